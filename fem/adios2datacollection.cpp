@@ -56,7 +56,10 @@ void ADIOS2DataCollection::Save()
             "MFEM ADIOS2DataCollection Save error: Mesh is null. Please call SetMesh before Save\n";
          mfem_error(error_message.c_str());
       }
-      stream->Print(*mesh);
+      // deferred: the mesh data is collected in the adios2 buffer and
+      // transported together with the fields at EndStep, instead of draining
+      // synchronously on the compute thread
+      stream->Print(*mesh, adios2stream::mode::deferred);
    }
 
    // reduce footprint
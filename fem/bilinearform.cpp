@@ -13,6 +13,7 @@
 
 #include "fem.hpp"
 #include "../general/device.hpp"
+#include "../general/profiler.hpp"
 #include <cmath>
 
 namespace mfem
@@ -22,12 +23,14 @@ void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
 
-   if (precompute_sparsity == 0 || fes->GetVDim() > 1)
+   if (precompute_sparsity == 0)
    {
       mat = new SparseMatrix(height);
       return;
    }
 
+   const int vdim = fes->GetVDim();
+   const int ndofs = fes->GetNDofs();
    const Table &elem_dof = fes->GetElementToDofTable();
    Table dof_dof;
 
@@ -40,27 +43,78 @@ void BilinearForm::AllocMat()
          mfem::Mult(*face_elem, elem_dof, face_dof);
          delete face_elem;
       }
-      Transpose(face_dof, dof_face, height);
+      Transpose(face_dof, dof_face, ndofs);
       mfem::Mult(dof_face, face_dof, dof_dof);
    }
    else
    {
       // the sparsity pattern is defined from the map: element->dof
       Table dof_elem;
-      Transpose(elem_dof, dof_elem, height);
+      Transpose(elem_dof, dof_elem, ndofs);
       mfem::Mult(dof_elem, elem_dof, dof_dof);
    }
 
    dof_dof.SortRows();
 
-   int *I = dof_dof.GetI();
-   int *J = dof_dof.GetJ();
-   double *data = Memory<double>(I[height]);
+   if (vdim == 1)
+   {
+      int *I = dof_dof.GetI();
+      int *J = dof_dof.GetJ();
+      double *data = Memory<double>(I[height]);
+
+      mat = new SparseMatrix(I, J, data, height, height, true, true, true);
+      *mat = 0.0;
 
-   mat = new SparseMatrix(I, J, data, height, height, true, true, true);
-   *mat = 0.0;
+      dof_dof.LoseData();
+   }
+   else
+   {
+      // Expand the scalar dof connectivity to vector dofs: every scalar
+      // entry (i,j) becomes a vdim x vdim block. The loop nesting below
+      // keeps the column indices of each row sorted for both orderings.
+      const int *sI = dof_dof.GetI();
+      const int *sJ = dof_dof.GetJ();
+      const bool by_nodes = (fes->GetOrdering() == Ordering::byNODES);
+
+      int *I = Memory<int>(height+1);
+      I[0] = 0;
+      for (int vi = 0; vi < height; vi++)
+      {
+         const int k = fes->VDofToDof(vi);
+         I[vi+1] = I[vi] + vdim*(sI[k+1] - sI[k]);
+      }
+      const int nnz = I[height];
+      int *J = Memory<int>(nnz);
+      double *data = Memory<double>(nnz);
+      for (int vi = 0; vi < height; vi++)
+      {
+         const int k = fes->VDofToDof(vi);
+         int pos = I[vi];
+         if (by_nodes)
+         {
+            for (int vd = 0; vd < vdim; vd++)
+            {
+               for (int s = sI[k]; s < sI[k+1]; s++)
+               {
+                  J[pos++] = fes->DofToVDof(sJ[s], vd);
+               }
+            }
+         }
+         else
+         {
+            for (int s = sI[k]; s < sI[k+1]; s++)
+            {
+               for (int vd = 0; vd < vdim; vd++)
+               {
+                  J[pos++] = fes->DofToVDof(sJ[s], vd);
+               }
+            }
+         }
+      }
 
-   dof_dof.LoseData();
+      mat = new SparseMatrix(I, J, data, height, height, true, true, true);
+      *mat = 0.0;
+   }
 }
 
 BilinearForm::BilinearForm(FiniteElementSpace * f)
@@ -100,6 +154,7 @@ BilinearForm::BilinearForm (FiniteElementSpace * f, BilinearForm * bf, int ps)
 
    // Copy the pointers to the integrators
    dbfi = bf->dbfi;
+   dbfi_marker = bf->dbfi_marker;
 
    bbfi = bf->bbfi;
    bbfi_marker = bf->bbfi_marker;
@@ -236,6 +291,14 @@ void BilinearForm::Finalize (int skip_zeros)
 void BilinearForm::AddDomainIntegrator(BilinearFormIntegrator *bfi)
 {
    dbfi.Append(bfi);
+   dbfi_marker.Append(NULL); // NULL marker means apply everywhere
+}
+
+void BilinearForm::AddDomainIntegrator(BilinearFormIntegrator *bfi,
+                                       Array<int> &elem_marker)
+{
+   dbfi.Append(bfi);
+   dbfi_marker.Append(&elem_marker);
 }
 
 void BilinearForm::AddBoundaryIntegrator (BilinearFormIntegrator * bfi)
@@ -374,8 +437,109 @@ void BilinearForm::AssembleBdrElementMatrix(
    }
 }
 
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+void BilinearForm::AssembleDomainColored(int skip_zeros)
+{
+   const int NE = fes->GetNE();
+   const Table &elem_dof = fes->GetElementToDofTable();
+
+   // Two elements sharing a dof write to the same matrix rows, so they must
+   // receive different colors. Assign each element, in order, the smallest
+   // color not already taken by a dof-neighbor.
+   Table dof_elem;
+   Transpose(elem_dof, dof_elem, fes->GetNDofs());
+
+   Array<int> color(NE);
+   color = -1;
+   Array<int> marker; // color -> last element that found it taken
+   int num_colors = 0;
+   for (int i = 0; i < NE; i++)
+   {
+      const int *dofs = elem_dof.GetRow(i);
+      for (int j = 0; j < elem_dof.RowSize(i); j++)
+      {
+         const int *els = dof_elem.GetRow(dofs[j]);
+         for (int k = 0; k < dof_elem.RowSize(dofs[j]); k++)
+         {
+            const int c = color[els[k]];
+            if (c >= 0) { marker[c] = i; }
+         }
+      }
+      int c = 0;
+      while (c < num_colors && marker[c] == i) { c++; }
+      if (c == num_colors) { marker.Append(-1); num_colors++; }
+      color[i] = c;
+   }
+
+   // Bucket the elements by color: elements of color c are listed in
+   // ordering[offsets[c]..offsets[c+1]).
+   Array<int> offsets(num_colors+1), ordering(NE);
+   offsets = 0;
+   for (int i = 0; i < NE; i++) { offsets[color[i]+1]++; }
+   offsets.PartialSum();
+   for (int i = 0; i < NE; i++) { ordering[offsets[color[i]]++] = i; }
+   for (int c = num_colors; c > 0; c--) { offsets[c] = offsets[c-1]; }
+   offsets[0] = 0;
+
+   // The integration rules are created on demand and cached in globally
+   // shared IntegrationRules containers, so assemble one element up front to
+   // keep the threads below from populating the cache concurrently. On mixed
+   // meshes some rules may still be created inside the parallel region --
+   // see also the note in ComputeElementMatrices().
+   if (NE > 0)
+   {
+      IsoparametricTransformation tr;
+      DenseMatrix el_mat;
+      fes->GetElementTransformation(0, &tr);
+      const FiniteElement &fe = *fes->GetFE(0);
+      for (int k = 0; k < dbfi.Size(); k++)
+      {
+         dbfi[k]->AssembleElementMatrix(fe, tr, el_mat);
+      }
+   }
+
+   for (int c = 0; c < num_colors; c++)
+   {
+      #pragma omp parallel for
+      for (int s = offsets[c]; s < offsets[c+1]; s++)
+      {
+         const int i = ordering[s];
+         Array<int> el_vdofs;
+         DenseMatrix el_mat, part_mat;
+         IsoparametricTransformation tr;
+
+         fes->GetElementVDofs(i, el_vdofs);
+         const FiniteElement &fe = *fes->GetFE(i);
+         fes->GetElementTransformation(i, &tr);
+         // note: some integrators may not be thread-safe
+         dbfi[0]->AssembleElementMatrix(fe, tr, el_mat);
+         for (int k = 1; k < dbfi.Size(); k++)
+         {
+            dbfi[k]->AssembleElementMatrix(fe, tr, part_mat);
+            el_mat += part_mat;
+         }
+         // Within a color the rows touched by different elements are
+         // disjoint, and with the static sparsity pattern Add() only
+         // searches the row and updates its values, so no locking is
+         // needed. Since the pattern cannot change, skip_zeros merely
+         // avoids searching the rows for entries known to be zero.
+         for (int r = 0; r < el_vdofs.Size(); r++)
+         {
+            for (int cl = 0; cl < el_vdofs.Size(); cl++)
+            {
+               const double a = el_mat(r, cl);
+               if (skip_zeros && a == 0.0) { continue; }
+               mat->Add(el_vdofs[r], el_vdofs[cl], a);
+            }
+         }
+      }
+   }
+}
+#endif // MFEM_USE_OPENMP && MFEM_THREAD_SAFE
+
 void BilinearForm::Assemble(int skip_zeros)
 {
+   MFEM_PROFILE_SCOPE("BilinearForm::Assemble");
    if (ext)
    {
       ext->Assemble();
@@ -386,11 +550,28 @@ void BilinearForm::Assemble(int skip_zeros)
    Mesh *mesh = fes -> GetMesh();
    DenseMatrix elmat, *elmat_p;
 
+   // Draw the element-matrix workspace from the per-thread scratch arena;
+   // the bulk reset before each element keeps assembly allocation-free in
+   // steady state.
+   ScratchArena &scratch = ScratchArena::ThreadInstance();
+
    if (mat == NULL)
    {
       AllocMat();
    }
 
+   bool marked_dbfi = false;
+   for (int k = 0; k < dbfi_marker.Size(); k++)
+   {
+      if (dbfi_marker[k]) { marked_dbfi = true; break; }
+   }
+   // Both keep per-element data structures that expect every element to be
+   // assembled, so elements skipped by the attribute markers would leave
+   // singular blocks behind.
+   MFEM_VERIFY(!marked_dbfi || (!static_cond && !hybridization),
+               "attribute-restricted domain integrators are not supported"
+               " with static condensation or hybridization");
+
 #ifdef MFEM_USE_LEGACY_OPENMP
    int free_element_matrices = 0;
    if (!element_matrices)
@@ -400,10 +581,65 @@ void BilinearForm::Assemble(int skip_zeros)
    }
 #endif
 
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+   // Assemble the elements concurrently in conflict-free batches; the static
+   // sparsity pattern enabled with UsePrecomputedSparsity() makes the matrix
+   // insertion lock-free.
+   const bool colored_assembly =
+      dbfi.Size() && !static_cond && !hybridization && !element_matrices &&
+      !marked_dbfi && mat->Finalized();
+   if (colored_assembly)
+   {
+      AssembleDomainColored(skip_zeros);
+   }
+
+   if (dbfi.Size() && !colored_assembly)
+#else
    if (dbfi.Size())
+#endif
    {
-      for (int i = 0; i < fes -> GetNE(); i++)
+      // Which element attributes need to be processed?
+      Array<int> elem_attr_marker(mesh->attributes.Size() ?
+                                  mesh->attributes.Max() : 0);
+      elem_attr_marker = 0;
+      bool all_attr = false;
+      for (int k = 0; k < dbfi.Size(); k++)
+      {
+         if (dbfi_marker[k] == NULL)
+         {
+            elem_attr_marker = 1;
+            all_attr = true;
+            break;
+         }
+         Array<int> &elem_marker = *dbfi_marker[k];
+         MFEM_ASSERT(elem_marker.Size() == elem_attr_marker.Size(),
+                     "invalid element marker for domain integrator #"
+                     << k << ", counting from zero");
+         for (int i = 0; i < elem_attr_marker.Size(); i++)
+         {
+            elem_attr_marker[i] |= elem_marker[i];
+         }
+      }
+
+      // When every domain integrator is attribute-restricted, visit only the
+      // elements of the marked attributes, using the per-attribute element
+      // lists cached on the mesh.
+      Array<int> marked_elems;
+      const bool use_attr_lists = !all_attr;
+      if (use_attr_lists)
       {
+         const Table &attr_elems = mesh->GetAttributeToElementTable();
+         for (int r = 0; r < mesh->attributes.Size(); r++)
+         {
+            if (elem_attr_marker[mesh->attributes[r]-1] == 0) { continue; }
+            marked_elems.Append(attr_elems.GetRow(r), attr_elems.RowSize(r));
+         }
+      }
+
+      const int num_elems = use_attr_lists ? marked_elems.Size() : fes->GetNE();
+      for (int m = 0; m < num_elems; m++)
+      {
+         const int i = use_attr_lists ? marked_elems[m] : m;
          fes->GetElementVDofs(i, vdofs);
          if (element_matrices)
          {
@@ -411,14 +647,29 @@ void BilinearForm::Assemble(int skip_zeros)
          }
          else
          {
+            const int elem_attr = mesh->GetAttribute(i);
             const FiniteElement &fe = *fes->GetFE(i);
             eltrans = fes->GetElementTransformation(i);
-            dbfi[0]->AssembleElementMatrix(fe, *eltrans, elmat);
-            for (int k = 1; k < dbfi.Size(); k++)
+            const int nd = vdofs.Size();
+            scratch.Reset();
+            elmat.Reset(scratch.Alloc<double>(nd*nd), nd, nd);
+            bool assembled = false;
+            for (int k = 0; k < dbfi.Size(); k++)
             {
-               dbfi[k]->AssembleElementMatrix(fe, *eltrans, elemmat);
-               elmat += elemmat;
+               if (dbfi_marker[k] &&
+                   (*dbfi_marker[k])[elem_attr-1] == 0) { continue; }
+               if (!assembled)
+               {
+                  dbfi[k]->AssembleElementMatrix(fe, *eltrans, elmat);
+                  assembled = true;
+               }
+               else
+               {
+                  dbfi[k]->AssembleElementMatrix(fe, *eltrans, elemmat);
+                  elmat += elemmat;
+               }
             }
+            if (!assembled) { continue; }
             elmat_p = &elmat;
          }
          if (static_cond)
@@ -467,6 +718,9 @@ void BilinearForm::Assemble(int skip_zeros)
          const FiniteElement &be = *fes->GetBE(i);
          fes -> GetBdrElementVDofs (i, vdofs);
          eltrans = fes -> GetBdrElementTransformation (i);
+         const int nd = vdofs.Size();
+         scratch.Reset();
+         elmat.Reset(scratch.Alloc<double>(nd*nd), nd, nd);
          int k = 0;
          for (; k < bbfi.Size(); k++)
          {
@@ -635,6 +889,8 @@ void BilinearForm::AssembleDiagonal(Vector &diag) const
          Vector local_diag(P->Height());
          ext->AssembleDiagonal(local_diag);
          const SparseMatrix *SP = dynamic_cast<const SparseMatrix*>(P);
+         const NCProlongationOperator *NCP =
+            dynamic_cast<const NCProlongationOperator*>(P);
 #ifdef MFEM_USE_MPI
          const HypreParMatrix *HP = dynamic_cast<const HypreParMatrix*>(P);
 #endif
@@ -642,6 +898,10 @@ void BilinearForm::AssembleDiagonal(Vector &diag) const
          {
             SP->AbsMultTranspose(local_diag, diag);
          }
+         else if (NCP)
+         {
+            NCP->AbsMultTranspose(local_diag, diag);
+         }
 #ifdef MFEM_USE_MPI
          else if (HP)
          {
@@ -848,6 +1108,13 @@ void BilinearForm::ComputeElementMatrices()
       return;
    }
 
+   for (int k = 0; k < dbfi_marker.Size(); k++)
+   {
+      MFEM_VERIFY(dbfi_marker[k] == NULL,
+                  "attribute-restricted domain integrators are not supported"
+                  " by ComputeElementMatrices");
+   }
+
    int num_elements = fes->GetNE();
    int num_dofs_per_el = fes->GetFE(0)->GetDof() * fes->GetVDim();
 
@@ -1080,6 +1347,17 @@ void BilinearForm::SetDiagonalPolicy(DiagonalPolicy policy)
    diag_policy = policy;
 }
 
+long BilinearForm::MemoryUsage() const
+{
+   long mem = sizeof(*this);
+   if (mat) { mem += mat->MemoryUsage(); }
+   if (mat_e) { mem += mat_e->MemoryUsage(); }
+   if (element_matrices) { mem += element_matrices->MemoryUsage(); }
+   mem += dbfi.MemoryUsage() + bbfi.MemoryUsage() +
+          fbfi.MemoryUsage() + bfbfi.MemoryUsage();
+   return mem;
+}
+
 BilinearForm::~BilinearForm()
 {
    delete mat_e;
@@ -1772,8 +2050,33 @@ MixedBilinearForm::~MixedBilinearForm()
 }
 
 
+void DiscreteLinearOperator::SetAssemblyLevel(AssemblyLevel assembly_level)
+{
+   if (ext)
+   {
+      MFEM_ABORT("the assembly level has already been set!");
+   }
+   assembly = assembly_level;
+   switch (assembly)
+   {
+      case AssemblyLevel::LEGACYFULL:
+         break;
+      case AssemblyLevel::PARTIAL:
+         ext = new PADiscreteLinearOperatorExtension(this);
+         break;
+      default:
+         mfem_error("Unsupported assembly level for DiscreteLinearOperator!");
+   }
+}
+
 void DiscreteLinearOperator::Assemble(int skip_zeros)
 {
+   if (ext)
+   {
+      ext->Assemble();
+      return;
+   }
+
    Array<int> dom_vdofs, ran_vdofs;
    ElementTransformation *T;
    const FiniteElement *dom_fe, *ran_fe;
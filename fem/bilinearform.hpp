@@ -83,6 +83,7 @@ protected:
 
    /// Set of Domain Integrators to be applied.
    Array<BilinearFormIntegrator*> dbfi;
+   Array<Array<int>*>             dbfi_marker; ///< Entries are not owned.
 
    /// Set of Boundary Integrators to be applied.
    Array<BilinearFormIntegrator*> bbfi;
@@ -112,6 +113,14 @@ protected:
    // Allocate appropriate SparseMatrix and assign it to mat
    void AllocMat();
 
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+   /** Assemble the domain integrals with OpenMP, processing the elements in
+       conflict-free batches obtained from a greedy coloring of the
+       element-element graph induced by shared dofs. Requires a matrix with
+       precomputed (static) sparsity, see UsePrecomputedSparsity(). */
+   void AssembleDomainColored(int skip_zeros);
+#endif
+
    void ConformingAssemble();
 
    // may be used in the construction of derived classes
@@ -218,6 +227,10 @@ public:
 
    /// Access all the integrators added with AddDomainIntegrator().
    Array<BilinearFormIntegrator*> *GetDBFI() { return &dbfi; }
+   /** @brief Access all element attribute markers added with
+       AddDomainIntegrator(). If no marker was specified when the integrator
+       was added, the corresponding pointer (to Array<int>) will be NULL. */
+   Array<Array<int>*> *GetDBFI_Marker() { return &dbfi_marker; }
 
    /// Access all the integrators added with AddBoundaryIntegrator().
    Array<BilinearFormIntegrator*> *GetBBFI() { return &bbfi; }
@@ -324,6 +337,14 @@ public:
    /// Adds new Domain Integrator. Assumes ownership of @a bfi.
    void AddDomainIntegrator(BilinearFormIntegrator *bfi);
 
+   /** @brief Adds new Domain Integrator, restricted to specific element
+       attributes.
+
+       Assumes ownership of @a bfi. The array @a elem_marker is stored
+       internally as a pointer to the given Array<int> object. */
+   void AddDomainIntegrator(BilinearFormIntegrator *bfi,
+                            Array<int> &elem_marker);
+
    /// Adds new Boundary Integrator. Assumes ownership of @a bfi.
    void AddBoundaryIntegrator(BilinearFormIntegrator *bfi);
 
@@ -588,6 +609,10 @@ public:
    /// Indicate that integrators are not owned by the BilinearForm
    void UseExternalIntegrators() { extern_bfs = 1; };
 
+   /** @brief Return the memory used by the assembled matrices and the
+       stored element matrices, in bytes. */
+   long MemoryUsage() const;
+
    /// Destroys bilinear form.
    virtual ~BilinearForm();
 };
@@ -977,8 +1002,13 @@ public:
    /// Access all interpolators added with AddDomainInterpolator().
    Array<BilinearFormIntegrator*> *GetDI() { return &dbfi; }
 
+   /// Set the desired assembly level. The default is AssemblyLevel::LEGACYFULL.
+   /** This method must be called before assembly. */
+   void SetAssemblyLevel(AssemblyLevel assembly_level);
+
    /** @brief Construct the internal matrix representation of the discrete
-       linear operator. */
+       linear operator. For partial assembly, the matrix-free action is set up
+       instead and can be used through Mult()/MultTranspose(). */
    virtual void Assemble(int skip_zeros = 1);
 };
 
@@ -13,10 +13,13 @@
 // PABilinearFormExtension and MFBilinearFormExtension.
 
 #include "../general/forall.hpp"
+#include "../general/profiler.hpp"
 #include "bilinearform.hpp"
 #include "libceed/ceed.hpp"
 #include "pgridfunc.hpp"
 
+#include <typeinfo>
+
 namespace mfem
 {
 
@@ -44,8 +47,19 @@ PABilinearFormExtension::PABilinearFormExtension(BilinearForm *form)
      testFes(a->FESpace())
 {
    elem_restrict = NULL;
+   elem_restrict_identity = false;
    int_face_restrict_lex = NULL;
    bdr_face_restrict_lex = NULL;
+#ifdef MFEM_USE_CEED
+   ceed_oper = NULL;
+#endif
+}
+
+PABilinearFormExtension::~PABilinearFormExtension()
+{
+#ifdef MFEM_USE_CEED
+   if (ceed_oper) { CeedOperatorDestroy(&ceed_oper); }
+#endif
 }
 
 void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
@@ -54,7 +68,12 @@ void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
                                  ElementDofOrdering::LEXICOGRAPHIC:
                                  ElementDofOrdering::NATIVE;
    elem_restrict = trialFes->GetElementRestriction(ordering);
-   if (elem_restrict)
+   // When the DOFs of the space are already numbered in E-vector order (L2
+   // spaces with one component, lexicographically for tensor elements), the
+   // apply paths work on the L-vectors directly and the E-vector work
+   // vectors are not needed.
+   elem_restrict_identity = trialFes->IsElementRestrictionIdentity();
+   if (elem_restrict && !elem_restrict_identity)
    {
       localX.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
       localY.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
@@ -96,6 +115,26 @@ void PABilinearFormExtension::Assemble()
       integrators[i]->AssemblePA(*a->FESpace());
    }
 
+   SetupMaskedElems();
+
+#ifdef MFEM_USE_CEED
+   // When all the domain integrators were assembled with libCEED, fuse their
+   // operators into one composite operator so that Mult() performs a single
+   // CeedOperatorApply instead of one per integrator.
+   if (ceed_oper) { CeedOperatorDestroy(&ceed_oper); }
+   if (DeviceCanUseCeed() && integratorCount > 1)
+   {
+      Array<const CeedData*> ceed_data(integratorCount);
+      bool all_ceed = true;
+      for (int i = 0; i < integratorCount; ++i)
+      {
+         ceed_data[i] = integrators[i]->GetCeedData();
+         all_ceed = all_ceed && (ceed_data[i] != NULL);
+      }
+      if (all_ceed) { CeedCompositePAOperator(ceed_data, &ceed_oper); }
+   }
+#endif
+
    MFEM_VERIFY(a->GetBBFI()->Size() == 0,
                "Partial assembly does not support AddBoundaryIntegrator yet.");
 
@@ -114,17 +153,101 @@ void PABilinearFormExtension::Assemble()
    }
 }
 
+void PABilinearFormExtension::SetupMaskedElems()
+{
+   // The PA and EA kernels compute all elements, so an attribute-restricted
+   // domain integrator is assembled or applied into a scratch vector whose
+   // blocks of excluded elements are zeroed before the accumulation, see
+   // AddMultDomainPA() and EABilinearFormExtension::Assemble(). Collect the
+   // excluded elements of each integrator here, using the per-attribute
+   // element lists cached on the mesh.
+   Mesh &mesh = *a->FESpace()->GetMesh();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   const int integratorCount = elem_markers.Size();
+   maskedElems.SetSize(0);
+   maskedElemOffsets.SetSize(integratorCount+1);
+   maskedElemOffsets[0] = 0;
+   for (int i = 0; i < integratorCount; ++i)
+   {
+      if (elem_markers[i])
+      {
+         MFEM_VERIFY(!DeviceCanUseCeed(),
+                     "Partial assembly with libCEED does not support domain"
+                     " attribute markers.");
+         const Array<int> &marker = *elem_markers[i];
+         const Table &attr_elems = mesh.GetAttributeToElementTable();
+         for (int r = 0; r < mesh.attributes.Size(); r++)
+         {
+            if (marker[mesh.attributes[r]-1]) { continue; }
+            maskedElems.Append(attr_elems.GetRow(r), attr_elems.RowSize(r));
+         }
+      }
+      maskedElemOffsets[i+1] = maskedElems.Size();
+   }
+}
+
+void PABilinearFormExtension::ZeroMaskedElems(const int i, Vector &Y) const
+{
+   const int begin = maskedElemOffsets[i];
+   const int nexcl = maskedElemOffsets[i+1] - begin;
+   const int ne = trialFes->GetNE();
+   const int edofs = Y.Size()/ne;
+   const int *d_excl = maskedElems.Read() + begin;
+   auto d_Y = Reshape(Y.ReadWrite(), edofs, ne);
+   MFEM_FORALL(gid, nexcl*edofs,
+   {
+      d_Y(gid%edofs, d_excl[gid/edofs]) = 0.0;
+   });
+}
+
+void PABilinearFormExtension::AddMultDomainPA(const int i, const Vector &X,
+                                              Vector &Y,
+                                              const bool transpose) const
+{
+   BilinearFormIntegrator &integ = *(*a->GetDBFI())[i];
+   if (maskedElemOffsets[i] == maskedElemOffsets[i+1])
+   {
+      if (transpose) { integ.AddMultTransposePA(X, Y); }
+      else           { integ.AddMultPA(X, Y); }
+      return;
+   }
+   maskedY.SetSize(Y.Size(), Device::GetDeviceMemoryType());
+   maskedY.UseDevice(true);
+   maskedY = 0.0;
+   if (transpose) { integ.AddMultTransposePA(X, maskedY); }
+   else           { integ.AddMultPA(X, maskedY); }
+   ZeroMaskedElems(i, maskedY);
+   Y += maskedY;
+}
+
+void PABilinearFormExtension::AssembleDiagonalDomainPA(const int i,
+                                                       Vector &Y) const
+{
+   BilinearFormIntegrator &integ = *(*a->GetDBFI())[i];
+   if (maskedElemOffsets[i] == maskedElemOffsets[i+1])
+   {
+      integ.AssembleDiagonalPA(Y);
+      return;
+   }
+   maskedY.SetSize(Y.Size(), Device::GetDeviceMemoryType());
+   maskedY.UseDevice(true);
+   maskedY = 0.0;
+   integ.AssembleDiagonalPA(maskedY);
+   ZeroMaskedElems(i, maskedY);
+   Y += maskedY;
+}
+
 void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
 
    const int iSz = integrators.Size();
-   if (elem_restrict && !DeviceCanUseCeed())
+   if (elem_restrict && !elem_restrict_identity && !DeviceCanUseCeed())
    {
       localY = 0.0;
       for (int i = 0; i < iSz; ++i)
       {
-         integrators[i]->AssembleDiagonalPA(localY);
+         AssembleDiagonalDomainPA(i, localY);
       }
       const ElementRestriction* H1elem_restrict =
          dynamic_cast<const ElementRestriction*>(elem_restrict);
@@ -143,7 +266,37 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
       y = 0.0;
       for (int i = 0; i < iSz; ++i)
       {
-         integrators[i]->AssembleDiagonalPA(y);
+         AssembleDiagonalDomainPA(i, y);
+      }
+   }
+
+   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
+   const int iFISz = intFaceIntegrators.Size();
+   if (int_face_restrict_lex && iFISz>0)
+   {
+      if (faceIntY.Size()>0)
+      {
+         faceIntY = 0.0;
+         for (int i = 0; i < iFISz; ++i)
+         {
+            intFaceIntegrators[i]->AssembleDiagonalPA(faceIntY);
+         }
+         int_face_restrict_lex->MultTranspose(faceIntY, y);
+      }
+   }
+
+   Array<BilinearFormIntegrator*> &bdrFaceIntegrators = *a->GetBFBFI();
+   const int bFISz = bdrFaceIntegrators.Size();
+   if (bdr_face_restrict_lex && bFISz>0)
+   {
+      if (faceBdrY.Size()>0)
+      {
+         faceBdrY = 0.0;
+         for (int i = 0; i < bFISz; ++i)
+         {
+            bdrFaceIntegrators[i]->AssembleDiagonalPA(faceBdrY);
+         }
+         bdr_face_restrict_lex->MultTranspose(faceBdrY, y);
       }
    }
 }
@@ -181,31 +334,91 @@ void PABilinearFormExtension::FormLinearSystem(const Array<int> &ess_tdof_list,
 
 void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
 {
+   MFEM_PROFILE_SCOPE("PABilinearFormExtension::Mult");
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
+   Array<BilinearFormIntegrator*> &bdrFaceIntegrators = *a->GetBFBFI();
 
    const int iSz = integrators.Size();
-   if (DeviceCanUseCeed() || !elem_restrict)
+   const int iFISz = intFaceIntegrators.Size();
+   const int bFISz = bdrFaceIntegrators.Size();
+
+   // With the CUDA backend, the domain, interior face and boundary face terms
+   // are computed on separate streams: they read x and write disjoint
+   // intermediate vectors, so only the final accumulations into y have to be
+   // ordered, which is done with events right before the transposed
+   // restrictions. See CuSetStreamTag().
+   const bool multi_stream = Device::Allows(Backend::CUDA) &&
+                             ((int_face_restrict_lex && iFISz > 0) ||
+                              (bdr_face_restrict_lex && bFISz > 0));
+   int last_event = 0;
+
+   if (multi_stream) { CuSetStreamTag(1); }
+   if (DeviceCanUseCeed() || !elem_restrict || elem_restrict_identity)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
       y = 0.0;
-      for (int i = 0; i < iSz; ++i)
+#ifdef MFEM_USE_CEED
+      if (ceed_oper)
       {
-         integrators[i]->AddMultPA(x, y);
+         // All the domain integrators are applied with a single fused
+         // CeedOperatorApply; the work vectors of the first integrator are
+         // used to wrap x and y.
+         CeedAddMultPA(ceed_oper, integrators[0]->GetCeedData(), x, y);
+      }
+      else
+#endif
+      {
+         for (int i = 0; i < iSz; ++i)
+         {
+            AddMultDomainPA(i, x, y);
+         }
       }
    }
    else
    {
       elem_restrict->Mult(x, localX);
       localY = 0.0;
-      for (int i = 0; i < iSz; ++i)
+      // The common mass+diffusion (e.g. Helmholtz) and H(curl) mass+curl-curl
+      // (e.g. Maxwell) pairs are applied with one fused kernel that shares
+      // the dof-to-quadrature transformations. Attribute-restricted pairs
+      // are not fused, since their contributions are masked per integrator.
+      bool fused = false;
+      if (iSz == 2 && maskedElems.Size() == 0)
       {
-         integrators[i]->AddMultPA(localX, localY);
+         for (int i = 0; i < 2 && !fused; ++i)
+         {
+            if (typeid(*integrators[i]) == typeid(MassIntegrator) &&
+                typeid(*integrators[1-i]) == typeid(DiffusionIntegrator))
+            {
+               const MassIntegrator &mass =
+                  *static_cast<const MassIntegrator*>(integrators[i]);
+               const DiffusionIntegrator &diffusion =
+                  *static_cast<const DiffusionIntegrator*>(integrators[1-i]);
+               fused = diffusion.AddMultFusedPA(mass, localX, localY);
+            }
+            else if (typeid(*integrators[i]) == typeid(VectorFEMassIntegrator) &&
+                     typeid(*integrators[1-i]) == typeid(CurlCurlIntegrator))
+            {
+               const VectorFEMassIntegrator &mass =
+                  *static_cast<const VectorFEMassIntegrator*>(integrators[i]);
+               const CurlCurlIntegrator &curlcurl =
+                  *static_cast<const CurlCurlIntegrator*>(integrators[1-i]);
+               fused = curlcurl.AddMultFusedPA(mass, localX, localY);
+            }
+         }
+      }
+      if (!fused)
+      {
+         for (int i = 0; i < iSz; ++i)
+         {
+            AddMultDomainPA(i, localX, localY);
+         }
       }
       elem_restrict->MultTranspose(localY, y);
    }
+   if (multi_stream) { CuEventRecord(last_event); CuSetStreamTag(2); }
 
-   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
-   const int iFISz = intFaceIntegrators.Size();
    if (int_face_restrict_lex && iFISz>0)
    {
       int_face_restrict_lex->Mult(x, faceIntX);
@@ -216,12 +429,13 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
          {
             intFaceIntegrators[i]->AddMultPA(faceIntX, faceIntY);
          }
+         if (multi_stream) { CuEventWait(last_event); }
          int_face_restrict_lex->MultTranspose(faceIntY, y);
+         if (multi_stream) { CuEventRecord(++last_event); }
       }
    }
+   if (multi_stream) { CuSetStreamTag(3); }
 
-   Array<BilinearFormIntegrator*> &bdrFaceIntegrators = *a->GetBFBFI();
-   const int bFISz = bdrFaceIntegrators.Size();
    if (bdr_face_restrict_lex && bFISz>0)
    {
       bdr_face_restrict_lex->Mult(x, faceBdrX);
@@ -232,22 +446,38 @@ void PABilinearFormExtension::Mult(const Vector &x, Vector &y) const
          {
             bdrFaceIntegrators[i]->AddMultPA(faceBdrX, faceBdrY);
          }
+         if (multi_stream) { CuEventWait(last_event); }
          bdr_face_restrict_lex->MultTranspose(faceBdrY, y);
       }
    }
+   if (multi_stream) { CuSetStreamTag(0); }
 }
 
 void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 {
+   MFEM_PROFILE_SCOPE("PABilinearFormExtension::MultTranspose");
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
+   Array<BilinearFormIntegrator*> &bdrFaceIntegrators = *a->GetBFBFI();
+
    const int iSz = integrators.Size();
-   if (elem_restrict)
+   const int iFISz = intFaceIntegrators.Size();
+   const int bFISz = bdrFaceIntegrators.Size();
+
+   // Multi-stream scheduling of the independent terms, as in Mult() above.
+   const bool multi_stream = Device::Allows(Backend::CUDA) &&
+                             ((int_face_restrict_lex && iFISz > 0) ||
+                              (bdr_face_restrict_lex && bFISz > 0));
+   int last_event = 0;
+
+   if (multi_stream) { CuSetStreamTag(1); }
+   if (elem_restrict && !elem_restrict_identity)
    {
       elem_restrict->Mult(x, localX);
       localY = 0.0;
       for (int i = 0; i < iSz; ++i)
       {
-         integrators[i]->AddMultTransposePA(localX, localY);
+         AddMultDomainPA(i, localX, localY, /*transpose*/ true);
       }
       elem_restrict->MultTranspose(localY, y);
    }
@@ -257,12 +487,11 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
       y = 0.0;
       for (int i = 0; i < iSz; ++i)
       {
-         integrators[i]->AddMultTransposePA(x, y);
+         AddMultDomainPA(i, x, y, /*transpose*/ true);
       }
    }
+   if (multi_stream) { CuEventRecord(last_event); CuSetStreamTag(2); }
 
-   Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
-   const int iFISz = intFaceIntegrators.Size();
    if (int_face_restrict_lex && iFISz>0)
    {
       int_face_restrict_lex->Mult(x, faceIntX);
@@ -273,12 +502,13 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
          {
             intFaceIntegrators[i]->AddMultTransposePA(faceIntX, faceIntY);
          }
+         if (multi_stream) { CuEventWait(last_event); }
          int_face_restrict_lex->MultTranspose(faceIntY, y);
+         if (multi_stream) { CuEventRecord(++last_event); }
       }
    }
+   if (multi_stream) { CuSetStreamTag(3); }
 
-   Array<BilinearFormIntegrator*> &bdrFaceIntegrators = *a->GetBFBFI();
-   const int bFISz = bdrFaceIntegrators.Size();
    if (bdr_face_restrict_lex && bFISz>0)
    {
       bdr_face_restrict_lex->Mult(x, faceBdrX);
@@ -289,9 +519,11 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
          {
             bdrFaceIntegrators[i]->AddMultTransposePA(faceBdrX, faceBdrY);
          }
+         if (multi_stream) { CuEventWait(last_event); }
          bdr_face_restrict_lex->MultTranspose(faceBdrY, y);
       }
    }
+   if (multi_stream) { CuSetStreamTag(0); }
 }
 
 // Data and methods for element-assembled bilinear forms
@@ -311,11 +543,27 @@ void EABilinearFormExtension::Assemble()
    ea_data.SetSize(ne*elemDofs*elemDofs, Device::GetMemoryType());
    ea_data.UseDevice(true);
 
+   SetupMaskedElems();
+
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    const int integratorCount = integrators.Size();
    for (int i = 0; i < integratorCount; ++i)
    {
-      integrators[i]->AssembleEA(*a->FESpace(), ea_data, i);
+      if (maskedElemOffsets[i] == maskedElemOffsets[i+1])
+      {
+         integrators[i]->AssembleEA(*a->FESpace(), ea_data, i);
+      }
+      else
+      {
+         // An attribute-restricted integrator is assembled separately and
+         // the element matrices of its excluded elements are discarded.
+         if (i == 0) { ea_data = 0.0; }
+         maskedY.SetSize(ea_data.Size(), Device::GetMemoryType());
+         maskedY.UseDevice(true);
+         integrators[i]->AssembleEA(*a->FESpace(), maskedY, false);
+         ZeroMaskedElems(i, maskedY);
+         ea_data += maskedY;
+      }
    }
 
    faceDofs = trialFes ->
@@ -369,7 +617,8 @@ void EABilinearFormExtension::Assemble()
 void EABilinearFormExtension::Mult(const Vector &x, Vector &y) const
 {
    // Apply the Element Restriction
-   const bool useRestrict = !DeviceCanUseCeed() && elem_restrict;
+   const bool useRestrict = !DeviceCanUseCeed() && elem_restrict &&
+                            !elem_restrict_identity;
    if (!useRestrict)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
@@ -495,7 +744,8 @@ void EABilinearFormExtension::Mult(const Vector &x, Vector &y) const
 void EABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 {
    // Apply the Element Restriction
-   const bool useRestrict = DeviceCanUseCeed() || !elem_restrict;
+   const bool useRestrict = !DeviceCanUseCeed() && elem_restrict &&
+                            !elem_restrict_identity;
    if (!useRestrict)
    {
       y.UseDevice(true); // typically this is a large vector, so store on device
@@ -1021,4 +1271,106 @@ void PAMixedBilinearFormExtension::AssembleDiagonal_ADAt(const Vector &D,
    }
 }
 
+PADiscreteLinearOperatorExtension::PADiscreteLinearOperatorExtension(
+   DiscreteLinearOperator *linop)
+   : PAMixedBilinearFormExtension(linop)
+{
+}
+
+void PADiscreteLinearOperatorExtension::Assemble()
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   const int integratorCount = integrators.Size();
+   for (int i = 0; i < integratorCount; ++i)
+   {
+      integrators[i]->AssemblePA(*trialFes, *testFes);
+   }
+   MFEM_VERIFY(a->GetBBFI()->Size() == 0 && a->GetTFBFI()->Size() == 0 &&
+               a->GetBTFBFI()->Size() == 0,
+               "Partial assembly does not support boundary or trace"
+               " interpolators yet.");
+
+   // Count the number of elements contributing to each test dof: the element
+   // contributions are equal, so the transposed restriction below must
+   // average them instead of summing.
+   MFEM_VERIFY(elem_restrict_test, "a test-space element restriction is"
+               " required for partially assembled interpolators");
+   test_multiplicity.UseDevice(true);
+   test_multiplicity.SetSize(elem_restrict_test->Width());
+   Vector ones(elem_restrict_test->Height());
+   ones.UseDevice(true);
+   ones = 1.0;
+   const ElementRestriction *elem_restrict =
+      dynamic_cast<const ElementRestriction*>(elem_restrict_test);
+   if (elem_restrict)
+   {
+      elem_restrict->MultTransposeUnsigned(ones, test_multiplicity);
+   }
+   else
+   {
+      // e.g. an L2 test space, where every dof belongs to one element
+      elem_restrict_test->MultTranspose(ones, test_multiplicity);
+   }
+   auto tm = test_multiplicity.ReadWrite();
+   MFEM_FORALL(i, test_multiplicity.Size(), tm[i] = 1.0/tm[i]; );
+}
+
+void PADiscreteLinearOperatorExtension::AddMult(
+   const Vector &x, Vector &y, const double c) const
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   const int iSz = integrators.Size();
+
+   // * G operation
+   SetupMultInputs(elem_restrict_trial, x, localTrial,
+                   elem_restrict_test, y, localTest, c);
+
+   // * B^TDB operation
+   for (int i = 0; i < iSz; ++i)
+   {
+      integrators[i]->AddMultPA(localTrial, localTest);
+   }
+
+   // * G^T operation, averaging the element contributions
+   tempY.SetSize(y.Size());
+   elem_restrict_test->MultTranspose(localTest, tempY);
+   const auto tm = test_multiplicity.Read();
+   auto ty = tempY.ReadWrite();
+   MFEM_FORALL(i, tempY.Size(), ty[i] *= tm[i]; );
+   y += tempY;
+}
+
+void PADiscreteLinearOperatorExtension::AddMultTranspose(
+   const Vector &x, Vector &y, const double c) const
+{
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   const int iSz = integrators.Size();
+
+   // the transpose of the averaged transposed restriction in AddMult()
+   xscaled.UseDevice(true);
+   xscaled.SetSize(x.Size());
+   xscaled = x;
+   const auto tm = test_multiplicity.Read();
+   auto xs = xscaled.ReadWrite();
+   MFEM_FORALL(i, xscaled.Size(), xs[i] *= tm[i]; );
+
+   // * G operation
+   SetupMultInputs(elem_restrict_test, xscaled, localTest,
+                   elem_restrict_trial, y, localTrial, c);
+
+   // * B^TD^TB operation
+   for (int i = 0; i < iSz; ++i)
+   {
+      integrators[i]->AddMultTransposePA(localTest, localTrial);
+   }
+
+   // * G^T operation
+   if (elem_restrict_trial)
+   {
+      tempY.SetSize(y.Size());
+      elem_restrict_trial->MultTranspose(localTrial, tempY);
+      y += tempY;
+   }
+}
+
 } // namespace mfem
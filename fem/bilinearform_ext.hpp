@@ -15,12 +15,14 @@
 #include "../config/config.hpp"
 #include "fespace.hpp"
 #include "../general/device.hpp"
+#include "libceed/ceed.hpp"
 
 namespace mfem
 {
 
 class BilinearForm;
 class MixedBilinearForm;
+class DiscreteLinearOperator;
 
 /// Class extending the BilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
@@ -71,11 +73,27 @@ protected:
    mutable Vector faceIntX, faceIntY;
    mutable Vector faceBdrX, faceBdrY;
    const Operator *elem_restrict; // Not owned
+   /// True when elem_restrict is the identity, see
+   /// FiniteElementSpace::IsElementRestrictionIdentity(). The apply paths
+   /// then skip the E-vector copies and work on the L-vectors directly.
+   bool elem_restrict_identity;
    const Operator *int_face_restrict_lex; // Not owned
    const Operator *bdr_face_restrict_lex; // Not owned
+   /** Excluded elements of the attribute-restricted domain integrators:
+       integrator i skips the elements listed in
+       maskedElems[maskedElemOffsets[i]..maskedElemOffsets[i+1]). Built in
+       Assemble() from the element lists cached on the mesh. */
+   Array<int> maskedElems, maskedElemOffsets;
+   /// Scratch E-vector for the attribute-restricted domain integrators.
+   mutable Vector maskedY;
+#ifdef MFEM_USE_CEED
+   /// Composite libCEED operator fusing all domain integrators, when possible.
+   CeedOperator ceed_oper;
+#endif
 
 public:
    PABilinearFormExtension(BilinearForm*);
+   virtual ~PABilinearFormExtension();
 
    void Assemble();
    void AssembleDiagonal(Vector &diag) const;
@@ -90,6 +108,21 @@ public:
 
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
+
+   /// Build #maskedElems and #maskedElemOffsets from the element attribute
+   /// markers of the domain integrators.
+   void SetupMaskedElems();
+
+   /** Apply domain integrator @a i to the E-vector @a X, adding into the
+       E-vector @a Y. Attribute-restricted integrators are computed into
+       #maskedY whose blocks of excluded elements are zeroed before the
+       accumulation into @a Y. */
+   void AddMultDomainPA(const int i, const Vector &X, Vector &Y,
+                        const bool transpose = false) const;
+   /// The AssembleDiagonalPA() analogue of AddMultDomainPA().
+   void AssembleDiagonalDomainPA(const int i, Vector &Y) const;
+   /// Zero the blocks of @a Y of the elements excluded by integrator @a i.
+   void ZeroMaskedElems(const int i, Vector &Y) const;
 };
 
 /// Data and methods for element-assembled bilinear forms
@@ -205,7 +238,7 @@ protected:
    mutable Vector localTrial, localTest, tempY;
    const Operator *elem_restrict_trial; // Not owned
    const Operator *elem_restrict_test;  // Not owned
-private:
+
    /// Helper function to set up inputs/outputs for Mult or MultTranspose
    void SetupMultInputs(const Operator *elem_restrict_x,
                         const Vector &x, Vector &localX,
@@ -251,6 +284,30 @@ public:
    void Update();
 };
 
+
+/** @brief Data and methods for partially-assembled discrete linear operators
+
+    The action differs from PAMixedBilinearFormExtension in that the element
+    contributions to a shared test dof are averaged instead of summed, matching
+    the "overwrite" semantics of DiscreteLinearOperator::Assemble(). */
+class PADiscreteLinearOperatorExtension : public PAMixedBilinearFormExtension
+{
+public:
+   PADiscreteLinearOperatorExtension(DiscreteLinearOperator *linop);
+
+   /// Partial assembly of all internal integrators
+   void Assemble();
+
+   void AddMult(const Vector &x, Vector &y, const double c=1.0) const;
+
+   void AddMultTranspose(const Vector &x, Vector &y, const double c=1.0) const;
+
+private:
+   /// Inverse of the number of elements contributing to each test dof
+   Vector test_multiplicity;
+   mutable Vector xscaled;
+};
+
 }
 
 #endif
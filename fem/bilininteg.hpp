@@ -49,6 +49,13 @@ public:
 
    using NonlinearFormIntegrator::AssemblePA;
 
+#ifdef MFEM_USE_CEED
+   /** @brief Return the libCEED PA data of the integrator, or NULL when the
+       integrator has not been assembled with libCEED. Used to compose the
+       libCEED operators of several integrators into one composite operator. */
+   virtual const CeedData *GetCeedData() const { return NULL; }
+#endif
+
    /// Method defining partial assembly.
    /** The result of the partial assembly is stored internally so that it can be
        used later in the methods AddMultPA() and AddMultTransposePA(). */
@@ -1868,6 +1875,8 @@ public:
                                          ElementTransformation &Trans);
 };
 
+class MassIntegrator;
+
 /** Class for integrating the bilinear form a(u,v) := (Q grad u, grad v) where Q
     can be a scalar or a matrix coefficient. */
 class DiffusionIntegrator: public BilinearFormIntegrator
@@ -1891,6 +1900,9 @@ private:
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, dofs1D, quad1D;
    Vector pa_data;
+   /// Single precision #pa_data, see EnableReducedPrecisionPA().
+   Array<float> pa_data_f32;
+   bool pa_reduced = false;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
 #ifdef MFEM_USE_CEED
    // CEED extension
@@ -1950,6 +1962,15 @@ public:
 #endif
    }
 
+   /// Access the scalar, vector and matrix coefficients (NULL when not set).
+   Coefficient *GetCoefficient() const { return Q; }
+   VectorCoefficient *GetVectorCoefficient() const { return VQ; }
+   MatrixCoefficient *GetMatrixCoefficient() const { return MQ; }
+
+#ifdef MFEM_USE_CEED
+   virtual const CeedData *GetCeedData() const { return ceedDataPtr; }
+#endif
+
    virtual ~DiffusionIntegrator()
    {
 #ifdef MFEM_USE_CEED
@@ -1994,10 +2015,40 @@ public:
 
    virtual void AddMultPA(const Vector&, Vector&) const;
 
+   /** @brief Fused partially assembled action y += (M + K) x, where K is this
+       diffusion operator and M is the mass operator assembled by @a mass.
+
+       The two actions share one dof-to-quadrature transformation, halving the
+       E-vector traffic of applying the integrators separately. Returns false
+       without modifying @a y when @a mass was not assembled with the same
+       basis maps as this integrator, in which case the caller should fall
+       back to separate applications. */
+   bool AddMultFusedPA(const MassIntegrator &mass,
+                       const Vector &x, Vector &y) const;
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe);
 
    void SetupPA(const FiniteElementSpace &fes);
+
+   /** @brief Re-evaluate the coefficient at quadrature points and rebuild the
+       partial assembly data, reusing the geometry factors and basis maps
+       cached by a previous AssemblePA() call.
+
+       When only the coefficient changes between assemblies, this costs a
+       single pointwise pass over the quadrature data instead of a full
+       setup. */
+   void UpdateCoefficientPA();
+
+   /** @brief Store the partial assembly quadrature data in single precision.
+
+       The apply kernels convert the stored values back to double precision
+       on load, so only the memory footprint and bandwidth of the quadrature
+       data are reduced; all arithmetic stays in double precision. Must be
+       enabled before assembly. Element assembly does not support this mode
+       and the fused mass-diffusion action falls back to separate
+       applications. */
+   void EnableReducedPrecisionPA(bool enable = true) { pa_reduced = enable; }
 };
 
 /** Class for local mass matrix assembling a(u,v) := (Q u, v) */
@@ -2011,15 +2062,30 @@ protected:
    // PA extension
    const FiniteElementSpace *fespace;
    Vector pa_data;
+   /// Single precision #pa_data, see EnableReducedPrecisionPA().
+   Array<float> pa_data_f32;
+   bool pa_reduced = false;
    const DofToQuad *maps;         ///< Not owned
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
 
+   /** Geometry-partitioned PA data for mixed meshes: the elements are grouped
+       into batches by geometry type, with one entry per batch in the arrays
+       below. The quad/hex batches use the sum-factorized tensor kernels and
+       the remaining batches (e.g. wedges) use the dense basis kernels. */
+   Array<const GeometryElementRestriction*> batch_restr; ///< Not owned
+   Array<const DofToQuad*> batch_maps;                   ///< Not owned
+   Array<int> batch_offsets; ///< Offsets of the batches in #pa_data
+   mutable Vector batch_x, batch_y; ///< Batch E-vector work buffers
+
 #ifdef MFEM_USE_CEED
    // CEED extension
    CeedData* ceedDataPtr;
 #endif
 
+   // Grant access to the PA data for the fused mass+diffusion action.
+   friend class DiffusionIntegrator;
+
 public:
    MassIntegrator(const IntegrationRule *ir = NULL)
       : BilinearFormIntegrator(ir)
@@ -2043,6 +2109,10 @@ public:
 #endif
    }
 
+#ifdef MFEM_USE_CEED
+   virtual const CeedData *GetCeedData() const { return ceedDataPtr; }
+#endif
+
    virtual ~MassIntegrator()
    {
 #ifdef MFEM_USE_CEED
@@ -2070,11 +2140,24 @@ public:
 
    virtual void AddMultPA(const Vector&, Vector&) const;
 
+   /** @brief Store the partial assembly quadrature data in single precision.
+
+       The apply kernels convert the stored values back to double precision
+       on load, so only the memory footprint and bandwidth of the quadrature
+       data are reduced; all arithmetic stays in double precision. Must be
+       enabled before assembly. Element assembly does not support this mode;
+       the geometry batches of mixed meshes keep double precision storage. */
+   void EnableReducedPrecisionPA(bool enable = true) { pa_reduced = enable; }
+
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
                                          ElementTransformation &Trans);
 
    void SetupPA(const FiniteElementSpace &fes);
+   /// Geometry-partitioned PA setup for mixed meshes.
+   void SetupPAMixed(const FiniteElementSpace &fes);
+   /// Geometry-partitioned PA action for mixed meshes, on L-vectors.
+   void AddMultPAMixed(const Vector &x, Vector &y) const;
 };
 
 /** Mass integrator (u, v) restricted to the boundary of a domain */
@@ -2102,6 +2185,10 @@ protected:
    const DofToQuad *maps;         ///< Not owned
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+#ifdef MFEM_USE_CEED
+   // CEED extension
+   CeedData* ceedDataPtr = NULL;
+#endif
 
 private:
 #ifndef MFEM_THREAD_SAFE
@@ -2112,12 +2199,24 @@ private:
 public:
    ConvectionIntegrator(VectorCoefficient &q, double a = 1.0)
       : Q(&q) { alpha = a; }
+
+   virtual ~ConvectionIntegrator()
+   {
+#ifdef MFEM_USE_CEED
+      delete ceedDataPtr;
+#endif
+   }
+
    virtual void AssembleElementMatrix(const FiniteElement &,
                                       ElementTransformation &,
                                       DenseMatrix &);
 
    using BilinearFormIntegrator::AssemblePA;
 
+#ifdef MFEM_USE_CEED
+   virtual const CeedData *GetCeedData() const { return ceedDataPtr; }
+#endif
+
    virtual void AssemblePA(const FiniteElementSpace&);
 
    virtual void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
@@ -2173,6 +2272,10 @@ protected:
    const DofToQuad *maps;         ///< Not owned
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+#ifdef MFEM_USE_CEED
+   // CEED extension
+   CeedData* ceedDataPtr = NULL;
+#endif
 
 public:
    /// Construct an integrator with coefficient 1.0
@@ -2196,6 +2299,17 @@ public:
    int GetVDim() const { return vdim; }
    void SetVDim(int vdim) { this->vdim = vdim; }
 
+   virtual ~VectorMassIntegrator()
+   {
+#ifdef MFEM_USE_CEED
+      delete ceedDataPtr;
+#endif
+   }
+
+#ifdef MFEM_USE_CEED
+   virtual const CeedData *GetCeedData() const { return ceedDataPtr; }
+#endif
+
    virtual void AssembleElementMatrix(const FiniteElement &el,
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
@@ -2333,6 +2447,8 @@ public:
 };
 
 /// Integrator for (curl u, curl v) for Nedelec elements
+class VectorFEMassIntegrator;
+
 class CurlCurlIntegrator: public BilinearFormIntegrator
 {
 private:
@@ -2385,6 +2501,18 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &fes);
    virtual void AddMultPA(const Vector &x, Vector &y) const;
    virtual void AssembleDiagonalPA(Vector& diag);
+
+   /** @brief Apply y += (M + K) x with a single fused kernel, where M is the
+       partially assembled H(curl) mass operator @a mass and K is this
+       partially assembled curl-curl operator.
+
+       The fused kernel shares the element dof-to-quadrature contractions and
+       the E-vector reads and writes between the two operators. Returns false,
+       without modifying @a y, when the two integrators are not assembled on
+       the same 3D Nedelec space and quadrature rule, in which case the two
+       operators have to be applied separately. */
+   bool AddMultFusedPA(const VectorFEMassIntegrator &mass,
+                       const Vector &x, Vector &y) const;
 };
 
 /** Integrator for (curl u, curl v) for FE spaces defined by 'dim' copies of a
@@ -2448,6 +2576,9 @@ protected:
    int dim, ne, nq, dofs1D, dofs1Dtest, quad1D, trial_fetype, test_fetype;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
 
+   // Grant access to the PA data for the fused mass+curl-curl action.
+   friend class CurlCurlIntegrator;
+
 public:
    VectorFEMassIntegrator() { Init(NULL, NULL, NULL); }
    VectorFEMassIntegrator(Coefficient *_q) { Init(_q, NULL, NULL); }
@@ -2569,6 +2700,10 @@ protected:
    const GeometricFactors *geom;  ///< Not owned
    int dim, sdim, ne, dofs1D, quad1D;
    Vector pa_data;
+#ifdef MFEM_USE_CEED
+   // CEED extension
+   CeedData* ceedDataPtr = NULL;
+#endif
 
 private:
    DenseMatrix dshape, dshapedxt, pelmat;
@@ -2578,6 +2713,17 @@ public:
    VectorDiffusionIntegrator() { Q = NULL; }
    VectorDiffusionIntegrator(Coefficient &q) { Q = &q; }
 
+   virtual ~VectorDiffusionIntegrator()
+   {
+#ifdef MFEM_USE_CEED
+      delete ceedDataPtr;
+#endif
+   }
+
+#ifdef MFEM_USE_CEED
+   virtual const CeedData *GetCeedData() const { return ceedDataPtr; }
+#endif
+
    virtual void AssembleElementMatrix(const FiniteElement &el,
                                       ElementTransformation &Trans,
                                       DenseMatrix &elmat);
@@ -2601,6 +2747,12 @@ protected:
    double q_lambda, q_mu;
    Coefficient *lambda, *mu;
 
+   // PA extension
+   const DofToQuad *maps;         ///< Not owned
+   const GeometricFactors *geom;  ///< Not owned
+   int dim, ne, dofs1D, quad1D;
+   Vector pa_data;
+
 private:
 #ifndef MFEM_THREAD_SAFE
    Vector shape;
@@ -2646,6 +2798,11 @@ public:
    virtual double ComputeFluxEnergy(const FiniteElement &fluxelem,
                                     ElementTransformation &Trans,
                                     Vector &flux, Vector *d_energy = NULL);
+
+   using BilinearFormIntegrator::AssemblePA;
+   virtual void AssemblePA(const FiniteElementSpace &fes);
+   virtual void AssembleDiagonalPA(Vector &diag);
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
 };
 
 /** Integrator for the DG form:
@@ -2696,6 +2853,8 @@ public:
 
    virtual void AddMultPA(const Vector&, Vector&) const;
 
+   virtual void AssembleDiagonalPA(Vector &diag);
+
    virtual void AssembleEAInteriorFaces(const FiniteElementSpace& fes,
                                         Vector &ea_data_int,
                                         Vector &ea_data_ext,
@@ -2912,6 +3071,24 @@ public:
                                        ElementTransformation &Trans,
                                        DenseMatrix &elmat)
    { nd_fe.ProjectGrad(h1_fe, Trans, elmat); }
+
+   using BilinearFormIntegrator::AssemblePA;
+
+   /** @brief Setup method for PA data. Assumes tensor-product elements with an
+       H1 trial space and an H(curl) test space using the default closed
+       Gauss-Lobatto and open Gauss-Legendre points. */
+   virtual void AssemblePA(const FiniteElementSpace &trial_fes,
+                           const FiniteElementSpace &test_fes);
+
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
+   virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
+
+private:
+   // PA extension: the reference-space gradient is geometry independent, so
+   // the only data are the 1D values and derivatives of the trial basis at
+   // the closed and open dof points of the test space.
+   Array<double> B_c, B_ct, G_o, G_ot;
+   int dim, ne, o_dofs1D, c_dofs1D;
 };
 
 
@@ -2940,6 +3117,27 @@ public:
                                        ElementTransformation &Trans,
                                        DenseMatrix &elmat)
    { ran_fe.ProjectCurl(dom_fe, Trans, elmat); }
+
+   using BilinearFormIntegrator::AssemblePA;
+
+   /** @brief Setup method for PA data. Assumes 3D tensor-product elements
+       with an H(curl) trial space and an H(div) test space, both using the
+       default closed Gauss-Lobatto and open Gauss-Legendre points. */
+   virtual void AssemblePA(const FiniteElementSpace &trial_fes,
+                           const FiniteElementSpace &test_fes);
+
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
+   virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
+
+private:
+   // PA extension: the reference-space curl is geometry independent. The
+   // DofToQuad maps hold the trial 1D bases evaluated at the closed and open
+   // dof points of the test space.
+   const DofToQuad *maps_C_C; ///< Closed trial basis at closed test points
+   const DofToQuad *maps_C_O; ///< Closed trial basis at open test points
+   const DofToQuad *maps_O_O; ///< Open trial basis at open test points
+   int dim, ne, o_dofs1D, c_dofs1D;
+   IntegrationRule ir_c, ir_o; ///< Tensor rules at the test-space dof points
 };
 
 
@@ -2959,6 +3157,29 @@ public:
                                        ElementTransformation &Trans,
                                        DenseMatrix &elmat)
    { ran_fe.ProjectDiv(dom_fe, Trans, elmat); }
+
+   using BilinearFormIntegrator::AssemblePA;
+
+   /** @brief Setup method for PA data. Assumes tensor-product elements with
+       an H(div) trial space and a nodal L2 test space whose nodes coincide
+       with the open points of the trial space. */
+   virtual void AssemblePA(const FiniteElementSpace &trial_fes,
+                           const FiniteElementSpace &test_fes);
+
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
+   virtual void AddMultTransposePA(const Vector &x, Vector &y) const;
+
+private:
+   // PA extension: the reference-space divergence combines with the nodal L2
+   // dofs through the factor 1/det(J) at the test-space nodes, stored in
+   // pa_data; the DofToQuad maps hold the trial 1D bases at those nodes.
+   const DofToQuad *maps_C_N;          ///< Closed trial basis at the L2 nodes
+   const DofToQuad *maps_O_N;          ///< Open trial basis at the L2 nodes
+   const GeometricFactors *geom;       ///< Not owned
+   int dim, ne, o_dofs1D, c_dofs1D, n_dofs1D;
+   Vector pa_data;
+   mutable Vector e_buf; ///< Workspace for the unscaled reference divergence
+   IntegrationRule ir_n; ///< Tensor rule at the test-space nodes
 };
 
 
@@ -3060,11 +3281,13 @@ protected:
 
 
 
-// PA Diffusion Assemble 2D kernel
+// PA Diffusion Assemble 2D kernel; with @a affine true, @a j holds one
+// (compressed) Jacobian per element, see GeometricFactors::compressed.
 template<const int T_SDIM>
 void PADiffusionSetup2D(const int Q1D,
                         const int coeffDim,
                         const int NE,
+                        const bool affine,
                         const Array<double> &w,
                         const Vector &j,
                         const Vector &c,
@@ -12,6 +12,7 @@
 #include "../general/forall.hpp"
 #include "bilininteg.hpp"
 #include "gridfunc.hpp"
+#include "libceed/convection.hpp"
 
 using namespace std;
 
@@ -21,7 +22,7 @@ namespace mfem
 // PA Convection Integrator
 
 // PA Convection Assemble 2D kernel
-static void PAConvectionSetup2D(const int Q1D,
+static void PAConvectionSetup2D(const int NQ,
                                 const int ne,
                                 const Array<double> &w,
                                 const Vector &j,
@@ -30,7 +31,6 @@ static void PAConvectionSetup2D(const int Q1D,
                                 Vector &op)
 {
    const int NE = ne;
-   const int NQ = Q1D*Q1D;
    auto W = w.Read();
 
    auto J = Reshape(j.Read(), NQ, 2, 2, NE);
@@ -60,7 +60,7 @@ static void PAConvectionSetup2D(const int Q1D,
 }
 
 // PA Convection Assemble 3D kernel
-static void PAConvectionSetup3D(const int Q1D,
+static void PAConvectionSetup3D(const int NQ,
                                 const int NE,
                                 const Array<double> &w,
                                 const Vector &j,
@@ -68,7 +68,6 @@ static void PAConvectionSetup3D(const int Q1D,
                                 const double alpha,
                                 Vector &op)
 {
-   const int NQ = Q1D*Q1D*Q1D;
    auto W = w.Read();
    auto J = Reshape(j.Read(), NQ, 3, 3, NE);
    const bool const_v = vel.Size() == 3;
@@ -114,8 +113,7 @@ static void PAConvectionSetup3D(const int Q1D,
 }
 
 static void PAConvectionSetup(const int dim,
-                              const int D1D,
-                              const int Q1D,
+                              const int NQ,
                               const int NE,
                               const Array<double> &W,
                               const Vector &J,
@@ -126,14 +124,110 @@ static void PAConvectionSetup(const int dim,
    if (dim == 1) { MFEM_ABORT("dim==1 not supported in PAConvectionSetup"); }
    if (dim == 2)
    {
-      PAConvectionSetup2D(Q1D, NE, W, J, coeff, alpha, op);
+      PAConvectionSetup2D(NQ, NE, W, J, coeff, alpha, op);
    }
    if (dim == 3)
    {
-      PAConvectionSetup3D(Q1D, NE, W, J, coeff, alpha, op);
+      PAConvectionSetup3D(NQ, NE, W, J, coeff, alpha, op);
+   }
+}
+
+#ifdef MFEM_USE_OCCA
+// OCCA PA Convection Apply 2D kernel
+static void OccaPAConvectionApply2D(const int D1D,
+                                    const int Q1D,
+                                    const int NE,
+                                    const Array<double> &B,
+                                    const Array<double> &G,
+                                    const Array<double> &Bt,
+                                    const Vector &op,
+                                    const Vector &X,
+                                    Vector &Y)
+{
+   occa::properties props;
+   props["defines/D1D"] = D1D;
+   props["defines/Q1D"] = Q1D;
+   const occa::memory o_B = OccaMemoryRead(B.GetMemory(), B.Size());
+   const occa::memory o_G = OccaMemoryRead(G.GetMemory(), G.Size());
+   const occa::memory o_Bt = OccaMemoryRead(Bt.GetMemory(), Bt.Size());
+   const occa::memory o_op = OccaMemoryRead(op.GetMemory(), op.Size());
+   const occa::memory o_X = OccaMemoryRead(X.GetMemory(), X.Size());
+   occa::memory o_Y = OccaMemoryReadWrite(Y.GetMemory(), Y.Size());
+   const occa_id_t id = std::make_pair(D1D,Q1D);
+   if (!Device::Allows(Backend::OCCA_CUDA))
+   {
+      static occa_kernel_t OccaConvApply2D_cpu;
+      if (OccaConvApply2D_cpu.find(id) == OccaConvApply2D_cpu.end())
+      {
+         const occa::kernel ConvectionApply2D_CPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "ConvectionApply2D_CPU", props);
+         OccaConvApply2D_cpu.emplace(id, ConvectionApply2D_CPU);
+      }
+      OccaConvApply2D_cpu.at(id)(NE, o_B, o_G, o_Bt, o_op, o_X, o_Y);
+   }
+   else
+   {
+      static occa_kernel_t OccaConvApply2D_gpu;
+      if (OccaConvApply2D_gpu.find(id) == OccaConvApply2D_gpu.end())
+      {
+         const occa::kernel ConvectionApply2D_GPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "ConvectionApply2D_GPU", props);
+         OccaConvApply2D_gpu.emplace(id, ConvectionApply2D_GPU);
+      }
+      OccaConvApply2D_gpu.at(id)(NE, o_B, o_G, o_Bt, o_op, o_X, o_Y);
    }
 }
 
+// OCCA PA Convection Apply 3D kernel
+static void OccaPAConvectionApply3D(const int D1D,
+                                    const int Q1D,
+                                    const int NE,
+                                    const Array<double> &B,
+                                    const Array<double> &G,
+                                    const Array<double> &Bt,
+                                    const Vector &op,
+                                    const Vector &X,
+                                    Vector &Y)
+{
+   occa::properties props;
+   props["defines/D1D"] = D1D;
+   props["defines/Q1D"] = Q1D;
+   const occa::memory o_B = OccaMemoryRead(B.GetMemory(), B.Size());
+   const occa::memory o_G = OccaMemoryRead(G.GetMemory(), G.Size());
+   const occa::memory o_Bt = OccaMemoryRead(Bt.GetMemory(), Bt.Size());
+   const occa::memory o_op = OccaMemoryRead(op.GetMemory(), op.Size());
+   const occa::memory o_X = OccaMemoryRead(X.GetMemory(), X.Size());
+   occa::memory o_Y = OccaMemoryReadWrite(Y.GetMemory(), Y.Size());
+   const occa_id_t id = std::make_pair(D1D,Q1D);
+   if (!Device::Allows(Backend::OCCA_CUDA))
+   {
+      static occa_kernel_t OccaConvApply3D_cpu;
+      if (OccaConvApply3D_cpu.find(id) == OccaConvApply3D_cpu.end())
+      {
+         const occa::kernel ConvectionApply3D_CPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "ConvectionApply3D_CPU", props);
+         OccaConvApply3D_cpu.emplace(id, ConvectionApply3D_CPU);
+      }
+      OccaConvApply3D_cpu.at(id)(NE, o_B, o_G, o_Bt, o_op, o_X, o_Y);
+   }
+   else
+   {
+      static occa_kernel_t OccaConvApply3D_gpu;
+      if (OccaConvApply3D_gpu.find(id) == OccaConvApply3D_gpu.end())
+      {
+         const occa::kernel ConvectionApply3D_GPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "ConvectionApply3D_GPU", props);
+         OccaConvApply3D_gpu.emplace(id, ConvectionApply3D_GPU);
+      }
+      OccaConvApply3D_gpu.at(id)(NE, o_B, o_G, o_Bt, o_op, o_X, o_Y);
+   }
+}
+#endif // MFEM_USE_OCCA
+
 // PA Convection Apply 2D kernel
 template<int T_D1D = 0, int T_Q1D = 0> static
 void PAConvectionApply2D(const int ne,
@@ -766,20 +860,85 @@ void SmemPAConvectionApply3D(const int ne,
    });
 }
 
+// PA Convection Apply kernel for non-tensor elements, batched over elements
+// using the dense basis and gradient matrices evaluated at the quadrature
+// points.
+static void PAConvectionApplySimplex(const int dim,
+                                     const int ND,
+                                     const int NQ,
+                                     const int NE,
+                                     const Array<double> &b,
+                                     const Array<double> &g,
+                                     const Vector &_op,
+                                     const Vector &_x,
+                                     Vector &_y)
+{
+   constexpr int max_NQ = MAX_Q1D*MAX_Q1D*MAX_Q1D;
+   MFEM_VERIFY(NQ <= max_NQ, "");
+   const int DIM = dim;
+   auto B = Reshape(b.Read(), NQ, ND);
+   auto G = Reshape(g.Read(), NQ, DIM, ND);
+   auto op = Reshape(_op.Read(), NQ, DIM, NE);
+   auto x = Reshape(_x.Read(), ND, NE);
+   auto y = Reshape(_y.ReadWrite(), ND, NE);
+   MFEM_FORALL_2D(e, NE, NQ, 1, 1,
+   {
+      MFEM_SHARED double DGu[max_NQ];
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         double dot = 0.0;
+         for (int i = 0; i < DIM; ++i)
+         {
+            double grad = 0.0;
+            for (int d = 0; d < ND; ++d)
+            {
+               grad += G(q,i,d) * x(d,e);
+            }
+            dot += op(q,i,e) * grad;
+         }
+         DGu[q] = dot;
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(d,x,ND)
+      {
+         double res = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            res += B(q,d) * DGu[q];
+         }
+         y(d,e) += res;
+      }
+   });
+}
+
 void ConvectionIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
-   // Assumes tensor-product elements
    Mesh *mesh = fes.GetMesh();
    const FiniteElement &el = *fes.GetFE(0);
    ElementTransformation &Trans = *fes.GetElementTransformation(0);
    const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, Trans);
+#ifdef MFEM_USE_CEED
+   if (DeviceCanUseCeed())
+   {
+      if (ceedDataPtr) { delete ceedDataPtr; }
+      CeedData* ptr = new CeedData();
+      ceedDataPtr = ptr;
+      InitCeedVecCoeff(Q, ptr);
+      return CeedPAConvectionAssemble(fes, *ir, alpha, *ptr);
+   }
+#endif
    const int dims = el.GetDim();
    const int symmDims = dims;
    const int nq = ir->GetNPoints();
    dim = mesh->Dimension();
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   // Use the sum-factorized kernels for tensor-product elements and fall back
+   // to the dense basis-at-quadrature-points kernel otherwise.
+   const DofToQuad::Mode mode =
+      dynamic_cast<const TensorBasisElement*>(&el) ?
+      DofToQuad::TENSOR : DofToQuad::FULL;
+   maps = &el.GetDofToQuad(*ir, mode);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
    pa_data.SetSize(symmDims * nq * ne, Device::GetMemoryType());
@@ -820,7 +979,7 @@ void ConvectionIntegrator::AssemblePA(const FiniteElementSpace &fes)
          }
       }
    }
-   PAConvectionSetup(dim, dofs1D, quad1D, ne, ir->GetWeights(), geom->J,
+   PAConvectionSetup(dim, nq, ne, ir->GetWeights(), geom->J,
                      vel, alpha, pa_data);
 }
 
@@ -836,6 +995,20 @@ static void PAConvectionApply(const int dim,
                               const Vector &x,
                               Vector &y)
 {
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca())
+   {
+      if (dim == 2)
+      {
+         return OccaPAConvectionApply2D(D1D,Q1D,NE,B,G,Bt,op,x,y);
+      }
+      if (dim == 3)
+      {
+         return OccaPAConvectionApply3D(D1D,Q1D,NE,B,G,Bt,op,x,y);
+      }
+      MFEM_ABORT("OCCA PA Convection Apply unknown kernel!");
+   }
+#endif // MFEM_USE_OCCA
    if (dim == 2)
    {
       switch ((D1D << 4 ) | Q1D)
@@ -871,6 +1044,19 @@ static void PAConvectionApply(const int dim,
 // PA Convection Apply kernel
 void ConvectionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+#ifdef MFEM_USE_CEED
+   if (DeviceCanUseCeed())
+   {
+      CeedAddMultPA(ceedDataPtr, x, y);
+      return;
+   }
+#endif
+   if (maps->mode == DofToQuad::FULL)
+   {
+      PAConvectionApplySimplex(dim, dofs1D, quad1D, ne,
+                               maps->B, maps->G, pa_data, x, y);
+      return;
+   }
    PAConvectionApply(dim, dofs1D, quad1D, ne,
                      maps->B, maps->G, maps->Bt, maps->Gt,
                      pa_data, x, y);
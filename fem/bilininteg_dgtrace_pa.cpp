@@ -1129,6 +1129,131 @@ static void PADGTraceApplyTranspose(const int dim,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA DGTrace Assemble Diagonal 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0> static
+void PADGTraceAssembleDiagonal2D(const int NF,
+                                 const Array<double> &b,
+                                 const Vector &_op,
+                                 Vector &_diag,
+                                 const int d1d = 0,
+                                 const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto op = Reshape(_op.Read(), Q1D, 2, 2, NF);
+   auto diag = Reshape(_diag.ReadWrite(), D1D, 2, NF);
+   MFEM_FORALL(f, NF,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      for (int d = 0; d < D1D; d++)
+      {
+         double val0 = 0.0;
+         double val1 = 0.0;
+         for (int q = 0; q < Q1D; ++q)
+         {
+            const double b2 = B(q,d) * B(q,d);
+            val0 += b2 * op(q,0,0,f);
+            val1 += b2 * op(q,1,1,f);
+         }
+         diag(d,0,f) += val0;
+         diag(d,1,f) += val1;
+      }
+   });
+}
+
+// PA DGTrace Assemble Diagonal 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0> static
+void PADGTraceAssembleDiagonal3D(const int NF,
+                                 const Array<double> &b,
+                                 const Vector &_op,
+                                 Vector &_diag,
+                                 const int d1d = 0,
+                                 const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto op = Reshape(_op.Read(), Q1D, Q1D, 2, 2, NF);
+   auto diag = Reshape(_diag.ReadWrite(), D1D, D1D, 2, NF);
+   MFEM_FORALL_3D(f, NF, D1D, D1D, 1,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      MFEM_FOREACH_THREAD(d1,x,D1D)
+      {
+         MFEM_FOREACH_THREAD(d2,y,D1D)
+         {
+            double val0 = 0.0;
+            double val1 = 0.0;
+            for (int q1 = 0; q1 < Q1D; ++q1)
+            {
+               const double b1 = B(q1,d1) * B(q1,d1);
+               for (int q2 = 0; q2 < Q1D; ++q2)
+               {
+                  const double b2 = b1 * B(q2,d2) * B(q2,d2);
+                  val0 += b2 * op(q1,q2,0,0,f);
+                  val1 += b2 * op(q1,q2,1,1,f);
+               }
+            }
+            diag(d1,d2,0,f) += val0;
+            diag(d1,d2,1,f) += val1;
+         }
+      }
+   });
+}
+
+static void PADGTraceAssembleDiagonal(const int dim,
+                                      const int D1D,
+                                      const int Q1D,
+                                      const int NF,
+                                      const Array<double> &B,
+                                      const Vector &op,
+                                      Vector &diag)
+{
+   if (dim == 2)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x22: return PADGTraceAssembleDiagonal2D<2,2>(NF,B,op,diag);
+         case 0x33: return PADGTraceAssembleDiagonal2D<3,3>(NF,B,op,diag);
+         case 0x44: return PADGTraceAssembleDiagonal2D<4,4>(NF,B,op,diag);
+         case 0x55: return PADGTraceAssembleDiagonal2D<5,5>(NF,B,op,diag);
+         case 0x66: return PADGTraceAssembleDiagonal2D<6,6>(NF,B,op,diag);
+         case 0x77: return PADGTraceAssembleDiagonal2D<7,7>(NF,B,op,diag);
+         case 0x88: return PADGTraceAssembleDiagonal2D<8,8>(NF,B,op,diag);
+         case 0x99: return PADGTraceAssembleDiagonal2D<9,9>(NF,B,op,diag);
+         default: return PADGTraceAssembleDiagonal2D(NF,B,op,diag,D1D,Q1D);
+      }
+   }
+   else if (dim == 3)
+   {
+      switch ((D1D << 4 ) | Q1D)
+      {
+         case 0x23: return PADGTraceAssembleDiagonal3D<2,3>(NF,B,op,diag);
+         case 0x34: return PADGTraceAssembleDiagonal3D<3,4>(NF,B,op,diag);
+         case 0x45: return PADGTraceAssembleDiagonal3D<4,5>(NF,B,op,diag);
+         case 0x56: return PADGTraceAssembleDiagonal3D<5,6>(NF,B,op,diag);
+         case 0x67: return PADGTraceAssembleDiagonal3D<6,7>(NF,B,op,diag);
+         case 0x78: return PADGTraceAssembleDiagonal3D<7,8>(NF,B,op,diag);
+         case 0x89: return PADGTraceAssembleDiagonal3D<8,9>(NF,B,op,diag);
+         default: return PADGTraceAssembleDiagonal3D(NF,B,op,diag,D1D,Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+void DGTraceIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   PADGTraceAssembleDiagonal(dim, dofs1D, quad1D, nf,
+                             maps->B, pa_data, diag);
+}
+
 // PA DGTraceIntegrator Apply kernel
 void DGTraceIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
@@ -246,6 +246,8 @@ void DiffusionIntegrator::AssembleEA(const FiniteElementSpace &fes,
                                      Vector &ea_data,
                                      const bool add)
 {
+   MFEM_VERIFY(!pa_reduced, "element assembly does not support the reduced"
+               " precision quadrature data");
    AssemblePA(fes);
    const int ne = fes.GetMesh()->GetNE();
    const Array<double> &B = maps->B;
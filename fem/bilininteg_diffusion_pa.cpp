@@ -10,10 +10,16 @@
 // CONTRIBUTING.md for details.
 
 #include "../general/forall.hpp"
+#include "../general/jit.hpp"
+#include "../linalg/kernels.hpp"
+#include "../linalg/simd.hpp"
 #include "bilininteg.hpp"
 #include "gridfunc.hpp"
+#include "kernel_dispatch.hpp"
 #include "libceed/diffusion.hpp"
 
+#include <sstream>
+
 using namespace std;
 
 namespace mfem
@@ -84,6 +90,7 @@ template<>
 void PADiffusionSetup2D<2>(const int Q1D,
                            const int coeffDim,
                            const int NE,
+                           const bool affine,
                            const Array<double> &w,
                            const Vector &j,
                            const Vector &c,
@@ -94,7 +101,10 @@ void PADiffusionSetup2D<2>(const int Q1D,
    MFEM_VERIFY(coeffDim < 3 ||
                !const_c, "Constant matrix coefficient not supported");
    const auto W = Reshape(w.Read(), Q1D,Q1D);
-   const auto J = Reshape(j.Read(), Q1D,Q1D,2,2,NE);
+   // with affine (compressed) geometric factors, J holds one Jacobian per
+   // element instead of one per quadrature point
+   const int JQ1D = affine ? 1 : Q1D;
+   const auto J = Reshape(j.Read(), JQ1D,JQ1D,2,2,NE);
    const auto C = const_c ? Reshape(c.Read(), 1,1,1,1) :
                   Reshape(c.Read(), coeffDim,Q1D,Q1D,NE);
    auto D = Reshape(d.Write(), Q1D,Q1D, symmetric ? 3 : 4, NE);
@@ -104,11 +114,16 @@ void PADiffusionSetup2D<2>(const int Q1D,
       {
          MFEM_FOREACH_THREAD(qy,y,Q1D)
          {
-            const double J11 = J(qx,qy,0,0,e);
-            const double J21 = J(qx,qy,1,0,e);
-            const double J12 = J(qx,qy,0,1,e);
-            const double J22 = J(qx,qy,1,1,e);
-            const double w_detJ = W(qx,qy) / ((J11*J22)-(J21*J12));
+            const int jx = affine ? 0 : qx;
+            const int jy = affine ? 0 : qy;
+            const double Jloc[4] =
+            {
+               J(jx,jy,0,0,e), J(jx,jy,1,0,e),
+               J(jx,jy,0,1,e), J(jx,jy,1,1,e)
+            };
+            const double J11 = Jloc[0], J21 = Jloc[1];
+            const double J12 = Jloc[2], J22 = Jloc[3];
+            const double w_detJ = W(qx,qy) / kernels::Det<2>(Jloc);
             if (coeffDim == 3 || coeffDim == 4) // Matrix coefficient
             {
                // First compute entries of R = MJ^{-T}, without det J factor.
@@ -151,6 +166,7 @@ template<>
 void PADiffusionSetup2D<3>(const int Q1D,
                            const int coeffDim,
                            const int NE,
+                           const bool affine,
                            const Array<double> &w,
                            const Vector &j,
                            const Vector &c,
@@ -161,7 +177,8 @@ void PADiffusionSetup2D<3>(const int Q1D,
    constexpr int SDIM = 3;
    const bool const_c = c.Size() == 1;
    const auto W = Reshape(w.Read(), Q1D,Q1D);
-   const auto J = Reshape(j.Read(), Q1D,Q1D,SDIM,DIM,NE);
+   const int JQ1D = affine ? 1 : Q1D;
+   const auto J = Reshape(j.Read(), JQ1D,JQ1D,SDIM,DIM,NE);
    const auto C = const_c ? Reshape(c.Read(), 1,1,1) :
                   Reshape(c.Read(), Q1D,Q1D,NE);
    auto D = Reshape(d.Write(), Q1D,Q1D, 3, NE);
@@ -171,13 +188,15 @@ void PADiffusionSetup2D<3>(const int Q1D,
       {
          MFEM_FOREACH_THREAD(qy,y,Q1D)
          {
+            const int jx = affine ? 0 : qx;
+            const int jy = affine ? 0 : qy;
             const double wq = W(qx,qy);
-            const double J11 = J(qx,qy,0,0,e);
-            const double J21 = J(qx,qy,1,0,e);
-            const double J31 = J(qx,qy,2,0,e);
-            const double J12 = J(qx,qy,0,1,e);
-            const double J22 = J(qx,qy,1,1,e);
-            const double J32 = J(qx,qy,2,1,e);
+            const double J11 = J(jx,jy,0,0,e);
+            const double J21 = J(jx,jy,1,0,e);
+            const double J31 = J(jx,jy,2,0,e);
+            const double J12 = J(jx,jy,0,1,e);
+            const double J22 = J(jx,jy,1,1,e);
+            const double J32 = J(jx,jy,2,1,e);
             const double E = J11*J11 + J21*J21 + J31*J31;
             const double G = J12*J12 + J22*J22 + J32*J32;
             const double F = J11*J12 + J21*J22 + J31*J32;
@@ -196,6 +215,7 @@ void PADiffusionSetup2D<3>(const int Q1D,
 void PADiffusionSetup3D(const int Q1D,
                         const int coeffDim,
                         const int NE,
+                        const bool affine,
                         const Array<double> &w,
                         const Vector &j,
                         const Vector &c,
@@ -206,7 +226,8 @@ void PADiffusionSetup3D(const int Q1D,
    MFEM_VERIFY(coeffDim < 6 ||
                !const_c, "Constant matrix coefficient not supported");
    const auto W = Reshape(w.Read(), Q1D,Q1D,Q1D);
-   const auto J = Reshape(j.Read(), Q1D,Q1D,Q1D,3,3,NE);
+   const int JQ1D = affine ? 1 : Q1D;
+   const auto J = Reshape(j.Read(), JQ1D,JQ1D,JQ1D,3,3,NE);
    const auto C = const_c ? Reshape(c.Read(), 1,1,1,1,1) :
                   Reshape(c.Read(), coeffDim,Q1D,Q1D,Q1D,NE);
    auto D = Reshape(d.Write(), Q1D,Q1D,Q1D, symmetric ? 6 : 9, NE);
@@ -218,29 +239,21 @@ void PADiffusionSetup3D(const int Q1D,
          {
             MFEM_FOREACH_THREAD(qz,z,Q1D)
             {
-               const double J11 = J(qx,qy,qz,0,0,e);
-               const double J21 = J(qx,qy,qz,1,0,e);
-               const double J31 = J(qx,qy,qz,2,0,e);
-               const double J12 = J(qx,qy,qz,0,1,e);
-               const double J22 = J(qx,qy,qz,1,1,e);
-               const double J32 = J(qx,qy,qz,2,1,e);
-               const double J13 = J(qx,qy,qz,0,2,e);
-               const double J23 = J(qx,qy,qz,1,2,e);
-               const double J33 = J(qx,qy,qz,2,2,e);
-               const double detJ = J11 * (J22 * J33 - J32 * J23) -
-               /* */               J21 * (J12 * J33 - J32 * J13) +
-               /* */               J31 * (J12 * J23 - J22 * J13);
-               const double w_detJ = W(qx,qy,qz) / detJ;
-               // adj(J)
-               const double A11 = (J22 * J33) - (J23 * J32);
-               const double A12 = (J32 * J13) - (J12 * J33);
-               const double A13 = (J12 * J23) - (J22 * J13);
-               const double A21 = (J31 * J23) - (J21 * J33);
-               const double A22 = (J11 * J33) - (J13 * J31);
-               const double A23 = (J21 * J13) - (J11 * J23);
-               const double A31 = (J21 * J32) - (J31 * J22);
-               const double A32 = (J31 * J12) - (J11 * J32);
-               const double A33 = (J11 * J22) - (J12 * J21);
+               const int jx = affine ? 0 : qx;
+               const int jy = affine ? 0 : qy;
+               const int jz = affine ? 0 : qz;
+               const double Jloc[9] =
+               {
+                  J(jx,jy,jz,0,0,e), J(jx,jy,jz,1,0,e), J(jx,jy,jz,2,0,e),
+                  J(jx,jy,jz,0,1,e), J(jx,jy,jz,1,1,e), J(jx,jy,jz,2,1,e),
+                  J(jx,jy,jz,0,2,e), J(jx,jy,jz,1,2,e), J(jx,jy,jz,2,2,e)
+               };
+               const double w_detJ = W(qx,qy,qz) / kernels::Det<3>(Jloc);
+               double adjJ[9];
+               kernels::CalcAdjugate<3>(Jloc, adjJ);
+               const double A11 = adjJ[0], A21 = adjJ[1], A31 = adjJ[2];
+               const double A12 = adjJ[3], A22 = adjJ[4], A32 = adjJ[5];
+               const double A13 = adjJ[6], A23 = adjJ[7], A33 = adjJ[8];
 
                if (coeffDim == 6 || coeffDim == 9) // Matrix coefficient version
                {
@@ -316,6 +329,7 @@ static void PADiffusionSetup(const int dim,
                              const int Q1D,
                              const int coeffDim,
                              const int NE,
+                             const bool affine,
                              const Array<double> &W,
                              const Vector &J,
                              const Vector &C,
@@ -327,25 +341,34 @@ static void PADiffusionSetup(const int dim,
 #ifdef MFEM_USE_OCCA
       if (DeviceCanUseOcca())
       {
+         // the OCCA kernels expect one Jacobian per quadrature point
+         MFEM_VERIFY(!affine, "compressed Jacobians not supported with OCCA");
          OccaPADiffusionSetup2D(D1D, Q1D, NE, W, J, C, D);
          return;
       }
 #else
       MFEM_CONTRACT_VAR(D1D);
 #endif // MFEM_USE_OCCA
-      if (sdim == 2) { PADiffusionSetup2D<2>(Q1D, coeffDim, NE, W, J, C, D); }
-      if (sdim == 3) { PADiffusionSetup2D<3>(Q1D, coeffDim, NE, W, J, C, D); }
+      if (sdim == 2)
+      {
+         PADiffusionSetup2D<2>(Q1D, coeffDim, NE, affine, W, J, C, D);
+      }
+      if (sdim == 3)
+      {
+         PADiffusionSetup2D<3>(Q1D, coeffDim, NE, affine, W, J, C, D);
+      }
    }
    if (dim == 3)
    {
 #ifdef MFEM_USE_OCCA
       if (DeviceCanUseOcca())
       {
+         MFEM_VERIFY(!affine, "compressed Jacobians not supported with OCCA");
          OccaPADiffusionSetup3D(D1D, Q1D, NE, W, J, C, D);
          return;
       }
 #endif // MFEM_USE_OCCA
-      PADiffusionSetup3D(Q1D, coeffDim, NE, W, J, C, D);
+      PADiffusionSetup3D(Q1D, coeffDim, NE, affine, W, J, C, D);
    }
 }
 
@@ -367,16 +390,30 @@ void DiffusionIntegrator::SetupPA(const FiniteElementSpace &fes)
       return CeedPADiffusionAssemble(fes, *ir, *ptr);
    }
 #endif
-   const int dims = el.GetDim();
-   const int symmDims = (dims * (dims + 1)) / 2; // 1x1: 1, 2x2: 3, 3x3: 6
-   const int nq = ir->GetNPoints();
    dim = mesh->Dimension();
    ne = fes.GetNE();
-   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
-   const int sdim = mesh->SpaceDimension();
+   int gf_flags = GeometricFactors::JACOBIANS | GeometricFactors::COMPRESSED;
+#ifdef MFEM_USE_OCCA
+   // the OCCA setup kernels read the Jacobians at every quadrature point
+   if (DeviceCanUseOcca()) { gf_flags = GeometricFactors::JACOBIANS; }
+#endif
+   geom = mesh->GetGeometricFactors(*ir, gf_flags);
    maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
+   UpdateCoefficientPA();
+}
+
+void DiffusionIntegrator::UpdateCoefficientPA()
+{
+   MFEM_VERIFY(fespace && maps && geom,
+               "AssemblePA() must be called before UpdateCoefficientPA()");
+   const FiniteElementSpace &fes = *fespace;
+   Mesh *mesh = fes.GetMesh();
+   const IntegrationRule *ir = maps->IntRule;
+   const int symmDims = (dim * (dim + 1)) / 2; // 1x1: 1, 2x2: 3, 3x3: 6
+   const int nq = ir->GetNPoints();
+   const int sdim = mesh->SpaceDimension();
    int coeffDim = 1;
    Vector coeff;
    const int MQfullDim = MQ ? MQ->GetHeight() * MQ->GetWidth() : 0;
@@ -473,23 +510,30 @@ void DiffusionIntegrator::SetupPA(const FiniteElementSpace &fes)
       qFun.Read();
       coeff.MakeRef(const_cast<QuadratureFunction &>(qFun),0);
    }
+   else if (BatchedCoefficient *bQ = dynamic_cast<BatchedCoefficient*>(Q))
+   {
+      bQ->Eval(*mesh, *ir, coeff); // all quadrature points in one sweep
+   }
    else
    {
-      coeff.SetSize(nq * ne);
-      auto C = Reshape(coeff.HostWrite(), nq, ne);
-      for (int e = 0; e < ne; ++e)
-      {
-         ElementTransformation& T = *fes.GetElementTransformation(e);
-         for (int q = 0; q < nq; ++q)
-         {
-            C(q,e) = Q->Eval(T, ir->IntPoint(q));
-         }
-      }
+      // dispatch through the batched virtual so coefficients with a fast
+      // whole-mesh fill (e.g. PWConstCoefficient) avoid the per-point loop
+      Q->Eval(coeff, fes, *ir);
    }
    pa_data.SetSize((symmetric ? symmDims : MQfullDim) * nq * ne,
                    Device::GetDeviceMemoryType());
-   PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeffDim, ne, ir->GetWeights(),
-                    geom->J, coeff, pa_data);
+   PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeffDim, ne, geom->compressed,
+                    ir->GetWeights(), geom->J, coeff, pa_data);
+   if (pa_reduced)
+   {
+      // demote the quadrature data; the apply kernels convert back on load
+      const int sz = pa_data.Size();
+      pa_data_f32.SetSize(sz, Device::GetDeviceMemoryType());
+      const double *pa_d = pa_data.Read();
+      float *pa_f = pa_data_f32.Write();
+      MFEM_FORALL(i, sz, pa_f[i] = (float) pa_d[i];);
+      pa_data.Destroy();
+   }
 }
 
 void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
@@ -930,7 +974,20 @@ void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    else
 #endif
    {
-      if (pa_data.Size()==0) { SetupPA(*fespace); }
+      if (pa_data.Size()==0 && pa_data_f32.Size()==0) { SetupPA(*fespace); }
+      if (pa_reduced)
+      {
+         // one-off promotion of the quadrature data back to double: the
+         // diagonal assembly is not bandwidth critical
+         Vector pa(pa_data_f32.Size());
+         pa.UseDevice(true);
+         const float *pa_f = pa_data_f32.Read();
+         double *pa_d = pa.Write();
+         MFEM_FORALL(i, pa.Size(), pa_d[i] = pa_f[i];);
+         PADiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne, symmetric,
+                                     maps->B, maps->G, pa, diag);
+         return;
+      }
       PADiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne, symmetric,
                                   maps->B, maps->G, pa_data, diag);
    }
@@ -1037,15 +1094,17 @@ static void OccaPADiffusionApply3D(const int D1D,
 }
 #endif // MFEM_USE_OCCA
 
-// PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+// PA Diffusion Apply 2D kernel; the quadrature data scalar is a template
+// parameter so the same kernel serves the double and the reduced precision
+// storage of pa_data, converting on load.
+template<typename TD, int T_D1D = 0, int T_Q1D = 0>
 static void PADiffusionApply2D(const int NE,
                                const bool symmetric,
                                const Array<double> &b_,
                                const Array<double> &g_,
                                const Array<double> &bt_,
                                const Array<double> &gt_,
-                               const Vector &d_,
+                               const TD *d_,
                                const Vector &x_,
                                Vector &y_,
                                const int d1d = 0,
@@ -1059,7 +1118,7 @@ static void PADiffusionApply2D(const int NE,
    auto G = Reshape(g_.Read(), Q1D, D1D);
    auto Bt = Reshape(bt_.Read(), D1D, Q1D);
    auto Gt = Reshape(gt_.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D*Q1D, symmetric ? 3 : 4, NE);
+   auto D = Reshape(d_, Q1D*Q1D, symmetric ? 3 : 4, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
    MFEM_FORALL(e, NE,
@@ -1159,6 +1218,25 @@ static void PADiffusionApply2D(const int NE,
    });
 }
 
+// PA Diffusion Apply 2D kernel with the double precision quadrature data in
+// a Vector, the form expected by the kernel dispatch table and the JIT.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PADiffusionApply2D(const int NE,
+                               const bool symmetric,
+                               const Array<double> &b_,
+                               const Array<double> &g_,
+                               const Array<double> &bt_,
+                               const Array<double> &gt_,
+                               const Vector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   PADiffusionApply2D<double,T_D1D,T_Q1D>(NE, symmetric, b_, g_, bt_, gt_,
+                                          d_.Read(), x_, y_, d1d, q1d);
+}
+
 // Shared memory PA Diffusion Apply 2D kernel
 template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0>
 static void SmemPADiffusionApply2D(const int NE,
@@ -1317,15 +1395,15 @@ static void SmemPADiffusionApply2D(const int NE,
    });
 }
 
-// PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+// PA Diffusion Apply 3D kernel, see PADiffusionApply2D for the role of TD
+template<typename TD, int T_D1D = 0, int T_Q1D = 0>
 static void PADiffusionApply3D(const int NE,
                                const bool symmetric,
                                const Array<double> &b,
                                const Array<double> &g,
                                const Array<double> &bt,
                                const Array<double> &gt,
-                               const Vector &d_,
+                               const TD *d_,
                                const Vector &x_,
                                Vector &y_,
                                int d1d = 0, int q1d = 0)
@@ -1338,7 +1416,7 @@ static void PADiffusionApply3D(const int NE,
    auto G = Reshape(g.Read(), Q1D, D1D);
    auto Bt = Reshape(bt.Read(), D1D, Q1D);
    auto Gt = Reshape(gt.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
+   auto D = Reshape(d_, Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
    MFEM_FORALL(e, NE,
@@ -1511,6 +1589,24 @@ static void PADiffusionApply3D(const int NE,
 }
 
 // Half of B and G are stored in shared to get B, Bt, G and Gt.
+// PA Diffusion Apply 3D kernel with the double precision quadrature data in
+// a Vector, the form expected by the kernel dispatch table and the JIT.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PADiffusionApply3D(const int NE,
+                               const bool symmetric,
+                               const Array<double> &b,
+                               const Array<double> &g,
+                               const Array<double> &bt,
+                               const Array<double> &gt,
+                               const Vector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               int d1d = 0, int q1d = 0)
+{
+   PADiffusionApply3D<double,T_D1D,T_Q1D>(NE, symmetric, b, g, bt, gt,
+                                          d_.Read(), x_, y_, d1d, q1d);
+}
+
 // Indices computation for SmemPADiffusionApply3D.
 static MFEM_HOST_DEVICE inline int qi(const int q, const int d, const int Q)
 {
@@ -1831,83 +1927,989 @@ static void SmemPADiffusionApply3D(const int NE,
    });
 }
 
-static void PADiffusionApply(const int dim,
-                             const int D1D,
-                             const int Q1D,
-                             const int NE,
-                             const bool symm,
-                             const Array<double> &B,
-                             const Array<double> &G,
-                             const Array<double> &Bt,
-                             const Array<double> &Gt,
-                             const Vector &D,
-                             const Vector &X,
-                             Vector &Y)
+// Cross-element SIMD apply kernels for the pure CPU backend: each SIMD lane
+// processes one element, so the vector width is independent of D1D and Q1D
+// and the contractions vectorize fully at any order -- the same strategy the
+// templated TProductShapeEvaluator classes use in miniapps/performance (see
+// fem/tevaluator.hpp). The quadrature data and the E-vectors are gathered
+// into lane-interleaved registers per batch; the last partial batch runs
+// with the unused lanes zero-padded and masked on the final scatter.
+template<int D1D, int Q1D>
+static void SimdPADiffusionApply2D(const int NE,
+                                   const bool symmetric,
+                                   const Array<double> &b_,
+                                   const Array<double> &g_,
+                                   const Vector &d_,
+                                   const Vector &x_,
+                                   Vector &y_,
+                                   const int, const int)
 {
-#ifdef MFEM_USE_OCCA
-   if (DeviceCanUseOcca())
+   constexpr int W = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double,W,MFEM_SIMD_BYTES> simd_t;
+   auto B = Reshape(b_.HostRead(), Q1D, D1D);
+   auto G = Reshape(g_.HostRead(), Q1D, D1D);
+   auto D = Reshape(d_.HostRead(), Q1D*Q1D, symmetric ? 3 : 4, NE);
+   auto X = Reshape(x_.HostRead(), D1D*D1D, NE);
+   auto Y = Reshape(y_.HostReadWrite(), D1D*D1D, NE);
+   for (int e = 0; e < NE; e += W)
    {
-      if (dim == 2)
+      const int lanes = (NE - e < W) ? NE - e : W;
+      simd_t Xs[D1D*D1D];
+      for (int i = 0; i < D1D*D1D; i++)
       {
-         OccaPADiffusionApply2D(D1D,Q1D,NE,B,G,Bt,Gt,D,X,Y);
-         return;
+         for (int l = 0; l < lanes; l++) { Xs[i][l] = X(i,e+l); }
+         for (int l = lanes; l < W; l++) { Xs[i][l] = 0.0; }
       }
-      if (dim == 3)
+      simd_t grad[Q1D][Q1D][2];
+      for (int qy = 0; qy < Q1D; ++qy)
       {
-         OccaPADiffusionApply3D(D1D,Q1D,NE,B,G,Bt,Gt,D,X,Y);
-         return;
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            grad[qy][qx][0] = 0.0;
+            grad[qy][qx][1] = 0.0;
+         }
       }
-      MFEM_ABORT("OCCA PADiffusionApply unknown kernel!");
-   }
-#endif // MFEM_USE_OCCA
-   const int ID = (D1D << 4) | Q1D;
-
-   if (dim == 2)
-   {
-      switch (ID)
+      for (int dy = 0; dy < D1D; ++dy)
       {
-         case 0x22: return SmemPADiffusionApply2D<2,2,16>(NE,symm,B,G,D,X,Y);
-         case 0x33: return SmemPADiffusionApply2D<3,3,16>(NE,symm,B,G,D,X,Y);
-         case 0x44: return SmemPADiffusionApply2D<4,4,8>(NE,symm,B,G,D,X,Y);
-         case 0x55: return SmemPADiffusionApply2D<5,5,8>(NE,symm,B,G,D,X,Y);
-         case 0x66: return SmemPADiffusionApply2D<6,6,4>(NE,symm,B,G,D,X,Y);
-         case 0x77: return SmemPADiffusionApply2D<7,7,4>(NE,symm,B,G,D,X,Y);
-         case 0x88: return SmemPADiffusionApply2D<8,8,2>(NE,symm,B,G,D,X,Y);
-         case 0x99: return SmemPADiffusionApply2D<9,9,2>(NE,symm,B,G,D,X,Y);
-         default:   return PADiffusionApply2D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
+         simd_t gradX[Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] = 0.0;
+            gradX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const simd_t s = Xs[dx + dy*D1D];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0].fma(s, B(qx,dx));
+               gradX[qx][1].fma(s, G(qx,dx));
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double wy  = B(qy,dy);
+            const double wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qy][qx][0].fma(gradX[qx][1], wy);
+               grad[qy][qx][1].fma(gradX[qx][0], wDy);
+            }
+         }
       }
-   }
-
-   if (dim == 3)
-   {
-      switch (ID)
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy*Q1D;
+            simd_t O11, O21, O12, O22;
+            for (int l = 0; l < lanes; l++)
+            {
+               O11[l] = D(q,0,e+l);
+               O21[l] = D(q,1,e+l);
+               O12[l] = symmetric ? O21[l] : D(q,2,e+l);
+               O22[l] = symmetric ? D(q,2,e+l) : D(q,3,e+l);
+            }
+            for (int l = lanes; l < W; l++)
+            {
+               O11[l] = O21[l] = O12[l] = O22[l] = 0.0;
+            }
+            const simd_t gradX = grad[qy][qx][0];
+            const simd_t gradY = grad[qy][qx][1];
+            grad[qy][qx][0] = O11*gradX + O12*gradY;
+            grad[qy][qx][1] = O21*gradX + O22*gradY;
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
       {
-         case 0x23: return SmemPADiffusionApply3D<2,3>(NE,symm,B,G,D,X,Y);
-         case 0x34: return SmemPADiffusionApply3D<3,4>(NE,symm,B,G,D,X,Y);
-         case 0x45: return SmemPADiffusionApply3D<4,5>(NE,symm,B,G,D,X,Y);
-         case 0x46: return SmemPADiffusionApply3D<4,6>(NE,symm,B,G,D,X,Y);
-         case 0x56: return SmemPADiffusionApply3D<5,6>(NE,symm,B,G,D,X,Y);
-         case 0x58: return SmemPADiffusionApply3D<5,8>(NE,symm,B,G,D,X,Y);
-         case 0x67: return SmemPADiffusionApply3D<6,7>(NE,symm,B,G,D,X,Y);
-         case 0x78: return SmemPADiffusionApply3D<7,8>(NE,symm,B,G,D,X,Y);
-         case 0x89: return SmemPADiffusionApply3D<8,9>(NE,symm,B,G,D,X,Y);
-         default:   return PADiffusionApply3D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D);
+         simd_t gradX[D1D][2];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            gradX[dx][0] = 0.0;
+            gradX[dx][1] = 0.0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const simd_t gX = grad[qy][qx][0];
+            const simd_t gY = grad[qy][qx][1];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradX[dx][0].fma(gX, G(qx,dx)); // Gt(dx,qx)
+               gradX[dx][1].fma(gY, B(qx,dx)); // Bt(dx,qx)
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const double wy  = B(qy,dy);
+            const double wDy = G(qy,dy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const simd_t r = gradX[dx][0]*wy + gradX[dx][1]*wDy;
+               for (int l = 0; l < lanes; l++) { Y(dx + dy*D1D, e+l) += r[l]; }
+            }
+         }
       }
    }
-   MFEM_ABORT("Unknown kernel.");
 }
 
-// PA Diffusion Apply kernel
-void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
+// 3D version of SimdPADiffusionApply2D, mirroring PADiffusionApply3D.
+template<int D1D, int Q1D>
+static void SimdPADiffusionApply3D(const int NE,
+                                   const bool symmetric,
+                                   const Array<double> &b_,
+                                   const Array<double> &g_,
+                                   const Vector &d_,
+                                   const Vector &x_,
+                                   Vector &y_,
+                                   const int, const int)
 {
-#ifdef MFEM_USE_CEED
-   if (DeviceCanUseCeed())
-   {
-      CeedAddMultPA(ceedDataPtr, x, y);
-   }
-   else
-#endif
+   constexpr int W = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double,W,MFEM_SIMD_BYTES> simd_t;
+   auto B = Reshape(b_.HostRead(), Q1D, D1D);
+   auto G = Reshape(g_.HostRead(), Q1D, D1D);
+   auto D = Reshape(d_.HostRead(), Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
+   auto X = Reshape(x_.HostRead(), D1D*D1D*D1D, NE);
+   auto Y = Reshape(y_.HostReadWrite(), D1D*D1D*D1D, NE);
+   for (int e = 0; e < NE; e += W)
    {
+      const int lanes = (NE - e < W) ? NE - e : W;
+      simd_t Xs[D1D*D1D*D1D];
+      for (int i = 0; i < D1D*D1D*D1D; i++)
+      {
+         for (int l = 0; l < lanes; l++) { Xs[i][l] = X(i,e+l); }
+         for (int l = lanes; l < W; l++) { Xs[i][l] = 0.0; }
+      }
+      simd_t grad[Q1D][Q1D][Q1D][3];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qz][qy][qx][0] = 0.0;
+               grad[qz][qy][qx][1] = 0.0;
+               grad[qz][qy][qx][2] = 0.0;
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         simd_t gradXY[Q1D][Q1D][3];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradXY[qy][qx][0] = 0.0;
+               gradXY[qy][qx][1] = 0.0;
+               gradXY[qy][qx][2] = 0.0;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            simd_t gradX[Q1D][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] = 0.0;
+               gradX[qx][1] = 0.0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const simd_t s = Xs[dx + (dy + dz*D1D)*D1D];
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][0].fma(s, B(qx,dx));
+                  gradX[qx][1].fma(s, G(qx,dx));
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradXY[qy][qx][0].fma(gradX[qx][1], wy);
+                  gradXY[qy][qx][1].fma(gradX[qx][0], wDy);
+                  gradXY[qy][qx][2].fma(gradX[qx][0], wy);
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double wz  = B(qz,dz);
+            const double wDz = G(qz,dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  grad[qz][qy][qx][0].fma(gradXY[qy][qx][0], wz);
+                  grad[qz][qy][qx][1].fma(gradXY[qy][qx][1], wz);
+                  grad[qz][qy][qx][2].fma(gradXY[qy][qx][2], wDz);
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + (qy + qz*Q1D)*Q1D;
+               simd_t O11, O12, O13, O21, O22, O23, O31, O32, O33;
+               for (int l = 0; l < lanes; l++)
+               {
+                  O11[l] = D(q,0,e+l);
+                  O12[l] = D(q,1,e+l);
+                  O13[l] = D(q,2,e+l);
+                  O21[l] = symmetric ? O12[l] : D(q,3,e+l);
+                  O22[l] = symmetric ? D(q,3,e+l) : D(q,4,e+l);
+                  O23[l] = symmetric ? D(q,4,e+l) : D(q,5,e+l);
+                  O31[l] = symmetric ? O13[l] : D(q,6,e+l);
+                  O32[l] = symmetric ? O23[l] : D(q,7,e+l);
+                  O33[l] = symmetric ? D(q,5,e+l) : D(q,8,e+l);
+               }
+               for (int l = lanes; l < W; l++)
+               {
+                  O11[l] = O12[l] = O13[l] = 0.0;
+                  O21[l] = O22[l] = O23[l] = 0.0;
+                  O31[l] = O32[l] = O33[l] = 0.0;
+               }
+               const simd_t gradX = grad[qz][qy][qx][0];
+               const simd_t gradY = grad[qz][qy][qx][1];
+               const simd_t gradZ = grad[qz][qy][qx][2];
+               grad[qz][qy][qx][0] = O11*gradX + O12*gradY + O13*gradZ;
+               grad[qz][qy][qx][1] = O21*gradX + O22*gradY + O23*gradZ;
+               grad[qz][qy][qx][2] = O31*gradX + O32*gradY + O33*gradZ;
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         simd_t gradXY[D1D][D1D][3];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradXY[dy][dx][0] = 0.0;
+               gradXY[dy][dx][1] = 0.0;
+               gradXY[dy][dx][2] = 0.0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            simd_t gradX[D1D][3];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradX[dx][0] = 0.0;
+               gradX[dx][1] = 0.0;
+               gradX[dx][2] = 0.0;
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const simd_t gX = grad[qz][qy][qx][0];
+               const simd_t gY = grad[qz][qy][qx][1];
+               const simd_t gZ = grad[qz][qy][qx][2];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradX[dx][0].fma(gX, G(qx,dx)); // Gt(dx,qx)
+                  gradX[dx][1].fma(gY, B(qx,dx)); // Bt(dx,qx)
+                  gradX[dx][2].fma(gZ, B(qx,dx));
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradXY[dy][dx][0].fma(gradX[dx][0], wy);
+                  gradXY[dy][dx][1].fma(gradX[dx][1], wDy);
+                  gradXY[dy][dx][2].fma(gradX[dx][2], wy);
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const double wz  = B(qz,dz);
+            const double wDz = G(qz,dz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const simd_t r = (gradXY[dy][dx][0] + gradXY[dy][dx][1])*wz +
+                                   gradXY[dy][dx][2]*wDz;
+                  for (int l = 0; l < lanes; l++)
+                  {
+                     Y(dx + (dy + dz*D1D)*D1D, e+l) += r[l];
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+// Specialized apply kernel signature: the transposed basis arrays are not
+// needed when D1D and Q1D are compile-time constants.
+typedef void (*DiffusionApplyKernel)(const int NE, const bool symm,
+                                     const Array<double> &B,
+                                     const Array<double> &G,
+                                     const Vector &D, const Vector &X,
+                                     Vector &Y, const int d1d, const int q1d);
+
+// Build the table of specialized apply kernels, instantiating only the
+// polynomial orders selected at build time (see kernel_dispatch.hpp).
+static KernelDispatchTable<DiffusionApplyKernel> GetDiffusionApplyKernels()
+{
+   KernelDispatchTable<DiffusionApplyKernel> t;
+#if MFEM_PA_ORDER_SELECTED(1)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 2, 2, SmemPADiffusionApply2D<2,2,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 2, 3, SmemPADiffusionApply3D<2,3>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(2)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 3, 3, SmemPADiffusionApply2D<3,3,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 3, 4, SmemPADiffusionApply3D<3,4>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(3)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 4, 4, SmemPADiffusionApply2D<4,4,8>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 5, SmemPADiffusionApply3D<4,5>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 6, SmemPADiffusionApply3D<4,6>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(4)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 5, 5, SmemPADiffusionApply2D<5,5,8>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 6, SmemPADiffusionApply3D<5,6>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 8, SmemPADiffusionApply3D<5,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(5)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 6, 6, SmemPADiffusionApply2D<6,6,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 6, 7, SmemPADiffusionApply3D<6,7>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(6)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 7, 7, SmemPADiffusionApply2D<7,7,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 7, 8, SmemPADiffusionApply3D<7,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(7)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 8, 8, SmemPADiffusionApply2D<8,8,2>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 8, 9, SmemPADiffusionApply3D<8,9>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(8)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 9, 9, SmemPADiffusionApply2D<9,9,2>);
+#endif
+   return t;
+}
+
+// Build the table of cross-element SIMD apply kernels for the CPU backend.
+// Scalar builds (no MFEM_USE_SIMD, one element per "vector") keep using the
+// kernels above, so the table stays empty and nothing is instantiated.
+static KernelDispatchTable<DiffusionApplyKernel>
+GetDiffusionApplySimdKernels()
+{
+   KernelDispatchTable<DiffusionApplyKernel> t;
+#if MFEM_SIMD_BYTES > 8
+#if MFEM_PA_ORDER_SELECTED(1)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 2, 2, SimdPADiffusionApply2D<2,2>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 2, 3, SimdPADiffusionApply3D<2,3>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(2)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 3, 3, SimdPADiffusionApply2D<3,3>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 3, 4, SimdPADiffusionApply3D<3,4>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(3)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 4, 4, SimdPADiffusionApply2D<4,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 5, SimdPADiffusionApply3D<4,5>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 6, SimdPADiffusionApply3D<4,6>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(4)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 5, 5, SimdPADiffusionApply2D<5,5>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 6, SimdPADiffusionApply3D<5,6>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 8, SimdPADiffusionApply3D<5,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(5)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 6, 6, SimdPADiffusionApply2D<6,6>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 6, 7, SimdPADiffusionApply3D<6,7>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(6)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 7, 7, SimdPADiffusionApply2D<7,7>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 7, 8, SimdPADiffusionApply3D<7,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(7)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 8, 8, SimdPADiffusionApply2D<8,8>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 8, 9, SimdPADiffusionApply3D<8,9>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(8)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 9, 9, SimdPADiffusionApply2D<9,9>);
+#endif
+#endif // MFEM_SIMD_BYTES > 8
+   return t;
+}
+
+// Compile the specialized apply kernel for an unregistered (dim, D1D, Q1D)
+// with the JIT engine, by re-instantiating the templates of this file for
+// the exact sizes (see general/jit.hpp). Returns NULL on failure. The
+// shared memory kernels above are only valid for the precompiled (D1D, Q1D)
+// pairs (the folded storage of B and G assumes them), so the generated
+// wrapper instantiates the generic kernels with compile-time sizes, which
+// are correct for any pair; the transposed basis arrays they expect are
+// rebuilt in the wrapper, an O(D1D*Q1D) cost per call.
+static DiffusionApplyKernel JitDiffusionApplyKernel(const int dim,
+                                                    const int D1D,
+                                                    const int Q1D)
+{
+   std::ostringstream src;
+   src << "#include \"" << MFEM_SOURCE_DIR
+       << "/fem/bilininteg_diffusion_pa.cpp\"\n"
+       "extern \"C\" void mjit_kernel(const int NE, const bool symm,\n"
+       "   const mfem::Array<double> &B, const mfem::Array<double> &G,\n"
+       "   const mfem::Vector &D, const mfem::Vector &X, mfem::Vector &Y,\n"
+       "   const int, const int)\n"
+       "{\n"
+       "   const int D1D = " << D1D << ", Q1D = " << Q1D << ";\n"
+       "   mfem::Array<double> Bt(D1D*Q1D), Gt(D1D*Q1D);\n"
+       "   for (int q = 0; q < Q1D; q++)\n"
+       "      for (int d = 0; d < D1D; d++)\n"
+       "      {\n"
+       "         Bt[d + q*D1D] = B[q + d*Q1D];\n"
+       "         Gt[d + q*D1D] = G[q + d*Q1D];\n"
+       "      }\n"
+       "   mfem::PADiffusionApply" << dim << "D<" << D1D << ',' << Q1D
+       << ">(NE,symm,B,G,Bt,Gt,D,X,Y);\n}\n";
+   return reinterpret_cast<DiffusionApplyKernel>(
+             Jit::Compile("mjit_kernel", src.str()));
+}
+
+static void PADiffusionApply(const int dim,
+                             const int D1D,
+                             const int Q1D,
+                             const int NE,
+                             const bool symm,
+                             const Array<double> &B,
+                             const Array<double> &G,
+                             const Array<double> &Bt,
+                             const Array<double> &Gt,
+                             const Vector &D,
+                             const Vector &X,
+                             Vector &Y)
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca())
+   {
+      if (dim == 2)
+      {
+         OccaPADiffusionApply2D(D1D,Q1D,NE,B,G,Bt,Gt,D,X,Y);
+         return;
+      }
+      if (dim == 3)
+      {
+         OccaPADiffusionApply3D(D1D,Q1D,NE,B,G,Bt,Gt,D,X,Y);
+         return;
+      }
+      MFEM_ABORT("OCCA PADiffusionApply unknown kernel!");
+   }
+#endif // MFEM_USE_OCCA
+   // With the pure 'cpu' backend, prefer the cross-element SIMD kernels;
+   // other host backends keep MFEM_FORALL-based kernels for their threading.
+   if (!Device::Allows(~Backend::CPU))
+   {
+      static KernelDispatchTable<DiffusionApplyKernel> simd_kernels =
+         GetDiffusionApplySimdKernels();
+      const DiffusionApplyKernel kernel = simd_kernels.Find(dim, D1D, Q1D);
+      if (kernel) { return kernel(NE,symm,B,G,D,X,Y,D1D,Q1D); }
+   }
+   static KernelDispatchTable<DiffusionApplyKernel> kernels =
+      GetDiffusionApplyKernels();
+   DiffusionApplyKernel kernel = kernels.Find(dim, D1D, Q1D);
+   if (!kernel && Jit::Enabled() && (dim == 2 || dim == 3))
+   {
+      kernel = JitDiffusionApplyKernel(dim, D1D, Q1D);
+      if (kernel) { kernels.Register(dim, D1D, Q1D, kernel); }
+   }
+   if (kernel) { return kernel(NE,symm,B,G,D,X,Y,D1D,Q1D); }
+   // Not registered: use the runtime-sized fallback kernels.
+   if (dim == 2) { return PADiffusionApply2D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D); }
+   if (dim == 3) { return PADiffusionApply3D(NE,symm,B,G,Bt,Gt,D,X,Y,D1D,Q1D); }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+// Reduced precision variant of PADiffusionApply: the quadrature data is
+// stored in single precision and converted back to double on load by the
+// generic kernels, so only its memory traffic is reduced; the basis
+// contractions and the accumulation stay in double precision.
+static void PADiffusionApplyF32(const int dim,
+                                const int D1D,
+                                const int Q1D,
+                                const int NE,
+                                const bool symm,
+                                const Array<double> &B,
+                                const Array<double> &G,
+                                const Array<double> &Bt,
+                                const Array<double> &Gt,
+                                const Array<float> &D,
+                                const Vector &X,
+                                Vector &Y)
+{
+   const float *d = D.Read();
+   if (dim == 2)
+   {
+      switch ((D1D << 4) | Q1D)
+      {
+         case 0x22:
+            return PADiffusionApply2D<float,2,2>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x33:
+            return PADiffusionApply2D<float,3,3>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x44:
+            return PADiffusionApply2D<float,4,4>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x55:
+            return PADiffusionApply2D<float,5,5>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x66:
+            return PADiffusionApply2D<float,6,6>(NE,symm,B,G,Bt,Gt,d,X,Y);
+      }
+      return PADiffusionApply2D(NE,symm,B,G,Bt,Gt,d,X,Y,D1D,Q1D);
+   }
+   if (dim == 3)
+   {
+      switch ((D1D << 4) | Q1D)
+      {
+         case 0x23:
+            return PADiffusionApply3D<float,2,3>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x34:
+            return PADiffusionApply3D<float,3,4>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x45:
+            return PADiffusionApply3D<float,4,5>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x56:
+            return PADiffusionApply3D<float,5,6>(NE,symm,B,G,Bt,Gt,d,X,Y);
+         case 0x67:
+            return PADiffusionApply3D<float,6,7>(NE,symm,B,G,Bt,Gt,d,X,Y);
+      }
+      return PADiffusionApply3D(NE,symm,B,G,Bt,Gt,d,X,Y,D1D,Q1D);
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+// PA fused Mass+Diffusion Apply 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAFusedMassDiffusionApply2D(const int NE,
+                                        const bool symmetric,
+                                        const Array<double> &b_,
+                                        const Array<double> &g_,
+                                        const Array<double> &bt_,
+                                        const Array<double> &gt_,
+                                        const Vector &md_,
+                                        const Vector &d_,
+                                        const Vector &x_,
+                                        Vector &y_,
+                                        const int d1d = 0,
+                                        const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b_.Read(), Q1D, D1D);
+   auto G = Reshape(g_.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt_.Read(), D1D, Q1D);
+   auto Gt = Reshape(gt_.Read(), D1D, Q1D);
+   auto M = Reshape(md_.Read(), Q1D*Q1D, NE);
+   auto D = Reshape(d_.Read(), Q1D*Q1D, symmetric ? 3 : 4, NE);
+   auto X = Reshape(x_.Read(), D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      // the following variables are evaluated at compile time
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      // grad[..][0-1] hold the gradient, grad[..][2] the value at the point
+      double grad[max_Q1D][max_Q1D][3];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            grad[qy][qx][0] = 0.0;
+            grad[qy][qx][1] = 0.0;
+            grad[qy][qx][2] = 0.0;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double gradX[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] = 0.0;
+            gradX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const double s = X(dx,dy,e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] += s * B(qx,dx);
+               gradX[qx][1] += s * G(qx,dx);
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double wy  = B(qy,dy);
+            const double wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qy][qx][0] += gradX[qx][1] * wy;
+               grad[qy][qx][1] += gradX[qx][0] * wDy;
+               grad[qy][qx][2] += gradX[qx][0] * wy;
+            }
+         }
+      }
+      // Calculate Dxy, xDy in plane and scale the value by the mass data
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy * Q1D;
+
+            const double O11 = D(q,0,e);
+            const double O21 = D(q,1,e);
+            const double O12 = symmetric ? O21 : D(q,2,e);
+            const double O22 = symmetric ? D(q,2,e) : D(q,3,e);
+
+            const double gradX = grad[qy][qx][0];
+            const double gradY = grad[qy][qx][1];
+
+            grad[qy][qx][0] = (O11 * gradX) + (O12 * gradY);
+            grad[qy][qx][1] = (O21 * gradX) + (O22 * gradY);
+            grad[qy][qx][2] = M(q,e) * grad[qy][qx][2];
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         double gradX[max_D1D][3];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            gradX[dx][0] = 0;
+            gradX[dx][1] = 0;
+            gradX[dx][2] = 0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double gX = grad[qy][qx][0];
+            const double gY = grad[qy][qx][1];
+            const double v  = grad[qy][qx][2];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double wx  = Bt(dx,qx);
+               const double wDx = Gt(dx,qx);
+               gradX[dx][0] += gX * wDx;
+               gradX[dx][1] += gY * wx;
+               gradX[dx][2] += v  * wx;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            const double wy  = Bt(dy,qy);
+            const double wDy = Gt(dy,qy);
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               Y(dx,dy,e) += ((gradX[dx][0] * wy) +
+                              (gradX[dx][1] * wDy) +
+                              (gradX[dx][2] * wy));
+            }
+         }
+      }
+   });
+}
+
+// PA fused Mass+Diffusion Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAFusedMassDiffusionApply3D(const int NE,
+                                        const bool symmetric,
+                                        const Array<double> &b,
+                                        const Array<double> &g,
+                                        const Array<double> &bt,
+                                        const Array<double> &gt,
+                                        const Vector &md_,
+                                        const Vector &d_,
+                                        const Vector &x_,
+                                        Vector &y_,
+                                        int d1d = 0, int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto Gt = Reshape(gt.Read(), D1D, Q1D);
+   auto M = Reshape(md_.Read(), Q1D*Q1D*Q1D, NE);
+   auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
+   auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+      // grad[..][0-2] hold the gradient, grad[..][3] the value at the point
+      double grad[max_Q1D][max_Q1D][max_Q1D][4];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qz][qy][qx][0] = 0.0;
+               grad[qz][qy][qx][1] = 0.0;
+               grad[qz][qy][qx][2] = 0.0;
+               grad[qz][qy][qx][3] = 0.0;
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double gradXY[max_Q1D][max_Q1D][3];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradXY[qy][qx][0] = 0.0;
+               gradXY[qy][qx][1] = 0.0;
+               gradXY[qy][qx][2] = 0.0;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double gradX[max_Q1D][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] = 0.0;
+               gradX[qx][1] = 0.0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s = X(dx,dy,dz,e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][0] += s * B(qx,dx);
+                  gradX[qx][1] += s * G(qx,dx);
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double wx  = gradX[qx][0];
+                  const double wDx = gradX[qx][1];
+                  gradXY[qy][qx][0] += wDx * wy;
+                  gradXY[qy][qx][1] += wx  * wDy;
+                  gradXY[qy][qx][2] += wx  * wy;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double wz  = B(qz,dz);
+            const double wDz = G(qz,dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  grad[qz][qy][qx][0] += gradXY[qy][qx][0] * wz;
+                  grad[qz][qy][qx][1] += gradXY[qy][qx][1] * wz;
+                  grad[qz][qy][qx][2] += gradXY[qy][qx][2] * wDz;
+                  grad[qz][qy][qx][3] += gradXY[qy][qx][2] * wz;
+               }
+            }
+         }
+      }
+      // Calculate Dxyz, xDyz, xyDz in plane; scale the value by the mass data
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + (qy + qz * Q1D) * Q1D;
+               const double O11 = D(q,0,e);
+               const double O12 = D(q,1,e);
+               const double O13 = D(q,2,e);
+               const double O21 = symmetric ? O12 : D(q,3,e);
+               const double O22 = symmetric ? D(q,3,e) : D(q,4,e);
+               const double O23 = symmetric ? D(q,4,e) : D(q,5,e);
+               const double O31 = symmetric ? O13 : D(q,6,e);
+               const double O32 = symmetric ? O23 : D(q,7,e);
+               const double O33 = symmetric ? D(q,5,e) : D(q,8,e);
+               const double gradX = grad[qz][qy][qx][0];
+               const double gradY = grad[qz][qy][qx][1];
+               const double gradZ = grad[qz][qy][qx][2];
+               grad[qz][qy][qx][0] = (O11*gradX)+(O12*gradY)+(O13*gradZ);
+               grad[qz][qy][qx][1] = (O21*gradX)+(O22*gradY)+(O23*gradZ);
+               grad[qz][qy][qx][2] = (O31*gradX)+(O32*gradY)+(O33*gradZ);
+               grad[qz][qy][qx][3] = M(q,e) * grad[qz][qy][qx][3];
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         double gradXY[max_D1D][max_D1D][4];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradXY[dy][dx][0] = 0;
+               gradXY[dy][dx][1] = 0;
+               gradXY[dy][dx][2] = 0;
+               gradXY[dy][dx][3] = 0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double gradX[max_D1D][4];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradX[dx][0] = 0;
+               gradX[dx][1] = 0;
+               gradX[dx][2] = 0;
+               gradX[dx][3] = 0;
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double gX = grad[qz][qy][qx][0];
+               const double gY = grad[qz][qy][qx][1];
+               const double gZ = grad[qz][qy][qx][2];
+               const double v  = grad[qz][qy][qx][3];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double wx  = Bt(dx,qx);
+                  const double wDx = Gt(dx,qx);
+                  gradX[dx][0] += gX * wDx;
+                  gradX[dx][1] += gY * wx;
+                  gradX[dx][2] += gZ * wx;
+                  gradX[dx][3] += v  * wx;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double wy  = Bt(dy,qy);
+               const double wDy = Gt(dy,qy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradXY[dy][dx][0] += gradX[dx][0] * wy;
+                  gradXY[dy][dx][1] += gradX[dx][1] * wDy;
+                  gradXY[dy][dx][2] += gradX[dx][2] * wy;
+                  gradXY[dy][dx][3] += gradX[dx][3] * wy;
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            const double wz  = Bt(dz,qz);
+            const double wDz = Gt(dz,qz);
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  Y(dx,dy,dz,e) +=
+                     ((gradXY[dy][dx][0] * wz) +
+                      (gradXY[dy][dx][1] * wz) +
+                      (gradXY[dy][dx][2] * wDz) +
+                      (gradXY[dy][dx][3] * wz));
+               }
+            }
+         }
+      }
+   });
+}
+
+static void PAFusedMassDiffusionApply(const int dim,
+                                      const int D1D,
+                                      const int Q1D,
+                                      const int NE,
+                                      const bool symm,
+                                      const Array<double> &B,
+                                      const Array<double> &G,
+                                      const Array<double> &Bt,
+                                      const Array<double> &Gt,
+                                      const Vector &MD,
+                                      const Vector &D,
+                                      const Vector &X,
+                                      Vector &Y)
+{
+   const int ID = (D1D << 4) | Q1D;
+
+   if (dim == 2)
+   {
+      switch (ID)
+      {
+         case 0x22: return PAFusedMassDiffusionApply2D<2,2>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x33: return PAFusedMassDiffusionApply2D<3,3>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x44: return PAFusedMassDiffusionApply2D<4,4>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x55: return PAFusedMassDiffusionApply2D<5,5>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x66: return PAFusedMassDiffusionApply2D<6,6>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x77: return PAFusedMassDiffusionApply2D<7,7>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x88: return PAFusedMassDiffusionApply2D<8,8>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x99: return PAFusedMassDiffusionApply2D<9,9>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         default:   return PAFusedMassDiffusionApply2D(NE,symm,B,G,Bt,Gt,MD,D,X,Y,D1D,Q1D);
+      }
+   }
+
+   if (dim == 3)
+   {
+      switch (ID)
+      {
+         case 0x23: return PAFusedMassDiffusionApply3D<2,3>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x34: return PAFusedMassDiffusionApply3D<3,4>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x45: return PAFusedMassDiffusionApply3D<4,5>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x56: return PAFusedMassDiffusionApply3D<5,6>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x67: return PAFusedMassDiffusionApply3D<6,7>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x78: return PAFusedMassDiffusionApply3D<7,8>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         case 0x89: return PAFusedMassDiffusionApply3D<8,9>(NE,symm,B,G,Bt,Gt,MD,D,X,Y);
+         default:   return PAFusedMassDiffusionApply3D(NE,symm,B,G,Bt,Gt,MD,D,X,Y,D1D,Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+bool DiffusionIntegrator::AddMultFusedPA(const MassIntegrator &mass,
+                                         const Vector &x, Vector &y) const
+{
+#ifdef MFEM_USE_CEED
+   if (DeviceCanUseCeed()) { return false; }
+#endif
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   if (maps == NULL || mass.maps != maps || mass.ne != ne ||
+       pa_reduced || mass.pa_reduced || (dim != 2 && dim != 3))
+   {
+      return false;
+   }
+   PAFusedMassDiffusionApply(dim, dofs1D, quad1D, ne, symmetric,
+                             maps->B, maps->G, maps->Bt, maps->Gt,
+                             mass.pa_data, pa_data, x, y);
+   return true;
+}
+
+// PA Diffusion Apply kernel
+void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+#ifdef MFEM_USE_CEED
+   if (DeviceCanUseCeed())
+   {
+      CeedAddMultPA(ceedDataPtr, x, y);
+   }
+   else
+#endif
+   {
+      if (pa_reduced)
+      {
+         PADiffusionApplyF32(dim, dofs1D, quad1D, ne, symmetric,
+                             maps->B, maps->G, maps->Bt, maps->Gt,
+                             pa_data_f32, x, y);
+         return;
+      }
       PADiffusionApply(dim, dofs1D, quad1D, ne, symmetric,
                        maps->B, maps->G, maps->Bt, maps->Gt,
                        pa_data, x, y);
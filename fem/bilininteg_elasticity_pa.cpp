@@ -0,0 +1,794 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "bilininteg.hpp"
+#include "gridfunc.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+// PA Elasticity Integrator
+
+// The quadrature data stores, for each point, the adjugate adj(J) (so that
+// reference gradients map to physical ones through adj(J)/det(J)) followed by
+// the two scaled coefficients w*lambda/det(J) and w*mu/det(J). The adjugate
+// entry A(k,j) = det(J) (J^{-1})_{k,j} is kept at slot k + j*dim.
+
+// PA Elasticity Assemble 2D kernel
+static void PAElasticitySetup2D(const int Q1D,
+                                const int NE,
+                                const Array<double> &w,
+                                const Vector &j,
+                                const Vector &lam,
+                                const Vector &mu,
+                                Vector &op)
+{
+   const int NQ = Q1D*Q1D;
+   const bool const_l = lam.Size() == 1;
+   const bool const_m = mu.Size() == 1;
+   auto W = w.Read();
+   auto J = Reshape(j.Read(), NQ, 2, 2, NE);
+   auto L = const_l ? Reshape(lam.Read(), 1, 1) : Reshape(lam.Read(), NQ, NE);
+   auto M = const_m ? Reshape(mu.Read(), 1, 1) : Reshape(mu.Read(), NQ, NE);
+   auto D = Reshape(op.Write(), NQ, 6, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         const double J11 = J(q,0,0,e);
+         const double J21 = J(q,1,0,e);
+         const double J12 = J(q,0,1,e);
+         const double J22 = J(q,1,1,e);
+         const double detJ = (J11*J22)-(J21*J12);
+         const double w_detJ = W[q] / detJ;
+         const double l = const_l ? L(0,0) : L(q,e);
+         const double m = const_m ? M(0,0) : M(q,e);
+         // adj(J), A(k,j) at slot k + 2*j
+         D(q,0,e) =  J22;
+         D(q,1,e) = -J21;
+         D(q,2,e) = -J12;
+         D(q,3,e) =  J11;
+         D(q,4,e) = w_detJ * l;
+         D(q,5,e) = w_detJ * m;
+      }
+   });
+}
+
+// PA Elasticity Assemble 3D kernel
+static void PAElasticitySetup3D(const int Q1D,
+                                const int NE,
+                                const Array<double> &w,
+                                const Vector &j,
+                                const Vector &lam,
+                                const Vector &mu,
+                                Vector &op)
+{
+   const int NQ = Q1D*Q1D*Q1D;
+   const bool const_l = lam.Size() == 1;
+   const bool const_m = mu.Size() == 1;
+   auto W = w.Read();
+   auto J = Reshape(j.Read(), NQ, 3, 3, NE);
+   auto L = const_l ? Reshape(lam.Read(), 1, 1) : Reshape(lam.Read(), NQ, NE);
+   auto M = const_m ? Reshape(mu.Read(), 1, 1) : Reshape(mu.Read(), NQ, NE);
+   auto D = Reshape(op.Write(), NQ, 11, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int q = 0; q < NQ; ++q)
+      {
+         const double J11 = J(q,0,0,e);
+         const double J21 = J(q,1,0,e);
+         const double J31 = J(q,2,0,e);
+         const double J12 = J(q,0,1,e);
+         const double J22 = J(q,1,1,e);
+         const double J32 = J(q,2,1,e);
+         const double J13 = J(q,0,2,e);
+         const double J23 = J(q,1,2,e);
+         const double J33 = J(q,2,2,e);
+         const double detJ = J11 * (J22 * J33 - J32 * J23) -
+         /* */               J21 * (J12 * J33 - J32 * J13) +
+         /* */               J31 * (J12 * J23 - J22 * J13);
+         const double w_detJ = W[q] / detJ;
+         const double l = const_l ? L(0,0) : L(q,e);
+         const double m = const_m ? M(0,0) : M(q,e);
+         // adj(J), A(k,j) at slot k + 3*j
+         D(q,0,e) = (J22 * J33) - (J23 * J32); // A11
+         D(q,1,e) = (J31 * J23) - (J21 * J33); // A21
+         D(q,2,e) = (J21 * J32) - (J31 * J22); // A31
+         D(q,3,e) = (J32 * J13) - (J12 * J33); // A12
+         D(q,4,e) = (J11 * J33) - (J13 * J31); // A22
+         D(q,5,e) = (J31 * J12) - (J11 * J32); // A32
+         D(q,6,e) = (J12 * J23) - (J22 * J13); // A13
+         D(q,7,e) = (J21 * J13) - (J11 * J23); // A23
+         D(q,8,e) = (J11 * J22) - (J12 * J21); // A33
+         D(q,9,e) = w_detJ * l;
+         D(q,10,e) = w_detJ * m;
+      }
+   });
+}
+
+void ElasticityIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   // Assumes tensor-product elements
+   Mesh *mesh = fes.GetMesh();
+   const FiniteElement &el = *fes.GetFE(0);
+   ElementTransformation *T = mesh->GetElementTransformation(0);
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(),
+                                             2 * T->OrderGrad(&el));
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Dimension not supported.");
+   MFEM_VERIFY(dim == mesh->SpaceDimension(),
+               "Embedded meshes are not supported.");
+   MFEM_VERIFY(fes.GetVDim() == dim, "Unexpected vector dimension.");
+   ne = fes.GetNE();
+   const int nq = ir->GetNPoints();
+   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   pa_data.SetSize((dim*dim + 2) * nq * ne, Device::GetDeviceMemoryType());
+   // Evaluate lambda and mu at the quadrature points; the second constructor
+   // defines both as multiples of a single coefficient.
+   Vector l_q, m_q;
+   if (ConstantCoefficient *cM = dynamic_cast<ConstantCoefficient*>(mu))
+   {
+      m_q.SetSize(1);
+      m_q(0) = cM->constant;
+   }
+   else
+   {
+      // the virtual call lets subclasses fill all points in one batch
+      mu->Eval(m_q, fes, *ir);
+   }
+   if (lambda)
+   {
+      if (ConstantCoefficient *cL = dynamic_cast<ConstantCoefficient*>(lambda))
+      {
+         l_q.SetSize(1);
+         l_q(0) = cL->constant;
+      }
+      else
+      {
+         lambda->Eval(l_q, fes, *ir);
+      }
+   }
+   else
+   {
+      l_q = m_q;
+      l_q *= q_lambda;
+      m_q *= q_mu;
+   }
+   const Array<double> &w = ir->GetWeights();
+   const Vector &j = geom->J;
+   if (dim == 2)
+   {
+      PAElasticitySetup2D(quad1D, ne, w, j, l_q, m_q, pa_data);
+   }
+   else
+   {
+      PAElasticitySetup3D(quad1D, ne, w, j, l_q, m_q, pa_data);
+   }
+}
+
+// PA Elasticity Apply 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0> static
+void PAElasticityApply2D(const int NE,
+                         const Array<double> &b,
+                         const Array<double> &g,
+                         const Array<double> &bt,
+                         const Array<double> &gt,
+                         const Vector &d_,
+                         const Vector &x_,
+                         Vector &y_,
+                         const int d1d = 0,
+                         const int q1d = 0)
+{
+   constexpr int VDIM = 2;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto Gt = Reshape(gt.Read(), D1D, Q1D);
+   auto D = Reshape(d_.Read(), Q1D*Q1D, 6, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, VDIM, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, VDIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+      // grad[qy][qx][c][k] is the reference gradient of component c with
+      // respect to reference coordinate k; the components couple at the
+      // quadrature points, so all of them are evaluated before applying D.
+      double grad[max_Q1D][max_Q1D][VDIM][2];
+      for (int c = 0; c < VDIM; c++)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               grad[qy][qx][c][0] = 0.0;
+               grad[qy][qx][c][1] = 0.0;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double gradX[max_Q1D][2];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               gradX[qx][0] = 0.0;
+               gradX[qx][1] = 0.0;
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s = x(dx,dy,c,e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][0] += s * B(qx,dx);
+                  gradX[qx][1] += s * G(qx,dx);
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double wy  = B(qy,dy);
+               const double wDy = G(qy,dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  grad[qy][qx][c][0] += gradX[qx][1] * wy;
+                  grad[qy][qx][c][1] += gradX[qx][0] * wDy;
+               }
+            }
+         }
+      }
+      // Apply the stress operator at each quadrature point:
+      // H = Ghat adj(J), sigma = lw tr(H) I + mw (H + H^t),
+      // Ghat <- sigma adj(J)^t (stored back transposed, ready for the
+      // test-function contraction).
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy * Q1D;
+            const double A00 = D(q,0,e);
+            const double A10 = D(q,1,e);
+            const double A01 = D(q,2,e);
+            const double A11 = D(q,3,e);
+            const double lw = D(q,4,e);
+            const double mw = D(q,5,e);
+            const double g00 = grad[qy][qx][0][0];
+            const double g01 = grad[qy][qx][0][1];
+            const double g10 = grad[qy][qx][1][0];
+            const double g11 = grad[qy][qx][1][1];
+            // H(c,j) = sum_k Ghat(c,k) A(k,j)
+            const double H00 = g00*A00 + g01*A10;
+            const double H01 = g00*A01 + g01*A11;
+            const double H10 = g10*A00 + g11*A10;
+            const double H11 = g10*A01 + g11*A11;
+            const double lt = lw * (H00 + H11);
+            const double s00 = lt + 2.0*mw*H00;
+            const double s11 = lt + 2.0*mw*H11;
+            const double s01 = mw*(H01 + H10);
+            // Ghat(c,k) <- sum_j A(k,j) sigma(c,j)
+            grad[qy][qx][0][0] = A00*s00 + A01*s01;
+            grad[qy][qx][0][1] = A10*s00 + A11*s01;
+            grad[qy][qx][1][0] = A00*s01 + A01*s11;
+            grad[qy][qx][1][1] = A10*s01 + A11*s11;
+         }
+      }
+      for (int c = 0; c < VDIM; c++)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double gradX[max_D1D][2];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               gradX[dx][0] = 0.0;
+               gradX[dx][1] = 0.0;
+            }
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double gX = grad[qy][qx][c][0];
+               const double gY = grad[qy][qx][c][1];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double wx  = Bt(dx,qx);
+                  const double wDx = Gt(dx,qx);
+                  gradX[dx][0] += gX * wDx;
+                  gradX[dx][1] += gY * wx;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               const double wy  = Bt(dy,qy);
+               const double wDy = Gt(dy,qy);
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  y(dx,dy,c,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
+               }
+            }
+         }
+      }
+   });
+}
+
+// PA Elasticity Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0> static
+void PAElasticityApply3D(const int NE,
+                         const Array<double> &b,
+                         const Array<double> &g,
+                         const Array<double> &bt,
+                         const Array<double> &gt,
+                         const Vector &d_,
+                         const Vector &x_,
+                         Vector &y_,
+                         const int d1d = 0,
+                         const int q1d = 0)
+{
+   constexpr int VDIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto Gt = Reshape(gt.Read(), D1D, Q1D);
+   auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, 11, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, VDIM, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, VDIM, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+      // all components are needed at once at the quadrature points
+      double grad[max_Q1D][max_Q1D][max_Q1D][VDIM][3];
+      for (int c = 0; c < VDIM; ++c)
+      {
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  grad[qz][qy][qx][c][0] = 0.0;
+                  grad[qz][qy][qx][c][1] = 0.0;
+                  grad[qz][qy][qx][c][2] = 0.0;
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            double gradXY[max_Q1D][max_Q1D][3];
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradXY[qy][qx][0] = 0.0;
+                  gradXY[qy][qx][1] = 0.0;
+                  gradXY[qy][qx][2] = 0.0;
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               double gradX[max_Q1D][2];
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  gradX[qx][0] = 0.0;
+                  gradX[qx][1] = 0.0;
+               }
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double s = x(dx,dy,dz,c,e);
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     gradX[qx][0] += s * B(qx,dx);
+                     gradX[qx][1] += s * G(qx,dx);
+                  }
+               }
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const double wy  = B(qy,dy);
+                  const double wDy = G(qy,dy);
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     const double wx  = gradX[qx][0];
+                     const double wDx = gradX[qx][1];
+                     gradXY[qy][qx][0] += wDx * wy;
+                     gradXY[qy][qx][1] += wx  * wDy;
+                     gradXY[qy][qx][2] += wx  * wy;
+                  }
+               }
+            }
+            for (int qz = 0; qz < Q1D; ++qz)
+            {
+               const double wz  = B(qz,dz);
+               const double wDz = G(qz,dz);
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     grad[qz][qy][qx][c][0] += gradXY[qy][qx][0] * wz;
+                     grad[qz][qy][qx][c][1] += gradXY[qy][qx][1] * wz;
+                     grad[qz][qy][qx][c][2] += gradXY[qy][qx][2] * wDz;
+                  }
+               }
+            }
+         }
+      }
+      // Apply the stress operator at each quadrature point (see the 2D
+      // kernel).
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + (qy + qz * Q1D) * Q1D;
+               double A[3][3], Ghat[3][3], H[3][3], sigma[3][3];
+               for (int j = 0; j < 3; ++j)
+               {
+                  for (int k = 0; k < 3; ++k)
+                  {
+                     A[k][j] = D(q,k+3*j,e);
+                  }
+               }
+               const double lw = D(q,9,e);
+               const double mw = D(q,10,e);
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  for (int k = 0; k < 3; ++k)
+                  {
+                     Ghat[c][k] = grad[qz][qy][qx][c][k];
+                  }
+               }
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  for (int j = 0; j < 3; ++j)
+                  {
+                     H[c][j] = Ghat[c][0]*A[0][j] + Ghat[c][1]*A[1][j] +
+                               Ghat[c][2]*A[2][j];
+                  }
+               }
+               const double lt = lw * (H[0][0] + H[1][1] + H[2][2]);
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  for (int j = 0; j < 3; ++j)
+                  {
+                     sigma[c][j] = mw*(H[c][j] + H[j][c]);
+                  }
+                  sigma[c][c] += lt;
+               }
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  for (int k = 0; k < 3; ++k)
+                  {
+                     grad[qz][qy][qx][c][k] =
+                        A[k][0]*sigma[c][0] + A[k][1]*sigma[c][1] +
+                        A[k][2]*sigma[c][2];
+                  }
+               }
+            }
+         }
+      }
+      for (int c = 0; c < VDIM; ++c)
+      {
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            double gradXY[max_D1D][max_D1D][3];
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradXY[dy][dx][0] = 0;
+                  gradXY[dy][dx][1] = 0;
+                  gradXY[dy][dx][2] = 0;
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               double gradX[max_D1D][3];
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  gradX[dx][0] = 0;
+                  gradX[dx][1] = 0;
+                  gradX[dx][2] = 0;
+               }
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double gX = grad[qz][qy][qx][c][0];
+                  const double gY = grad[qz][qy][qx][c][1];
+                  const double gZ = grad[qz][qy][qx][c][2];
+                  for (int dx = 0; dx < D1D; ++dx)
+                  {
+                     const double wx  = Bt(dx,qx);
+                     const double wDx = Gt(dx,qx);
+                     gradX[dx][0] += gX * wDx;
+                     gradX[dx][1] += gY * wx;
+                     gradX[dx][2] += gZ * wx;
+                  }
+               }
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  const double wy  = Bt(dy,qy);
+                  const double wDy = Gt(dy,qy);
+                  for (int dx = 0; dx < D1D; ++dx)
+                  {
+                     gradXY[dy][dx][0] += gradX[dx][0] * wy;
+                     gradXY[dy][dx][1] += gradX[dx][1] * wDy;
+                     gradXY[dy][dx][2] += gradX[dx][2] * wy;
+                  }
+               }
+            }
+            for (int dz = 0; dz < D1D; ++dz)
+            {
+               const double wz  = Bt(dz,qz);
+               const double wDz = Gt(dz,qz);
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  for (int dx = 0; dx < D1D; ++dx)
+                  {
+                     y(dx,dy,dz,c,e) +=
+                        ((gradXY[dy][dx][0] * wz) +
+                         (gradXY[dy][dx][1] * wz) +
+                         (gradXY[dy][dx][2] * wDz));
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+// PA Elasticity Apply kernel
+void ElasticityIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   const int D1D = dofs1D;
+   const int Q1D = quad1D;
+   const Array<double> &B = maps->B;
+   const Array<double> &G = maps->G;
+   const Array<double> &Bt = maps->Bt;
+   const Array<double> &Gt = maps->Gt;
+   const Vector &D = pa_data;
+   if (dim == 2)
+   {
+      switch ((dofs1D << 4) | quad1D)
+      {
+         case 0x22: return PAElasticityApply2D<2,2>(ne,B,G,Bt,Gt,D,x,y);
+         case 0x33: return PAElasticityApply2D<3,3>(ne,B,G,Bt,Gt,D,x,y);
+         case 0x44: return PAElasticityApply2D<4,4>(ne,B,G,Bt,Gt,D,x,y);
+         case 0x55: return PAElasticityApply2D<5,5>(ne,B,G,Bt,Gt,D,x,y);
+         default: return PAElasticityApply2D(ne,B,G,Bt,Gt,D,x,y,D1D,Q1D);
+      }
+   }
+   if (dim == 3)
+   {
+      switch ((dofs1D << 4) | quad1D)
+      {
+         case 0x23: return PAElasticityApply3D<2,3>(ne,B,G,Bt,Gt,D,x,y);
+         case 0x34: return PAElasticityApply3D<3,4>(ne,B,G,Bt,Gt,D,x,y);
+         case 0x45: return PAElasticityApply3D<4,5>(ne,B,G,Bt,Gt,D,x,y);
+         default: return PAElasticityApply3D(ne,B,G,Bt,Gt,D,x,y,D1D,Q1D);
+      }
+   }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+// The component-c diagonal block of the element matrix contracts the
+// reference gradients with
+//    M(k,l) = (lw + mw) A(k,c) A(l,c) + mw sum_j A(k,j) A(l,j),
+// which follows from testing the stress operator with v = u = phi e_c.
+
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAElasticityDiagonal2D(const int NE,
+                                   const Array<double> &b,
+                                   const Array<double> &g,
+                                   const Vector &d,
+                                   Vector &y,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto D = Reshape(d.Read(), Q1D*Q1D, 6, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, 2, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MD1 = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : MAX_Q1D;
+      double QD0[MQ1][MD1];
+      double QD1[MQ1][MD1];
+      double QD2[MQ1][MD1];
+      for (int c = 0; c < 2; ++c)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               QD0[qx][dy] = 0.0;
+               QD1[qx][dy] = 0.0;
+               QD2[qx][dy] = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const int q = qx + qy * Q1D;
+                  const double A00 = D(q,0,e);
+                  const double A10 = D(q,1,e);
+                  const double A01 = D(q,2,e);
+                  const double A11 = D(q,3,e);
+                  const double lw = D(q,4,e);
+                  const double mw = D(q,5,e);
+                  const double A0c = c == 0 ? A00 : A01;
+                  const double A1c = c == 0 ? A10 : A11;
+                  const double M00 = (lw + mw)*A0c*A0c +
+                                     mw*(A00*A00 + A01*A01);
+                  const double M01 = (lw + mw)*A0c*A1c +
+                                     mw*(A00*A10 + A01*A11);
+                  const double M11 = (lw + mw)*A1c*A1c +
+                                     mw*(A10*A10 + A11*A11);
+                  QD0[qx][dy] += B(qy, dy) * B(qy, dy) * M00;
+                  QD1[qx][dy] += B(qy, dy) * G(qy, dy) * M01;
+                  QD2[qx][dy] += G(qy, dy) * G(qy, dy) * M11;
+               }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               double temp = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  temp += G(qx, dx) * G(qx, dx) * QD0[qx][dy];
+                  temp += G(qx, dx) * B(qx, dx) * QD1[qx][dy];
+                  temp += B(qx, dx) * G(qx, dx) * QD1[qx][dy];
+                  temp += B(qx, dx) * B(qx, dx) * QD2[qx][dy];
+               }
+               Y(dx,dy,c,e) += temp;
+            }
+         }
+      }
+   });
+}
+
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAElasticityDiagonal3D(const int NE,
+                                   const Array<double> &b,
+                                   const Array<double> &g,
+                                   const Vector &d,
+                                   Vector &y,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   constexpr int DIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Q = Reshape(d.Read(), Q1D*Q1D*Q1D, 11, NE);
+   auto Y = Reshape(y.ReadWrite(), D1D, D1D, D1D, 3, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MD1 = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : MAX_Q1D;
+      double QQD[MQ1][MQ1][MD1];
+      double QDD[MQ1][MD1][MD1];
+      for (int c = 0; c < DIM; ++c)
+      {
+         for (int i = 0; i < DIM; ++i)
+         {
+            for (int j = 0; j < DIM; ++j)
+            {
+               // first tensor contraction, along z direction
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     for (int dz = 0; dz < D1D; ++dz)
+                     {
+                        QQD[qx][qy][dz] = 0.0;
+                        for (int qz = 0; qz < Q1D; ++qz)
+                        {
+                           const int q = qx + (qy + qz * Q1D) * Q1D;
+                           const double lw = Q(q,9,e);
+                           const double mw = Q(q,10,e);
+                           double O = (lw + mw) * Q(q,i+3*c,e) * Q(q,j+3*c,e);
+                           for (int m = 0; m < DIM; ++m)
+                           {
+                              O += mw * Q(q,i+3*m,e) * Q(q,j+3*m,e);
+                           }
+                           const double Bz = B(qz,dz);
+                           const double Gz = G(qz,dz);
+                           const double L = i==2 ? Gz : Bz;
+                           const double R = j==2 ? Gz : Bz;
+                           QQD[qx][qy][dz] += L * O * R;
+                        }
+                     }
+                  }
+               }
+               // second tensor contraction, along y direction
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  for (int dz = 0; dz < D1D; ++dz)
+                  {
+                     for (int dy = 0; dy < D1D; ++dy)
+                     {
+                        QDD[qx][dy][dz] = 0.0;
+                        for (int qy = 0; qy < Q1D; ++qy)
+                        {
+                           const double By = B(qy,dy);
+                           const double Gy = G(qy,dy);
+                           const double L = i==1 ? Gy : By;
+                           const double R = j==1 ? Gy : By;
+                           QDD[qx][dy][dz] += L * QQD[qx][qy][dz] * R;
+                        }
+                     }
+                  }
+               }
+               // third tensor contraction, along x direction
+               for (int dz = 0; dz < D1D; ++dz)
+               {
+                  for (int dy = 0; dy < D1D; ++dy)
+                  {
+                     for (int dx = 0; dx < D1D; ++dx)
+                     {
+                        double temp = 0.0;
+                        for (int qx = 0; qx < Q1D; ++qx)
+                        {
+                           const double Bx = B(qx,dx);
+                           const double Gx = G(qx,dx);
+                           const double L = i==0 ? Gx : Bx;
+                           const double R = j==0 ? Gx : Bx;
+                           temp += L * QDD[qx][dy][dz] * R;
+                        }
+                        Y(dx, dy, dz, c, e) += temp;
+                     }
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+void ElasticityIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   if (dim == 2)
+   {
+      return PAElasticityDiagonal2D(ne, maps->B, maps->G, pa_data, diag,
+                                    dofs1D, quad1D);
+   }
+   else if (dim == 3)
+   {
+      return PAElasticityDiagonal3D(ne, maps->B, maps->G, pa_data, diag,
+                                    dofs1D, quad1D);
+   }
+   MFEM_ABORT("Dimension not implemented.");
+}
+
+} // namespace mfem
@@ -0,0 +1,456 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../general/forall.hpp"
+#include "bilininteg.hpp"
+#include "gridfunc.hpp"
+
+using namespace std;
+
+namespace mfem
+{
+
+// PA Discrete Interpolators (gradient, curl, divergence)
+
+// On tensor-product elements the discrete interpolation matrices are tensor
+// products of small 1D matrices: the trial basis (or its derivative)
+// tabulated at the dof points of the test space. Each component of the
+// interpolated field is one term of the form
+//
+//    y_test += sign * (M_z x M_y x M_x) x_trial,
+//
+// which the two kernels below apply for slices of the trial and test
+// E-vectors. The matrices are at most (order+2) x (order+2).
+constexpr int INTERP_MAX_D1D = HCURL_MAX_D1D + 1;
+
+// Fill 'ir' with the lexicographically ordered tensor product of the 1D
+// points 'pts1d'; only the coordinates are needed, not the weights.
+static void MakeTensorRule(const double *pts1d, const int n1d, const int dim,
+                           IntegrationRule &ir)
+{
+   const int n = TensorBasisElement::Pow(n1d, dim);
+   ir.SetSize(n);
+   for (int m = 0; m < n; m++)
+   {
+      IntegrationPoint &ip = ir.IntPoint(m);
+      ip.x = pts1d[m % n1d];
+      ip.y = (dim > 1) ? pts1d[(m / n1d) % n1d] : 0.0;
+      ip.z = (dim > 2) ? pts1d[m / (n1d * n1d)] : 0.0;
+      ip.weight = 0.0;
+   }
+}
+
+// y(:,qx,qy) += sgn * sum_{ix,iy} Mx(qx,ix) My(qy,iy) x(:,ix,iy), operating
+// on the component slices starting at x_ofs and y_ofs of E-vectors with
+// x_nd and y_nd dofs per element.
+static void PAInterpContract2D(const int NE, const double sgn,
+                               const int nx, const int ny,
+                               const int mx, const int my,
+                               const Array<double> &mat_x,
+                               const Array<double> &mat_y,
+                               const Vector &x_, const int x_nd,
+                               const int x_ofs,
+                               Vector &y_, const int y_nd, const int y_ofs)
+{
+   MFEM_VERIFY(nx <= INTERP_MAX_D1D && ny <= INTERP_MAX_D1D &&
+               mx <= INTERP_MAX_D1D && my <= INTERP_MAX_D1D, "");
+   auto Mx = Reshape(mat_x.Read(), mx, nx);
+   auto My = Reshape(mat_y.Read(), my, ny);
+   auto x = Reshape(x_.Read(), x_nd, NE);
+   auto y = Reshape(y_.ReadWrite(), y_nd, NE);
+   MFEM_FORALL(e, NE,
+   {
+      double t1[INTERP_MAX_D1D][INTERP_MAX_D1D];
+      for (int qx = 0; qx < mx; ++qx)
+      {
+         for (int iy = 0; iy < ny; ++iy)
+         {
+            double s = 0.0;
+            for (int ix = 0; ix < nx; ++ix)
+            {
+               s += Mx(qx,ix) * x(x_ofs + ix + nx*iy, e);
+            }
+            t1[qx][iy] = s;
+         }
+      }
+      for (int qy = 0; qy < my; ++qy)
+      {
+         for (int qx = 0; qx < mx; ++qx)
+         {
+            double s = 0.0;
+            for (int iy = 0; iy < ny; ++iy)
+            {
+               s += My(qy,iy) * t1[qx][iy];
+            }
+            y(y_ofs + qx + mx*qy, e) += sgn * s;
+         }
+      }
+   });
+}
+
+// 3D version of PAInterpContract2D
+static void PAInterpContract3D(const int NE, const double sgn,
+                               const int nx, const int ny, const int nz,
+                               const int mx, const int my, const int mz,
+                               const Array<double> &mat_x,
+                               const Array<double> &mat_y,
+                               const Array<double> &mat_z,
+                               const Vector &x_, const int x_nd,
+                               const int x_ofs,
+                               Vector &y_, const int y_nd, const int y_ofs)
+{
+   MFEM_VERIFY(nx <= INTERP_MAX_D1D && ny <= INTERP_MAX_D1D &&
+               nz <= INTERP_MAX_D1D && mx <= INTERP_MAX_D1D &&
+               my <= INTERP_MAX_D1D && mz <= INTERP_MAX_D1D, "");
+   auto Mx = Reshape(mat_x.Read(), mx, nx);
+   auto My = Reshape(mat_y.Read(), my, ny);
+   auto Mz = Reshape(mat_z.Read(), mz, nz);
+   auto x = Reshape(x_.Read(), x_nd, NE);
+   auto y = Reshape(y_.ReadWrite(), y_nd, NE);
+   MFEM_FORALL(e, NE,
+   {
+      double t1[INTERP_MAX_D1D][INTERP_MAX_D1D][INTERP_MAX_D1D];
+      double t2[INTERP_MAX_D1D][INTERP_MAX_D1D][INTERP_MAX_D1D];
+      for (int qx = 0; qx < mx; ++qx)
+      {
+         for (int iy = 0; iy < ny; ++iy)
+         {
+            for (int iz = 0; iz < nz; ++iz)
+            {
+               double s = 0.0;
+               for (int ix = 0; ix < nx; ++ix)
+               {
+                  s += Mx(qx,ix) * x(x_ofs + ix + nx*(iy + ny*iz), e);
+               }
+               t1[qx][iy][iz] = s;
+            }
+         }
+      }
+      for (int qy = 0; qy < my; ++qy)
+      {
+         for (int qx = 0; qx < mx; ++qx)
+         {
+            for (int iz = 0; iz < nz; ++iz)
+            {
+               double s = 0.0;
+               for (int iy = 0; iy < ny; ++iy)
+               {
+                  s += My(qy,iy) * t1[qx][iy][iz];
+               }
+               t2[qx][qy][iz] = s;
+            }
+         }
+      }
+      for (int qz = 0; qz < mz; ++qz)
+      {
+         for (int qy = 0; qy < my; ++qy)
+         {
+            for (int qx = 0; qx < mx; ++qx)
+            {
+               double s = 0.0;
+               for (int iz = 0; iz < nz; ++iz)
+               {
+                  s += Mz(qz,iz) * t2[qx][qy][iz];
+               }
+               y(y_ofs + qx + mx*(qy + my*qz), e) += sgn * s;
+            }
+         }
+      }
+   });
+}
+
+// Discrete gradient: H^1 -> H(curl)
+
+void GradientInterpolator::AssemblePA(const FiniteElementSpace &trial_fes,
+                                      const FiniteElementSpace &test_fes)
+{
+   // Assumes tensor-product elements
+   Mesh *mesh = trial_fes.GetMesh();
+   const FiniteElement *trial_fe = trial_fes.GetFE(0);
+   const FiniteElement *test_fe = test_fes.GetFE(0);
+   const TensorBasisElement *trial_tb =
+      dynamic_cast<const TensorBasisElement*>(trial_fe);
+   MFEM_VERIFY(trial_tb &&
+               dynamic_cast<const VectorTensorFiniteElement*>(test_fe),
+               "Only tensor-product elements are supported.");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Dimension not supported.");
+   ne = trial_fes.GetNE();
+   const int order = test_fe->GetOrder();
+   MFEM_VERIFY(trial_fe->GetOrder() == order,
+               "The orders of the trial and test spaces must match.");
+   c_dofs1D = order + 1;
+   o_dofs1D = order;
+   // Tabulate the 1D trial basis and its derivative at the closed
+   // (Gauss-Lobatto) and open (Gauss-Legendre) dof points of the test space.
+   // The reference-space gradient is geometry independent, so this is all the
+   // data the action needs.
+   const Poly_1D::Basis &basis1d = trial_tb->GetBasis1D();
+   const double *cp = poly1d.GetPoints(order, BasisType::GaussLobatto);
+   const double *op = poly1d.GetPoints(order - 1, BasisType::GaussLegendre);
+   B_c.SetSize(c_dofs1D * c_dofs1D);
+   B_ct.SetSize(c_dofs1D * c_dofs1D);
+   G_o.SetSize(o_dofs1D * c_dofs1D);
+   G_ot.SetSize(c_dofs1D * o_dofs1D);
+   Vector val(c_dofs1D), grad(c_dofs1D);
+   for (int i = 0; i < c_dofs1D; i++)
+   {
+      basis1d.Eval(cp[i], val, grad);
+      for (int j = 0; j < c_dofs1D; j++)
+      {
+         B_c[i + c_dofs1D*j] = B_ct[j + c_dofs1D*i] = val(j);
+      }
+   }
+   for (int i = 0; i < o_dofs1D; i++)
+   {
+      basis1d.Eval(op[i], val, grad);
+      for (int j = 0; j < c_dofs1D; j++)
+      {
+         G_o[i + o_dofs1D*j] = G_ot[j + c_dofs1D*i] = grad(j);
+      }
+   }
+}
+
+void GradientInterpolator::AddMultPA(const Vector &x, Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D;
+   if (dim == 2)
+   {
+      const int x_nd = c*c, y_nd = 2*o*c;
+      PAInterpContract2D(ne, 1.0, c,c, o,c, G_o, B_c, x, x_nd, 0,
+                         y, y_nd, 0);
+      PAInterpContract2D(ne, 1.0, c,c, c,o, B_c, G_o, x, x_nd, 0,
+                         y, y_nd, o*c);
+   }
+   else
+   {
+      const int x_nd = c*c*c, y_nd = 3*o*c*c;
+      PAInterpContract3D(ne, 1.0, c,c,c, o,c,c, G_o, B_c, B_c,
+                         x, x_nd, 0, y, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, c,c,c, c,o,c, B_c, G_o, B_c,
+                         x, x_nd, 0, y, y_nd, o*c*c);
+      PAInterpContract3D(ne, 1.0, c,c,c, c,c,o, B_c, B_c, G_o,
+                         x, x_nd, 0, y, y_nd, 2*o*c*c);
+   }
+}
+
+void GradientInterpolator::AddMultTransposePA(const Vector &x, Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D;
+   if (dim == 2)
+   {
+      const int x_nd = 2*o*c, y_nd = c*c;
+      PAInterpContract2D(ne, 1.0, o,c, c,c, G_ot, B_ct, x, x_nd, 0,
+                         y, y_nd, 0);
+      PAInterpContract2D(ne, 1.0, c,o, c,c, B_ct, G_ot, x, x_nd, o*c,
+                         y, y_nd, 0);
+   }
+   else
+   {
+      const int x_nd = 3*o*c*c, y_nd = c*c*c;
+      PAInterpContract3D(ne, 1.0, o,c,c, c,c,c, G_ot, B_ct, B_ct,
+                         x, x_nd, 0, y, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, c,o,c, c,c,c, B_ct, G_ot, B_ct,
+                         x, x_nd, o*c*c, y, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, c,c,o, c,c,c, B_ct, B_ct, G_ot,
+                         x, x_nd, 2*o*c*c, y, y_nd, 0);
+   }
+}
+
+// Discrete curl: H(curl) -> H(div), 3D
+
+void CurlInterpolator::AssemblePA(const FiniteElementSpace &trial_fes,
+                                  const FiniteElementSpace &test_fes)
+{
+   // Assumes tensor-product elements
+   Mesh *mesh = trial_fes.GetMesh();
+   const VectorTensorFiniteElement *trial_el =
+      dynamic_cast<const VectorTensorFiniteElement*>(trial_fes.GetFE(0));
+   const VectorTensorFiniteElement *test_el =
+      dynamic_cast<const VectorTensorFiniteElement*>(test_fes.GetFE(0));
+   MFEM_VERIFY(trial_el && test_el,
+               "Only tensor-product elements are supported.");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 3, "Only the 3D H(curl) -> H(div) case is supported.");
+   ne = trial_fes.GetNE();
+   const int order = trial_el->GetOrder();
+   MFEM_VERIFY(test_el->GetOrder() == order,
+               "Incompatible trial and test spaces.");
+   c_dofs1D = order + 1;
+   o_dofs1D = order;
+   // The two spaces share the closed (Gauss-Lobatto) and open
+   // (Gauss-Legendre) 1D dof points, where the reference-space curl reduces
+   // to tensor contractions with the maps tabulated here.
+   MakeTensorRule(poly1d.GetPoints(order, BasisType::GaussLobatto),
+                  c_dofs1D, dim, ir_c);
+   MakeTensorRule(poly1d.GetPoints(order - 1, BasisType::GaussLegendre),
+                  o_dofs1D, dim, ir_o);
+   maps_C_C = &trial_el->GetDofToQuad(ir_c, DofToQuad::TENSOR);
+   maps_C_O = &trial_el->GetDofToQuad(ir_o, DofToQuad::TENSOR);
+   maps_O_O = &trial_el->GetDofToQuadOpen(ir_o, DofToQuad::TENSOR);
+}
+
+void CurlInterpolator::AddMultPA(const Vector &x, Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D;
+   const int x_nd = 3*o*c*c, y_nd = 3*c*o*o;
+   // trial (H(curl)) and test (H(div)) component offsets
+   const int xo[3] = { 0, o*c*c, 2*o*c*c };
+   const int yo[3] = { 0, c*o*o, 2*c*o*o };
+   const Array<double> &Bc = maps_C_C->B;
+   const Array<double> &G = maps_C_O->G;
+   const Array<double> &Bo = maps_O_O->B;
+   // (curl u)_x = d u_z / d y - d u_y / d z, and cyclic
+   PAInterpContract3D(ne,  1.0, c,c,o, c,o,o, Bc, G, Bo,
+                      x, x_nd, xo[2], y, y_nd, yo[0]);
+   PAInterpContract3D(ne, -1.0, c,o,c, c,o,o, Bc, Bo, G,
+                      x, x_nd, xo[1], y, y_nd, yo[0]);
+   PAInterpContract3D(ne,  1.0, o,c,c, o,c,o, Bo, Bc, G,
+                      x, x_nd, xo[0], y, y_nd, yo[1]);
+   PAInterpContract3D(ne, -1.0, c,c,o, o,c,o, G, Bc, Bo,
+                      x, x_nd, xo[2], y, y_nd, yo[1]);
+   PAInterpContract3D(ne,  1.0, c,o,c, o,o,c, G, Bo, Bc,
+                      x, x_nd, xo[1], y, y_nd, yo[2]);
+   PAInterpContract3D(ne, -1.0, o,c,c, o,o,c, Bo, G, Bc,
+                      x, x_nd, xo[0], y, y_nd, yo[2]);
+}
+
+void CurlInterpolator::AddMultTransposePA(const Vector &x, Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D;
+   const int x_nd = 3*c*o*o, y_nd = 3*o*c*c;
+   const int xo[3] = { 0, c*o*o, 2*c*o*o };
+   const int yo[3] = { 0, o*c*c, 2*o*c*c };
+   const Array<double> &Bct = maps_C_C->Bt;
+   const Array<double> &Gt = maps_C_O->Gt;
+   const Array<double> &Bot = maps_O_O->Bt;
+   // the transposes of the six terms in AddMultPA()
+   PAInterpContract3D(ne,  1.0, c,o,o, c,c,o, Bct, Gt, Bot,
+                      x, x_nd, xo[0], y, y_nd, yo[2]);
+   PAInterpContract3D(ne, -1.0, c,o,o, c,o,c, Bct, Bot, Gt,
+                      x, x_nd, xo[0], y, y_nd, yo[1]);
+   PAInterpContract3D(ne,  1.0, o,c,o, o,c,c, Bot, Bct, Gt,
+                      x, x_nd, xo[1], y, y_nd, yo[0]);
+   PAInterpContract3D(ne, -1.0, o,c,o, c,c,o, Gt, Bct, Bot,
+                      x, x_nd, xo[1], y, y_nd, yo[2]);
+   PAInterpContract3D(ne,  1.0, o,o,c, c,o,c, Gt, Bot, Bct,
+                      x, x_nd, xo[2], y, y_nd, yo[1]);
+   PAInterpContract3D(ne, -1.0, o,o,c, o,c,c, Bot, Gt, Bct,
+                      x, x_nd, xo[2], y, y_nd, yo[0]);
+}
+
+// Discrete divergence: H(div) -> L2
+
+void DivergenceInterpolator::AssemblePA(const FiniteElementSpace &trial_fes,
+                                        const FiniteElementSpace &test_fes)
+{
+   // Assumes tensor-product elements
+   Mesh *mesh = trial_fes.GetMesh();
+   const VectorTensorFiniteElement *trial_el =
+      dynamic_cast<const VectorTensorFiniteElement*>(trial_fes.GetFE(0));
+   const FiniteElement *test_fe = test_fes.GetFE(0);
+   const NodalTensorFiniteElement *test_el =
+      dynamic_cast<const NodalTensorFiniteElement*>(test_fe);
+   MFEM_VERIFY(trial_el && test_el,
+               "Only tensor-product elements are supported.");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "Dimension not supported.");
+   ne = trial_fes.GetNE();
+   const int order = test_el->GetOrder();
+   MFEM_VERIFY(trial_el->GetOrder() == order + 1,
+               "Incompatible trial and test spaces.");
+   c_dofs1D = order + 2;
+   o_dofs1D = order + 1;
+   n_dofs1D = order + 1;
+   // The trial bases are tabulated at the (nodal) test dofs; since those are
+   // point values, the reference-space divergence picks up the geometric
+   // factor 1/det(J) at each node.
+   MakeTensorRule(poly1d.GetPoints(order, test_el->GetBasisType()),
+                  n_dofs1D, dim, ir_n);
+   maps_C_N = &trial_el->GetDofToQuad(ir_n, DofToQuad::TENSOR);
+   maps_O_N = &trial_el->GetDofToQuadOpen(ir_n, DofToQuad::TENSOR);
+   geom = mesh->GetGeometricFactors(ir_n, GeometricFactors::DETERMINANTS);
+   const int nq = ir_n.GetNPoints();
+   pa_data.SetSize(nq * ne, Device::GetDeviceMemoryType());
+   const auto detJ = geom->detJ.Read();
+   auto d = pa_data.Write();
+   MFEM_FORALL(i, nq * ne, d[i] = 1.0 / detJ[i]; );
+}
+
+void DivergenceInterpolator::AddMultPA(const Vector &x, Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D, n = n_dofs1D;
+   const Array<double> &G = maps_C_N->G;
+   const Array<double> &Bo = maps_O_N->B;
+   const int y_nd = (dim == 2) ? n*n : n*n*n;
+   e_buf.SetSize(y_nd * ne, Device::GetDeviceMemoryType());
+   e_buf.UseDevice(true);
+   e_buf = 0.0;
+   if (dim == 2)
+   {
+      const int x_nd = 2*c*o;
+      PAInterpContract2D(ne, 1.0, c,o, n,n, G, Bo, x, x_nd, 0,
+                         e_buf, y_nd, 0);
+      PAInterpContract2D(ne, 1.0, o,c, n,n, Bo, G, x, x_nd, c*o,
+                         e_buf, y_nd, 0);
+   }
+   else
+   {
+      const int x_nd = 3*c*o*o;
+      PAInterpContract3D(ne, 1.0, c,o,o, n,n,n, G, Bo, Bo,
+                         x, x_nd, 0, e_buf, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, o,c,o, n,n,n, Bo, G, Bo,
+                         x, x_nd, c*o*o, e_buf, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, o,o,c, n,n,n, Bo, Bo, G,
+                         x, x_nd, 2*c*o*o, e_buf, y_nd, 0);
+   }
+   const auto d = pa_data.Read();
+   const auto b = e_buf.Read();
+   auto Y = y.ReadWrite();
+   MFEM_FORALL(i, y_nd * ne, Y[i] += d[i] * b[i]; );
+}
+
+void DivergenceInterpolator::AddMultTransposePA(const Vector &x,
+                                                Vector &y) const
+{
+   const int c = c_dofs1D, o = o_dofs1D, n = n_dofs1D;
+   const Array<double> &Gt = maps_C_N->Gt;
+   const Array<double> &Bot = maps_O_N->Bt;
+   const int x_nd = (dim == 2) ? n*n : n*n*n;
+   e_buf.SetSize(x_nd * ne, Device::GetDeviceMemoryType());
+   e_buf.UseDevice(true);
+   {
+      const auto d = pa_data.Read();
+      const auto X = x.Read();
+      auto b = e_buf.Write();
+      MFEM_FORALL(i, x_nd * ne, b[i] = d[i] * X[i]; );
+   }
+   if (dim == 2)
+   {
+      const int y_nd = 2*c*o;
+      PAInterpContract2D(ne, 1.0, n,n, c,o, Gt, Bot, e_buf, x_nd, 0,
+                         y, y_nd, 0);
+      PAInterpContract2D(ne, 1.0, n,n, o,c, Bot, Gt, e_buf, x_nd, 0,
+                         y, y_nd, c*o);
+   }
+   else
+   {
+      const int y_nd = 3*c*o*o;
+      PAInterpContract3D(ne, 1.0, n,n,n, c,o,o, Gt, Bot, Bot,
+                         e_buf, x_nd, 0, y, y_nd, 0);
+      PAInterpContract3D(ne, 1.0, n,n,n, o,c,o, Bot, Gt, Bot,
+                         e_buf, x_nd, 0, y, y_nd, c*o*o);
+      PAInterpContract3D(ne, 1.0, n,n,n, o,o,c, Bot, Bot, Gt,
+                         e_buf, x_nd, 0, y, y_nd, 2*c*o*o);
+   }
+}
+
+} // namespace mfem
@@ -10,10 +10,14 @@
 // CONTRIBUTING.md for details.
 
 #include "../general/forall.hpp"
+#include "../general/jit.hpp"
 #include "bilininteg.hpp"
 #include "gridfunc.hpp"
+#include "kernel_dispatch.hpp"
 #include "libceed/mass.hpp"
 
+#include <sstream>
+
 using namespace std;
 
 namespace mfem
@@ -45,8 +49,8 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
    dim = mesh->Dimension();
    ne = fes.GetMesh()->GetNE();
    nq = ir->GetNPoints();
-   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::COORDINATES |
-                                    GeometricFactors::JACOBIANS);
+   geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS |
+                                    GeometricFactors::COMPRESSED);
    maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
    dofs1D = maps->ndof;
    quad1D = maps->nqpt;
@@ -77,16 +81,9 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
    }
    else
    {
-      coeff.SetSize(nq * ne);
-      auto C = Reshape(coeff.HostWrite(), nq, ne);
-      for (int e = 0; e < ne; ++e)
-      {
-         ElementTransformation& T = *fes.GetElementTransformation(e);
-         for (int q = 0; q < nq; ++q)
-         {
-            C(q,e) = Q->Eval(T, ir->IntPoint(q));
-         }
-      }
+      // the virtual call allows subclasses (e.g. PWConstCoefficient) to fill
+      // all quadrature points in one batch, possibly on the device
+      Q->Eval(coeff, fes, *ir);
    }
    if (dim==1) { MFEM_ABORT("Not supported yet... stay tuned!"); }
    if (dim==2)
@@ -94,8 +91,11 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
       const int NE = ne;
       const int Q1D = quad1D;
       const bool const_c = coeff.Size() == 1;
+      // with compressed geometric factors, J holds one Jacobian per element
+      const bool affine = geom->compressed;
+      const int JQ1D = affine ? 1 : Q1D;
       const auto W = Reshape(ir->GetWeights().Read(), Q1D,Q1D);
-      const auto J = Reshape(geom->J.Read(), Q1D,Q1D,2,2,NE);
+      const auto J = Reshape(geom->J.Read(), JQ1D,JQ1D,2,2,NE);
       const auto C = const_c ? Reshape(coeff.Read(), 1,1,1) :
                      Reshape(coeff.Read(), Q1D,Q1D,NE);
       auto v = Reshape(pa_data.Write(), Q1D,Q1D, NE);
@@ -105,10 +105,12 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
          {
             MFEM_FOREACH_THREAD(qy,y,Q1D)
             {
-               const double J11 = J(qx,qy,0,0,e);
-               const double J12 = J(qx,qy,1,0,e);
-               const double J21 = J(qx,qy,0,1,e);
-               const double J22 = J(qx,qy,1,1,e);
+               const int jx = affine ? 0 : qx;
+               const int jy = affine ? 0 : qy;
+               const double J11 = J(jx,jy,0,0,e);
+               const double J12 = J(jx,jy,1,0,e);
+               const double J21 = J(jx,jy,0,1,e);
+               const double J22 = J(jx,jy,1,1,e);
                const double detJ = (J11*J22)-(J21*J12);
                const double coeff = const_c ? C(0,0,0) : C(qx,qy,e);
                v(qx,qy,e) =  W(qx,qy) * coeff * detJ;
@@ -121,8 +123,10 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
       const int NE = ne;
       const int Q1D = quad1D;
       const bool const_c = coeff.Size() == 1;
+      const bool affine = geom->compressed;
+      const int JQ1D = affine ? 1 : Q1D;
       const auto W = Reshape(ir->GetWeights().Read(), Q1D,Q1D,Q1D);
-      const auto J = Reshape(geom->J.Read(), Q1D,Q1D,Q1D,3,3,NE);
+      const auto J = Reshape(geom->J.Read(), JQ1D,JQ1D,JQ1D,3,3,NE);
       const auto C = const_c ? Reshape(coeff.Read(), 1,1,1,1) :
                      Reshape(coeff.Read(), Q1D,Q1D,Q1D,NE);
       auto v = Reshape(pa_data.Write(), Q1D,Q1D,Q1D,NE);
@@ -134,15 +138,18 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
             {
                MFEM_FOREACH_THREAD(qz,z,Q1D)
                {
-                  const double J11 = J(qx,qy,qz,0,0,e);
-                  const double J21 = J(qx,qy,qz,1,0,e);
-                  const double J31 = J(qx,qy,qz,2,0,e);
-                  const double J12 = J(qx,qy,qz,0,1,e);
-                  const double J22 = J(qx,qy,qz,1,1,e);
-                  const double J32 = J(qx,qy,qz,2,1,e);
-                  const double J13 = J(qx,qy,qz,0,2,e);
-                  const double J23 = J(qx,qy,qz,1,2,e);
-                  const double J33 = J(qx,qy,qz,2,2,e);
+                  const int jx = affine ? 0 : qx;
+                  const int jy = affine ? 0 : qy;
+                  const int jz = affine ? 0 : qz;
+                  const double J11 = J(jx,jy,jz,0,0,e);
+                  const double J21 = J(jx,jy,jz,1,0,e);
+                  const double J31 = J(jx,jy,jz,2,0,e);
+                  const double J12 = J(jx,jy,jz,0,1,e);
+                  const double J22 = J(jx,jy,jz,1,1,e);
+                  const double J32 = J(jx,jy,jz,2,1,e);
+                  const double J13 = J(jx,jy,jz,0,2,e);
+                  const double J23 = J(jx,jy,jz,1,2,e);
+                  const double J33 = J(jx,jy,jz,2,2,e);
                   const double detJ = J11 * (J22 * J33 - J32 * J23) -
                   /* */               J21 * (J12 * J33 - J32 * J13) +
                   /* */               J31 * (J12 * J23 - J22 * J13);
@@ -153,10 +160,86 @@ void MassIntegrator::SetupPA(const FiniteElementSpace &fes)
          }
       });
    }
+   if (pa_reduced)
+   {
+      // demote the quadrature data; the apply kernels convert back on load
+      const int sz = pa_data.Size();
+      pa_data_f32.SetSize(sz, Device::GetDeviceMemoryType());
+      const double *pa_d = pa_data.Read();
+      float *pa_f = pa_data_f32.Write();
+      MFEM_FORALL(i, sz, pa_f[i] = (float) pa_d[i];);
+      pa_data.Destroy();
+   }
+}
+
+void MassIntegrator::SetupPAMixed(const FiniteElementSpace &fes)
+{
+   fespace = &fes;
+   Mesh *mesh = fes.GetMesh();
+   MFEM_VERIFY(fes.GetVDim() == 1,
+               "vdim != 1 is not supported on mixed meshes");
+   dim = mesh->Dimension();
+   ne = fes.GetNE();
+   Array<Geometry::Type> geoms;
+   mesh->GetGeometries(dim, geoms);
+   const int nbatch = geoms.Size();
+   batch_restr.SetSize(nbatch);
+   batch_maps.SetSize(nbatch);
+   batch_offsets.SetSize(nbatch + 1);
+   batch_offsets[0] = 0;
+   for (int b = 0; b < nbatch; ++b)
+   {
+      int e0 = 0;
+      while (mesh->GetElementBaseGeometry(e0) != geoms[b]) { ++e0; }
+      const FiniteElement &el = *fes.GetFE(e0);
+      // Use the sum-factorized kernels for the tensor-product batches and the
+      // dense basis-at-quadrature-points kernel for the other batches.
+      const bool tensor = dynamic_cast<const TensorBasisElement*>(&el) != NULL;
+      const ElementDofOrdering ordering = tensor ?
+                                          ElementDofOrdering::LEXICOGRAPHIC :
+                                          ElementDofOrdering::NATIVE;
+      batch_restr[b] = static_cast<const GeometryElementRestriction*>(
+                          fes.GetElementRestriction(ordering, geoms[b]));
+      ElementTransformation &T = *mesh->GetElementTransformation(e0);
+      const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, T);
+      batch_maps[b] = &el.GetDofToQuad(*ir, tensor ? DofToQuad::TENSOR :
+                                       DofToQuad::FULL);
+      batch_offsets[b+1] = batch_offsets[b] +
+                           ir->GetNPoints()*batch_restr[b]->GetNE();
+   }
+   pa_data.SetSize(batch_offsets[nbatch], Device::GetDeviceMemoryType());
+   // Quadrature data w_q * coeff * detJ, one batch at a time. The setup is
+   // done on the host since there are no geometric factors for mixed meshes.
+   double *pa = pa_data.HostWrite();
+   for (int b = 0; b < nbatch; ++b)
+   {
+      const Array<int> &elems = batch_restr[b]->GetElementList();
+      const IntegrationRule &ir = *batch_maps[b]->IntRule;
+      const int nqpts = ir.GetNPoints();
+      double *v = pa + batch_offsets[b];
+      for (int i = 0; i < elems.Size(); ++i)
+      {
+         ElementTransformation &T = *fes.GetElementTransformation(elems[i]);
+         for (int q = 0; q < nqpts; ++q)
+         {
+            const IntegrationPoint &ip = ir.IntPoint(q);
+            T.SetIntPoint(&ip);
+            const double coeff = Q ? Q->Eval(T, ip) : 1.0;
+            v[nqpts*i + q] = ip.weight * coeff * T.Weight();
+         }
+      }
+   }
 }
 
 void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
 {
+   Mesh *mesh = fes.GetMesh();
+   if (mesh->GetNE() > 0 && mesh->GetNumGeometries(mesh->Dimension()) > 1)
+   {
+      SetupPAMixed(fes);
+      return;
+   }
+   batch_restr.SetSize(0);
    SetupPA(fes);
 }
 
@@ -466,18 +549,84 @@ static void PAMassAssembleDiagonal(const int dim, const int D1D,
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Mass Diagonal kernel for non-tensor elements, batched over elements
+// using the dense basis matrix evaluated at the quadrature points.
+static void PAMassAssembleDiagonalDense(const int ND,
+                                        const int NQ,
+                                        const int NE,
+                                        const Array<double> &b,
+                                        const Vector &d,
+                                        Vector &y)
+{
+   auto B = Reshape(b.Read(), NQ, ND);
+   auto D = Reshape(d.Read(), NQ, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   MFEM_FORALL(e, NE,
+   {
+      for (int dof = 0; dof < ND; ++dof)
+      {
+         double res = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            res += B(q,dof) * B(q,dof) * D(q,e);
+         }
+         Y(dof,e) += res;
+      }
+   });
+}
+
 void MassIntegrator::AssembleDiagonalPA(Vector &diag)
 {
 #ifdef MFEM_USE_CEED
    if (DeviceCanUseCeed())
    {
       CeedAssembleDiagonalPA(ceedDataPtr, diag);
+      return;
    }
-   else
 #endif
+   if (batch_restr.Size() > 0)
    {
-      PAMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa_data, diag);
+      // Mixed mesh: diag is an L-vector here, see
+      // PABilinearFormExtension::AssembleDiagonal(). Process the geometry
+      // batches one at a time, accumulating into diag.
+      for (int b = 0; b < batch_restr.Size(); ++b)
+      {
+         const GeometryElementRestriction &restr = *batch_restr[b];
+         const DofToQuad &m = *batch_maps[b];
+         if (restr.GetNE() == 0) { continue; }
+         batch_y.SetSize(restr.Height(), Device::GetDeviceMemoryType());
+         batch_y.UseDevice(true);
+         batch_y = 0.0;
+         Vector op;
+         op.MakeRef(pa_data, batch_offsets[b],
+                    batch_offsets[b+1] - batch_offsets[b]);
+         if (m.mode == DofToQuad::TENSOR)
+         {
+            PAMassAssembleDiagonal(dim, m.ndof, m.nqpt, restr.GetNE(),
+                                   m.B, op, batch_y);
+         }
+         else
+         {
+            PAMassAssembleDiagonalDense(m.ndof, m.nqpt, restr.GetNE(),
+                                        m.B, op, batch_y);
+         }
+         restr.MultTransposeUnsigned(batch_y, diag);
+      }
+      return;
+   }
+   if (pa_reduced)
+   {
+      // one-off promotion of the quadrature data back to double: the
+      // diagonal assembly is not bandwidth critical
+      Vector pa(pa_data_f32.Size());
+      pa.UseDevice(true);
+      const float *pa_f = pa_data_f32.Read();
+      double *pa_d = pa.Write();
+      MFEM_FORALL(i, pa.Size(), pa_d[i] = pa_f[i];);
+      PAMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa, diag);
+      return;
    }
+   PAMassAssembleDiagonal(dim, dofs1D, quad1D, ne, maps->B, pa_data, diag);
 }
 
 
@@ -573,11 +722,14 @@ static void OccaPAMassApply3D(const int D1D,
 }
 #endif // MFEM_USE_OCCA
 
-template<int T_D1D = 0, int T_Q1D = 0>
+// PA Mass Apply 2D kernel; the quadrature data scalar is a template
+// parameter so the same kernel serves the double and the reduced precision
+// storage of pa_data, converting on load.
+template<typename TD, int T_D1D = 0, int T_Q1D = 0>
 static void PAMassApply2D(const int NE,
                           const Array<double> &b_,
                           const Array<double> &bt_,
-                          const Vector &d_,
+                          const TD *d_,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
@@ -589,7 +741,7 @@ static void PAMassApply2D(const int NE,
    MFEM_VERIFY(Q1D <= MAX_Q1D, "");
    auto B = Reshape(b_.Read(), Q1D, D1D);
    auto Bt = Reshape(bt_.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D, Q1D, NE);
+   auto D = Reshape(d_, Q1D, Q1D, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
    MFEM_FORALL(e, NE,
@@ -665,6 +817,22 @@ static void PAMassApply2D(const int NE,
    });
 }
 
+// PA Mass Apply 2D kernel with the double precision quadrature data in a
+// Vector, the form expected by the kernel dispatch table and the JIT.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAMassApply2D(const int NE,
+                          const Array<double> &b_,
+                          const Array<double> &bt_,
+                          const Vector &d_,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int q1d = 0)
+{
+   PAMassApply2D<double,T_D1D,T_Q1D>(NE, b_, bt_, d_.Read(), x_, y_,
+                                     d1d, q1d);
+}
+
 template<int T_D1D = 0, int T_Q1D = 0, int T_NBZ = 0>
 static void SmemPAMassApply2D(const int NE,
                               const Array<double> &b_,
@@ -788,11 +956,12 @@ static void SmemPAMassApply2D(const int NE,
    });
 }
 
-template<int T_D1D = 0, int T_Q1D = 0>
+// PA Mass Apply 3D kernel, see PAMassApply2D for the role of TD
+template<typename TD, int T_D1D = 0, int T_Q1D = 0>
 static void PAMassApply3D(const int NE,
                           const Array<double> &b_,
                           const Array<double> &bt_,
-                          const Vector &d_,
+                          const TD *d_,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
@@ -804,7 +973,7 @@ static void PAMassApply3D(const int NE,
    MFEM_VERIFY(Q1D <= MAX_Q1D, "");
    auto B = Reshape(b_.Read(), Q1D, D1D);
    auto Bt = Reshape(bt_.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D, Q1D, Q1D, NE);
+   auto D = Reshape(d_, Q1D, Q1D, Q1D, NE);
    auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
    auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
    MFEM_FORALL(e, NE,
@@ -929,6 +1098,22 @@ static void PAMassApply3D(const int NE,
    });
 }
 
+// PA Mass Apply 3D kernel with the double precision quadrature data in a
+// Vector, the form expected by the kernel dispatch table and the JIT.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAMassApply3D(const int NE,
+                          const Array<double> &b_,
+                          const Array<double> &bt_,
+                          const Vector &d_,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int q1d = 0)
+{
+   PAMassApply3D<double,T_D1D,T_Q1D>(NE, b_, bt_, d_.Read(), x_, y_,
+                                     d1d, q1d);
+}
+
 template<int T_D1D = 0, int T_Q1D = 0>
 static void SmemPAMassApply3D(const int NE,
                               const Array<double> &b_,
@@ -1156,6 +1341,87 @@ static void SmemPAMassApply3D(const int NE,
    });
 }
 
+// Specialized apply kernel signature, shared by the 2D and 3D variants.
+typedef void (*MassApplyKernel)(const int NE, const Array<double> &B,
+                                const Array<double> &Bt, const Vector &D,
+                                const Vector &X, Vector &Y,
+                                const int d1d, const int q1d);
+
+// Build the table of specialized apply kernels, instantiating only the
+// polynomial orders selected at build time (see kernel_dispatch.hpp).
+static KernelDispatchTable<MassApplyKernel> GetMassApplyKernels()
+{
+   KernelDispatchTable<MassApplyKernel> t;
+#if MFEM_PA_ORDER_SELECTED(1)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 2, 2, SmemPAMassApply2D<2,2,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 2, 2, 4, SmemPAMassApply2D<2,4,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 2, 3, SmemPAMassApply3D<2,3>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 2, 4, SmemPAMassApply3D<2,4>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(2)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 3, 3, SmemPAMassApply2D<3,3,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 2, 3, 4, SmemPAMassApply2D<3,4,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 2, 3, 6, SmemPAMassApply2D<3,6,16>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 3, 4, SmemPAMassApply3D<3,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 3, 6, SmemPAMassApply3D<3,6>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(3)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 4, 4, SmemPAMassApply2D<4,4,8>);
+   MFEM_REGISTER_PA_KERNEL(t, 2, 4, 8, SmemPAMassApply2D<4,8,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 5, SmemPAMassApply3D<4,5>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 6, SmemPAMassApply3D<4,6>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 4, 8, SmemPAMassApply3D<4,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(4)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 5, 5, SmemPAMassApply2D<5,5,8>);
+   MFEM_REGISTER_PA_KERNEL(t, 2, 5, 8, SmemPAMassApply2D<5,8,2>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 6, SmemPAMassApply3D<5,6>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 5, 8, SmemPAMassApply3D<5,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(5)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 6, 6, SmemPAMassApply2D<6,6,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 6, 7, SmemPAMassApply3D<6,7>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(6)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 7, 7, SmemPAMassApply2D<7,7,4>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 7, 8, SmemPAMassApply3D<7,8>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(7)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 8, 8, SmemPAMassApply2D<8,8,2>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 8, 9, SmemPAMassApply3D<8,9>);
+#endif
+#if MFEM_PA_ORDER_SELECTED(8)
+   MFEM_REGISTER_PA_KERNEL(t, 2, 9, 9, SmemPAMassApply2D<9,9,2>);
+   MFEM_REGISTER_PA_KERNEL(t, 3, 9, 10, SmemPAMassApply3D<9,10>);
+#endif
+   return t;
+}
+
+// Compile the specialized apply kernel for an unregistered (dim, D1D, Q1D)
+// with the JIT engine, by re-instantiating the templates of this file for
+// the exact sizes (see general/jit.hpp). Returns NULL on failure.
+static MassApplyKernel JitMassApplyKernel(const int dim,
+                                          const int D1D,
+                                          const int Q1D)
+{
+   // the kernels launch Q1D x Q1D thread blocks, so they need Q1D >= D1D
+   if (Q1D < D1D) { return NULL; }
+   // NBZ following the pattern of the precompiled 2D instantiations
+   const int NBZ = (D1D <= 3) ? 16 : (D1D <= 5) ? 8 : (D1D <= 7) ? 4 : 2;
+   std::ostringstream src;
+   src << "#include \"" << MFEM_SOURCE_DIR
+       << "/fem/bilininteg_mass_pa.cpp\"\n"
+       "extern \"C\" void mjit_kernel(const int NE,\n"
+       "   const mfem::Array<double> &B, const mfem::Array<double> &Bt,\n"
+       "   const mfem::Vector &D, const mfem::Vector &X, mfem::Vector &Y,\n"
+       "   const int, const int)\n"
+       "{\n   mfem::SmemPAMassApply" << dim << "D<" << D1D << ',' << Q1D;
+   if (dim == 2) { src << ',' << NBZ; }
+   src << ">(NE,B,Bt,D,X,Y);\n}\n";
+   return reinterpret_cast<MassApplyKernel>(
+             Jit::Compile("mjit_kernel", src.str()));
+}
+
 static void PAMassApply(const int dim,
                         const int D1D,
                         const int Q1D,
@@ -1180,63 +1446,159 @@ static void PAMassApply(const int dim,
       MFEM_ABORT("OCCA PA Mass Apply unknown kernel!");
    }
 #endif // MFEM_USE_OCCA
-   const int id = (D1D << 4) | Q1D;
+   static KernelDispatchTable<MassApplyKernel> kernels =
+      GetMassApplyKernels();
+   MassApplyKernel kernel = kernels.Find(dim, D1D, Q1D);
+   if (!kernel && Jit::Enabled() && (dim == 2 || dim == 3))
+   {
+      kernel = JitMassApplyKernel(dim, D1D, Q1D);
+      if (kernel) { kernels.Register(dim, D1D, Q1D, kernel); }
+   }
+   if (kernel) { return kernel(NE,B,Bt,D,X,Y,D1D,Q1D); }
+   // Not registered: use the runtime-sized fallback kernels.
+   if (dim == 2) { return PAMassApply2D(NE,B,Bt,D,X,Y,D1D,Q1D); }
+   if (dim == 3) { return PAMassApply3D(NE,B,Bt,D,X,Y,D1D,Q1D); }
+   MFEM_ABORT("Unknown kernel.");
+}
+
+// Reduced precision variant of PAMassApply: the quadrature data is stored
+// in single precision and converted back to double on load by the generic
+// kernels, so only its memory traffic is reduced; the basis contractions
+// and the accumulation stay in double precision.
+static void PAMassApplyF32(const int dim,
+                           const int D1D,
+                           const int Q1D,
+                           const int NE,
+                           const Array<double> &B,
+                           const Array<double> &Bt,
+                           const Array<float> &D,
+                           const Vector &X,
+                           Vector &Y)
+{
+   const float *d = D.Read();
    if (dim == 2)
    {
-      switch (id)
+      switch ((D1D << 4) | Q1D)
       {
-         case 0x22: return SmemPAMassApply2D<2,2,16>(NE,B,Bt,D,X,Y);
-         case 0x24: return SmemPAMassApply2D<2,4,16>(NE,B,Bt,D,X,Y);
-         case 0x33: return SmemPAMassApply2D<3,3,16>(NE,B,Bt,D,X,Y);
-         case 0x34: return SmemPAMassApply2D<3,4,16>(NE,B,Bt,D,X,Y);
-         case 0x36: return SmemPAMassApply2D<3,6,16>(NE,B,Bt,D,X,Y);
-         case 0x44: return SmemPAMassApply2D<4,4,8>(NE,B,Bt,D,X,Y);
-         case 0x48: return SmemPAMassApply2D<4,8,4>(NE,B,Bt,D,X,Y);
-         case 0x55: return SmemPAMassApply2D<5,5,8>(NE,B,Bt,D,X,Y);
-         case 0x58: return SmemPAMassApply2D<5,8,2>(NE,B,Bt,D,X,Y);
-         case 0x66: return SmemPAMassApply2D<6,6,4>(NE,B,Bt,D,X,Y);
-         case 0x77: return SmemPAMassApply2D<7,7,4>(NE,B,Bt,D,X,Y);
-         case 0x88: return SmemPAMassApply2D<8,8,2>(NE,B,Bt,D,X,Y);
-         case 0x99: return SmemPAMassApply2D<9,9,2>(NE,B,Bt,D,X,Y);
-         default:   return PAMassApply2D(NE,B,Bt,D,X,Y,D1D,Q1D);
+         case 0x22: return PAMassApply2D<float,2,2>(NE,B,Bt,d,X,Y);
+         case 0x33: return PAMassApply2D<float,3,3>(NE,B,Bt,d,X,Y);
+         case 0x44: return PAMassApply2D<float,4,4>(NE,B,Bt,d,X,Y);
+         case 0x55: return PAMassApply2D<float,5,5>(NE,B,Bt,d,X,Y);
+         case 0x66: return PAMassApply2D<float,6,6>(NE,B,Bt,d,X,Y);
       }
+      return PAMassApply2D(NE,B,Bt,d,X,Y,D1D,Q1D);
    }
-   else if (dim == 3)
+   if (dim == 3)
    {
-      switch (id)
+      switch ((D1D << 4) | Q1D)
       {
-         case 0x23: return SmemPAMassApply3D<2,3>(NE,B,Bt,D,X,Y);
-         case 0x24: return SmemPAMassApply3D<2,4>(NE,B,Bt,D,X,Y);
-         case 0x34: return SmemPAMassApply3D<3,4>(NE,B,Bt,D,X,Y);
-         case 0x36: return SmemPAMassApply3D<3,6>(NE,B,Bt,D,X,Y);
-         case 0x45: return SmemPAMassApply3D<4,5>(NE,B,Bt,D,X,Y);
-         case 0x46: return SmemPAMassApply3D<4,6>(NE,B,Bt,D,X,Y);
-         case 0x48: return SmemPAMassApply3D<4,8>(NE,B,Bt,D,X,Y);
-         case 0x56: return SmemPAMassApply3D<5,6>(NE,B,Bt,D,X,Y);
-         case 0x58: return SmemPAMassApply3D<5,8>(NE,B,Bt,D,X,Y);
-         case 0x67: return SmemPAMassApply3D<6,7>(NE,B,Bt,D,X,Y);
-         case 0x78: return SmemPAMassApply3D<7,8>(NE,B,Bt,D,X,Y);
-         case 0x89: return SmemPAMassApply3D<8,9>(NE,B,Bt,D,X,Y);
-         case 0x9A: return SmemPAMassApply3D<9,10>(NE,B,Bt,D,X,Y);
-         default:   return PAMassApply3D(NE,B,Bt,D,X,Y,D1D,Q1D);
+         case 0x23: return PAMassApply3D<float,2,3>(NE,B,Bt,d,X,Y);
+         case 0x34: return PAMassApply3D<float,3,4>(NE,B,Bt,d,X,Y);
+         case 0x45: return PAMassApply3D<float,4,5>(NE,B,Bt,d,X,Y);
+         case 0x56: return PAMassApply3D<float,5,6>(NE,B,Bt,d,X,Y);
+         case 0x67: return PAMassApply3D<float,6,7>(NE,B,Bt,d,X,Y);
       }
+      return PAMassApply3D(NE,B,Bt,d,X,Y,D1D,Q1D);
    }
-   mfem::out << "Unknown kernel 0x" << std::hex << id << std::endl;
    MFEM_ABORT("Unknown kernel.");
 }
 
+// PA Mass Apply kernel for non-tensor elements (e.g. the wedge batches of a
+// mixed mesh), batched over elements using the dense basis matrix evaluated
+// at the quadrature points.
+static void PAMassApplyDense(const int ND,
+                             const int NQ,
+                             const int NE,
+                             const Array<double> &b,
+                             const Vector &_op,
+                             const Vector &_x,
+                             Vector &_y)
+{
+   constexpr int max_NQ = MAX_Q1D*MAX_Q1D*MAX_Q1D;
+   MFEM_VERIFY(NQ <= max_NQ, "");
+   auto B = Reshape(b.Read(), NQ, ND);
+   auto op = Reshape(_op.Read(), NQ, NE);
+   auto x = Reshape(_x.Read(), ND, NE);
+   auto y = Reshape(_y.ReadWrite(), ND, NE);
+   MFEM_FORALL_2D(e, NE, NQ, 1, 1,
+   {
+      MFEM_SHARED double DBu[max_NQ];
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         double Bu = 0.0;
+         for (int d = 0; d < ND; ++d)
+         {
+            Bu += B(q,d) * x(d,e);
+         }
+         DBu[q] = op(q,e) * Bu;
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(d,x,ND)
+      {
+         double res = 0.0;
+         for (int q = 0; q < NQ; ++q)
+         {
+            res += B(q,d) * DBu[q];
+         }
+         y(d,e) += res;
+      }
+   });
+}
+
+void MassIntegrator::AddMultPAMixed(const Vector &x, Vector &y) const
+{
+   // x and y are L-vectors here: without a uniform element restriction, the
+   // PA extension applies the integrators on L-vectors, see
+   // PABilinearFormExtension::Mult(). Process the geometry batches one at a
+   // time, accumulating into y in the same E-vector pass.
+   for (int b = 0; b < batch_restr.Size(); ++b)
+   {
+      const GeometryElementRestriction &restr = *batch_restr[b];
+      const DofToQuad &m = *batch_maps[b];
+      if (restr.GetNE() == 0) { continue; }
+      batch_x.SetSize(restr.Height(), Device::GetDeviceMemoryType());
+      batch_y.SetSize(restr.Height(), Device::GetDeviceMemoryType());
+      batch_y.UseDevice(true);
+      restr.Mult(x, batch_x);
+      batch_y = 0.0;
+      Vector op;
+      op.MakeRef(const_cast<Vector&>(pa_data), batch_offsets[b],
+                 batch_offsets[b+1] - batch_offsets[b]);
+      if (m.mode == DofToQuad::TENSOR)
+      {
+         PAMassApply(dim, m.ndof, m.nqpt, restr.GetNE(), m.B, m.Bt, op,
+                     batch_x, batch_y);
+      }
+      else
+      {
+         PAMassApplyDense(m.ndof, m.nqpt, restr.GetNE(), m.B, op,
+                          batch_x, batch_y);
+      }
+      restr.MultTranspose(batch_y, y);
+   }
+}
+
 void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
 #ifdef MFEM_USE_CEED
    if (DeviceCanUseCeed())
    {
       CeedAddMultPA(ceedDataPtr, x, y);
+      return;
    }
-   else
 #endif
+   if (batch_restr.Size() > 0)
+   {
+      AddMultPAMixed(x, y);
+      return;
+   }
+   if (pa_reduced)
    {
-      PAMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x, y);
+      PAMassApplyF32(dim, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                     pa_data_f32, x, y);
+      return;
    }
+   PAMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x, y);
 }
 
 } // namespace mfem
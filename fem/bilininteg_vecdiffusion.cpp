@@ -12,6 +12,7 @@
 #include "../general/forall.hpp"
 #include "bilininteg.hpp"
 #include "gridfunc.hpp"
+#include "libceed/vecdiffusion.hpp"
 
 using namespace std;
 
@@ -129,6 +130,18 @@ void VectorDiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    const FiniteElement &el = *fes.GetFE(0);
    const IntegrationRule *ir
       = IntRule ? IntRule : &DiffusionIntegrator::GetRule(el, el);
+#ifdef MFEM_USE_CEED
+   // The embedded surface case (dim < space dim) falls back to the native
+   // kernels.
+   if (DeviceCanUseCeed() && mesh->Dimension() == mesh->SpaceDimension())
+   {
+      if (ceedDataPtr) { delete ceedDataPtr; }
+      CeedData* ptr = new CeedData();
+      ceedDataPtr = ptr;
+      InitCeedCoeff(Q, ptr);
+      return CeedPAVectorDiffusionAssemble(fes, *ir, *ptr);
+   }
+#endif
    const int dims = el.GetDim();
    const int symmDims = (dims * (dims + 1)) / 2; // 1x1: 1, 2x2: 3, 3x3: 6
    const int nq = ir->GetNPoints();
@@ -503,9 +516,116 @@ void PAVectorDiffusionApply3D(const int NE,
    });
 }
 
+#ifdef MFEM_USE_OCCA
+// OCCA PA Vector Diffusion Apply 2D kernel
+static void OccaPAVectorDiffusionApply2D(const int D1D,
+                                         const int Q1D,
+                                         const int NE,
+                                         const Array<double> &B,
+                                         const Array<double> &G,
+                                         const Array<double> &Bt,
+                                         const Array<double> &Gt,
+                                         const Vector &D,
+                                         const Vector &X,
+                                         Vector &Y)
+{
+   occa::properties props;
+   props["defines/D1D"] = D1D;
+   props["defines/Q1D"] = Q1D;
+   const occa::memory o_B = OccaMemoryRead(B.GetMemory(), B.Size());
+   const occa::memory o_G = OccaMemoryRead(G.GetMemory(), G.Size());
+   const occa::memory o_Bt = OccaMemoryRead(Bt.GetMemory(), Bt.Size());
+   const occa::memory o_Gt = OccaMemoryRead(Gt.GetMemory(), Gt.Size());
+   const occa::memory o_D = OccaMemoryRead(D.GetMemory(), D.Size());
+   const occa::memory o_X = OccaMemoryRead(X.GetMemory(), X.Size());
+   occa::memory o_Y = OccaMemoryReadWrite(Y.GetMemory(), Y.Size());
+   const occa_id_t id = std::make_pair(D1D,Q1D);
+   if (!Device::Allows(Backend::OCCA_CUDA))
+   {
+      static occa_kernel_t OccaVecDiffApply2D_cpu;
+      if (OccaVecDiffApply2D_cpu.find(id) == OccaVecDiffApply2D_cpu.end())
+      {
+         const occa::kernel VectorDiffusionApply2D_CPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "VectorDiffusionApply2D_CPU", props);
+         OccaVecDiffApply2D_cpu.emplace(id, VectorDiffusionApply2D_CPU);
+      }
+      OccaVecDiffApply2D_cpu.at(id)(NE, o_B, o_G, o_Bt, o_Gt, o_D, o_X, o_Y);
+   }
+   else
+   {
+      static occa_kernel_t OccaVecDiffApply2D_gpu;
+      if (OccaVecDiffApply2D_gpu.find(id) == OccaVecDiffApply2D_gpu.end())
+      {
+         const occa::kernel VectorDiffusionApply2D_GPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "VectorDiffusionApply2D_GPU", props);
+         OccaVecDiffApply2D_gpu.emplace(id, VectorDiffusionApply2D_GPU);
+      }
+      OccaVecDiffApply2D_gpu.at(id)(NE, o_B, o_G, o_Bt, o_Gt, o_D, o_X, o_Y);
+   }
+}
+
+// OCCA PA Vector Diffusion Apply 3D kernel
+static void OccaPAVectorDiffusionApply3D(const int D1D,
+                                         const int Q1D,
+                                         const int NE,
+                                         const Array<double> &B,
+                                         const Array<double> &G,
+                                         const Array<double> &Bt,
+                                         const Array<double> &Gt,
+                                         const Vector &D,
+                                         const Vector &X,
+                                         Vector &Y)
+{
+   occa::properties props;
+   props["defines/D1D"] = D1D;
+   props["defines/Q1D"] = Q1D;
+   const occa::memory o_B = OccaMemoryRead(B.GetMemory(), B.Size());
+   const occa::memory o_G = OccaMemoryRead(G.GetMemory(), G.Size());
+   const occa::memory o_Bt = OccaMemoryRead(Bt.GetMemory(), Bt.Size());
+   const occa::memory o_Gt = OccaMemoryRead(Gt.GetMemory(), Gt.Size());
+   const occa::memory o_D = OccaMemoryRead(D.GetMemory(), D.Size());
+   const occa::memory o_X = OccaMemoryRead(X.GetMemory(), X.Size());
+   occa::memory o_Y = OccaMemoryReadWrite(Y.GetMemory(), Y.Size());
+   const occa_id_t id = std::make_pair(D1D,Q1D);
+   if (!Device::Allows(Backend::OCCA_CUDA))
+   {
+      static occa_kernel_t OccaVecDiffApply3D_cpu;
+      if (OccaVecDiffApply3D_cpu.find(id) == OccaVecDiffApply3D_cpu.end())
+      {
+         const occa::kernel VectorDiffusionApply3D_CPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "VectorDiffusionApply3D_CPU", props);
+         OccaVecDiffApply3D_cpu.emplace(id, VectorDiffusionApply3D_CPU);
+      }
+      OccaVecDiffApply3D_cpu.at(id)(NE, o_B, o_G, o_Bt, o_Gt, o_D, o_X, o_Y);
+   }
+   else
+   {
+      static occa_kernel_t OccaVecDiffApply3D_gpu;
+      if (OccaVecDiffApply3D_gpu.find(id) == OccaVecDiffApply3D_gpu.end())
+      {
+         const occa::kernel VectorDiffusionApply3D_GPU =
+            mfem::OccaDev().buildKernel("occa://mfem/fem/occa.okl",
+                                        "VectorDiffusionApply3D_GPU", props);
+         OccaVecDiffApply3D_gpu.emplace(id, VectorDiffusionApply3D_GPU);
+      }
+      OccaVecDiffApply3D_gpu.at(id)(NE, o_B, o_G, o_Bt, o_Gt, o_D, o_X, o_Y);
+   }
+}
+#endif // MFEM_USE_OCCA
+
 // PA Diffusion Apply kernel
 void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+#ifdef MFEM_USE_CEED
+   if (ceedDataPtr)
+   {
+      CeedAddMultPA(ceedDataPtr, x, y);
+      return;
+   }
+#endif
    const int D1D = dofs1D;
    const int Q1D = quad1D;
    const Array<double> &B = maps->B;
@@ -514,6 +634,21 @@ void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    const Array<double> &Gt = maps->Gt;
    const Vector &D = pa_data;
 
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca() && dim == sdim)
+   {
+      if (dim == 2)
+      {
+         return OccaPAVectorDiffusionApply2D(D1D,Q1D,ne,B,G,Bt,Gt,D,x,y);
+      }
+      if (dim == 3)
+      {
+         return OccaPAVectorDiffusionApply3D(D1D,Q1D,ne,B,G,Bt,Gt,D,x,y);
+      }
+      MFEM_ABORT("OCCA PA Vector Diffusion Apply unknown kernel!");
+   }
+#endif // MFEM_USE_OCCA
+
    if (dim == 2 && sdim == 3)
    {
       switch ((dofs1D << 4 ) | quad1D)
@@ -726,6 +861,13 @@ static void PAVectorDiffusionAssembleDiagonal(const int dim,
 
 void VectorDiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
 {
+#ifdef MFEM_USE_CEED
+   if (ceedDataPtr)
+   {
+      CeedAssembleDiagonalPA(ceedDataPtr, diag);
+      return;
+   }
+#endif
    PAVectorDiffusionAssembleDiagonal(dim,
                                      dofs1D,
                                      quad1D,
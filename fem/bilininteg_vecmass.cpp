@@ -12,6 +12,7 @@
 #include "../general/forall.hpp"
 #include "bilininteg.hpp"
 #include "gridfunc.hpp"
+#include "libceed/vecmass.hpp"
 
 using namespace std;
 
@@ -30,6 +31,18 @@ void VectorMassIntegrator::AssemblePA(const FiniteElementSpace &fes)
    ElementTransformation *T = mesh->GetElementTransformation(0);
    const IntegrationRule *ir
       = IntRule ? IntRule : &MassIntegrator::GetRule(el, el, *T);
+#ifdef MFEM_USE_CEED
+   // Only the scalar coefficient case is supported with libCEED; the vector
+   // and matrix coefficient cases fall back to the native kernels.
+   if (DeviceCanUseCeed() && !VQ && !MQ)
+   {
+      if (ceedDataPtr) { delete ceedDataPtr; }
+      CeedData* ptr = new CeedData();
+      ceedDataPtr = ptr;
+      InitCeedCoeff(Q, ptr);
+      return CeedPAVectorMassAssemble(fes, *ir, *ptr);
+   }
+#endif
    dim = mesh->Dimension();
    ne = fes.GetMesh()->GetNE();
    nq = ir->GetNPoints();
@@ -361,6 +374,13 @@ static void PAVectorMassApply(const int dim,
 
 void VectorMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
+#ifdef MFEM_USE_CEED
+   if (ceedDataPtr)
+   {
+      CeedAddMultPA(ceedDataPtr, x, y);
+      return;
+   }
+#endif
    PAVectorMassApply(dim, dofs1D, quad1D, ne, maps->B, maps->Bt, pa_data, x, y);
 }
 
@@ -514,6 +534,13 @@ static void PAVectorMassAssembleDiagonal(const int dim,
 
 void VectorMassIntegrator::AssembleDiagonalPA(Vector &diag)
 {
+#ifdef MFEM_USE_CEED
+   if (ceedDataPtr)
+   {
+      CeedAssembleDiagonalPA(ceedDataPtr, diag);
+      return;
+   }
+#endif
    PAVectorMassAssembleDiagonal(dim,
                                 dofs1D,
                                 quad1D,
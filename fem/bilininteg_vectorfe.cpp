@@ -18,6 +18,7 @@ namespace mfem
 void PADiffusionSetup3D(const int Q1D,
                         const int coeffDim,
                         const int NE,
+                        const bool affine,
                         const Array<double> &w,
                         const Vector &j,
                         const Vector &_coeff,
@@ -855,13 +856,13 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
 
    if (trial_curl && test_curl && dim == 3)
    {
-      PADiffusionSetup3D(quad1D, coeffDim, ne, ir->GetWeights(), geom->J,
-                         coeff, pa_data);
+      PADiffusionSetup3D(quad1D, coeffDim, ne, false, ir->GetWeights(),
+                         geom->J, coeff, pa_data);
    }
    else if (trial_curl && test_curl && dim == 2)
    {
-      PADiffusionSetup2D<2>(quad1D, coeffDim, ne, ir->GetWeights(), geom->J,
-                            coeff, pa_data);
+      PADiffusionSetup2D<2>(quad1D, coeffDim, ne, false, ir->GetWeights(),
+                            geom->J, coeff, pa_data);
    }
    else if (trial_div && test_div && dim == 3)
    {
@@ -1108,12 +1109,12 @@ void MixedVectorGradientIntegrator::AssemblePA(const FiniteElementSpace
    // Use the same setup functions as VectorFEMassIntegrator.
    if (test_el->GetDerivType() == mfem::FiniteElement::CURL && dim == 3)
    {
-      PADiffusionSetup3D(quad1D, 1, ne, ir->GetWeights(), geom->J,
+      PADiffusionSetup3D(quad1D, 1, ne, false, ir->GetWeights(), geom->J,
                          coeff, pa_data);
    }
    else if (test_el->GetDerivType() == mfem::FiniteElement::CURL && dim == 2)
    {
-      PADiffusionSetup2D<2>(quad1D, 1, ne, ir->GetWeights(), geom->J,
+      PADiffusionSetup2D<2>(quad1D, 1, ne, false, ir->GetWeights(), geom->J,
                             coeff, pa_data);
    }
    else
@@ -21,6 +21,43 @@ namespace mfem
 
 using namespace std;
 
+void Coefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                       const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   vals.SetSize(NE*NQ);
+   double *v = vals.HostWrite();
+   for (int e = 0; e < NE; e++)
+   {
+      ElementTransformation &T = *fes.GetElementTransformation(e);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(q);
+         T.SetIntPoint(&ip);
+         v[e*NQ + q] = Eval(T, ip);
+      }
+   }
+}
+
+void ConstantCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                               const IntegrationRule &ir)
+{
+   vals.SetSize(fes.GetNE()*ir.GetNPoints());
+   vals = constant;
+}
+
+// Fill 'attr' with the attribute of each element of 'mesh'.
+static void GetElementAttributes(const Mesh &mesh, Array<int> &attr)
+{
+   const int NE = mesh.GetNE();
+   attr.SetSize(NE);
+   for (int e = 0; e < NE; e++)
+   {
+      attr[e] = mesh.GetAttribute(e);
+   }
+}
+
 double PWConstCoefficient::Eval(ElementTransformation & T,
                                 const IntegrationPoint & ip)
 {
@@ -28,6 +65,24 @@ double PWConstCoefficient::Eval(ElementTransformation & T,
    return (constants(att-1));
 }
 
+void PWConstCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                              const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   vals.SetSize(NE*NQ);
+   Array<int> attr;
+   GetElementAttributes(*fes.GetMesh(), attr);
+   const auto d_attr = attr.Read();
+   const auto d_const = constants.Read();
+   auto d_v = Reshape(vals.Write(), NQ, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const double c = d_const[d_attr[e]-1]; // one gather per element
+      for (int q = 0; q < NQ; q++) { d_v(q,e) = c; }
+   });
+}
+
 double FunctionCoefficient::Eval(ElementTransformation & T,
                                  const IntegrationPoint & ip)
 {
@@ -46,12 +101,124 @@ double FunctionCoefficient::Eval(ElementTransformation & T,
    }
 }
 
+void FunctionCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                               const IntegrationRule &ir)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int dim = mesh->Dimension();
+   const int NE = fes.GetNE();
+   if (NE == 0 || dim < 2 || mesh->GetNumGeometries(dim) != 1)
+   {
+      // the batched physical coordinates are not available, evaluate one
+      // element at a time
+      Coefficient::Eval(vals, fes, ir);
+      return;
+   }
+   const int NQ = ir.GetNPoints();
+   const int sdim = mesh->SpaceDimension();
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(ir, GeometricFactors::COORDINATES);
+   vals.SetSize(NE*NQ);
+   double *v = vals.HostWrite();
+   const double *X = geom->X.HostRead(); // (NQ x sdim x NE)
+   Vector transip(sdim);
+   for (int e = 0; e < NE; e++)
+   {
+      for (int q = 0; q < NQ; q++)
+      {
+         for (int d = 0; d < sdim; d++)
+         {
+            transip(d) = X[(e*sdim + d)*NQ + q];
+         }
+         v[e*NQ + q] = Function ? Function(transip)
+                       : TDFunction(transip, GetTime());
+      }
+   }
+}
+
 double GridFunctionCoefficient::Eval (ElementTransformation &T,
                                       const IntegrationPoint &ip)
 {
    return GridF -> GetValue (T, ip, Component);
 }
 
+/** @brief Evaluate the component @a comp of @a gf at the points of @a ir in
+    all elements of its mesh with one QuadratureInterpolator sweep, storing
+    the result in @a vals ordered by point first and element second. */
+/** Returns false when the batched kernels do not apply (different meshes,
+    1D, mixed, NURBS, or embedded surface meshes, vector finite elements, or
+    elements beyond the QuadratureInterpolator size limits) and the caller
+    should use the per-point loop instead. */
+static bool BatchedGridFunctionEval(const GridFunction &gf, int comp,
+                                    const FiniteElementSpace &fes,
+                                    const IntegrationRule &ir, Vector &vals)
+{
+   const FiniteElementSpace *gf_fes = gf.FESpace();
+   Mesh *mesh = gf_fes->GetMesh();
+   if (mesh != fes.GetMesh()) { return false; }
+   const int NE = gf_fes->GetNE();
+   if (NE == 0) { vals.SetSize(0); return true; }
+   const int dim = mesh->Dimension();
+   if (dim < 2 || dim != mesh->SpaceDimension() ||
+       mesh->GetNumGeometries(dim) != 1 || gf_fes->GetNURBSext())
+   {
+      return false;
+   }
+   const FiniteElement *fe = gf_fes->GetFE(0);
+   const int vdim = gf_fes->GetVDim();
+   if (fe->GetRangeType() != FiniteElement::SCALAR ||
+       comp < 1 || comp > vdim)
+   {
+      return false;
+   }
+   const int ND = fe->GetDof();
+   const int NQ = ir.GetNPoints();
+   typedef QuadratureInterpolator QI;
+   if (dim == 2 && (ND > QI::MAX_ND2D || NQ > QI::MAX_NQ2D ||
+                    vdim > QI::MAX_VDIM2D)) { return false; }
+   if (dim == 3 && (ND > QI::MAX_ND3D || NQ > QI::MAX_NQ3D ||
+                    vdim > QI::MAX_VDIM3D)) { return false; }
+   const Operator *elem_restr =
+      gf_fes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (elem_restr == NULL) { return false; }
+
+   Vector e_vec(ND*vdim*NE);
+   e_vec.UseDevice(true);
+   elem_restr->Mult(gf, e_vec);
+
+   const QuadratureInterpolator *qi = gf_fes->GetQuadratureInterpolator(ir);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   vals.SetSize(NQ*NE);
+
+   if (vdim == 1)
+   {
+      qi->Values(e_vec, vals);
+      return true;
+   }
+
+   Vector q_val(NQ*vdim*NE);
+   q_val.UseDevice(true);
+   qi->Values(e_vec, q_val);
+   const int nq = NQ, c = comp - 1;
+   const auto u = Reshape(q_val.Read(), NQ, vdim, NE);
+   auto v = Reshape(vals.Write(), NQ, NE);
+   MFEM_FORALL(i, NE*NQ,
+   {
+      v(i%nq, i/nq) = u(i%nq, c, i/nq);
+   });
+   return true;
+}
+
+void GridFunctionCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                                   const IntegrationRule &ir)
+{
+   if (GridF && BatchedGridFunctionEval(*GridF, Component, fes, ir, vals))
+   {
+      return;
+   }
+   Coefficient::Eval(vals, fes, ir);
+}
+
 double TransformedCoefficient::Eval(ElementTransformation &T,
                                     const IntegrationPoint &ip)
 {
@@ -101,6 +268,76 @@ void VectorCoefficient::Eval(DenseMatrix &M, ElementTransformation &T,
    }
 }
 
+void VectorCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                             const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   vals.SetSize(NE*NQ*vdim);
+   double *v = vals.HostWrite();
+   DenseMatrix M;
+   for (int e = 0; e < NE; e++)
+   {
+      ElementTransformation &T = *fes.GetElementTransformation(e);
+      Eval(M, T, ir);
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int q = 0; q < NQ; q++)
+         {
+            v[(e*vdim + c)*NQ + q] = M(c,q);
+         }
+      }
+   }
+}
+
+void VectorConstantCoefficient::Eval(Vector &vals,
+                                     const FiniteElementSpace &fes,
+                                     const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   vals.SetSize(NE*NQ*vdim);
+   double *v = vals.HostWrite();
+   for (int e = 0; e < NE; e++)
+   {
+      for (int c = 0; c < vdim; c++)
+      {
+         const double vc = vec(c);
+         for (int q = 0; q < NQ; q++) { v[(e*vdim + c)*NQ + q] = vc; }
+      }
+   }
+}
+
+void PWVectorCoefficient::Eval(Vector &V, ElementTransformation &T,
+                               const IntegrationPoint &ip)
+{
+   V.SetSize(vdim);
+   constants.GetColumn(T.Attribute - 1, V);
+}
+
+void PWVectorCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                               const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   const int VD = vdim;
+   vals.SetSize(NE*NQ*VD);
+   Array<int> attr;
+   GetElementAttributes(*fes.GetMesh(), attr);
+   const auto d_attr = attr.Read();
+   const auto d_tbl = constants.Read();
+   auto d_v = Reshape(vals.Write(), NQ, VD, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int att = d_attr[e];
+      for (int c = 0; c < VD; c++)
+      {
+         const double vc = d_tbl[(att-1)*VD + c];
+         for (int q = 0; q < NQ; q++) { d_v(q,c,e) = vc; }
+      }
+   });
+}
+
 void VectorFunctionCoefficient::Eval(Vector &V, ElementTransformation &T,
                                      const IntegrationPoint &ip)
 {
@@ -124,6 +361,47 @@ void VectorFunctionCoefficient::Eval(Vector &V, ElementTransformation &T,
    }
 }
 
+void VectorFunctionCoefficient::Eval(Vector &vals,
+                                     const FiniteElementSpace &fes,
+                                     const IntegrationRule &ir)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int dim = mesh->Dimension();
+   const int NE = fes.GetNE();
+   if (Q || NE == 0 || dim < 2 || mesh->GetNumGeometries(dim) != 1)
+   {
+      // scaling by Q requires the element transformations; otherwise the
+      // batched physical coordinates are not available, evaluate one element
+      // at a time
+      VectorCoefficient::Eval(vals, fes, ir);
+      return;
+   }
+   const int NQ = ir.GetNPoints();
+   const int sdim = mesh->SpaceDimension();
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(ir, GeometricFactors::COORDINATES);
+   vals.SetSize(NE*NQ*vdim);
+   double *v = vals.HostWrite();
+   const double *X = geom->X.HostRead(); // (NQ x sdim x NE)
+   Vector transip(sdim), V(vdim);
+   for (int e = 0; e < NE; e++)
+   {
+      for (int q = 0; q < NQ; q++)
+      {
+         for (int d = 0; d < sdim; d++)
+         {
+            transip(d) = X[(e*sdim + d)*NQ + q];
+         }
+         if (Function) { Function(transip, V); }
+         else { TDFunction(transip, GetTime(), V); }
+         for (int c = 0; c < vdim; c++)
+         {
+            v[(e*vdim + c)*NQ + q] = V(c);
+         }
+      }
+   }
+}
+
 VectorArrayCoefficient::VectorArrayCoefficient (int dim)
    : VectorCoefficient(dim), Coeff(dim), ownCoeff(dim)
 {
@@ -291,6 +569,63 @@ void VectorRestrictedCoefficient::Eval(
    }
 }
 
+void MatrixCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                             const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   const int HW = height*width;
+   vals.SetSize(NE*NQ*HW);
+   double *v = vals.HostWrite();
+   DenseMatrix K(height, width);
+   for (int e = 0; e < NE; e++)
+   {
+      ElementTransformation &T = *fes.GetElementTransformation(e);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = ir.IntPoint(q);
+         T.SetIntPoint(&ip);
+         Eval(K, T, ip);
+         for (int k = 0; k < HW; k++)
+         {
+            v[(e*HW + k)*NQ + q] = K.GetData()[k];
+         }
+      }
+   }
+}
+
+void PWMatrixCoefficient::Eval(DenseMatrix &K, ElementTransformation &T,
+                               const IntegrationPoint &ip)
+{
+   K.SetSize(height, width);
+   Vector col;
+   constants.GetColumnReference(T.Attribute - 1, col);
+   K = col.GetData();
+}
+
+void PWMatrixCoefficient::Eval(Vector &vals, const FiniteElementSpace &fes,
+                               const IntegrationRule &ir)
+{
+   const int NE = fes.GetNE();
+   const int NQ = ir.GetNPoints();
+   const int HW = height*width;
+   vals.SetSize(NE*NQ*HW);
+   Array<int> attr;
+   GetElementAttributes(*fes.GetMesh(), attr);
+   const auto d_attr = attr.Read();
+   const auto d_tbl = constants.Read();
+   auto d_v = Reshape(vals.Write(), NQ, HW, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int att = d_attr[e];
+      for (int k = 0; k < HW; k++)
+      {
+         const double vk = d_tbl[(att-1)*HW + k];
+         for (int q = 0; q < NQ; q++) { d_v(q,k,e) = vk; }
+      }
+   });
+}
+
 void MatrixFunctionCoefficient::Eval(DenseMatrix &K, ElementTransformation &T,
                                      const IntegrationPoint &ip)
 {
@@ -955,4 +1290,36 @@ double QuadratureFunctionCoefficient::Eval(ElementTransformation &T,
    return temp[0];
 }
 
+const Vector &BatchedCoefficient::QuadraturePositions(
+   Mesh &mesh, const IntegrationRule &ir, int &sdim, int &ne)
+{
+   const GeometricFactors *geom =
+      mesh.GetGeometricFactors(ir, GeometricFactors::COORDINATES);
+   sdim = mesh.SpaceDimension();
+   ne = mesh.GetNE();
+   return geom->X;
+}
+
+const Vector &BatchedVectorCoefficient::QuadraturePositions(
+   Mesh &mesh, const IntegrationRule &ir, int &sdim, int &ne)
+{
+   const GeometricFactors *geom =
+      mesh.GetGeometricFactors(ir, GeometricFactors::COORDINATES);
+   sdim = mesh.SpaceDimension();
+   ne = mesh.GetNE();
+   return geom->X;
+}
+
+void BatchedCoefficient::Eval(QuadratureFunction &qf)
+{
+   const QuadratureSpace &qspace = *qf.GetSpace();
+   MFEM_VERIFY(qf.GetVDim() == 1, "QuadratureFunction's vdim must be 1");
+   Mesh &mesh = *qspace.GetMesh();
+   MFEM_VERIFY(mesh.GetNE() == 0 ||
+               mesh.GetNumGeometries(mesh.Dimension()) <= 1,
+               "mixed meshes are not supported");
+   if (mesh.GetNE() == 0) { return; }
+   Eval(mesh, qspace.GetElementIntRule(0), qf);
+}
+
 }
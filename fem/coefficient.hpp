@@ -15,6 +15,7 @@
 #include <functional>
 
 #include "../config/config.hpp"
+#include "../general/forall.hpp"
 #include "../linalg/linalg.hpp"
 #include "intrules.hpp"
 #include "eltrans.hpp"
@@ -23,6 +24,7 @@ namespace mfem
 {
 
 class Mesh;
+class FiniteElementSpace;
 
 #ifdef MFEM_USE_MPI
 class ParMesh;
@@ -70,6 +72,16 @@ public:
       return Eval(T, ip);
    }
 
+   /** @brief Evaluate the coefficient at the points of the integration rule
+       @a ir in all mesh elements of @a fes, storing the result in @a vals. */
+   /** On return, @a vals has size ir.GetNPoints() x fes.GetNE() with the
+       values ordered by quadrature point first and element second. The base
+       class implementation loops over the elements and calls the per-point
+       Eval() method; subclasses can overload it to evaluate whole batches at
+       once. All mesh elements must use the same integration rule @a ir. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+
    virtual ~Coefficient() { }
 };
 
@@ -87,6 +99,10 @@ public:
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip)
    { return (constant); }
+
+   /// Fill @a vals with the constant at all quadrature points of @a fes.
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
 };
 
 /** @brief A piecewise constant coefficient with the constants keyed
@@ -123,6 +139,12 @@ public:
    /// Evaluate the coefficient.
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /** @brief Fill @a vals using #constants as a device lookup table: the
+       attribute of each element indexes the table once and the value is
+       broadcast to all quadrature points of the element. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
 };
 
 /// A general function coefficient
@@ -166,6 +188,11 @@ public:
    /// Evaluate the coefficient at @a ip.
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /** @brief Evaluate the function at all quadrature points of @a fes using
+       the batched physical coordinates from the mesh GeometricFactors. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
 };
 
 class GridFunction;
@@ -193,6 +220,15 @@ public:
    /// Evaluate the coefficient at @a ip.
    virtual double Eval(ElementTransformation &T,
                        const IntegrationPoint &ip);
+
+   /** @brief Evaluate the grid function at the points of @a ir in all
+       elements of @a fes. When @a fes shares the mesh of the grid function's
+       own space, the values are computed in one QuadratureInterpolator sweep
+       (using the interpolator and element restriction cached per rule by that
+       space) instead of locating and evaluating shapes point by point; the
+       base class loop is used otherwise. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
 };
 
 
@@ -381,6 +417,18 @@ public:
    virtual void Eval(DenseMatrix &M, ElementTransformation &T,
                      const IntegrationRule &ir);
 
+   /** @brief Evaluate the vector coefficient at the points of the integration
+       rule @a ir in all mesh elements of @a fes, storing the result in
+       @a vals. */
+   /** On return, @a vals has size ir.GetNPoints() x GetVDim() x fes.GetNE()
+       with the values ordered by quadrature point first, vector component
+       second, and element last. The base class implementation evaluates one
+       element at a time with the DenseMatrix Eval() method; subclasses can
+       overload it to evaluate whole batches at once. All mesh elements must
+       use the same integration rule @a ir. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+
    virtual ~VectorCoefficient() { }
 };
 
@@ -400,10 +448,42 @@ public:
    virtual void Eval(Vector &V, ElementTransformation &T,
                      const IntegrationPoint &ip) { V = vec; }
 
+   /// Fill @a vals with the constant vector at all quadrature points of
+   /// @a fes.
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+
    /// Return a reference to the constant vector in this class.
    const Vector& GetVec() { return vec; }
 };
 
+/** @brief A piecewise constant vector coefficient with the constant vectors
+    keyed off the element attribute numbers. */
+class PWVectorCoefficient : public VectorCoefficient
+{
+private:
+   DenseMatrix constants; ///< one column vector per attribute
+
+public:
+   /** @brief Construct the coefficient from the matrix @a c of column
+       vectors, so that column @a i-1 is the vector used in regions with
+       attribute @a i. */
+   PWVectorCoefficient(const DenseMatrix &c)
+      : VectorCoefficient(c.Height()), constants(c) { }
+
+   using VectorCoefficient::Eval;
+
+   /// Evaluate the vector coefficient at @a ip.
+   virtual void Eval(Vector &V, ElementTransformation &T,
+                     const IntegrationPoint &ip);
+
+   /** @brief Fill @a vals using #constants as a device lookup table: the
+       attribute of each element indexes the table once and the vector is
+       broadcast to all quadrature points of the element. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+};
+
 /// A general vector function coefficient
 class VectorFunctionCoefficient : public VectorCoefficient
 {
@@ -438,6 +518,11 @@ public:
    virtual void Eval(Vector &V, ElementTransformation &T,
                      const IntegrationPoint &ip);
 
+   /** @brief Evaluate the function at all quadrature points of @a fes using
+       the batched physical coordinates from the mesh GeometricFactors. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+
    virtual ~VectorFunctionCoefficient() { }
 };
 
@@ -740,6 +825,18 @@ public:
                               const IntegrationPoint &ip)
    { mfem_error("MatrixCoefficient::EvalSymmetric"); }
 
+   /** @brief Evaluate the matrix coefficient at the points of the integration
+       rule @a ir in all mesh elements of @a fes, storing the result in
+       @a vals. */
+   /** On return, @a vals has size ir.GetNPoints() x (height x width) x
+       fes.GetNE() with the values ordered by quadrature point first,
+       column-major matrix entry second, and element last. The base class
+       implementation evaluates one point at a time with the DenseMatrix
+       Eval() method; subclasses can overload it to evaluate whole batches at
+       once. All mesh elements must use the same integration rule @a ir. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+
    virtual ~MatrixCoefficient() { }
 };
 
@@ -760,6 +857,39 @@ public:
 };
 
 
+/** @brief A piecewise constant matrix coefficient with the constant matrices
+    keyed off the element attribute numbers. */
+class PWMatrixCoefficient : public MatrixCoefficient
+{
+private:
+   DenseMatrix constants; ///< one column of h*w entries per attribute
+
+public:
+   /** @brief Construct the coefficient from the (h*w) x n matrix @a c:
+       column @a i-1, viewed as an h x w column-major matrix, is the value
+       used in regions with attribute @a i. */
+   PWMatrixCoefficient(int h, int w, const DenseMatrix &c)
+      : MatrixCoefficient(h, w), constants(c)
+   {
+      MFEM_VERIFY(c.Height() == h*w,
+                  "PWMatrixCoefficient: the rows of 'c' must store h*w-sized"
+                  " matrices");
+   }
+
+   using MatrixCoefficient::Eval;
+
+   /// Evaluate the matrix coefficient at @a ip.
+   virtual void Eval(DenseMatrix &K, ElementTransformation &T,
+                     const IntegrationPoint &ip);
+
+   /** @brief Fill @a vals using #constants as a device lookup table: the
+       attribute of each element indexes the table once and the matrix is
+       broadcast to all quadrature points of the element. */
+   virtual void Eval(Vector &vals, const FiniteElementSpace &fes,
+                     const IntegrationRule &ir);
+};
+
+
 /** @brief A matrix coefficient with an optional scalar coefficient multiplier
     \a q.  The matrix function can either be represented by a std function or
     a constant matrix provided when constructing this object.  */
@@ -1601,6 +1731,120 @@ public:
    virtual ~QuadratureFunctionCoefficient() { }
 };
 
+/** @brief Base class for coefficients that can evaluate all quadrature
+    points of all mesh elements in one batched sweep.
+
+    The per-point virtual Coefficient::Eval() interface forces assembly code
+    back to the host whenever a spatially varying coefficient is present.
+    Subclasses of this class additionally provide the batched Eval() methods
+    below, which the partial assembly setup of the integrators consumes
+    directly (see e.g. DiffusionIntegrator), filling all values in a single
+    MFEM_FORALL sweep that can run on the device. */
+class BatchedCoefficient : public Coefficient
+{
+protected:
+   /** @brief Return the physical coordinates of the points of @a ir on all
+       elements of @a mesh, in (nq x sdim x ne) layout.
+
+       The returned Vector is owned by the mesh (see
+       Mesh::GetGeometricFactors) and is device-resident when a device is
+       active; @a sdim and @a ne return the space dimension and the number
+       of elements. */
+   static const Vector &QuadraturePositions(Mesh &mesh,
+                                            const IntegrationRule &ir,
+                                            int &sdim, int &ne);
+
+public:
+   using Coefficient::Eval;
+
+   /** @brief Evaluate the coefficient at the points of @a ir on all
+       elements of @a mesh, writing the (nq x ne) values into @a values. */
+   virtual void Eval(Mesh &mesh, const IntegrationRule &ir,
+                     Vector &values) = 0;
+
+   /// Evaluate the coefficient at all points of @a qf's quadrature space.
+   void Eval(QuadratureFunction &qf);
+};
+
+/** @brief A coefficient defined by a device-capturable function object,
+    evaluated in batches.
+
+    The template parameter @a F must be copyable by value and provide
+
+        MFEM_HOST_DEVICE double operator()(double x, double y, double z) const
+
+    (unused coordinates are zero in lower dimensions), so that the batched
+    evaluation can capture it in a device kernel. The per-point
+    Coefficient::Eval() interface remains available for host-side code paths
+    such as full assembly. */
+template <typename F>
+class DeviceFunctionCoefficient : public BatchedCoefficient
+{
+private:
+   F fun;
+
+public:
+   explicit DeviceFunctionCoefficient(F fun_) : fun(fun_) { }
+
+   using BatchedCoefficient::Eval;
+
+   virtual double Eval(ElementTransformation &T, const IntegrationPoint &ip)
+   {
+      double x[3] = { 0.0, 0.0, 0.0 };
+      Vector transip(x, 3);
+      T.Transform(ip, transip);
+      return fun(x[0], x[1], x[2]);
+   }
+
+   virtual void Eval(Mesh &mesh, const IntegrationRule &ir, Vector &values)
+   {
+      int sdim, ne;
+      const Vector &pos = QuadraturePositions(mesh, ir, sdim, ne);
+      const int nq = ir.GetNPoints();
+      const auto X = Reshape(pos.Read(), nq, sdim, ne);
+      values.SetSize(nq*ne);
+      auto C = Reshape(values.Write(), nq, ne);
+      const F f = fun;
+      MFEM_FORALL(i, ne*nq,
+      {
+         const int e = i/nq, q = i%nq;
+         const double x = X(q,0,e);
+         const double y = (sdim > 1) ? X(q,1,e) : 0.0;
+         const double z = (sdim > 2) ? X(q,2,e) : 0.0;
+         C(q,e) = f(x,y,z);
+      });
+   }
+};
+
+/** @brief A vector coefficient that can evaluate all points of an
+    IntegrationRule on all mesh elements in one batch, the VectorCoefficient
+    counterpart of BatchedCoefficient.
+
+    Device-side consumers, such as the nodal projection engine used by
+    GridFunction::ProjectCoefficient(VectorCoefficient &), detect this class
+    with a dynamic_cast and call the batched Eval() instead of looping
+    elements and points on the host. */
+class BatchedVectorCoefficient : public VectorCoefficient
+{
+protected:
+   /// See BatchedCoefficient::QuadraturePositions().
+   static const Vector &QuadraturePositions(Mesh &mesh,
+                                            const IntegrationRule &ir,
+                                            int &sdim, int &ne);
+
+public:
+   /// Construct a batched vector coefficient with @a vd components.
+   explicit BatchedVectorCoefficient(int vd) : VectorCoefficient(vd) { }
+
+   using VectorCoefficient::Eval;
+
+   /** @brief Evaluate the coefficient at the points of @a ir on all
+       elements of @a mesh, writing the values into @a values in
+       (nq x vdim x ne) layout. */
+   virtual void Eval(Mesh &mesh, const IntegrationRule &ir,
+                     Vector &values) = 0;
+};
+
 /** @brief Compute the Lp norm of a function f.
     \f$ \| f \|_{Lp} = ( \int_\Omega | f |^p d\Omega)^{1/p} \f$ */
 double ComputeLpNorm(double p, Coefficient &coeff, Mesh &mesh,
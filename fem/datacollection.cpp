@@ -17,6 +17,11 @@
 
 #include <cerrno>      // errno
 #include <sstream>
+#include <vector>
+#include <queue>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #ifndef _WIN32
 #include <sys/stat.h>  // mkdir
@@ -28,6 +33,106 @@
 namespace mfem
 {
 
+/** Background writer used by DataCollection in asynchronous mode. Save()
+    serializes each file into a memory buffer and enqueues it here; a single
+    worker thread performs the (optional) compression and the disk writes in
+    submission order, off the compute path. */
+class DataCollectionWriter
+{
+private:
+   struct Task
+   {
+      std::string file_name;
+      int compression;
+      std::string data;
+   };
+
+   std::queue<Task> tasks;
+   std::mutex mutex;
+   std::condition_variable task_ready, task_done;
+   std::thread worker;
+   int pending;
+   bool stop, failed;
+   std::string failed_name; // first file that failed to write
+
+   void Run()
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (true)
+      {
+         while (tasks.empty() && !stop) { task_ready.wait(lock); }
+         if (tasks.empty()) { return; } // stopped and drained
+         Task task;
+         std::swap(task, tasks.front());
+         tasks.pop();
+         lock.unlock();
+         bool ok;
+         try
+         {
+            // the stream wrapped by ofgzstream throws on open/write failures
+            mfem::ofgzstream file(task.file_name, task.compression);
+            file.write(task.data.data(), task.data.size());
+            file.flush();
+            ok = !!file;
+         }
+         catch (...)
+         {
+            ok = false;
+         }
+         lock.lock();
+         if (!ok && !failed) { failed = true; failed_name = task.file_name; }
+         pending--;
+         task_done.notify_all();
+      }
+   }
+
+public:
+   DataCollectionWriter() : pending(0), stop(false), failed(false)
+   {
+      worker = std::thread(&DataCollectionWriter::Run, this);
+   }
+
+   /// Queue the contents of @a buffer for writing to @a file_name.
+   void Enqueue(const std::string &file_name, int compression,
+                std::ostringstream &buffer)
+   {
+      Task task;
+      task.file_name = file_name;
+      task.compression = compression;
+      task.data = buffer.str();
+      std::lock_guard<std::mutex> lock(mutex);
+      tasks.push(std::move(task));
+      pending++;
+      task_ready.notify_one();
+   }
+
+   /** Block until all queued writes are on disk. Returns false if any write
+       failed since the last call, setting @a failed_file to its name. */
+   bool Wait(std::string &failed_file)
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      while (pending > 0) { task_done.wait(lock); }
+      if (failed)
+      {
+         failed_file = failed_name;
+         failed = false;
+         return false;
+      }
+      return true;
+   }
+
+   /// Drains the queue before joining the worker.
+   ~DataCollectionWriter()
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stop = true;
+         task_ready.notify_one();
+      }
+      worker.join();
+   }
+};
+
 // static method
 int DataCollection::create_directory(const std::string &dir_name,
                                      const Mesh *mesh, int myid)
@@ -109,6 +214,9 @@ DataCollection::DataCollection(const std::string& collection_name, Mesh *mesh_)
    pad_digits_cycle = pad_digits_rank = pad_digits_default;
    format = SERIAL_FORMAT; // use serial mesh format
    compression = false;
+   binary = false;
+   lossy_tol = 0.0;
+   writer = NULL;
    error = NO_ERROR;
 }
 
@@ -170,6 +278,57 @@ void DataCollection::SetCompression(bool comp)
 #endif
 }
 
+void DataCollection::SetBinaryOutput(bool binary_)
+{
+   binary = binary_;
+}
+
+void DataCollection::SetLossyTolerance(double tol)
+{
+   MFEM_VERIFY(tol >= 0.0, "invalid lossy tolerance: " << tol);
+   lossy_tol = tol;
+}
+
+void DataCollection::SetFieldLossyTolerance(const std::string &field_name,
+                                            double tol)
+{
+   MFEM_VERIFY(tol >= 0.0, "invalid lossy tolerance: " << tol);
+   field_lossy_tol[field_name] = tol;
+}
+
+double DataCollection::GetFieldLossyTolerance(
+   const std::string &field_name) const
+{
+   std::map<std::string,double>::const_iterator
+      it = field_lossy_tol.find(field_name);
+   return (it != field_lossy_tol.end()) ? it->second : lossy_tol;
+}
+
+void DataCollection::SetAsyncSave(bool async)
+{
+   if (async && !writer)
+   {
+      writer = new DataCollectionWriter;
+   }
+   else if (!async && writer)
+   {
+      WaitForSave();
+      delete writer;
+      writer = NULL;
+   }
+}
+
+void DataCollection::WaitForSave()
+{
+   if (!writer) { return; }
+   std::string failed_file;
+   if (!writer->Wait(failed_file))
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing to file: " << failed_file);
+   }
+}
+
 void DataCollection::SetPrefixPath(const std::string& prefix)
 {
    if (!prefix.empty())
@@ -228,23 +387,47 @@ void DataCollection::SaveMesh()
    }
 
    std::string mesh_name = GetMeshFileName();
-   mfem::ofgzstream mesh_file(mesh_name, compression);
-   mesh_file.precision(precision);
+   bool ok;
+   if (writer)
+   {
+      std::ostringstream buffer;
+      SerializeMesh(buffer);
+      ok = !!buffer;
+      if (ok) { writer->Enqueue(mesh_name, compression, buffer); }
+   }
+   else
+   {
+      mfem::ofgzstream mesh_file(mesh_name, compression);
+      SerializeMesh(mesh_file);
+      ok = !!mesh_file;
+   }
+   if (!ok)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing mesh to file: " << mesh_name);
+   }
+}
+
+void DataCollection::SerializeMesh(std::ostream &out) const
+{
+   out.precision(precision);
 #ifdef MFEM_USE_MPI
    const ParMesh *pmesh = dynamic_cast<const ParMesh*>(mesh);
    if (pmesh && format == PARALLEL_FORMAT)
    {
-      pmesh->ParPrint(mesh_file);
+      MFEM_VERIFY(!binary, "binary output is incompatible with the parallel"
+                  " mesh format");
+      pmesh->ParPrint(out);
    }
    else
 #endif
+   if (binary)
    {
-      mesh->Print(mesh_file);
+      mesh->PrintBinary(out);
    }
-   if (!mesh_file)
+   else
    {
-      error = WRITE_ERROR;
-      MFEM_WARNING("Error writing mesh to file: " << mesh_name);
+      mesh->Print(out);
    }
 }
 
@@ -276,11 +459,30 @@ const
 
 void DataCollection::SaveOneField(const FieldMapIterator &it)
 {
-   mfem::ofgzstream field_file(GetFieldFileName(it->first), compression);
-
-   field_file.precision(precision);
-   (it->second)->Save(field_file);
-   if (!field_file)
+   const std::string file_name = GetFieldFileName(it->first);
+   const GridFunction *gf = it->second;
+   const double tol = GetFieldLossyTolerance(it->first);
+   bool ok;
+   if (writer)
+   {
+      std::ostringstream buffer;
+      buffer.precision(precision);
+      if (tol > 0.0) { gf->SaveLossy(buffer, tol); }
+      else if (binary) { gf->SaveBinary(buffer); }
+      else { gf->Save(buffer); }
+      ok = !!buffer;
+      if (ok) { writer->Enqueue(file_name, compression, buffer); }
+   }
+   else
+   {
+      mfem::ofgzstream field_file(file_name, compression);
+      field_file.precision(precision);
+      if (tol > 0.0) { gf->SaveLossy(field_file, tol); }
+      else if (binary) { gf->SaveBinary(field_file); }
+      else { gf->Save(field_file); }
+      ok = !!field_file;
+   }
+   if (!ok)
    {
       error = WRITE_ERROR;
       MFEM_WARNING("Error writing field to file: " << it->first);
@@ -289,11 +491,24 @@ void DataCollection::SaveOneField(const FieldMapIterator &it)
 
 void DataCollection::SaveOneQField(const QFieldMapIterator &it)
 {
-   mfem::ofgzstream q_field_file(GetFieldFileName(it->first), compression);
-
-   q_field_file.precision(precision);
-   (it->second)->Save(q_field_file);
-   if (!q_field_file)
+   const std::string file_name = GetFieldFileName(it->first);
+   bool ok;
+   if (writer)
+   {
+      std::ostringstream buffer;
+      buffer.precision(precision);
+      (it->second)->Save(buffer);
+      ok = !!buffer;
+      if (ok) { writer->Enqueue(file_name, compression, buffer); }
+   }
+   else
+   {
+      mfem::ofgzstream q_field_file(file_name, compression);
+      q_field_file.precision(precision);
+      (it->second)->Save(q_field_file);
+      ok = !!q_field_file;
+   }
+   if (!ok)
    {
       error = WRITE_ERROR;
       MFEM_WARNING("Error writing q-field to file: " << it->first);
@@ -337,6 +552,7 @@ void DataCollection::DeleteAll()
 
 DataCollection::~DataCollection()
 {
+   delete writer; // drains any writes still queued
    DeleteData();
 }
 
@@ -1115,4 +1331,294 @@ const char *ParaViewDataCollection::GetDataTypeString() const
    }
 }
 
+
+// class TimeSeriesDataCollection implementation
+
+TimeSeriesDataCollection::TimeSeriesDataCollection(
+   const std::string &collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_)
+{
+   cycle = 0; // always record the cycle in the index
+   mesh_offset = mesh_size = 0;
+   mesh_sequence = -1;
+}
+
+std::string TimeSeriesDataCollection::GetTSDataFileName() const
+{
+   std::string file_name = prefix_path + name + ".ts";
+   if (appendRankToFileName)
+   {
+      file_name += "." + to_padded_string(myid, pad_digits_rank);
+   }
+   return file_name;
+}
+
+std::string TimeSeriesDataCollection::GetTSIndexFileName() const
+{
+   std::string file_name = prefix_path + name + ".tsi";
+   if (appendRankToFileName)
+   {
+      file_name += "." + to_padded_string(myid, pad_digits_rank);
+   }
+   return file_name;
+}
+
+void TimeSeriesDataCollection::Save()
+{
+   MFEM_VERIFY(!compression,
+               "the time-series format does not support compression");
+
+   if (!prefix_path.empty())
+   {
+      int err = create_directory(
+                   prefix_path.substr(0, prefix_path.size()-1), mesh, myid);
+      if (err)
+      {
+         error = WRITE_ERROR;
+         MFEM_WARNING("Error creating directory: " << prefix_path);
+         return;
+      }
+   }
+
+   const std::string data_name = GetTSDataFileName();
+   std::fstream data(data_name.c_str(),
+                     std::ios::in | std::ios::out | std::ios::binary);
+   if (!data)
+   {
+      // The file does not exist yet: create it with its header line.
+      data.clear();
+      data.open(data_name.c_str(), std::ios::out | std::ios::binary);
+      data << "MFEM time-series v1.0\n";
+   }
+   if (!data)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error opening time-series data file: " << data_name);
+      return;
+   }
+   data.seekp(0, std::ios::end);
+   data.precision(precision);
+
+   // Append a new mesh chunk only when the mesh has changed; otherwise the
+   // index entry below re-references the chunk written at an earlier cycle.
+   if (mesh_sequence == -1 || mesh_sequence != mesh->GetSequence())
+   {
+      mesh_offset = (long)data.tellp();
+      SerializeMesh(data);
+      mesh_size = (long)data.tellp() - mesh_offset;
+      mesh_sequence = mesh->GetSequence();
+   }
+
+   // Append the field chunks, collecting the index entry as we go. The item
+   // name goes last on its line so that names with spaces parse cleanly.
+   std::ostringstream entry;
+   entry.precision(17); // restart metadata: keep the full double precision
+   entry << "cycle " << cycle << ' ' << time << ' ' << time_step << '\n';
+   entry << "mesh " << mesh_offset << ' ' << mesh_size << '\n';
+
+   for (FieldMapIterator it = field_map.begin(); it != field_map.end(); ++it)
+   {
+      const long offset = (long)data.tellp();
+      if (binary) { (it->second)->SaveBinary(data); }
+      else        { (it->second)->Save(data); }
+      entry << "field " << offset << ' ' << (long)data.tellp() - offset
+            << ' ' << it->first << '\n';
+   }
+
+   for (QFieldMapIterator it = q_field_map.begin(); it != q_field_map.end();
+        ++it)
+   {
+      const long offset = (long)data.tellp();
+      (it->second)->Save(data);
+      entry << "qfield " << offset << ' ' << (long)data.tellp() - offset
+            << ' ' << it->first << '\n';
+   }
+   entry << "end\n";
+
+   data.flush();
+   if (!data)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing time-series data file: " << data_name);
+      return; // do not index a partially written cycle
+   }
+
+   const std::string index_name = GetTSIndexFileName();
+   std::ofstream index(index_name.c_str(), std::ios::app);
+   if (index && index.tellp() == std::streampos(0))
+   {
+      index << "MFEM time-series index v1.0\n";
+   }
+   index << entry.str();
+   index.flush();
+   if (!index)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing time-series index file: " << index_name);
+   }
+}
+
+void TimeSeriesDataCollection::Load(int cycle_)
+{
+   DeleteAll();
+   time = 0.0;
+   time_step = 0.0;
+   error = NO_ERROR;
+   cycle = cycle_;
+
+   const std::string index_name = GetTSIndexFileName();
+   std::ifstream index(index_name.c_str());
+   if (!index)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Unable to open time-series index file: " << index_name);
+      return;
+   }
+   std::string line;
+   std::getline(index, line);
+   filter_dos(line);
+   if (line != "MFEM time-series index v1.0")
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Unknown time-series index format: " << line);
+      return;
+   }
+
+   // Scan the index for the requested cycle; if a cycle was saved more than
+   // once, the last (most recent) block wins.
+   bool found = false, in_block = false;
+   long m_offset = 0, m_size = 0;
+   std::vector<std::string> names;
+   std::vector<long> offsets, sizes;
+   std::vector<bool> is_q_field;
+   std::string keyword;
+   while (index >> keyword)
+   {
+      if (keyword == "cycle")
+      {
+         int c;
+         double t, dt;
+         index >> c >> t >> dt;
+         in_block = (c == cycle_);
+         if (in_block)
+         {
+            found = true;
+            time = t;
+            time_step = dt;
+            names.clear();
+            offsets.clear();
+            sizes.clear();
+            is_q_field.clear();
+         }
+      }
+      else if (keyword == "mesh")
+      {
+         long offset, size;
+         index >> offset >> size;
+         if (in_block) { m_offset = offset; m_size = size; }
+      }
+      else if (keyword == "field" || keyword == "qfield")
+      {
+         long offset, size;
+         index >> offset >> size;
+         index.get(); // the separating space before the name
+         std::getline(index, line);
+         filter_dos(line);
+         if (in_block)
+         {
+            names.push_back(line);
+            offsets.push_back(offset);
+            sizes.push_back(size);
+            is_q_field.push_back(keyword == "qfield");
+         }
+      }
+      else if (keyword != "end")
+      {
+         error = READ_ERROR;
+         MFEM_WARNING("Unknown keyword in time-series index: " << keyword);
+         return;
+      }
+   }
+   if (!found)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Cycle " << cycle_ << " not found in time-series index: "
+                   << index_name);
+      return;
+   }
+
+   const std::string data_name = GetTSDataFileName();
+   std::ifstream data(data_name.c_str(), std::ios::binary);
+   if (!data)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Unable to open time-series data file: " << data_name);
+      return;
+   }
+
+   // Read each indexed chunk into memory and parse it from there, so the
+   // stream readers cannot run past a chunk boundary.
+   std::string chunk((size_t)m_size, '\0');
+   data.seekg(m_offset);
+   data.read(&chunk[0], m_size);
+   if (!data)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading mesh chunk from: " << data_name);
+      return;
+   }
+   std::istringstream mesh_chunk(chunk);
+   if (format == SERIAL_FORMAT)
+   {
+      mesh = new Mesh(mesh_chunk, 1, 0, false);
+      serial = true;
+   }
+   else
+   {
+#ifdef MFEM_USE_MPI
+      mesh = new ParMesh(m_comm, mesh_chunk);
+      serial = false;
+#else
+      error = READ_ERROR;
+      MFEM_WARNING("Reading parallel format in serial is not supported");
+      return;
+#endif
+   }
+   own_data = true;
+
+   for (int i = 0; i < (int)names.size(); i++)
+   {
+      chunk.resize((size_t)sizes[i]);
+      data.seekg(offsets[i]);
+      data.read(&chunk[0], sizes[i]);
+      if (!data)
+      {
+         error = READ_ERROR;
+         MFEM_WARNING("Error reading chunk of '" << names[i] << "' from: "
+                      << data_name);
+         return;
+      }
+      std::istringstream field_chunk(chunk);
+      if (is_q_field[i])
+      {
+         q_field_map.Register(
+            names[i], new QuadratureFunction(mesh, field_chunk), own_data);
+      }
+      else if (serial)
+      {
+         field_map.Register(
+            names[i], new GridFunction(mesh, field_chunk), own_data);
+      }
+      else
+      {
+#ifdef MFEM_USE_MPI
+         field_map.Register(
+            names[i],
+            new ParGridFunction(dynamic_cast<ParMesh*>(mesh), field_chunk),
+            own_data);
+#endif
+      }
+   }
+}
+
 }  // end namespace MFEM
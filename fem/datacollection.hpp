@@ -121,6 +121,8 @@ protected:
 };
 
 
+class DataCollectionWriter; // background writer thread, see SetAsyncSave()
+
 /** A class for collecting finite element data that is part of the same
     simulation. Currently, this class groups together grid functions (fields),
     quadrature functions (q-fields), and the mesh that they are defined on. */
@@ -208,6 +210,22 @@ protected:
    int format;
    int compression;
 
+   /// Save the mesh and fields in binary form: see SetBinaryOutput()
+   bool binary;
+
+   /// Default lossy-compression tolerance: see SetLossyTolerance()
+   double lossy_tol;
+
+   /// Per-field lossy tolerances overriding #lossy_tol, keyed by field name
+   std::map<std::string,double> field_lossy_tol;
+
+   /// Return the lossy tolerance in effect for @a field_name (0 = lossless)
+   double GetFieldLossyTolerance(const std::string &field_name) const;
+
+   /// Background writer thread, allocated in SetAsyncSave(); NULL when
+   /// saving synchronously.
+   DataCollectionWriter *writer;
+
    /// Should the collection delete its mesh and fields
    bool own_data;
 
@@ -223,6 +241,9 @@ protected:
    std::string GetMeshFileName() const;
    std::string GetFieldFileName(const std::string &field_name) const;
 
+   /// Write the mesh to @a out in the format selected by #format and #binary
+   void SerializeMesh(std::ostream &out) const;
+
    /// Save one field to disk, assuming the collection directory exists
    void SaveOneField(const FieldMapIterator &it);
 
@@ -351,6 +372,48 @@ public:
    /// Set the flag for use of gz compressed files
    virtual void SetCompression(bool comp);
 
+   /** @brief Enable or disable binary output.
+
+       When enabled, the mesh is saved with Mesh::PrintBinary() (conforming
+       non-NURBS meshes only; incompatible with #PARALLEL_FORMAT) and fields
+       with GridFunction::SaveBinary(), so serialization reduces to bulk
+       copies of the coordinate and dof arrays. Q-fields are still written in
+       ASCII. The files load through the regular Mesh and GridFunction stream
+       constructors. Binary output combines with SetCompression(). */
+   virtual void SetBinaryOutput(bool binary_);
+
+   /** @brief Set the default error tolerance for lossy field compression.
+
+       When @a tol > 0, fields are saved with GridFunction::SaveLossy(),
+       which guarantees that each dof value reloaded on restart differs from
+       the saved one by at most the tolerance, and typically shrinks smooth
+       high-order fields by an order of magnitude. A tolerance of 0 (the
+       default) keeps fields lossless, honoring SetBinaryOutput(). The mesh
+       and q-fields are always written losslessly. */
+   void SetLossyTolerance(double tol);
+
+   /** @brief Override the lossy-compression tolerance for one field.
+
+       Takes precedence over SetLossyTolerance() for @a field_name; use 0 to
+       keep that field lossless. */
+   void SetFieldLossyTolerance(const std::string &field_name, double tol);
+
+   /** @brief Enable or disable asynchronous saving.
+
+       When enabled, Save() serializes the mesh and fields into in-memory
+       buffers and returns; a background thread performs the optional zlib
+       compression and the disk writes. With binary output enabled the
+       serialization itself is a bulk copy, so Save() returns after little
+       more than a memcpy. Buffers are snapshots: the mesh and fields may be
+       modified freely once Save() returns. I/O errors from queued writes are
+       reported by the next WaitForSave() (or Error() after it). Disabling
+       waits for all pending writes. */
+   void SetAsyncSave(bool async);
+
+   /// Wait until all writes queued by asynchronous Save() calls have
+   /// completed, folding any write failure into the error state.
+   void WaitForSave();
+
    /// Set the path where the DataCollection will be saved.
    void SetPrefixPath(const std::string &prefix);
 
@@ -545,5 +608,48 @@ public:
    virtual void Load(int cycle_ = 0) override;
 };
 
+
+/** @brief Data collection that appends all cycles of a run to a single data
+    file per rank, indexed by cycle.
+
+    Each Save() appends one chunk per item (the mesh and every registered
+    field, in the formats selected by SetFormat() and SetBinaryOutput()) to
+    the data file "<name>.ts[.<rank>]" and records the chunk offsets together
+    with the cycle metadata in the small ASCII index file
+    "<name>.tsi[.<rank>]". The mesh chunk is rewritten only when the mesh
+    changes (tracked through Mesh::GetSequence()); unchanged meshes are
+    re-indexed from the existing chunk. A long time history therefore costs
+    two open files per rank instead of one directory of small files per
+    cycle, and Load() seeks directly to the indexed chunks of the requested
+    cycle. Compression and asynchronous saving are not supported, since the
+    chunks must remain seekable and append in order. */
+class TimeSeriesDataCollection : public DataCollection
+{
+protected:
+   /// Data-file offset and size of the most recently written mesh chunk
+   long mesh_offset, mesh_size;
+   /// Mesh::GetSequence() value of the written mesh chunk, or -1 when no
+   /// mesh chunk has been written by this object yet
+   long mesh_sequence;
+
+   /// Name of the single data file: "<prefix><name>.ts[.<rank>]"
+   std::string GetTSDataFileName() const;
+   /// Name of the cycle index file: "<prefix><name>.tsi[.<rank>]"
+   std::string GetTSIndexFileName() const;
+
+public:
+   /// Constructor. The collection name is used in the output file names.
+   /** If @a mesh_ is NULL, then the mesh can be set later by calling
+       SetMesh(). */
+   explicit TimeSeriesDataCollection(const std::string &collection_name,
+                                     Mesh *mesh_ = NULL);
+
+   /// Append the current cycle to the data file and record it in the index.
+   virtual void Save() override;
+
+   /// Read the mesh and the fields of cycle @a cycle_ from the data file.
+   virtual void Load(int cycle_ = 0) override;
+};
+
 }
 #endif
@@ -489,27 +489,18 @@ void IsoparametricTransformation::Transform (const IntegrationPoint &ip,
 void IsoparametricTransformation::Transform (const IntegrationRule &ir,
                                              DenseMatrix &tr)
 {
-   int dof, n, dim, i, j, k;
-
-   dim = PointMat.Height();
-   dof = FElem->GetDof();
-   n = ir.GetNPoints();
-
-   shape.SetSize(dof);
-   tr.SetSize(dim, n);
-
-   for (j = 0; j < n; j++)
-   {
-      FElem -> CalcShape (ir.IntPoint(j), shape);
-      for (i = 0; i < dim; i++)
-      {
-         tr(i, j) = 0.0;
-         for (k = 0; k < dof; k++)
-         {
-            tr(i, j) += PointMat(i, k) * shape(k);
-         }
-      }
-   }
+   const int dof = FElem->GetDof();
+   const int n = ir.GetNPoints();
+
+   tr.SetSize(PointMat.Height(), n);
+
+   // The shape values of (FElem, ir) are computed once and cached inside
+   // FElem, so repeated calls over elements that share the same finite
+   // element - the common case of a mesh with one geometry type and order -
+   // reuse the same table instead of re-evaluating the basis at every call.
+   const DofToQuad &d2q = FElem->GetDofToQuad(ir, DofToQuad::FULL);
+   const DenseMatrix Bt(const_cast<double *>(d2q.Bt.HostRead()), dof, n);
+   Mult(PointMat, Bt, tr);
 }
 
 void IsoparametricTransformation::Transform (const DenseMatrix &matrix,
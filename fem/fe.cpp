@@ -16,12 +16,36 @@
 #include "../mesh/nurbs.hpp"
 #include "bilininteg.hpp"
 #include <cmath>
+#include <mutex>
 
 namespace mfem
 {
 
 using namespace std;
 
+namespace
+{
+
+// Mutexes protecting the lazily-built tables that are shared process-wide:
+// the DofToQuad caches of the FiniteElement objects and the point, basis,
+// and binomial tables of Poly_1D.
+std::mutex dof2quad_mutex;
+std::mutex poly1d_points_mutex, poly1d_bases_mutex, binom_mutex;
+
+// Rows of the binomial "p choose k" table built by Poly_1D::Binom(). Rows
+// are allocated once and never move, so pointers handed out earlier stay
+// valid while other threads extend the table.
+struct BinomTable
+{
+   Array<int*> rows;
+   ~BinomTable()
+   {
+      for (int i = 0; i < rows.Size(); i++) { delete [] rows[i]; }
+   }
+} binom_table;
+
+} // anonymous namespace
+
 FiniteElement::FiniteElement(int D, Geometry::Type G, int Do, int O, int F)
    : Nodes(Do)
 {
@@ -469,6 +493,7 @@ const DofToQuad &ScalarFiniteElement::GetDofToQuad(const IntegrationRule &ir,
 {
    MFEM_VERIFY(mode == DofToQuad::FULL, "invalid mode requested");
 
+   std::lock_guard<std::mutex> lock(dof2quad_mutex);
    for (int i = 0; i < dof2quad_array.Size(); i++)
    {
       const DofToQuad &d2q = *dof2quad_array[i];
@@ -518,6 +543,7 @@ const DofToQuad &ScalarFiniteElement::GetTensorDofToQuad(
 {
    MFEM_VERIFY(mode == DofToQuad::TENSOR, "invalid mode requested");
 
+   std::lock_guard<std::mutex> lock(dof2quad_mutex);
    for (int i = 0; i < dof2quad_array.Size(); i++)
    {
       const DofToQuad &d2q = *dof2quad_array[i];
@@ -7161,19 +7187,24 @@ void Poly_1D::Basis::Eval(const double y, Vector &u, Vector &d,
 
 const int *Poly_1D::Binom(const int p)
 {
-   if (binom.NumCols() <= p)
+   std::lock_guard<std::mutex> lock(binom_mutex);
+   Array<int*> &rows = binom_table.rows;
+   const int old_size = rows.Size();
+   if (old_size <= p)
    {
-      binom.SetSize(p + 1, p + 1);
-      for (int i = 0; i <= p; i++)
+      rows.SetSize(p + 1);
+      for (int i = old_size; i <= p; i++)
       {
-         binom(i,0) = binom(i,i) = 1;
+         int *row = new int[i + 1];
+         row[0] = row[i] = 1;
          for (int j = 1; j < i; j++)
          {
-            binom(i,j) = binom(i-1,j) + binom(i-1,j-1);
+            row[j] = rows[i-1][j] + rows[i-1][j-1];
          }
+         rows[i] = row;
       }
    }
-   return binom[p];
+   return rows[p];
 }
 
 void Poly_1D::ChebyshevPoints(const int p, double *x)
@@ -7408,6 +7439,7 @@ const double *Poly_1D::GetPoints(const int p, const int btype)
 
    if (qtype == Quadrature1D::Invalid) { return NULL; }
 
+   std::lock_guard<std::mutex> lock(poly1d_points_mutex);
    if (points_container.find(btype) == points_container.end())
    {
       points_container[btype] = new Array<double*>(h_mt);
@@ -7429,6 +7461,7 @@ Poly_1D::Basis &Poly_1D::GetBasis(const int p, const int btype)
 {
    BasisType::Check(btype);
 
+   std::lock_guard<std::mutex> lock(poly1d_bases_mutex);
    if ( bases_container.find(btype) == bases_container.end() )
    {
       // we haven't been asked for basis or points of this type yet
@@ -7472,7 +7505,6 @@ Poly_1D::~Poly_1D()
    }
 }
 
-Array2D<int> Poly_1D::binom;
 Poly_1D poly1d;
 
 
@@ -11740,6 +11772,7 @@ const DofToQuad &VectorTensorFiniteElement::GetTensorDofToQuad(
 {
    MFEM_VERIFY(mode == DofToQuad::TENSOR, "invalid mode requested");
 
+   std::lock_guard<std::mutex> lock(dof2quad_mutex);
    for (int i = 0;
         i < (closed ? dof2quad_array.Size() : dof2quad_array_open.Size());
         i++)
@@ -1878,8 +1878,6 @@ private:
    PointsMap points_container;
    BasisMap  bases_container;
 
-   static Array2D<int> binom;
-
    static void CalcMono(const int p, const double x, double *u);
    static void CalcMono(const int p, const double x, double *u, double *d);
 
@@ -1894,7 +1892,9 @@ public:
    Poly_1D(): h_mt(MemoryType::HOST) { }
 
    /** @brief Get a pointer to an array containing the binomial coefficients "p
-       choose k" for k=0,...,p for the given p. */
+       choose k" for k=0,...,p for the given p. This method is thread-safe, as
+       are GetPoints() and GetBasis(); the returned pointer remains valid while
+       other threads extend the table. */
    static const int *Binom(const int p);
 
    /** @brief Get the coordinates of the points of the given BasisType,
@@ -30,8 +30,10 @@
 #include "bilinearform.hpp"
 #include "hybridization.hpp"
 #include "datacollection.hpp"
+#include "resampler.hpp"
 #include "estimators.hpp"
 #include "staticcond.hpp"
+#include "nurbs_pa.hpp"
 #include "tmop.hpp"
 #include "tmop_tools.hpp"
 #include "gslib.hpp"
@@ -41,6 +43,7 @@
 #include "transfer.hpp"
 #include "fespacehierarchy.hpp"
 #include "multigrid.hpp"
+#include "lor.hpp"
 
 #ifdef MFEM_USE_MPI
 #include "pfespace.hpp"
@@ -62,7 +62,7 @@ FiniteElementSpace::FiniteElementSpace()
      fdofs(NULL), bdofs(NULL),
      elem_dof(NULL), bdrElem_dof(NULL), face_dof(NULL),
      NURBSext(NULL), own_ext(false),
-     cP(NULL), cR(NULL), cP_is_set(false),
+     cP(NULL), cR(NULL), cP_is_set(false), cP_op(NULL),
      Th(Operator::ANY_TYPE),
      sequence(0)
 { }
@@ -155,6 +155,38 @@ int FiniteElementSpace::DofToVDof(int dof, int vd, int ndofs) const
    }
 }
 
+void FiniteElementSpace::ConvertByNodesToByVDim(const Vector &x, Vector &y)
+const
+{
+   MFEM_ASSERT(x.Size() == vdim*ndofs && y.Size() == vdim*ndofs,
+               "invalid vector sizes");
+   if (vdim == 1) { y = x; return; }
+   // The index map is the analytic transpose (dof,vd) -> (vd,dof), so no
+   // gather table is needed.
+   const int nd = ndofs, vd = vdim;
+   const auto d_x = Reshape(x.Read(), nd, vd);
+   auto d_y = Reshape(y.Write(), vd, nd);
+   MFEM_FORALL(i, nd,
+   {
+      for (int c = 0; c < vd; c++) { d_y(c,i) = d_x(i,c); }
+   });
+}
+
+void FiniteElementSpace::ConvertByVDimToByNodes(const Vector &x, Vector &y)
+const
+{
+   MFEM_ASSERT(x.Size() == vdim*ndofs && y.Size() == vdim*ndofs,
+               "invalid vector sizes");
+   if (vdim == 1) { y = x; return; }
+   const int nd = ndofs, vd = vdim;
+   const auto d_x = Reshape(x.Read(), vd, nd);
+   auto d_y = Reshape(y.Write(), nd, vd);
+   MFEM_FORALL(i, nd,
+   {
+      for (int c = 0; c < vd; c++) { d_y(i,c) = d_x(c,i); }
+   });
+}
+
 // static function
 void FiniteElementSpace::AdjustVDofs (Array<int> &vdofs)
 {
@@ -220,8 +252,21 @@ void FiniteElementSpace::BuildElementToDofTable() const
    el_dof -> MakeI (mesh -> GetNE());
    for (int i = 0; i < mesh -> GetNE(); i++)
    {
-      GetElementDofs (i, dofs);
-      el_dof -> AddColumnsInRow (i, dofs.Size());
+      // the row size is just the number of dofs of the element FE, so the
+      // entity lookups done by GetElementDofs() are needed only in the
+      // second pass; trace collections, e.g. DG interface spaces, define no
+      // element FE and require the full dof enumeration to size their rows
+      const Geometry::Type geom = mesh->GetElementBaseGeometry(i);
+      const FiniteElement *fe = fec->FiniteElementForGeometry(geom);
+      if (fe)
+      {
+         el_dof -> AddColumnsInRow (i, fe->GetDof());
+      }
+      else
+      {
+         GetElementDofs (i, dofs);
+         el_dof -> AddColumnsInRow (i, dofs.Size());
+      }
    }
    el_dof -> MakeJ();
    for (int i = 0; i < mesh -> GetNE(); i++)
@@ -884,15 +929,186 @@ const SparseMatrix* FiniteElementSpace::GetConformingRestriction() const
    return cR;
 }
 
+const Operator *FiniteElementSpace::GetProlongationMatrix() const
+{
+   const SparseMatrix *P = GetConformingProlongation();
+   if (!P) { return NULL; }
+   if (!cP_op) { cP_op = new NCProlongationOperator(*P, *cR); }
+   return cP_op;
+}
+
 int FiniteElementSpace::GetNConformingDofs() const
 {
    const SparseMatrix* P = GetConformingProlongation();
    return P ? (P->Width() / vdim) : ndofs;
 }
 
+NCProlongationOperator::NCProlongationOperator(const SparseMatrix &cP,
+                                               const SparseMatrix &cR)
+   : Operator(cP.Height(), cP.Width()), P_mat(cP)
+{
+   const int n_ldofs = cP.Height();
+   const int n_tdofs = cP.Width();
+   MFEM_VERIFY(cR.Height() == n_tdofs && cR.Width() == n_ldofs,
+               "incompatible conforming prolongation and restriction");
+
+   // the rows of cR identify the true dofs among the local dofs
+   conf_ldof.SetSize(n_tdofs);
+   Array<bool> is_true_dof(n_ldofs);
+   is_true_dof = false;
+   for (int t = 0; t < n_tdofs; t++)
+   {
+      MFEM_ASSERT(cR.RowSize(t) == 1, "invalid conforming restriction");
+      const int ldof = cR.GetRowColumns(t)[0];
+      conf_ldof[t] = ldof;
+      is_true_dof[ldof] = true;
+   }
+
+   // compact CSR copy of the constrained (non-identity) rows of cP
+   const int *I = cP.GetI();
+   const int *J = cP.GetJ();
+   const double *A = cP.GetData();
+   int n_dep = 0, nnz = 0;
+   for (int i = 0; i < n_ldofs; i++)
+   {
+      if (!is_true_dof[i]) { n_dep++; nnz += I[i+1] - I[i]; }
+   }
+   dep_ldof.SetSize(n_dep);
+   dep_ptr.SetSize(n_dep + 1);
+   dep_col.SetSize(nnz);
+   dep_val.SetSize(nnz);
+   dep_ptr[0] = 0;
+   Array<int> t_rowsize(n_tdofs);
+   t_rowsize = 0;
+   n_dep = nnz = 0;
+   for (int i = 0; i < n_ldofs; i++)
+   {
+      if (is_true_dof[i]) { continue; }
+      dep_ldof[n_dep] = i;
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         dep_col[nnz] = J[k];
+         dep_val(nnz) = A[k];
+         t_rowsize[J[k]]++;
+         nnz++;
+      }
+      dep_ptr[++n_dep] = nnz;
+   }
+
+   // transpose of the constrained block, making MultTranspose() race-free
+   dept_ptr.SetSize(n_tdofs + 1);
+   dept_ptr[0] = 0;
+   for (int t = 0; t < n_tdofs; t++)
+   {
+      dept_ptr[t+1] = dept_ptr[t] + t_rowsize[t];
+   }
+   dept_ldof.SetSize(nnz);
+   dept_val.SetSize(nnz);
+   t_rowsize = 0;
+   for (int j = 0; j < n_dep; j++)
+   {
+      for (int k = dep_ptr[j]; k < dep_ptr[j+1]; k++)
+      {
+         const int t = dep_col[k];
+         const int pos = dept_ptr[t] + t_rowsize[t]++;
+         dept_ldof[pos] = dep_ldof[j];
+         dept_val(pos) = dep_val(k);
+      }
+   }
+   dep_val.UseDevice(true);
+   dept_val.UseDevice(true);
+}
+
+void NCProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   const int n_tdofs = conf_ldof.Size();
+   const int n_dep = dep_ldof.Size();
+   const double *d_x = x.Read();
+   double *d_y = y.Write();
+   const int *c_l = conf_ldof.Read();
+   MFEM_FORALL(t, n_tdofs, d_y[c_l[t]] = d_x[t];);
+   if (n_dep == 0) { return; }
+   const int *d_l = dep_ldof.Read();
+   const int *d_p = dep_ptr.Read();
+   const int *d_c = dep_col.Read();
+   const double *d_v = dep_val.Read();
+   MFEM_FORALL(i, n_dep,
+   {
+      double sum = 0.0;
+      for (int k = d_p[i]; k < d_p[i+1]; k++)
+      {
+         sum += d_v[k]*d_x[d_c[k]];
+      }
+      d_y[d_l[i]] = sum;
+   });
+}
+
+void NCProlongationOperator::MultTranspose(const Vector &x, Vector &y) const
+{
+   const int n_tdofs = conf_ldof.Size();
+   const double *d_x = x.Read();
+   double *d_y = y.Write();
+   const int *c_l = conf_ldof.Read();
+   const int *t_p = dept_ptr.Read();
+   const int *t_l = dept_ldof.Read();
+   const double *t_v = dept_val.Read();
+   MFEM_FORALL(t, n_tdofs,
+   {
+      double sum = d_x[c_l[t]];
+      for (int k = t_p[t]; k < t_p[t+1]; k++)
+      {
+         sum += t_v[k]*d_x[t_l[k]];
+      }
+      d_y[t] = sum;
+   });
+}
+
+void NCProlongationOperator::AbsMultTranspose(const Vector &x, Vector &y) const
+{
+   const int n_tdofs = conf_ldof.Size();
+   const double *d_x = x.Read();
+   double *d_y = y.Write();
+   const int *c_l = conf_ldof.Read();
+   const int *t_p = dept_ptr.Read();
+   const int *t_l = dept_ldof.Read();
+   const double *t_v = dept_val.Read();
+   MFEM_FORALL(t, n_tdofs,
+   {
+      double sum = d_x[c_l[t]]; // the identity entries have |p| = 1
+      for (int k = t_p[t]; k < t_p[t+1]; k++)
+      {
+         sum += fabs(t_v[k])*d_x[t_l[k]];
+      }
+      d_y[t] = sum;
+   });
+}
+
+bool FiniteElementSpace::IsElementRestrictionIdentity() const
+{
+   // On mixed meshes the elements of each geometry are interleaved in the
+   // L-vector, so none of the per-geometry E-vectors can coincide with it.
+   if (mesh->GetNE() > 0 && mesh->GetNumGeometries(mesh->Dimension()) > 1)
+   {
+      return false;
+   }
+   // The DOFs of a discontinuous space are blocked per element in the
+   // elements' native order, which for tensor product L2 elements is the
+   // lexicographic one. With several vector components the E-vector
+   // interleaves them per element, unlike either L-vector ordering.
+   return IsDGSpace() && vdim == 1;
+}
+
 const Operator *FiniteElementSpace::GetElementRestriction(
    ElementDofOrdering e_ordering) const
 {
+   // On mixed meshes the number of dofs varies between elements and there is
+   // no uniform E-vector: the per-geometry restrictions, see
+   // GetElementRestriction(ElementDofOrdering, Geometry::Type), have to be
+   // used instead.
+   if (mesh->GetNE() > 0 && mesh->GetNumGeometries(mesh->Dimension()) > 1)
+   {
+      return NULL;
+   }
    // Check if we have a discontinuous space using the FE collection:
    if (IsDGSpace())
    {
@@ -918,6 +1134,20 @@ const Operator *FiniteElementSpace::GetElementRestriction(
    return L2E_nat.Ptr();
 }
 
+const Operator *FiniteElementSpace::GetElementRestriction(
+   ElementDofOrdering e_ordering, Geometry::Type geom) const
+{
+   const key_elem key = std::make_pair(e_ordering, geom);
+   auto itr = L2E_geom.find(key);
+   if (itr != L2E_geom.end())
+   {
+      return itr->second;
+   }
+   Operator *res = new GeometryElementRestriction(*this, e_ordering, geom);
+   L2E_geom[key] = res;
+   return res;
+}
+
 const Operator *FiniteElementSpace::GetFaceRestriction(
    ElementDofOrdering e_ordering, FaceType type, L2FaceValues mul) const
 {
@@ -1125,6 +1355,9 @@ FiniteElementSpace::RefinementOperator::RefinementOperator
    {
       fespace->GetLocalRefinementMatrices(elem_geoms[i], localP[elem_geoms[i]]);
    }
+
+   FlagIdentityMatrices();
+   SetupBatched();
 }
 
 FiniteElementSpace::RefinementOperator::RefinementOperator(
@@ -1142,6 +1375,48 @@ FiniteElementSpace::RefinementOperator::RefinementOperator(
 
    // Make a copy of the coarse elem_dof Table.
    old_elem_dof = new Table(coarse_fes->GetElementToDofTable());
+
+   FlagIdentityMatrices();
+   SetupBatched();
+}
+
+void FiniteElementSpace::RefinementOperator::FlagIdentityMatrices()
+{
+   // With local refinement most elements are typically untouched and their
+   // local matrix is the identity (up to roundoff in the shape function
+   // evaluation); flag them so Mult()/MultTranspose() can copy the dofs
+   // directly instead of applying the dense matrix.
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      const int nmat = localP[g].SizeK();
+      localP_id[g].SetSize(nmat);
+      for (int i = 0; i < nmat; i++)
+      {
+         const DenseMatrix &lP = localP[g](i);
+         bool id = (lP.Height() == lP.Width());
+         for (int r = 0; id && r < lP.Height(); r++)
+         {
+            for (int c = 0; c < lP.Width(); c++)
+            {
+               if (std::abs(lP(r,c) - ((r == c) ? 1.0 : 0.0)) > 1e-12)
+               {
+                  id = false;
+                  break;
+               }
+            }
+         }
+         localP_id[g][i] = id;
+         // Snap flagged matrices to exact identities: the host loops skip
+         // them, and the batched kernels then reproduce the dof copies of the
+         // host path exactly.
+         if (id)
+         {
+            DenseMatrix &lP_rw = localP[g](i);
+            lP_rw = 0.0;
+            for (int r = 0; r < lP_rw.Height(); r++) { lP_rw(r,r) = 1.0; }
+         }
+      }
+   }
 }
 
 FiniteElementSpace::RefinementOperator::~RefinementOperator()
@@ -1149,9 +1424,220 @@ FiniteElementSpace::RefinementOperator::~RefinementOperator()
    delete old_elem_dof;
 }
 
+void FiniteElementSpace::RefinementOperator::SetupBatched()
+{
+   // The batched apply requires a single geometry (so that all local matrices
+   // have the same dimensions) and dofs without sign encoding; otherwise, and
+   // in purely serial runs, the per-element host loops in Mult() and
+   // MultTranspose() are kept.
+   batched = false;
+   if (!Device::Allows(Backend::DEVICE_MASK|Backend::OMP_MASK)) { return; }
+   Mesh *mesh = fespace->GetMesh();
+   Mesh::GeometryList elem_geoms(*mesh);
+   if (elem_geoms.Size() != 1) { return; }
+   batch_geom = elem_geoms[0];
+
+   const CoarseFineTransformations &rtrans = mesh->GetRefinementTransforms();
+   const int ne = mesh->GetNE();
+   const int NDF = localP[batch_geom].SizeI();
+   const int NDC = localP[batch_geom].SizeJ();
+   const int vdim = fespace->GetVDim();
+
+   // Embeddings and element dofs in device-usable form.
+   emb_parent.SetSize(ne);
+   emb_matrix.SetSize(ne);
+   fine_elem_dof_b.SetSize(ne*NDF);
+   Array<int> dofs;
+   for (int k = 0; k < ne; k++)
+   {
+      const Embedding &emb = rtrans.embeddings[k];
+      emb_parent[k] = emb.parent;
+      emb_matrix[k] = emb.matrix;
+      fespace->GetElementDofs(k, dofs);
+      if (dofs.Size() != NDF) { return; }
+      for (int j = 0; j < NDF; j++)
+      {
+         if (dofs[j] < 0) { return; }
+         fine_elem_dof_b[k*NDF + j] = dofs[j];
+      }
+   }
+   coarse_elem_dof_b.SetSize(old_elem_dof->Size()*NDC);
+   for (int p = 0; p < old_elem_dof->Size(); p++)
+   {
+      if (old_elem_dof->RowSize(p) != NDC) { return; }
+      const int *row = old_elem_dof->GetRow(p);
+      for (int j = 0; j < NDC; j++)
+      {
+         if (row[j] < 0) { return; }
+         coarse_elem_dof_b[p*NDC + j] = row[j];
+      }
+   }
+
+   // For each fine dof, record the last and the first (fine element, local
+   // dof) pair touching it in the host loop order: the last writer determines
+   // the value in Mult(), the first one is the single contributor of the dof
+   // in MultTranspose().
+   const int f_ndofs = height/vdim;
+   fine_dof_src.SetSize(f_ndofs);
+   fine_dof_fst.SetSize(f_ndofs);
+   fine_dof_src = -1;
+   fine_dof_fst = -1;
+   for (int k = 0; k < ne; k++)
+   {
+      for (int j = 0; j < NDF; j++)
+      {
+         const int d = fine_elem_dof_b[k*NDF + j];
+         fine_dof_src[d] = k*NDF + j;
+         if (fine_dof_fst[d] < 0) { fine_dof_fst[d] = k*NDF + j; }
+      }
+   }
+
+   // For each coarse dof, list the (fine element, parent local dof) pairs
+   // accumulating into it in MultTranspose().
+   const int c_ndofs = width/vdim;
+   ct_offsets.SetSize(c_ndofs + 1);
+   ct_offsets = 0;
+   for (int k = 0; k < ne; k++)
+   {
+      for (int i = 0; i < NDC; i++)
+      {
+         ct_offsets[coarse_elem_dof_b[emb_parent[k]*NDC + i] + 1]++;
+      }
+   }
+   ct_offsets.PartialSum();
+   ct_src.SetSize(ct_offsets[c_ndofs]);
+   {
+      Array<int> fill(c_ndofs);
+      fill = 0;
+      for (int k = 0; k < ne; k++)
+      {
+         for (int i = 0; i < NDC; i++)
+         {
+            const int d = coarse_elem_dof_b[emb_parent[k]*NDC + i];
+            ct_src[ct_offsets[d] + fill[d]++] = k*NDC + i;
+         }
+      }
+   }
+
+   batched = true;
+}
+
+void FiniteElementSpace::RefinementOperator::BatchedMult(
+   const Vector &x, Vector &y) const
+{
+   const int vdim = fespace->GetVDim();
+   const bool byvdim = fespace->GetOrdering() == Ordering::byVDIM;
+   const int f_ndofs = height/vdim;
+   const int c_ndofs = width/vdim;
+   const DenseTensor &lP = localP[batch_geom];
+   const int NDF = lP.SizeI(), NDC = lP.SizeJ(), VD = vdim;
+   const int ne = emb_parent.Size();
+
+   // Interpolate every fine element from its parent into an E-vector, ...
+   Vector e_f(ne*NDF*vdim);
+   e_f.UseDevice(true);
+   const auto lPd = Reshape(lP.Read(), NDF, NDC, lP.SizeK());
+   const auto par = emb_parent.Read();
+   const auto mat = emb_matrix.Read();
+   const auto cdof = coarse_elem_dof_b.Read();
+   const auto X = x.Read();
+   auto E = Reshape(e_f.Write(), NDF, vdim, ne);
+   MFEM_FORALL(k, ne,
+   {
+      const int p = par[k], m = mat[k];
+      for (int vd = 0; vd < VD; vd++)
+      {
+         for (int i = 0; i < NDF; i++)
+         {
+            double sum = 0.0;
+            for (int j = 0; j < NDC; j++)
+            {
+               const int d = cdof[p*NDC + j];
+               sum += lPd(i,j,m)*X[byvdim ? d*VD + vd : d + vd*c_ndofs];
+            }
+            E(i, vd, k) = sum;
+         }
+      }
+   });
+
+   // ... then place it in the fine L-vector.
+   const auto src = fine_dof_src.Read();
+   auto Y = y.Write();
+   MFEM_FORALL(i, f_ndofs,
+   {
+      const int s = src[i];
+      for (int vd = 0; vd < VD; vd++)
+      {
+         Y[byvdim ? i*VD + vd : i + vd*f_ndofs] =
+            (s < 0) ? 0.0 : E(s%NDF, vd, s/NDF);
+      }
+   });
+}
+
+void FiniteElementSpace::RefinementOperator::BatchedMultTranspose(
+   const Vector &x, Vector &y) const
+{
+   const int vdim = fespace->GetVDim();
+   const bool byvdim = fespace->GetOrdering() == Ordering::byVDIM;
+   const int f_ndofs = height/vdim;
+   const int c_ndofs = width/vdim;
+   const DenseTensor &lP = localP[batch_geom];
+   const int NDF = lP.SizeI(), NDC = lP.SizeJ(), VD = vdim;
+   const int ne = emb_parent.Size();
+
+   // Restrict every fine element to its parent's dofs, counting each fine dof
+   // in the first element containing it only, like the host loop, ...
+   Vector e_c(ne*NDC*vdim);
+   e_c.UseDevice(true);
+   const auto lPd = Reshape(lP.Read(), NDF, NDC, lP.SizeK());
+   const auto mat = emb_matrix.Read();
+   const auto fdof = fine_elem_dof_b.Read();
+   const auto fst = fine_dof_fst.Read();
+   const auto X = x.Read();
+   auto E = Reshape(e_c.Write(), NDC, vdim, ne);
+   MFEM_FORALL(k, ne,
+   {
+      const int m = mat[k];
+      for (int vd = 0; vd < VD; vd++)
+      {
+         for (int i = 0; i < NDC; i++)
+         {
+            double sum = 0.0;
+            for (int j = 0; j < NDF; j++)
+            {
+               const int d = fdof[k*NDF + j];
+               if (fst[d] != k*NDF + j) { continue; }
+               sum += lPd(j,i,m)*X[byvdim ? d*VD + vd : d + vd*f_ndofs];
+            }
+            E(i, vd, k) = sum;
+         }
+      }
+   });
+
+   // ... then accumulate the per-element contributions of each coarse dof.
+   const auto off = ct_offsets.Read();
+   const auto src = ct_src.Read();
+   auto Y = y.Write();
+   MFEM_FORALL(d, c_ndofs,
+   {
+      for (int vd = 0; vd < VD; vd++)
+      {
+         double sum = 0.0;
+         for (int e = off[d]; e < off[d+1]; e++)
+         {
+            const int s = src[e];
+            sum += E(s%NDC, vd, s/NDC);
+         }
+         Y[byvdim ? d*VD + vd : d + vd*c_ndofs] = sum;
+      }
+   });
+}
+
 void FiniteElementSpace::RefinementOperator
 ::Mult(const Vector &x, Vector &y) const
 {
+   if (batched) { BatchedMult(x, y); return; }
+
    Mesh* mesh = fespace->GetMesh();
    const CoarseFineTransformations &rtrans = mesh->GetRefinementTransforms();
 
@@ -1180,6 +1666,11 @@ void FiniteElementSpace::RefinementOperator
          old_dofs.Copy(old_vdofs);
          fespace->DofsToVDofs(vd, old_vdofs, old_ndofs);
          x.GetSubVector(old_vdofs, subX);
+         if (localP_id[geom][emb.matrix])
+         {
+            y.SetSubVector(vdofs, subX);
+            continue;
+         }
          lP.Mult(subX, subY);
          y.SetSubVector(vdofs, subY);
       }
@@ -1189,6 +1680,8 @@ void FiniteElementSpace::RefinementOperator
 void FiniteElementSpace::RefinementOperator
 ::MultTranspose(const Vector &x, Vector &y) const
 {
+   if (batched) { BatchedMultTranspose(x, y); return; }
+
    y = 0.0;
 
    Mesh* mesh = fespace->GetMesh();
@@ -1232,6 +1725,11 @@ void FiniteElementSpace::RefinementOperator
             }
          }
 
+         if (localP_id[geom][emb.matrix])
+         {
+            y.AddElementVector(c_vdofs, subX);
+            continue;
+         }
          lP.MultTranspose(subX, subY);
          y.AddElementVector(c_vdofs, subY);
       }
@@ -1247,7 +1745,7 @@ FiniteElementSpace::DerefinementOperator::DerefinementOperator(
    const FiniteElementSpace *f_fes, const FiniteElementSpace *c_fes,
    BilinearFormIntegrator *mass_integ)
    : Operator(c_fes->GetVSize(), f_fes->GetVSize()),
-     fine_fes(f_fes)
+     fine_fes(f_fes), batched(false)
 {
    MFEM_VERIFY(c_fes->GetOrdering() == f_fes->GetOrdering() &&
                c_fes->GetVDim() == f_fes->GetVDim(),
@@ -1336,6 +1834,8 @@ FiniteElementSpace::DerefinementOperator::DerefinementOperator(
 
    // Make a copy of the coarse element-to-dof Table.
    coarse_elem_dof = new Table(c_fes->GetElementToDofTable());
+
+   SetupBatched(c_fes);
 }
 
 FiniteElementSpace::DerefinementOperator::~DerefinementOperator()
@@ -1343,9 +1843,142 @@ FiniteElementSpace::DerefinementOperator::~DerefinementOperator()
    delete coarse_elem_dof;
 }
 
+void FiniteElementSpace::DerefinementOperator::SetupBatched(
+   const FiniteElementSpace *c_fes)
+{
+   // The batched apply requires a single geometry (so that all local matrices
+   // have the same dimensions) and dofs without sign encoding; otherwise, and
+   // in purely serial runs, the per-element host loop in Mult() is kept.
+   batched = false;
+   if (!Device::Allows(Backend::DEVICE_MASK|Backend::OMP_MASK)) { return; }
+   Mesh::GeometryList elem_geoms(*fine_fes->GetMesh());
+   if (elem_geoms.Size() != 1) { return; }
+   batch_geom = elem_geoms[0];
+
+   const int nc = coarse_to_fine.Size();
+   const int ldof_c = localR[batch_geom].SizeI();
+   const int ldof_f = localR[batch_geom].SizeJ();
+
+   // Flatten coarse_to_fine and the localR slice indices used by each
+   // (coarse element, fine sub-element) pair.
+   c2f_offsets.SetSize(nc + 1);
+   c2f_offsets[0] = 0;
+   for (int el = 0; el < nc; el++)
+   {
+      c2f_offsets[el+1] = c2f_offsets[el] + coarse_to_fine.RowSize(el);
+   }
+   c2f_elems.SetSize(c2f_offsets[nc]);
+   lr_indices.SetSize(c2f_offsets[nc]);
+   for (int el = 0; el < nc; el++)
+   {
+      const int *row = coarse_to_fine.GetRow(el);
+      const int lR_offset =
+         ref_type_to_fine_elem_offset[coarse_to_ref_type[el]];
+      for (int s = 0; s < coarse_to_fine.RowSize(el); s++)
+      {
+         c2f_elems[c2f_offsets[el] + s] = row[s];
+         lr_indices[c2f_offsets[el] + s] = lR_offset + s;
+      }
+   }
+
+   // Fine element dofs in device-usable form.
+   const int ne_f = fine_fes->GetNE();
+   fine_elem_dof_b.SetSize(ne_f*ldof_f);
+   Array<int> dofs;
+   for (int e = 0; e < ne_f; e++)
+   {
+      fine_fes->GetElementDofs(e, dofs);
+      if (dofs.Size() != ldof_f) { return; }
+      for (int j = 0; j < ldof_f; j++)
+      {
+         if (dofs[j] < 0) { return; }
+         fine_elem_dof_b[e*ldof_f + j] = dofs[j];
+      }
+   }
+
+   // For each coarse dof, record the (coarse element, local dof) pair that
+   // determines its value -- the last writer in the host loop order.
+   coarse_dof_src.SetSize(height/fine_fes->GetVDim());
+   coarse_dof_src = -1;
+   for (int el = 0; el < nc; el++)
+   {
+      const int *cd = coarse_elem_dof->GetRow(el);
+      if (coarse_elem_dof->RowSize(el) != ldof_c) { return; }
+      for (int i = 0; i < ldof_c; i++)
+      {
+         if (cd[i] < 0) { return; }
+         coarse_dof_src[cd[i]] = el*ldof_c + i;
+      }
+   }
+
+   batched = true;
+}
+
+void FiniteElementSpace::DerefinementOperator::BatchedMult(
+   const Vector &x, Vector &y) const
+{
+   const int vdim = fine_fes->GetVDim();
+   const bool byvdim = fine_fes->GetOrdering() == Ordering::byVDIM;
+   const int c_ndofs = height/vdim;
+   const int f_ndofs = width/vdim;
+   const DenseTensor &lR = localR[batch_geom];
+   const int NDC = lR.SizeI(), NDF = lR.SizeJ(), VD = vdim;
+   const int nc = coarse_to_fine.Size();
+
+   // Project the fine patches into a coarse E-vector, ...
+   Vector e_c(nc*NDC*vdim);
+   e_c.UseDevice(true);
+   const auto lRd = Reshape(lR.Read(), NDC, NDF, lR.SizeK());
+   const auto off = c2f_offsets.Read();
+   const auto fels = c2f_elems.Read();
+   const auto lri = lr_indices.Read();
+   const auto fdof = fine_elem_dof_b.Read();
+   const auto X = x.Read();
+   auto E = Reshape(e_c.Write(), NDC, vdim, nc);
+   MFEM_FORALL(el, nc,
+   {
+      for (int vd = 0; vd < VD; vd++)
+      {
+         for (int i = 0; i < NDC; i++) { E(i, vd, el) = 0.0; }
+      }
+      for (int k = off[el]; k < off[el+1]; k++)
+      {
+         const int fe = fels[k], lr = lri[k];
+         for (int vd = 0; vd < VD; vd++)
+         {
+            for (int i = 0; i < NDC; i++)
+            {
+               double sum = 0.0;
+               for (int j = 0; j < NDF; j++)
+               {
+                  const int d = fdof[fe*NDF + j];
+                  sum += lRd(i,j,lr)*X[byvdim ? d*VD + vd : d + vd*f_ndofs];
+               }
+               E(i, vd, el) += sum;
+            }
+         }
+      }
+   });
+
+   // ... then place it in the coarse L-vector.
+   const auto src = coarse_dof_src.Read();
+   auto Y = y.Write();
+   MFEM_FORALL(i, c_ndofs,
+   {
+      const int s = src[i];
+      for (int vd = 0; vd < VD; vd++)
+      {
+         Y[byvdim ? i*VD + vd : i + vd*c_ndofs] =
+            (s < 0) ? 0.0 : E(s%NDC, vd, s/NDC);
+      }
+   });
+}
+
 void FiniteElementSpace::DerefinementOperator
 ::Mult(const Vector &x, Vector &y) const
 {
+   if (batched) { BatchedMult(x, y); return; }
+
    Array<int> c_vdofs, f_vdofs;
    Vector loc_x, loc_y;
    DenseMatrix loc_x_mat, loc_y_mat;
@@ -1534,6 +2167,7 @@ void FiniteElementSpace::Constructor(Mesh *mesh, NURBSExtension *NURBSext,
       UpdateNURBS();
       cP = cR = NULL;
       cP_is_set = false;
+      cP_op = NULL;
    }
    else
    {
@@ -1642,6 +2276,7 @@ void FiniteElementSpace::Construct()
    cP = NULL;
    cR = NULL;
    cP_is_set = false;
+   cP_op = NULL;
    // 'Th' is initialized/destroyed before this method is called.
 
    nvdofs = mesh->GetNV() * fec->DofForGeometry(Geometry::POINT);
@@ -2117,6 +2752,7 @@ FiniteElementSpace::~FiniteElementSpace()
 
 void FiniteElementSpace::Destroy()
 {
+   delete cP_op;
    delete cR;
    delete cP;
    Th.Clear();
@@ -2131,6 +2767,12 @@ void FiniteElementSpace::Destroy()
    {
       delete x.second;
    }
+   L2F.clear();
+   for (auto &x : L2E_geom)
+   {
+      delete x.second;
+   }
+   L2E_geom.clear();
    for (int i = 0; i < E2IFQ_array.Size(); i++)
    {
       delete E2IFQ_array[i];
@@ -2305,6 +2947,21 @@ void FiniteElementSpace::Update(bool want_transform)
    }
 }
 
+long FiniteElementSpace::MemoryUsage() const
+{
+   long mem = sizeof(*this);
+   if (elem_dof) { mem += elem_dof->MemoryUsage(); }
+   if (bdrElem_dof) { mem += bdrElem_dof->MemoryUsage(); }
+   if (face_dof) { mem += face_dof->MemoryUsage(); }
+   mem += face_to_be.MemoryUsage();
+   mem += dof_elem_array.MemoryUsage() + dof_ldof_array.MemoryUsage();
+   if (fdofs) { mem += (mesh->GetNFaces() + 1)*(long)sizeof(int); }
+   if (bdofs) { mem += (mesh->GetNE() + 1)*(long)sizeof(int); }
+   if (cP) { mem += cP->MemoryUsage(); }
+   if (cR) { mem += cR->MemoryUsage(); }
+   return mem;
+}
+
 void FiniteElementSpace::Save(std::ostream &out) const
 {
    int fes_format = 90; // the original format, v0.9
@@ -2744,7 +3401,8 @@ L2ProjectionGridTransfer::L2Projection::L2Projection(
    const FiniteElementSpace &fes_ho_, const FiniteElementSpace &fes_lor_)
    : Operator(fes_lor_.GetVSize(), fes_ho_.GetVSize()),
      fes_ho(fes_ho_),
-     fes_lor(fes_lor_)
+     fes_lor(fes_lor_),
+     batched(false), R_ho(NULL), R_lor(NULL)
 {
    Mesh *mesh_ho = fes_ho.GetMesh();
    MFEM_VERIFY(mesh_ho->GetNumGeometries(mesh_ho->Dimension()) <= 1,
@@ -2855,11 +3513,115 @@ L2ProjectionGridTransfer::L2Projection::L2Projection(
       RtMlorR_inv.Factor();
       RtMlorR_inv.Mult(RtMlor, P(iho));
    }
+
+   // Set up the batched apply path: the local projection/prolongation
+   // matrices are applied to all elements in one kernel and the results are
+   // moved with the element restrictions. This requires the E- and L-dofs to
+   // be in one-to-one correspondence, i.e. L2 spaces on both sides; other
+   // spaces, and purely serial runs where the per-element host loop in
+   // Mult()/Prolongate() is already efficient, are not affected.
+   if (!Device::Allows(Backend::DEVICE_MASK|Backend::OMP_MASK)) { return; }
+   const Operator *r_ho =
+      fes_ho.GetElementRestriction(ElementDofOrdering::NATIVE);
+   const Operator *r_lor =
+      fes_lor.GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (dynamic_cast<const L2ElementRestriction*>(r_ho) &&
+       dynamic_cast<const L2ElementRestriction*>(r_lor))
+   {
+      R_ho = r_ho;
+      R_lor = r_lor;
+      lor_map.SetSize(nel_ho*nref);
+      for (int iho = 0; iho < nel_ho; iho++)
+      {
+         for (int iref = 0; iref < nref; iref++)
+         {
+            lor_map[iho*nref + iref] = ho2lor.GetRow(iho)[iref];
+         }
+      }
+      e_ho.SetSize(R_ho->Height());
+      e_lor.SetSize(R_lor->Height());
+      e_ho.UseDevice(true);
+      e_lor.UseDevice(true);
+      batched = true;
+   }
+}
+
+void L2ProjectionGridTransfer::L2Projection::BatchedMult(
+   const Vector &x, Vector &y) const
+{
+   const int vdim = fes_ho.GetVDim();
+   const int nel_ho = fes_ho.GetNE();
+   R_ho->Mult(x, e_ho);
+   const auto X = Reshape(e_ho.Read(), ndof_ho, vdim, nel_ho);
+   const auto Rd = Reshape(R.Read(), ndof_lor*nref, ndof_ho, nel_ho);
+   const auto map = lor_map.Read();
+   auto Y = Reshape(e_lor.Write(), ndof_lor, vdim, fes_lor.GetNE());
+   const int NDHO = ndof_ho, NDLOR = ndof_lor, NREF = nref, VD = vdim;
+   MFEM_FORALL(iho, nel_ho,
+   {
+      for (int vd = 0; vd < VD; vd++)
+      {
+         for (int iref = 0; iref < NREF; iref++)
+         {
+            const int ilor = map[iho*NREF + iref];
+            for (int d = 0; d < NDLOR; d++) { Y(d, vd, ilor) = 0.0; }
+         }
+         for (int j = 0; j < NDHO; j++)
+         {
+            const double xj = X(j, vd, iho);
+            for (int iref = 0; iref < NREF; iref++)
+            {
+               const int ilor = map[iho*NREF + iref];
+               for (int d = 0; d < NDLOR; d++)
+               {
+                  Y(d, vd, ilor) += Rd(iref*NDLOR + d, j, iho)*xj;
+               }
+            }
+         }
+      }
+   });
+   R_lor->MultTranspose(e_lor, y);
+}
+
+void L2ProjectionGridTransfer::L2Projection::BatchedProlongate(
+   const Vector &x, Vector &y) const
+{
+   const int vdim = fes_ho.GetVDim();
+   const int nel_ho = fes_ho.GetNE();
+   R_lor->Mult(x, e_lor);
+   const auto X = Reshape(e_lor.Read(), ndof_lor, vdim, fes_lor.GetNE());
+   const auto Pd = Reshape(P.Read(), ndof_ho, ndof_lor*nref, nel_ho);
+   const auto map = lor_map.Read();
+   auto Y = Reshape(e_ho.Write(), ndof_ho, vdim, nel_ho);
+   const int NDHO = ndof_ho, NDLOR = ndof_lor, NREF = nref, VD = vdim;
+   MFEM_FORALL(iho, nel_ho,
+   {
+      for (int vd = 0; vd < VD; vd++)
+      {
+         for (int i = 0; i < NDHO; i++) { Y(i, vd, iho) = 0.0; }
+         for (int iref = 0; iref < NREF; iref++)
+         {
+            const int ilor = map[iho*NREF + iref];
+            for (int d = 0; d < NDLOR; d++)
+            {
+               const double xv = X(d, vd, ilor);
+               const int c = iref*NDLOR + d;
+               for (int i = 0; i < NDHO; i++)
+               {
+                  Y(i, vd, iho) += Pd(i, c, iho)*xv;
+               }
+            }
+         }
+      }
+   });
+   R_ho->MultTranspose(e_ho, y);
 }
 
 void L2ProjectionGridTransfer::L2Projection::Mult(
    const Vector &x, Vector &y) const
 {
+   if (batched) { BatchedMult(x, y); return; }
+
    int vdim = fes_ho.GetVDim();
    Array<int> vdofs;
    DenseMatrix xel_mat(ndof_ho, vdim);
@@ -2886,6 +3648,8 @@ void L2ProjectionGridTransfer::L2Projection::Mult(
 void L2ProjectionGridTransfer::L2Projection::Prolongate(
    const Vector &x, Vector &y) const
 {
+   if (batched) { BatchedProlongate(x, y); return; }
+
    int vdim = fes_ho.GetVDim();
    Array<int> vdofs;
    DenseMatrix xel_mat(ndof_lor*nref, vdim);
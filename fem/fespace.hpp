@@ -82,6 +82,45 @@ class QuadratureInterpolator;
 class FaceQuadratureInterpolator;
 
 
+/** @brief Matrix-free application of the conforming prolongation and
+    restriction of a nonconforming space, see
+    FiniteElementSpace::GetProlongationMatrix().
+
+    The rows of the conforming prolongation matrix split into identity rows,
+    one per true (unconstrained) dof, and a typically small set of constrained
+    dof rows coupling slave dofs to their masters. The identity rows are
+    applied as plain device copies and only the constrained rows go through a
+    compact CSR product; a transposed copy of the constrained block makes
+    MultTranspose() race-free without atomics. */
+class NCProlongationOperator : public Operator
+{
+public:
+   /** @brief Construct from the conforming prolongation @a cP and restriction
+       @a cR of a FiniteElementSpace; @a cP must stay alive as long as the
+       operator, see GetMatrix(). */
+   NCProlongationOperator(const SparseMatrix &cP, const SparseMatrix &cR);
+
+   virtual void Mult(const Vector &x, Vector &y) const;
+   virtual void MultTranspose(const Vector &x, Vector &y) const;
+
+   /// Computes y = |P|^t x, entry-wise absolute values of the prolongation.
+   void AbsMultTranspose(const Vector &x, Vector &y) const;
+
+   /// Access the underlying conforming prolongation matrix.
+   const SparseMatrix &GetMatrix() const { return P_mat; }
+
+private:
+   const SparseMatrix &P_mat; ///< The wrapped prolongation; not owned.
+   Array<int> conf_ldof; ///< Local dof of each true dof (the identity rows).
+   /// The constrained dof rows of #P_mat, in CSR form over true dof columns.
+   Array<int> dep_ldof, dep_ptr, dep_col;
+   Vector dep_val;
+   /// Transpose of the constrained block, with one row per true dof.
+   Array<int> dept_ptr, dept_ldof;
+   Vector dept_val;
+};
+
+
 /** @brief Class FiniteElementSpace - responsible for providing FEM view of the
     mesh, mainly managing the set of degrees of freedom. */
 class FiniteElementSpace
@@ -127,6 +166,8 @@ protected:
    /// Conforming restriction matrix such that cR.cP=I.
    mutable SparseMatrix *cR; // owned
    mutable bool cP_is_set;
+   /// Matrix-free form of #cP, see GetProlongationMatrix(). Owned.
+   mutable NCProlongationOperator *cP_op;
 
    /// Transformation to apply to GridFunctions after space Update().
    OperatorHandle Th;
@@ -148,6 +189,19 @@ protected:
    using map_L2F = std::unordered_map<const key_face,Operator*,key_hash>;
    mutable map_L2F L2F;
 
+   /** The per-geometry element restriction operators used on mixed meshes,
+       see GetElementRestriction(ElementDofOrdering, Geometry::Type). */
+   using key_elem = std::pair<ElementDofOrdering, Geometry::Type>;
+   struct key_elem_hash
+   {
+      std::size_t operator()(const key_elem& k) const
+      {
+         return (int)k.first + 2 * (int)k.second;
+      }
+   };
+   using map_L2E = std::unordered_map<const key_elem,Operator*,key_elem_hash>;
+   mutable map_L2E L2E_geom;
+
    mutable Array<QuadratureInterpolator*> E2Q_array;
    mutable Array<FaceQuadratureInterpolator*> E2IFQ_array;
    mutable Array<FaceQuadratureInterpolator*> E2BFQ_array;
@@ -202,8 +256,28 @@ protected:
    {
       const FiniteElementSpace* fespace;
       DenseTensor localP[Geometry::NumGeom];
+      // Flags the local matrices that are identities, i.e. correspond to
+      // elements left untouched by the refinement; for those the dense
+      // local products in Mult()/MultTranspose() reduce to dof copies.
+      Array<bool> localP_id[Geometry::NumGeom];
       Table* old_elem_dof; // Owned.
 
+      void FlagIdentityMatrices();
+
+      /// Batched apply path, set up in the constructor.
+      bool batched;
+      Geometry::Type batch_geom; ///< the single mesh geometry
+      Array<int> emb_parent, emb_matrix; ///< embeddings in device form
+      Array<int> fine_elem_dof_b;   ///< fine element dofs, flattened
+      Array<int> coarse_elem_dof_b; ///< coarse element dofs, flattened
+      Array<int> fine_dof_src;  ///< (fine el, local dof) writing each fine dof
+      Array<int> fine_dof_fst;  ///< first (fine el, local dof) of each fine dof
+      Array<int> ct_offsets, ct_src; ///< (fine el, local dof)s of a coarse dof
+
+      void SetupBatched();
+      void BatchedMult(const Vector &x, Vector &y) const;
+      void BatchedMultTranspose(const Vector &x, Vector &y) const;
+
    public:
       /** Construct the operator based on the elem_dof table of the original
           (coarse) space. The class takes ownership of the table. */
@@ -227,6 +301,17 @@ protected:
       Array<Geometry::Type> ref_type_to_geom;
       Array<int> ref_type_to_fine_elem_offset;
 
+      /// Batched apply path, set up in the constructor.
+      bool batched;
+      Geometry::Type batch_geom; ///< the single mesh geometry
+      Array<int> c2f_offsets, c2f_elems; ///< coarse_to_fine in device form
+      Array<int> lr_indices; ///< localR slice for each fine element slot
+      Array<int> fine_elem_dof_b; ///< fine element dofs, flattened
+      Array<int> coarse_dof_src; ///< (coarse el, local dof) writing each dof
+
+      void SetupBatched(const FiniteElementSpace *c_fes);
+      void BatchedMult(const Vector &x, Vector &y) const;
+
    public:
       DerefinementOperator(const FiniteElementSpace *f_fes,
                            const FiniteElementSpace *c_fes,
@@ -326,9 +411,11 @@ public:
    /// The returned SparseMatrix is owned by the FiniteElementSpace.
    const SparseMatrix *GetConformingRestriction() const;
 
-   /// The returned Operator is owned by the FiniteElementSpace.
-   virtual const Operator *GetProlongationMatrix() const
-   { return GetConformingProlongation(); }
+   /** @brief The returned Operator is owned by the FiniteElementSpace.
+
+       On a nonconforming mesh this is a matrix-free NCProlongationOperator
+       applying the conforming interpolation #cP; NULL on conforming meshes. */
+   virtual const Operator *GetProlongationMatrix() const;
 
    /// The returned SparseMatrix is owned by the FiniteElementSpace.
    virtual const SparseMatrix *GetRestrictionMatrix() const
@@ -350,9 +437,33 @@ public:
        permutation of the degrees of freedom, implemented by the
        L2ElementRestriction class.
 
+       On mixed meshes there is no uniform E-vector and NULL is returned: use
+       the per-geometry restrictions returned by
+       GetElementRestriction(ElementDofOrdering, Geometry::Type) instead.
+
        The returned Operator is owned by the FiniteElementSpace. */
    const Operator *GetElementRestriction(ElementDofOrdering e_ordering) const;
 
+   /** @brief Returns true if the E-vector produced by GetElementRestriction()
+       coincides with the L-vector, i.e. the element restriction is the
+       identity and the E-vector transfers can be skipped. */
+   /** Discontinuous (L2) spaces with a single vector component number their
+       DOFs element by element at construction and, for tensor product
+       elements, already in the lexicographic order expected by the
+       sum-factorized kernels, so the partial assembly apply paths can work on
+       the L-vectors directly. */
+   bool IsElementRestrictionIdentity() const;
+
+   /** @brief Return an Operator that converts L-vectors to the E-vector of
+       the subset of mesh elements with geometry type @a geom. */
+   /** On mixed meshes, the restrictions of the geometry types present in the
+       mesh partition the elements into batches with a uniform number of dofs
+       per element, see GeometryElementRestriction.
+
+       The returned Operator is owned by the FiniteElementSpace. */
+   const Operator *GetElementRestriction(ElementDofOrdering e_ordering,
+                                         Geometry::Type geom) const;
+
    /// Return an Operator that converts L-vectors to E-vectors on each face.
    virtual const Operator *GetFaceRestriction(
       ElementDofOrdering e_ordering, FaceType,
@@ -469,6 +580,11 @@ public:
    ElementTransformation *GetBdrElementTransformation(int i) const
    { return mesh->GetBdrElementTransformation(i); }
 
+   /** @brief Returns the transformation defining the @a i-th boundary element
+       in the user-defined variable @a ElTr. */
+   void GetBdrElementTransformation(int i, IsoparametricTransformation *ElTr)
+   { mesh->GetBdrElementTransformation(i, ElTr); }
+
    int GetAttribute(int i) const { return mesh->GetAttribute(i); }
 
    int GetBdrAttribute(int i) const { return mesh->GetBdrAttribute(i); }
@@ -504,6 +620,16 @@ public:
 
    int DofToVDof(int dof, int vd, int ndofs = -1) const;
 
+   /** @brief Reorder the vdof Vector @a x from Ordering::byNODES layout into
+       Ordering::byVDIM layout in @a y.
+
+       Both vectors must have size GetVSize(). The transform runs on the
+       device when the vectors reside there. */
+   void ConvertByNodesToByVDim(const Vector &x, Vector &y) const;
+
+   /// Inverse of ConvertByNodesToByVDim().
+   void ConvertByVDimToByNodes(const Vector &x, Vector &y) const;
+
    int VDofToDof(int vdof) const
    { return (ordering == Ordering::byNODES) ? (vdof%ndofs) : (vdof/vdim); }
 
@@ -706,6 +832,9 @@ public:
    /// Return update counter (see Mesh::sequence)
    long GetSequence() const { return sequence; }
 
+   /// Return the memory used by the internal tables and arrays, in bytes.
+   long MemoryUsage() const;
+
    /// Return whether or not the space is discontinuous (L2)
    bool IsDGSpace() const
    {
@@ -938,6 +1067,15 @@ protected:
 
       DenseTensor R, P;
 
+      /// Batched apply path, set up for L2 spaces in the constructor.
+      bool batched;
+      const Operator *R_ho, *R_lor; ///< Element restrictions, not owned
+      Array<int> lor_map; ///< ho2lor connections in device-usable form
+      mutable Vector e_ho, e_lor; ///< E-vector work arrays
+
+      void BatchedMult(const Vector &x, Vector &y) const;
+      void BatchedProlongate(const Vector &x, Vector &y) const;
+
    public:
       L2Projection(const FiniteElementSpace &fes_ho_,
                    const FiniteElementSpace &fes_lor_);
@@ -12,10 +12,18 @@
 // Implementation of GridFunction
 
 #include "gridfunc.hpp"
+#include "quadinterpolator.hpp"
+#include "../linalg/kernels.hpp"
 #include "../mesh/nurbs.hpp"
+#include "../general/binaryio.hpp"
 #include "../general/text.hpp"
+#include "../general/forall.hpp"
 
 #include <limits>
+#include <cstdint>
+#ifdef MFEM_USE_ZLIB
+#include <zlib.h>
+#endif
 #include <cstring>
 #include <string>
 #include <cmath>
@@ -54,6 +62,27 @@ GridFunction::GridFunction(Mesh *m, std::istream &input)
          MFEM_ABORT("unknown section: " << buff);
       }
    }
+   else if (next_char == 'B') // First letter of "BinaryData"
+   {
+      string buff;
+      getline(input, buff);
+      filter_dos(buff);
+      MFEM_VERIFY(buff == "BinaryData", "unknown section: " << buff);
+      const std::int64_t size = bin_io::read<std::int64_t>(input);
+      MFEM_VERIFY(size == fes->GetVSize(),
+                  "binary data size mismatch: " << size << " != "
+                  << fes->GetVSize());
+      SetSize(fes->GetVSize());
+      input.read((char*)HostWrite(), (size_t)size*sizeof(double));
+   }
+   else if (next_char == 'L') // First letter of "LossyData"
+   {
+      string buff;
+      getline(input, buff);
+      filter_dos(buff);
+      MFEM_VERIFY(buff == "LossyData", "unknown section: " << buff);
+      LoadLossy(input);
+   }
    else
    {
       Vector::Load(input, fes->GetVSize());
@@ -333,6 +362,25 @@ void GridFunction::GetTrueDofs(Vector &tv) const
    }
 }
 
+void GridFunction::GetComponent(int vd, Vector &comp)
+{
+   const int nd = fes->GetNDofs(), vdim = fes->GetVDim();
+   MFEM_ASSERT(vd >= 0 && vd < vdim, "invalid component index: " << vd);
+   if (vdim == 1 || fes->GetOrdering() == Ordering::byNODES)
+   {
+      // the component is a contiguous block -> make comp a reference into
+      // the data of *this
+      comp.MakeRef(*this, vd*nd, nd);
+   }
+   else
+   {
+      comp.SetSize(nd);
+      const auto d_x = Reshape(this->Read(), vdim, nd);
+      auto d_c = comp.Write();
+      MFEM_FORALL(i, nd, { d_c[i] = d_x(vd, i); });
+   }
+}
+
 void GridFunction::SetFromTrueDofs(const Vector &tv)
 {
    MFEM_ASSERT(tv.Size() == fes->GetTrueVSize(), "invalid input");
@@ -391,7 +439,7 @@ void GridFunction::GetNodalValues(int i, Array<double> &nval, int vdim) const
 double GridFunction::GetValue(int i, const IntegrationPoint &ip, int vdim)
 const
 {
-   Array<int> dofs;
+   SmallArray<int,64> dofs;
    fes->GetElementDofs(i, dofs);
    fes->DofsToVDofs(vdim-1, dofs);
    Vector DofVal(dofs.Size()), LocVec;
@@ -402,9 +450,12 @@ const
    }
    else
    {
-      ElementTransformation *Tr = fes->GetElementTransformation(i);
-      Tr->SetIntPoint(&ip);
-      fe->CalcPhysShape(*Tr, DofVal);
+      // use a caller-owned transformation so concurrent evaluations from
+      // different threads do not race on the shared mesh objects
+      IsoparametricTransformation Tr;
+      fes->GetElementTransformation(i, &Tr);
+      Tr.SetIntPoint(&ip);
+      fe->CalcPhysShape(Tr, DofVal);
    }
    GetSubVector(dofs, LocVec);
 
@@ -416,7 +467,7 @@ void GridFunction::GetVectorValue(int i, const IntegrationPoint &ip,
 {
    const FiniteElement *FElem = fes->GetFE(i);
    int dof = FElem->GetDof();
-   Array<int> vdofs;
+   SmallArray<int,64> vdofs;
    fes->GetElementVDofs(i, vdofs);
    Vector loc_data;
    GetSubVector(vdofs, loc_data);
@@ -429,9 +480,10 @@ void GridFunction::GetVectorValue(int i, const IntegrationPoint &ip,
       }
       else
       {
-         ElementTransformation *Tr = fes->GetElementTransformation(i);
-         Tr->SetIntPoint(&ip);
-         FElem->CalcPhysShape(*Tr, shape);
+         IsoparametricTransformation Tr;
+         fes->GetElementTransformation(i, &Tr);
+         Tr.SetIntPoint(&ip);
+         FElem->CalcPhysShape(Tr, shape);
       }
       int vdim = fes->GetVDim();
       val.SetSize(vdim);
@@ -444,9 +496,10 @@ void GridFunction::GetVectorValue(int i, const IntegrationPoint &ip,
    {
       int spaceDim = fes->GetMesh()->SpaceDimension();
       DenseMatrix vshape(dof, spaceDim);
-      ElementTransformation *Tr = fes->GetElementTransformation(i);
-      Tr->SetIntPoint(&ip);
-      FElem->CalcVShape(*Tr, vshape);
+      IsoparametricTransformation Tr;
+      fes->GetElementTransformation(i, &Tr);
+      Tr.SetIntPoint(&ip);
+      FElem->CalcVShape(Tr, vshape);
       val.SetSize(spaceDim);
       vshape.MultTranspose(loc_data, val);
    }
@@ -478,13 +531,134 @@ void GridFunction::GetValues(int i, const IntegrationRule &ir, Vector &vals,
                              DenseMatrix &tr, int vdim)
 const
 {
-   ElementTransformation *ET;
-   ET = fes->GetElementTransformation(i);
-   ET->Transform(ir, tr);
+   IsoparametricTransformation ET;
+   fes->GetElementTransformation(i, &ET);
+   ET.Transform(ir, tr);
 
    GetValues(i, ir, vals, vdim);
 }
 
+// Sort the indices 0..n-1 of elem_ids so that equal element ids become
+// contiguous; used by the batch GetValues/GetVectorValues methods below.
+static void SortPointsByElement(const Array<int> &elem_ids, Array<int> &perm)
+{
+   const int npts = elem_ids.Size();
+   perm.SetSize(npts);
+   for (int k = 0; k < npts; k++) { perm[k] = k; }
+   const int *eid = elem_ids.GetData();
+   std::sort(perm.begin(), perm.end(),
+             [eid](int a, int b) { return eid[a] < eid[b]; });
+}
+
+void GridFunction::GetValues(const Array<int> &elem_ids,
+                             const Array<IntegrationPoint> &ips, Vector &vals,
+                             int vdim) const
+{
+   const int npts = elem_ids.Size();
+   MFEM_VERIFY(ips.Size() == npts, "mismatched input array sizes");
+   vals.SetSize(npts);
+
+   Array<int> perm;
+   SortPointsByElement(elem_ids, perm);
+
+   Array<int> dofs;
+   Vector DofVal, loc_data;
+   int k = 0;
+   // skip the points that were not found (negative element index)
+   for (; k < npts && elem_ids[perm[k]] < 0; k++) { vals(perm[k]) = 0.0; }
+   while (k < npts)
+   {
+      const int el = elem_ids[perm[k]];
+      fes->GetElementDofs(el, dofs);
+      fes->DofsToVDofs(vdim-1, dofs);
+      const FiniteElement *fe = fes->GetFE(el);
+      DofVal.SetSize(fe->GetDof());
+      GetSubVector(dofs, loc_data);
+      if (fe->GetMapType() == FiniteElement::VALUE)
+      {
+         for (; k < npts && elem_ids[perm[k]] == el; k++)
+         {
+            fe->CalcShape(ips[perm[k]], DofVal);
+            vals(perm[k]) = DofVal * loc_data;
+         }
+      }
+      else
+      {
+         ElementTransformation *Tr = fes->GetElementTransformation(el);
+         for (; k < npts && elem_ids[perm[k]] == el; k++)
+         {
+            Tr->SetIntPoint(&ips[perm[k]]);
+            fe->CalcPhysShape(*Tr, DofVal);
+            vals(perm[k]) = DofVal * loc_data;
+         }
+      }
+   }
+}
+
+void GridFunction::GetVectorValues(const Array<int> &elem_ids,
+                                   const Array<IntegrationPoint> &ips,
+                                   DenseMatrix &vals) const
+{
+   const int npts = elem_ids.Size();
+   MFEM_VERIFY(ips.Size() == npts, "mismatched input array sizes");
+   const int vdim = VectorDim();
+   vals.SetSize(vdim, npts);
+
+   Array<int> perm;
+   SortPointsByElement(elem_ids, perm);
+
+   Array<int> vdofs;
+   Vector shape, loc_data;
+   DenseMatrix vshape;
+   int k = 0;
+   for (; k < npts && elem_ids[perm[k]] < 0; k++)
+   {
+      for (int d = 0; d < vdim; d++) { vals(d, perm[k]) = 0.0; }
+   }
+   while (k < npts)
+   {
+      const int el = elem_ids[perm[k]];
+      const FiniteElement *fe = fes->GetFE(el);
+      const int dof = fe->GetDof();
+      fes->GetElementVDofs(el, vdofs);
+      GetSubVector(vdofs, loc_data);
+      if (fe->GetRangeType() == FiniteElement::SCALAR)
+      {
+         shape.SetSize(dof);
+         ElementTransformation *Tr =
+            (fe->GetMapType() == FiniteElement::VALUE) ? NULL :
+            fes->GetElementTransformation(el);
+         for (; k < npts && elem_ids[perm[k]] == el; k++)
+         {
+            if (Tr == NULL)
+            {
+               fe->CalcShape(ips[perm[k]], shape);
+            }
+            else
+            {
+               Tr->SetIntPoint(&ips[perm[k]]);
+               fe->CalcPhysShape(*Tr, shape);
+            }
+            for (int d = 0; d < vdim; d++)
+            {
+               vals(d, perm[k]) = shape * ((const double *)loc_data + dof*d);
+            }
+         }
+      }
+      else
+      {
+         vshape.SetSize(dof, vdim);
+         ElementTransformation *Tr = fes->GetElementTransformation(el);
+         for (; k < npts && elem_ids[perm[k]] == el; k++)
+         {
+            Tr->SetIntPoint(&ips[perm[k]]);
+            fe->CalcVShape(*Tr, vshape);
+            vshape.MultTranspose(loc_data.GetData(), &vals(0, perm[k]));
+         }
+      }
+   }
+}
+
 void GridFunction::GetLaplacians(int i, const IntegrationRule &ir, Vector &laps,
                                  int vdim)
 const
@@ -2249,12 +2423,99 @@ void GridFunction::ProjectDeltaCoefficient(DeltaCoefficient &delta_coeff,
    }
 }
 
+/** Batched nodal projection engine: evaluate the coefficient at the nodal
+    points of every element in one kernel and scatter the element values with
+    the transpose element restriction, averaging the contributions on shared
+    dofs (they agree for continuous coefficients). Supported for spaces built
+    on a single nodal element type with the VALUE map type, and for
+    coefficients that can be evaluated in batch - Batched(Vector)Coefficient
+    and (vector) constants. Returns false otherwise, in which case the caller
+    falls back to the per-element host projection. */
+static bool BatchedProjectCoefficient(FiniteElementSpace &fes,
+                                      Coefficient *Q, VectorCoefficient *VQ,
+                                      Vector &x)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int ne = fes.GetNE(), dim = mesh->Dimension();
+   if (ne == 0 || (dim != 2 && dim != 3)) { return false; }
+   if (mesh->GetNumGeometries(dim) > 1) { return false; }
+   const FiniteElement *fe = fes.GetFE(0);
+   if (dynamic_cast<const NodalFiniteElement*>(fe) == NULL ||
+       fe->GetMapType() != FiniteElement::VALUE)
+   {
+      return false;
+   }
+   const int vdim = fes.GetVDim();
+   const int nd = fe->GetDof();
+   const IntegrationRule &nodes = fe->GetNodes();
+   // The generic quadrature interpolator used to compute the nodal
+   // coordinates has fixed size limits.
+   const int max_nd = (dim == 2) ? QuadratureInterpolator::MAX_ND2D
+                      : QuadratureInterpolator::MAX_ND3D;
+   Vector e_vals;
+   if (Q)
+   {
+      if (vdim != 1) { return false; }
+      if (BatchedCoefficient *bQ = dynamic_cast<BatchedCoefficient*>(Q))
+      {
+         if (nd > max_nd) { return false; }
+         bQ->Eval(*mesh, nodes, e_vals);
+      }
+      else if (ConstantCoefficient *cQ =
+                  dynamic_cast<ConstantCoefficient*>(Q))
+      {
+         e_vals.SetSize(nd*ne);
+         e_vals = cQ->constant;
+      }
+      else { return false; }
+   }
+   else
+   {
+      if (VQ->GetVDim() != vdim) { return false; }
+      if (BatchedVectorCoefficient *bVQ =
+             dynamic_cast<BatchedVectorCoefficient*>(VQ))
+      {
+         if (nd > max_nd) { return false; }
+         bVQ->Eval(*mesh, nodes, e_vals);
+      }
+      else if (VectorConstantCoefficient *cVQ =
+                  dynamic_cast<VectorConstantCoefficient*>(VQ))
+      {
+         e_vals.SetSize(nd*vdim*ne);
+         Vector vc(cVQ->GetVec());
+         const auto cv = vc.Read();
+         auto V = Reshape(e_vals.Write(), nd, vdim, ne);
+         const int ND = nd, VD = vdim;
+         MFEM_FORALL(i, ne*nd,
+         {
+            const int e = i/ND, d = i%ND;
+            for (int c = 0; c < VD; c++) { V(d,c,e) = cv[c]; }
+         });
+      }
+      else { return false; }
+   }
+   const Operator *R =
+      fes.GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (R == NULL || R->Height() != nd*vdim*ne) { return false; }
+   R->MultTranspose(e_vals, x);
+   // Divide by the dof multiplicities (all one for L2 spaces).
+   Vector ones(R->Height()), counts(x.Size());
+   ones = 1.0;
+   R->MultTranspose(ones, counts);
+   const auto c = counts.Read();
+   auto d = x.ReadWrite();
+   MFEM_FORALL(i, x.Size(), { if (c[i] != 0.0) { d[i] /= c[i]; } });
+   return true;
+}
+
 void GridFunction::ProjectCoefficient(Coefficient &coeff)
 {
    DeltaCoefficient *delta_c = dynamic_cast<DeltaCoefficient *>(&coeff);
 
    if (delta_c == NULL)
    {
+      if (BatchedProjectCoefficient(*fes, &coeff, NULL, *this)) { return; }
+
       Array<int> vdofs;
       Vector vals;
 
@@ -2304,6 +2565,8 @@ void GridFunction::ProjectCoefficient(
 
 void GridFunction::ProjectCoefficient(VectorCoefficient &vcoeff)
 {
+   if (BatchedProjectCoefficient(*fes, NULL, &vcoeff, *this)) { return; }
+
    int i;
    Array<int> vdofs;
    Vector vals;
@@ -2564,6 +2827,222 @@ void GridFunction::ProjectBdrCoefficientTangent(
 #endif
 }
 
+/** @brief Batched L2 error evaluation: restrict @a x to an E-vector,
+    interpolate it at the quadrature points with the QuadratureInterpolator,
+    evaluate the exact solution with the batched Coefficient::Eval, and
+    accumulate the weighted square error with a single device dot product. */
+/** The square of the error (which can be negative with negative quadrature
+    weights) is returned in @a error. Returns false when the batched kernels
+    do not apply (1D, mixed, NURBS, or embedded surface meshes, vector finite
+    elements, or elements beyond the QuadratureInterpolator size limits) and
+    the caller should use the per-point host loop instead. */
+static bool BatchedL2Error(const GridFunction &x, Coefficient *exsol,
+                           VectorCoefficient *vexsol,
+                           const IntegrationRule *irs[], double &error)
+{
+   const FiniteElementSpace *fes = x.FESpace();
+   Mesh *mesh = fes->GetMesh();
+   const int NE = fes->GetNE();
+   if (NE == 0) { error = 0.0; return true; }
+   const int dim = mesh->Dimension();
+   if (dim < 2 || dim != mesh->SpaceDimension() ||
+       mesh->GetNumGeometries(dim) != 1 || fes->GetNURBSext())
+   {
+      return false;
+   }
+   const FiniteElement *fe = fes->GetFE(0);
+   const int vdim = fes->GetVDim();
+   if (fe->GetRangeType() != FiniteElement::SCALAR ||
+       (exsol && vdim != 1) || (vexsol && vexsol->GetVDim() != vdim))
+   {
+      return false;
+   }
+   const IntegrationRule *ir;
+   if (irs)
+   {
+      ir = irs[fe->GetGeomType()];
+   }
+   else
+   {
+      const int intorder = 2*fe->GetOrder() + 3; // <----------
+      ir = &(IntRules.Get(fe->GetGeomType(), intorder));
+   }
+   const int ND = fe->GetDof();
+   const int NQ = ir->GetNPoints();
+   typedef QuadratureInterpolator QI;
+   if (dim == 2 && (ND > QI::MAX_ND2D || NQ > QI::MAX_NQ2D ||
+                    vdim > QI::MAX_VDIM2D)) { return false; }
+   if (dim == 3 && (ND > QI::MAX_ND3D || NQ > QI::MAX_NQ3D ||
+                    vdim > QI::MAX_VDIM3D)) { return false; }
+   const Operator *elem_restr =
+      fes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (elem_restr == NULL) { return false; }
+
+   Vector e_vec(ND*vdim*NE);
+   e_vec.UseDevice(true);
+   elem_restr->Mult(x, e_vec);
+
+   const QuadratureInterpolator *qi = fes->GetQuadratureInterpolator(*ir);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   Vector q_val(NQ*vdim*NE);
+   q_val.UseDevice(true);
+   qi->Values(e_vec, q_val);
+
+   Vector q_ex;
+   q_ex.UseDevice(true);
+   if (exsol) { exsol->Eval(q_ex, *fes, *ir); }
+   else { vexsol->Eval(q_ex, *fes, *ir); }
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*ir, GeometricFactors::DETERMINANTS);
+
+   Vector diff(NQ*vdim*NE), wdiff(NQ*vdim*NE);
+   diff.UseDevice(true);
+   wdiff.UseDevice(true);
+   const int nq = NQ, vd = vdim;
+   const auto qw = ir->GetWeights().Read();
+   const auto detJ = Reshape(geom->detJ.Read(), NQ, NE);
+   const auto u = Reshape(q_val.Read(), NQ, vdim, NE);
+   const auto u_ex = Reshape(q_ex.Read(), NQ, vdim, NE);
+   auto d = Reshape(diff.Write(), NQ, vdim, NE);
+   auto wd = Reshape(wdiff.Write(), NQ, vdim, NE);
+   MFEM_FORALL(i, NE*NQ,
+   {
+      const int e = i / nq;
+      const int q = i % nq;
+      const double w = qw[q] * detJ(q,e);
+      for (int c = 0; c < vd; c++)
+      {
+         const double a = u(q,c,e) - u_ex(q,c,e);
+         d(q,c,e) = a;
+         wd(q,c,e) = w * a;
+      }
+   });
+   // the weighted square error reduces to one (device) dot product
+   error = diff * wdiff;
+   return true;
+}
+
+/** @brief Companion of BatchedL2Error() for ComputeGradError(): interpolate
+    the reference-space derivatives with the QuadratureInterpolator, map them
+    to physical space with the cached Jacobians, and accumulate the weighted
+    square error of the gradient with a single device dot product. */
+static bool BatchedGradError(const GridFunction &x, VectorCoefficient *exgrad,
+                             const IntegrationRule *irs[], double &error)
+{
+   const FiniteElementSpace *fes = x.FESpace();
+   Mesh *mesh = fes->GetMesh();
+   const int NE = fes->GetNE();
+   if (NE == 0) { error = 0.0; return true; }
+   const int dim = mesh->Dimension();
+   if (dim < 2 || dim != mesh->SpaceDimension() ||
+       mesh->GetNumGeometries(dim) != 1 || fes->GetNURBSext())
+   {
+      return false;
+   }
+   const FiniteElement *fe = fes->GetFE(0);
+   if (fe->GetRangeType() != FiniteElement::SCALAR ||
+       fes->GetVDim() != 1 || exgrad->GetVDim() != dim)
+   {
+      return false;
+   }
+   const IntegrationRule *ir;
+   if (irs)
+   {
+      ir = irs[fe->GetGeomType()];
+   }
+   else
+   {
+      const int intorder = 2*fe->GetOrder() + 3; // <--------
+      ir = &(IntRules.Get(fe->GetGeomType(), intorder));
+   }
+   const int ND = fe->GetDof();
+   const int NQ = ir->GetNPoints();
+   typedef QuadratureInterpolator QI;
+   if (dim == 2 && (ND > QI::MAX_ND2D || NQ > QI::MAX_NQ2D)) { return false; }
+   if (dim == 3 && (ND > QI::MAX_ND3D || NQ > QI::MAX_NQ3D)) { return false; }
+   const Operator *elem_restr =
+      fes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (elem_restr == NULL) { return false; }
+
+   Vector e_vec(ND*NE);
+   e_vec.UseDevice(true);
+   elem_restr->Mult(x, e_vec);
+
+   const QuadratureInterpolator *qi = fes->GetQuadratureInterpolator(*ir);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   Vector q_der(NQ*dim*NE), unused;
+   q_der.UseDevice(true);
+   qi->Mult(e_vec, QI::DERIVATIVES, unused, q_der, unused);
+
+   Vector q_ex;
+   q_ex.UseDevice(true);
+   exgrad->Eval(q_ex, *fes, *ir);
+
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS |
+                                GeometricFactors::DETERMINANTS);
+
+   Vector diff(NQ*dim*NE), wdiff(NQ*dim*NE);
+   diff.UseDevice(true);
+   wdiff.UseDevice(true);
+   const int nq = NQ;
+   const auto qw = ir->GetWeights().Read();
+   const auto J = Reshape(geom->J.Read(), NQ, dim, dim, NE);
+   const auto detJ = Reshape(geom->detJ.Read(), NQ, NE);
+   const auto du = Reshape(q_der.Read(), NQ, dim, NE);
+   const auto g_ex = Reshape(q_ex.Read(), NQ, dim, NE);
+   auto d = Reshape(diff.Write(), NQ, dim, NE);
+   auto wd = Reshape(wdiff.Write(), NQ, dim, NE);
+   if (dim == 2)
+   {
+      MFEM_FORALL(i, NE*NQ,
+      {
+         const int e = i / nq;
+         const int q = i % nq;
+         double Jloc[4], Jinv[4];
+         for (int c = 0; c < 2; c++)
+         {
+            for (int r = 0; r < 2; r++) { Jloc[r+c*2] = J(q,r,c,e); }
+         }
+         kernels::CalcInverse<2>(Jloc, Jinv);
+         const double w = qw[q] * detJ(q,e);
+         for (int r = 0; r < 2; r++)
+         {
+            const double a = Jinv[0+r*2]*du(q,0,e) + Jinv[1+r*2]*du(q,1,e)
+                             - g_ex(q,r,e);
+            d(q,r,e) = a;
+            wd(q,r,e) = w * a;
+         }
+      });
+   }
+   else // dim == 3
+   {
+      MFEM_FORALL(i, NE*NQ,
+      {
+         const int e = i / nq;
+         const int q = i % nq;
+         double Jloc[9], Jinv[9];
+         for (int c = 0; c < 3; c++)
+         {
+            for (int r = 0; r < 3; r++) { Jloc[r+c*3] = J(q,r,c,e); }
+         }
+         kernels::CalcInverse<3>(Jloc, Jinv);
+         const double w = qw[q] * detJ(q,e);
+         for (int r = 0; r < 3; r++)
+         {
+            const double a = Jinv[0+r*3]*du(q,0,e) + Jinv[1+r*3]*du(q,1,e)
+                             + Jinv[2+r*3]*du(q,2,e) - g_ex(q,r,e);
+            d(q,r,e) = a;
+            wd(q,r,e) = w * a;
+         }
+      });
+   }
+   // the weighted square error reduces to one (device) dot product
+   error = diff * wdiff;
+   return true;
+}
+
 double GridFunction::ComputeL2Error(
    Coefficient *exsol[], const IntegrationRule *irs[]) const
 {
@@ -2621,6 +3100,15 @@ double GridFunction::ComputeL2Error(
    VectorCoefficient &exsol, const IntegrationRule *irs[],
    Array<int> *elems) const
 {
+   if (elems == NULL)
+   {
+      double batch_error;
+      if (BatchedL2Error(*this, NULL, &exsol, irs, batch_error))
+      {
+         return (batch_error < 0.0) ? -sqrt(-batch_error) : sqrt(batch_error);
+      }
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -2661,6 +3149,12 @@ double GridFunction::ComputeL2Error(
 double GridFunction::ComputeGradError(VectorCoefficient *exgrad,
                                       const IntegrationRule *irs[]) const
 {
+   double batch_error;
+   if (BatchedGradError(*this, exgrad, irs, batch_error))
+   {
+      return (batch_error < 0.0) ? -sqrt(-batch_error) : sqrt(batch_error);
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *Tr;
@@ -3090,6 +3584,16 @@ double GridFunction::ComputeLpError(const double p, Coefficient &exsol,
                                     Coefficient *weight,
                                     const IntegrationRule *irs[]) const
 {
+   if (p == 2.0 && weight == NULL)
+   {
+      // this is the path taken by ComputeL2Error() and ConvergenceStudy
+      double batch_error;
+      if (BatchedL2Error(*this, &exsol, NULL, irs, batch_error))
+      {
+         return (batch_error < 0.0) ? -sqrt(-batch_error) : sqrt(batch_error);
+      }
+   }
+
    double error = 0.0;
    const FiniteElement *fe;
    ElementTransformation *T;
@@ -3439,6 +3943,114 @@ void GridFunction::Save(std::ostream &out) const
    out.flush();
 }
 
+void GridFunction::SaveBinary(std::ostream &out) const
+{
+   fes->Save(out);
+   out << '\n' << "BinaryData\n";
+   bin_io::write<std::int64_t>(out, Size());
+   out.write((const char*)HostRead(), (size_t)Size()*sizeof(double));
+   out.flush();
+}
+
+// Variable-length integer encoding used by the "LossyData" format: the
+// zigzag-mapped value is stored in groups of 7 bits, least significant
+// first, with the high bit of each byte marking a continuation.
+static void AppendVarInt(std::vector<char> &buf, std::int64_t value)
+{
+   std::uint64_t u = (std::uint64_t(value) << 1) ^
+                     std::uint64_t(value >> 63); // zigzag
+   do
+   {
+      unsigned char byte = u & 0x7f;
+      u >>= 7;
+      if (u) { byte |= 0x80; }
+      buf.push_back((char)byte);
+   }
+   while (u);
+}
+
+static bool ReadVarInt(const char *buf, size_t size, size_t &pos,
+                       std::int64_t &value)
+{
+   std::uint64_t u = 0;
+   int shift = 0;
+   while (pos < size)
+   {
+      const unsigned char byte = buf[pos++];
+      u |= std::uint64_t(byte & 0x7f) << shift;
+      if (!(byte & 0x80))
+      {
+         value = std::int64_t(u >> 1) ^ -std::int64_t(u & 1); // un-zigzag
+         return true;
+      }
+      shift += 7;
+      if (shift > 63) { break; }
+   }
+   return false;
+}
+
+void GridFunction::SaveLossy(std::ostream &out, double tol) const
+{
+   MFEM_VERIFY(tol > 0.0, "the error tolerance must be positive");
+   MFEM_VERIFY(fes->GetNURBSext() == NULL,
+               "not supported for NURBS patch-stored grid functions");
+
+   // Uniform scalar quantization with bin width 2*tol: the reconstruction
+   // q*w differs from the value by at most w/2 = tol. The quantized values
+   // of smooth high-order fields change slowly between neighboring dofs, so
+   // their consecutive differences are small and varint-encode compactly.
+   const double w = 2.0*tol;
+   const int size = Size();
+   const double *v = HostRead();
+   std::vector<char> buf;
+   buf.reserve(2*size);
+   std::int64_t prev = 0;
+   for (int i = 0; i < size; i++)
+   {
+      MFEM_VERIFY(std::abs(v[i]) < 4.0e18*w, "value too large for the "
+                  "tolerance: |" << v[i] << "| with tol = " << tol);
+      const std::int64_t q = (std::int64_t)llround(v[i]/w);
+      AppendVarInt(buf, q - prev);
+      prev = q;
+   }
+
+   fes->Save(out);
+   out << '\n' << "LossyData\n";
+   bin_io::write<std::int64_t>(out, size);
+   bin_io::write<double>(out, w);
+   bin_io::write<std::int64_t>(out, (std::int64_t)buf.size());
+   out.write(buf.data(), buf.size());
+   out.flush();
+}
+
+void GridFunction::LoadLossy(std::istream &input)
+{
+   const char *msg = "invalid LossyData section";
+   const std::int64_t size = bin_io::read<std::int64_t>(input);
+   MFEM_VERIFY(size == fes->GetVSize(),
+               "lossy data size mismatch: " << size << " != "
+               << fes->GetVSize());
+   const double w = bin_io::read<double>(input);
+   MFEM_VERIFY(w > 0.0, msg);
+   const std::int64_t nbytes = bin_io::read<std::int64_t>(input);
+   MFEM_VERIFY(nbytes >= 0, msg);
+   std::vector<char> buf(nbytes);
+   input.read(buf.data(), nbytes);
+   MFEM_VERIFY(input, msg);
+
+   SetSize(fes->GetVSize());
+   double *v = HostWrite();
+   size_t pos = 0;
+   std::int64_t q = 0, dq;
+   for (int i = 0; i < size; i++)
+   {
+      MFEM_VERIFY(ReadVarInt(buf.data(), buf.size(), pos, dq), msg);
+      q += dq;
+      v[i] = q*w;
+   }
+   MFEM_VERIFY(pos == buf.size(), msg);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void GridFunction::Save(adios2stream &out,
                         const std::string& variable_name,
@@ -3655,6 +4267,7 @@ QuadratureFunction::QuadratureFunction(Mesh *mesh, std::istream &in)
 
    qspace = new QuadratureSpace(mesh, in);
    own_qspace = true;
+   layout = Ordering::byVDIM;
 
    in >> ident; MFEM_VERIFY(ident == "VDim:", msg);
    in >> vdim;
@@ -3662,6 +4275,40 @@ QuadratureFunction::QuadratureFunction(Mesh *mesh, std::istream &in)
    Load(in, vdim*qspace->GetSize());
 }
 
+void QuadratureFunction::SetLayout(Ordering::Type layout_)
+{
+   if (layout_ == layout) { return; }
+   if (vdim > 1 && Size() > 0)
+   {
+      // transpose between point-major (byVDIM) and component-major (byNODES)
+      Vector old(*this);
+      const double *src = old.HostRead();
+      double *dst = HostWrite();
+      const int nq = qspace->GetSize();
+      if (layout_ == Ordering::byNODES)
+      {
+         for (int p = 0; p < nq; p++)
+         {
+            for (int c = 0; c < vdim; c++)
+            {
+               dst[c*nq + p] = src[p*vdim + c];
+            }
+         }
+      }
+      else
+      {
+         for (int p = 0; p < nq; p++)
+         {
+            for (int c = 0; c < vdim; c++)
+            {
+               dst[p*vdim + c] = src[c*nq + p];
+            }
+         }
+      }
+   }
+   layout = layout_;
+}
+
 QuadratureFunction & QuadratureFunction::operator=(double value)
 {
    Vector::operator=(value);
@@ -3677,6 +4324,7 @@ QuadratureFunction & QuadratureFunction::operator=(const Vector &v)
 
 QuadratureFunction & QuadratureFunction::operator=(const QuadratureFunction &v)
 {
+   MFEM_ASSERT(layout == v.layout, "incompatible data layouts");
    return this->operator=((const Vector &)v);
 }
 
@@ -3685,7 +4333,17 @@ void QuadratureFunction::Save(std::ostream &out) const
    qspace->Save(out);
    out << "VDim: " << vdim << '\n'
        << '\n';
-   Vector::Print(out, vdim);
+   if (layout == Ordering::byVDIM)
+   {
+      Vector::Print(out, vdim);
+   }
+   else
+   {
+      // the file format is point-major, independent of the data layout
+      QuadratureFunction qf(*this);
+      qf.SetLayout(Ordering::byVDIM);
+      qf.Vector::Print(out, vdim);
+   }
    out.flush();
 }
 
@@ -3696,6 +4354,182 @@ std::ostream &operator<<(std::ostream &out, const QuadratureFunction &qf)
 }
 
 
+/** Batched Zienkiewicz-Zhu estimate for the diffusion integrator: element
+    fluxes at the flux-space nodes, their averaging into the smoothed flux and
+    the element energy norms of the difference are each computed by one kernel
+    over all elements, reproducing the per-element host algorithm. Supported
+    for scalar u, an sdim-vector nodal flux space on a single-geometry mesh,
+    and a batch-evaluable (or absent) scalar diffusion coefficient; returns
+    false otherwise so the caller can fall back to the element loop. The
+    estimates are written through the device memory of @a error_estimates. */
+static bool BatchedZZErrorEstimator(BilinearFormIntegrator &blfi,
+                                    GridFunction &u, GridFunction &flux,
+                                    bool with_coeff, Vector &error_estimates,
+                                    double &total_error)
+{
+   DiffusionIntegrator *di = dynamic_cast<DiffusionIntegrator*>(&blfi);
+   if (di == NULL) { return false; }
+   if (di->GetVectorCoefficient() || di->GetMatrixCoefficient())
+   {
+      return false;
+   }
+   Coefficient *Q = di->GetCoefficient();
+   ConstantCoefficient *cQ = dynamic_cast<ConstantCoefficient*>(Q);
+   BatchedCoefficient *bQ = dynamic_cast<BatchedCoefficient*>(Q);
+   if (Q && !cQ && !bQ) { return false; }
+
+   FiniteElementSpace *ufes = u.FESpace(), *ffes = flux.FESpace();
+   Mesh *mesh = ufes->GetMesh();
+   const int dim = mesh->Dimension(), sdim = mesh->SpaceDimension();
+   const int ne = ufes->GetNE();
+   if (ne == 0 || dim != sdim || (dim != 2 && dim != 3)) { return false; }
+   if (mesh->GetNumGeometries(dim) > 1) { return false; }
+   if (ufes->GetVDim() != 1 || ffes->GetVDim() != sdim) { return false; }
+   const FiniteElement *ufe = ufes->GetFE(0), *ffe = ffes->GetFE(0);
+   if (dynamic_cast<const NodalFiniteElement*>(ufe) == NULL ||
+       dynamic_cast<const NodalFiniteElement*>(ffe) == NULL ||
+       ufe->GetMapType() != FiniteElement::VALUE ||
+       ffe->GetMapType() != FiniteElement::VALUE)
+   {
+      return false;
+   }
+
+   const IntegrationRule &irn = ffe->GetNodes();
+   const IntegrationRule &ir2 =
+      IntRules.Get(ffe->GetGeomType(), 2*ffe->GetOrder());
+   const int fnd = irn.GetNPoints(), nq2 = ir2.GetNPoints();
+   const int max_nd = (dim == 2) ? QuadratureInterpolator::MAX_ND2D
+                      : QuadratureInterpolator::MAX_ND3D;
+   const int max_nq = (dim == 2) ? QuadratureInterpolator::MAX_NQ2D
+                      : QuadratureInterpolator::MAX_NQ3D;
+   if (ufe->GetDof() > max_nd || ffe->GetDof() > max_nd ||
+       fnd > max_nq || nq2 > max_nq)
+   {
+      return false;
+   }
+
+   const Operator *Ru =
+      ufes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   const Operator *Rf =
+      ffes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   if (Ru == NULL || Rf == NULL) { return false; }
+
+   // Reference gradients of u at the flux-space nodes and the element
+   // Jacobians at the same points.
+   Vector ue(Ru->Height());
+   Ru->Mult(u, ue);
+   const QuadratureInterpolator *qi = ufes->GetQuadratureInterpolator(irn);
+   qi->SetOutputLayout(QVectorLayout::byNODES);
+   qi->DisableTensorProducts();
+   Vector du(fnd*dim*ne), unused_val, unused_det;
+   qi->Mult(ue, QuadratureInterpolator::DERIVATIVES,
+            unused_val, du, unused_det);
+   const GeometricFactors *geom_n =
+      mesh->GetGeometricFactors(irn, GeometricFactors::JACOBIANS);
+
+   Vector qn; // coefficient at flux nodes, only used with with_coeff
+   if (with_coeff && Q)
+   {
+      if (bQ) { bQ->Eval(*mesh, irn, qn); }
+      else { qn.SetSize(fnd*ne); qn = cQ->constant; }
+   }
+
+   // Element flux at the flux-space nodes: (k) J^{-T} grad_ref(u).
+   Vector fl(fnd*sdim*ne);
+   {
+      const auto DU = Reshape(du.Read(), fnd, 1, dim, ne);
+      const auto J = Reshape(geom_n->J.Read(), fnd, sdim, dim, ne);
+      auto FL = Reshape(fl.Write(), fnd, sdim, ne);
+      const bool use_q = with_coeff && Q;
+      const double *qd = use_q ? qn.Read() : NULL;
+      const int DIM = dim, FND = fnd;
+      MFEM_FORALL(idx, ne*fnd,
+      {
+         const int e = idx/FND, q = idx%FND;
+         double Jloc[9], Jinv[9], g[3], pf[3];
+         for (int c = 0; c < DIM; c++)
+         {
+            for (int d = 0; d < DIM; d++) { Jloc[c+DIM*d] = J(q,c,d,e); }
+         }
+         if (DIM == 2) { kernels::CalcInverse<2>(Jloc, Jinv); }
+         else { kernels::CalcInverse<3>(Jloc, Jinv); }
+         for (int d = 0; d < DIM; d++) { g[d] = DU(q,0,d,e); }
+         for (int c = 0; c < DIM; c++)
+         {
+            pf[c] = 0.0;
+            for (int d = 0; d < DIM; d++) { pf[c] += Jinv[d+DIM*c]*g[d]; }
+         }
+         const double k = use_q ? qd[q + FND*e] : 1.0;
+         for (int c = 0; c < DIM; c++) { FL(q,c,e) = k*pf[c]; }
+      });
+   }
+
+   // Average the element fluxes into the smoothed flux GridFunction.
+   Rf->MultTranspose(fl, flux);
+   {
+      Vector ones(Rf->Height()), counts(flux.Size());
+      ones = 1.0;
+      Rf->MultTranspose(ones, counts);
+      const auto c = counts.Read();
+      auto d = flux.ReadWrite();
+      MFEM_FORALL(i, flux.Size(), { if (c[i] != 0.0) { d[i] /= c[i]; } });
+   }
+
+   // Difference between the element and the smoothed fluxes.
+   Vector fla(Rf->Height());
+   Rf->Mult(flux, fla);
+   fl -= fla;
+
+   // Element energy norms of the difference.
+   const QuadratureInterpolator *qi2 = ffes->GetQuadratureInterpolator(ir2);
+   qi2->SetOutputLayout(QVectorLayout::byNODES);
+   qi2->DisableTensorProducts();
+   Vector vals(nq2*sdim*ne), unused_der;
+   qi2->Mult(fl, QuadratureInterpolator::VALUES,
+             vals, unused_der, unused_det);
+   const GeometricFactors *geom_2 =
+      mesh->GetGeometricFactors(ir2, GeometricFactors::DETERMINANTS);
+   Vector wq(nq2);
+   for (int q = 0; q < nq2; q++) { wq(q) = ir2.IntPoint(q).weight; }
+   Vector q2;
+   if (Q)
+   {
+      if (bQ) { bQ->Eval(*mesh, ir2, q2); }
+      else { q2.SetSize(nq2*ne); q2 = cQ->constant; }
+   }
+   error_estimates.SetSize(ne);
+   {
+      const auto V = Reshape(vals.Read(), nq2, sdim, ne);
+      const auto detJ = Reshape(geom_2->detJ.Read(), nq2, ne);
+      const auto W = wq.Read();
+      const double *qd = Q ? q2.Read() : NULL;
+      auto EST = error_estimates.Write();
+      const int DIM = dim, NQ = nq2;
+      MFEM_FORALL(e, ne,
+      {
+         double energy = 0.0;
+         for (int q = 0; q < NQ; q++)
+         {
+            double f2 = 0.0;
+            for (int c = 0; c < DIM; c++) { f2 += V(q,c,e)*V(q,c,e); }
+            const double k = qd ? qd[q + NQ*e] : 1.0;
+            energy += detJ(q,e)*W[q]*k*f2;
+         }
+         EST[e] = energy;
+      });
+   }
+   total_error = 0.0;
+   {
+      const double *est = error_estimates.HostRead();
+      for (int i = 0; i < ne; i++) { total_error += est[i]; }
+   }
+   {
+      auto EST = error_estimates.ReadWrite();
+      MFEM_FORALL(i, ne, { EST[i] = sqrt(EST[i]); });
+   }
+   return true;
+}
+
 double ZZErrorEstimator(BilinearFormIntegrator &blfi,
                         GridFunction &u,
                         GridFunction &flux, Vector &error_estimates,
@@ -3703,6 +4537,16 @@ double ZZErrorEstimator(BilinearFormIntegrator &blfi,
                         int with_subdomains,
                         bool with_coeff)
 {
+   if (aniso_flags == NULL && with_subdomains == 0)
+   {
+      double batched_total;
+      if (BatchedZZErrorEstimator(blfi, u, flux, with_coeff,
+                                  error_estimates, batched_total))
+      {
+         return std::sqrt(batched_total);
+      }
+   }
+
    FiniteElementSpace *ufes = u.FESpace();
    FiniteElementSpace *ffes = flux.FESpace();
    ElementTransformation *Transf;
@@ -3902,4 +4746,179 @@ GridFunction *Extrude1DGridFunction(Mesh *mesh, Mesh *mesh2d,
    return sol2d;
 }
 
+
+// Run-length encoding used by the delta streaming classes when zlib is not
+// available: the XOR diffs are mostly zero bytes when the field evolves
+// smoothly. Each record is a uint32 zero-run length, a uint32 literal
+// length, and the literal bytes, all in native byte order.
+static void DeltaEncodeRLE(const char *data, size_t size,
+                           std::vector<char> &enc)
+{
+   enc.clear();
+   size_t pos = 0;
+   while (pos < size)
+   {
+      size_t zend = pos;
+      while (zend < size && data[zend] == 0 &&
+             zend - pos < UINT32_MAX) { zend++; }
+      size_t lend = zend;
+      while (lend < size && lend - zend < UINT32_MAX)
+      {
+         if (data[lend] != 0) { lend++; continue; }
+         size_t z = lend;
+         while (z < size && data[z] == 0) { z++; }
+         // break the literal run only for zero runs long enough to pay for
+         // the 8-byte record header
+         if (z - lend > 2*sizeof(uint32_t) || z == size) { break; }
+         lend = z;
+      }
+      bin_io::AppendBytes<uint32_t>(enc, uint32_t(zend - pos));
+      bin_io::AppendBytes<uint32_t>(enc, uint32_t(lend - zend));
+      enc.insert(enc.end(), data + zend, data + lend);
+      pos = lend;
+   }
+}
+
+static bool DeltaDecodeRLE(const std::vector<char> &enc, char *data,
+                           size_t size)
+{
+   size_t in = 0, out = 0;
+   while (in < enc.size())
+   {
+      if (enc.size() - in < 2*sizeof(uint32_t)) { return false; }
+      uint32_t zrun, lit;
+      std::memcpy(&zrun, &enc[in], sizeof(uint32_t));
+      std::memcpy(&lit, &enc[in] + sizeof(uint32_t), sizeof(uint32_t));
+      in += 2*sizeof(uint32_t);
+      if (zrun + (size_t)lit > size - out ||
+          lit > enc.size() - in) { return false; }
+      std::memset(data + out, 0, zrun);
+      out += zrun;
+      if (lit) { std::memcpy(data + out, &enc[in], lit); }
+      in += lit;
+      out += lit;
+   }
+   return out == size;
+}
+
+bool DeltaSolutionSender::Negotiate(std::iostream &out)
+{
+   negotiated = true;
+   peer_delta = false;
+   if (!delta_enabled) { return false; }
+   out << "mfem_delta_query\n" << flush;
+   string reply;
+   if (getline(out, reply)) // blocks until the peer replies or disconnects
+   {
+      filter_dos(reply);
+      peer_delta = (reply == "mfem_delta_ack");
+   }
+   return peer_delta;
+}
+
+void DeltaSolutionSender::Send(std::iostream &out, Mesh &mesh,
+                               GridFunction &gf)
+{
+   if (!negotiated) { Negotiate(out); }
+   if (!peer_delta)
+   {
+      // standard GLVis solution message
+      out << "solution\n" << mesh << gf << flush;
+      return;
+   }
+   const int size = gf.Size();
+   if (mesh_sequence != mesh.GetSequence() || prev.Size() != size)
+   {
+      // full frame: ASCII mesh + binary field, so that both sides hold
+      // bit-identical dof values for the following XOR deltas
+      out << "mfem_delta_full\n" << mesh;
+      gf.SaveBinary(out);
+      mesh_sequence = mesh.GetSequence();
+   }
+   else
+   {
+      const char *cur = (const char *)gf.HostRead();
+      const char *old = (const char *)prev.HostRead();
+      const size_t bytes = size*sizeof(double);
+      std::vector<char> diff(bytes);
+      for (size_t i = 0; i < bytes; i++) { diff[i] = cur[i] ^ old[i]; }
+      std::vector<char> payload;
+      const char *encoding;
+#ifdef MFEM_USE_ZLIB
+      uLongf payload_size = compressBound(bytes);
+      payload.resize(payload_size);
+      int res = compress2((Bytef *)payload.data(), &payload_size,
+                          (const Bytef *)diff.data(), bytes, 6);
+      MFEM_VERIFY(res == Z_OK, "zlib error in delta compression: " << res);
+      payload.resize(payload_size);
+      encoding = "zlib";
+#else
+      DeltaEncodeRLE(diff.data(), bytes, payload);
+      encoding = "rle";
+#endif
+      out << "mfem_delta_solution\n"
+          << encoding << ' ' << size << ' ' << payload.size() << '\n';
+      out.write(payload.data(), payload.size());
+      out << flush;
+   }
+   prev = gf;
+}
+
+bool DeltaSolutionReceiver::Receive(std::iostream &in)
+{
+   string keyword;
+   while (in >> keyword)
+   {
+      if (keyword == "mfem_delta_query")
+      {
+         in << "mfem_delta_ack\n" << flush;
+         continue;
+      }
+      else if (keyword == "solution" || keyword == "mfem_delta_full")
+      {
+         delete field; field = NULL;
+         delete mesh;
+         mesh = new Mesh(in, 1, 0, false);
+         field = new GridFunction(mesh, in);
+         return (bool)in;
+      }
+      else if (keyword == "mfem_delta_solution")
+      {
+         string encoding;
+         int size;
+         size_t payload_size;
+         in >> encoding >> size >> payload_size;
+         in.get(); // the newline before the payload
+         std::vector<char> payload(payload_size);
+         if (payload_size) { in.read(payload.data(), payload_size); }
+         if (!in || !field || field->Size() != size) { return false; }
+         const size_t bytes = size*sizeof(double);
+         std::vector<char> diff(bytes);
+         bool ok = false;
+         if (encoding == "rle")
+         {
+            ok = DeltaDecodeRLE(payload, diff.data(), bytes);
+         }
+#ifdef MFEM_USE_ZLIB
+         else if (encoding == "zlib")
+         {
+            uLongf dest_size = bytes;
+            ok = (uncompress((Bytef *)diff.data(), &dest_size,
+                             (const Bytef *)payload.data(),
+                             payload_size) == Z_OK && dest_size == bytes);
+         }
+#endif
+         if (!ok) { return false; }
+         char *data = (char *)field->HostReadWrite();
+         for (size_t i = 0; i < bytes; i++) { data[i] ^= diff[i]; }
+         return true;
+      }
+      else
+      {
+         return false; // unknown message
+      }
+   }
+   return false;
+}
+
 }
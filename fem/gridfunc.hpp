@@ -19,8 +19,9 @@
 #ifdef MFEM_USE_ADIOS2
 #include "../general/adios2stream.hpp"
 #endif
+#include "../general/forall.hpp"
 #include <limits>
-#include <ostream>
+#include <iostream>
 #include <string>
 
 namespace mfem
@@ -67,6 +68,9 @@ protected:
        degree of freedom. */
    void ProjectDiscCoefficient(VectorCoefficient &coeff, Array<int> &dof_attr);
 
+   /// Read the payload of a "LossyData" section written by SaveLossy().
+   void LoadLossy(std::istream &input);
+
    void Destroy();
 
 public:
@@ -78,6 +82,12 @@ public:
       : Vector(orig), fes(orig.fes), fec(NULL), sequence(orig.sequence)
    { UseDevice(true); }
 
+   /// Move constructor. "Steals" the data (and the owned #fec) from @a orig.
+   GridFunction(GridFunction &&orig)
+      : Vector(std::move(orig)), fes(orig.fes), fec(orig.fec),
+        sequence(orig.sequence), t_vec(std::move(orig.t_vec))
+   { orig.fec = NULL; }
+
    /// Construct a GridFunction associated with the FiniteElementSpace @a *f.
    GridFunction(FiniteElementSpace *f) : Vector(f->GetVSize())
    { fes = f; fec = NULL; sequence = f->GetSequence(); UseDevice(true); }
@@ -109,6 +119,22 @@ public:
    GridFunction &operator=(const GridFunction &rhs)
    { return operator=((const Vector &)rhs); }
 
+   /// Move assignment. "Steals" the data (and the owned #fec) from @a rhs.
+   GridFunction &operator=(GridFunction &&rhs)
+   {
+      if (this != &rhs)
+      {
+         Destroy();
+         Vector::operator=(std::move(rhs));
+         fes = rhs.fes;
+         fec = rhs.fec;
+         sequence = rhs.sequence;
+         t_vec = std::move(rhs.t_vec);
+         rhs.fec = NULL;
+      }
+      return *this;
+   }
+
    /// Make the GridFunction the owner of #fec and #fes.
    /** If the new FiniteElementCollection, @a _fec, is NULL, ownership of #fec
        and #fes is taken away. */
@@ -141,6 +167,16 @@ public:
    /// Shortcut for calling SetFromTrueDofs() with GetTrueVector() as argument.
    void SetFromTrueVector() { SetFromTrueDofs(GetTrueVector()); }
 
+   /** @brief Extract component @a vd of the GridFunction into @a comp.
+
+       With Ordering::byNODES, @a comp is made a zero-copy reference into the
+       data of this GridFunction (see Vector::MakeRef()), so writes through
+       @a comp modify the GridFunction. With Ordering::byVDIM the component is
+       strided in memory and is instead gathered into @a comp -- on the
+       device when the data resides there -- and later changes to either
+       vector are not reflected in the other. */
+   void GetComponent(int vd, Vector &comp);
+
    /// Returns the values in the vertices of i'th element for dimension vdim.
    void GetNodalValues(int i, Array<double> &nval, int vdim = 1) const;
 
@@ -273,6 +309,39 @@ public:
                            DenseMatrix &vals, DenseMatrix &tr) const;
    ///@}
 
+   /** @name Batch Get Values Methods
+
+       These methods evaluate the field at an array of (element, reference
+       point) pairs in one call. The points are grouped by element so that
+       the per-element setup (FiniteElement lookup, dof extraction) is
+       performed once per distinct element instead of once per point, which
+       is considerably faster than calling GetValue in a loop when many
+       points fall in the same elements, e.g. when sampling along lines. The
+       input arrays match the output of Mesh::FindPoints(), so a batch of
+       physical points can be evaluated with
+
+           mesh.FindPoints(point_mat, elem_ids, ips);
+           gf.GetValues(elem_ids, ips, vals);
+
+       Values at points with a negative element index (not found by
+       Mesh::FindPoints()) are set to zero.
+   */
+   ///@{
+   /** Compute scalar values at the (element, reference point) pairs given
+       by @a elem_ids and @a ips; @a vals is resized to the number of
+       points. */
+   void GetValues(const Array<int> &elem_ids,
+                  const Array<IntegrationPoint> &ips, Vector &vals,
+                  int vdim = 1) const;
+
+   /** Compute vector values at the (element, reference point) pairs given
+       by @a elem_ids and @a ips; column @a j of @a vals receives the value
+       at the j-th point. */
+   void GetVectorValues(const Array<int> &elem_ids,
+                        const Array<IntegrationPoint> &ips,
+                        DenseMatrix &vals) const;
+   ///@}
+
    void GetLaplacians(int i, const IntegrationRule &ir, Vector &laps,
                       int vdim = 1) const;
 
@@ -639,6 +708,28 @@ public:
    /// Save the GridFunction to an output stream.
    virtual void Save(std::ostream &out) const;
 
+   /** @brief Save the GridFunction with its data section in binary form.
+
+       The finite element space header is written as in Save(), followed by a
+       "BinaryData" section holding the vector size and the raw
+       (native-byte-order) dof values, so serialization is a bulk copy instead
+       of ASCII formatting. The stream constructor recognizes the section, so
+       the file loads through the usual GridFunction(Mesh *, std::istream &)
+       path. Not supported for NURBS grid functions stored patch-by-patch. */
+   virtual void SaveBinary(std::ostream &out) const;
+
+   /** @brief Save the GridFunction with lossy, error-bounded compression of
+       the data section.
+
+       The dof values are quantized so that each reloaded value differs from
+       the saved one by at most @a tol, and the quantized values are stored
+       as variable-length deltas in a "LossyData" section, which typically
+       shrinks smooth high-order fields by an order of magnitude. The stream
+       constructor recognizes the section, so the file loads through the
+       usual GridFunction(Mesh *, std::istream &) path. Not supported for
+       NURBS grid functions stored patch-by-patch. */
+   virtual void SaveLossy(std::ostream &out, double tol) const;
+
 #ifdef MFEM_USE_ADIOS2
    /// Save the GridFunction to a binary output stream using adios2 bp format.
    virtual void Save(adios2stream &out, const std::string& variable_name,
@@ -674,24 +765,32 @@ protected:
    int vdim;                ///< Vector dimension
    bool own_qspace;         ///< QuadratureSpace ownership flag
 
+   /** Data layout: Ordering::byVDIM stores the vector components of each
+       quadrature point together (array-of-structures, the default), while
+       Ordering::byNODES stores each component contiguously over all points
+       (structure-of-arrays). */
+   Ordering::Type layout;
+
 public:
    /// Create an empty QuadratureFunction.
    /** The object can be initialized later using the SetSpace() methods. */
    QuadratureFunction()
-      : qspace(NULL), vdim(0), own_qspace(false) { }
+      : qspace(NULL), vdim(0), own_qspace(false), layout(Ordering::byVDIM) { }
 
    /** @brief Copy constructor. The QuadratureSpace ownership flag, #own_qspace,
        in the new object is set to false. */
    QuadratureFunction(const QuadratureFunction &orig)
       : Vector(orig),
-        qspace(orig.qspace), vdim(orig.vdim), own_qspace(false) { }
+        qspace(orig.qspace), vdim(orig.vdim), own_qspace(false),
+        layout(orig.layout) { }
 
    /// Create a QuadratureFunction based on the given QuadratureSpace.
    /** The QuadratureFunction does not assume ownership of the QuadratureSpace.
        @note The Vector data is not initialized. */
    QuadratureFunction(QuadratureSpace *qspace_, int vdim_ = 1)
       : Vector(vdim_*qspace_->GetSize()),
-        qspace(qspace_), vdim(vdim_), own_qspace(false) { }
+        qspace(qspace_), vdim(vdim_), own_qspace(false),
+        layout(Ordering::byVDIM) { }
 
    /** @brief Create a QuadratureFunction based on the given QuadratureSpace,
        using the external data, @a qf_data. */
@@ -699,7 +798,8 @@ public:
        QuadratureSpace nor the external data. */
    QuadratureFunction(QuadratureSpace *qspace_, double *qf_data, int vdim_ = 1)
       : Vector(qf_data, vdim_*qspace_->GetSize()),
-        qspace(qspace_), vdim(vdim_), own_qspace(false) { }
+        qspace(qspace_), vdim(vdim_), own_qspace(false),
+        layout(Ordering::byVDIM) { }
 
    /// Read a QuadratureFunction from the stream @a in.
    /** The QuadratureFunction assumes ownership of the read QuadratureSpace. */
@@ -747,6 +847,36 @@ public:
    /// Set the QuadratureSpace ownership flag.
    void SetOwnsSpace(bool own) { own_qspace = own; }
 
+   /// Get the data layout, see SetLayout().
+   Ordering::Type GetLayout() const { return layout; }
+
+   /** @brief Change the data layout, permuting the existing values.
+
+       With Ordering::byVDIM (the default) the vector components of each
+       quadrature point are stored together, and the zero-copy element views
+       returned by the non-const GetElementValues() methods are available.
+       With Ordering::byNODES each component is stored contiguously over all
+       quadrature points, which vectorizes component-wise kernels and makes
+       the zero-copy component views of GetComponentValues() available. */
+   void SetLayout(Ordering::Type layout_);
+
+   /** @brief Return component @a comp of all quadrature point values as a
+       reference to the global values. Requires the Ordering::byNODES
+       layout. */
+   inline void GetComponentValues(int comp, Vector &values);
+
+   /** @brief Apply the pointwise transformation @a func to the values of
+       all quadrature points.
+
+       The functor is invoked once per quadrature point as
+       `func(double *vals, int stride)`, where `vals` points to the first
+       vector component of the point and component `c` is `vals[c*stride]`
+       (the stride depends on the layout). The loop is dispatched with
+       MFEM_FORALL on the data where it resides, so when a device backend is
+       enabled the functor must be device-callable, e.g. a lambda marked
+       MFEM_HOST_DEVICE capturing by value. */
+   template <typename F> void Transform(F func);
+
    /// Redefine '=' for QuadratureFunction = constant.
    QuadratureFunction &operator=(double value);
 
@@ -853,6 +983,74 @@ GridFunction *Extrude1DGridFunction(Mesh *mesh, Mesh *mesh2d,
                                     GridFunction *sol, const int ny);
 
 
+/** @brief Sender side of the delta visualization streaming protocol.
+
+    Send() writes a time-evolving solution to a (socket) stream, resending
+    the mesh only when it changes and encoding the frames in between as
+    compressed binary diffs of the dof array, which stay small when the
+    field evolves smoothly. The mode is negotiated over the stream: a
+    delta-capable receiver (DeltaSolutionReceiver) acknowledges the query
+    and gets "mfem_delta_full"/"mfem_delta_solution" messages; without an
+    acknowledgment every frame falls back to the standard GLVis
+    "solution\n<mesh><field>" message, so the sender can also feed a plain
+    GLVis window. Note that the negotiation blocks until the peer replies or
+    closes the stream, so it should only be enabled when the receiver is a
+    delta-capable relay; pass enable_delta = false for stock GLVis. The
+    finite element space must not change between delta frames (a changed
+    mesh or dof count triggers a full frame automatically). */
+class DeltaSolutionSender
+{
+private:
+   long mesh_sequence; ///< mesh sequence of the last full frame, -1 if none
+   Vector prev;        ///< dof values of the last sent frame
+   bool delta_enabled, negotiated, peer_delta;
+
+public:
+   explicit DeltaSolutionSender(bool enable_delta = true)
+      : mesh_sequence(-1), delta_enabled(enable_delta), negotiated(false),
+        peer_delta(false) { }
+
+   /** @brief Query the receiver for delta support; returns true if it
+       acknowledged. Called automatically by the first Send(). */
+   bool Negotiate(std::iostream &out);
+
+   /// Send one frame of @a gf on @a mesh; @a out.precision() is used for the
+   /// ASCII (fallback and mesh) parts of the messages.
+   void Send(std::iostream &out, Mesh &mesh, GridFunction &gf);
+
+   /// Force the next Send() to start over with a full frame.
+   void Reset() { mesh_sequence = -1; }
+};
+
+
+/** @brief Receiver side of the delta visualization streaming protocol; see
+    DeltaSolutionSender.
+
+    Receive() reads one message: it acknowledges negotiation queries,
+    reconstructs full frames, and applies delta frames to the stored
+    solution. Intended for relay processes that re-serve the reconstructed
+    frames (e.g. to a local GLVis) on the far side of a slow link. */
+class DeltaSolutionReceiver
+{
+private:
+   Mesh *mesh;          ///< owned reconstructed mesh, or NULL
+   GridFunction *field; ///< owned reconstructed field, or NULL
+
+public:
+   DeltaSolutionReceiver() : mesh(NULL), field(NULL) { }
+
+   /** @brief Read messages from @a in until a frame is complete. Returns
+       true when a new frame is available through GetMesh()/GetField(),
+       false at end of stream or on an unknown message. */
+   bool Receive(std::iostream &in);
+
+   Mesh *GetMesh() { return mesh; }
+   GridFunction *GetField() { return field; }
+
+   ~DeltaSolutionReceiver() { delete field; delete mesh; }
+};
+
+
 // Inline methods
 
 inline void QuadratureFunction::SetSpace(QuadratureSpace *qspace_, int vdim_)
@@ -882,6 +1080,8 @@ inline void QuadratureFunction::SetSpace(QuadratureSpace *qspace_,
 
 inline void QuadratureFunction::GetElementValues(int idx, Vector &values)
 {
+   MFEM_ASSERT(layout == Ordering::byVDIM,
+               "zero-copy element views require the byVDIM layout");
    const int s_offset = qspace->element_offsets[idx];
    const int sl_size = qspace->element_offsets[idx+1] - s_offset;
    values.NewDataAndSize(data + vdim*s_offset, vdim*sl_size);
@@ -892,16 +1092,32 @@ inline void QuadratureFunction::GetElementValues(int idx, Vector &values) const
    const int s_offset = qspace->element_offsets[idx];
    const int sl_size = qspace->element_offsets[idx+1] - s_offset;
    values.SetSize(vdim*sl_size);
-   const double *q = data + vdim*s_offset;
-   for (int i = 0; i<values.Size(); i++)
+   if (layout == Ordering::byVDIM)
    {
-      values(i) = *(q++);
+      const double *q = data + vdim*s_offset;
+      for (int i = 0; i<values.Size(); i++)
+      {
+         values(i) = *(q++);
+      }
+   }
+   else
+   {
+      const int nq = qspace->GetSize();
+      for (int j = 0; j < sl_size; j++)
+      {
+         for (int i = 0; i < vdim; i++)
+         {
+            values(i + vdim*j) = data[i*nq + s_offset + j];
+         }
+      }
    }
 }
 
 inline void QuadratureFunction::GetElementValues(int idx, const int ip_num,
                                                  Vector &values)
 {
+   MFEM_ASSERT(layout == Ordering::byVDIM,
+               "zero-copy element views require the byVDIM layout");
    const int s_offset = qspace->element_offsets[idx] * vdim + ip_num * vdim;
    values.NewDataAndSize(data + s_offset, vdim);
 }
@@ -909,17 +1125,31 @@ inline void QuadratureFunction::GetElementValues(int idx, const int ip_num,
 inline void QuadratureFunction::GetElementValues(int idx, const int ip_num,
                                                  Vector &values) const
 {
-   const int s_offset = qspace->element_offsets[idx] * vdim + ip_num * vdim;
    values.SetSize(vdim);
-   const double *q = data + s_offset;
-   for (int i = 0; i < values.Size(); i++)
+   if (layout == Ordering::byVDIM)
    {
-      values(i) = *(q++);
+      const int s_offset = qspace->element_offsets[idx] * vdim + ip_num * vdim;
+      const double *q = data + s_offset;
+      for (int i = 0; i < values.Size(); i++)
+      {
+         values(i) = *(q++);
+      }
+   }
+   else
+   {
+      const int nq = qspace->GetSize();
+      const int p = qspace->element_offsets[idx] + ip_num;
+      for (int i = 0; i < vdim; i++)
+      {
+         values(i) = data[i*nq + p];
+      }
    }
 }
 
 inline void QuadratureFunction::GetElementValues(int idx, DenseMatrix &values)
 {
+   MFEM_ASSERT(layout == Ordering::byVDIM,
+               "zero-copy element views require the byVDIM layout");
    const int s_offset = qspace->element_offsets[idx];
    const int sl_size = qspace->element_offsets[idx+1] - s_offset;
    values.Reset(data + vdim*s_offset, vdim, sl_size);
@@ -931,16 +1161,49 @@ inline void QuadratureFunction::GetElementValues(int idx,
    const int s_offset = qspace->element_offsets[idx];
    const int sl_size = qspace->element_offsets[idx+1] - s_offset;
    values.SetSize(vdim, sl_size);
-   const double *q = data + vdim*s_offset;
-   for (int j = 0; j<sl_size; j++)
+   if (layout == Ordering::byVDIM)
+   {
+      const double *q = data + vdim*s_offset;
+      for (int j = 0; j<sl_size; j++)
+      {
+         for (int i = 0; i<vdim; i++)
+         {
+            values(i,j) = *(q++);
+         }
+      }
+   }
+   else
    {
-      for (int i = 0; i<vdim; i++)
+      const int nq = qspace->GetSize();
+      for (int j = 0; j < sl_size; j++)
       {
-         values(i,j) = *(q++);
+         for (int i = 0; i < vdim; i++)
+         {
+            values(i,j) = data[i*nq + s_offset + j];
+         }
       }
    }
 }
 
+inline void QuadratureFunction::GetComponentValues(int comp, Vector &values)
+{
+   MFEM_ASSERT(layout == Ordering::byNODES,
+               "zero-copy component views require the byNODES layout");
+   MFEM_ASSERT(comp >= 0 && comp < vdim, "invalid component index");
+   const int nq = qspace->GetSize();
+   values.NewDataAndSize(data + comp*nq, nq);
+}
+
+template <typename F>
+void QuadratureFunction::Transform(F func)
+{
+   const int nq = qspace->GetSize();
+   const int point_stride = (layout == Ordering::byVDIM) ? vdim : 1;
+   const int comp_stride = (layout == Ordering::byVDIM) ? 1 : nq;
+   double *d = ReadWrite();
+   MFEM_FORALL(p, nq, { func(d + p*point_stride, comp_stride); });
+}
+
 } // namespace mfem
 
 #endif
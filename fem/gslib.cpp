@@ -32,7 +32,8 @@ FindPointsGSLIB::FindPointsGSLIB()
    : mesh(NULL), meshsplit(NULL), ir_simplex(NULL),
      fdata2D(NULL), fdata3D(NULL), cr(NULL), gsl_comm(NULL),
      dim(-1), points_cnt(0), setupflag(false), default_interp_value(0),
-     avgtype(AvgType::ARITHMETIC)
+     avgtype(AvgType::ARITHMETIC), node_move_tol(0.0),
+     ind_fes(NULL), ind_fes_sequence(-1)
 {
    gsl_comm = new comm;
    cr       = new crystal;
@@ -53,6 +54,7 @@ FindPointsGSLIB::~FindPointsGSLIB()
    delete cr;
    delete ir_simplex;
    delete meshsplit;
+   delete ind_fes;
 }
 
 #ifdef MFEM_USE_MPI
@@ -60,7 +62,8 @@ FindPointsGSLIB::FindPointsGSLIB(MPI_Comm _comm)
    : mesh(NULL), meshsplit(NULL), ir_simplex(NULL),
      fdata2D(NULL), fdata3D(NULL), cr(NULL), gsl_comm(NULL),
      dim(-1), points_cnt(0), setupflag(false), default_interp_value(0),
-     avgtype(AvgType::ARITHMETIC)
+     avgtype(AvgType::ARITHMETIC), node_move_tol(0.0),
+     ind_fes(NULL), ind_fes_sequence(-1)
 {
    gsl_comm = new comm;
    cr      = new crystal;
@@ -75,8 +78,40 @@ void FindPointsGSLIB::Setup(Mesh &m, const double bb_t, const double newt_tol,
    MFEM_VERIFY(m.GetNumGeometries(m.Dimension()) == 1,
                "Mixed meshes are not currently supported in FindPointsGSLIB.");
 
+   // Incremental setup mode: if this mesh is already set up and no node has
+   // moved more than node_move_tol since the search structure was built,
+   // keep the structure alive -- gslib inflates the element bounding boxes
+   // by the relative tolerance bb_t, so they stay valid under small motion.
+   // Otherwise the freshly extracted coordinates are reused for the rebuild.
+   bool coords_ready = false;
+   if (setupflag && node_move_tol > 0.0 && mesh == &m &&
+       (mesh->GetNodalFESpace()->GetFE(0)->GetGeomType() == Geometry::SQUARE ||
+        mesh->GetNodalFESpace()->GetFE(0)->GetGeomType() == Geometry::CUBE))
+   {
+      Vector prev_coords;
+      prev_coords.Swap(gsl_mesh);
+      GetQuadHexNodalCoordinates();
+      coords_ready = true;
+      if (gsl_mesh.Size() == prev_coords.Size())
+      {
+         double max_move = 0.0;
+         for (int i = 0; i < gsl_mesh.Size(); i++)
+         {
+            const double move = fabs(gsl_mesh(i) - prev_coords(i));
+            if (move > max_move) { max_move = move; }
+         }
+         if (max_move <= node_move_tol) { return; }
+      }
+   }
+
    // call FreeData if FindPointsGSLIB::Setup has been called already
-   if (setupflag) { FreeData(); }
+   if (setupflag)
+   {
+      Vector extracted_coords;
+      if (coords_ready) { extracted_coords.Swap(gsl_mesh); }
+      FreeData();
+      if (coords_ready) { gsl_mesh.Swap(extracted_coords); }
+   }
 
    crystal_init(cr, gsl_comm);
    mesh = &m;
@@ -92,7 +127,7 @@ void FindPointsGSLIB::Setup(Mesh &m, const double bb_t, const double newt_tol,
    }
    else if (gt == Geometry::SQUARE || gt == Geometry::CUBE)
    {
-      GetQuadHexNodalCoordinates();
+      if (!coords_ready) { GetQuadHexNodalCoordinates(); }
    }
    else
    {
@@ -237,10 +272,8 @@ void FindPointsGSLIB::GetNodeValues(const GridFunction &gf_in,
 
    if (gt == Geometry::SQUARE || gt == Geometry::CUBE)
    {
-      const GridFunction *nodes     = mesh->GetNodes();
-      const FiniteElementSpace *fes = nodes->FESpace();
-      const IntegrationRule &ir     = fes->GetFE(0)->GetNodes();
-      const int dof_cnt = ir.GetNPoints();
+      const FiniteElementSpace *fes = gf_in.FESpace();
+      const int dof_cnt = fes->GetFE(0)->GetDof();
 
       node_vals.SetSize(NE * dof_cnt);
 
@@ -249,11 +282,16 @@ void FindPointsGSLIB::GetNodeValues(const GridFunction &gf_in,
       MFEM_VERIFY(tbe != NULL, "TensorBasis FiniteElement expected.");
       const Array<int> &dof_map = tbe->GetDofMap();
 
+      // The function is nodal (Gauss-Lobatto H1 of the same order as the
+      // mesh), so its values at the element nodes are its dofs; gather them
+      // directly instead of evaluating the basis point-by-point.
       int pt_id = 0;
+      Array<int> dofs;
       Vector vals_el;
       for (int i = 0; i < NE; i++)
       {
-         gf_in.GetValues(i, ir, vals_el);
+         fes->GetElementDofs(i, dofs);
+         gf_in.GetSubVector(dofs, vals_el);
          for (int j = 0; j < dof_cnt; j++)
          {
             node_vals(pt_id++) = vals_el(dof_map[j]);
@@ -326,6 +364,10 @@ void FindPointsGSLIB::GetSimplexNodalCoordinates()
    const int NE              = mesh->GetNE();
    int NEsplit = 0;
 
+   // Release the split mesh of a previous Setup() call, if any.
+   delete ir_simplex;  ir_simplex = NULL;
+   delete meshsplit;   meshsplit = NULL;
+
    // Split the reference element into a reference submesh of quads or hexes.
    if (gt == Geometry::TRIANGLE)
    {
@@ -650,9 +692,19 @@ void FindPointsGSLIB::Interpolate(const GridFunction &field_in,
 void FindPointsGSLIB::InterpolateH1(const GridFunction &field_in,
                                     Vector &field_out)
 {
-   FiniteElementSpace ind_fes(mesh, field_in.FESpace()->FEColl());
-   GridFunction field_in_scalar(&ind_fes);
-   Vector node_vals;
+   // (Re)build the scalar auxiliary space only when the field collection or
+   // the mesh changes; repeated interpolation during a simulation reuses it
+   // together with the node-value scratch vector.
+   if (!ind_fes || ind_fes->GetMesh() != mesh ||
+       ind_fes->FEColl() != field_in.FESpace()->FEColl() ||
+       ind_fes_sequence != mesh->GetSequence())
+   {
+      delete ind_fes;
+      ind_fes = new FiniteElementSpace(mesh, field_in.FESpace()->FEColl());
+      ind_fes_sequence = mesh->GetSequence();
+   }
+   GridFunction field_in_scalar(ind_fes);
+   Vector &node_vals = node_vals_buf;
 
    const int ncomp      = field_in.FESpace()->GetVDim(),
              points_fld = field_in.Size() / ncomp,
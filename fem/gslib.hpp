@@ -60,6 +60,12 @@ protected:
    bool setupflag;              // flag to indicate whether gslib data has been setup
    double default_interp_value; // used for points that are not found in the mesh
    AvgType avgtype;             // average type used for L2 functions
+   double node_move_tol;        // tolerance for the incremental setup mode;
+   // see SetIncrementalSetupTol()
+   FiniteElementSpace *ind_fes; // scalar auxiliary space reused across
+   // InterpolateH1() calls; owned
+   long ind_fes_sequence;       // mesh sequence at which ind_fes was built
+   Vector node_vals_buf;        // node-value scratch reused by InterpolateH1()
 
    /// Get GridFunction from MFEM format to GSLIB format
    void GetNodeValues(const GridFunction &gf_in, Vector &node_vals);
@@ -152,6 +158,19 @@ public:
       default_interp_value = interp_value_;
    }
 
+   /** Enable the incremental setup mode with node movement tolerance @a tol
+       (disabled when @a tol <= 0, the default). In this mode, calling Setup()
+       again for the mesh that is currently set up keeps the gslib search
+       structure alive and skips the full rebuild if no mesh node has moved
+       more than @a tol (in physical space) since the structure was last
+       built. The element bounding boxes are inflated by the relative
+       tolerance @a bb_t of Setup(), so they remain valid under small motion;
+       note that the reference positions returned by FindPoints() then refer
+       to the mesh of the last full rebuild. Intended for ALE-type
+       simulations with small displacements per step; currently effective
+       only for quad/hex meshes. */
+   void SetIncrementalSetupTol(const double tol) { node_move_tol = tol; }
+
    /** Cleans up memory allocated internally by gslib.
        Note that in parallel, this must be called before MPI_Finalize(), as it
        calls MPI_Comm_free() for internal gslib communicators. */
@@ -17,6 +17,7 @@
 #endif
 
 #include <map>
+#include <cstring>
 
 // uncomment next line for debugging: write C and P to file
 // #define MFEM_DEBUG_HYBRIDIZATION_CP
@@ -566,6 +567,79 @@ void Hybridization::AssembleBdrMatrix(int bdr_el, const DenseMatrix &A)
    }
 }
 
+void Hybridization::FactorElementMatrices()
+{
+   const int NE = fes->GetNE();
+   Array<int> b_dofs;
+
+   // Group the elements by their (interior, boundary) dof counts; on
+   // uniform meshes without essential dofs this produces a single group.
+   std::map<std::pair<int,int>, Array<int> > groups;
+   for (int el = 0; el < NE; el++)
+   {
+      int ni;
+      GetBDofs(el, ni, b_dofs);
+      groups[std::make_pair(ni, b_dofs.Size())].Append(el);
+   }
+
+   std::map<std::pair<int,int>, Array<int> >::iterator it;
+   for (it = groups.begin(); it != groups.end(); ++it)
+   {
+      const int ni = it->first.first;
+      const int nb = it->first.second;
+      const Array<int> &els = it->second;
+      const int ne = els.Size();
+
+      DenseTensor T_ii(ni, ni, ne), T_ib(ni, nb, ne);
+      DenseTensor T_bi(nb, ni, ne), T_bb(nb, nb, ne);
+      {
+         double *ii = T_ii.HostWrite(), *ib = T_ib.HostWrite();
+         double *bi = T_bi.HostWrite(), *bb = T_bb.HostWrite();
+         for (int k = 0; k < ne; k++)
+         {
+            const double *d = Af_data + Af_offsets[els[k]];
+            std::memcpy(ii + k*ni*ni, d, ni*ni*sizeof(double));
+            std::memcpy(ib + k*ni*nb, d + ni*ni, ni*nb*sizeof(double));
+            std::memcpy(bi + k*nb*ni, d + ni*(ni+nb), nb*ni*sizeof(double));
+            std::memcpy(bb + k*nb*nb, d + ni*(ni+2*nb), nb*nb*sizeof(double));
+         }
+      }
+
+      Array<int> P_ii, P_bb;
+      if (ni > 0)
+      {
+         BatchLUFactor(T_ii, P_ii);
+         BatchBlockFactor(T_ii, P_ii, T_ib, T_bi, T_bb);
+      }
+      BatchLUFactor(T_bb, P_bb);
+
+      // Store the factored blocks and pivots back in the layout used by
+      // MultAfInv() and ComputeH().
+      {
+         const double *ii = T_ii.HostRead(), *ib = T_ib.HostRead();
+         const double *bi = T_bi.HostRead(), *bb = T_bb.HostRead();
+         const int *pii = P_ii.HostRead(), *pbb = P_bb.HostRead();
+         for (int k = 0; k < ne; k++)
+         {
+            double *d = Af_data + Af_offsets[els[k]];
+            std::memcpy(d, ii + k*ni*ni, ni*ni*sizeof(double));
+            std::memcpy(d + ni*ni, ib + k*ni*nb, ni*nb*sizeof(double));
+            std::memcpy(d + ni*(ni+nb), bi + k*nb*ni, nb*ni*sizeof(double));
+            std::memcpy(d + ni*(ni+2*nb), bb + k*nb*nb, nb*nb*sizeof(double));
+            int *ipiv = Af_ipiv + Af_f_offsets[els[k]];
+            for (int i = 0; i < ni; i++)
+            {
+               ipiv[i] = pii[k*ni + i] + LUFactors::ipiv_base;
+            }
+            for (int i = 0; i < nb; i++)
+            {
+               ipiv[ni + i] = pbb[k*nb + i] + LUFactors::ipiv_base;
+            }
+         }
+      }
+   }
+}
+
 void Hybridization::ComputeH()
 {
    const int skip_zeros = 1;
@@ -581,6 +655,9 @@ void Hybridization::ComputeH()
    SparseMatrix *V = pC ? new SparseMatrix(Ct->Height(), Ct->Width()) : NULL;
 #endif
 
+   // Batched local elimination of the element unknowns.
+   FactorElementMatrices();
+
    c_dof_marker = -1;
    int c_mark_start = 0;
    for (int el = 0; el < NE; el++)
@@ -588,16 +665,11 @@ void Hybridization::ComputeH()
       int i_dofs_size;
       GetBDofs(el, i_dofs_size, b_dofs);
 
-      LUFactors LU_ii(Af_data + Af_offsets[el], Af_ipiv + Af_f_offsets[el]);
-      double *A_ib_data = LU_ii.data + i_dofs_size*i_dofs_size;
+      double *A_ii_data = Af_data + Af_offsets[el];
+      double *A_ib_data = A_ii_data + i_dofs_size*i_dofs_size;
       double *A_bi_data = A_ib_data + i_dofs_size*b_dofs.Size();
       LUFactors LU_bb(A_bi_data + i_dofs_size*b_dofs.Size(),
-                      LU_ii.ipiv + i_dofs_size);
-
-      LU_ii.Factor(i_dofs_size);
-      LU_ii.BlockFactor(i_dofs_size, b_dofs.Size(),
-                        A_ib_data, A_bi_data, LU_bb.data);
-      LU_bb.Factor(b_dofs.Size());
+                      Af_ipiv + Af_f_offsets[el] + i_dofs_size);
 
       // Extract Cb_t from Ct, define c_dofs
       c_dofs.SetSize(0);
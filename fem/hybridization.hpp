@@ -81,6 +81,15 @@ protected:
 
    void GetBDofs(int el, int &num_idofs, Array<int> &b_dofs) const;
 
+   /** @brief Eliminate the element unknowns in all element matrices.
+
+       Groups the elements by their (interior, boundary) dof counts and
+       performs the local LU and Schur-complement factorizations of each
+       group in batched kernel launches, replacing the element-at-a-time
+       elimination. The factored data is stored back in #Af_data/#Af_ipiv in
+       the layout expected by MultAfInv(). */
+   void FactorElementMatrices();
+
    void ComputeH();
 
    // Compute depending on mode:
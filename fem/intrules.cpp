@@ -82,8 +82,13 @@ IntegrationRule::IntegrationRule(IntegrationRule &irx, IntegrationRule &iry,
    SetPointIndices();
 }
 
+// Protects the lazy construction of the contiguous 'weights' and 'points'
+// arrays, which can be requested concurrently for shared rules.
+static std::mutex ir_arrays_mutex;
+
 const Array<double> &IntegrationRule::GetWeights() const
 {
+   std::lock_guard<std::mutex> lock(ir_arrays_mutex);
    if (weights.Size() != GetNPoints())
    {
       weights.SetSize(GetNPoints());
@@ -95,6 +100,23 @@ const Array<double> &IntegrationRule::GetWeights() const
    return weights;
 }
 
+const Array<double> &IntegrationRule::GetPoints() const
+{
+   std::lock_guard<std::mutex> lock(ir_arrays_mutex);
+   if (points.Size() != 3*GetNPoints())
+   {
+      points.SetSize(3*GetNPoints());
+      for (int i = 0; i < GetNPoints(); i++)
+      {
+         const IntegrationPoint &ip = IntPoint(i);
+         points[3*i + 0] = ip.x;
+         points[3*i + 1] = ip.y;
+         points[3*i + 2] = ip.z;
+      }
+   }
+   return points;
+}
+
 void IntegrationRule::SetPointIndices()
 {
    for (int i = 0; i < Size(); i++)
@@ -883,6 +905,16 @@ IntegrationRules::IntegrationRules(int Ref, int _type):
 {
    refined = Ref;
 
+   static_assert(Geometry::NumGeom <= NumGeom,
+                 "IntegrationRules::NumGeom is too small");
+   for (int g = 0; g < NumGeom; g++)
+   {
+      for (int o = 0; o < NumCachedOrders; o++)
+      {
+         rule_cache[g][o].store(NULL, std::memory_order_relaxed);
+      }
+   }
+
    if (refined < 0) { own_rules = 0; return; }
 
    own_rules = 1;
@@ -914,11 +946,26 @@ IntegrationRules::IntegrationRules(int Ref, int _type):
 
 const IntegrationRule &IntegrationRules::Get(int GeomType, int Order)
 {
+   if (GeomType == Geometry::POINT || Order < 0)
+   {
+      Order = 0;
+   }
+
+   // Lock-free fast path: return a rule that has already been published.
+   if (GeomType >= 0 && GeomType < NumGeom && Order < NumCachedOrders)
+   {
+      const IntegrationRule *cached =
+         rule_cache[GeomType][Order].load(std::memory_order_acquire);
+      if (cached) { return *cached; }
+   }
+
+   std::lock_guard<std::recursive_mutex> lock(rules_mutex);
+
    Array<IntegrationRule *> *ir_array;
 
    switch (GeomType)
    {
-      case Geometry::POINT:       ir_array = &PointIntRules; Order = 0; break;
+      case Geometry::POINT:       ir_array = &PointIntRules; break;
       case Geometry::SEGMENT:     ir_array = &SegmentIntRules; break;
       case Geometry::TRIANGLE:    ir_array = &TriangleIntRules; break;
       case Geometry::SQUARE:      ir_array = &SquareIntRules; break;
@@ -930,36 +977,33 @@ const IntegrationRule &IntegrationRules::Get(int GeomType, int Order)
          ir_array = NULL;
    }
 
-   if (Order < 0)
-   {
-      Order = 0;
-   }
-
    if (!HaveIntRule(*ir_array, Order))
    {
-#ifdef MFEM_USE_LEGACY_OPENMP
-      #pragma omp critical
-#endif
+      IntegrationRule *ir = GenerateIntegrationRule(GeomType, Order);
+      int RealOrder = Order;
+      while (RealOrder+1 < ir_array->Size() &&
+      /*  */ (*ir_array)[RealOrder+1] == ir)
       {
-         if (!HaveIntRule(*ir_array, Order))
-         {
-            IntegrationRule *ir = GenerateIntegrationRule(GeomType, Order);
-            int RealOrder = Order;
-            while (RealOrder+1 < ir_array->Size() &&
-            /*  */ (*ir_array)[RealOrder+1] == ir)
-            {
-               RealOrder++;
-            }
-            ir->SetOrder(RealOrder);
-         }
+         RealOrder++;
       }
+      ir->SetOrder(RealOrder);
    }
 
-   return *(*ir_array)[Order];
+   // Publish the rule for lock-free lookup. Entries are never replaced --
+   // Set() refuses to overwrite existing rules -- so published pointers
+   // stay valid for the lifetime of this object.
+   IntegrationRule *ir = (*ir_array)[Order];
+   if (Order < NumCachedOrders)
+   {
+      rule_cache[GeomType][Order].store(ir, std::memory_order_release);
+   }
+   return *ir;
 }
 
 void IntegrationRules::Set(int GeomType, int Order, IntegrationRule &IntRule)
 {
+   std::lock_guard<std::recursive_mutex> lock(rules_mutex);
+
    Array<IntegrationRule *> *ir_array;
 
    switch (GeomType)
@@ -984,6 +1028,10 @@ void IntegrationRules::Set(int GeomType, int Order, IntegrationRule &IntRule)
    AllocIntRule(*ir_array, Order);
 
    (*ir_array)[Order] = &IntRule;
+   if (GeomType >= 0 && GeomType < NumGeom && Order < NumCachedOrders)
+   {
+      rule_cache[GeomType][Order].store(&IntRule, std::memory_order_release);
+   }
 }
 
 void IntegrationRules::DeleteIntRuleArray(Array<IntegrationRule *> &ir_array)
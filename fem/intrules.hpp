@@ -15,6 +15,9 @@
 #include "../config/config.hpp"
 #include "../general/array.hpp"
 
+#include <atomic>
+#include <mutex>
+
 namespace mfem
 {
 
@@ -96,6 +99,10 @@ private:
        by request with the method GetWeights(). */
    mutable Array<double> weights;
 
+   /** @brief The quadrature point coordinates gathered as a contiguous array
+       of (x,y,z) triplets. Created by request with the method GetPoints(). */
+   mutable Array<double> points;
+
    /// Sets the indices of each quadrature point on initialization.
    void SetPointIndices();
 
@@ -252,9 +259,16 @@ public:
 
    /// Return the quadrature weights in a contiguous array.
    /** If a contiguous array is not required, the weights can be accessed with
-       a call like this: `IntPoint(i).weight`. */
+       a call like this: `IntPoint(i).weight`. The returned Array can be read
+       on the device through its Read() method. */
    const Array<double> &GetWeights() const;
 
+   /// Return the quadrature point coordinates in a contiguous array.
+   /** The coordinates are stored as (x,y,z) triplets: the d-th coordinate of
+       the i-th point is entry `3*i + d`. The returned Array can be read on
+       the device through its Read() method. */
+   const Array<double> &GetPoints() const;
+
    /// Destroys an IntegrationRule object
    ~IntegrationRule() { }
 };
@@ -357,6 +371,19 @@ private:
 
    void DeleteIntRuleArray(Array<IntegrationRule *> &ir_array);
 
+   /// Dimensions of the lock-free publication cache used by Get().
+   /** NumGeom must be at least Geometry::NumGeom (checked in intrules.cpp);
+       rules of order NumCachedOrders or higher fall back to the mutex. */
+   static const int NumGeom = 8;
+   static const int NumCachedOrders = 32;
+
+   /// Rules already built, published here for lock-free lookup in Get().
+   std::atomic<const IntegrationRule*> rule_cache[NumGeom][NumCachedOrders];
+
+   /// Serializes rule construction; Get() reads rule_cache without it.
+   /// Recursive because some generators request rules of other geometries.
+   std::recursive_mutex rules_mutex;
+
 public:
    /// Sets initial sizes for the integration rule arrays, but rules
    /// are defined the first time they are requested with the Get method.
@@ -364,6 +391,8 @@ public:
                              int type = Quadrature1D::GaussLegendre);
 
    /// Returns an integration rule for given GeomType and Order.
+   /** This method is thread-safe: rules are built under a mutex and then
+       published, so lookups of already-built rules are lock-free. */
    const IntegrationRule &Get(int GeomType, int Order);
 
    void Set(int GeomType, int Order, IntegrationRule &IntRule);
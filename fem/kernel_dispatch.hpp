@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_DISPATCH
+#define MFEM_KERNEL_DISPATCH
+
+#include "../config/config.hpp"
+#include <unordered_map>
+
+// The fully specialized partial assembly kernels (compile-time D1D and Q1D)
+// are instantiated only for the polynomial orders in the inclusive range
+// [MFEM_PA_ORDER_MIN, MFEM_PA_ORDER_MAX]. The defaults cover all orders that
+// the kernel sources specialize, reproducing the historical behavior; a
+// deployment that only runs, say, orders 4 to 6 can compile with
+//
+//    -DMFEM_PA_ORDER_MIN=4 -DMFEM_PA_ORDER_MAX=6
+//
+// to drop the other instantiations and shrink the binary. Orders outside the
+// selected range remain fully supported through the runtime-sized fallback
+// kernels, which are always compiled.
+
+#ifndef MFEM_PA_ORDER_MIN
+#define MFEM_PA_ORDER_MIN 1
+#endif
+
+#ifndef MFEM_PA_ORDER_MAX
+#define MFEM_PA_ORDER_MAX 9
+#endif
+
+/// Preprocessor predicate: is order @a p selected for full specialization?
+/** Usable in #if directives, guarding both the registration of a kernel and
+    its template instantiation. */
+#define MFEM_PA_ORDER_SELECTED(p) \
+   ((p) >= (MFEM_PA_ORDER_MIN) && (p) <= (MFEM_PA_ORDER_MAX))
+
+/** @brief Register a kernel in the dispatch table @a table under the key
+    (@a dim, @a d1d, @a q1d).
+
+    The kernel is the trailing (variadic) argument, so template instantiations
+    with commas in their parameter lists need no extra parentheses.
+    Registrations are expected to appear in a one-time initialization function
+    (typically populating a function-local static table), with each call
+    wrapped in an #if MFEM_PA_ORDER_SELECTED(p) block so that deselected
+    orders are neither instantiated nor registered. */
+#define MFEM_REGISTER_PA_KERNEL(table, dim, d1d, q1d, ...) \
+   (table).Register(dim, d1d, q1d, __VA_ARGS__)
+
+namespace mfem
+{
+
+/** @brief Dispatch table mapping (dim, D1D, Q1D) to a specialized kernel,
+    replacing the hard-coded switch statements in the partial assembly
+    sources.
+
+    The template parameter is the (integrator-specific) kernel function
+    pointer type. Each kernel source keeps one table per operation, populates
+    it once with the instantiations selected at build time (see
+    MFEM_PA_ORDER_SELECTED), and falls back to its runtime-sized generic
+    kernel when Find() returns NULL. Lookup is a single hash table probe, so
+    registered kernels dispatch at full speed regardless of how many orders a
+    given build instantiates. */
+template <typename Kernel>
+class KernelDispatchTable
+{
+   std::unordered_map<int,Kernel> table;
+
+   static int Key(int dim, int d1d, int q1d)
+   { return (dim << 16) | (d1d << 8) | q1d; }
+
+public:
+   /// Associate @a kernel with the key (@a dim, @a d1d, @a q1d).
+   void Register(int dim, int d1d, int q1d, Kernel kernel)
+   { table[Key(dim, d1d, q1d)] = kernel; }
+
+   /// Return the kernel registered for (@a dim, @a d1d, @a q1d), or NULL.
+   Kernel Find(int dim, int d1d, int q1d) const
+   {
+      typename std::unordered_map<int,Kernel>::const_iterator
+      it = table.find(Key(dim, d1d, q1d));
+      return (it != table.end()) ? it->second : NULL;
+   }
+};
+
+} // namespace mfem
+
+#endif
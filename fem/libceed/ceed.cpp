@@ -42,7 +42,13 @@ extern CeedRestrMap ceed_restr_map;
 
 void InitCeedCoeff(Coefficient* Q, CeedData* ptr)
 {
-   if (ConstantCoefficient* coeff = dynamic_cast<ConstantCoefficient*>(Q))
+   if (Q == nullptr)
+   {
+      CeedConstCoeff* ceedCoeff = new CeedConstCoeff{1.0};
+      ptr->coeff_type = CeedCoeff::Const;
+      ptr->coeff = (void*)ceedCoeff;
+   }
+   else if (ConstantCoefficient* coeff = dynamic_cast<ConstantCoefficient*>(Q))
    {
       CeedConstCoeff* ceedCoeff = new CeedConstCoeff{coeff->constant};
       ptr->coeff_type = CeedCoeff::Const;
@@ -62,6 +68,31 @@ void InitCeedCoeff(Coefficient* Q, CeedData* ptr)
    }
 }
 
+void InitCeedVecCoeff(VectorCoefficient* VQ, CeedData* ptr)
+{
+   if (VectorConstantCoefficient* coeff =
+          dynamic_cast<VectorConstantCoefficient*>(VQ))
+   {
+      const Vector &val = coeff->GetVec();
+      CeedVecConstCoeff* ceedCoeff = new CeedVecConstCoeff;
+      for (int i = 0; i < val.Size(); i++) { ceedCoeff->val[i] = val(i); }
+      ptr->coeff_type = CeedCoeff::VecConst;
+      ptr->coeff = (void*)ceedCoeff;
+   }
+   else if (VectorGridFunctionCoefficient* coeff =
+               dynamic_cast<VectorGridFunctionCoefficient*>(VQ))
+   {
+      CeedGridCoeff* ceedCoeff = new CeedGridCoeff;
+      ceedCoeff->coeff = coeff->GetGridFunction();
+      ptr->coeff_type = CeedCoeff::VecGrid;
+      ptr->coeff = (void*)ceedCoeff;
+   }
+   else
+   {
+      MFEM_ABORT("This type of VectorCoefficient is not supported.");
+   }
+}
+
 static CeedElemTopology GetCeedTopology(Geometry::Type geom)
 {
    switch (geom)
@@ -450,6 +481,7 @@ void CeedPAAssemble(const CeedPAOperator& op,
    // Context data to be passed to the 'f_build_diff' Q-function.
    ceedData.build_ctx_data.dim = mesh->Dimension();
    ceedData.build_ctx_data.space_dim = mesh->SpaceDimension();
+   ceedData.build_ctx_data.vdim = vdim;
 
    std::string qf_file = GetCeedPath() + op.header;
    std::string qf;
@@ -472,6 +504,27 @@ void CeedPAAssemble(const CeedPAOperator& op,
                                      &ceedData.build_qfunc);
          CeedQFunctionAddInput(ceedData.build_qfunc, "coeff", 1, CEED_EVAL_INTERP);
          break;
+      case CeedCoeff::VecConst:
+      {
+         qf = qf_file + op.const_func;
+         CeedQFunctionCreateInterior(ceed, 1, op.const_qf,
+                                     qf.c_str(),
+                                     &ceedData.build_qfunc);
+         CeedVecConstCoeff* coeff = (CeedVecConstCoeff*)ceedData.coeff;
+         for (int d = 0; d < dim; d++)
+         {
+            ceedData.build_ctx_data.vel[d] = coeff->val[d];
+         }
+         break;
+      }
+      case CeedCoeff::VecGrid:
+         qf = qf_file + op.grid_func;
+         CeedQFunctionCreateInterior(ceed, 1, op.grid_qf,
+                                     qf.c_str(),
+                                     &ceedData.build_qfunc);
+         CeedQFunctionAddInput(ceedData.build_qfunc, "coeff", dim,
+                               CEED_EVAL_INTERP);
+         break;
       default:
          MFEM_ABORT("This coeff_type is not handled");
    }
@@ -489,13 +542,14 @@ void CeedPAAssemble(const CeedPAOperator& op,
    // Create the operator that builds the quadrature data for the operator.
    CeedOperatorCreate(ceed, ceedData.build_qfunc, NULL, NULL,
                       &ceedData.build_oper);
-   if (ceedData.coeff_type==CeedCoeff::Grid)
+   if (ceedData.coeff_type==CeedCoeff::Grid ||
+       ceedData.coeff_type==CeedCoeff::VecGrid)
    {
       CeedGridCoeff* ceedCoeff = (CeedGridCoeff*)ceedData.coeff;
       InitCeedBasisAndRestriction(*ceedCoeff->coeff->FESpace(), irm, ceed,
                                   &ceedCoeff->basis,
                                   &ceedCoeff->restr);
-      CeedVectorCreate(ceed, ceedCoeff->coeff->FESpace()->GetNDofs(),
+      CeedVectorCreate(ceed, ceedCoeff->coeff->FESpace()->GetVSize(),
                        &ceedCoeff->coeffVector);
       CeedVectorSetArray(ceedCoeff->coeffVector, CEED_MEM_HOST, CEED_USE_POINTER,
                          ceedCoeff->coeff->GetData());
@@ -535,13 +589,32 @@ void CeedPAAssemble(const CeedPAOperator& op,
    CeedOperatorSetField(ceedData.oper, "v", ceedData.restr, ceedData.basis,
                         CEED_VECTOR_ACTIVE);
 
-   CeedVectorCreate(ceed, fes.GetNDofs(), &ceedData.u);
-   CeedVectorCreate(ceed, fes.GetNDofs(), &ceedData.v);
+   CeedVectorCreate(ceed, vdim*fes.GetNDofs(), &ceedData.u);
+   CeedVectorCreate(ceed, vdim*fes.GetNDofs(), &ceedData.v);
+}
+
+void CeedCompositePAOperator(const Array<const CeedData*> &ceedData,
+                             CeedOperator *oper)
+{
+   Ceed ceed(internal::ceed);
+   CeedCompositeOperatorCreate(ceed, oper);
+   for (int i = 0; i < ceedData.Size(); i++)
+   {
+      CeedCompositeOperatorAddSub(*oper, ceedData[i]->oper);
+   }
 }
 
 void CeedAddMultPA(const CeedData *ceedDataPtr,
                    const Vector &x,
                    Vector &y)
+{
+   CeedAddMultPA(ceedDataPtr->oper, ceedDataPtr, x, y);
+}
+
+void CeedAddMultPA(CeedOperator oper,
+                   const CeedData *ceedDataPtr,
+                   const Vector &x,
+                   Vector &y)
 {
    const CeedScalar *x_ptr;
    CeedScalar *y_ptr;
@@ -562,7 +635,7 @@ void CeedAddMultPA(const CeedData *ceedDataPtr,
                       const_cast<CeedScalar*>(x_ptr));
    CeedVectorSetArray(ceedDataPtr->v, mem, CEED_USE_POINTER, y_ptr);
 
-   CeedOperatorApplyAdd(ceedDataPtr->oper, ceedDataPtr->u, ceedDataPtr->v,
+   CeedOperatorApplyAdd(oper, ceedDataPtr->u, ceedDataPtr->v,
                         CEED_REQUEST_IMMEDIATE);
 
    CeedVectorTakeArray(ceedDataPtr->u, mem, const_cast<CeedScalar**>(&x_ptr));
@@ -29,6 +29,7 @@ class FiniteElementSpace;
 class GridFunction;
 class IntegrationRule;
 class Coefficient;
+class VectorCoefficient;
 
 // Hash table for CeedBasis
 using CeedBasisKey =
@@ -72,10 +73,17 @@ extern CeedBasisMap basis_map;
 extern CeedRestrMap restr_map;
 }
 
-/// A structure used to pass additional data to f_build_diff and f_apply_diff
-struct BuildContext { CeedInt dim, space_dim; CeedScalar coeff; };
+/** A structure used to pass additional data to the 'f_build_*' and 'f_apply_*'
+    Q-functions. The (identical) local copies in the Q-function headers, e.g.
+    mass.h or diffusion.h, have to be kept in sync with this one. */
+struct BuildContext
+{
+   CeedInt dim, space_dim, vdim;
+   CeedScalar coeff;
+   CeedScalar vel[3];
+};
 
-enum class CeedCoeff { Const, Grid };
+enum class CeedCoeff { Const, Grid, VecConst, VecGrid };
 
 struct CeedConstCoeff
 {
@@ -90,6 +98,11 @@ struct CeedGridCoeff
    CeedVector coeffVector;
 };
 
+struct CeedVecConstCoeff
+{
+   double val[3];
+};
+
 struct CeedData
 {
    CeedOperator build_oper, oper;
@@ -114,15 +127,22 @@ struct CeedData
       CeedQFunctionDestroy(&build_qfunc);
       CeedVectorDestroy(&node_coords);
       CeedVectorDestroy(&rho);
-      if (coeff_type==CeedCoeff::Grid)
-      {
-         CeedGridCoeff* c = (CeedGridCoeff*)coeff;
-         CeedVectorDestroy(&c->coeffVector);
-         delete c;
-      }
-      else
+      switch (coeff_type)
       {
-         delete (CeedConstCoeff*)coeff;
+         case CeedCoeff::Const:
+            delete (CeedConstCoeff*)coeff;
+            break;
+         case CeedCoeff::Grid:
+         case CeedCoeff::VecGrid:
+         {
+            CeedGridCoeff* c = (CeedGridCoeff*)coeff;
+            CeedVectorDestroy(&c->coeffVector);
+            delete c;
+            break;
+         }
+         case CeedCoeff::VecConst:
+            delete (CeedVecConstCoeff*)coeff;
+            break;
       }
       CeedVectorDestroy(&u);
       CeedVectorDestroy(&v);
@@ -165,9 +185,14 @@ struct CeedPAOperator
 };
 
 /** @brief Identifies the type of coefficient of the Integrator to initialize
-    accordingly the CeedData. */
+    accordingly the CeedData. A NULL @a Q is treated as the constant
+    coefficient 1.0. */
 void InitCeedCoeff(Coefficient* Q, CeedData* ptr);
 
+/** @brief Identifies the type of vector coefficient of the Integrator to
+    initialize accordingly the CeedData. */
+void InitCeedVecCoeff(VectorCoefficient* VQ, CeedData* ptr);
+
 /// Initialize a CeedBasis and a CeedElemRestriction
 void InitCeedBasisAndRestriction(const FiniteElementSpace &fes,
                                  const IntegrationRule &ir,
@@ -183,11 +208,24 @@ const std::string &GetCeedPath();
 void CeedPAAssemble(const CeedPAOperator& op,
                     CeedData& ceedData);
 
+/** @brief Compose the libCEED operators of the given CeedData objects into
+    one composite operator, so that several integrators over the same space
+    can be applied with a single CeedOperatorApply. */
+void CeedCompositePAOperator(const Array<const CeedData*> &ceedData,
+                             CeedOperator *oper);
+
 /** @brief Function that applies a libCEED PA operator. */
 void CeedAddMultPA(const CeedData *ceedDataPtr,
                    const Vector &x,
                    Vector &y);
 
+/** @brief Function that applies an already composed libCEED operator, e.g. a
+    composite operator, using the work vectors of @a ceedDataPtr. */
+void CeedAddMultPA(CeedOperator oper,
+                   const CeedData *ceedDataPtr,
+                   const Vector &x,
+                   Vector &y);
+
 /** @brief Function that assembles a libCEED PA operator diagonal. */
 void CeedAssembleDiagonalPA(const CeedData *ceedDataPtr,
                             Vector &diag);
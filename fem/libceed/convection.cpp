@@ -0,0 +1,41 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "convection.hpp"
+
+#ifdef MFEM_USE_CEED
+#include "ceed.hpp"
+#include "convection.h"
+
+namespace mfem
+{
+
+void CeedPAConvectionAssemble(const FiniteElementSpace &fes,
+                              const mfem::IntegrationRule &irm,
+                              const double alpha, CeedData& ceedData)
+{
+   CeedInt dim = fes.GetMesh()->SpaceDimension();
+   CeedPAOperator convOp = {fes, irm,
+                            dim, "/convection.h",
+                            ":f_build_conv_const", f_build_conv_const,
+                            ":f_build_conv_grid", f_build_conv_grid,
+                            ":f_apply_conv", f_apply_conv,
+                            CEED_EVAL_GRAD,
+                            CEED_EVAL_INTERP
+                           };
+   // The scaling of the convection integrator is passed in the context.
+   ceedData.build_ctx_data.coeff = alpha;
+   CeedPAAssemble(convOp, ceedData);
+}
+
+} // namespace mfem
+
+#endif // MFEM_USE_CEED
@@ -0,0 +1,205 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+/// A structure used to pass additional data to f_build_conv and f_apply_conv
+struct BuildContext
+{
+   CeedInt dim, space_dim, vdim;
+   CeedScalar coeff;
+   CeedScalar vel[3];
+};
+
+/// libCEED Q-function for building quadrature data for a convection operator
+/// with a constant velocity; the scaling alpha is passed in the coeff field
+/// and the velocity components in the vel field of the context
+CEED_QFUNCTION(f_build_conv_const)(void *ctx, CeedInt Q,
+                                   const CeedScalar *const *in,
+                                   CeedScalar *const *out)
+{
+   BuildContext *bc = (BuildContext*)ctx;
+   // in[0] is Jacobians with shape [dim, nc=dim, Q]
+   // in[1] is quadrature weights, size (Q)
+   //
+   // At every quadrature point, compute qd = alpha qw adj(J) vel, so that the
+   // reference gradient contracted with qd gives alpha (vel . grad u) qw detJ.
+   const CeedScalar alpha = bc->coeff;
+   const CeedScalar *vel = bc->vel;
+   const CeedScalar *J = in[0], *qw = in[1];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 11:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            qd[i] = alpha * qw[i] * vel[0];
+         }
+         break;
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            // J: 0 2   adj(J):  J22 -J12
+            //    1 3           -J21  J11
+            const CeedScalar J11 = J[i + Q * 0];
+            const CeedScalar J21 = J[i + Q * 1];
+            const CeedScalar J12 = J[i + Q * 2];
+            const CeedScalar J22 = J[i + Q * 3];
+            const CeedScalar w = alpha * qw[i];
+            qd[i + Q * 0] = w * ( J22 * vel[0] - J12 * vel[1]);
+            qd[i + Q * 1] = w * (-J21 * vel[0] + J11 * vel[1]);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            // J: 0 3 6
+            //    1 4 7
+            //    2 5 8
+            const CeedScalar J11 = J[i + Q * 0];
+            const CeedScalar J21 = J[i + Q * 1];
+            const CeedScalar J31 = J[i + Q * 2];
+            const CeedScalar J12 = J[i + Q * 3];
+            const CeedScalar J22 = J[i + Q * 4];
+            const CeedScalar J32 = J[i + Q * 5];
+            const CeedScalar J13 = J[i + Q * 6];
+            const CeedScalar J23 = J[i + Q * 7];
+            const CeedScalar J33 = J[i + Q * 8];
+            const CeedScalar A11 = J22 * J33 - J23 * J32;
+            const CeedScalar A12 = J13 * J32 - J12 * J33;
+            const CeedScalar A13 = J12 * J23 - J13 * J22;
+            const CeedScalar A21 = J23 * J31 - J21 * J33;
+            const CeedScalar A22 = J11 * J33 - J13 * J31;
+            const CeedScalar A23 = J13 * J21 - J11 * J23;
+            const CeedScalar A31 = J21 * J32 - J22 * J31;
+            const CeedScalar A32 = J12 * J31 - J11 * J32;
+            const CeedScalar A33 = J11 * J22 - J12 * J21;
+            const CeedScalar w = alpha * qw[i];
+            qd[i + Q * 0] = w * (A11 * vel[0] + A12 * vel[1] + A13 * vel[2]);
+            qd[i + Q * 1] = w * (A21 * vel[0] + A22 * vel[1] + A23 * vel[2]);
+            qd[i + Q * 2] = w * (A31 * vel[0] + A32 * vel[1] + A33 * vel[2]);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for building quadrature data for a convection operator
+/// with a grid function velocity; the scaling alpha is passed in the coeff
+/// field of the context
+CEED_QFUNCTION(f_build_conv_grid)(void *ctx, CeedInt Q,
+                                  const CeedScalar *const *in,
+                                  CeedScalar *const *out)
+{
+   BuildContext *bc = (BuildContext*)ctx;
+   // in[0] is the velocity with shape [nc=dim, Q]
+   // in[1] is Jacobians with shape [dim, nc=dim, Q]
+   // in[2] is quadrature weights, size (Q)
+   //
+   // At every quadrature point, compute qd = alpha qw adj(J) vel, so that the
+   // reference gradient contracted with qd gives alpha (vel . grad u) qw detJ.
+   const CeedScalar alpha = bc->coeff;
+   const CeedScalar *c = in[0], *J = in[1], *qw = in[2];
+   CeedScalar *qd = out[0];
+   switch (bc->dim + 10 * bc->space_dim)
+   {
+      case 11:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            qd[i] = alpha * qw[i] * c[i];
+         }
+         break;
+      case 22:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            // J: 0 2   adj(J):  J22 -J12
+            //    1 3           -J21  J11
+            const CeedScalar v0 = c[i + Q * 0];
+            const CeedScalar v1 = c[i + Q * 1];
+            const CeedScalar J11 = J[i + Q * 0];
+            const CeedScalar J21 = J[i + Q * 1];
+            const CeedScalar J12 = J[i + Q * 2];
+            const CeedScalar J22 = J[i + Q * 3];
+            const CeedScalar w = alpha * qw[i];
+            qd[i + Q * 0] = w * ( J22 * v0 - J12 * v1);
+            qd[i + Q * 1] = w * (-J21 * v0 + J11 * v1);
+         }
+         break;
+      case 33:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            // J: 0 3 6
+            //    1 4 7
+            //    2 5 8
+            const CeedScalar v0 = c[i + Q * 0];
+            const CeedScalar v1 = c[i + Q * 1];
+            const CeedScalar v2 = c[i + Q * 2];
+            const CeedScalar J11 = J[i + Q * 0];
+            const CeedScalar J21 = J[i + Q * 1];
+            const CeedScalar J31 = J[i + Q * 2];
+            const CeedScalar J12 = J[i + Q * 3];
+            const CeedScalar J22 = J[i + Q * 4];
+            const CeedScalar J32 = J[i + Q * 5];
+            const CeedScalar J13 = J[i + Q * 6];
+            const CeedScalar J23 = J[i + Q * 7];
+            const CeedScalar J33 = J[i + Q * 8];
+            const CeedScalar A11 = J22 * J33 - J23 * J32;
+            const CeedScalar A12 = J13 * J32 - J12 * J33;
+            const CeedScalar A13 = J12 * J23 - J13 * J22;
+            const CeedScalar A21 = J23 * J31 - J21 * J33;
+            const CeedScalar A22 = J11 * J33 - J13 * J31;
+            const CeedScalar A23 = J13 * J21 - J11 * J23;
+            const CeedScalar A31 = J21 * J32 - J22 * J31;
+            const CeedScalar A32 = J12 * J31 - J11 * J32;
+            const CeedScalar A33 = J11 * J22 - J12 * J21;
+            const CeedScalar w = alpha * qw[i];
+            qd[i + Q * 0] = w * (A11 * v0 + A12 * v1 + A13 * v2);
+            qd[i + Q * 1] = w * (A21 * v0 + A22 * v1 + A23 * v2);
+            qd[i + Q * 2] = w * (A31 * v0 + A32 * v1 + A33 * v2);
+         }
+         break;
+   }
+   return 0;
+}
+
+/// libCEED Q-function for applying a convection operator
+CEED_QFUNCTION(f_apply_conv)(void *ctx, CeedInt Q,
+                             const CeedScalar *const *in,
+                             CeedScalar *const *out)
+{
+   BuildContext *bc = (BuildContext *)ctx;
+   // in[0] has shape [dim, nc=1, Q], out[0] has shape [nc=1, Q]
+   const CeedScalar *ug = in[0], *qd = in[1];
+   CeedScalar *v = out[0];
+   switch (bc->dim)
+   {
+      case 1:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            v[i] = qd[i] * ug[i];
+         }
+         break;
+      case 2:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            v[i] = qd[i + Q * 0] * ug[i + Q * 0] +
+                   qd[i + Q * 1] * ug[i + Q * 1];
+         }
+         break;
+      case 3:
+         for (CeedInt i = 0; i < Q; i++)
+         {
+            v[i] = qd[i + Q * 0] * ug[i + Q * 0] +
+                   qd[i + Q * 1] * ug[i + Q * 1] +
+                   qd[i + Q * 2] * ug[i + Q * 2];
+         }
+         break;
+   }
+   return 0;
+}
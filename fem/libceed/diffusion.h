@@ -10,7 +10,12 @@
 // CONTRIBUTING.md for details.
 
 /// A structure used to pass additional data to f_build_diff and f_apply_diff
-struct BuildContext { CeedInt dim, space_dim; CeedScalar coeff; };
+struct BuildContext
+{
+   CeedInt dim, space_dim, vdim;
+   CeedScalar coeff;
+   CeedScalar vel[3];
+};
 
 /// libCEED Q-function for building quadrature data for a diffusion operator
 /// with a constant coefficient
@@ -0,0 +1,39 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "vecdiffusion.hpp"
+
+#ifdef MFEM_USE_CEED
+#include "ceed.hpp"
+#include "vecdiffusion.h"
+
+namespace mfem
+{
+
+void CeedPAVectorDiffusionAssemble(const FiniteElementSpace &fes,
+                                   const mfem::IntegrationRule &irm,
+                                   CeedData& ceedData)
+{
+   CeedInt dim = fes.GetMesh()->SpaceDimension();
+   CeedPAOperator vecDiffOp = {fes, irm,
+                               dim * (dim + 1) / 2, "/vecdiffusion.h",
+                               ":f_build_vecdiff_const", f_build_vecdiff_const,
+                               ":f_build_vecdiff_grid", f_build_vecdiff_grid,
+                               ":f_apply_vecdiff", f_apply_vecdiff,
+                               CEED_EVAL_GRAD,
+                               CEED_EVAL_GRAD
+                              };
+   CeedPAAssemble(vecDiffOp, ceedData);
+}
+
+} // namespace mfem
+
+#endif // MFEM_USE_CEED
@@ -0,0 +1,38 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "vecmass.hpp"
+
+#ifdef MFEM_USE_CEED
+#include "ceed.hpp"
+#include "vecmass.h"
+
+namespace mfem
+{
+
+void CeedPAVectorMassAssemble(const FiniteElementSpace &fes,
+                              const mfem::IntegrationRule &irm,
+                              CeedData& ceedData)
+{
+   CeedPAOperator vecMassOp = {fes, irm,
+                               1, "/vecmass.h",
+                               ":f_build_vecmass_const", f_build_vecmass_const,
+                               ":f_build_vecmass_grid", f_build_vecmass_grid,
+                               ":f_apply_vecmass", f_apply_vecmass,
+                               CEED_EVAL_INTERP,
+                               CEED_EVAL_INTERP
+                              };
+   CeedPAAssemble(vecMassOp, ceedData);
+}
+
+} // namespace mfem
+
+#endif // MFEM_USE_CEED
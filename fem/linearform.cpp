@@ -76,10 +76,83 @@ void LinearForm::AddBdrFaceIntegrator(LinearFormIntegrator *lfi,
    flfi_marker.Append(&bdr_attr_marker);
 }
 
+bool LinearForm::SupportsDevice() const
+{
+   // The device fast path covers only the common domain and boundary
+   // integrals; delta and boundary face integrators use the legacy path.
+   if (dlfi_delta.Size() || flfi.Size()) { return false; }
+   if (dlfi.Size() == 0 && blfi.Size() == 0) { return false; }
+   for (int k = 0; k < dlfi.Size(); k++)
+   {
+      if (!dlfi[k]->SupportsDevice()) { return false; }
+   }
+   for (int k = 0; k < blfi.Size(); k++)
+   {
+      if (!blfi[k]->SupportsDevice()) { return false; }
+   }
+   Mesh &mesh = *fes->GetMesh();
+   const int dim = mesh.Dimension();
+   if (mesh.GetNE() == 0 || dim == 1) { return false; }
+   if (mesh.GetNumGeometries(dim) > 1) { return false; }
+   // The element and face restriction operators require a tensor-product
+   // basis; the boundary face restriction also requires a conforming mesh.
+   const FiniteElement *fe = fes->GetFE(0);
+   if (dynamic_cast<const TensorBasisElement*>(fe) == NULL) { return false; }
+   if (blfi.Size() && !mesh.Conforming()) { return false; }
+   return true;
+}
+
+void LinearForm::AssembleDevice()
+{
+   Vector::operator=(0.0);
+
+   if (dlfi.Size())
+   {
+      const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
+      const Operator *elem_restrict = fes->GetElementRestriction(ordering);
+      Vector b_e;
+      b_e.SetSize(elem_restrict->Height(), Device::GetMemoryType());
+      b_e.UseDevice(true);
+      b_e = 0.0;
+      for (int k = 0; k < dlfi.Size(); k++)
+      {
+         dlfi[k]->AssembleDevice(*fes, b_e);
+      }
+      elem_restrict->MultTranspose(b_e, *this);
+   }
+
+   if (blfi.Size())
+   {
+      Mesh *mesh = fes->GetMesh();
+      const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
+      const Operator *face_restrict =
+         fes->GetFaceRestriction(ordering, FaceType::Boundary,
+                                 L2FaceValues::SingleValued);
+      Vector b_f;
+      b_f.SetSize(face_restrict->Height(), Device::GetMemoryType());
+      b_f.UseDevice(true);
+      b_f = 0.0;
+      Array<int> markers(mesh->bdr_attributes.Size() ?
+                         mesh->bdr_attributes.Max() : 0);
+      for (int k = 0; k < blfi.Size(); k++)
+      {
+         if (blfi_marker[k] == NULL) { markers = 1; }
+         else { blfi_marker[k]->Copy(markers); }
+         blfi[k]->AssembleDevice(*fes, markers, b_f);
+      }
+      // H1FaceRestriction::MultTranspose() adds to the output vector.
+      face_restrict->MultTranspose(b_f, *this);
+   }
+}
+
 void LinearForm::Assemble()
 {
+   if (SupportsDevice()) { return AssembleDevice(); }
+
    Array<int> vdofs;
-   ElementTransformation *eltrans;
+   // Use caller-owned transformation objects instead of the shared ones in
+   // the Mesh, keeping the loops below safe to split between threads.
+   IsoparametricTransformation eltrans;
    Vector elemvect;
 
    int i;
@@ -95,10 +168,10 @@ void LinearForm::Assemble()
       for (i = 0; i < fes -> GetNE(); i++)
       {
          fes -> GetElementVDofs (i, vdofs);
-         eltrans = fes -> GetElementTransformation (i);
+         fes -> GetElementTransformation (i, &eltrans);
          for (int k=0; k < dlfi.Size(); k++)
          {
-            dlfi[k]->AssembleRHSElementVect(*fes->GetFE(i), *eltrans, elemvect);
+            dlfi[k]->AssembleRHSElementVect(*fes->GetFE(i), eltrans, elemvect);
             AddElementVector (vdofs, elemvect);
          }
       }
@@ -135,13 +208,13 @@ void LinearForm::Assemble()
          const int bdr_attr = mesh->GetBdrAttribute(i);
          if (bdr_attr_marker[bdr_attr-1] == 0) { continue; }
          fes -> GetBdrElementVDofs (i, vdofs);
-         eltrans = fes -> GetBdrElementTransformation (i);
+         fes -> GetBdrElementTransformation (i, &eltrans);
          for (int k=0; k < blfi.Size(); k++)
          {
             if (blfi_marker[k] &&
                 (*blfi_marker[k])[bdr_attr-1] == 0) { continue; }
 
-            blfi[k]->AssembleRHSElementVect(*fes->GetBE(i), *eltrans, elemvect);
+            blfi[k]->AssembleRHSElementVect(*fes->GetBE(i), eltrans, elemvect);
 
             AddElementVector (vdofs, elemvect);
          }
@@ -149,7 +222,8 @@ void LinearForm::Assemble()
    }
    if (flfi.Size())
    {
-      FaceElementTransformations *tr;
+      FaceElementTransformations tr;
+      IsoparametricTransformation eltr1, eltr2;
       Mesh *mesh = fes->GetMesh();
 
       // Which boundary attributes need to be processed?
@@ -178,17 +252,16 @@ void LinearForm::Assemble()
          const int bdr_attr = mesh->GetBdrAttribute(i);
          if (bdr_attr_marker[bdr_attr-1] == 0) { continue; }
 
-         tr = mesh->GetBdrFaceTransformations(i);
-         if (tr != NULL)
+         if (mesh->GetBdrFaceTransformations(i, tr, eltr1, eltr2))
          {
-            fes -> GetElementVDofs (tr -> Elem1No, vdofs);
+            fes -> GetElementVDofs (tr.Elem1No, vdofs);
             for (int k = 0; k < flfi.Size(); k++)
             {
                if (flfi_marker[k] &&
                    (*flfi_marker[k])[bdr_attr-1] == 0) { continue; }
 
-               flfi[k] -> AssembleRHSElementVect (*fes->GetFE(tr -> Elem1No),
-                                                  *tr, elemvect);
+               flfi[k] -> AssembleRHSElementVect (*fes->GetFE(tr.Elem1No),
+                                                  tr, elemvect);
                AddElementVector (vdofs, elemvect);
             }
          }
@@ -265,6 +338,29 @@ LinearForm & LinearForm::operator=(const Vector &v)
    return *this;
 }
 
+LinearForm &LinearForm::operator=(LinearForm &&rhs)
+{
+   if (this != &rhs)
+   {
+      // Swap the full state with rhs; the integrators previously owned by
+      // this form are then deleted when rhs is destroyed.
+      Vector tmp(std::move(*this));
+      Vector::operator=(std::move(rhs));
+      static_cast<Vector&>(rhs) = std::move(tmp);
+      mfem::Swap(fes, rhs.fes);
+      mfem::Swap(extern_lfs, rhs.extern_lfs);
+      mfem::Swap(dlfi, rhs.dlfi);
+      mfem::Swap(dlfi_delta, rhs.dlfi_delta);
+      mfem::Swap(blfi, rhs.blfi);
+      mfem::Swap(blfi_marker, rhs.blfi_marker);
+      mfem::Swap(flfi, rhs.flfi);
+      mfem::Swap(flfi_marker, rhs.flfi_marker);
+      mfem::Swap(dlfi_delta_elem_id, rhs.dlfi_delta_elem_id);
+      mfem::Swap(dlfi_delta_ip, rhs.dlfi_delta_ip);
+   }
+   return *this;
+}
+
 LinearForm::~LinearForm()
 {
    if (!extern_lfs)
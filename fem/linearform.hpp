@@ -56,6 +56,16 @@ protected:
    /// Force (re)computation of delta locations.
    void ResetDeltaLocations() { dlfi_delta_elem_id.SetSize(0); }
 
+   /** @brief Return true if the form can be assembled with the device fast
+       path in AssembleDevice(), i.e. all its integrators support device
+       assembly and the FE space uses tensor-product elements. */
+   bool SupportsDevice() const;
+
+   /** @brief Assemble the form with batched kernels: the integrators add
+       their element contributions to an E-vector which is then gathered with
+       the (race-free) transposed element/face restriction operators. */
+   void AssembleDevice();
+
 private:
    /// Copy construction is not supported; body is undefined.
    LinearForm(const LinearForm &);
@@ -89,6 +99,24 @@ public:
    LinearForm(FiniteElementSpace *f, double *data) : Vector(data, f->GetVSize())
    { fes = f; extern_lfs = 0; }
 
+   /// Move constructor. "Steals" the data and the integrators from @a rhs.
+   LinearForm(LinearForm &&rhs) : Vector(std::move(rhs))
+   {
+      fes = rhs.fes;
+      extern_lfs = rhs.extern_lfs;
+      mfem::Swap(dlfi, rhs.dlfi);
+      mfem::Swap(dlfi_delta, rhs.dlfi_delta);
+      mfem::Swap(blfi, rhs.blfi);
+      mfem::Swap(blfi_marker, rhs.blfi_marker);
+      mfem::Swap(flfi, rhs.flfi);
+      mfem::Swap(flfi_marker, rhs.flfi_marker);
+      mfem::Swap(dlfi_delta_elem_id, rhs.dlfi_delta_elem_id);
+      mfem::Swap(dlfi_delta_ip, rhs.dlfi_delta_ip);
+   }
+
+   /// Move assignment. "Steals" the data and the integrators from @a rhs.
+   LinearForm &operator=(LinearForm &&rhs);
+
    /// Copy assignment. Only the data of the base class Vector is copied.
    /** It is assumed that this object and @a rhs use FiniteElementSpace%s that
        have the same size.
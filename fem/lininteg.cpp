@@ -16,6 +16,20 @@
 namespace mfem
 {
 
+void LinearFormIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                          Vector &b)
+{
+   mfem_error ("LinearFormIntegrator::AssembleDevice(...)\n"
+               "   is not implemented for this class.");
+}
+
+void LinearFormIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                          const Array<int> &markers, Vector &b)
+{
+   mfem_error ("LinearFormIntegrator::AssembleDevice(...)\n"
+               "   is not implemented for this class.");
+}
+
 void LinearFormIntegrator::AssembleRHSElementVect(
    const FiniteElement &el, FaceElementTransformations &Tr, Vector &elvect)
 {
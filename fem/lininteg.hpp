@@ -18,6 +18,8 @@
 namespace mfem
 {
 
+class FiniteElementSpace;
+
 /// Abstract base class LinearFormIntegrator
 class LinearFormIntegrator
 {
@@ -27,6 +29,22 @@ protected:
    LinearFormIntegrator(const IntegrationRule *ir = NULL) { IntRule = ir; }
 
 public:
+   /// Method probing for assembly on device
+   virtual bool SupportsDevice() const { return false; }
+
+   /// Method defining assembly on device for domain integrators
+   /** Add the contribution of all mesh elements to the E-vector @a b; the
+       result is gathered into an L-vector by the caller using
+       ElementRestriction::MultTranspose(). */
+   virtual void AssembleDevice(const FiniteElementSpace &fes, Vector &b);
+
+   /// Method defining assembly on device for boundary integrators
+   /** Add the contribution of the boundary elements with attributes marked in
+       @a markers to the boundary face E-vector @a b; the result is gathered
+       into an L-vector by the caller using the boundary face restriction. */
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
    /** Given a particular Finite Element and a transformation (Tr)
        computes the element vector, elvect. */
    virtual void AssembleRHSElementVect(const FiniteElement &el,
@@ -106,6 +124,10 @@ public:
    DomainLFIntegrator(Coefficient &QF, const IntegrationRule *ir)
       : DeltaLFIntegrator(QF, ir), Q(QF), oa(1), ob(1) { }
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes, Vector &b);
+
    /** Given a particular Finite Element and a transformation (Tr)
        computes the element right hand side element vector, elvect. */
    virtual void AssembleRHSElementVect(const FiniteElement &el,
@@ -116,6 +138,7 @@ public:
                                          ElementTransformation &Trans,
                                          Vector &elvect);
 
+   using LinearFormIntegrator::AssembleDevice;
    using LinearFormIntegrator::AssembleRHSElementVect;
 };
 
@@ -158,11 +181,18 @@ public:
    BoundaryLFIntegrator(Coefficient &QG, int a = 1, int b = 1)
       : Q(QG), oa(a), ob(b) { }
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes,
+                               const Array<int> &markers, Vector &b);
+
    /** Given a particular boundary Finite Element and a transformation (Tr)
        computes the element boundary vector, elvect. */
    virtual void AssembleRHSElementVect(const FiniteElement &el,
                                        ElementTransformation &Tr,
                                        Vector &elvect);
+
+   using LinearFormIntegrator::AssembleDevice;
    virtual void AssembleRHSElementVect(const FiniteElement &el,
                                        FaceElementTransformations &Tr,
                                        Vector &elvect);
@@ -217,6 +247,10 @@ public:
    VectorDomainLFIntegrator(VectorCoefficient &QF)
       : DeltaLFIntegrator(QF), Q(QF) { }
 
+   virtual bool SupportsDevice() const { return true; }
+
+   virtual void AssembleDevice(const FiniteElementSpace &fes, Vector &b);
+
    /** Given a particular Finite Element and a transformation (Tr)
        computes the element right hand side element vector, elvect. */
    virtual void AssembleRHSElementVect(const FiniteElement &el,
@@ -227,6 +261,7 @@ public:
                                          ElementTransformation &Trans,
                                          Vector &elvect);
 
+   using LinearFormIntegrator::AssembleDevice;
    using LinearFormIntegrator::AssembleRHSElementVect;
 };
 
@@ -0,0 +1,232 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Device assembly of the (f, v) boundary linear form integrator.
+
+#include "../general/forall.hpp"
+#include "fem.hpp"
+
+namespace mfem
+{
+
+// Batched (f, v) assembly into the boundary face E-vector for 2D meshes,
+// where the boundary faces are segments. Faces with a zero marker are
+// skipped.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void LFBoundaryAssemble2D(const int NF,
+                                 const Array<double> &bt,
+                                 const Array<double> &w,
+                                 const Vector &detj,
+                                 const Array<int> &m,
+                                 const Vector &c_,
+                                 Vector &y_,
+                                 const int d1d = 0,
+                                 const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool const_c = c_.Size() == 1;
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto W = w.Read();
+   auto detJ = Reshape(detj.Read(), Q1D, NF);
+   auto M = m.Read();
+   auto C = const_c ? Reshape(c_.Read(), 1, 1) : Reshape(c_.Read(), Q1D, NF);
+   auto Y = Reshape(y_.ReadWrite(), D1D, NF);
+   MFEM_FORALL(f, NF,
+   {
+      if (M[f] == 0) { return; } // the face is not marked
+
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         double u = 0.0;
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const double coeff = const_c ? C(0, 0) : C(qx, f);
+            u += Bt(dx, qx) * W[qx] * coeff * detJ(qx, f);
+         }
+         Y(dx, f) += u;
+      }
+   });
+}
+
+// Batched (f, v) assembly into the boundary face E-vector for 3D meshes,
+// where the boundary faces are quadrilaterals.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void LFBoundaryAssemble3D(const int NF,
+                                 const Array<double> &bt,
+                                 const Array<double> &w,
+                                 const Vector &detj,
+                                 const Array<int> &m,
+                                 const Vector &c_,
+                                 Vector &y_,
+                                 const int d1d = 0,
+                                 const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool const_c = c_.Size() == 1;
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D);
+   auto detJ = Reshape(detj.Read(), Q1D, Q1D, NF);
+   auto M = m.Read();
+   auto C = const_c ? Reshape(c_.Read(), 1, 1, 1) :
+            Reshape(c_.Read(), Q1D, Q1D, NF);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NF);
+   MFEM_FORALL(f, NF,
+   {
+      if (M[f] == 0) { return; } // the face is not marked
+
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double QD[max_Q1D][max_D1D];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            double u = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double coeff = const_c ? C(0, 0, 0) : C(qx, qy, f);
+               u += Bt(dx, qx) * W(qx, qy) * coeff * detJ(qx, qy, f);
+            }
+            QD[qy][dx] = u;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            double u = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               u += Bt(dy, qy) * QD[qy][dx];
+            }
+            Y(dx, dy, f) += u;
+         }
+      }
+   });
+}
+
+void BoundaryLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                          const Array<int> &markers,
+                                          Vector &b)
+{
+   Mesh &mesh = *fes.GetMesh();
+   const int dim = mesh.Dimension();
+   const int nf = fes.GetNFbyType(FaceType::Boundary);
+   if (nf == 0) { return; }
+   const FiniteElement &el = *fes.GetFaceElement(0);
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(),
+                                             oa * el.GetOrder() + ob);
+   const int nq = ir->GetNPoints();
+   const FaceGeometricFactors *geom =
+      mesh.GetFaceGeometricFactors(*ir, FaceGeometricFactors::DETERMINANTS,
+                                   FaceType::Boundary);
+   const DofToQuad &maps = el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   const int D1D = maps.ndof;
+   const int Q1D = maps.nqpt;
+
+   // Map the boundary faces, in the face restriction ordering, i.e. by
+   // increasing mesh face index, to their boundary elements.
+   Array<int> face_to_be(mesh.GetNumFaces());
+   face_to_be = -1;
+   for (int be = 0; be < mesh.GetNBE(); ++be)
+   {
+      int f, o;
+      if (dim == 3) { mesh.GetBdrElementFace(be, &f, &o); }
+      else { f = mesh.GetBdrElementEdgeIndex(be); }
+      face_to_be[f] = be;
+   }
+
+   // Attribute markers and coefficient values for each boundary face. The
+   // face restriction and the face geometric factors use the lexicographic
+   // ordering of the face as seen from the adjacent element, see
+   // GetFaceDofs() in restriction.cpp, so the coefficient is evaluated with
+   // the element transformation at the matching reference points.
+   Array<int> face_markers(nf);
+   Vector coeff;
+   ConstantCoefficient *cQ = dynamic_cast<ConstantCoefficient*>(&Q);
+   if (cQ) { coeff.SetSize(1); coeff(0) = cQ->constant; }
+   else { coeff.SetSize(nq * nf); }
+   auto C = Reshape(coeff.HostWrite(), nq, cQ ? 1 : nf);
+   int f_ind = 0;
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      const int be = face_to_be[f];
+      if (be < 0) { continue; }
+      const int bdr_attr = mesh.GetBdrAttribute(be);
+      const int marker = markers[bdr_attr-1];
+      face_markers[f_ind] = marker;
+      if (!cQ && marker)
+      {
+         int e, e2, inf, inf2;
+         mesh.GetFaceElements(f, &e, &e2);
+         mesh.GetFaceInfos(f, &inf, &inf2);
+         const int face_id = inf/64;
+         ElementTransformation &T = *mesh.GetElementTransformation(e);
+         for (int q = 0; q < nq; ++q)
+         {
+            const IntegrationPoint &fip = ir->IntPoint(q);
+            IntegrationPoint ip;
+            if (dim == 2)
+            {
+               switch (face_id)
+               {
+                  case 0: ip.Set2(fip.x, 0.0);   break; // SOUTH
+                  case 1: ip.Set2(1.0,   fip.x); break; // EAST
+                  case 2: ip.Set2(fip.x, 1.0);   break; // NORTH
+                  case 3: ip.Set2(0.0,   fip.x); break; // WEST
+               }
+            }
+            else
+            {
+               switch (face_id)
+               {
+                  case 0: ip.Set3(fip.x, fip.y, 0.0);   break; // BOTTOM
+                  case 1: ip.Set3(fip.x, 0.0,   fip.y); break; // SOUTH
+                  case 2: ip.Set3(1.0,   fip.x, fip.y); break; // EAST
+                  case 3: ip.Set3(fip.x, 1.0,   fip.y); break; // NORTH
+                  case 4: ip.Set3(0.0,   fip.x, fip.y); break; // WEST
+                  case 5: ip.Set3(fip.x, fip.y, 1.0);   break; // TOP
+               }
+            }
+            T.SetIntPoint(&ip);
+            C(q, f_ind) = Q.Eval(T, ip);
+         }
+      }
+      f_ind++;
+   }
+   MFEM_VERIFY(f_ind == nf, "incorrect number of boundary faces");
+
+   if (dim == 2)
+   {
+      return LFBoundaryAssemble2D(nf, maps.Bt, ir->GetWeights(), geom->detJ,
+                                  face_markers, coeff, b, D1D, Q1D);
+   }
+   if (dim == 3)
+   {
+      return LFBoundaryAssemble3D(nf, maps.Bt, ir->GetWeights(), geom->detJ,
+                                  face_markers, coeff, b, D1D, Q1D);
+   }
+   MFEM_ABORT("Not supported.");
+}
+
+} // namespace mfem
@@ -0,0 +1,312 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Device assembly of the (f, v) domain linear form integrators.
+
+#include "../general/forall.hpp"
+#include "fem.hpp"
+
+namespace mfem
+{
+
+// Batched (f, v) assembly into the E-vector, 2D case. The coefficient values
+// are either constant (c_ has vdim entries) or given at all quadrature points.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void LFDomainAssemble2D(const int NE,
+                               const int vdim,
+                               const Array<double> &bt,
+                               const Array<double> &w,
+                               const Vector &j,
+                               const Vector &c_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool const_c = c_.Size() == vdim;
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D);
+   auto J = Reshape(j.Read(), Q1D, Q1D, 2, 2, NE);
+   auto C = const_c ? Reshape(c_.Read(), 1, 1, vdim, 1) :
+            Reshape(c_.Read(), Q1D, Q1D, vdim, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, vdim, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double Z[max_Q1D][max_Q1D];
+      double QD[max_Q1D][max_D1D];
+      for (int c = 0; c < vdim; ++c)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double J11 = J(qx, qy, 0, 0, e);
+               const double J12 = J(qx, qy, 1, 0, e);
+               const double J21 = J(qx, qy, 0, 1, e);
+               const double J22 = J(qx, qy, 1, 1, e);
+               const double detJ = (J11 * J22) - (J21 * J12);
+               const double coeff =
+                  const_c ? C(0, 0, c, 0) : C(qx, qy, c, e);
+               Z[qy][qx] = W(qx, qy) * coeff * detJ;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               double u = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  u += Bt(dx, qx) * Z[qy][qx];
+               }
+               QD[qy][dx] = u;
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               double u = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  u += Bt(dy, qy) * QD[qy][dx];
+               }
+               Y(dx, dy, c, e) += u;
+            }
+         }
+      }
+   });
+}
+
+// Batched (f, v) assembly into the E-vector, 3D case.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void LFDomainAssemble3D(const int NE,
+                               const int vdim,
+                               const Array<double> &bt,
+                               const Array<double> &w,
+                               const Vector &j,
+                               const Vector &c_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   const bool const_c = c_.Size() == vdim;
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto W = Reshape(w.Read(), Q1D, Q1D, Q1D);
+   auto J = Reshape(j.Read(), Q1D, Q1D, Q1D, 3, 3, NE);
+   auto C = const_c ? Reshape(c_.Read(), 1, 1, 1, vdim, 1) :
+            Reshape(c_.Read(), Q1D, Q1D, Q1D, vdim, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, vdim, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double Z[max_Q1D][max_Q1D][max_Q1D];
+      double QQD[max_Q1D][max_Q1D][max_D1D];
+      double QDD[max_Q1D][max_D1D][max_D1D];
+      for (int c = 0; c < vdim; ++c)
+      {
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double J11 = J(qx, qy, qz, 0, 0, e);
+                  const double J21 = J(qx, qy, qz, 1, 0, e);
+                  const double J31 = J(qx, qy, qz, 2, 0, e);
+                  const double J12 = J(qx, qy, qz, 0, 1, e);
+                  const double J22 = J(qx, qy, qz, 1, 1, e);
+                  const double J32 = J(qx, qy, qz, 2, 1, e);
+                  const double J13 = J(qx, qy, qz, 0, 2, e);
+                  const double J23 = J(qx, qy, qz, 1, 2, e);
+                  const double J33 = J(qx, qy, qz, 2, 2, e);
+                  const double detJ = J11 * (J22 * J33 - J32 * J23) -
+                  /* */               J21 * (J12 * J33 - J32 * J13) +
+                  /* */               J31 * (J12 * J23 - J22 * J13);
+                  const double coeff =
+                     const_c ? C(0, 0, 0, c, 0) : C(qx, qy, qz, c, e);
+                  Z[qz][qy][qx] = W(qx, qy, qz) * coeff * detJ;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  double u = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     u += Bt(dx, qx) * Z[qz][qy][qx];
+                  }
+                  QQD[qz][qy][dx] = u;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  double u = 0.0;
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     u += Bt(dy, qy) * QQD[qz][qy][dx];
+                  }
+                  QDD[qz][dy][dx] = u;
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  double u = 0.0;
+                  for (int qz = 0; qz < Q1D; ++qz)
+                  {
+                     u += Bt(dz, qz) * QDD[qz][dy][dx];
+                  }
+                  Y(dx, dy, dz, c, e) += u;
+               }
+            }
+         }
+      }
+   });
+}
+
+static void LFDomainAssemble(const FiniteElementSpace &fes,
+                             const IntegrationRule *ir,
+                             const int vdim,
+                             const Vector &coeff,
+                             Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int dim = mesh->Dimension();
+   const int ne = mesh->GetNE();
+   const FiniteElement &el = *fes.GetFE(0);
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS);
+   const DofToQuad &maps = el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   const int D1D = maps.ndof;
+   const int Q1D = maps.nqpt;
+   if (dim == 2)
+   {
+      return LFDomainAssemble2D(ne, vdim, maps.Bt, ir->GetWeights(),
+                                geom->J, coeff, b, D1D, Q1D);
+   }
+   if (dim == 3)
+   {
+      return LFDomainAssemble3D(ne, vdim, maps.Bt, ir->GetWeights(),
+                                geom->J, coeff, b, D1D, Q1D);
+   }
+   MFEM_ABORT("Not supported.");
+}
+
+void DomainLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                        Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int ne = mesh->GetNE();
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(),
+                                             oa * el.GetOrder() + ob);
+   const int nq = ir->GetNPoints();
+   Vector coeff;
+   if (ConstantCoefficient *cQ = dynamic_cast<ConstantCoefficient*>(&Q))
+   {
+      coeff.SetSize(1);
+      coeff(0) = cQ->constant;
+   }
+   else if (QuadratureFunctionCoefficient *cQ =
+               dynamic_cast<QuadratureFunctionCoefficient*>(&Q))
+   {
+      const QuadratureFunction &qFun = cQ->GetQuadFunction();
+      MFEM_VERIFY(qFun.Size() == nq * ne,
+                  "Incompatible QuadratureFunction dimension \n");
+      MFEM_VERIFY(ir == &qFun.GetSpace()->GetElementIntRule(0),
+                  "IntegrationRule used within integrator and in"
+                  " QuadratureFunction appear to be different");
+      qFun.Read();
+      coeff.MakeRef(const_cast<QuadratureFunction &>(qFun), 0);
+   }
+   else
+   {
+      coeff.SetSize(nq * ne);
+      auto C = Reshape(coeff.HostWrite(), nq, ne);
+      for (int e = 0; e < ne; ++e)
+      {
+         ElementTransformation &T = *fes.GetElementTransformation(e);
+         for (int q = 0; q < nq; ++q)
+         {
+            C(q, e) = Q.Eval(T, ir->IntPoint(q));
+         }
+      }
+   }
+   LFDomainAssemble(fes, ir, 1, coeff, b);
+}
+
+void VectorDomainLFIntegrator::AssembleDevice(const FiniteElementSpace &fes,
+                                              Vector &b)
+{
+   Mesh *mesh = fes.GetMesh();
+   const int ne = mesh->GetNE();
+   const int vdim = Q.GetVDim();
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule *ir = IntRule ? IntRule :
+                               &IntRules.Get(el.GetGeomType(),
+                                             2 * el.GetOrder());
+   const int nq = ir->GetNPoints();
+   Vector coeff;
+   if (VectorConstantCoefficient *cQ =
+          dynamic_cast<VectorConstantCoefficient*>(&Q))
+   {
+      coeff = cQ->GetVec();
+   }
+   else
+   {
+      coeff.SetSize(nq * vdim * ne);
+      Vector qvec(vdim);
+      auto C = Reshape(coeff.HostWrite(), nq, vdim, ne);
+      for (int e = 0; e < ne; ++e)
+      {
+         ElementTransformation &T = *fes.GetElementTransformation(e);
+         for (int q = 0; q < nq; ++q)
+         {
+            Q.Eval(qvec, T, ir->IntPoint(q));
+            for (int c = 0; c < vdim; ++c) { C(q, c, e) = qvec(c); }
+         }
+      }
+   }
+   LFDomainAssemble(fes, ir, vdim, coeff, b);
+}
+
+} // namespace mfem
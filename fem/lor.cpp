@@ -0,0 +1,181 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "lor.hpp"
+
+namespace mfem
+{
+
+// Determine the order and mesh point basis of the LOR refinement for the
+// high-order space 'fes_ho'. Only H1 spaces are supported; for a positive
+// (Bernstein) basis there are no nodal points, so closed uniform points are
+// used for the refined mesh instead.
+static int GetLORRefinement(const FiniteElementSpace &fes_ho, int &ref_type)
+{
+   const H1_FECollection *h1_fec =
+      dynamic_cast<const H1_FECollection*>(fes_ho.FEColl());
+   MFEM_VERIFY(h1_fec != NULL, "LOR discretization requires an H1 space");
+   MFEM_VERIFY(fes_ho.Conforming(),
+               "LOR discretization requires a conforming mesh: the refined "
+               "mesh would not match the high-order dofs across a "
+               "nonconforming interface");
+   MFEM_VERIFY(fes_ho.GetNE() > 0, "empty mesh is not supported");
+   if (h1_fec->GetBasisType() == BasisType::Positive)
+   {
+      ref_type = BasisType::ClosedUniform;
+   }
+   return fes_ho.GetOrder(0);
+}
+
+LORDiscretization::LORDiscretization()
+   : a_ho(NULL), ess_tdof_list(NULL),
+     mesh_lor(NULL), fec_lor(NULL), fes_lor(NULL), a_lor(NULL)
+{ }
+
+LORDiscretization::LORDiscretization(BilinearForm &a_ho_,
+                                     const Array<int> &ess_tdofs, int ref_type)
+   : LORDiscretization()
+{
+   a_ho = &a_ho_;
+   ess_tdof_list = &ess_tdofs;
+   FiniteElementSpace &fes_ho = *a_ho->FESpace();
+   const int order = GetLORRefinement(fes_ho, ref_type);
+
+   Mesh *mesh_ho = fes_ho.GetMesh();
+   mesh_lor = new Mesh(mesh_ho, order, ref_type);
+   fec_lor = new H1_FECollection(1, mesh_ho->Dimension());
+   fes_lor = new FiniteElementSpace(mesh_lor, fec_lor, fes_ho.GetVDim(),
+                                    fes_ho.GetOrdering());
+   a_lor = new BilinearForm(fes_lor);
+   ShareIntegrators();
+   a_lor->UsePrecomputedSparsity();
+   LORDiscretization::AssembleSystem();
+}
+
+void LORDiscretization::ShareIntegrators()
+{
+   MFEM_VERIFY(a_ho->GetBBFI()->Size() == 0 && a_ho->GetFBFI()->Size() == 0 &&
+               a_ho->GetBFBFI()->Size() == 0,
+               "LOR discretization supports only domain integrators");
+   Array<BilinearFormIntegrator*> &dbfi = *a_ho->GetDBFI();
+   for (int i = 0; i < dbfi.Size(); i++)
+   {
+      a_lor->AddDomainIntegrator(dbfi[i]);
+   }
+}
+
+void LORDiscretization::AssembleSystem()
+{
+   if (A.Ptr())
+   {
+      // Reassembly: the sparsity pattern of the matrix, including the
+      // structure created by the essential dof elimination, is reused and the
+      // values are refilled in place, so 'A' keeps pointing to the same
+      // SparseMatrix.
+      *a_lor = 0.0;
+      a_lor->Assemble();
+      // use the same diagonal policy as FormSystemMatrix did on first assembly
+      a_lor->EliminateVDofs(*ess_tdof_list, Operator::DIAG_KEEP);
+   }
+   else
+   {
+      a_lor->Assemble();
+      a_lor->FormSystemMatrix(*ess_tdof_list, A);
+   }
+}
+
+LORDiscretization::~LORDiscretization()
+{
+   if (a_lor)
+   {
+      // The domain integrators are owned by the high-order form.
+      a_lor->GetDBFI()->DeleteAll();
+      delete a_lor;
+   }
+   delete fes_lor;
+   delete fec_lor;
+   delete mesh_lor;
+}
+
+#ifdef MFEM_USE_MPI
+
+ParLORDiscretization::ParLORDiscretization(ParBilinearForm &a_ho_,
+                                           const Array<int> &ess_tdofs,
+                                           int ref_type)
+{
+   a_ho = &a_ho_;
+   ess_tdof_list = &ess_tdofs;
+   ParFiniteElementSpace &fes_ho = *a_ho_.ParFESpace();
+   const int order = GetLORRefinement(fes_ho, ref_type);
+
+   ParMesh *pmesh_lor = new ParMesh(fes_ho.GetParMesh(), order, ref_type);
+   mesh_lor = pmesh_lor;
+   fec_lor = new H1_FECollection(1, pmesh_lor->Dimension());
+   ParFiniteElementSpace *pfes_lor =
+      new ParFiniteElementSpace(pmesh_lor, fec_lor, fes_ho.GetVDim(),
+                                fes_ho.GetOrdering());
+   fes_lor = pfes_lor;
+   pa_lor = new ParBilinearForm(pfes_lor);
+   a_lor = pa_lor;
+   ShareIntegrators();
+   a_lor->UsePrecomputedSparsity();
+   ParLORDiscretization::AssembleSystem();
+}
+
+void ParLORDiscretization::AssembleSystem()
+{
+   if (A.Ptr())
+   {
+      pa_lor->Update();
+      pa_lor->UsePrecomputedSparsity();
+      A.Clear();
+   }
+   pa_lor->Assemble();
+   pa_lor->FormSystemMatrix(*ess_tdof_list, A);
+}
+
+#endif // MFEM_USE_MPI
+
+LORSolver::LORSolver(BilinearForm &a_ho, const Array<int> &ess_tdofs,
+                     Solver *solver_, bool own_solver_, int ref_type)
+   : solver(solver_), own_solver(own_solver_)
+{
+   lor = new LORDiscretization(a_ho, ess_tdofs, ref_type);
+   height = width = lor->GetAssembledSystem().Ptr()->Height();
+   solver->SetOperator(*lor->GetAssembledSystem().Ptr());
+}
+
+#ifdef MFEM_USE_MPI
+
+LORSolver::LORSolver(ParBilinearForm &a_ho, const Array<int> &ess_tdofs,
+                     Solver *solver_, bool own_solver_, int ref_type)
+   : solver(solver_), own_solver(own_solver_)
+{
+   lor = new ParLORDiscretization(a_ho, ess_tdofs, ref_type);
+   height = width = lor->GetAssembledSystem().Ptr()->Height();
+   solver->SetOperator(*lor->GetAssembledSystem().Ptr());
+}
+
+#endif // MFEM_USE_MPI
+
+void LORSolver::ReassembleSystem()
+{
+   lor->AssembleSystem();
+   solver->SetOperator(*lor->GetAssembledSystem().Ptr());
+}
+
+LORSolver::~LORSolver()
+{
+   if (own_solver) { delete solver; }
+   delete lor;
+}
+
+} // namespace mfem
@@ -0,0 +1,151 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_LOR
+#define MFEM_LOR
+
+#include "bilinearform.hpp"
+#ifdef MFEM_USE_MPI
+#include "pbilinearform.hpp"
+#endif
+
+namespace mfem
+{
+
+/** @brief Create and manage the low-order-refined (LOR) discretization of a
+    high-order H1 bilinear form: the refined mesh, the order-1 space on it,
+    and the assembled LOR system matrix.
+
+    The dofs of the high-order space and of the LOR space coincide, so the
+    LOR matrix can be used directly to precondition the high-order operator.
+    The domain integrators of the high-order form (and thus their
+    coefficients) are shared with the LOR form; after a coefficient changes,
+    calling AssembleSystem() again refreshes the LOR matrix in place, reusing
+    the LOR mesh, space and sparsity pattern. */
+class LORDiscretization
+{
+protected:
+   BilinearForm *a_ho;              ///< The high-order form, not owned.
+   const Array<int> *ess_tdof_list; ///< Essential true dofs, not owned.
+
+   Mesh *mesh_lor;
+   FiniteElementCollection *fec_lor;
+   FiniteElementSpace *fes_lor;
+   BilinearForm *a_lor;
+   OperatorHandle A;
+
+   /// Used by the ParLORDiscretization constructor.
+   LORDiscretization();
+
+   /// Share the domain integrators of 'a_ho' with 'a_lor'.
+   void ShareIntegrators();
+
+public:
+   /** Construct the LOR discretization of the high-order form @a a_ho_ and
+       assemble the LOR system matrix, eliminating the essential dofs
+       @a ess_tdofs. The high-order space must be an H1 space on a conforming
+       mesh and only domain integrators are supported. The refined mesh
+       places its vertices at the @a ref_type points (see BasisType); for a
+       high-order space using BasisType::Positive, BasisType::ClosedUniform
+       is used instead of the default. */
+   LORDiscretization(BilinearForm &a_ho_, const Array<int> &ess_tdofs,
+                     int ref_type = BasisType::GaussLobatto);
+
+   virtual ~LORDiscretization();
+
+   /** (Re)assemble the LOR system matrix, e.g. after a coefficient of the
+       high-order form has changed. After the first assembly the sparsity
+       pattern is reused and the matrix object stays the same, so references
+       to it remain valid. */
+   virtual void AssembleSystem();
+
+   /// Access the assembled LOR system.
+   OperatorHandle &GetAssembledSystem() { return A; }
+
+   /// Access the assembled LOR matrix (serial case).
+   SparseMatrix &GetAssembledMatrix() const { return *A.As<SparseMatrix>(); }
+
+   FiniteElementSpace &GetFESpace() const { return *fes_lor; }
+   Mesh &GetMesh() const { return *mesh_lor; }
+};
+
+#ifdef MFEM_USE_MPI
+
+/// Parallel version of LORDiscretization.
+class ParLORDiscretization : public LORDiscretization
+{
+protected:
+   ParBilinearForm *pa_lor; // same object as 'a_lor'
+
+public:
+   /// Construct the LOR discretization of the parallel form @a a_ho_.
+   ParLORDiscretization(ParBilinearForm &a_ho_, const Array<int> &ess_tdofs,
+                        int ref_type = BasisType::GaussLobatto);
+
+   /** (Re)assemble the LOR system matrix. Unlike the serial case, the
+       parallel matrix is rebuilt, so the handle returned by
+       GetAssembledSystem() changes. */
+   virtual void AssembleSystem();
+
+   /// Access the assembled LOR matrix (parallel case).
+   HypreParMatrix &GetAssembledMatrix() const
+   { return *A.As<HypreParMatrix>(); }
+
+   ParFiniteElementSpace &GetParFESpace() const
+   { return *static_cast<ParFiniteElementSpace*>(fes_lor); }
+};
+
+#endif // MFEM_USE_MPI
+
+/** @brief Wrap a solver so that it is set up with the LOR matrix of a
+    high-order bilinear form and can be used as a preconditioner for the
+    high-order system, e.g. PCG on a partially assembled p=6 Poisson operator
+    preconditioned by an algebraic solver on the LOR matrix. */
+class LORSolver : public Solver
+{
+protected:
+   LORDiscretization *lor;
+   Solver *solver;
+   bool own_solver;
+
+public:
+   /** Create a solver for the LOR discretization of @a a_ho. The given
+       @a solver_ is set up with the assembled LOR matrix; it is owned (and
+       deleted) by this object unless @a own_solver_ is false. */
+   LORSolver(BilinearForm &a_ho, const Array<int> &ess_tdofs,
+             Solver *solver_, bool own_solver_ = true,
+             int ref_type = BasisType::GaussLobatto);
+
+#ifdef MFEM_USE_MPI
+   /// Parallel version: uses a ParLORDiscretization internally.
+   LORSolver(ParBilinearForm &a_ho, const Array<int> &ess_tdofs,
+             Solver *solver_, bool own_solver_ = true,
+             int ref_type = BasisType::GaussLobatto);
+#endif
+
+   virtual ~LORSolver();
+
+   /** Reassemble the LOR matrix (after a coefficient change) and set up the
+       wrapped solver with it again. */
+   void ReassembleSystem();
+
+   virtual void Mult(const Vector &x, Vector &y) const { solver->Mult(x, y); }
+
+   /// Forwarded to the wrapped solver; normally not needed.
+   virtual void SetOperator(const Operator &op) { solver->SetOperator(op); }
+
+   Solver &GetSolver() { return *solver; }
+   LORDiscretization &GetLOR() { return *lor; }
+};
+
+} // namespace mfem
+
+#endif
@@ -10,6 +10,7 @@
 // CONTRIBUTING.md for details.
 
 #include "multigrid.hpp"
+#include "transfer.hpp"
 
 namespace mfem
 {
@@ -33,16 +34,12 @@ Multigrid::~Multigrid()
       }
       delete X[i];
       delete Y[i];
-      delete R[i];
-      delete Z[i];
    }
 
    operators.DeleteAll();
    smoothers.DeleteAll();
    X.DeleteAll();
    Y.DeleteAll();
-   R.DeleteAll();
-   Z.DeleteAll();
 
    for (int i = 0; i < bfs.Size(); ++i)
    {
@@ -73,10 +70,15 @@ void Multigrid::AddLevel(Operator* opr, Solver* smoother, bool ownOperator,
    *X.Last() = 0.0;
    Y.Append(new Vector(height));
    *Y.Last() = 0.0;
-   R.Append(new Vector(height));
-   *R.Last() = 0.0;
-   Z.Append(new Vector(height));
-   *Z.Last() = 0.0;
+   if (R.Size() < height)
+   {
+      R.SetSize(height);
+      Z.SetSize(height);
+      R.UseDevice(true);
+      Z.UseDevice(true);
+      R = 0.0;
+      Z = 0.0;
+   }
 }
 
 int Multigrid::NumLevels() const { return operators.Size(); }
@@ -137,17 +139,21 @@ void Multigrid::SetOperator(const Operator& op)
 
 void Multigrid::SmoothingStep(int level, bool transpose) const
 {
-   GetOperatorAtLevel(level)->Mult(*Y[level], *R[level]); // r = A x
-   subtract(*X[level], *R[level], *R[level]);             // r = b - A x
+   Vector r, z;
+   r.MakeRef(R, 0, operators[level]->Height());
+   z.MakeRef(Z, 0, operators[level]->Height());
+
+   GetOperatorAtLevel(level)->Mult(*Y[level], r); // r = A x
+   subtract(*X[level], r, r);                     // r = b - A x
    if (transpose)
    {
-      GetSmootherAtLevel(level)->MultTranspose(*R[level], *Z[level]); // z = S r
+      GetSmootherAtLevel(level)->MultTranspose(r, z); // z = S r
    }
    else
    {
-      GetSmootherAtLevel(level)->Mult(*R[level], *Z[level]); // z = S r
+      GetSmootherAtLevel(level)->Mult(r, z); // z = S r
    }
-   add(*Y[level], 1.0, *Z[level], *Y[level]);             // x = x + S (b - A x)
+   add(*Y[level], 1.0, z, *Y[level]);             // x = x + S (b - A x)
 }
 
 void Multigrid::Cycle(int level) const
@@ -163,13 +169,16 @@ void Multigrid::Cycle(int level) const
       SmoothingStep(level, false);
    }
 
+   Vector r;
+   r.MakeRef(R, 0, operators[level]->Height());
+
    // Compute residual
-   GetOperatorAtLevel(level)->Mult(*Y[level], *R[level]);
-   subtract(*X[level], *R[level], *R[level]);
+   GetOperatorAtLevel(level)->Mult(*Y[level], r);
+   subtract(*X[level], r, r);
 
    // Restrict residual
-   fespaces.GetProlongationAtLevel(level - 1)->MultTranspose(*R[level],
-                                                             *X[level - 1]);
+   const Operator* P = fespaces.GetProlongationAtLevel(level - 1);
+   P->MultTranspose(r, *X[level - 1]);
 
    // Init zeros
    *Y[level - 1] = 0.0;
@@ -185,11 +194,24 @@ void Multigrid::Cycle(int level) const
       Cycle(level - 1);
    }
 
-   // Prolongate
-   fespaces.GetProlongationAtLevel(level - 1)->Mult(*Y[level - 1], *R[level]);
-
-   // Add update
-   *Y[level] += *R[level];
+   // Prolongate and add the coarse-grid correction, fused into one pass when
+   // the prolongation is one of the matrix-free transfer operators
+   if (const TransferOperator* tP = dynamic_cast<const TransferOperator*>(P))
+   {
+      tP->AddMult(*Y[level - 1], *Y[level]);
+   }
+#ifdef MFEM_USE_MPI
+   else if (const TrueTransferOperator* ttP =
+               dynamic_cast<const TrueTransferOperator*>(P))
+   {
+      ttP->AddMult(*Y[level - 1], *Y[level]);
+   }
+#endif
+   else
+   {
+      P->Mult(*Y[level - 1], r);
+      *Y[level] += r;
+   }
 
    // Post-smooth
    for (int i = 0; i < postSmoothingSteps; i++)
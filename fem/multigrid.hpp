@@ -49,8 +49,12 @@ private:
 
    mutable Array<Vector*> X;
    mutable Array<Vector*> Y;
-   mutable Array<Vector*> R;
-   mutable Array<Vector*> Z;
+   /** Scratch vectors shared by all levels, sized for the largest level;
+       each level aliases a leading sub-vector, see SmoothingStep() and
+       Cycle(). Residuals and smoother outputs are not live across the
+       recursion into the coarser levels, so one pool suffices. */
+   mutable Vector R;
+   mutable Vector Z;
 
 public:
    /// Constructs an empty multigrid for the given FiniteElementSpaceHierarchy
@@ -138,6 +138,15 @@ void NonlinearForm::Mult(const Vector &x, Vector &y) const
    if (ext)
    {
       ext->Mult(px, py);
+      if (Serial())
+      {
+         if (cP) { cP->MultTranspose(py, y); }
+
+         for (int i = 0; i < ess_tdof_list.Size(); i++)
+         {
+            y(ess_tdof_list[i]) = 0.0;
+         }
+      }
       return;
    }
 
@@ -264,7 +273,10 @@ Operator &NonlinearForm::GetGradient(const Vector &x) const
 {
    if (ext)
    {
-      MFEM_ABORT("Not yet implemented!");
+      MFEM_VERIFY(fnfi.Size() == 0 && bfnfi.Size() == 0,
+                  "face integrators are not supported yet by the partially"
+                  " assembled gradient!");
+      return ext->GetGradient(Prolongate(x));
    }
 
    const int skip_zeros = 0;
@@ -408,6 +420,179 @@ Operator &NonlinearForm::GetGradient(const Vector &x) const
    return *mGrad;
 }
 
+// Collect the (signed) vdofs of dof-coupling group 'g': the vdofs of element
+// 'g' for g < NE, and the combined vdofs of the g-NE'th interior face-neighbor
+// pair otherwise.
+static void FDGroupVDofs(const FiniteElementSpace *fes, const int g,
+                         const Array<int> &face_elem1,
+                         const Array<int> &face_elem2,
+                         Array<int> &vdofs, Array<int> &vdofs2)
+{
+   const int NE = fes->GetNE();
+   if (g < NE)
+   {
+      fes->GetElementVDofs(g, vdofs);
+   }
+   else
+   {
+      fes->GetElementVDofs(face_elem1[g-NE], vdofs);
+      fes->GetElementVDofs(face_elem2[g-NE], vdofs2);
+      vdofs.Append(vdofs2);
+   }
+}
+
+// Expand the (signed) vdofs into the sorted unique true dofs they depend on.
+static void FDGroupTDofs(const SparseMatrix *cP, const Array<int> &vdofs,
+                         Array<int> &tdofs)
+{
+   tdofs.SetSize(0);
+   for (int k = 0; k < vdofs.Size(); k++)
+   {
+      const int vd = (vdofs[k] >= 0) ? vdofs[k] : -1-vdofs[k];
+      if (!cP) { tdofs.Append(vd); continue; }
+      const int *cols = cP->GetRowColumns(vd);
+      for (int j = 0; j < cP->RowSize(vd); j++) { tdofs.Append(cols[j]); }
+   }
+   tdofs.Sort();
+   tdofs.Unique();
+}
+
+SparseMatrix *NonlinearForm::AssembleFDJacobian(const Vector &x,
+                                                double eps) const
+{
+   MFEM_VERIFY(Serial(), "finite-difference Jacobian assembly is serial only");
+   MFEM_VERIFY(x.Size() == Width(), "invalid input Vector size: "
+               << x.Size() << ", expected: " << Width());
+
+   // Collect the groups of true dofs that may couple in the residual: one
+   // group per element, plus one per interior face-neighbor pair when
+   // interior face integrators are present. (Boundary face dofs are subsets
+   // of the element groups.)
+   Mesh *mesh = fes->GetMesh();
+   const int NE = fes->GetNE();
+   Array<int> face_elem1, face_elem2;
+   if (fnfi.Size())
+   {
+      for (int i = 0; i < mesh->GetNumFaces(); i++)
+      {
+         FaceElementTransformations *tr =
+            mesh->GetInteriorFaceTransformations(i);
+         if (tr)
+         {
+            face_elem1.Append(tr->Elem1No);
+            face_elem2.Append(tr->Elem2No);
+         }
+      }
+   }
+   const int num_groups = NE + face_elem1.Size();
+   const int n = Width();
+
+   Array<int> vdofs, vdofs2, tdofs;
+   Table group_tdof;
+   group_tdof.MakeI(num_groups);
+   for (int g = 0; g < num_groups; g++)
+   {
+      FDGroupVDofs(fes, g, face_elem1, face_elem2, vdofs, vdofs2);
+      FDGroupTDofs(cP, vdofs, tdofs);
+      group_tdof.AddColumnsInRow(g, tdofs.Size());
+   }
+   group_tdof.MakeJ();
+   for (int g = 0; g < num_groups; g++)
+   {
+      FDGroupVDofs(fes, g, face_elem1, face_elem2, vdofs, vdofs2);
+      FDGroupTDofs(cP, vdofs, tdofs);
+      group_tdof.AddConnections(g, tdofs.GetData(), tdofs.Size());
+   }
+   group_tdof.ShiftUpI();
+   Table tdof_group;
+   Transpose(group_tdof, tdof_group, n);
+
+   // Two true dofs whose residual columns overlap in some row must receive
+   // different colors; column j touches row i when i and j share a group, so
+   // dof t conflicts with every dof reachable through a group of a group-
+   // neighbor of t. Assign each dof, in order, the smallest color not
+   // already taken by such a dof -- the same greedy scheme as
+   // BilinearForm::AssembleDomainColored(), one level deeper.
+   Array<int> color(n);
+   color = -1;
+   Array<int> marker; // color -> last dof that found it taken
+   int num_colors = 0;
+   for (int t = 0; t < n; t++)
+   {
+      const int *groups = tdof_group.GetRow(t);
+      for (int a = 0; a < tdof_group.RowSize(t); a++)
+      {
+         const int *rows = group_tdof.GetRow(groups[a]);
+         for (int b = 0; b < group_tdof.RowSize(groups[a]); b++)
+         {
+            const int *row_groups = tdof_group.GetRow(rows[b]);
+            for (int d = 0; d < tdof_group.RowSize(rows[b]); d++)
+            {
+               const int *gt = group_tdof.GetRow(row_groups[d]);
+               for (int e = 0; e < group_tdof.RowSize(row_groups[d]); e++)
+               {
+                  const int c = color[gt[e]];
+                  if (c >= 0) { marker[c] = t; }
+               }
+            }
+         }
+      }
+      int c = 0;
+      while (c < num_colors && marker[c] == t) { c++; }
+      if (c == num_colors) { marker.Append(-1); num_colors++; }
+      color[t] = c;
+   }
+
+   // Bucket the dofs by color: dofs of color c are listed in
+   // ordering[offsets[c]..offsets[c+1]).
+   Array<int> offsets(num_colors+1), ordering(n);
+   offsets = 0;
+   for (int t = 0; t < n; t++) { offsets[color[t]+1]++; }
+   offsets.PartialSum();
+   for (int t = 0; t < n; t++) { ordering[offsets[color[t]]++] = t; }
+   for (int c = num_colors; c > 0; c--) { offsets[c] = offsets[c-1]; }
+   offsets[0] = 0;
+
+   // One perturbed residual per color recovers all the columns of that
+   // color, since their sparsity rows are disjoint.
+   SparseMatrix *J = new SparseMatrix(n);
+   Vector r0(n), rp(n), xp(n);
+   Mult(x, r0);
+   for (int c = 0; c < num_colors; c++)
+   {
+      xp = x;
+      for (int s = offsets[c]; s < offsets[c+1]; s++)
+      {
+         const int j = ordering[s];
+         xp(j) += eps*(1.0 + fabs(x(j)));
+      }
+      Mult(xp, rp);
+      for (int s = offsets[c]; s < offsets[c+1]; s++)
+      {
+         const int j = ordering[s];
+         const double h = eps*(1.0 + fabs(x(j)));
+         const int *groups = tdof_group.GetRow(j);
+         for (int a = 0; a < tdof_group.RowSize(j); a++)
+         {
+            const int *gt = group_tdof.GetRow(groups[a]);
+            for (int b = 0; b < group_tdof.RowSize(groups[a]); b++)
+            {
+               const int i = gt[b];
+               J->Set(i, j, (rp(i) - r0(i))/h);
+            }
+         }
+      }
+   }
+   J->Finalize(0);
+
+   for (int i = 0; i < ess_tdof_list.Size(); i++)
+   {
+      J->EliminateRowCol(ess_tdof_list[i]);
+   }
+
+   return J;
+}
+
 void NonlinearForm::Update()
 {
    if (ext) { MFEM_ABORT("Not yet implemented!"); }
@@ -422,6 +607,11 @@ void NonlinearForm::Update()
    // Do not modify aux1 and aux2, their size will be set before use.
    P = fes->GetProlongationMatrix();
    cP = dynamic_cast<const SparseMatrix*>(P);
+   if (const NCProlongationOperator *NCP =
+          dynamic_cast<const NCProlongationOperator*>(P))
+   {
+      cP = &NCP->GetMatrix();
+   }
 }
 
 void NonlinearForm::Setup()
@@ -498,6 +688,11 @@ void BlockNonlinearForm::SetSpaces(Array<FiniteElementSpace *> &f)
       // Retrieve prolongation matrix for each FE space
       P[s] = fes[s]->GetProlongationMatrix();
       cP[s] = dynamic_cast<const SparseMatrix *>(P[s]);
+      if (const NCProlongationOperator *NCP =
+             dynamic_cast<const NCProlongationOperator *>(P[s]))
+      {
+         cP[s] = &NCP->GetMatrix();
+      }
 
       // If the P Operator exists and its type is not SparseMatrix, this
       // indicates the Operator is part of parallel run.
@@ -72,7 +72,13 @@ public:
         ext(NULL), fes(f), Grad(NULL), cGrad(NULL),
         sequence(f->GetSequence()), P(f->GetProlongationMatrix()),
         cP(dynamic_cast<const SparseMatrix*>(P))
-   { }
+   {
+      if (const NCProlongationOperator *NCP =
+             dynamic_cast<const NCProlongationOperator*>(P))
+      {
+         cP = &NCP->GetMatrix();
+      }
+   }
 
    /// Set the desired assembly level. The default is AssemblyLevel::NONE.
    /** This method must be called before assembly. */
@@ -157,6 +163,24 @@ public:
        The state @a x must be a true-dof vector. */
    virtual Operator &GetGradient(const Vector &x) const;
 
+   /** @brief Assemble the Jacobian at the state @a x by graph-colored finite
+       differences and return it as a new SparseMatrix, owned by the caller. */
+   /** The true dofs are colored so that no two dofs of the same color couple
+       in the residual, i.e. they never meet in an element (or in a pair of
+       face-neighbor elements, when interior face integrators are present).
+       All the dofs of a color are perturbed together, so the Jacobian is
+       recovered from one Mult() per color plus one for the base residual,
+       instead of one Mult() per dof. The entry J(i,j) is the one-sided
+       difference (R(x + h_j e_j) - R(x))_i / h_j with h_j = eps*(1 + |x_j|).
+
+       Intended for NonlinearFormIntegrator%s that do not implement an exact
+       AssembleElementGrad(), e.g. complex material models linearized by
+       finite differences. Essential boundary conditions are imposed as in
+       GetGradient(). Serial only.
+
+       The state @a x must be a true-dof vector. */
+   SparseMatrix *AssembleFDJacobian(const Vector &x, double eps = 1e-8) const;
+
    /// Update the NonlinearForm to propagate updates of the associated FE space.
    /** After calling this method, the essential boundary conditions need to be
        set again. */
@@ -13,6 +13,7 @@
 // PABilinearFormExtension and MFBilinearFormExtension.
 
 #include "nonlinearform.hpp"
+#include "../general/forall.hpp"
 
 namespace mfem
 {
@@ -24,11 +25,12 @@ NonlinearFormExtension::NonlinearFormExtension(NonlinearForm *form)
 }
 
 PANonlinearFormExtension::PANonlinearFormExtension(NonlinearForm *form):
-   NonlinearFormExtension(form), fes(*form->FESpace())
+   NonlinearFormExtension(form), fes(*form->FESpace()), Grad(NULL)
 {
    const ElementDofOrdering ordering = ElementDofOrdering::LEXICOGRAPHIC;
    elem_restrict_lex = fes.GetElementRestriction(ordering);
-   if (elem_restrict_lex)
+   elem_restrict_identity = fes.IsElementRestrictionIdentity();
+   if (elem_restrict_lex && !elem_restrict_identity)
    {
       localX.SetSize(elem_restrict_lex->Height(), Device::GetMemoryType());
       localY.SetSize(elem_restrict_lex->Height(), Device::GetMemoryType());
@@ -50,7 +52,7 @@ void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
 {
    Array<NonlinearFormIntegrator*> &integrators = *n->GetDNFI();
    const int iSz = integrators.Size();
-   if (elem_restrict_lex)
+   if (elem_restrict_lex && !elem_restrict_identity)
    {
       elem_restrict_lex->Mult(x, localX);
       localY = 0.0;
@@ -71,4 +73,80 @@ void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
    }
 }
 
+Operator &PANonlinearFormExtension::GetGradient(const Vector &x) const
+{
+   delete Grad;
+   Grad = new Gradient(x, *this);
+   return *Grad;
+}
+
+PANonlinearFormExtension::Gradient::Gradient(const Vector &x,
+                                             const PANonlinearFormExtension &e):
+   Operator(e.fes.GetVSize()), ext(e),
+   ess_tdof_list(e.n->GetEssentialTrueDofs())
+{
+   MFEM_VERIFY(ext.elem_restrict_lex, "Not yet implemented!");
+   // Assemble the state-dependent gradient data of the domain integrators at
+   // the E-vector of the state x. When the restriction is the identity, the
+   // L-vector x already is the E-vector.
+   if (!ext.elem_restrict_identity)
+   {
+      ext.elem_restrict_lex->Mult(x, ext.localX);
+   }
+   const Vector &localX = ext.elem_restrict_identity ? x : ext.localX;
+   Array<NonlinearFormIntegrator*> &integrators = *ext.n->GetDNFI();
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      integrators[i]->AssembleGradPA(localX, ext.fes);
+   }
+}
+
+void PANonlinearFormExtension::Gradient::Mult(const Vector &x, Vector &y) const
+{
+   // Apply the gradient with the essential dofs of x set to zero and then
+   // overwrite the essential dofs of y with those of x, reproducing the
+   // elimination of the gradient rows and columns with ones on the diagonal.
+   const int csz = ess_tdof_list.Size();
+   if (csz)
+   {
+      z = x;
+      auto idx = ess_tdof_list.Read();
+      auto d_z = z.ReadWrite();
+      MFEM_FORALL(i, csz, d_z[idx[i]] = 0.0;);
+   }
+
+   const Vector &in = csz ? z : x;
+   if (ext.elem_restrict_identity)
+   {
+      // the E-vectors coincide with the L-vectors: apply the gradient
+      // without the restriction round trip
+      y.UseDevice(true);
+      y = 0.0;
+      Array<NonlinearFormIntegrator*> &integrators = *ext.n->GetDNFI();
+      for (int i = 0; i < integrators.Size(); ++i)
+      {
+         integrators[i]->AddMultGradPA(in, y);
+      }
+   }
+   else
+   {
+      ext.elem_restrict_lex->Mult(in, ext.localX);
+      ext.localY = 0.0;
+      Array<NonlinearFormIntegrator*> &integrators = *ext.n->GetDNFI();
+      for (int i = 0; i < integrators.Size(); ++i)
+      {
+         integrators[i]->AddMultGradPA(ext.localX, ext.localY);
+      }
+      ext.elem_restrict_lex->MultTranspose(ext.localY, y);
+   }
+
+   if (csz)
+   {
+      auto idx = ess_tdof_list.Read();
+      auto d_x = x.Read();
+      auto d_y = y.ReadWrite();
+      MFEM_FORALL(i, csz, d_y[idx[i]] = d_x[idx[i]];);
+   }
+}
+
 }
@@ -26,6 +26,8 @@ protected:
 public:
    NonlinearFormExtension(NonlinearForm *form);
    virtual void AssemblePA() = 0;
+   /// Return the gradient (linearization) of the form at the state @a x.
+   virtual Operator &GetGradient(const Vector &x) const = 0;
 };
 
 /// Data and methods for partially-assembled nonlinear forms
@@ -35,10 +37,38 @@ protected:
    const FiniteElementSpace &fes; // Not owned
    mutable Vector localX, localY;
    const Operator *elem_restrict_lex; // Not owned
+   /// True when elem_restrict_lex is the identity, see
+   /// FiniteElementSpace::IsElementRestrictionIdentity(). The apply and
+   /// gradient paths then skip the E-vector copies and work on the
+   /// L-vectors directly.
+   bool elem_restrict_identity;
+
+   /** @brief Operator expressing the action of the gradient of the form at
+       the state given at construction time. */
+   class Gradient : public Operator
+   {
+      const PANonlinearFormExtension &ext;
+      const Array<int> &ess_tdof_list;
+      mutable Vector z; ///< Input vector with the essential dofs set to zero
+   public:
+      /** @brief Assemble the gradient data of the domain integrators of
+          @a ext at the state @a x and form the linearized operator. */
+      Gradient(const Vector &x, const PANonlinearFormExtension &ext);
+      /** @brief Apply the action of the gradient. The essential dofs are
+          treated as if the rows and columns of the gradient were eliminated
+          with ones on the diagonal. */
+      virtual void Mult(const Vector &x, Vector &y) const;
+   };
+   mutable Gradient *Grad; ///< Owned
+
 public:
    PANonlinearFormExtension(NonlinearForm*);
+   virtual ~PANonlinearFormExtension() { delete Grad; }
    void AssemblePA();
    void Mult(const Vector &x, Vector &y) const;
+   /** @brief Return the gradient of the form at the state @a x, assembling
+       the gradient data of the domain integrators at @a x. */
+   Operator &GetGradient(const Vector &x) const;
 };
 }
 #endif // NONLINEARFORM_EXT_HPP
@@ -88,6 +88,25 @@ public:
        called. */
    virtual void AddMultPA(const Vector &x, Vector &y) const;
 
+   /// Method defining partial assembly of the gradient operator.
+   /** The state E-vector @a x defines where the gradient (linearization) of
+       the integrator is evaluated. The state-dependent data computed here is
+       stored internally so that it can be used later in the method
+       AddMultGradPA().
+
+       This method can be called only after the method AssemblePA() has been
+       called. */
+   virtual void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes);
+
+   /// Method for partially assembled gradient action.
+   /** Perform the action of the gradient of the integrator, evaluated at the
+       state specified in AssembleGradPA(), on the input @a x and add the
+       result to the output @a y. Both @a x and @a y are E-vectors.
+
+       This method can be called only after the method AssembleGradPA() has
+       been called. */
+   virtual void AddMultGradPA(const Vector &x, Vector &y) const;
+
    virtual ~NonlinearFormIntegrator() { }
 };
 
@@ -313,6 +332,7 @@ private:
    Vector shape;
    // PA extension
    Vector pa_data;
+   Vector pa_grad_data;
    const DofToQuad *maps;         ///< Not owned
    const GeometricFactors *geom;  ///< Not owned
    int dim, ne, nq;
@@ -339,6 +359,10 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &fes);
 
    virtual void AddMultPA(const Vector &x, Vector &y) const;
+
+   virtual void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes);
+
+   virtual void AddMultGradPA(const Vector &x, Vector &y) const;
 };
 
 }
@@ -789,6 +789,774 @@ static void SmemPAConvectionNLApply3D(const int NE,
    });
 }
 
+// PA Convection NL 2D gradient assemble kernel: evaluate the state and its
+// weighted physical gradient at the quadrature points.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionNLGradAssemble2D(const int NE,
+                                         const Array<double> &b,
+                                         const Array<double> &g,
+                                         const Vector &q_,
+                                         const Vector &x_,
+                                         Vector &u_,
+                                         const int d1d = 0,
+                                         const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Q = Reshape(q_.Read(), Q1D * Q1D, 2, 2, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, 2, NE);
+   auto U = Reshape(u_.Write(), Q1D * Q1D, 2, 3, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double data[max_Q1D][max_Q1D][2];
+      double grad0[max_Q1D][max_Q1D][2];
+      double grad1[max_Q1D][max_Q1D][2];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            data[qy][qx][0] = 0.0;
+            data[qy][qx][1] = 0.0;
+            grad0[qy][qx][0] = 0.0;
+            grad0[qy][qx][1] = 0.0;
+            grad1[qy][qx][0] = 0.0;
+            grad1[qy][qx][1] = 0.0;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double dataX[max_Q1D][2];
+         double gradX0[max_Q1D][2];
+         double gradX1[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            dataX[qx][0] = 0.0;
+            dataX[qx][1] = 0.0;
+            gradX0[qx][0] = 0.0;
+            gradX0[qx][1] = 0.0;
+            gradX1[qx][0] = 0.0;
+            gradX1[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const double s0 = x(dx, dy, 0, e);
+            const double s1 = x(dx, dy, 1, e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double Bx = B(qx, dx);
+               const double Gx = G(qx, dx);
+               dataX[qx][0] += s0 * Bx;
+               dataX[qx][1] += s1 * Bx;
+               gradX0[qx][0] += s0 * Gx;
+               gradX0[qx][1] += s0 * Bx;
+               gradX1[qx][0] += s1 * Gx;
+               gradX1[qx][1] += s1 * Bx;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double By = B(qy, dy);
+            const double Gy = G(qy, dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               data[qy][qx][0] += dataX[qx][0] * By;
+               data[qy][qx][1] += dataX[qx][1] * By;
+               grad0[qy][qx][0] += gradX0[qx][0] * By;
+               grad0[qy][qx][1] += gradX0[qx][1] * Gy;
+               grad1[qy][qx][0] += gradX1[qx][0] * By;
+               grad1[qy][qx][1] += gradX1[qx][1] * Gy;
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy * Q1D;
+            const double grad00 = grad0[qy][qx][0];
+            const double grad01 = grad0[qy][qx][1];
+            const double grad10 = grad1[qy][qx][0];
+            const double grad11 = grad1[qy][qx][1];
+            U(q, 0, 0, e) = data[qy][qx][0];
+            U(q, 1, 0, e) = data[qy][qx][1];
+            U(q, 0, 1, e) = grad00 * Q(q, 0, 0, e) + grad01 * Q(q, 1, 0, e);
+            U(q, 0, 2, e) = grad00 * Q(q, 0, 1, e) + grad01 * Q(q, 1, 1, e);
+            U(q, 1, 1, e) = grad10 * Q(q, 0, 0, e) + grad11 * Q(q, 1, 0, e);
+            U(q, 1, 2, e) = grad10 * Q(q, 0, 1, e) + grad11 * Q(q, 1, 1, e);
+         }
+      }
+   });
+}
+
+// PA Convection NL 3D gradient assemble kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionNLGradAssemble3D(const int NE,
+                                         const Array<double> &b,
+                                         const Array<double> &g,
+                                         const Vector &q_,
+                                         const Vector &x_,
+                                         Vector &u_,
+                                         const int d1d = 0,
+                                         const int q1d = 0)
+{
+   constexpr int VDIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Q = Reshape(q_.Read(), Q1D * Q1D * Q1D, VDIM, VDIM, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, VDIM, NE);
+   auto U = Reshape(u_.Write(), Q1D * Q1D * Q1D, VDIM, VDIM + 1, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      constexpr int VDIM = 3;
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double data[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad0[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad1[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad2[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  data[qz][qy][qx][c] = 0.0;
+                  grad0[qz][qy][qx][c] = 0.0;
+                  grad1[qz][qy][qx][c] = 0.0;
+                  grad2[qz][qy][qx][c] = 0.0;
+               }
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double dataXY[max_Q1D][max_Q1D][VDIM];
+         double gradXY0[max_Q1D][max_Q1D][VDIM];
+         double gradXY1[max_Q1D][max_Q1D][VDIM];
+         double gradXY2[max_Q1D][max_Q1D][VDIM];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  dataXY[qy][qx][c] = 0.0;
+                  gradXY0[qy][qx][c] = 0.0;
+                  gradXY1[qy][qx][c] = 0.0;
+                  gradXY2[qy][qx][c] = 0.0;
+               }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double dataX[max_Q1D][VDIM];
+            double gradX0[max_Q1D][VDIM];
+            double gradX1[max_Q1D][VDIM];
+            double gradX2[max_Q1D][VDIM];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  dataX[qx][c] = 0.0;
+                  gradX0[qx][c] = 0.0;
+                  gradX1[qx][c] = 0.0;
+                  gradX2[qx][c] = 0.0;
+               }
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s0 = x(dx, dy, dz, 0, e);
+               const double s1 = x(dx, dy, dz, 1, e);
+               const double s2 = x(dx, dy, dz, 2, e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double Bx = B(qx, dx);
+                  const double Gx = G(qx, dx);
+
+                  dataX[qx][0] += s0 * Bx;
+                  dataX[qx][1] += s1 * Bx;
+                  dataX[qx][2] += s2 * Bx;
+
+                  gradX0[qx][0] += s0 * Gx;
+                  gradX0[qx][1] += s0 * Bx;
+                  gradX0[qx][2] += s0 * Bx;
+
+                  gradX1[qx][0] += s1 * Gx;
+                  gradX1[qx][1] += s1 * Bx;
+                  gradX1[qx][2] += s1 * Bx;
+
+                  gradX2[qx][0] += s2 * Gx;
+                  gradX2[qx][1] += s2 * Bx;
+                  gradX2[qx][2] += s2 * Bx;
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double By = B(qy, dy);
+               const double Gy = G(qy, dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  dataXY[qy][qx][0] += dataX[qx][0] * By;
+                  dataXY[qy][qx][1] += dataX[qx][1] * By;
+                  dataXY[qy][qx][2] += dataX[qx][2] * By;
+
+                  gradXY0[qy][qx][0] += gradX0[qx][0] * By;
+                  gradXY0[qy][qx][1] += gradX0[qx][1] * Gy;
+                  gradXY0[qy][qx][2] += gradX0[qx][2] * By;
+
+                  gradXY1[qy][qx][0] += gradX1[qx][0] * By;
+                  gradXY1[qy][qx][1] += gradX1[qx][1] * Gy;
+                  gradXY1[qy][qx][2] += gradX1[qx][2] * By;
+
+                  gradXY2[qy][qx][0] += gradX2[qx][0] * By;
+                  gradXY2[qy][qx][1] += gradX2[qx][1] * Gy;
+                  gradXY2[qy][qx][2] += gradX2[qx][2] * By;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double Bz = B(qz, dz);
+            const double Gz = G(qz, dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  data[qz][qy][qx][0] += dataXY[qy][qx][0] * Bz;
+                  data[qz][qy][qx][1] += dataXY[qy][qx][1] * Bz;
+                  data[qz][qy][qx][2] += dataXY[qy][qx][2] * Bz;
+
+                  grad0[qz][qy][qx][0] += gradXY0[qy][qx][0] * Bz;
+                  grad0[qz][qy][qx][1] += gradXY0[qy][qx][1] * Bz;
+                  grad0[qz][qy][qx][2] += gradXY0[qy][qx][2] * Gz;
+
+                  grad1[qz][qy][qx][0] += gradXY1[qy][qx][0] * Bz;
+                  grad1[qz][qy][qx][1] += gradXY1[qy][qx][1] * Bz;
+                  grad1[qz][qy][qx][2] += gradXY1[qy][qx][2] * Gz;
+
+                  grad2[qz][qy][qx][0] += gradXY2[qy][qx][0] * Bz;
+                  grad2[qz][qy][qx][1] += gradXY2[qy][qx][1] * Bz;
+                  grad2[qz][qy][qx][2] += gradXY2[qy][qx][2] * Gz;
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + Q1D * (qy + qz * Q1D);
+
+               U(q, 0, 0, e) = data[qz][qy][qx][0];
+               U(q, 1, 0, e) = data[qz][qy][qx][1];
+               U(q, 2, 0, e) = data[qz][qy][qx][2];
+
+               const double grad00 = grad0[qz][qy][qx][0];
+               const double grad01 = grad0[qz][qy][qx][1];
+               const double grad02 = grad0[qz][qy][qx][2];
+
+               const double grad10 = grad1[qz][qy][qx][0];
+               const double grad11 = grad1[qz][qy][qx][1];
+               const double grad12 = grad1[qz][qy][qx][2];
+
+               const double grad20 = grad2[qz][qy][qx][0];
+               const double grad21 = grad2[qz][qy][qx][1];
+               const double grad22 = grad2[qz][qy][qx][2];
+
+               U(q, 0, 1, e) = grad00 * Q(q, 0, 0, e)
+                               + grad01 * Q(q, 1, 0, e)
+                               + grad02 * Q(q, 2, 0, e);
+               U(q, 0, 2, e) = grad00 * Q(q, 0, 1, e)
+                               + grad01 * Q(q, 1, 1, e)
+                               + grad02 * Q(q, 2, 1, e);
+               U(q, 0, 3, e) = grad00 * Q(q, 0, 2, e)
+                               + grad01 * Q(q, 1, 2, e)
+                               + grad02 * Q(q, 2, 2, e);
+
+               U(q, 1, 1, e) = grad10 * Q(q, 0, 0, e)
+                               + grad11 * Q(q, 1, 0, e)
+                               + grad12 * Q(q, 2, 0, e);
+               U(q, 1, 2, e) = grad10 * Q(q, 0, 1, e)
+                               + grad11 * Q(q, 1, 1, e)
+                               + grad12 * Q(q, 2, 1, e);
+               U(q, 1, 3, e) = grad10 * Q(q, 0, 2, e)
+                               + grad11 * Q(q, 1, 2, e)
+                               + grad12 * Q(q, 2, 2, e);
+
+               U(q, 2, 1, e) = grad20 * Q(q, 0, 0, e)
+                               + grad21 * Q(q, 1, 0, e)
+                               + grad22 * Q(q, 2, 0, e);
+               U(q, 2, 2, e) = grad20 * Q(q, 0, 1, e)
+                               + grad21 * Q(q, 1, 1, e)
+                               + grad22 * Q(q, 2, 1, e);
+               U(q, 2, 3, e) = grad20 * Q(q, 0, 2, e)
+                               + grad21 * Q(q, 1, 2, e)
+                               + grad22 * Q(q, 2, 2, e);
+            }
+         }
+      }
+   });
+}
+
+// PA Convection NL 2D gradient apply kernel: apply the linearization
+// (w.grad)u + (u.grad)w of the convection term at the assembled state u to
+// the input w.
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionNLGradApply2D(const int NE,
+                                      const Array<double> &b,
+                                      const Array<double> &g,
+                                      const Array<double> &bt,
+                                      const Vector &q_,
+                                      const Vector &u_,
+                                      const Vector &x_,
+                                      Vector &y_,
+                                      const int d1d = 0,
+                                      const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto Q = Reshape(q_.Read(), Q1D * Q1D, 2, 2, NE);
+   auto U = Reshape(u_.Read(), Q1D * Q1D, 2, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, 2, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, 2, NE);
+   MFEM_FORALL(e, NE,
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double data[max_Q1D][max_Q1D][2];
+      double grad0[max_Q1D][max_Q1D][2];
+      double grad1[max_Q1D][max_Q1D][2];
+      double Z[max_Q1D][max_Q1D][2];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            data[qy][qx][0] = 0.0;
+            data[qy][qx][1] = 0.0;
+            grad0[qy][qx][0] = 0.0;
+            grad0[qy][qx][1] = 0.0;
+            grad1[qy][qx][0] = 0.0;
+            grad1[qy][qx][1] = 0.0;
+         }
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         double dataX[max_Q1D][2];
+         double gradX0[max_Q1D][2];
+         double gradX1[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            dataX[qx][0] = 0.0;
+            dataX[qx][1] = 0.0;
+            gradX0[qx][0] = 0.0;
+            gradX0[qx][1] = 0.0;
+            gradX1[qx][0] = 0.0;
+            gradX1[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            const double s0 = x(dx, dy, 0, e);
+            const double s1 = x(dx, dy, 1, e);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double Bx = B(qx, dx);
+               const double Gx = G(qx, dx);
+               dataX[qx][0] += s0 * Bx;
+               dataX[qx][1] += s1 * Bx;
+               gradX0[qx][0] += s0 * Gx;
+               gradX0[qx][1] += s0 * Bx;
+               gradX1[qx][0] += s1 * Gx;
+               gradX1[qx][1] += s1 * Bx;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            const double By = B(qy, dy);
+            const double Gy = G(qy, dy);
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               data[qy][qx][0] += dataX[qx][0] * By;
+               data[qy][qx][1] += dataX[qx][1] * By;
+               grad0[qy][qx][0] += gradX0[qx][0] * By;
+               grad0[qy][qx][1] += gradX0[qx][1] * Gy;
+               grad1[qy][qx][0] += gradX1[qx][0] * By;
+               grad1[qy][qx][1] += gradX1[qx][1] * Gy;
+            }
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + qy * Q1D;
+            const double w1 = data[qy][qx][0];
+            const double w2 = data[qy][qx][1];
+            const double grad00 = grad0[qy][qx][0];
+            const double grad01 = grad0[qy][qx][1];
+            const double grad10 = grad1[qy][qx][0];
+            const double grad11 = grad1[qy][qx][1];
+            const double Dxw1 = grad00 * Q(q, 0, 0, e) + grad01 * Q(q, 1, 0, e);
+            const double Dyw1 = grad00 * Q(q, 0, 1, e) + grad01 * Q(q, 1, 1, e);
+            const double Dxw2 = grad10 * Q(q, 0, 0, e) + grad11 * Q(q, 1, 0, e);
+            const double Dyw2 = grad10 * Q(q, 0, 1, e) + grad11 * Q(q, 1, 1, e);
+            const double u1 = U(q, 0, 0, e);
+            const double u2 = U(q, 1, 0, e);
+            Z[qy][qx][0] = w1 * U(q, 0, 1, e) + w2 * U(q, 0, 2, e)
+                           + u1 * Dxw1 + u2 * Dyw1;
+            Z[qy][qx][1] = w1 * U(q, 1, 1, e) + w2 * U(q, 1, 2, e)
+                           + u1 * Dxw2 + u2 * Dyw2;
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         double Y[max_D1D][2];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            Y[dx][0] = 0.0;
+            Y[dx][1] = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const double Btx = Bt(dx, qx);
+               Y[dx][0] += Btx * Z[qy][qx][0];
+               Y[dx][1] += Btx * Z[qy][qx][1];
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double Bty = Bt(dy, qy);
+               y(dx, dy, 0, e) += Bty * Y[dx][0];
+               y(dx, dy, 1, e) += Bty * Y[dx][1];
+            }
+         }
+      }
+   });
+}
+
+// PA Convection NL 3D gradient apply kernel
+template<int T_D1D = 0, int T_Q1D = 0>
+static void PAConvectionNLGradApply3D(const int NE,
+                                      const Array<double> &b,
+                                      const Array<double> &g,
+                                      const Array<double> &bt,
+                                      const Vector &q_,
+                                      const Vector &u_,
+                                      const Vector &x_,
+                                      Vector &y_,
+                                      const int d1d = 0,
+                                      const int q1d = 0)
+{
+   constexpr int VDIM = 3;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= MAX_Q1D, "");
+
+   auto B = Reshape(b.Read(), Q1D, D1D);
+   auto G = Reshape(g.Read(), Q1D, D1D);
+   auto Bt = Reshape(bt.Read(), D1D, Q1D);
+   auto Q = Reshape(q_.Read(), Q1D * Q1D * Q1D, VDIM, VDIM, NE);
+   auto U = Reshape(u_.Read(), Q1D * Q1D * Q1D, VDIM, VDIM + 1, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, VDIM, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, VDIM, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      constexpr int VDIM = 3;
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int max_D1D = T_D1D ? T_D1D : MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : MAX_Q1D;
+
+      double data[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad0[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad1[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double grad2[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      double Z[max_Q1D][max_Q1D][max_Q1D][VDIM];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  data[qz][qy][qx][c] = 0.0;
+                  grad0[qz][qy][qx][c] = 0.0;
+                  grad1[qz][qy][qx][c] = 0.0;
+                  grad2[qz][qy][qx][c] = 0.0;
+               }
+            }
+         }
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         double dataXY[max_Q1D][max_Q1D][VDIM];
+         double gradXY0[max_Q1D][max_Q1D][VDIM];
+         double gradXY1[max_Q1D][max_Q1D][VDIM];
+         double gradXY2[max_Q1D][max_Q1D][VDIM];
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  dataXY[qy][qx][c] = 0.0;
+                  gradXY0[qy][qx][c] = 0.0;
+                  gradXY1[qy][qx][c] = 0.0;
+                  gradXY2[qy][qx][c] = 0.0;
+               }
+            }
+         }
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            double dataX[max_Q1D][VDIM];
+            double gradX0[max_Q1D][VDIM];
+            double gradX1[max_Q1D][VDIM];
+            double gradX2[max_Q1D][VDIM];
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               for (int c = 0; c < VDIM; ++c)
+               {
+                  dataX[qx][c] = 0.0;
+                  gradX0[qx][c] = 0.0;
+                  gradX1[qx][c] = 0.0;
+                  gradX2[qx][c] = 0.0;
+               }
+            }
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const double s0 = x(dx, dy, dz, 0, e);
+               const double s1 = x(dx, dy, dz, 1, e);
+               const double s2 = x(dx, dy, dz, 2, e);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double Bx = B(qx, dx);
+                  const double Gx = G(qx, dx);
+
+                  dataX[qx][0] += s0 * Bx;
+                  dataX[qx][1] += s1 * Bx;
+                  dataX[qx][2] += s2 * Bx;
+
+                  gradX0[qx][0] += s0 * Gx;
+                  gradX0[qx][1] += s0 * Bx;
+                  gradX0[qx][2] += s0 * Bx;
+
+                  gradX1[qx][0] += s1 * Gx;
+                  gradX1[qx][1] += s1 * Bx;
+                  gradX1[qx][2] += s1 * Bx;
+
+                  gradX2[qx][0] += s2 * Gx;
+                  gradX2[qx][1] += s2 * Bx;
+                  gradX2[qx][2] += s2 * Bx;
+               }
+            }
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               const double By = B(qy, dy);
+               const double Gy = G(qy, dy);
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  dataXY[qy][qx][0] += dataX[qx][0] * By;
+                  dataXY[qy][qx][1] += dataX[qx][1] * By;
+                  dataXY[qy][qx][2] += dataX[qx][2] * By;
+
+                  gradXY0[qy][qx][0] += gradX0[qx][0] * By;
+                  gradXY0[qy][qx][1] += gradX0[qx][1] * Gy;
+                  gradXY0[qy][qx][2] += gradX0[qx][2] * By;
+
+                  gradXY1[qy][qx][0] += gradX1[qx][0] * By;
+                  gradXY1[qy][qx][1] += gradX1[qx][1] * Gy;
+                  gradXY1[qy][qx][2] += gradX1[qx][2] * By;
+
+                  gradXY2[qy][qx][0] += gradX2[qx][0] * By;
+                  gradXY2[qy][qx][1] += gradX2[qx][1] * Gy;
+                  gradXY2[qy][qx][2] += gradX2[qx][2] * By;
+               }
+            }
+         }
+         for (int qz = 0; qz < Q1D; ++qz)
+         {
+            const double Bz = B(qz, dz);
+            const double Gz = G(qz, dz);
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  data[qz][qy][qx][0] += dataXY[qy][qx][0] * Bz;
+                  data[qz][qy][qx][1] += dataXY[qy][qx][1] * Bz;
+                  data[qz][qy][qx][2] += dataXY[qy][qx][2] * Bz;
+
+                  grad0[qz][qy][qx][0] += gradXY0[qy][qx][0] * Bz;
+                  grad0[qz][qy][qx][1] += gradXY0[qy][qx][1] * Bz;
+                  grad0[qz][qy][qx][2] += gradXY0[qy][qx][2] * Gz;
+
+                  grad1[qz][qy][qx][0] += gradXY1[qy][qx][0] * Bz;
+                  grad1[qz][qy][qx][1] += gradXY1[qy][qx][1] * Bz;
+                  grad1[qz][qy][qx][2] += gradXY1[qy][qx][2] * Gz;
+
+                  grad2[qz][qy][qx][0] += gradXY2[qy][qx][0] * Bz;
+                  grad2[qz][qy][qx][1] += gradXY2[qy][qx][1] * Bz;
+                  grad2[qz][qy][qx][2] += gradXY2[qy][qx][2] * Gz;
+               }
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               const int q = qx + Q1D * (qy + qz * Q1D);
+
+               const double w1 = data[qz][qy][qx][0];
+               const double w2 = data[qz][qy][qx][1];
+               const double w3 = data[qz][qy][qx][2];
+
+               const double grad00 = grad0[qz][qy][qx][0];
+               const double grad01 = grad0[qz][qy][qx][1];
+               const double grad02 = grad0[qz][qy][qx][2];
+
+               const double grad10 = grad1[qz][qy][qx][0];
+               const double grad11 = grad1[qz][qy][qx][1];
+               const double grad12 = grad1[qz][qy][qx][2];
+
+               const double grad20 = grad2[qz][qy][qx][0];
+               const double grad21 = grad2[qz][qy][qx][1];
+               const double grad22 = grad2[qz][qy][qx][2];
+
+               const double Dxw1 = grad00 * Q(q, 0, 0, e)
+                                   + grad01 * Q(q, 1, 0, e)
+                                   + grad02 * Q(q, 2, 0, e);
+               const double Dyw1 = grad00 * Q(q, 0, 1, e)
+                                   + grad01 * Q(q, 1, 1, e)
+                                   + grad02 * Q(q, 2, 1, e);
+               const double Dzw1 = grad00 * Q(q, 0, 2, e)
+                                   + grad01 * Q(q, 1, 2, e)
+                                   + grad02 * Q(q, 2, 2, e);
+
+               const double Dxw2 = grad10 * Q(q, 0, 0, e)
+                                   + grad11 * Q(q, 1, 0, e)
+                                   + grad12 * Q(q, 2, 0, e);
+               const double Dyw2 = grad10 * Q(q, 0, 1, e)
+                                   + grad11 * Q(q, 1, 1, e)
+                                   + grad12 * Q(q, 2, 1, e);
+               const double Dzw2 = grad10 * Q(q, 0, 2, e)
+                                   + grad11 * Q(q, 1, 2, e)
+                                   + grad12 * Q(q, 2, 2, e);
+
+               const double Dxw3 = grad20 * Q(q, 0, 0, e)
+                                   + grad21 * Q(q, 1, 0, e)
+                                   + grad22 * Q(q, 2, 0, e);
+               const double Dyw3 = grad20 * Q(q, 0, 1, e)
+                                   + grad21 * Q(q, 1, 1, e)
+                                   + grad22 * Q(q, 2, 1, e);
+               const double Dzw3 = grad20 * Q(q, 0, 2, e)
+                                   + grad21 * Q(q, 1, 2, e)
+                                   + grad22 * Q(q, 2, 2, e);
+
+               const double u1 = U(q, 0, 0, e);
+               const double u2 = U(q, 1, 0, e);
+               const double u3 = U(q, 2, 0, e);
+
+               Z[qz][qy][qx][0] = w1 * U(q, 0, 1, e) + w2 * U(q, 0, 2, e)
+                                  + w3 * U(q, 0, 3, e)
+                                  + u1 * Dxw1 + u2 * Dyw1 + u3 * Dzw1;
+               Z[qz][qy][qx][1] = w1 * U(q, 1, 1, e) + w2 * U(q, 1, 2, e)
+                                  + w3 * U(q, 1, 3, e)
+                                  + u1 * Dxw2 + u2 * Dyw2 + u3 * Dzw2;
+               Z[qz][qy][qx][2] = w1 * U(q, 2, 1, e) + w2 * U(q, 2, 2, e)
+                                  + w3 * U(q, 2, 3, e)
+                                  + u1 * Dxw3 + u2 * Dyw3 + u3 * Dzw3;
+            }
+         }
+      }
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         double opXY[max_D1D][max_D1D][VDIM];
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               opXY[dy][dx][0] = 0.0;
+               opXY[dy][dx][1] = 0.0;
+               opXY[dy][dx][2] = 0.0;
+            }
+         }
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            double opX[max_D1D][VDIM];
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               opX[dx][0] = 0.0;
+               opX[dx][1] = 0.0;
+               opX[dx][2] = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const double Btx = Bt(dx, qx);
+                  opX[dx][0] += Btx * Z[qz][qy][qx][0];
+                  opX[dx][1] += Btx * Z[qz][qy][qx][1];
+                  opX[dx][2] += Btx * Z[qz][qy][qx][2];
+               }
+            }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double Bty = Bt(dy, qy);
+                  opXY[dy][dx][0] += Bty * opX[dx][0];
+                  opXY[dy][dx][1] += Bty * opX[dx][1];
+                  opXY[dy][dx][2] += Bty * opX[dx][2];
+               }
+            }
+         }
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const double Btz = Bt(dz, qz);
+                  y(dx, dy, dz, 0, e) += Btz * opXY[dy][dx][0];
+                  y(dx, dy, dz, 1, e) += Btz * opXY[dy][dx][1];
+                  y(dx, dy, dz, 2, e) += Btz * opXY[dy][dx][2];
+               }
+            }
+         }
+      }
+   });
+}
+
 void VectorConvectionNLFIntegrator::AddMultPA(const Vector &x, Vector &y) const
 {
    const int NE = ne;
@@ -813,4 +1581,51 @@ void VectorConvectionNLFIntegrator::AddMultPA(const Vector &x, Vector &y) const
    MFEM_ABORT("Not yet implemented!");
 }
 
+void VectorConvectionNLFIntegrator::AssembleGradPA(
+   const Vector &x, const FiniteElementSpace &fes)
+{
+   if (pa_data.Size() == 0) { AssemblePA(fes); }
+   pa_grad_data.SetSize(ne * nq * dim * (dim + 1), Device::GetMemoryType());
+   const int NE = ne;
+   const int D1D = maps->ndof;
+   const int Q1D = maps->nqpt;
+   const Vector &Q = pa_data;
+   const Array<double> &B = maps->B;
+   const Array<double> &G = maps->G;
+   if (dim == 2)
+   {
+      return PAConvectionNLGradAssemble2D(NE, B, G, Q, x, pa_grad_data,
+                                          D1D, Q1D);
+   }
+   if (dim == 3)
+   {
+      return PAConvectionNLGradAssemble3D(NE, B, G, Q, x, pa_grad_data,
+                                          D1D, Q1D);
+   }
+   MFEM_ABORT("Not yet implemented!");
+}
+
+void VectorConvectionNLFIntegrator::AddMultGradPA(const Vector &x,
+                                                  Vector &y) const
+{
+   MFEM_VERIFY(pa_grad_data.Size() > 0, "the gradient data is not assembled!");
+   const int NE = ne;
+   const int D1D = maps->ndof;
+   const int Q1D = maps->nqpt;
+   const Vector &Q = pa_data;
+   const Vector &U = pa_grad_data;
+   const Array<double> &B = maps->B;
+   const Array<double> &G = maps->G;
+   const Array<double> &Bt = maps->Bt;
+   if (dim == 2)
+   {
+      return PAConvectionNLGradApply2D(NE, B, G, Bt, Q, U, x, y, D1D, Q1D);
+   }
+   if (dim == 3)
+   {
+      return PAConvectionNLGradApply3D(NE, B, G, Bt, Q, U, x, y, D1D, Q1D);
+   }
+   MFEM_ABORT("Not yet implemented!");
+}
+
 } // namespace mfem
@@ -0,0 +1,663 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "nurbs_pa.hpp"
+#include "../mesh/nurbs.hpp"
+
+namespace mfem
+{
+
+static const NURBSExtension &GetNURBSExt(const FiniteElementSpace &f)
+{
+   MFEM_VERIFY(f.GetNURBSext() != NULL,
+               "NURBSPatchOperator requires a NURBS space!");
+   return *f.GetNURBSext();
+}
+
+NURBSPatchOperator::NURBSPatchOperator(const FiniteElementSpace &f, int q1d)
+   : Operator(f.GetVSize()), fes(f), ext(GetNURBSExt(f)),
+     dim(f.GetMesh()->Dimension())
+{
+   MFEM_VERIFY(dim == 2 || dim == 3, "only 2D and 3D meshes are supported!");
+   MFEM_VERIFY(fes.GetVDim() == 1, "only scalar spaces are supported!");
+   MFEM_VERIFY(fes.GetMesh()->SpaceDimension() == dim,
+               "surface NURBS meshes are not supported!");
+   MFEM_VERIFY(ext.GetGNE() == ext.GetNE(),
+               "all elements of the NURBS mesh must be active!");
+
+   SetupPatchBases(q1d);
+}
+
+NURBSPatchOperator::~NURBSPatchOperator()
+{
+   for (int p = 0; p < patch_data.Size(); p++) { delete patch_data[p]; }
+}
+
+void NURBSPatchOperator::SetupPatchBases(int q1d)
+{
+   const int NP = ext.GetNP();
+   patch_data.SetSize(NP);
+
+   Array<const KnotVector *> pkv(dim);
+   for (int p = 0; p < NP; p++)
+   {
+      PatchData *pd = new PatchData;
+      patch_data[p] = pd;
+      ext.GetPatchKnotVectors(p, pkv);
+      for (int d = 0; d < 3; d++)
+      {
+         pd->nd[d] = pd->ne[d] = pd->nq[d] = 1;
+         pd->order[d] = 0;
+      }
+      for (int d = 0; d < dim; d++)
+      {
+         const KnotVector *kv = pkv[d];
+         const int ord = kv->GetOrder();
+         pd->order[d] = ord;
+         pd->nd[d] = kv->GetNCP();
+         pd->ne[d] = kv->GetNE();
+         pd->nq[d] = (q1d > 0) ? q1d : ord + 1;
+
+         // Knot spans with nonzero measure, i.e. the 1D elements.
+         pd->span[d].SetSize(pd->ne[d]);
+         pd->spaninv[d].SetSize(kv->GetNKS());
+         pd->spaninv[d] = -1;
+         int ne = 0;
+         for (int i = 0; i < kv->GetNKS(); i++)
+         {
+            if (kv->isElement(i))
+            {
+               pd->spaninv[d][i] = ne;
+               pd->span[d][ne++] = i;
+            }
+         }
+         MFEM_VERIFY(ne == pd->ne[d], "inconsistent knot vector!");
+
+         // Evaluate the 1D B-spline basis once per knot span.
+         const IntegrationRule &ir1d =
+            IntRules.Get(Geometry::SEGMENT, 2*pd->nq[d] - 1);
+         MFEM_VERIFY(ir1d.GetNPoints() == pd->nq[d],
+                     "unexpected 1D quadrature rule!");
+         pd->B[d].SetSize(pd->ne[d]*pd->nq[d]*(ord + 1));
+         pd->G[d].SetSize(pd->ne[d]*pd->nq[d]*(ord + 1));
+         Vector shape(ord + 1), dshape(ord + 1);
+         for (int e = 0; e < pd->ne[d]; e++)
+         {
+            for (int q = 0; q < pd->nq[d]; q++)
+            {
+               const double xi = ir1d.IntPoint(q).x;
+               kv->CalcShape(shape, pd->span[d][e], xi);
+               kv->CalcDShape(dshape, pd->span[d][e], xi);
+               for (int i = 0; i <= ord; i++)
+               {
+                  pd->B[d]((e*pd->nq[d] + q)*(ord + 1) + i) = shape(i);
+                  pd->G[d]((e*pd->nq[d] + q)*(ord + 1) + i) = dshape(i);
+               }
+            }
+         }
+      }
+      pd->dofs.SetSize(pd->NumDofs());
+      pd->dofs = -1;
+   }
+
+   // The dofs of the element with knot-span indices (I,J,K) are the control
+   // points (I+ii, J+jj, K+kk), 0 <= ii,jj,kk <= order, listed with ii
+   // fastest; see NURBSExtension::Generate{2,3}DElementDofTable(). This
+   // recovers the patch-local lexicographic dof maps from the element dof
+   // table.
+   Array<int> ijk, edofs;
+   for (int e = 0; e < fes.GetNE(); e++)
+   {
+      PatchData *pd = patch_data[ext.GetElementPatch(e)];
+      ext.GetElementIJK(e, ijk);
+      fes.GetElementDofs(e, edofs);
+      const int o2 = (dim == 3) ? pd->order[2] : 0;
+      int l = 0;
+      for (int kk = 0; kk <= o2; kk++)
+      {
+         for (int jj = 0; jj <= pd->order[1]; jj++)
+         {
+            for (int ii = 0; ii <= pd->order[0]; ii++, l++)
+            {
+               int a = ijk[0] + ii + pd->nd[0]*(ijk[1] + jj);
+               if (dim == 3) { a += pd->nd[0]*pd->nd[1]*(ijk[2] + kk); }
+               pd->dofs[a] = edofs[l];
+            }
+         }
+      }
+   }
+
+   // Gather the control weights and evaluate the NURBS weight function and
+   // its reference gradient at the quadrature points.
+   const Vector &weights = ext.GetWeights();
+   for (int p = 0; p < NP; p++)
+   {
+      PatchData *pd = patch_data[p];
+      const int ndp = pd->NumDofs();
+      pd->wts.SetSize(ndp);
+      for (int a = 0; a < ndp; a++)
+      {
+         MFEM_VERIFY(pd->dofs[a] >= 0, "patch dof map is incomplete!");
+         pd->wts(a) = weights(pd->dofs[a]);
+      }
+      PatchEval(*pd, pd->wts, true, pd->W, pd->dW);
+   }
+}
+
+void NURBSPatchOperator::AssembleQData(Coefficient *Q, bool diffusion)
+{
+   const int nsym = dim*(dim + 1)/2;
+   for (int p = 0; p < patch_data.Size(); p++)
+   {
+      PatchData *pd = patch_data[p];
+      pd->D.SetSize((diffusion ? nsym : 1)*pd->NumQuadPoints());
+   }
+
+   Mesh *mesh = fes.GetMesh();
+   Array<int> ijk;
+   DenseMatrix adjJ(dim);
+   IntegrationRule irp;
+   int last_p = -1;
+   for (int e = 0; e < fes.GetNE(); e++)
+   {
+      const int p = ext.GetElementPatch(e);
+      PatchData &pd = *patch_data[p];
+      const int nq0 = pd.nq[0], nq1 = pd.nq[1], nq2 = pd.nq[2];
+      if (p != last_p)
+      {
+         // Tensor-product Gauss rule matching the 1D basis tables.
+         const IntegrationRule &irx = IntRules.Get(Geometry::SEGMENT,
+                                                   2*nq0 - 1);
+         const IntegrationRule &iry = IntRules.Get(Geometry::SEGMENT,
+                                                   2*nq1 - 1);
+         const IntegrationRule &irz = IntRules.Get(Geometry::SEGMENT,
+                                                   2*nq2 - 1);
+         irp.SetSize(nq0*nq1*((dim == 3) ? nq2 : 1));
+         for (int qz = 0; qz < ((dim == 3) ? nq2 : 1); qz++)
+         {
+            for (int qy = 0; qy < nq1; qy++)
+            {
+               for (int qx = 0; qx < nq0; qx++)
+               {
+                  IntegrationPoint &ip = irp[qx + nq0*(qy + nq1*qz)];
+                  ip.x = irx.IntPoint(qx).x;
+                  ip.y = iry.IntPoint(qy).x;
+                  ip.z = (dim == 3) ? irz.IntPoint(qz).x : 0.0;
+                  ip.weight = irx.IntPoint(qx).weight *
+                              iry.IntPoint(qy).weight *
+                              ((dim == 3) ? irz.IntPoint(qz).weight : 1.0);
+               }
+            }
+         }
+         last_p = p;
+      }
+
+      ext.GetElementIJK(e, ijk);
+      const int sx = pd.spaninv[0][ijk[0]];
+      const int sy = pd.spaninv[1][ijk[1]];
+      const int sz = (dim == 3) ? pd.spaninv[2][ijk[2]] : 0;
+      const int NQ0 = pd.ne[0]*nq0, NQ1 = pd.ne[1]*nq1;
+
+      ElementTransformation *Tr = mesh->GetElementTransformation(e);
+      for (int qz = 0; qz < ((dim == 3) ? nq2 : 1); qz++)
+      {
+         for (int qy = 0; qy < nq1; qy++)
+         {
+            for (int qx = 0; qx < nq0; qx++)
+            {
+               const IntegrationPoint &ip = irp[qx + nq0*(qy + nq1*qz)];
+               Tr->SetIntPoint(&ip);
+               const double detJ = Tr->Weight();
+               const double coeff = Q ? Q->Eval(*Tr, ip) : 1.0;
+               const int q = sx*nq0 + qx + NQ0*(sy*nq1 + qy +
+                                                NQ1*(sz*nq2 + qz));
+               if (!diffusion)
+               {
+                  const double W = pd.W(q);
+                  pd.D(q) = coeff*ip.weight*detJ/(W*W);
+               }
+               else
+               {
+                  CalcAdjugate(Tr->Jacobian(), adjJ);
+                  const double a = coeff*ip.weight/detJ;
+                  // Lower triangle of a adj(J) adj(J)^T, column by column.
+                  int s = 0;
+                  for (int j = 0; j < dim; j++)
+                  {
+                     for (int i = j; i < dim; i++, s++)
+                     {
+                        double sum = 0.0;
+                        for (int k = 0; k < dim; k++)
+                        {
+                           sum += adjJ(i,k)*adjJ(j,k);
+                        }
+                        pd.D(s + nsym*q) = a*sum;
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+void NURBSPatchOperator::PatchEval(const PatchData &pd, const Vector &x,
+                                   bool grad, Vector &val, Vector &dval) const
+{
+   const int nd0 = pd.nd[0], nd1 = pd.nd[1], nd2 = pd.nd[2];
+   const int NQ0 = pd.ne[0]*pd.nq[0];
+   const int NQ1 = pd.ne[1]*pd.nq[1];
+   const int p0 = pd.order[0] + 1, p1 = pd.order[1] + 1;
+   const int nqp = pd.NumQuadPoints();
+   val.SetSize(nqp);
+   dval.SetSize(grad ? dim*nqp : 0);
+
+   if (dim == 2)
+   {
+      // Contract in x: t0 = B_x x, t1 = G_x x.
+      Vector t0(NQ0*nd1), t1(grad ? NQ0*nd1 : 0);
+      for (int e = 0; e < pd.ne[0]; e++)
+      {
+         const int f = pd.span[0][e];
+         for (int q = 0; q < pd.nq[0]; q++)
+         {
+            const int qx = e*pd.nq[0] + q;
+            const double *b = pd.B[0].GetData() + qx*p0;
+            const double *g = pd.G[0].GetData() + qx*p0;
+            for (int j = 0; j < nd1; j++)
+            {
+               double s = 0.0, ds = 0.0;
+               for (int i = 0; i < p0; i++)
+               {
+                  const double c = x(f + i + nd0*j);
+                  s += b[i]*c;
+                  ds += g[i]*c;
+               }
+               t0(qx + NQ0*j) = s;
+               if (grad) { t1(qx + NQ0*j) = ds; }
+            }
+         }
+      }
+      // Contract in y.
+      for (int e = 0; e < pd.ne[1]; e++)
+      {
+         const int f = pd.span[1][e];
+         for (int q = 0; q < pd.nq[1]; q++)
+         {
+            const int qy = e*pd.nq[1] + q;
+            const double *b = pd.B[1].GetData() + qy*p1;
+            const double *g = pd.G[1].GetData() + qy*p1;
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               double s = 0.0, dx = 0.0, dy = 0.0;
+               for (int j = 0; j < p1; j++)
+               {
+                  s += b[j]*t0(qx + NQ0*(f + j));
+                  if (grad)
+                  {
+                     dx += b[j]*t1(qx + NQ0*(f + j));
+                     dy += g[j]*t0(qx + NQ0*(f + j));
+                  }
+               }
+               const int qg = qx + NQ0*qy;
+               val(qg) = s;
+               if (grad)
+               {
+                  dval(0 + 2*qg) = dx;
+                  dval(1 + 2*qg) = dy;
+               }
+            }
+         }
+      }
+      return;
+   }
+
+   const int p2 = pd.order[2] + 1;
+   // Contract in x: t0 = B_x x, t1 = G_x x.
+   Vector t0(NQ0*nd1*nd2), t1(grad ? NQ0*nd1*nd2 : 0);
+   for (int e = 0; e < pd.ne[0]; e++)
+   {
+      const int f = pd.span[0][e];
+      for (int q = 0; q < pd.nq[0]; q++)
+      {
+         const int qx = e*pd.nq[0] + q;
+         const double *b = pd.B[0].GetData() + qx*p0;
+         const double *g = pd.G[0].GetData() + qx*p0;
+         for (int k = 0; k < nd2; k++)
+         {
+            for (int j = 0; j < nd1; j++)
+            {
+               double s = 0.0, ds = 0.0;
+               for (int i = 0; i < p0; i++)
+               {
+                  const double c = x(f + i + nd0*(j + nd1*k));
+                  s += b[i]*c;
+                  ds += g[i]*c;
+               }
+               t0(qx + NQ0*(j + nd1*k)) = s;
+               if (grad) { t1(qx + NQ0*(j + nd1*k)) = ds; }
+            }
+         }
+      }
+   }
+   // Contract in y: u0 = B_y t0, u1 = B_y t1, u2 = G_y t0.
+   Vector u0(NQ0*NQ1*nd2);
+   Vector u1(grad ? NQ0*NQ1*nd2 : 0), u2(grad ? NQ0*NQ1*nd2 : 0);
+   for (int e = 0; e < pd.ne[1]; e++)
+   {
+      const int f = pd.span[1][e];
+      for (int q = 0; q < pd.nq[1]; q++)
+      {
+         const int qy = e*pd.nq[1] + q;
+         const double *b = pd.B[1].GetData() + qy*p1;
+         const double *g = pd.G[1].GetData() + qy*p1;
+         for (int k = 0; k < nd2; k++)
+         {
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               double s = 0.0, dx = 0.0, dy = 0.0;
+               for (int j = 0; j < p1; j++)
+               {
+                  s += b[j]*t0(qx + NQ0*(f + j + nd1*k));
+                  if (grad)
+                  {
+                     dx += b[j]*t1(qx + NQ0*(f + j + nd1*k));
+                     dy += g[j]*t0(qx + NQ0*(f + j + nd1*k));
+                  }
+               }
+               u0(qx + NQ0*(qy + NQ1*k)) = s;
+               if (grad)
+               {
+                  u1(qx + NQ0*(qy + NQ1*k)) = dx;
+                  u2(qx + NQ0*(qy + NQ1*k)) = dy;
+               }
+            }
+         }
+      }
+   }
+   // Contract in z.
+   for (int e = 0; e < pd.ne[2]; e++)
+   {
+      const int f = pd.span[2][e];
+      for (int q = 0; q < pd.nq[2]; q++)
+      {
+         const int qz = e*pd.nq[2] + q;
+         const double *b = pd.B[2].GetData() + qz*p2;
+         const double *g = pd.G[2].GetData() + qz*p2;
+         for (int qy = 0; qy < NQ1; qy++)
+         {
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               double s = 0.0, dx = 0.0, dy = 0.0, dz = 0.0;
+               for (int k = 0; k < p2; k++)
+               {
+                  s += b[k]*u0(qx + NQ0*(qy + NQ1*(f + k)));
+                  if (grad)
+                  {
+                     dx += b[k]*u1(qx + NQ0*(qy + NQ1*(f + k)));
+                     dy += b[k]*u2(qx + NQ0*(qy + NQ1*(f + k)));
+                     dz += g[k]*u0(qx + NQ0*(qy + NQ1*(f + k)));
+                  }
+               }
+               const int qg = qx + NQ0*(qy + NQ1*qz);
+               val(qg) = s;
+               if (grad)
+               {
+                  dval(0 + 3*qg) = dx;
+                  dval(1 + 3*qg) = dy;
+                  dval(2 + 3*qg) = dz;
+               }
+            }
+         }
+      }
+   }
+}
+
+void NURBSPatchOperator::PatchEvalTranspose(const PatchData &pd,
+                                            const Vector &val,
+                                            const Vector &dval,
+                                            Vector &y) const
+{
+   const int nd0 = pd.nd[0], nd1 = pd.nd[1], nd2 = pd.nd[2];
+   const int NQ0 = pd.ne[0]*pd.nq[0];
+   const int NQ1 = pd.ne[1]*pd.nq[1];
+   const int p0 = pd.order[0] + 1, p1 = pd.order[1] + 1;
+   const bool has_v = (val.Size() > 0), has_g = (dval.Size() > 0);
+   y.SetSize(pd.NumDofs());
+   y = 0.0;
+
+   if (dim == 2)
+   {
+      // Contract in y: A collects the B_y terms, C the G_x pre-image.
+      Vector A(NQ0*nd1), C(has_g ? NQ0*nd1 : 0);
+      A = 0.0;
+      C = 0.0;
+      for (int e = 0; e < pd.ne[1]; e++)
+      {
+         const int f = pd.span[1][e];
+         for (int q = 0; q < pd.nq[1]; q++)
+         {
+            const int qy = e*pd.nq[1] + q;
+            const double *b = pd.B[1].GetData() + qy*p1;
+            const double *g = pd.G[1].GetData() + qy*p1;
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               const int qg = qx + NQ0*qy;
+               const double v = has_v ? val(qg) : 0.0;
+               const double d0 = has_g ? dval(0 + 2*qg) : 0.0;
+               const double d1 = has_g ? dval(1 + 2*qg) : 0.0;
+               for (int j = 0; j < p1; j++)
+               {
+                  A(qx + NQ0*(f + j)) += b[j]*v + g[j]*d1;
+                  if (has_g) { C(qx + NQ0*(f + j)) += b[j]*d0; }
+               }
+            }
+         }
+      }
+      // Contract in x.
+      for (int e = 0; e < pd.ne[0]; e++)
+      {
+         const int f = pd.span[0][e];
+         for (int q = 0; q < pd.nq[0]; q++)
+         {
+            const int qx = e*pd.nq[0] + q;
+            const double *b = pd.B[0].GetData() + qx*p0;
+            const double *g = pd.G[0].GetData() + qx*p0;
+            for (int j = 0; j < nd1; j++)
+            {
+               const double a = A(qx + NQ0*j);
+               const double c = has_g ? C(qx + NQ0*j) : 0.0;
+               for (int i = 0; i < p0; i++)
+               {
+                  y(f + i + nd0*j) += b[i]*a + g[i]*c;
+               }
+            }
+         }
+      }
+      return;
+   }
+
+   const int p2 = pd.order[2] + 1;
+   // Contract in z: A collects the B_z terms, B2/C2 the G_x/G_y pre-images.
+   Vector A(NQ0*NQ1*nd2);
+   Vector B2(has_g ? NQ0*NQ1*nd2 : 0), C2(has_g ? NQ0*NQ1*nd2 : 0);
+   A = 0.0;
+   B2 = 0.0;
+   C2 = 0.0;
+   for (int e = 0; e < pd.ne[2]; e++)
+   {
+      const int f = pd.span[2][e];
+      for (int q = 0; q < pd.nq[2]; q++)
+      {
+         const int qz = e*pd.nq[2] + q;
+         const double *b = pd.B[2].GetData() + qz*p2;
+         const double *g = pd.G[2].GetData() + qz*p2;
+         for (int qy = 0; qy < NQ1; qy++)
+         {
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               const int qg = qx + NQ0*(qy + NQ1*qz);
+               const double v = has_v ? val(qg) : 0.0;
+               const double d0 = has_g ? dval(0 + 3*qg) : 0.0;
+               const double d1 = has_g ? dval(1 + 3*qg) : 0.0;
+               const double d2 = has_g ? dval(2 + 3*qg) : 0.0;
+               for (int k = 0; k < p2; k++)
+               {
+                  A(qx + NQ0*(qy + NQ1*(f + k))) += b[k]*v + g[k]*d2;
+                  if (has_g)
+                  {
+                     B2(qx + NQ0*(qy + NQ1*(f + k))) += b[k]*d0;
+                     C2(qx + NQ0*(qy + NQ1*(f + k))) += b[k]*d1;
+                  }
+               }
+            }
+         }
+      }
+   }
+   // Contract in y.
+   Vector P(NQ0*nd1*nd2), R(has_g ? NQ0*nd1*nd2 : 0);
+   P = 0.0;
+   R = 0.0;
+   for (int e = 0; e < pd.ne[1]; e++)
+   {
+      const int f = pd.span[1][e];
+      for (int q = 0; q < pd.nq[1]; q++)
+      {
+         const int qy = e*pd.nq[1] + q;
+         const double *b = pd.B[1].GetData() + qy*p1;
+         const double *g = pd.G[1].GetData() + qy*p1;
+         for (int k = 0; k < nd2; k++)
+         {
+            for (int qx = 0; qx < NQ0; qx++)
+            {
+               const double a = A(qx + NQ0*(qy + NQ1*k));
+               const double b2 = has_g ? B2(qx + NQ0*(qy + NQ1*k)) : 0.0;
+               const double c2 = has_g ? C2(qx + NQ0*(qy + NQ1*k)) : 0.0;
+               for (int j = 0; j < p1; j++)
+               {
+                  P(qx + NQ0*(f + j + nd1*k)) += b[j]*a + g[j]*c2;
+                  if (has_g) { R(qx + NQ0*(f + j + nd1*k)) += b[j]*b2; }
+               }
+            }
+         }
+      }
+   }
+   // Contract in x.
+   for (int e = 0; e < pd.ne[0]; e++)
+   {
+      const int f = pd.span[0][e];
+      for (int q = 0; q < pd.nq[0]; q++)
+      {
+         const int qx = e*pd.nq[0] + q;
+         const double *b = pd.B[0].GetData() + qx*p0;
+         const double *g = pd.G[0].GetData() + qx*p0;
+         for (int k = 0; k < nd2; k++)
+         {
+            for (int j = 0; j < nd1; j++)
+            {
+               const double a = P(qx + NQ0*(j + nd1*k));
+               const double r = has_g ? R(qx + NQ0*(j + nd1*k)) : 0.0;
+               for (int i = 0; i < p0; i++)
+               {
+                  y(f + i + nd0*(j + nd1*k)) += b[i]*a + g[i]*r;
+               }
+            }
+         }
+      }
+   }
+}
+
+NURBSPatchMassOperator::NURBSPatchMassOperator(const FiniteElementSpace &f,
+                                               Coefficient *Q, int q1d)
+   : NURBSPatchOperator(f, q1d)
+{
+   AssembleQData(Q, false);
+}
+
+void NURBSPatchMassOperator::Mult(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   Vector xl, yl, vq, none;
+   for (int p = 0; p < patch_data.Size(); p++)
+   {
+      const PatchData &pd = *patch_data[p];
+      const int ndp = pd.NumDofs();
+      xl.SetSize(ndp);
+      for (int a = 0; a < ndp; a++) { xl(a) = pd.wts(a)*x(pd.dofs[a]); }
+      PatchEval(pd, xl, false, vq, none);
+      const int nqp = pd.NumQuadPoints();
+      for (int q = 0; q < nqp; q++) { vq(q) *= pd.D(q); }
+      PatchEvalTranspose(pd, vq, none, yl);
+      for (int a = 0; a < ndp; a++) { y(pd.dofs[a]) += pd.wts(a)*yl(a); }
+   }
+}
+
+NURBSPatchDiffusionOperator::NURBSPatchDiffusionOperator(
+   const FiniteElementSpace &f, Coefficient *Q, int q1d)
+   : NURBSPatchOperator(f, q1d)
+{
+   AssembleQData(Q, true);
+}
+
+void NURBSPatchDiffusionOperator::Mult(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   Vector xl, yl, vq, gq, fv, fg;
+   for (int p = 0; p < patch_data.Size(); p++)
+   {
+      const PatchData &pd = *patch_data[p];
+      const int ndp = pd.NumDofs();
+      xl.SetSize(ndp);
+      for (int a = 0; a < ndp; a++) { xl(a) = pd.wts(a)*x(pd.dofs[a]); }
+      PatchEval(pd, xl, true, vq, gq);
+
+      const int nqp = pd.NumQuadPoints();
+      fv.SetSize(nqp);
+      fg.SetSize(dim*nqp);
+      for (int q = 0; q < nqp; q++)
+      {
+         // grad u = (grad S - (S/W) grad W)/W, with S the B-spline numerator.
+         const double W = pd.W(q);
+         double gu[3], F[3];
+         for (int c = 0; c < dim; c++)
+         {
+            gu[c] = (gq(c + dim*q) - vq(q)/W*pd.dW(c + dim*q))/W;
+         }
+         if (dim == 2)
+         {
+            F[0] = pd.D(0 + 3*q)*gu[0] + pd.D(1 + 3*q)*gu[1];
+            F[1] = pd.D(1 + 3*q)*gu[0] + pd.D(2 + 3*q)*gu[1];
+         }
+         else
+         {
+            F[0] = pd.D(0 + 6*q)*gu[0] + pd.D(1 + 6*q)*gu[1] +
+                   pd.D(2 + 6*q)*gu[2];
+            F[1] = pd.D(1 + 6*q)*gu[0] + pd.D(3 + 6*q)*gu[1] +
+                   pd.D(4 + 6*q)*gu[2];
+            F[2] = pd.D(2 + 6*q)*gu[0] + pd.D(4 + 6*q)*gu[1] +
+                   pd.D(5 + 6*q)*gu[2];
+         }
+         // grad v = w_a (grad B_a/W - B_a grad W/W^2): split the flux into
+         // a gradient part and a value part of the transposed evaluation.
+         double dWF = 0.0;
+         for (int c = 0; c < dim; c++)
+         {
+            dWF += pd.dW(c + dim*q)*F[c];
+            fg(c + dim*q) = F[c]/W;
+         }
+         fv(q) = -dWF/(W*W);
+      }
+      PatchEvalTranspose(pd, fv, fg, yl);
+      for (int a = 0; a < ndp; a++) { y(pd.dofs[a]) += pd.wts(a)*yl(a); }
+   }
+}
+
+}
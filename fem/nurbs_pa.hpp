@@ -0,0 +1,123 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_NURBS_PA
+#define MFEM_NURBS_PA
+
+#include "../config/config.hpp"
+#include "fespace.hpp"
+
+namespace mfem
+{
+
+/** @brief Base class for matrix-free, patch-level operators on scalar
+    NURBSExtension-based spaces.
+
+    The generic assembly path evaluates the NURBS basis with per-element
+    CalcShape()/CalcDShape() calls and never exploits the tensor-product
+    structure of the patches. This class instead evaluates the 1D B-spline
+    shape functions once per knot span at construction time and applies the
+    operator with sum-factorized tensor contractions over whole patches,
+    the same technique the partial assembly kernels use for nodal tensor
+    elements.
+
+    The rational character of the basis is handled exactly: with the control
+    weights folded into the input and output dof vectors, a NURBS field is
+    the ratio of two tensor-product B-spline fields, so the contractions act
+    on plain B-spline coefficients while the NURBS weight function and its
+    reference gradient are precomputed at the quadrature points.
+
+    The operator acts on unconstrained space dofs; essential boundary
+    conditions can be imposed on top of it, e.g., through a
+    ConstrainedOperator. Supported are serial spaces with vdim == 1 on
+    meshes whose elements are all active. */
+class NURBSPatchOperator : public Operator
+{
+protected:
+   /// Precomputed data for one patch.
+   struct PatchData
+   {
+      int nd[3];          ///< number of 1D control points per direction
+      int ne[3];          ///< number of 1D knot spans per direction
+      int nq[3];          ///< number of 1D quadrature points per knot span
+      int order[3];       ///< 1D polynomial order per direction
+      Array<int> dofs;    ///< patch-local lexicographic dof -> space dof
+      Array<int> span[3]; ///< knot-span index of each 1D element
+      Array<int> spaninv[3]; ///< inverse of #span: knot-span index -> element
+      Vector wts;         ///< NURBS control weights in patch-local ordering
+      Vector B[3], G[3];  ///< 1D shape/derivative tables: (span, point, basis)
+      Vector W, dW;       ///< weight function and its ref. gradient at points
+      Vector D;           ///< operator-specific quadrature point data
+
+      int NumDofs() const { return nd[0]*nd[1]*nd[2]; }
+      int NumQuadPoints() const
+      { return ne[0]*nq[0]*ne[1]*nq[1]*ne[2]*nq[2]; }
+   };
+
+   const FiniteElementSpace &fes;
+   const NURBSExtension &ext;
+   int dim;
+   Array<PatchData *> patch_data;
+
+   /** @brief Build the patch dof maps and the per-knot-span 1D basis tables,
+       and evaluate the NURBS weight function at the quadrature points.
+
+       With @a q1d <= 0, each direction uses order+1 Gauss points per knot
+       span. */
+   void SetupPatchBases(int q1d);
+
+   /** @brief Fill PatchData::D from the mesh geometry and the coefficient.
+
+       Stores c w_q det(J) / W^2 per point for the mass operator, and the
+       packed symmetric matrix c w_q det(J) J^{-1} J^{-T} per point for the
+       diffusion operator. */
+   void AssembleQData(Coefficient *Q, bool diffusion);
+
+   /// B-spline values (and, if @a grad is true, reference gradients) of the
+   /// patch-local coefficients @a x at all quadrature points of @a pd.
+   void PatchEval(const PatchData &pd, const Vector &x, bool grad,
+                  Vector &val, Vector &dval) const;
+
+   /// Transpose of PatchEval(): accumulate the quadrature point values
+   /// @a val and gradients @a dval (either may be empty) into @a y.
+   void PatchEvalTranspose(const PatchData &pd, const Vector &val,
+                           const Vector &dval, Vector &y) const;
+
+   NURBSPatchOperator(const FiniteElementSpace &f, int q1d);
+
+public:
+   virtual ~NURBSPatchOperator();
+};
+
+/// Patch-level action of the mass bilinear form (Q u, v) on a NURBS space.
+class NURBSPatchMassOperator : public NURBSPatchOperator
+{
+public:
+   NURBSPatchMassOperator(const FiniteElementSpace &f, Coefficient *Q = NULL,
+                          int q1d = 0);
+
+   virtual void Mult(const Vector &x, Vector &y) const;
+};
+
+/// Patch-level action of the diffusion bilinear form (Q grad u, grad v) on
+/// a NURBS space.
+class NURBSPatchDiffusionOperator : public NURBSPatchOperator
+{
+public:
+   NURBSPatchDiffusionOperator(const FiniteElementSpace &f,
+                               Coefficient *Q = NULL, int q1d = 0);
+
+   virtual void Mult(const Vector &x, Vector &y) const;
+};
+
+}
+
+#endif
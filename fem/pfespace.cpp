@@ -134,11 +134,17 @@ void ParFiniteElementSpace::Construct()
    {
       ConstructTrueNURBSDofs();
       GenerateGlobalOffsets();
+      // Finalize the ltdof broadcast started in ConstructTrueNURBSDofs(),
+      // overlapping its communication with the offset generation above.
+      gcomm->BcastEnd(ldof_ltdof.GetData(), 0);
    }
    else if (Conforming())
    {
       ConstructTrueDofs();
       GenerateGlobalOffsets();
+      // Finalize the ltdof broadcast started in ConstructTrueDofs(),
+      // overlapping its communication with the offset generation above.
+      gcomm->BcastEnd(ldof_ltdof.GetData(), 0);
    }
    else // Nonconforming()
    {
@@ -171,6 +177,12 @@ void ParFiniteElementSpace::Construct()
       // after all regular DOFs
       ngdofs = ngvdofs + ngedofs + ngfdofs;
 
+      // Finalize the cut-space ltdof broadcast started in ConstructTrueDofs(),
+      // overlapping its communication with the ghost DOF counting above. The
+      // array 'ldof_ltdof' must be complete before it is used (and then
+      // overwritten) below.
+      gcomm->BcastEnd(ldof_ltdof.GetData(), 0);
+
       // get P and R matrices, initialize DOF offsets, etc. NOTE: in the NC
       // case this needs to be done here to get the number of true DOFs
       ltdof_size = BuildParallelConformingInterpolation(
@@ -685,7 +697,7 @@ void ParFiniteElementSpace::Build_Dof_TrueDof_Matrix() const // matrix P
       i_offd[i+1] = offd_counter;
    }
 
-   SortPairs<HYPRE_Int, int>(cmap_j_offd, offd_counter);
+   ParallelSort(cmap_j_offd.begin(), cmap_j_offd.begin() + offd_counter);
 
    for (int i = 0; i < offd_counter; i++)
    {
@@ -1278,8 +1290,10 @@ void ParFiniteElementSpace::ConstructTrueDofs()
    }
    gcomm->SetLTDofTable(ldof_ltdof);
 
-   // have the group masters broadcast their ltdofs to the rest of the group
-   gcomm->Bcast(ldof_ltdof);
+   // have the group masters broadcast their ltdofs to the rest of the group;
+   // the broadcast is finalized in Construct() so that the exchange overlaps
+   // the generation of the global DOF offsets
+   gcomm->BcastBegin(ldof_ltdof.GetData(), 0);
 }
 
 void ParFiniteElementSpace::ConstructTrueNURBSDofs()
@@ -1325,8 +1339,9 @@ void ParFiniteElementSpace::ConstructTrueNURBSDofs()
    }
    gcomm->SetLTDofTable(ldof_ltdof);
 
-   // have the group masters broadcast their ltdofs to the rest of the group
-   gcomm->Bcast(ldof_ltdof);
+   // have the group masters broadcast their ltdofs to the rest of the group;
+   // the broadcast is finalized in Construct(), see ConstructTrueDofs()
+   gcomm->BcastBegin(ldof_ltdof.GetData(), 0);
 }
 
 void ParFiniteElementSpace::GetGhostVertexDofs(const MeshId &id,
@@ -2546,7 +2561,7 @@ ParFiniteElementSpace::RebalanceMatrix(int old_ndofs,
       cmap_offd[i].one = j_offd[i];
       cmap_offd[i].two = i;
    }
-   SortPairs<HYPRE_Int, int>(cmap_offd, offd_cols);
+   ParallelSort(cmap_offd.begin(), cmap_offd.begin() + offd_cols);
 
    HYPRE_Int* cmap = Memory<HYPRE_Int>(offd_cols);
    for (int i = 0; i < offd_cols; i++)
@@ -3004,6 +3019,13 @@ ConformingProlongationOperator::ConformingProlongationOperator(
 }
 
 void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void ConformingProlongationOperator::MultBegin(
+   const Vector &x, Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Width(), "");
    MFEM_ASSERT(y.Size() == Height(), "");
@@ -3023,6 +3045,13 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
       j = end+1;
    }
    std::copy(xdata+j-m, xdata+Width(), ydata+j);
+}
+
+void ConformingProlongationOperator::MultEnd(Vector &y) const
+{
+   MFEM_ASSERT(y.Size() == Height(), "");
+
+   double *ydata = y.HostWrite();
 
    const int out_layout = 0; // 0 - output is ldofs array
    gc.BcastEnd(ydata, out_layout);
@@ -3030,6 +3059,13 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
 
 void ConformingProlongationOperator::MultTranspose(
    const Vector &x, Vector &y) const
+{
+   MultTransposeBegin(x, y);
+   MultTransposeEnd(y);
+}
+
+void ConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x, Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Height(), "");
    MFEM_ASSERT(y.Size() == Width(), "");
@@ -3048,6 +3084,13 @@ void ConformingProlongationOperator::MultTranspose(
       j = end+1;
    }
    std::copy(xdata+j, xdata+Height(), ydata+j-m);
+}
+
+void ConformingProlongationOperator::MultTransposeEnd(Vector &y) const
+{
+   MFEM_ASSERT(y.Size() == Width(), "");
+
+   double *ydata = y.HostWrite();
 
    const int out_layout = 2; // 2 - output is an array on all ltdofs
    gc.ReduceEnd<double>(ydata, out_layout, GroupCommunicator::Sum);
@@ -3056,7 +3099,8 @@ void ConformingProlongationOperator::MultTranspose(
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
    const ParFiniteElementSpace &pfes) :
    ConformingProlongationOperator(pfes),
-   mpi_gpu_aware(Device::GetGPUAwareMPI())
+   mpi_gpu_aware(Device::GetGPUAwareMPI()),
+   req_counter(0)
 {
    MFEM_ASSERT(pfes.Conforming(), "internal error");
    const SparseMatrix *R = pfes.GetRestrictionMatrix();
@@ -3171,10 +3215,17 @@ void DeviceConformingProlongationOperator::BcastEndCopy(
 
 void DeviceConformingProlongationOperator::Mult(const Vector &x,
                                                 Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void DeviceConformingProlongationOperator::MultBegin(const Vector &x,
+                                                     Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    BcastBeginCopy(x); // copy to 'shr_buf'
-   int req_counter = 0;
+   req_counter = 0;
    for (int nbr = 1; nbr < gtopo.GetNumNeighbors(); nbr++)
    {
       const int send_offset = shr_buf_offsets[nbr];
@@ -3197,6 +3248,10 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
       }
    }
    BcastLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultEnd(Vector &y) const
+{
    MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
    BcastEndCopy(y); // copy from 'ext_buf'
 }
@@ -3259,10 +3314,17 @@ void DeviceConformingProlongationOperator::ReduceEndAssemble(Vector &y) const
 
 void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
                                                          Vector &y) const
+{
+   MultTransposeBegin(x, y);
+   MultTransposeEnd(y);
+}
+
+void DeviceConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x, Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    ReduceBeginCopy(x); // copy to 'ext_buf'
-   int req_counter = 0;
+   req_counter = 0;
    for (int nbr = 1; nbr < gtopo.GetNumNeighbors(); nbr++)
    {
       const int send_offset = ext_buf_offsets[nbr];
@@ -3285,6 +3347,10 @@ void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
       }
    }
    ReduceLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultTransposeEnd(Vector &y) const
+{
    MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
    ReduceEndAssemble(y); // assemble from 'shr_buf'
 }
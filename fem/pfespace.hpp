@@ -396,6 +396,29 @@ public:
    virtual void Mult(const Vector &x, Vector &y) const;
 
    virtual void MultTranspose(const Vector &x, Vector &y) const;
+
+   /** @brief Post the halo exchange for Mult() and copy the owned true dofs
+       of @a x into @a y, without waiting for the exchanged values.
+
+       Work that does not depend on the shared, non-owned ldofs of @a y —
+       e.g. the interior-element part of a partially assembled operator — can
+       be scheduled between MultBegin() and the matching MultEnd(). Each
+       MultBegin() must be completed by MultEnd() before any other exchange
+       is started on the same group communicator. */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /** @brief Complete a halo exchange started by MultBegin(), writing the
+       shared, non-owned ldofs of @a y. */
+   virtual void MultEnd(Vector &y) const;
+
+   /** @brief Post the reduction for MultTranspose() and copy the owned ldofs
+       of @a x into @a y, without waiting for the contributions from other
+       ranks. The same pairing rules as for MultBegin() apply. */
+   virtual void MultTransposeBegin(const Vector &x, Vector &y) const;
+
+   /** @brief Complete a reduction started by MultTransposeBegin(),
+       accumulating the received shared-dof contributions into @a y. */
+   virtual void MultTransposeEnd(Vector &y) const;
 };
 
 /// Auxiliary device class used by ParFiniteElementSpace.
@@ -410,6 +433,7 @@ protected:
    Array<int> ltdof_ldof, unq_ltdof;
    Array<int> unq_shr_i, unq_shr_j;
    MPI_Request *requests;
+   mutable int req_counter;
    // Kernel: copy ltdofs from 'src' to 'shr_buf' - prepare for send.
    //         shr_buf[i] = src[shr_ltdof[i]]
    void BcastBeginCopy(const Vector &src) const;
@@ -442,6 +466,20 @@ public:
    virtual void Mult(const Vector &x, Vector &y) const;
 
    virtual void MultTranspose(const Vector &x, Vector &y) const;
+
+   /** @brief Device version of ConformingProlongationOperator::MultBegin():
+       the pack kernel and the local true-dof copy run on the device; only the
+       MPI calls involve the host. */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /// Device version of ConformingProlongationOperator::MultEnd().
+   virtual void MultEnd(Vector &y) const;
+
+   /// Device version of ConformingProlongationOperator::MultTransposeBegin().
+   virtual void MultTransposeBegin(const Vector &x, Vector &y) const;
+
+   /// Device version of ConformingProlongationOperator::MultTransposeEnd().
+   virtual void MultTransposeEnd(Vector &y) const;
 };
 
 }
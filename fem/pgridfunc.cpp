@@ -204,6 +204,29 @@ HypreParVector *ParGridFunction::ParallelAssemble() const
 
 void ParGridFunction::ExchangeFaceNbrData()
 {
+   BeginExchangeFaceNbrData();
+   EndExchangeFaceNbrData();
+}
+
+void ParGridFunction::FreeFaceNbrRequests()
+{
+   if (face_nbr_requests == NULL) { return; }
+   for (int i = 0; i < face_nbr_num_requests; i++)
+   {
+      MPI_Request_free(&face_nbr_requests[i]);
+   }
+   delete [] face_nbr_requests;
+   face_nbr_requests = NULL;
+   face_nbr_num_requests = 0;
+   face_nbr_send_buf = NULL;
+   face_nbr_recv_buf = NULL;
+}
+
+void ParGridFunction::BeginExchangeFaceNbrData()
+{
+   MFEM_VERIFY(!face_nbr_exchange_started,
+               "a face-neighbor exchange is already in progress");
+
    pfes->ExchangeFaceNbrData();
 
    if (pfes->GetFaceNbrVSize() <= 0)
@@ -213,20 +236,15 @@ void ParGridFunction::ExchangeFaceNbrData()
 
    ParMesh *pmesh = pfes->GetParMesh();
 
+   // keep the received data device-resident: the DG face restrictions read it
+   // directly in their device kernels, see ParL2FaceRestriction::Mult()
+   face_nbr_data.UseDevice(true);
    face_nbr_data.SetSize(pfes->GetFaceNbrVSize());
+   send_data.UseDevice(true);
    send_data.SetSize(pfes->send_face_nbr_ldof.Size_of_connections());
 
-   int *send_offset = pfes->send_face_nbr_ldof.GetI();
    const int *d_send_ldof = mfem::Read(pfes->send_face_nbr_ldof.GetJMemory(),
                                        send_data.Size());
-   int *recv_offset = pfes->face_nbr_ldof.GetI();
-   MPI_Comm MyComm = pfes->GetComm();
-
-   int num_face_nbrs = pmesh->GetNFaceNeighbors();
-   MPI_Request *requests = new MPI_Request[2*num_face_nbrs];
-   MPI_Request *send_requests = requests;
-   MPI_Request *recv_requests = requests + num_face_nbrs;
-   MPI_Status  *statuses = new MPI_Status[num_face_nbrs];
 
    auto d_data = this->Read();
    auto d_send_data = send_data.Write();
@@ -240,25 +258,55 @@ void ParGridFunction::ExchangeFaceNbrData()
    auto send_data_ptr = mpi_gpu_aware ? send_data.Read() : send_data.HostRead();
    auto face_nbr_data_ptr = mpi_gpu_aware ? face_nbr_data.Write() :
                             face_nbr_data.HostWrite();
-   for (int fn = 0; fn < num_face_nbrs; fn++)
+
+   int num_face_nbrs = pmesh->GetNFaceNeighbors();
+
+   // The persistent requests remain valid as long as the communication
+   // buffers are not reallocated, e.g. after the space is updated.
+   if (face_nbr_requests == NULL ||
+       face_nbr_num_requests != 2*num_face_nbrs ||
+       face_nbr_send_buf != send_data_ptr ||
+       face_nbr_recv_buf != face_nbr_data_ptr)
    {
-      int nbr_rank = pmesh->GetFaceNbrRank(fn);
-      int tag = 0;
+      FreeFaceNbrRequests();
+
+      int *send_offset = pfes->send_face_nbr_ldof.GetI();
+      int *recv_offset = pfes->face_nbr_ldof.GetI();
+      MPI_Comm MyComm = pfes->GetComm();
 
-      MPI_Isend(&send_data_ptr[send_offset[fn]],
-                send_offset[fn+1] - send_offset[fn],
-                MPI_DOUBLE, nbr_rank, tag, MyComm, &send_requests[fn]);
+      face_nbr_requests = new MPI_Request[2*num_face_nbrs];
+      face_nbr_num_requests = 2*num_face_nbrs;
+      MPI_Request *send_requests = face_nbr_requests;
+      MPI_Request *recv_requests = face_nbr_requests + num_face_nbrs;
 
-      MPI_Irecv(&face_nbr_data_ptr[recv_offset[fn]],
-                recv_offset[fn+1] - recv_offset[fn],
-                MPI_DOUBLE, nbr_rank, tag, MyComm, &recv_requests[fn]);
+      for (int fn = 0; fn < num_face_nbrs; fn++)
+      {
+         int nbr_rank = pmesh->GetFaceNbrRank(fn);
+         int tag = 0;
+
+         MPI_Send_init(const_cast<double*>(&send_data_ptr[send_offset[fn]]),
+                       send_offset[fn+1] - send_offset[fn],
+                       MPI_DOUBLE, nbr_rank, tag, MyComm, &send_requests[fn]);
+
+         MPI_Recv_init(&face_nbr_data_ptr[recv_offset[fn]],
+                       recv_offset[fn+1] - recv_offset[fn],
+                       MPI_DOUBLE, nbr_rank, tag, MyComm, &recv_requests[fn]);
+      }
+
+      face_nbr_send_buf = send_data_ptr;
+      face_nbr_recv_buf = face_nbr_data_ptr;
    }
 
-   MPI_Waitall(num_face_nbrs, send_requests, statuses);
-   MPI_Waitall(num_face_nbrs, recv_requests, statuses);
+   MPI_Startall(face_nbr_num_requests, face_nbr_requests);
+   face_nbr_exchange_started = true;
+}
+
+void ParGridFunction::EndExchangeFaceNbrData()
+{
+   if (!face_nbr_exchange_started) { return; }
 
-   delete [] statuses;
-   delete [] requests;
+   MPI_Waitall(face_nbr_num_requests, face_nbr_requests, MPI_STATUSES_IGNORE);
+   face_nbr_exchange_started = false;
 }
 
 double ParGridFunction::GetValue(int i, const IntegrationPoint &ip, int vdim)
@@ -832,6 +880,60 @@ void ParGridFunction::Save(std::ostream &out) const
    }
 }
 
+void ParGridFunction::SaveBinary(std::ostream &out) const
+{
+   double *data_  = const_cast<double*>(HostRead());
+   for (int i = 0; i < size; i++)
+   {
+      if (pfes->GetDofSign(i) < 0) { data_[i] = -data_[i]; }
+   }
+
+   GridFunction::SaveBinary(out);
+
+   for (int i = 0; i < size; i++)
+   {
+      if (pfes->GetDofSign(i) < 0) { data_[i] = -data_[i]; }
+   }
+}
+
+void ParGridFunction::SaveLossy(std::ostream &out, double tol) const
+{
+   double *data_  = const_cast<double*>(HostRead());
+   for (int i = 0; i < size; i++)
+   {
+      if (pfes->GetDofSign(i) < 0) { data_[i] = -data_[i]; }
+   }
+
+   GridFunction::SaveLossy(out, tol);
+
+   for (int i = 0; i < size; i++)
+   {
+      if (pfes->GetDofSign(i) < 0) { data_[i] = -data_[i]; }
+   }
+}
+
+void ParGridFunction::SaveAggregated(const char *fname_prefix, int num_files,
+                                     int pad_digits, int precision,
+                                     bool binary) const
+{
+   std::ostringstream piece;
+   piece.precision(precision);
+   if (binary) { SaveBinary(piece); } else { Save(piece); }
+   AggregatedWrite(pfes->GetComm(), fname_prefix, num_files, piece.str(),
+                   pad_digits);
+}
+
+ParGridFunction *ParGridFunction::LoadAggregated(ParMesh *pmesh,
+                                                 const char *fname_prefix,
+                                                 int num_files, int pad_digits)
+{
+   std::string piece;
+   AggregatedRead(pmesh->GetComm(), fname_prefix, num_files, piece,
+                  pad_digits);
+   std::istringstream ifs(piece);
+   return new ParGridFunction(pmesh, ifs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void ParGridFunction::Save(adios2stream &out,
                            const std::string& variable_name,
@@ -43,6 +43,21 @@ protected:
    //TODO: Use temporary memory to avoid CUDA malloc allocation cost.
    Vector send_data;
 
+   /** @brief Persistent MPI requests (sends followed by receives) used by
+       BeginExchangeFaceNbrData() and EndExchangeFaceNbrData(). */
+   MPI_Request *face_nbr_requests = NULL;
+   int face_nbr_num_requests = 0;
+
+   /// The buffer addresses the persistent requests were created with.
+   const double *face_nbr_send_buf = NULL;
+   const double *face_nbr_recv_buf = NULL;
+
+   /// True between BeginExchangeFaceNbrData() and EndExchangeFaceNbrData().
+   bool face_nbr_exchange_started = false;
+
+   /// Free the persistent MPI requests used for face-neighbor exchanges.
+   void FreeFaceNbrRequests();
+
    void ProjectBdrCoefficient(Coefficient *coeff[], VectorCoefficient *vcoeff,
                               Array<int> &attr);
 
@@ -200,6 +215,21 @@ public:
    HypreParVector *ParallelAssemble() const;
 
    void ExchangeFaceNbrData();
+
+   /** @brief Start a face-neighbor data exchange: pack #send_data on device
+       and start the persistent sends and receives.
+
+       The local work that does not need the face-neighbor data, e.g. interior
+       face integration, can then be overlapped with the halo exchange before
+       calling EndExchangeFaceNbrData(). The persistent requests are created
+       with MPI_Send_init()/MPI_Recv_init() on the first call and reused as
+       long as the communication buffers do not change. */
+   void BeginExchangeFaceNbrData();
+
+   /** @brief Complete the exchange started by BeginExchangeFaceNbrData();
+       afterwards #face_nbr_data is safe to read. */
+   void EndExchangeFaceNbrData();
+
    Vector &FaceNbrData() { return face_nbr_data; }
    const Vector &FaceNbrData() const { return face_nbr_data; }
 
@@ -403,6 +433,33 @@ public:
        the local dofs. */
    virtual void Save(std::ostream &out) const;
 
+   /** Save the local portion of the ParGridFunction in binary form, taking
+       into account the signs of the local dofs as in Save(). */
+   virtual void SaveBinary(std::ostream &out) const;
+
+   /** Save the local portion of the ParGridFunction with error-bounded
+       lossy compression, taking into account the signs of the local dofs as
+       in Save(). */
+   virtual void SaveLossy(std::ostream &out, double tol) const;
+
+   /** @brief Save the grid function into @a num_files aggregate files
+       written with MPI-IO collective writes, instead of one file per rank.
+
+       Each rank serializes its local portion with Save() (or SaveBinary()
+       when @a binary is true) and the pieces are aggregated into the files
+       "<fname_prefix>.<file>" by AggregatedWrite(). Reload with
+       LoadAggregated() on the same number of ranks and files. */
+   void SaveAggregated(const char *fname_prefix, int num_files,
+                       int pad_digits = 6, int precision = 16,
+                       bool binary = false) const;
+
+   /** @brief Read a grid function on @a pmesh written by SaveAggregated()
+       with the same @a num_files on the same number of ranks. The returned
+       ParGridFunction is allocated with new and owned by the caller. */
+   static ParGridFunction *LoadAggregated(ParMesh *pmesh,
+                                          const char *fname_prefix,
+                                          int num_files, int pad_digits = 6);
+
 #ifdef MFEM_USE_ADIOS2
    /** Save the local portion of the ParGridFunction. This differs from the
        serial GridFunction::Save in that it takes into account the signs of
@@ -415,7 +472,7 @@ public:
    /// Merge the local grid functions
    void SaveAsOne(std::ostream &out = mfem::out);
 
-   virtual ~ParGridFunction() { }
+   virtual ~ParGridFunction() { FreeFaceNbrRequests(); }
 };
 
 
@@ -13,6 +13,7 @@
 #include "../general/forall.hpp"
 #include "../linalg/dtensor.hpp"
 #include "../linalg/kernels.hpp"
+#include <map>
 
 namespace mfem
 {
@@ -232,6 +233,67 @@ void QuadratureInterpolator::Eval3D(
    });
 }
 
+typedef QuadratureInterpolator::EvalKernel EvalKernel;
+
+static unsigned EvalKernelKey(int dim, int vdim, int nd, int nq)
+{
+   return ((unsigned)dim << 28) | ((unsigned)vdim << 24) |
+          ((unsigned)nd << 12) | (unsigned)nq;
+}
+
+/** Generate the default dispatch table: specializations of Eval2D() and
+    Eval3D() for all orders up to p = 8 with q1d = p+1 and q1d = p+2
+    quadrature points per direction, plus the larger rules supported by the
+    original hand-written dispatch. */
+static std::map<unsigned, EvalKernel> DefaultEvalKernels()
+{
+   std::map<unsigned, EvalKernel> table;
+#define MFEM_QUADINTERP_2D(VDIM, D1D, Q1D)                                  \
+   table[EvalKernelKey(2, VDIM, (D1D)*(D1D), (Q1D)*(Q1D))] =                \
+      &QuadratureInterpolator::Eval2D<VDIM, (D1D)*(D1D), (Q1D)*(Q1D)>;
+#define MFEM_QUADINTERP_3D(VDIM, D1D, Q1D)                                  \
+   table[EvalKernelKey(3, VDIM, (D1D)*(D1D)*(D1D), (Q1D)*(Q1D)*(Q1D))] =    \
+      &QuadratureInterpolator::Eval3D<VDIM, (D1D)*(D1D)*(D1D),              \
+                                      (Q1D)*(Q1D)*(Q1D)>;
+#define MFEM_QUADINTERP_ORDERS(KERNEL, VDIM)                                \
+   KERNEL(VDIM,1,1) KERNEL(VDIM,1,2)                                        \
+   KERNEL(VDIM,2,2) KERNEL(VDIM,2,3)                                        \
+   KERNEL(VDIM,3,3) KERNEL(VDIM,3,4)                                        \
+   KERNEL(VDIM,4,4) KERNEL(VDIM,4,5)                                        \
+   KERNEL(VDIM,5,5) KERNEL(VDIM,5,6)                                        \
+   KERNEL(VDIM,6,6) KERNEL(VDIM,6,7)                                        \
+   KERNEL(VDIM,7,7) KERNEL(VDIM,7,8)                                        \
+   KERNEL(VDIM,8,8) KERNEL(VDIM,8,9)                                        \
+   KERNEL(VDIM,9,9) KERNEL(VDIM,9,10)
+   MFEM_QUADINTERP_ORDERS(MFEM_QUADINTERP_2D, 1)
+   MFEM_QUADINTERP_ORDERS(MFEM_QUADINTERP_2D, 2)
+   MFEM_QUADINTERP_ORDERS(MFEM_QUADINTERP_2D, 3)
+   MFEM_QUADINTERP_ORDERS(MFEM_QUADINTERP_3D, 1)
+   MFEM_QUADINTERP_ORDERS(MFEM_QUADINTERP_3D, 3)
+   // Rules with more points, kept from the original dispatch table.
+   MFEM_QUADINTERP_2D(1,4,6) MFEM_QUADINTERP_2D(1,5,7) MFEM_QUADINTERP_2D(1,5,8)
+   MFEM_QUADINTERP_2D(2,4,6) MFEM_QUADINTERP_2D(2,5,7) MFEM_QUADINTERP_2D(2,5,8)
+   MFEM_QUADINTERP_2D(3,3,5) MFEM_QUADINTERP_2D(3,4,6)
+   MFEM_QUADINTERP_2D(3,5,7) MFEM_QUADINTERP_2D(3,5,8)
+   MFEM_QUADINTERP_3D(1,4,6) MFEM_QUADINTERP_3D(3,4,6)
+#undef MFEM_QUADINTERP_ORDERS
+#undef MFEM_QUADINTERP_3D
+#undef MFEM_QUADINTERP_2D
+   return table;
+}
+
+static std::map<unsigned, EvalKernel> &EvalKernelTable()
+{
+   static std::map<unsigned, EvalKernel> table = DefaultEvalKernels();
+   return table;
+}
+
+void QuadratureInterpolator::RegisterEvalKernel(int dim, int vdim, int nd,
+                                                int nq, EvalKernel kernel)
+{
+   EvalKernelTable()[EvalKernelKey(dim, vdim, nd, nq)] = kernel;
+}
+
 void QuadratureInterpolator::Mult(
    const Vector &e_vec, unsigned eval_flags,
    Vector &q_val, Vector &q_der, Vector &q_det) const
@@ -259,149 +321,26 @@ void QuadratureInterpolator::Mult(
    const DofToQuad &maps = fe->GetDofToQuad(*ir, DofToQuad::FULL);
    const int nd = maps.ndof;
    const int nq = maps.nqpt;
-   void (*eval_func)(
-      const int NE,
-      const int vdim,
-      const DofToQuad &maps,
-      const Vector &e_vec,
-      Vector &q_val,
-      Vector &q_der,
-      Vector &q_det,
-      const int eval_flags) = NULL;
-   if (vdim == 1)
+   EvalKernel eval_func = NULL;
+   const std::map<unsigned, EvalKernel> &table = EvalKernelTable();
+   const std::map<unsigned, EvalKernel>::const_iterator
+      it = table.find(EvalKernelKey(dim, vdim, nd, nq));
+   if (it != table.end())
    {
-      if (dim == 2)
-      {
-         switch (100*nd + nq)
-         {
-            // Q0
-            case 101: eval_func = &Eval2D<1,1,1>; break;
-            case 104: eval_func = &Eval2D<1,1,4>; break;
-            // Q1
-            case 404: eval_func = &Eval2D<1,4,4>; break;
-            case 409: eval_func = &Eval2D<1,4,9>; break;
-            // Q2
-            case 909: eval_func = &Eval2D<1,9,9>; break;
-            case 916: eval_func = &Eval2D<1,9,16>; break;
-            // Q3
-            case 1616: eval_func = &Eval2D<1,16,16>; break;
-            case 1625: eval_func = &Eval2D<1,16,25>; break;
-            case 1636: eval_func = &Eval2D<1,16,36>; break;
-            // Q4
-            case 2525: eval_func = &Eval2D<1,25,25>; break;
-            case 2536: eval_func = &Eval2D<1,25,36>; break;
-            case 2549: eval_func = &Eval2D<1,25,49>; break;
-            case 2564: eval_func = &Eval2D<1,25,64>; break;
-         }
-         if (nq >= 100 || !eval_func)
-         {
-            eval_func = &Eval2D<1>;
-         }
-      }
-      else if (dim == 3)
-      {
-         switch (1000*nd + nq)
-         {
-            // Q0
-            case 1001: eval_func = &Eval3D<1,1,1>; break;
-            case 1008: eval_func = &Eval3D<1,1,8>; break;
-            // Q1
-            case 8008: eval_func = &Eval3D<1,8,8>; break;
-            case 8027: eval_func = &Eval3D<1,8,27>; break;
-            // Q2
-            case 27027: eval_func = &Eval3D<1,27,27>; break;
-            case 27064: eval_func = &Eval3D<1,27,64>; break;
-            // Q3
-            case 64064: eval_func = &Eval3D<1,64,64>; break;
-            case 64125: eval_func = &Eval3D<1,64,125>; break;
-            case 64216: eval_func = &Eval3D<1,64,216>; break;
-            // Q4
-            case 125125: eval_func = &Eval3D<1,125,125>; break;
-            case 125216: eval_func = &Eval3D<1,125,216>; break;
-         }
-         if (nq >= 1000 || !eval_func)
-         {
-            eval_func = &Eval3D<1>;
-         }
-      }
+      eval_func = it->second;
    }
-   else if (vdim == 3 && dim == 2)
+   else if (dim == 2)
    {
-      switch (100*nd + nq)
-      {
-         // Q0
-         case 101: eval_func = &Eval2D<3,1,1>; break;
-         case 104: eval_func = &Eval2D<3,1,4>; break;
-         // Q1
-         case 404: eval_func = &Eval2D<3,4,4>; break;
-         case 409: eval_func = &Eval2D<3,4,9>; break;
-         // Q2
-         case 904: eval_func = &Eval2D<3,9,4>; break;
-         case 909: eval_func = &Eval2D<3,9,9>; break;
-         case 916: eval_func = &Eval2D<3,9,16>; break;
-         case 925: eval_func = &Eval2D<3,9,25>; break;
-         // Q3
-         case 1616: eval_func = &Eval2D<3,16,16>; break;
-         case 1625: eval_func = &Eval2D<3,16,25>; break;
-         case 1636: eval_func = &Eval2D<3,16,36>; break;
-         // Q4
-         case 2525: eval_func = &Eval2D<3,25,25>; break;
-         case 2536: eval_func = &Eval2D<3,25,36>; break;
-         case 2549: eval_func = &Eval2D<3,25,49>; break;
-         case 2564: eval_func = &Eval2D<3,25,64>; break;
-         default:   eval_func = &Eval2D<3>;
-      }
+      // Fall back to the generic, runtime-sized kernels; the limits on nd
+      // and nq are verified inside the kernels.
+      if (vdim == 1) { eval_func = &Eval2D<1>; }
+      else if (vdim == 2) { eval_func = &Eval2D<2>; }
+      else if (vdim == 3) { eval_func = &Eval2D<3>; }
    }
-   else if (vdim == dim)
+   else if (dim == 3)
    {
-      if (dim == 2)
-      {
-         switch (100*nd + nq)
-         {
-            // Q1
-            case 404: eval_func = &Eval2D<2,4,4>; break;
-            case 409: eval_func = &Eval2D<2,4,9>; break;
-            // Q2
-            case 909: eval_func = &Eval2D<2,9,9>; break;
-            case 916: eval_func = &Eval2D<2,9,16>; break;
-            // Q3
-            case 1616: eval_func = &Eval2D<2,16,16>; break;
-            case 1625: eval_func = &Eval2D<2,16,25>; break;
-            case 1636: eval_func = &Eval2D<2,16,36>; break;
-            // Q4
-            case 2525: eval_func = &Eval2D<2,25,25>; break;
-            case 2536: eval_func = &Eval2D<2,25,36>; break;
-            case 2549: eval_func = &Eval2D<2,25,49>; break;
-            case 2564: eval_func = &Eval2D<2,25,64>; break;
-         }
-         if (nq >= 100 || !eval_func)
-         {
-            eval_func = &Eval2D<2>;
-         }
-      }
-      else if (dim == 3)
-      {
-         switch (1000*nd + nq)
-         {
-            // Q1
-            case 8008: eval_func = &Eval3D<3,8,8>; break;
-            case 8027: eval_func = &Eval3D<3,8,27>; break;
-            // Q2
-            case 27027: eval_func = &Eval3D<3,27,27>; break;
-            case 27064: eval_func = &Eval3D<3,27,64>; break;
-            // Q3
-            case 64064: eval_func = &Eval3D<3,64,64>; break;
-            case 64125: eval_func = &Eval3D<3,64,125>; break;
-            case 64216: eval_func = &Eval3D<3,64,216>; break;
-            // Q4
-            case 125125: eval_func = &Eval3D<3,125,125>; break;
-            case 125216: eval_func = &Eval3D<3,125,216>; break;
-         }
-         if (nq >= 1000 || !eval_func)
-         {
-            eval_func = &Eval3D<3>;
-         }
-      }
+      if (vdim == 1) { eval_func = &Eval3D<1>; }
+      else if (vdim == 3) { eval_func = &Eval3D<3>; }
    }
    if (eval_func)
    {
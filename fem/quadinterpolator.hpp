@@ -45,6 +45,8 @@ protected:
 
    mutable bool use_tensor_products;
 
+public:
+   /// Size limits of the non-tensor evaluation kernels.
    static const int MAX_NQ2D = 100;
    static const int MAX_ND2D = 100;
    static const int MAX_VDIM2D = 3;
@@ -53,7 +55,6 @@ protected:
    static const int MAX_ND3D = 1000;
    static const int MAX_VDIM3D = 3;
 
-public:
    enum EvalFlags
    {
       VALUES       = 1 << 0,  ///< Evaluate the values at quadrature points
@@ -113,6 +114,30 @@ public:
    void MultTranspose(unsigned eval_flags, const Vector &q_val,
                       const Vector &q_der, Vector &e_vec) const;
 
+   /// Signature of the evaluation kernels used by Mult().
+   typedef void (*EvalKernel)(const int NE,
+                              const int vdim,
+                              const DofToQuad &maps,
+                              const Vector &e_vec,
+                              Vector &q_val,
+                              Vector &q_der,
+                              Vector &q_det,
+                              const int eval_flags);
+
+   /** @brief Register the evaluation kernel @a kernel for the given space
+       dimension @a dim, vector dimension @a vdim, number of element dofs
+       @a nd, and number of quadrature points @a nq.
+
+       Mult() looks up its kernel in this table before falling back to the
+       generic, runtime-sized kernel. The table is pre-populated with the
+       compile-time specializations of Eval2D() and Eval3D() generated in
+       quadinterpolator.cpp: all orders up to p = 8 with q1d = p+1 and
+       q1d = p+2 quadrature points per direction. This method can be used to
+       override a default entry or to add (dof, quadrature) combinations not
+       covered by the generated table. */
+   static void RegisterEvalKernel(int dim, int vdim, int nd, int nq,
+                                  EvalKernel kernel);
+
    // Compute kernels follow (cannot be private or protected with nvcc)
 
    /// Template compute kernel for 2D.
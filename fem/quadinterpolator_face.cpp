@@ -96,6 +96,7 @@ void FaceQuadratureInterpolator::Eval2D(
    Vector &q_der,
    Vector &q_det,
    Vector &q_nor,
+   Vector &q_ntr,
    const int eval_flags)
 {
    const int nd = maps.ndof;
@@ -106,16 +107,17 @@ void FaceQuadratureInterpolator::Eval2D(
    MFEM_VERIFY(ND1D <= MAX_ND1D, "");
    MFEM_VERIFY(NQ1D <= MAX_NQ1D, "");
    MFEM_VERIFY(VDIM == 2 || !(eval_flags & DETERMINANTS), "");
+   MFEM_VERIFY(VDIM == 2 || !(eval_flags & NORMALS), "");
+   MFEM_VERIFY(VDIM == 2 || !(eval_flags & NORMAL_TRACES), "");
    auto B = Reshape(maps.B.Read(), NQ1D, ND1D);
    auto G = Reshape(maps.G.Read(), NQ1D, ND1D);
    auto F = Reshape(f_vec.Read(), ND1D, VDIM, NF);
    auto sign = signs.Read();
    auto val = Reshape(q_val.Write(), NQ1D, VDIM, NF);
-   // auto der = Reshape(q_der.Write(), NQ1D, VDIM, NF); // only tangential der
+   auto der = Reshape(q_der.Write(), NQ1D, VDIM, NF); // tangential derivatives
    auto det = Reshape(q_det.Write(), NQ1D, NF);
    auto n   = Reshape(q_nor.Write(), NQ1D, VDIM, NF);
-   MFEM_VERIFY(eval_flags | DERIVATIVES,
-               "Derivatives on the faces are not yet supported.");
+   auto ntr = Reshape(q_ntr.Write(), NQ1D, NF);
    // If Gauss-Lobatto
    MFEM_FORALL(f, NF,
    {
@@ -134,20 +136,22 @@ void FaceQuadratureInterpolator::Eval2D(
       }
       for (int q = 0; q < NQ1D; ++q)
       {
-         if (eval_flags & VALUES)
+         double ed[max_VDIM];
+         if (eval_flags & (VALUES | NORMAL_TRACES))
          {
-            double ed[max_VDIM];
             for (int c = 0; c < VDIM; c++) { ed[c] = 0.0; }
             for (int d = 0; d < ND1D; ++d)
             {
                const double b = B(q,d);
                for (int c = 0; c < VDIM; c++) { ed[c] += b*r_F[d][c]; }
             }
-            for (int c = 0; c < VDIM; c++) { val(q,c,f) = ed[c]; }
+            if (eval_flags & VALUES)
+            {
+               for (int c = 0; c < VDIM; c++) { val(q,c,f) = ed[c]; }
+            }
          }
-         if ((eval_flags & DERIVATIVES)
-             || (eval_flags & DETERMINANTS)
-             || (eval_flags & NORMALS))
+         if (eval_flags & (DERIVATIVES | DETERMINANTS | NORMALS |
+                           NORMAL_TRACES))
          {
             double D[max_VDIM];
             for (int i = 0; i < VDIM; i++) { D[i] = 0.0; }
@@ -160,20 +164,30 @@ void FaceQuadratureInterpolator::Eval2D(
                   D[c] += s_e * w;
                }
             }
+            if (eval_flags & DERIVATIVES)
+            {
+               // derivative along the (reference) face coordinate
+               for (int c = 0; c < VDIM; c++) { der(q,c,f) = D[c]; }
+            }
             if (VDIM == 2 &&
-                ((eval_flags & NORMALS)
-                 || (eval_flags & DETERMINANTS)))
+                (eval_flags & (NORMALS | DETERMINANTS | NORMAL_TRACES)))
             {
                const double norm = sqrt(D[0]*D[0]+D[1]*D[1]);
+               const double s = sign[f] ? -1.0 : 1.0;
+               const double n0 =  s*D[1]/norm;
+               const double n1 = -s*D[0]/norm;
                if (eval_flags & DETERMINANTS)
                {
                   det(q,f) = norm;
                }
                if (eval_flags & NORMALS)
                {
-                  const double s = sign[f] ? -1.0 : 1.0;
-                  n(q,0,f) =  s*D[1]/norm;
-                  n(q,1,f) = -s*D[0]/norm;
+                  n(q,0,f) = n0;
+                  n(q,1,f) = n1;
+               }
+               if (eval_flags & NORMAL_TRACES)
+               {
+                  ntr(q,f) = ed[0]*n0 + ed[1]*n1;
                }
             }
          }
@@ -192,6 +206,7 @@ void FaceQuadratureInterpolator::Eval3D(
    Vector &q_der,
    Vector &q_det,
    Vector &q_nor,
+   Vector &q_ntr,
    const int eval_flags)
 {
    const int nd = maps.ndof;
@@ -202,16 +217,18 @@ void FaceQuadratureInterpolator::Eval3D(
    MFEM_VERIFY(ND1D <= MAX_ND1D, "");
    MFEM_VERIFY(NQ1D <= MAX_NQ1D, "");
    MFEM_VERIFY(VDIM == 3 || !(eval_flags & DETERMINANTS), "");
+   MFEM_VERIFY(VDIM == 3 || !(eval_flags & NORMALS), "");
+   MFEM_VERIFY(VDIM == 3 || !(eval_flags & NORMAL_TRACES), "");
    auto B = Reshape(maps.B.Read(), NQ1D, ND1D);
    auto G = Reshape(maps.G.Read(), NQ1D, ND1D);
    auto F = Reshape(e_vec.Read(), ND1D, ND1D, VDIM, NF);
    auto sign = signs.Read();
    auto val = Reshape(q_val.Write(), NQ1D, NQ1D, VDIM, NF);
-   // auto der = Reshape(q_der.Write(), NQ1D, VDIM, 3, NF);
+   // the two tangential derivatives, along the reference face coordinates
+   auto der = Reshape(q_der.Write(), NQ1D, NQ1D, VDIM, 2, NF);
    auto det = Reshape(q_det.Write(), NQ1D, NQ1D, NF);
    auto nor = Reshape(q_nor.Write(), NQ1D, NQ1D, 3, NF);
-   MFEM_VERIFY(eval_flags | DERIVATIVES,
-               "Derivatives on the faces are not yet supported.");
+   auto ntr = Reshape(q_ntr.Write(), NQ1D, NQ1D, NF);
    MFEM_FORALL(f, NF,
    {
       const int ND1D = T_ND1D ? T_ND1D : nd;
@@ -231,9 +248,10 @@ void FaceQuadratureInterpolator::Eval3D(
             }
          }
       }
-      if (eval_flags & VALUES)
+      double BBu[max_NQ1D][max_NQ1D][max_VDIM];
+      if (eval_flags & (VALUES | NORMAL_TRACES))
       {
-         double Bu[max_NQ1D][max_ND1D][VDIM];
+         double Bu[max_NQ1D][max_ND1D][max_VDIM];
          for (int d2 = 0; d2 < ND1D; ++d2)
          {
             for (int q = 0; q < NQ1D; ++q)
@@ -249,7 +267,6 @@ void FaceQuadratureInterpolator::Eval3D(
                }
             }
          }
-         double BBu[max_NQ1D][max_NQ1D][VDIM];
          for (int q2 = 0; q2 < NQ1D; ++q2)
          {
             for (int q1 = 0; q1 < NQ1D; ++q1)
@@ -263,20 +280,21 @@ void FaceQuadratureInterpolator::Eval3D(
                      BBu[q2][q1][c] += b*Bu[q1][d2][c];
                   }
                }
-               for (int c = 0; c < VDIM; c++)
+               if (eval_flags & VALUES)
                {
-                  val(q1,q2,c,f) = BBu[q2][q1][c];
+                  for (int c = 0; c < VDIM; c++)
+                  {
+                     val(q1,q2,c,f) = BBu[q2][q1][c];
+                  }
                }
             }
          }
       }
-      if ((eval_flags & DERIVATIVES)
-          || (eval_flags & DETERMINANTS)
-          || (eval_flags & NORMALS))
+      if (eval_flags & (DERIVATIVES | DETERMINANTS | NORMALS | NORMAL_TRACES))
       {
          // We only compute the tangential derivatives
-         double Gu[max_NQ1D][max_ND1D][VDIM];
-         double Bu[max_NQ1D][max_ND1D][VDIM];
+         double Gu[max_NQ1D][max_ND1D][max_VDIM];
+         double Bu[max_NQ1D][max_ND1D][max_VDIM];
          for (int d2 = 0; d2 < ND1D; ++d2)
          {
             for (int q = 0; q < NQ1D; ++q)
@@ -299,8 +317,8 @@ void FaceQuadratureInterpolator::Eval3D(
                }
             }
          }
-         double BGu[max_NQ1D][max_NQ1D][VDIM];
-         double GBu[max_NQ1D][max_NQ1D][VDIM];
+         double BGu[max_NQ1D][max_NQ1D][max_VDIM];
+         double GBu[max_NQ1D][max_NQ1D][max_VDIM];
          for (int q2 = 0; q2 < NQ1D; ++q2)
          {
             for (int q1 = 0; q1 < NQ1D; ++q1)
@@ -322,8 +340,22 @@ void FaceQuadratureInterpolator::Eval3D(
                }
             }
          }
-         if (VDIM == 3 && ((eval_flags & NORMALS) ||
-                           (eval_flags & DETERMINANTS)))
+         if (eval_flags & DERIVATIVES)
+         {
+            for (int q2 = 0; q2 < NQ1D; ++q2)
+            {
+               for (int q1 = 0; q1 < NQ1D; ++q1)
+               {
+                  for (int c = 0; c < VDIM; c++)
+                  {
+                     der(q1,q2,c,0,f) = BGu[q2][q1][c];
+                     der(q1,q2,c,1,f) = GBu[q2][q1][c];
+                  }
+               }
+            }
+         }
+         if (VDIM == 3 && (eval_flags & (NORMALS | DETERMINANTS |
+                                         NORMAL_TRACES)))
          {
             double n[3];
             for (int q2 = 0; q2 < NQ1D; ++q2)
@@ -345,6 +377,11 @@ void FaceQuadratureInterpolator::Eval3D(
                      nor(q1,q2,1,f) = n[1]/norm;
                      nor(q1,q2,2,f) = n[2]/norm;
                   }
+                  if (eval_flags & NORMAL_TRACES)
+                  {
+                     ntr(q1,q2,f) = (BBu[q2][q1][0]*n[0] + BBu[q2][q1][1]*n[1]
+                                     + BBu[q2][q1][2]*n[2])/norm;
+                  }
                }
             }
          }
@@ -354,7 +391,8 @@ void FaceQuadratureInterpolator::Eval3D(
 
 void FaceQuadratureInterpolator::Mult(
    const Vector &e_vec, unsigned eval_flags,
-   Vector &q_val, Vector &q_der, Vector &q_det, Vector &q_nor) const
+   Vector &q_val, Vector &q_der, Vector &q_det, Vector &q_nor,
+   Vector &q_ntr) const
 {
    if (nf == 0) { return; }
    const int vdim = fespace->GetVDim();
@@ -375,6 +413,7 @@ void FaceQuadratureInterpolator::Mult(
       Vector &q_der,
       Vector &q_det,
       Vector &q_nor,
+      Vector &q_ntr,
       const int eval_flags) = NULL;
    if (vdim == 1)
    {
@@ -487,7 +526,7 @@ void FaceQuadratureInterpolator::Mult(
    if (eval_func)
    {
       eval_func(nf, vdim, maps, signs, e_vec,
-                q_val, q_der, q_det, q_nor, eval_flags);
+                q_val, q_der, q_det, q_nor, q_ntr, eval_flags);
    }
    else
    {
@@ -498,8 +537,22 @@ void FaceQuadratureInterpolator::Mult(
 void FaceQuadratureInterpolator::Values(
    const Vector &e_vec, Vector &q_val) const
 {
-   Vector q_der, q_det, q_nor;
-   Mult(e_vec, VALUES, q_val, q_der, q_det, q_nor);
+   Vector q_der, q_det, q_nor, q_ntr;
+   Mult(e_vec, VALUES, q_val, q_der, q_det, q_nor, q_ntr);
+}
+
+void FaceQuadratureInterpolator::Derivatives(
+   const Vector &e_vec, Vector &q_der) const
+{
+   Vector q_val, q_det, q_nor, q_ntr;
+   Mult(e_vec, DERIVATIVES, q_val, q_der, q_det, q_nor, q_ntr);
+}
+
+void FaceQuadratureInterpolator::NormalTraces(
+   const Vector &e_vec, Vector &q_ntr) const
+{
+   Vector q_val, q_der, q_det, q_nor;
+   Mult(e_vec, NORMAL_TRACES, q_val, q_der, q_det, q_nor, q_ntr);
 }
 
 } // namespace mfem
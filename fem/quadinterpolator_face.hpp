@@ -57,7 +57,12 @@ public:
           this flag can be used to compute and store their determinants. This
           flag can only be used in Mult(). */
       DETERMINANTS = 1 << 2,
-      NORMALS      = 1 << 3
+      NORMALS      = 1 << 3,
+      /** @brief For vector fields with vdim == dim, evaluate the normal
+          component (val . n) of the field at the quadrature points, fused
+          with the face-geometry (normal and determinant) computation. This
+          is the normal trace needed, e.g., by H(div) and DG face terms. */
+      NORMAL_TRACES = 1 << 4
    };
 
    FaceQuadratureInterpolator(const FiniteElementSpace &fes,
@@ -74,17 +79,35 @@ public:
    /** The @a eval_flags are a bitwise mask of constants from the FaceEvalFlags
        enumeration. When the VALUES flag is set, the values at quadrature points
        are computed and stored in the Vector @a q_val. Similarly, when the flag
-       DERIVATIVES is set, the derivatives are computed and stored in @a q_der.
-       When the DETERMINANTS flags is set, it is assumed that the derivatives
-       form a matrix at each quadrature point (i.e. the associated
-       FiniteElementSpace is a vector space) and their determinants are computed
-       and stored in @a q_det. */
+       DERIVATIVES is set, the tangential derivatives (along the reference face
+       coordinates) are computed and stored in @a q_der. When the DETERMINANTS
+       flags is set, it is assumed that the derivatives form a matrix at each
+       quadrature point (i.e. the associated FiniteElementSpace is a vector
+       space) and their determinants are computed and stored in @a q_det. When
+       the NORMAL_TRACES flag is set (vector spaces with vdim == dim only), the
+       normal components (val . n) are computed and stored in @a q_ntr, reusing
+       the face geometry evaluated for the normals and determinants. All
+       requested quantities are computed in a single fused pass over the
+       faces. */
    void Mult(const Vector &e_vec, unsigned eval_flags,
-             Vector &q_val, Vector &q_der, Vector &q_det, Vector &q_nor) const;
+             Vector &q_val, Vector &q_der, Vector &q_det, Vector &q_nor,
+             Vector &q_ntr) const;
 
    /// Interpolate the values of the E-vector @a e_vec at quadrature points.
    void Values(const Vector &e_vec, Vector &q_val) const;
 
+   /** @brief Interpolate the tangential derivatives of the E-vector @a e_vec
+       at quadrature points. */
+   /** In 2D the layout of @a q_der is (NQ x VDIM x NF); in 3D it is
+       (NQ1D x NQ1D x VDIM x 2 x NF) with the two slots holding the
+       derivatives along the two reference face coordinates. */
+   void Derivatives(const Vector &e_vec, Vector &q_der) const;
+
+   /** @brief Evaluate the normal components (val . n) of the vector E-vector
+       @a e_vec at quadrature points, with layout (NQ x NF). Only supported
+       for spaces with vdim == dim. */
+   void NormalTraces(const Vector &e_vec, Vector &q_ntr) const;
+
    // Compute kernels follow (cannot be private or protected with nvcc)
 
    /// Template compute kernel for 2D.
@@ -98,6 +121,7 @@ public:
                       Vector &q_der,
                       Vector &q_det,
                       Vector &q_nor,
+                      Vector &q_ntr,
                       const int eval_flags);
 
    /// Template compute kernel for 3D.
@@ -111,6 +135,7 @@ public:
                       Vector &q_der,
                       Vector &q_det,
                       Vector &q_nor,
+                      Vector &q_ntr,
                       const int eval_flags);
 };
 
@@ -0,0 +1,252 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "resampler.hpp"
+#include "restriction.hpp"
+#include "../general/forall.hpp"
+#include "../general/text.hpp"
+
+#include <fstream>
+
+namespace mfem
+{
+
+UniformGridResampler::UniformGridResampler(Mesh &mesh_, const Vector &p_min,
+                                           const Vector &p_max,
+                                           const Array<int> &num_points)
+   : mesh(mesh_), lattice(3), outside_value(0.0), tab_fes(NULL), tab_ndof(0)
+{
+   const int sdim = mesh.SpaceDimension();
+   MFEM_VERIFY(p_min.Size() == sdim && p_max.Size() == sdim &&
+               num_points.Size() == sdim,
+               "p_min, p_max, and num_points must have one entry per space"
+               " dimension");
+   box_min = p_min;
+   box_max = p_max;
+   lattice = 1;
+   for (int d = 0; d < sdim; d++)
+   {
+      MFEM_VERIFY(num_points[d] >= 1, "invalid number of lattice points");
+      lattice[d] = num_points[d];
+   }
+   point_shape.UseDevice(true);
+   e_vec.UseDevice(true);
+
+   Setup();
+}
+
+void UniformGridResampler::Setup()
+{
+   const int sdim = mesh.SpaceDimension();
+   const int np = lattice[0]*lattice[1]*lattice[2];
+
+   DenseMatrix point_mat(sdim, np);
+   for (int k = 0; k < lattice[2]; k++)
+   {
+      for (int j = 0; j < lattice[1]; j++)
+      {
+         for (int i = 0; i < lattice[0]; i++)
+         {
+            const int p = i + lattice[0]*(j + lattice[1]*k);
+            const int idx[3] = { i, j, k };
+            for (int d = 0; d < sdim; d++)
+            {
+               const int n = lattice[d];
+               const double frac = (n > 1) ? idx[d]/(n - 1.0) : 0.5;
+               point_mat(d, p) = box_min(d) + frac*(box_max(d) - box_min(d));
+            }
+         }
+      }
+   }
+
+   mesh.FindPoints(point_mat, point_elem, point_ip, false);
+
+   tab_fes = NULL; // the located reference points changed
+}
+
+void UniformGridResampler::Tabulate(const FiniteElementSpace &fes) const
+{
+   if (tab_fes == &fes)
+   {
+      return;
+   }
+
+   MFEM_VERIFY(fes.GetMesh() == &mesh,
+               "the field is not defined on the resampled mesh");
+
+   const int np = point_elem.Size();
+   const int nd = (mesh.GetNE() > 0) ? fes.GetFE(0)->GetDof() : 0;
+
+   point_shape.SetSize(nd*np);
+   point_shape = 0.0;
+
+   Vector shape;
+   auto h_shape = Reshape(point_shape.HostWrite(), nd, np);
+   for (int p = 0; p < np; p++)
+   {
+      const int e = point_elem[p];
+      if (e < 0)
+      {
+         continue;
+      }
+      const FiniteElement *fe = fes.GetFE(e);
+      MFEM_VERIFY(fe->GetRangeType() == FiniteElement::SCALAR &&
+                  fe->GetDof() == nd,
+                  "only uniform scalar finite element spaces are supported");
+      shape.SetSize(nd);
+      if (fe->GetMapType() == FiniteElement::VALUE)
+      {
+         fe->CalcShape(point_ip[p], shape);
+      }
+      else
+      {
+         ElementTransformation *T = mesh.GetElementTransformation(e);
+         T->SetIntPoint(&point_ip[p]);
+         fe->CalcPhysShape(*T, shape);
+      }
+      for (int j = 0; j < nd; j++)
+      {
+         h_shape(j, p) = shape(j);
+      }
+   }
+
+   tab_fes = &fes;
+   tab_ndof = nd;
+}
+
+void UniformGridResampler::Resample(const GridFunction &gf,
+                                    Vector &values) const
+{
+   const FiniteElementSpace *fes = gf.FESpace();
+   Tabulate(*fes);
+
+   const int np = point_elem.Size();
+   const int vd = fes->GetVDim();
+   const int nd = tab_ndof;
+   const int ne = mesh.GetNE();
+
+   values.UseDevice(true);
+   values.SetSize(np*vd);
+   if (ne == 0)
+   {
+      values = outside_value;
+      return;
+   }
+
+   const Operator *R = fes->GetElementRestriction(ElementDofOrdering::NATIVE);
+   MFEM_VERIFY(R, "mixed meshes are not supported");
+   e_vec.SetSize(R->Height());
+   R->Mult(gf, e_vec);
+
+   const double fill = outside_value;
+   auto d_elem = point_elem.Read();
+   auto d_shape = Reshape(point_shape.Read(), nd, np);
+   auto d_e = Reshape(e_vec.Read(), nd, vd, ne);
+   auto d_val = Reshape(values.Write(), np, vd);
+   MFEM_FORALL(p, np,
+   {
+      const int e = d_elem[p];
+      for (int c = 0; c < vd; c++)
+      {
+         double val = fill;
+         if (e >= 0)
+         {
+            val = 0.0;
+            for (int j = 0; j < nd; j++)
+            {
+               val += d_shape(j, p)*d_e(j, c, e);
+            }
+         }
+         d_val(p, c) = val;
+      }
+   });
+}
+
+
+UniformGridDataCollection::UniformGridDataCollection(
+   const std::string &collection_name, Mesh &mesh_, const Vector &p_min,
+   const Vector &p_max, const Array<int> &num_points)
+   : DataCollection(collection_name, &mesh_),
+     resampler(mesh_, p_min, p_max, num_points)
+{
+}
+
+void UniformGridDataCollection::Save()
+{
+   int err;
+
+   std::string dir_name = prefix_path + name;
+   if (cycle != -1)
+   {
+      dir_name += "_" + to_padded_string(cycle, pad_digits_cycle);
+   }
+   err = create_directory(dir_name, mesh, myid);
+   if (err)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error creating directory: " << dir_name);
+      return; // do not even try to write the bricks
+   }
+
+   std::string rank_suffix = "";
+   if (!serial || appendRankToFileName)
+   {
+      rank_suffix = "." + to_padded_string(myid, pad_digits_rank);
+   }
+
+   // write the text header describing the lattice and the bricks
+   {
+      std::string header_name = dir_name + "/grid.header" + rank_suffix;
+      std::ofstream header(header_name.c_str());
+      header.precision(precision);
+      const Array<int> &n = resampler.GetLatticeSize();
+      const Vector &p_min = resampler.GetBoxMin();
+      const Vector &p_max = resampler.GetBoxMax();
+      header << "lattice " << n[0] << ' ' << n[1] << ' ' << n[2] << '\n';
+      header << "box_min";
+      for (int d = 0; d < p_min.Size(); d++) { header << ' ' << p_min(d); }
+      header << "\nbox_max";
+      for (int d = 0; d < p_max.Size(); d++) { header << ' ' << p_max(d); }
+      header << "\ncycle " << cycle << '\n';
+      header << "time " << time << '\n';
+      for (FieldMapConstIterator it = field_map.begin();
+           it != field_map.end(); ++it)
+      {
+         header << "field " << it->first << ' '
+                << it->second->FESpace()->GetVDim() << '\n';
+      }
+      if (!header)
+      {
+         error = WRITE_ERROR;
+         MFEM_WARNING("Error writing header to file: " << header_name);
+      }
+   }
+
+   // write one raw brick of doubles per registered field
+   Vector values;
+   for (FieldMapIterator it = field_map.begin(); it != field_map.end(); ++it)
+   {
+      resampler.Resample(*it->second, values);
+
+      std::string brick_name = dir_name + "/" + it->first + ".brick" +
+                               rank_suffix;
+      std::ofstream brick(brick_name.c_str(), std::ios::binary);
+      brick.write(reinterpret_cast<const char *>(values.HostRead()),
+                  values.Size()*sizeof(double));
+      if (!brick)
+      {
+         error = WRITE_ERROR;
+         MFEM_WARNING("Error writing brick to file: " << brick_name);
+      }
+   }
+}
+
+} // namespace mfem
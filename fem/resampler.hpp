@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_RESAMPLER
+#define MFEM_RESAMPLER
+
+#include "../config/config.hpp"
+#include "gridfunc.hpp"
+#include "datacollection.hpp"
+
+namespace mfem
+{
+
+/** @brief Evaluates grid functions on a uniform Cartesian lattice.
+
+    The lattice points are located in the mesh once with Mesh::FindPoints()
+    and the basis values at the located reference coordinates are tabulated
+    per finite element space. Each Resample() call then reduces to one element
+    restriction plus one batched device kernel that contracts the tabulated
+    basis with the E-vector of the field, in the style of the
+    QuadratureInterpolator. Intended for in-situ visualization output where a
+    compact raw brick replaces the full high-order field, see
+    UniformGridDataCollection. */
+class UniformGridResampler
+{
+protected:
+   Mesh &mesh;
+   Array<int> lattice;  ///< number of points per direction: nx, ny, nz
+   Vector box_min, box_max;
+   double outside_value;
+
+   /// Element containing each lattice point; -1 when the point was not found
+   /// (or, on a ParMesh, -2 when it was assigned to another rank).
+   Array<int> point_elem;
+   /// Reference coordinates of the located lattice points.
+   Array<IntegrationPoint> point_ip;
+
+   /// The space the basis tabulation below corresponds to; NULL when no
+   /// tabulation is available.
+   mutable const FiniteElementSpace *tab_fes;
+   mutable int tab_ndof;
+   /// Basis values, (tab_ndof x num points): column p holds the values of the
+   /// dofs of element point_elem[p] at lattice point p.
+   mutable Vector point_shape;
+   /// Scratch E-vector for Resample().
+   mutable Vector e_vec;
+
+   /// Tabulate the basis values of @a fes at the located lattice points.
+   void Tabulate(const FiniteElementSpace &fes) const;
+
+public:
+   /** @brief Create a resampler for the box [@a p_min, @a p_max] covered by
+       @a num_points lattice points per direction.
+
+       @a p_min, @a p_max, and @a num_points have one entry per space
+       dimension; each direction with more than one point samples the box
+       boundaries inclusively, a direction with a single point samples the box
+       center. The points are located immediately, see Setup(). */
+   UniformGridResampler(Mesh &mesh_, const Vector &p_min, const Vector &p_max,
+                        const Array<int> &num_points);
+
+   /// Value assigned to lattice points outside the (local) mesh, 0 by default.
+   void SetOutsideValue(double value) { outside_value = value; }
+
+   /// Total number of lattice points.
+   int GetNPoints() const { return point_elem.Size(); }
+   /// Number of lattice points per direction (nx, ny, nz).
+   const Array<int> &GetLatticeSize() const { return lattice; }
+   const Vector &GetBoxMin() const { return box_min; }
+   const Vector &GetBoxMax() const { return box_max; }
+
+   /// Re-locate the lattice points, e.g. after mesh adaptation or motion.
+   /// Invalidates the basis tabulation.
+   void Setup();
+
+   /** @brief Evaluate @a gf at the lattice points.
+
+       On return @a values has size GetNPoints() x vdim with each component
+       stored as a contiguous brick, the x-index varying fastest. Points
+       outside the (local) mesh get the value set by SetOutsideValue(). */
+   void Resample(const GridFunction &gf, Vector &values) const;
+};
+
+
+/** @brief Data collection that saves its fields resampled on a uniform grid.
+
+    Save() writes, per registered field, a raw binary brick of doubles (see
+    UniformGridResampler::Resample() for the layout) next to a small text
+    header describing the lattice, so the output can be memory-mapped or
+    loaded by visualization tools directly, without rediscretizing the
+    high-order fields. In parallel every rank writes its own brick covering
+    the locally found lattice points; q-fields are ignored. */
+class UniformGridDataCollection : public DataCollection
+{
+protected:
+   UniformGridResampler resampler;
+
+public:
+   /// Create the collection; the lattice parameters are described in
+   /// UniformGridResampler::UniformGridResampler().
+   UniformGridDataCollection(const std::string &collection_name, Mesh &mesh_,
+                             const Vector &p_min, const Vector &p_max,
+                             const Array<int> &num_points);
+
+   /// Access the resampler, e.g. to call Setup() after mesh adaptation.
+   UniformGridResampler &GetResampler() { return resampler; }
+
+   /// Save the header and one brick per registered field.
+   virtual void Save();
+};
+
+} // namespace mfem
+
+#endif
@@ -50,51 +50,91 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
          dynamic_cast<const TensorBasisElement*>(fe);
       const Array<int> &fe_dof_map = el->GetDofMap();
       MFEM_VERIFY(fe_dof_map.Size() > 0, "invalid dof map");
-      dof_map = fe_dof_map.GetData();
+      dof_map = fe_dof_map.Read(); // device pointer, see the kernels below
    }
    const Table& e2dTable = fes.GetElementToDofTable();
-   const int* elementMap = e2dTable.GetJ();
-   // We will be keeping a count of how many local nodes point to its global dof
-   for (int i = 0; i <= ndofs; ++i)
+   const int *d_elementMap = e2dTable.ReadJ();
+   const int DOF = dof;
+   const int NDOFS = ndofs;
+   // We will be keeping a count of how many local nodes point to its global
+   // dof. The construction passes below run as (threaded) device kernels;
+   // only the counting and the slot claims use atomic increments and the
+   // ranges are sorted afterwards, so the result is identical to the one of
+   // a serial construction.
+   auto d_offsets = offsets.Write();
+   MFEM_FORALL(i, NDOFS+1, d_offsets[i] = 0;);
+   MFEM_FORALL(l, nedofs,
    {
-      offsets[i] = 0;
-   }
-   for (int e = 0; e < ne; ++e)
-   {
-      for (int d = 0; d < dof; ++d)
-      {
-         const int sgid = elementMap[dof*e + d];  // signed
-         const int gid = (sgid >= 0) ? sgid : -1 - sgid;
-         ++offsets[gid + 1];
-      }
-   }
+      const int sgid = d_elementMap[l];  // signed
+      const int gid = (sgid >= 0) ? sgid : -1 - sgid;
+      AtomicAdd(d_offsets[gid + 1], 1);
+   });
    // Aggregate to find offsets for each global dof
+   offsets.HostReadWrite();
    for (int i = 1; i <= ndofs; ++i)
    {
       offsets[i] += offsets[i - 1];
    }
    // For each global dof, fill in all local nodes that point to it
-   for (int e = 0; e < ne; ++e)
+   Array<int> counter(ndofs);
+   auto d_counter = counter.Write();
+   MFEM_FORALL(i, NDOFS, d_counter[i] = 0;);
+   const bool reorder = dof_reorder;
+   const int *d_dof_map = dof_map;
+   auto d_offs = offsets.Read();
+   auto d_indices = indices.Write();
+   auto d_gatherMap = gatherMap.Write();
+   MFEM_FORALL(lid, nedofs,
    {
-      for (int d = 0; d < dof; ++d)
+      const int e = lid / DOF;
+      const int d = lid % DOF;
+      const int sdid = reorder ? d_dof_map[d] : 0;  // signed
+      const int did = (!reorder)?d:(sdid >= 0 ? sdid : -1-sdid);
+      const int sgid = d_elementMap[DOF*e + did];  // signed
+      const int gid = (sgid >= 0) ? sgid : -1-sgid;
+      const bool plus = (sgid >= 0 && sdid >= 0) || (sgid < 0 && sdid < 0);
+      d_gatherMap[lid] = plus ? gid : -1-gid;
+      const int k = AtomicAdd(d_counter[gid], 1);
+      d_indices[d_offs[gid] + k] = plus ? lid : -1-lid;
+   });
+   // The atomics claim the slots of each dof's range in arbitrary order:
+   // sort the (short) ranges by local index so that MultTranspose()
+   // accumulates in the same order independently of the thread schedule.
+   MFEM_FORALL(i, NDOFS,
+   {
+      const int begin = d_offs[i], end = d_offs[i+1];
+      for (int j = begin + 1; j < end; ++j)
       {
-         const int sdid = dof_reorder ? dof_map[d] : 0;  // signed
-         const int did = (!dof_reorder)?d:(sdid >= 0 ? sdid : -1-sdid);
-         const int sgid = elementMap[dof*e + did];  // signed
-         const int gid = (sgid >= 0) ? sgid : -1-sgid;
-         const int lid = dof*e + d;
-         const bool plus = (sgid >= 0 && sdid >= 0) || (sgid < 0 && sdid < 0);
-         gatherMap[lid] = plus ? gid : -1-gid;
-         indices[offsets[gid]++] = plus ? lid : -1-lid;
+         const int v = d_indices[j];
+         const int key = (v >= 0) ? v : -1 - v;
+         int k = j - 1;
+         for ( ; k >= begin; --k)
+         {
+            const int w = d_indices[k];
+            const int wkey = (w >= 0) ? w : -1 - w;
+            if (wkey <= key) { break; }
+            d_indices[k+1] = w;
+         }
+         d_indices[k+1] = v;
       }
+   });
+   // Split the global dofs by the number of element nodes targeting them:
+   // the single-node majority is handled by a conflict-free copy kernel in
+   // MultTranspose(), only the dofs shared by several nodes accumulate.
+   const int *h_offsets = offsets.HostRead();
+   int nsingle = 0;
+   for (int i = 0; i < ndofs; ++i)
+   {
+      if (h_offsets[i+1] - h_offsets[i] == 1) { ++nsingle; }
    }
-   // We shifted the offsets vector by 1 by using it as a counter.
-   // Now we shift it back.
-   for (int i = ndofs; i > 0; --i)
+   singleDofs.SetSize(nsingle);
+   sharedDofs.SetSize(ndofs - nsingle);
+   int s = 0, m = 0;
+   for (int i = 0; i < ndofs; ++i)
    {
-      offsets[i] = offsets[i - 1];
+      if (h_offsets[i+1] - h_offsets[i] == 1) { singleDofs[s++] = i; }
+      else { sharedDofs[m++] = i; }
    }
-   offsets[0] = 0;
 }
 
 void ElementRestriction::Mult(const Vector& x, Vector& y) const
@@ -150,8 +190,24 @@ void ElementRestriction::MultTranspose(const Vector& x, Vector& y) const
    auto d_indices = indices.Read();
    auto d_x = Reshape(x.Read(), nd, vd, ne);
    auto d_y = Reshape(y.Write(), t?vd:ndofs, t?ndofs:vd);
-   MFEM_FORALL(i, ndofs,
+   // dofs targeted by a single element node: conflict-free signed copy
+   auto d_single = singleDofs.Read();
+   MFEM_FORALL(k, singleDofs.Size(),
    {
+      const int i = d_single[k];
+      const int j = d_indices[d_offsets[i]];
+      const int idx_j = (j >= 0) ? j : -1 - j;
+      for (int c = 0; c < vd; ++c)
+      {
+         const double dofValue = d_x(idx_j % nd, c, idx_j / nd);
+         d_y(t?c:i,t?i:c) = (j >= 0) ? dofValue : -dofValue;
+      }
+   });
+   // dofs shared by several element nodes: accumulate their contributions
+   auto d_shared = sharedDofs.Read();
+   MFEM_FORALL(k, sharedDofs.Size(),
+   {
+      const int i = d_shared[k];
       const int offset = d_offsets[i];
       const int nextOffset = d_offsets[i + 1];
       for (int c = 0; c < vd; ++c)
@@ -168,6 +224,50 @@ void ElementRestriction::MultTranspose(const Vector& x, Vector& y) const
    });
 }
 
+void ElementRestriction::AddMultTranspose(const Vector& x, Vector& y) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   // dofs targeted by a single element node: conflict-free signed update
+   auto d_single = singleDofs.Read();
+   MFEM_FORALL(k, singleDofs.Size(),
+   {
+      const int i = d_single[k];
+      const int j = d_indices[d_offsets[i]];
+      const int idx_j = (j >= 0) ? j : -1 - j;
+      for (int c = 0; c < vd; ++c)
+      {
+         const double dofValue = d_x(idx_j % nd, c, idx_j / nd);
+         d_y(t?c:i,t?i:c) += (j >= 0) ? dofValue : -dofValue;
+      }
+   });
+   // dofs shared by several element nodes: accumulate their contributions
+   auto d_shared = sharedDofs.Read();
+   MFEM_FORALL(k, sharedDofs.Size(),
+   {
+      const int i = d_shared[k];
+      const int offset = d_offsets[i];
+      const int nextOffset = d_offsets[i + 1];
+      for (int c = 0; c < vd; ++c)
+      {
+         double dofValue = 0;
+         for (int j = offset; j < nextOffset; ++j)
+         {
+            const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 - d_indices[j];
+            dofValue += (d_indices[j] >= 0) ? d_x(idx_j % nd, c,
+            idx_j / nd) : -d_x(idx_j % nd, c, idx_j / nd);
+         }
+         d_y(t?c:i,t?i:c) += dofValue;
+      }
+   });
+}
+
 void ElementRestriction::MultTransposeUnsigned(const Vector& x, Vector& y) const
 {
    // Assumes all elements have the same number of dofs
@@ -178,8 +278,23 @@ void ElementRestriction::MultTransposeUnsigned(const Vector& x, Vector& y) const
    auto d_indices = indices.Read();
    auto d_x = Reshape(x.Read(), nd, vd, ne);
    auto d_y = Reshape(y.Write(), t?vd:ndofs, t?ndofs:vd);
-   MFEM_FORALL(i, ndofs,
+   // dofs targeted by a single element node: conflict-free copy
+   auto d_single = singleDofs.Read();
+   MFEM_FORALL(k, singleDofs.Size(),
+   {
+      const int i = d_single[k];
+      const int j = d_indices[d_offsets[i]];
+      const int idx_j = (j >= 0) ? j : -1 - j;
+      for (int c = 0; c < vd; ++c)
+      {
+         d_y(t?c:i,t?i:c) = d_x(idx_j % nd, c, idx_j / nd);
+      }
+   });
+   // dofs shared by several element nodes: accumulate their contributions
+   auto d_shared = sharedDofs.Read();
+   MFEM_FORALL(k, sharedDofs.Size(),
    {
+      const int i = d_shared[k];
       const int offset = d_offsets[i];
       const int nextOffset = d_offsets[i + 1];
       for (int c = 0; c < vd; ++c)
@@ -446,6 +561,183 @@ void ElementRestriction::FillJAndData(const Vector &ea_data,
    h_I[0] = 0;
 }
 
+GeometryElementRestriction::GeometryElementRestriction(
+   const FiniteElementSpace &f, ElementDofOrdering e_ordering,
+   Geometry::Type g)
+   : fes(f),
+     geom(g),
+     vdim(fes.GetVDim()),
+     byvdim(fes.GetOrdering() == Ordering::byVDIM),
+     ndofs(fes.GetNDofs())
+{
+   const int ne = fes.GetNE();
+   elem_list.Reserve(ne);
+   for (int e = 0; e < ne; ++e)
+   {
+      if (fes.GetMesh()->GetElementBaseGeometry(e) == geom)
+      {
+         elem_list.Append(e);
+      }
+   }
+   ne_geom = elem_list.Size();
+   dof = (ne_geom > 0) ? fes.GetFE(elem_list[0])->GetDof() : 0;
+   height = vdim*ne_geom*dof;
+   width = fes.GetVSize();
+   bool dof_reorder = (e_ordering == ElementDofOrdering::LEXICOGRAPHIC);
+   const int *dof_map = NULL;
+   if (dof_reorder && ne_geom > 0)
+   {
+      const FiniteElement *fe = fes.GetFE(elem_list[0]);
+      const TensorBasisElement* el =
+         dynamic_cast<const TensorBasisElement*>(fe);
+      if (el == NULL)
+      {
+         mfem_error("Finite element not suitable for lexicographic ordering");
+      }
+      const Array<int> &fe_dof_map = el->GetDofMap();
+      // An empty dof_map means the native ordering is already lexicographic,
+      // e.g. for the L2 tensor elements.
+      if (fe_dof_map.Size() > 0) { dof_map = fe_dof_map.GetData(); }
+      else { dof_reorder = false; }
+   }
+   const Table& e2dTable = fes.GetElementToDofTable();
+   const int* elementI = e2dTable.HostReadI();
+   const int* elementMap = e2dTable.HostReadJ();
+   offsets.SetSize(ndofs+1);
+   indices.SetSize(ne_geom*dof);
+   gatherMap.SetSize(ne_geom*dof);
+   // We will be keeping a count of how many local nodes point to its global
+   // dof. Unlike in ElementRestriction, the element-to-dof table is indexed
+   // through its row offsets since mixed meshes have variable row sizes.
+   for (int i = 0; i <= ndofs; ++i)
+   {
+      offsets[i] = 0;
+   }
+   for (int i = 0; i < ne_geom; ++i)
+   {
+      const int row = elementI[elem_list[i]];
+      for (int d = 0; d < dof; ++d)
+      {
+         const int sgid = elementMap[row + d];  // signed
+         const int gid = (sgid >= 0) ? sgid : -1 - sgid;
+         ++offsets[gid + 1];
+      }
+   }
+   // Aggregate to find offsets for each global dof
+   for (int i = 1; i <= ndofs; ++i)
+   {
+      offsets[i] += offsets[i - 1];
+   }
+   // For each global dof, fill in all local nodes that point to it
+   for (int i = 0; i < ne_geom; ++i)
+   {
+      const int row = elementI[elem_list[i]];
+      for (int d = 0; d < dof; ++d)
+      {
+         const int sdid = dof_reorder ? dof_map[d] : 0;  // signed
+         const int did = (!dof_reorder)?d:(sdid >= 0 ? sdid : -1-sdid);
+         const int sgid = elementMap[row + did];  // signed
+         const int gid = (sgid >= 0) ? sgid : -1-sgid;
+         const int lid = dof*i + d;
+         const bool plus = (sgid >= 0 && sdid >= 0) || (sgid < 0 && sdid < 0);
+         gatherMap[lid] = plus ? gid : -1-gid;
+         indices[offsets[gid]++] = plus ? lid : -1-lid;
+      }
+   }
+   // We shifted the offsets vector by 1 by using it as a counter.
+   // Now we shift it back.
+   for (int i = ndofs; i > 0; --i)
+   {
+      offsets[i] = offsets[i - 1];
+   }
+   offsets[0] = 0;
+}
+
+void GeometryElementRestriction::Mult(const Vector& x, Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.Write(), nd, vd, ne_geom);
+   auto d_gatherMap = gatherMap.Read();
+   MFEM_FORALL(i, dof*ne_geom,
+   {
+      const int gid = d_gatherMap[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const double dofValue = d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, i / nd) = plus ? dofValue : -dofValue;
+      }
+   });
+}
+
+void GeometryElementRestriction::MultTranspose(const Vector& x, Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne_geom);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   MFEM_FORALL(i, ndofs,
+   {
+      const int offset = d_offsets[i];
+      const int nextOffset = d_offsets[i + 1];
+      // Skip the L-dofs that do not belong to elements of this geometry, so
+      // that only the dofs touched by this batch are read and written.
+      if (offset != nextOffset)
+      {
+         for (int c = 0; c < vd; ++c)
+         {
+            double dofValue = 0;
+            for (int j = offset; j < nextOffset; ++j)
+            {
+               const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 -
+                                 d_indices[j];
+               dofValue += (d_indices[j] >= 0) ? d_x(idx_j % nd, c,
+               idx_j / nd) : -d_x(idx_j % nd, c, idx_j / nd);
+            }
+            d_y(t?c:i,t?i:c) += dofValue;
+         }
+      }
+   });
+}
+
+void GeometryElementRestriction::MultTransposeUnsigned(const Vector& x,
+                                                       Vector& y) const
+{
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne_geom);
+   auto d_y = Reshape(y.ReadWrite(), t?vd:ndofs, t?ndofs:vd);
+   MFEM_FORALL(i, ndofs,
+   {
+      const int offset = d_offsets[i];
+      const int nextOffset = d_offsets[i + 1];
+      if (offset != nextOffset)
+      {
+         for (int c = 0; c < vd; ++c)
+         {
+            double dofValue = 0;
+            for (int j = offset; j < nextOffset; ++j)
+            {
+               const int idx_j = (d_indices[j] >= 0) ? d_indices[j] : -1 -
+                                 d_indices[j];
+               dofValue += d_x(idx_j % nd, c, idx_j / nd);
+            }
+            d_y(t?c:i,t?i:c) += dofValue;
+         }
+      }
+   });
+}
+
 L2ElementRestriction::L2ElementRestriction(const FiniteElementSpace &fes)
    : ne(fes.GetNE()),
      vdim(fes.GetVDim()),
@@ -691,7 +983,7 @@ H1FaceRestriction::H1FaceRestriction(const FiniteElementSpace &fes,
       dynamic_cast<const TensorBasisElement*>(fe);
    const int *dof_map = el->GetDofMap().GetData();
    const Table& e2dTable = fes.GetElementToDofTable();
-   const int* elementMap = e2dTable.GetJ();
+   const int* elementMap = e2dTable.HostReadJ();
    Array<int> faceMap(dof);
    int e1, e2;
    int inf1, inf2;
@@ -1031,7 +1323,7 @@ L2FaceRestriction::L2FaceRestriction(const FiniteElementSpace &fes,
       }
    }
    const Table& e2dTable = fes.GetElementToDofTable();
-   const int* elementMap = e2dTable.GetJ();
+   const int* elementMap = e2dTable.HostReadJ();
    Array<int> faceMap1(dof), faceMap2(dof);
    int e1, e2;
    int inf1, inf2;
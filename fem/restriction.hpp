@@ -46,12 +46,22 @@ protected:
    Array<int> offsets;
    Array<int> indices;
    Array<int> gatherMap;
+   /// Global dofs targeted by a single element node, handled by a
+   /// conflict-free copy kernel in MultTranspose().
+   Array<int> singleDofs;
+   /// Global dofs shared by several element nodes, whose contributions
+   /// MultTranspose() accumulates.
+   Array<int> sharedDofs;
 
 public:
    ElementRestriction(const FiniteElementSpace&, ElementDofOrdering);
    void Mult(const Vector &x, Vector &y) const;
    void MultTranspose(const Vector &x, Vector &y) const;
 
+   /// Compute MultTranspose and add the result to @a y instead of
+   /// overwriting it.
+   void AddMultTranspose(const Vector &x, Vector &y) const;
+
    /// Compute Mult without applying signs based on DOF orientations.
    void MultUnsigned(const Vector &x, Vector &y) const;
    /// Compute MultTranspose without applying signs based on DOF orientations.
@@ -76,6 +86,49 @@ public:
    void FillJAndData(const Vector &ea_data, SparseMatrix &mat) const;
 };
 
+/** @brief Operator that converts L-vectors to the E-vector of the subset of
+    mesh elements with a given geometry type. */
+/** Objects of this type are typically created and owned by FiniteElementSpace
+    objects, see FiniteElementSpace::GetElementRestriction(ElementDofOrdering,
+    Geometry::Type). On mixed meshes, the restrictions of the geometry types
+    present in the mesh partition the elements into batches with a uniform
+    number of dofs per element, so that, e.g., the sum-factorized kernels can
+    process the hexahedral batch and the dense basis kernels the wedge batch.
+    MultTranspose() accumulates into the L-vector, so the contributions of all
+    geometry batches combine in the same E-vector pass. */
+class GeometryElementRestriction : public Operator
+{
+protected:
+   const FiniteElementSpace &fes;
+   const Geometry::Type geom;
+   const int vdim;
+   const bool byvdim;
+   const int ndofs;
+   int ne_geom;
+   int dof;
+   Array<int> elem_list;
+   Array<int> offsets;
+   Array<int> indices;
+   Array<int> gatherMap;
+
+public:
+   GeometryElementRestriction(const FiniteElementSpace&, ElementDofOrdering,
+                              Geometry::Type geom);
+   /// Return the number of elements with geometry type @a geom.
+   int GetNE() const { return ne_geom; }
+   /// Return the mesh element indices forming the batch.
+   const Array<int> &GetElementList() const { return elem_list; }
+   /// Extract the E-vector @a y of the batch from the L-vector @a x.
+   void Mult(const Vector &x, Vector &y) const;
+   /// Add the E-vector @a x of the batch to the L-vector @a y.
+   /** Note that, unlike ElementRestriction::MultTranspose(), the result is
+       accumulated into @a y (which therefore has to be initialized by the
+       caller) and the L-dofs not touched by the batch are left unchanged. */
+   void MultTranspose(const Vector &x, Vector &y) const;
+   /// Compute MultTranspose without applying signs based on DOF orientations.
+   void MultTransposeUnsigned(const Vector &x, Vector &y) const;
+};
+
 /// Operator that converts L2 FiniteElementSpace L-vectors to E-vectors.
 /** Objects of this type are typically created and owned by FiniteElementSpace
     objects, see FiniteElementSpace::GetElementRestriction(). L-vectors
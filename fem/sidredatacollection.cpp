@@ -15,6 +15,7 @@
 #ifdef MFEM_USE_SIDRE
 
 #include "fem.hpp"
+#include "../general/backends.hpp"
 
 #include <axom/sidre.hpp>
 
@@ -763,8 +764,33 @@ void SidreDataCollection::UpdateStateToDS()
    }
 }
 
+void SidreDataCollection::StageFieldsToHost() const
+{
+   // Sidre holds external pointers to the host data of the mesh nodes and of
+   // the registered fields. Issue all stale device-to-host copies
+   // asynchronously up front -- they are ordered after any still-running
+   // kernels on the same stream -- and synchronize the stream once at the
+   // end, instead of blocking on each field in turn. Fields whose host copy
+   // is already valid are skipped by Memory<T>::Prefetch.
+   if (mesh != NULL && mesh->GetNodes() != NULL)
+   {
+      const GridFunction *nodes = mesh->GetNodes();
+      nodes->GetMemory().Prefetch(MemoryClass::HOST, nodes->Size());
+   }
+   for (const auto& field : field_map)
+   {
+      const GridFunction *gf = field.second;
+      if (gf != NULL && gf->GetData() != NULL)
+      {
+         gf->GetMemory().Prefetch(MemoryClass::HOST, gf->Size());
+      }
+   }
+   MFEM_STREAM_SYNC;
+}
+
 void SidreDataCollection::PrepareToSave()
 {
+   StageFieldsToHost();
    verifyMeshBlueprint();
    UpdateStateToDS();
 }
@@ -437,6 +437,15 @@ protected:
    // return the filename based on prefix_path, collection name and cycle.
    std::string get_file_path(const std::string &filename) const;
 
+   /** @brief Stage the data of all registered fields (and the mesh nodes) to
+       host memory before handing the external pointers to Sidre. */
+   /** The device-to-host copies are issued asynchronously for all fields
+       first, so they queue behind any still-running kernels and behind each
+       other, and the stream is synchronized once before the writer touches
+       the host pointers. Fields whose host copy is already valid, as tracked
+       by the Memory validity flags, are skipped. */
+   void StageFieldsToHost() const;
+
 private:
    // If the data collection does not own the datastore, it will need pointers
    // to the blueprint and blueprint index group to use.
@@ -10,6 +10,9 @@
 // CONTRIBUTING.md for details.
 
 #include "staticcond.hpp"
+#include "../general/forall.hpp"
+#include <cstring>
+#include <map>
 
 namespace mfem
 {
@@ -41,7 +44,8 @@ StaticCondensation::StaticCondensation(FiniteElementSpace *fespace)
    S = S_e = NULL;
    symm = false;
    A_data.Reset();
-   A_ipiv.Reset();
+   Aee_data.Reset();
+   factored = false;
 
    Array<int> vdofs;
    const int NE = fes->GetNE();
@@ -110,7 +114,7 @@ StaticCondensation::~StaticCondensation()
    delete S_e;
    delete S;
    A_data.Delete();
-   A_ipiv.Delete();
+   Aee_data.Delete();
    delete tr_fes;
    delete tr_fec;
 }
@@ -136,8 +140,8 @@ void StaticCondensation::Init(bool symmetric, bool block_diagonal)
    const int NE = fes->GetNE();
    // symm = symmetric; // TODO: handle the symmetric case
    A_offsets.SetSize(NE+1);
-   A_ipiv_offsets.SetSize(NE+1);
-   A_offsets[0] = A_ipiv_offsets[0] = 0;
+   Aee_offsets.SetSize(NE+1);
+   A_offsets[0] = Aee_offsets[0] = 0;
    Array<int> rvdofs;
    for (int i = 0; i < NE; i++)
    {
@@ -145,10 +149,12 @@ void StaticCondensation::Init(bool symmetric, bool block_diagonal)
       const int ned = rvdofs.Size();
       const int npd = elem_pdof.RowSize(i);
       A_offsets[i+1] = A_offsets[i] + npd*(npd + (symm ? 1 : 2)*ned);
-      A_ipiv_offsets[i+1] = A_ipiv_offsets[i] + npd;
+      Aee_offsets[i+1] = Aee_offsets[i] + ned*ned;
    }
    A_data = Memory<double>(A_offsets[NE]);
-   A_ipiv = Memory<int>(A_ipiv_offsets[NE]);
+   Aee_data = Memory<double>(Aee_offsets[NE]);
+   batches.clear();
+   factored = false;
    const int nedofs = tr_fes->GetVSize();
    if (fes->GetVDim() == 1)
    {
@@ -196,9 +202,8 @@ void StaticCondensation::AssembleMatrix(int el, const DenseMatrix &elmat)
    DenseMatrix A_pp(A_data + A_offsets[el], nvpd, nvpd);
    DenseMatrix A_pe(A_pp.Data() + nvpd*nvpd, nvpd, nved);
    DenseMatrix A_ep;
-   if (symm) { A_ep.SetSize(nved, nvpd); }
-   else      { A_ep.UseExternalData(A_pe.Data() + nvpd*nved, nved, nvpd); }
-   DenseMatrix A_ee(nved, nved);
+   if (!symm) { A_ep.UseExternalData(A_pe.Data() + nvpd*nved, nved, nvpd); }
+   DenseMatrix A_ee(Aee_data + Aee_offsets[el], nved, nved);
 
    const int npd = nvpd/vdim;
    const int ned = nved/vdim;
@@ -210,18 +215,15 @@ void StaticCondensation::AssembleMatrix(int el, const DenseMatrix &elmat)
       {
          A_pp.CopyMN(elmat, npd, npd, i*nd+ned, j*nd+ned, i*npd, j*npd);
          A_pe.CopyMN(elmat, npd, ned, i*nd+ned, j*nd,     i*npd, j*ned);
-         A_ep.CopyMN(elmat, ned, npd, i*nd,     j*nd+ned, i*ned, j*npd);
+         if (!symm)
+         {
+            A_ep.CopyMN(elmat, ned, npd, i*nd, j*nd+ned, i*ned, j*npd);
+         }
          A_ee.CopyMN(elmat, ned, ned, i*nd,     j*nd,     i*ned, j*ned);
       }
    }
-   // Compute the Schur complement
-   LUFactors lu(A_pp.Data(), A_ipiv + A_ipiv_offsets[el]);
-   lu.Factor(nvpd);
-   lu.BlockFactor(nvpd, nved, A_pe.Data(), A_ep.Data(), A_ee.Data());
-
-   // Assemble the Schur complement
-   const int skip_zeros = 0;
-   S->AddSubMatrix(rvdofs, rvdofs, A_ee, skip_zeros);
+   // The elimination of the private dofs and the assembly of the local Schur
+   // complements into S are deferred to FactorElementMatrices().
 }
 
 void StaticCondensation::AssembleBdrMatrix(int el, const DenseMatrix &elmat)
@@ -232,9 +234,114 @@ void StaticCondensation::AssembleBdrMatrix(int el, const DenseMatrix &elmat)
    S->AddSubMatrix(rvdofs, rvdofs, elmat, skip_zeros);
 }
 
+void StaticCondensation::FactorElementMatrices()
+{
+   const int NE = fes->GetNE();
+   const int skip_zeros = 0;
+   Array<int> rvdofs;
+
+   // Group the elements by their (private, exposed) dof counts; on a uniform
+   // mesh this produces a single batch.
+   std::map<std::pair<int,int>, int> batch_id;
+   batches.clear();
+   for (int el = 0; el < NE; el++)
+   {
+      tr_fes->GetElementVDofs(el, rvdofs);
+      const std::pair<int,int> key(elem_pdof.RowSize(el), rvdofs.Size());
+      std::map<std::pair<int,int>, int>::iterator it = batch_id.find(key);
+      int id;
+      if (it != batch_id.end()) { id = it->second; }
+      else
+      {
+         id = batches.size();
+         batch_id[key] = id;
+         batches.push_back(ElemBatch());
+         batches[id].npd = key.first;
+         batches[id].ned = key.second;
+      }
+      ElemBatch &eb = batches[id];
+      eb.els.Append(el);
+      eb.pdofs.Append(elem_pdof.GetRow(el), key.first);
+      eb.rdofs.Append(rvdofs);
+   }
+
+   for (unsigned b = 0; b < batches.size(); b++)
+   {
+      ElemBatch &eb = batches[b];
+      const int npd = eb.npd, ned = eb.ned, ne = eb.els.Size();
+
+      eb.A_pp.SetSize(npd, npd, ne);
+      eb.A_pe.SetSize(npd, ned, ne);
+      eb.A_ep.SetSize(ned, npd, ne);
+      DenseTensor A_ee(ned, ned, ne);
+      {
+         double *pp = eb.A_pp.HostWrite(), *pe = eb.A_pe.HostWrite();
+         double *ep = eb.A_ep.HostWrite(), *ee = A_ee.HostWrite();
+         for (int k = 0; k < ne; k++)
+         {
+            const double *d = A_data + A_offsets[eb.els[k]];
+            std::memcpy(pp + k*npd*npd, d, npd*npd*sizeof(double));
+            std::memcpy(pe + k*npd*ned, d + npd*npd, npd*ned*sizeof(double));
+            if (!symm)
+            {
+               std::memcpy(ep + k*ned*npd, d + npd*(npd+ned),
+                           ned*npd*sizeof(double));
+            }
+            else
+            {
+               // only U_pe is stored in the symmetric case; recover A_ep as
+               // the transpose of A_pe
+               for (int j = 0; j < npd; j++)
+               {
+                  for (int i = 0; i < ned; i++)
+                  {
+                     ep[k*ned*npd + i + j*ned] = pe[k*npd*ned + j + i*npd];
+                  }
+               }
+            }
+            std::memcpy(ee + k*ned*ned, Aee_data + Aee_offsets[eb.els[k]],
+                        ned*ned*sizeof(double));
+         }
+      }
+
+      if (npd > 0)
+      {
+         BatchLUFactor(eb.A_pp, eb.ipiv);
+         if (ned > 0)
+         {
+            BatchBlockFactor(eb.A_pp, eb.ipiv, eb.A_pe, eb.A_ep, A_ee);
+         }
+      }
+      if (symm)
+      {
+         // the recovery kernels use U_pe in the symmetric case
+         eb.A_ep.SetSize(0, 0, 0);
+      }
+
+      // Assemble the local Schur complements
+      double *ee = A_ee.HostReadWrite();
+      Array<int> rv;
+      for (int k = 0; k < ne; k++)
+      {
+         rv.MakeRef(eb.rdofs.GetData() + k*ned, ned);
+         DenseMatrix S_ee(ee + k*ned*ned, ned, ned);
+         S->AddSubMatrix(rv, rv, S_ee, skip_zeros);
+         S_ee.ClearExternalData();
+      }
+   }
+
+   // Release the element-wise storage used during assembly.
+   A_data.Delete();
+   A_data.Reset();
+   Aee_data.Delete();
+   Aee_data.Reset();
+   factored = true;
+}
+
 void StaticCondensation::Finalize()
 {
    const int skip_zeros = 0;
+   if (!factored) { FactorElementMatrices(); }
    if (!Parallel())
    {
       S->Finalize(skip_zeros);
@@ -314,7 +421,6 @@ void StaticCondensation::ReduceRHS(const Vector &b, Vector &sc_b) const
 
    MFEM_ASSERT(b.Size() == fes->GetVSize(), "'b' has incorrect size");
 
-   const int NE = fes->GetNE();
    const int nedofs = tr_fes->GetVSize();
    const SparseMatrix *tr_cP = NULL;
    Vector b_r;
@@ -332,42 +438,78 @@ void StaticCondensation::ReduceRHS(const Vector &b, Vector &sc_b) const
       b_r(i) = b(rdof_edof[i]);
    }
 
-   DenseMatrix U_pe, L_ep;
-   Vector b_p, b_ep;
-   Array<int> rvdofs;
-   for (int i = 0; i < NE; i++)
-   {
-      tr_fes->GetElementVDofs(i, rvdofs);
-      const int ned = rvdofs.Size();
-      const int *rd = rvdofs.GetData();
-      const int npd = elem_pdof.RowSize(i);
-      const int *pd = elem_pdof.GetRow(i);
-      b_p.SetSize(npd);
-      b_ep.SetSize(ned);
-      for (int j = 0; j < npd; j++)
+   MFEM_VERIFY(factored, "the element matrices are not factored");
+   // Batched elimination, b_ep = A_ep A_pp_inv b_p, one batch of elements
+   // per kernel launch.
+   for (unsigned bi = 0; bi < batches.size(); bi++)
+   {
+      const ElemBatch &eb = batches[bi];
+      const int npd = eb.npd, ned = eb.ned, ne = eb.els.Size();
+      if (npd == 0 || ned == 0 || ne == 0) { continue; }
+
+      Vector b_p(npd*ne), b_ep(ned*ne);
       {
-         b_p(j) = b(pd[j]);
+         const double *d_b = b.Read();
+         const int *d_pd = eb.pdofs.Read();
+         double *d_bp = b_p.Write();
+         MFEM_FORALL(k, npd*ne, d_bp[k] = d_b[d_pd[k]];);
       }
-
-      LUFactors lu(const_cast<double*>((const double*)A_data) + A_offsets[i],
-                   const_cast<int*>((const int*)A_ipiv) + A_ipiv_offsets[i]);
-      lu.LSolve(npd, 1, b_p);
-
+      auto lu = Reshape(eb.A_pp.Read(), npd, npd, ne);
+      auto piv = Reshape(eb.ipiv.Read(), npd, ne);
+      auto bp = Reshape(b_p.ReadWrite(), npd, ne);
+      auto bep = Reshape(b_ep.Write(), ned, ne);
+      MFEM_FORALL(e, ne,
+      {
+         // b_p <- L^{-1} P b_p
+         for (int i = 0; i < npd; i++)
+         {
+            const int p = piv(i,e);
+            if (p != i)
+            {
+               const double t = bp(i,e);
+               bp(i,e) = bp(p,e);
+               bp(p,e) = t;
+            }
+            double sum = bp(i,e);
+            for (int j = 0; j < i; j++) { sum -= lu(i,j,e)*bp(j,e); }
+            bp(i,e) = sum;
+         }
+      });
       if (symm)
       {
          // TODO: handle the symmetric case correctly.
-         U_pe.UseExternalData(lu.data + npd*npd, npd, ned);
-         U_pe.MultTranspose(b_p, b_ep);
+         auto pe = Reshape(eb.A_pe.Read(), npd, ned, ne);
+         MFEM_FORALL(e, ne,
+         {
+            for (int i = 0; i < ned; i++)
+            {
+               double sum = 0.0;
+               for (int j = 0; j < npd; j++) { sum += pe(j,i,e)*bp(j,e); }
+               bep(i,e) = sum;
+            }
+         });
       }
       else
       {
-         L_ep.UseExternalData(lu.data + npd*(npd+ned), ned, npd);
-         L_ep.Mult(b_p, b_ep);
+         auto ep = Reshape(eb.A_ep.Read(), ned, npd, ne);
+         MFEM_FORALL(e, ne,
+         {
+            for (int i = 0; i < ned; i++)
+            {
+               double sum = 0.0;
+               for (int j = 0; j < npd; j++) { sum += ep(i,j,e)*bp(j,e); }
+               bep(i,e) = sum;
+            }
+         });
       }
-      for (int j = 0; j < ned; j++)
+      // Scatter-subtract into b_r; the exposed dofs are shared between
+      // elements, so this part stays sequential.
+      const double *h_bep = b_ep.HostRead();
+      const int *rd = eb.rdofs.HostRead();
+      for (int k = 0; k < ned*ne; k++)
       {
-         if (rd[j] >= 0) { b_r(rd[j]) -= b_ep(j); }
-         else            { b_r(-1-rd[j]) += b_ep(j); }
+         if (rd[k] >= 0) { b_r(rd[k]) -= h_bep[k]; }
+         else            { b_r(-1-rd[k]) += h_bep[k]; }
       }
    }
    if (!Parallel())
@@ -510,31 +652,68 @@ void StaticCondensation::ComputeSolution(
    {
       sol(rdof_edof[i]) = sol_r(i);
    }
-   const int NE = fes->GetNE();
-   Vector b_p, s_e;
-   Array<int> rvdofs;
-   for (int i = 0; i < NE; i++)
+   MFEM_VERIFY(factored, "the element matrices are not factored");
+   // Batched back substitution, sol_p = A_pp_inv (b_p - A_pe sol_e), one
+   // batch of elements per kernel launch; the private dofs are owned by
+   // their elements, so the recovered values are scattered directly.
+   for (unsigned bi = 0; bi < batches.size(); bi++)
    {
-      tr_fes->GetElementVDofs(i, rvdofs);
-      const int ned = rvdofs.Size();
-      const int npd = elem_pdof.RowSize(i);
-      const int *pd = elem_pdof.GetRow(i);
-      b_p.SetSize(npd);
+      const ElemBatch &eb = batches[bi];
+      const int npd = eb.npd, ned = eb.ned, ne = eb.els.Size();
+      if (npd == 0 || ne == 0) { continue; }
 
-      for (int j = 0; j < npd; j++)
+      Vector b_p(npd*ne), s_e(ned*ne);
       {
-         b_p(j) = b(pd[j]);
+         const double *d_b = b.Read();
+         const int *d_pd = eb.pdofs.Read();
+         double *d_bp = b_p.Write();
+         MFEM_FORALL(k, npd*ne, d_bp[k] = d_b[d_pd[k]];);
       }
-      sol_r.GetSubVector(rvdofs, s_e);
-
-      LUFactors lu(const_cast<double*>((const double*)A_data) + A_offsets[i],
-                   const_cast<int*>((const int*)A_ipiv) + A_ipiv_offsets[i]);
-      lu.LSolve(npd, 1, b_p);
-      lu.BlockBackSolve(npd, ned, 1, lu.data + npd*npd, s_e, b_p);
-
-      for (int j = 0; j < npd; j++)
       {
-         sol(pd[j]) = b_p(j);
+         const double *d_sr = sol_r.Read();
+         const int *d_rd = eb.rdofs.Read();
+         double *d_se = s_e.Write();
+         MFEM_FORALL(k, ned*ne,
+         {
+            const int r = d_rd[k];
+            d_se[k] = (r >= 0) ? d_sr[r] : -d_sr[-1-r];
+         });
+      }
+      auto lu = Reshape(eb.A_pp.Read(), npd, npd, ne);
+      auto piv = Reshape(eb.ipiv.Read(), npd, ne);
+      auto pe = Reshape(eb.A_pe.Read(), npd, ned, ne);
+      auto bp = Reshape(b_p.ReadWrite(), npd, ne);
+      auto se = Reshape(s_e.Read(), ned, ne);
+      MFEM_FORALL(e, ne,
+      {
+         // b_p <- L^{-1} P b_p
+         for (int i = 0; i < npd; i++)
+         {
+            const int p = piv(i,e);
+            if (p != i)
+            {
+               const double t = bp(i,e);
+               bp(i,e) = bp(p,e);
+               bp(p,e) = t;
+            }
+            double sum = bp(i,e);
+            for (int j = 0; j < i; j++) { sum -= lu(i,j,e)*bp(j,e); }
+            bp(i,e) = sum;
+         }
+         // b_p <- U^{-1} (b_p - U_pe s_e)
+         for (int i = npd-1; i >= 0; i--)
+         {
+            double sum = bp(i,e);
+            for (int j = 0; j < ned; j++) { sum -= pe(i,j,e)*se(j,e); }
+            for (int j = i+1; j < npd; j++) { sum -= lu(i,j,e)*bp(j,e); }
+            bp(i,e) = sum/lu(i,i,e);
+         }
+      });
+      {
+         const double *d_bp = b_p.Read();
+         const int *d_pd = eb.pdofs.Read();
+         double *d_sol = sol.ReadWrite();
+         MFEM_FORALL(k, npd*ne, d_sol[d_pd[k]] = d_bp[k];);
       }
    }
 }
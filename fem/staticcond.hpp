@@ -14,6 +14,7 @@
 
 #include "../config/config.hpp"
 #include "fespace.hpp"
+#include <vector>
 
 #ifdef MFEM_USE_MPI
 #include "pfespace.hpp"
@@ -81,9 +82,39 @@ class StaticCondensation
 #endif
 
    bool symm; // TODO: handle the symmetric case correctly.
-   Array<int> A_offsets, A_ipiv_offsets;
+   Array<int> A_offsets;
    Memory<double> A_data;
-   Memory<int> A_ipiv;
+   // Local Schur complements, kept between assembly and factorization.
+   Array<int> Aee_offsets;
+   Memory<double> Aee_data;
+
+   /** Element batch used by the batched factorization and recovery kernels.
+       All elements in a batch have the same number of private and exposed
+       vdofs, so their factors can be stored as DenseTensors and processed in
+       single kernel launches. */
+   struct ElemBatch
+   {
+      int npd, ned;     ///< number of private/exposed vdofs per element
+      Array<int> els;   ///< elements in the batch
+      Array<int> pdofs; ///< private vdofs, npd per element
+      Array<int> rdofs; ///< signed exposed vdofs, ned per element
+      DenseTensor A_pp; ///< batched LU factors of the private blocks
+      DenseTensor A_pe; ///< batched U_pe factors
+      DenseTensor A_ep; ///< batched L_ep factors (empty in the symm case)
+      Array<int> ipiv;  ///< batched (zero-based) pivot rows
+   };
+   std::vector<ElemBatch> batches;
+   bool factored;
+
+   /** @brief Eliminate the private dofs from all element matrices.
+
+       Groups the elements into #batches by their (private, exposed) dof
+       counts, performs the local LU and Schur-complement factorizations of
+       each batch in batched kernel launches, and assembles the local Schur
+       complements into S. The factors are kept in the per-batch tensors used
+       by the recovery kernels in ReduceRHS() and ComputeSolution(), and the
+       element-wise storage used during assembly is released. */
+   void FactorElementMatrices();
 
    Array<int> ess_rtdof_list;
 
@@ -670,6 +670,9 @@ public:
    /// Checks if the target matrices contain non-trivial size specification.
    virtual bool ContainsVolumeInfo() const;
 
+   /// Return the target-matrix construction algorithm of the constructor.
+   TargetType GetTargetType() const { return target_type; }
+
    /** @brief Given an element and quadrature rule, computes ref->target
        transformation Jacobians for each quadrature point in the element.
        The physical positions of the element's nodes are given by @a elfun. */
@@ -945,6 +948,18 @@ protected:
    //        output - the result of AssembleElementVector() (dof x dim).
    DenseMatrix DSh, DS, Jrt, Jpr, Jpt, P, PMatI, PMatO;
 
+   // Data for the partial assembly (PA) action path, set by AssemblePA():
+   //   pa_mid: id of the metric, e.g. 2 for TMOP_Metric_002.
+   //    pa_g: reference gradients of the shape functions at the quadrature
+   //          points, reordered to match the lexicographic E-vector layout,
+   //          (nq x dim x nd).
+   //  pa_jrt: Jtr^{-1} at each quadrature point, (dim x dim x nq x ne).
+   //    pa_w: metric_normal * ip.weight * det(Jtr) at each quadrature point.
+   //    pa_z: inter-kernel scratch space for w P(Jpt) Jrt^t, (q-vector).
+   int pa_dim, pa_ne, pa_nq, pa_nd, pa_mid;
+   Vector pa_g, pa_jrt, pa_w;
+   mutable Vector pa_z;
+
    void ComputeNormalizationEnergies(const GridFunction &x,
                                      double &metric_energy, double &lim_energy);
 
@@ -1022,7 +1037,8 @@ public:
         lim_dist(NULL), lim_func(NULL), lim_normal(1.0),
         zeta_0(NULL), zeta(NULL), coeff_zeta(NULL), adapt_eval(NULL),
         discr_tc(dynamic_cast<DiscreteAdaptTC *>(tc)),
-        fdflag(false), dxscale(1.0e3), fd_call_flag(false), exact_action(false)
+        fdflag(false), dxscale(1.0e3), fd_call_flag(false), exact_action(false),
+        pa_dim(0), pa_ne(0), pa_nq(0), pa_nd(0), pa_mid(0)
    { }
 
    ~TMOP_Integrator();
@@ -1121,6 +1137,18 @@ public:
 
    /** @brief Flag to control if exact action of Integration is effected. */
    void SetExactActionFlag(bool flag_) { exact_action = flag_; }
+
+   /** @brief Precompute the quadrature point data used by AddMultPA().
+
+       Supported only for metrics 001, 002, 302 and 303, target types
+       IDEAL_SHAPE_UNIT_SIZE and IDEAL_SHAPE_EQUAL_SIZE, and integrators
+       without limiting, coefficients, or FD-based derivatives. */
+   using NonlinearFormIntegrator::AssemblePA;
+   virtual void AssemblePA(const FiniteElementSpace &fes);
+
+   /** @brief Batched action of AssembleElementVector() on E-vectors.
+       This method can be called only after AssemblePA(). */
+   virtual void AddMultPA(const Vector &x, Vector &y) const;
 };
 
 class TMOPComboIntegrator : public NonlinearFormIntegrator
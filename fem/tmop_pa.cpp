@@ -0,0 +1,319 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "tmop.hpp"
+#include "../general/forall.hpp"
+#include "../linalg/dtensor.hpp"
+
+namespace mfem
+{
+
+// Batched action of the TMOP metric term, 2D case.
+//
+// Phase one evaluates, at every quadrature point of every element,
+// Jpt = Jpr Jrt and Z = w P(Jpt) Jrt^t, where P = dW/dJpt of the metric;
+// phase two contracts Z with the reference gradients of the shape functions,
+// reproducing the AddMultABt(DS, P, PMatO) step of
+// TMOP_Integrator::AssembleElementVectorExact() for all elements at once.
+static void TMOPAddMultPA2D(const int mid, const int NE,
+                            const int nd, const int nq,
+                            const Vector &g_, const Vector &jrt_,
+                            const Vector &w_, Vector &z_,
+                            const Vector &x_, Vector &y_)
+{
+   const int ND = nd, NQ = nq;
+   auto G = Reshape(g_.Read(), NQ, 2, ND);
+   auto Jrt = Reshape(jrt_.Read(), 2, 2, NQ, NE);
+   auto W = Reshape(w_.Read(), NQ, NE);
+   auto Z = Reshape(z_.Write(), 2, 2, NQ, NE);
+   auto X = Reshape(x_.Read(), ND, 2, NE);
+   auto Y = Reshape(y_.ReadWrite(), ND, 2, NE);
+   const int L = std::max(ND, NQ);
+   MFEM_FORALL_3D(e, NE, L, 1, 1,
+   {
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         // Jpr = PMatI^t DSh
+         double A00 = 0.0, A01 = 0.0, A10 = 0.0, A11 = 0.0;
+         for (int i = 0; i < ND; i++)
+         {
+            const double x0 = X(i,0,e), x1 = X(i,1,e);
+            A00 += x0 * G(q,0,i); A01 += x0 * G(q,1,i);
+            A10 += x1 * G(q,0,i); A11 += x1 * G(q,1,i);
+         }
+         const double R00 = Jrt(0,0,q,e), R01 = Jrt(0,1,q,e);
+         const double R10 = Jrt(1,0,q,e), R11 = Jrt(1,1,q,e);
+         // Jpt = Jpr Jrt
+         const double T00 = A00*R00 + A01*R10, T01 = A00*R01 + A01*R11;
+         const double T10 = A10*R00 + A11*R10, T11 = A10*R01 + A11*R11;
+         // P = dW/dJpt
+         double P00, P01, P10, P11;
+         if (mid == 1)
+         {
+            // W = I1 => P = dI1 = 2 Jpt.
+            P00 = 2.0*T00; P01 = 2.0*T01;
+            P10 = 2.0*T10; P11 = 2.0*T11;
+         }
+         else // mid == 2
+         {
+            // W = 0.5 I1b - 1 => P = 0.5 dI1b
+            //   = Jpt/det - (I1/(2 det^2)) ddet, ddet = adj(Jpt)^t.
+            const double det = T00*T11 - T01*T10;
+            const double I1 = T00*T00 + T01*T01 + T10*T10 + T11*T11;
+            const double a = 1.0/det, b = 0.5*I1/(det*det);
+            P00 = a*T00 - b*T11; P01 = a*T01 + b*T10;
+            P10 = a*T10 + b*T01; P11 = a*T11 - b*T00;
+         }
+         // Z = w P Jrt^t
+         const double w = W(q,e);
+         Z(0,0,q,e) = w * (P00*R00 + P01*R01);
+         Z(0,1,q,e) = w * (P00*R10 + P01*R11);
+         Z(1,0,q,e) = w * (P10*R00 + P11*R01);
+         Z(1,1,q,e) = w * (P10*R10 + P11*R11);
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i,x,ND)
+      {
+         double y0 = 0.0, y1 = 0.0;
+         for (int q = 0; q < NQ; q++)
+         {
+            const double g0 = G(q,0,i), g1 = G(q,1,i);
+            y0 += g0 * Z(0,0,q,e) + g1 * Z(0,1,q,e);
+            y1 += g0 * Z(1,0,q,e) + g1 * Z(1,1,q,e);
+         }
+         Y(i,0,e) += y0;
+         Y(i,1,e) += y1;
+      }
+   });
+}
+
+// Batched action of the TMOP metric term, 3D case; see TMOPAddMultPA2D.
+static void TMOPAddMultPA3D(const int mid, const int NE,
+                            const int nd, const int nq,
+                            const Vector &g_, const Vector &jrt_,
+                            const Vector &w_, Vector &z_,
+                            const Vector &x_, Vector &y_)
+{
+   const int ND = nd, NQ = nq;
+   auto G = Reshape(g_.Read(), NQ, 3, ND);
+   auto Jrt = Reshape(jrt_.Read(), 3, 3, NQ, NE);
+   auto W = Reshape(w_.Read(), NQ, NE);
+   auto Z = Reshape(z_.Write(), 3, 3, NQ, NE);
+   auto X = Reshape(x_.Read(), ND, 3, NE);
+   auto Y = Reshape(y_.ReadWrite(), ND, 3, NE);
+   const int L = std::max(ND, NQ);
+   MFEM_FORALL_3D(e, NE, L, 1, 1,
+   {
+      MFEM_FOREACH_THREAD(q,x,NQ)
+      {
+         // Jpr = PMatI^t DSh
+         double A[9], R[9], T[9];
+         for (int k = 0; k < 9; k++) { A[k] = 0.0; }
+         for (int i = 0; i < ND; i++)
+         {
+            for (int c = 0; c < 3; c++)
+            {
+               const double g = G(q,c,i);
+               A[0+3*c] += X(i,0,e) * g;
+               A[1+3*c] += X(i,1,e) * g;
+               A[2+3*c] += X(i,2,e) * g;
+            }
+         }
+         for (int j = 0; j < 3; j++)
+         {
+            for (int i = 0; i < 3; i++) { R[i+3*j] = Jrt(i,j,q,e); }
+         }
+         // Jpt = Jpr Jrt
+         for (int j = 0; j < 3; j++)
+         {
+            for (int i = 0; i < 3; i++)
+            {
+               T[i+3*j] = A[i+3*0]*R[0+3*j] + A[i+3*1]*R[1+3*j] +
+                          A[i+3*2]*R[2+3*j];
+            }
+         }
+         const double det =
+            T[0]*(T[4]*T[8] - T[7]*T[5]) -
+            T[3]*(T[1]*T[8] - T[7]*T[2]) +
+            T[6]*(T[1]*T[5] - T[4]*T[2]);
+         double I1 = 0.0;
+         for (int k = 0; k < 9; k++) { I1 += T[k]*T[k]; }
+         // C = ddet/dJpt, the cofactor matrix of Jpt.
+         double C[9];
+         C[0+3*0] = T[4]*T[8] - T[5]*T[7];
+         C[1+3*0] = T[5]*T[6] - T[3]*T[8];
+         C[2+3*0] = T[3]*T[7] - T[4]*T[6];
+         C[0+3*1] = T[2]*T[7] - T[1]*T[8];
+         C[1+3*1] = T[0]*T[8] - T[2]*T[6];
+         C[2+3*1] = T[1]*T[6] - T[0]*T[7];
+         C[0+3*2] = T[1]*T[5] - T[2]*T[4];
+         C[1+3*2] = T[2]*T[3] - T[0]*T[5];
+         C[2+3*2] = T[0]*T[4] - T[1]*T[3];
+         // P = dW/dJpt
+         double P[9];
+         if (mid == 302)
+         {
+            // W = I1b I2b / 9 - 1, with I2 = |adj(Jpt)|^2:
+            // P = (2 I2 Jpt + I1 dI2)/(9 det^2) - (2 I1 I2/(9 det^3)) C,
+            // dI2 = 2 (I1 Jpt - Jpt Jpt^t Jpt).
+            double I2 = 0.0;
+            for (int k = 0; k < 9; k++) { I2 += C[k]*C[k]; }
+            // BT = (Jpt Jpt^t) Jpt
+            double BT[9];
+            for (int j = 0; j < 3; j++)
+            {
+               for (int i = 0; i < 3; i++)
+               {
+                  double s = 0.0;
+                  for (int k = 0; k < 3; k++)
+                  {
+                     for (int l = 0; l < 3; l++)
+                     {
+                        s += T[i+3*l] * T[k+3*l] * T[k+3*j];
+                     }
+                  }
+                  BT[i+3*j] = s;
+               }
+            }
+            const double a = 1.0/(9.0*det*det);
+            const double b = 2.0*I1*I2/(9.0*det*det*det);
+            for (int k = 0; k < 9; k++)
+            {
+               P[k] = a*(2.0*I2*T[k] + 2.0*I1*(I1*T[k] - BT[k])) - b*C[k];
+            }
+         }
+         else // mid == 303
+         {
+            // W = I1b/3 - 1 => P = dI1b/3
+            //   = (2/(3 det^{2/3})) Jpt - (2 I1/(9 det^{5/3})) C.
+            const double det23 = cbrt(det*det);
+            const double a = 2.0/(3.0*det23);
+            const double b = 2.0*I1/(9.0*det*det23);
+            for (int k = 0; k < 9; k++) { P[k] = a*T[k] - b*C[k]; }
+         }
+         // Z = w P Jrt^t
+         const double w = W(q,e);
+         for (int j = 0; j < 3; j++)
+         {
+            for (int i = 0; i < 3; i++)
+            {
+               Z(i,j,q,e) = w * (P[i+3*0]*R[j+3*0] + P[i+3*1]*R[j+3*1] +
+                                 P[i+3*2]*R[j+3*2]);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(i,x,ND)
+      {
+         double y0 = 0.0, y1 = 0.0, y2 = 0.0;
+         for (int q = 0; q < NQ; q++)
+         {
+            const double g0 = G(q,0,i), g1 = G(q,1,i), g2 = G(q,2,i);
+            y0 += g0 * Z(0,0,q,e) + g1 * Z(0,1,q,e) + g2 * Z(0,2,q,e);
+            y1 += g0 * Z(1,0,q,e) + g1 * Z(1,1,q,e) + g2 * Z(1,2,q,e);
+            y2 += g0 * Z(2,0,q,e) + g1 * Z(2,1,q,e) + g2 * Z(2,2,q,e);
+         }
+         Y(i,0,e) += y0;
+         Y(i,1,e) += y1;
+         Y(i,2,e) += y2;
+      }
+   });
+}
+
+void TMOP_Integrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(fes.GetOrdering() == Ordering::byNODES,
+               "PA Only supports Ordering::byNODES!");
+   MFEM_VERIFY(!fdflag, "PA does not support FD-based derivatives!");
+   MFEM_VERIFY(coeff1 == NULL && nodes0 == NULL && zeta == NULL &&
+               !exact_action,
+               "PA does not support coefficients, limiting, or exact action!");
+   const TargetConstructor::TargetType ttype = targetC->GetTargetType();
+   MFEM_VERIFY(ttype == TargetConstructor::IDEAL_SHAPE_UNIT_SIZE ||
+               ttype == TargetConstructor::IDEAL_SHAPE_EQUAL_SIZE,
+               "PA supports only targets that are fixed during the solve!");
+
+   if      (dynamic_cast<TMOP_Metric_001 *>(metric)) { pa_mid = 1; }
+   else if (dynamic_cast<TMOP_Metric_002 *>(metric)) { pa_mid = 2; }
+   else if (dynamic_cast<TMOP_Metric_302 *>(metric)) { pa_mid = 302; }
+   else if (dynamic_cast<TMOP_Metric_303 *>(metric)) { pa_mid = 303; }
+   else { MFEM_ABORT("PA is not implemented for this metric!"); }
+
+   const FiniteElement &el = *fes.GetFE(0);
+   const IntegrationRule &ir = ActionIntegrationRule(el);
+   pa_dim = el.GetDim();
+   pa_ne = fes.GetNE();
+   pa_nd = el.GetDof();
+   pa_nq = ir.GetNPoints();
+   const int dim = pa_dim, nd = pa_nd, nq = pa_nq;
+   MFEM_VERIFY((pa_mid < 300) == (dim == 2), "Incompatible metric dimension!");
+
+   // Reference gradients of the shape functions, reordered to match the
+   // lexicographic E-vector layout used by PANonlinearFormExtension.
+   const DofToQuad &maps = el.GetDofToQuad(ir, DofToQuad::FULL);
+   const TensorBasisElement *tbe =
+      dynamic_cast<const TensorBasisElement *>(&el);
+   pa_g.SetSize(nq*dim*nd, Device::GetMemoryType());
+   auto g = Reshape(pa_g.HostWrite(), nq, dim, nd);
+   for (int i = 0; i < nd; i++)
+   {
+      const int n = (tbe && tbe->GetDofMap().Size() > 0) ?
+                    tbe->GetDofMap()[i] : i;
+      for (int c = 0; c < dim; c++)
+      {
+         for (int q = 0; q < nq; q++) { g(q,c,i) = maps.G[q+nq*(c+dim*n)]; }
+      }
+   }
+
+   // Quadrature point data: Jrt = Jtr^{-1} and w = metric_normal wq det(Jtr).
+   // The supported target types do not use the element positions, so the
+   // targets can be cached for the whole solve.
+   pa_jrt.SetSize(pa_ne*nq*dim*dim, Device::GetMemoryType());
+   pa_w.SetSize(pa_ne*nq, Device::GetMemoryType());
+   pa_z.SetSize(pa_ne*nq*dim*dim, Device::GetMemoryType());
+   auto jrt = Reshape(pa_jrt.HostWrite(), dim, dim, nq, pa_ne);
+   auto w = Reshape(pa_w.HostWrite(), nq, pa_ne);
+   DenseTensor Jtr(dim, dim, nq);
+   DenseMatrix Jrt_q(dim);
+   const Vector elfun; // not used by the supported target types
+   for (int e = 0; e < pa_ne; e++)
+   {
+      targetC->ComputeElementTargets(e, el, ir, elfun, Jtr);
+      for (int q = 0; q < nq; q++)
+      {
+         const DenseMatrix &Jtr_q = Jtr(q);
+         CalcInverse(Jtr_q, Jrt_q);
+         w(q,e) = metric_normal * ir.IntPoint(q).weight * Jtr_q.Det();
+         for (int j = 0; j < dim; j++)
+         {
+            for (int i = 0; i < dim; i++) { jrt(i,j,q,e) = Jrt_q(i,j); }
+         }
+      }
+   }
+}
+
+void TMOP_Integrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(pa_dim == 2 || pa_dim == 3,
+               "AssemblePA() has not been called!");
+   if (pa_dim == 2)
+   {
+      TMOPAddMultPA2D(pa_mid, pa_ne, pa_nd, pa_nq,
+                      pa_g, pa_jrt, pa_w, pa_z, x, y);
+   }
+   else
+   {
+      TMOPAddMultPA3D(pa_mid, pa_ne, pa_nd, pa_nq,
+                      pa_g, pa_jrt, pa_w, pa_z, x, y);
+   }
+}
+
+} // namespace mfem
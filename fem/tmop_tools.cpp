@@ -12,6 +12,7 @@
 #include "tmop_tools.hpp"
 #include "nonlinearform.hpp"
 #include "pnonlinearform.hpp"
+#include "quadinterpolator.hpp"
 #include "../general/osockstream.hpp"
 
 namespace mfem
@@ -308,32 +309,126 @@ void InterpolatorFP::ComputeAtNewPosition(const Vector &new_nodes,
 
 #endif
 
+// Bitwise comparison of two vectors; used to detect that a line search is
+// starting from the trial point accepted at the previous Newton iteration.
+static bool IsSameVector(const Vector &a, const Vector &b)
+{
+   if (a.Size() != b.Size()) { return false; }
+   const double *ad = a.HostRead(), *bd = b.HostRead();
+   for (int i = 0; i < a.Size(); i++)
+   {
+      if (ad[i] != bd[i]) { return false; }
+   }
+   return true;
+}
+
+double TMOPNewtonSolver::MinDetJpr(const FiniteElementSpace *fes,
+                                   const Vector &x_loc) const
+{
+   const int NE = fes->GetNE();
+   if (NE == 0) { return infinity(); }
+   Mesh *mesh = fes->GetMesh();
+   const int dim = mesh->Dimension();
+
+   // Batched scan: interpolate det(Jpr) at all quadrature points of all
+   // elements at once and reduce. Used when all elements share the same
+   // finite element and integration rule.
+   if (!IntegRules && fes->GetVDim() == dim && (dim == 2 || dim == 3) &&
+       mesh->GetNumGeometries(dim) == 1)
+   {
+      const int nd = fes->GetFE(0)->GetDof(), nq = ir.GetNPoints();
+      const int max_nd = (dim == 2) ? QuadratureInterpolator::MAX_ND2D
+                         /*       */ : QuadratureInterpolator::MAX_ND3D;
+      const int max_nq = (dim == 2) ? QuadratureInterpolator::MAX_NQ2D
+                         /*       */ : QuadratureInterpolator::MAX_NQ3D;
+      if (nd <= max_nd && nq <= max_nq)
+      {
+         const QuadratureInterpolator *qi =
+            fes->GetQuadratureInterpolator(ir);
+         qi->DisableTensorProducts();
+         qi->SetOutputLayout(QVectorLayout::byNODES);
+         const Operator *elem_restr =
+            fes->GetElementRestriction(ElementDofOrdering::NATIVE);
+         Vector q_val, q_der, q_det(nq*NE);
+         q_det.UseDevice(true);
+         if (elem_restr)
+         {
+            Vector e_vec(dim*nd*NE);
+            e_vec.UseDevice(true);
+            elem_restr->Mult(x_loc, e_vec);
+            qi->Mult(e_vec, QuadratureInterpolator::DETERMINANTS,
+                     q_val, q_der, q_det);
+         }
+         else
+         {
+            qi->Mult(x_loc, QuadratureInterpolator::DETERMINANTS,
+                     q_val, q_der, q_det);
+         }
+         return q_det.Min();
+      }
+   }
+
+   // Fallback: element-by-element scan (mixed meshes, large elements).
+   double min_detJ = infinity();
+   Array<int> xdofs;
+   DenseMatrix Jpr(dim);
+   for (int i = 0; i < NE; i++)
+   {
+      const int dof = fes->GetFE(i)->GetDof();
+      DenseMatrix dshape(dof, dim), pos(dof, dim);
+      Vector posV(pos.Data(), dof * dim);
+
+      fes->GetElementVDofs(i, xdofs);
+      x_loc.GetSubVector(xdofs, posV);
+
+      const IntegrationRule &irule = GetIntegrationRule(*fes->GetFE(i));
+      const int nsp = irule.GetNPoints();
+      for (int j = 0; j < nsp; j++)
+      {
+         fes->GetFE(i)->CalcDShape(irule.IntPoint(j), dshape);
+         MultAtB(pos, dshape, Jpr);
+         min_detJ = std::min(min_detJ, Jpr.Det());
+      }
+   }
+   return min_detJ;
+}
+
 double TMOPNewtonSolver::ComputeScalingFactor(const Vector &x,
                                               const Vector &b) const
 {
    const FiniteElementSpace *fes = NULL;
-   double energy_in = 0.0;
 #ifdef MFEM_USE_MPI
    const ParNonlinearForm *p_nlf = dynamic_cast<const ParNonlinearForm *>(oper);
    MFEM_VERIFY(!(parallel && p_nlf == NULL), "Invalid Operator subclass.");
-   if (parallel)
-   {
-      fes = p_nlf->FESpace();
-      energy_in = p_nlf->GetEnergy(x);
-   }
+   if (parallel) { fes = p_nlf->FESpace(); }
 #endif
    const bool serial = !parallel;
    const NonlinearForm *nlf = dynamic_cast<const NonlinearForm *>(oper);
    MFEM_VERIFY(!(serial && nlf == NULL), "Invalid Operator subclass.");
-   if (serial)
+   if (serial) { fes = nlf->FESpace(); }
+
+   // Check if the line search starts from the trial point accepted at the
+   // previous Newton iteration, in which case the cached energy and minimal
+   // det(Jpr) are reused below. All ranks must take the same branch, hence
+   // the reduction.
+   int at_last = IsSameVector(x, x_last);
+#ifdef MFEM_USE_MPI
+   if (parallel)
    {
-      fes = nlf->FESpace();
-      energy_in = nlf->GetEnergy(x);
+      MPI_Allreduce(MPI_IN_PLACE, &at_last, 1, MPI_INT, MPI_LAND,
+                    p_nlf->ParFESpace()->GetComm());
    }
+#endif
 
-   const int NE = fes->GetMesh()->GetNE(), dim = fes->GetMesh()->Dimension();
-   Array<int> xdofs;
-   DenseMatrix Jpr(dim);
+   double energy_in = 0.0;
+   if (energy_cached && at_last) { energy_in = energy_last; }
+   else
+   {
+#ifdef MFEM_USE_MPI
+      if (parallel) { energy_in = p_nlf->GetEnergy(x); }
+#endif
+      if (serial) { energy_in = nlf->GetEnergy(x); }
+   }
 
    // Get the local prolongation of the solution vector.
    Vector x_out_loc(fes->GetVSize());
@@ -352,40 +447,26 @@ double TMOPNewtonSolver::ComputeScalingFactor(const Vector &x,
 
    // Check if the starting mesh (given by x) is inverted.
    // Note that x hasn't been modified by the Newton update yet.
-   double min_detJ = infinity();
-   for (int i = 0; i < NE; i++)
+   double min_detJ_all;
+   if (detJ_cached && at_last) { min_detJ_all = min_detJ_last; }
+   else
    {
-      const int dof = fes->GetFE(i)->GetDof();
-      DenseMatrix dshape(dof, dim), pos(dof, dim);
-      Vector posV(pos.Data(), dof * dim);
-
-      fes->GetElementVDofs(i, xdofs);
-      x_out_loc.GetSubVector(xdofs, posV);
-
-      const IntegrationRule &irule = GetIntegrationRule(*fes->GetFE(i));
-      const int nsp = irule.GetNPoints();
-      for (int j = 0; j < nsp; j++)
+      min_detJ_all = MinDetJpr(fes, x_out_loc);
+#ifdef MFEM_USE_MPI
+      if (parallel)
       {
-         fes->GetFE(i)->CalcDShape(irule.IntPoint(j), dshape);
-         MultAtB(pos, dshape, Jpr);
-         min_detJ = std::min(min_detJ, Jpr.Det());
+         MPI_Allreduce(MPI_IN_PLACE, &min_detJ_all, 1, MPI_DOUBLE, MPI_MIN,
+                       p_nlf->ParFESpace()->GetComm());
       }
-   }
-   double min_detJ_all = min_detJ;
-#ifdef MFEM_USE_MPI
-   if (parallel)
-   {
-      MPI_Allreduce(&min_detJ, &min_detJ_all, 1, MPI_DOUBLE, MPI_MIN,
-                    p_nlf->ParFESpace()->GetComm());
-   }
 #endif
+   }
    const bool untangling = (min_detJ_all <= 0) ? true : false;
 
    const bool have_b = (b.Size() == Height());
 
    Vector x_out(x.Size());
    bool x_out_ok = false;
-   double scale = 1.0, energy_out = 0.0;
+   double scale = 1.0, energy_out = 0.0, min_detJ_out = infinity();
    const double norm0 = Norm(r);
 
    const double detJ_factor = (solver_type == 1) ? 0.25 : 0.5;
@@ -411,37 +492,16 @@ double TMOPNewtonSolver::ComputeScalingFactor(const Vector &x,
       // Check det(Jpr) > 0.
       if (!untangling)
       {
-         int jac_ok = 1;
-         for (int i = 0; i < NE; i++)
-         {
-            const int dof = fes->GetFE(i)->GetDof();
-            DenseMatrix dshape(dof, dim), pos(dof, dim);
-            Vector posV(pos.Data(), dof * dim);
-
-            fes->GetElementVDofs(i, xdofs);
-            x_out_loc.GetSubVector(xdofs, posV);
-
-            const IntegrationRule &irule = GetIntegrationRule(*fes->GetFE(i));
-            const int nsp = irule.GetNPoints();
-            for (int j = 0; j < nsp; j++)
-            {
-               fes->GetFE(i)->CalcDShape(irule.IntPoint(j), dshape);
-               MultAtB(pos, dshape, Jpr);
-               if (Jpr.Det() <= 0.0) { jac_ok = 0; goto break2; }
-            }
-         }
-
-      break2:
-         int jac_ok_all = jac_ok;
+         min_detJ_out = MinDetJpr(fes, x_out_loc);
 #ifdef MFEM_USE_MPI
          if (parallel)
          {
-            MPI_Allreduce(&jac_ok, &jac_ok_all, 1, MPI_INT, MPI_LAND,
-                          p_nlf->ParFESpace()->GetComm());
+            MPI_Allreduce(MPI_IN_PLACE, &min_detJ_out, 1, MPI_DOUBLE,
+                          MPI_MIN, p_nlf->ParFESpace()->GetComm());
          }
 #endif
 
-         if (jac_ok_all == 0)
+         if (min_detJ_out <= 0.0)
          {
             if (print_level >= 0)
             { mfem::out << "Scale = " << scale << " Neg det(J) found.\n"; }
@@ -499,6 +559,19 @@ double TMOPNewtonSolver::ComputeScalingFactor(const Vector &x,
                 << "% with " << scale << " scaling.\n";
    }
 
+   // Cache the values computed at the accepted trial point; the next Newton
+   // iteration starts its line search there. The min det(Jpr) is known only
+   // when the trial points were checked for inversion, i.e. not while
+   // untangling.
+   energy_cached = x_out_ok;
+   detJ_cached = x_out_ok && !untangling;
+   if (x_out_ok)
+   {
+      x_last = x_out;
+      energy_last = energy_out;
+      min_detJ_last = min_detJ_out;
+   }
+
    if (x_out_ok == false) { scale = 0.0; }
    return scale;
 }
@@ -14,6 +14,7 @@
 
 #include "bilinearform.hpp"
 #include "pbilinearform.hpp"
+#include "nonlinearform.hpp"
 #include "tmop.hpp"
 #include "gslib.hpp"
 
@@ -120,6 +121,15 @@ protected:
    IntegrationRules *IntegRules;
    int integ_order;
 
+   // Line-search caches: the energy and the minimal det(Jpr) at the most
+   // recently accepted trial point. The accepted point becomes the starting
+   // point of the next Newton iteration, so reusing the values there saves
+   // one full-mesh energy sweep and one full-mesh Jacobian scan per
+   // iteration; see ComputeScalingFactor().
+   mutable Vector x_last;
+   mutable double energy_last, min_detJ_last;
+   mutable bool energy_cached, detJ_cached;
+
    const IntegrationRule &GetIntegrationRule(const FiniteElement &el) const
    {
       if (IntegRules)
@@ -131,15 +141,26 @@ protected:
 
    void UpdateDiscreteTC(const TMOP_Integrator &ti, const Vector &x_new) const;
 
+   /** @brief Minimal det(Jpr) over the quadrature points of all elements.
+
+       Uses a batched scan through the QuadratureInterpolator when the mesh
+       has a single element type; falls back to an element-by-element loop
+       for mixed meshes and prescribed integration rule sets. */
+   double MinDetJpr(const FiniteElementSpace *fes, const Vector &x_loc) const;
+
 public:
 #ifdef MFEM_USE_MPI
    TMOPNewtonSolver(MPI_Comm comm, const IntegrationRule &irule, int type = 0)
       : LBFGSSolver(comm), solver_type(type), parallel(true),
-        ir(irule), IntegRules(NULL), integ_order(-1) { }
+        ir(irule), IntegRules(NULL), integ_order(-1),
+        energy_last(0.0), min_detJ_last(0.0),
+        energy_cached(false), detJ_cached(false) { }
 #endif
    TMOPNewtonSolver(const IntegrationRule &irule, int type = 0)
       : LBFGSSolver(), solver_type(type), parallel(false),
-        ir(irule), IntegRules(NULL), integ_order(-1) { }
+        ir(irule), IntegRules(NULL), integ_order(-1),
+        energy_last(0.0), min_detJ_last(0.0),
+        energy_cached(false), detJ_cached(false) { }
 
    /// Prescribe a set of integration rules; relevant for mixed meshes.
    /** If called, this function has priority over the IntegrationRule given to
@@ -156,6 +177,13 @@ public:
 
    virtual void Mult(const Vector &b, Vector &x) const
    {
+      // (Re)assemble the quadrature point data of the form; this is a no-op
+      // unless AssemblyLevel::PARTIAL is used, and makes sure the PA data
+      // accounts for normalization enabled after the form was set up.
+      NonlinearForm *nlf =
+         const_cast<NonlinearForm *>(dynamic_cast<const NonlinearForm *>(oper));
+      if (nlf) { nlf->Setup(); }
+
       if (solver_type == 0)
       {
          NewtonSolver::Mult(b, x);
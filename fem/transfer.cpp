@@ -51,6 +51,29 @@ void TransferOperator::MultTranspose(const Vector& x, Vector& y) const
    opr->MultTranspose(x, y);
 }
 
+void TransferOperator::AddMult(const Vector& x, Vector& y) const
+{
+   const TensorProductPRefinementTransferOperator* topr =
+      dynamic_cast<const TensorProductPRefinementTransferOperator*>(opr);
+   if (topr)
+   {
+      topr->AddMult(x, y);
+      return;
+   }
+   const PRefinementTransferOperator* popr =
+      dynamic_cast<const PRefinementTransferOperator*>(opr);
+   if (popr)
+   {
+      popr->AddMult(x, y);
+      return;
+   }
+   // h-refinement path: generic prolongation operator
+   tmp.SetSize(y.Size());
+   tmp.UseDevice(true);
+   opr->Mult(x, tmp);
+   y += tmp;
+}
+
 PRefinementTransferOperator::PRefinementTransferOperator(
    const FiniteElementSpace& lFESpace_, const FiniteElementSpace& hFESpace_)
    : Operator(hFESpace_.GetVSize(), lFESpace_.GetVSize()), lFESpace(lFESpace_),
@@ -103,6 +126,65 @@ void PRefinementTransferOperator::Mult(const Vector& x, Vector& y) const
    }
 }
 
+void PRefinementTransferOperator::AddMult(const Vector& x, Vector& y) const
+{
+   Mesh* mesh = hFESpace.GetMesh();
+   Array<int> l_dofs, h_dofs, l_vdofs, h_vdofs;
+   DenseMatrix loc_prol;
+   Vector subY, subX;
+
+   Array<char> processed(hFESpace.GetVSize());
+   processed = 0;
+
+   Geometry::Type cached_geom = Geometry::INVALID;
+   const FiniteElement* h_fe = NULL;
+   const FiniteElement* l_fe = NULL;
+   IsoparametricTransformation T;
+
+   int vdim = lFESpace.GetVDim();
+
+   for (int i = 0; i < mesh->GetNE(); i++)
+   {
+      hFESpace.GetElementDofs(i, h_dofs);
+      lFESpace.GetElementDofs(i, l_dofs);
+
+      const Geometry::Type geom = mesh->GetElementBaseGeometry(i);
+      if (geom != cached_geom)
+      {
+         h_fe = hFESpace.GetFE(i);
+         l_fe = lFESpace.GetFE(i);
+         T.SetIdentityTransformation(h_fe->GetGeomType());
+         h_fe->GetTransferMatrix(*l_fe, T, loc_prol);
+         subY.SetSize(loc_prol.Height());
+         cached_geom = geom;
+      }
+
+      for (int vd = 0; vd < vdim; vd++)
+      {
+         l_dofs.Copy(l_vdofs);
+         lFESpace.DofsToVDofs(vd, l_vdofs);
+         h_dofs.Copy(h_vdofs);
+         hFESpace.DofsToVDofs(vd, h_vdofs);
+         x.GetSubVector(l_vdofs, subX);
+         loc_prol.Mult(subX, subY);
+         // each fine dof must receive its prolongated value exactly once
+         for (int p = 0; p < h_dofs.Size(); ++p)
+         {
+            if (processed[hFESpace.DecodeDof(h_dofs[p])])
+            {
+               subY[p] = 0.0;
+            }
+         }
+         y.AddElementVector(h_vdofs, subY);
+      }
+
+      for (int p = 0; p < h_dofs.Size(); ++p)
+      {
+         processed[hFESpace.DecodeDof(h_dofs[p])] = 1;
+      }
+   }
+}
+
 void PRefinementTransferOperator::MultTranspose(const Vector& x,
                                                 Vector& y) const
 {
@@ -490,6 +572,35 @@ void TensorProductPRefinementTransferOperator::Mult(const Vector& x,
    elem_restrict_lex_h->MultTranspose(localH, y);
 }
 
+void TensorProductPRefinementTransferOperator::AddMult(const Vector& x,
+                                                       Vector& y) const
+{
+   if (lFESpace.GetMesh()->GetNE() == 0)
+   {
+      return;
+   }
+
+   elem_restrict_lex_l->Mult(x, localL);
+   if (dim == 2)
+   {
+      TransferKernels::Prolongation2D(NE, D1D, Q1D, localL, localH, B, mask);
+   }
+   else if (dim == 3)
+   {
+      TransferKernels::Prolongation3D(NE, D1D, Q1D, localL, localH, B, mask);
+   }
+   else
+   {
+      MFEM_ABORT("TensorProductPRefinementTransferOperator::AddMult not "
+                 "implemented for dim = "
+                 << dim);
+   }
+   // the mask in the prolongation kernel guarantees that each fine dof is
+   // contributed exactly once, so the accumulating transpose computes y += P x
+   static_cast<const ElementRestriction*>(elem_restrict_lex_h)
+   ->AddMultTranspose(localH, y);
+}
+
 void TensorProductPRefinementTransferOperator::MultTranspose(const Vector& x,
                                                              Vector& y) const
 {
@@ -544,6 +655,13 @@ void TrueTransferOperator::Mult(const Vector& x, Vector& y) const
    hFESpace.GetRestrictionMatrix()->Mult(tmpH, y);
 }
 
+void TrueTransferOperator::AddMult(const Vector& x, Vector& y) const
+{
+   lFESpace.GetProlongationMatrix()->Mult(x, tmpL);
+   localTransferOperator->Mult(tmpL, tmpH);
+   hFESpace.GetRestrictionMatrix()->AddMult(tmpH, y);
+}
+
 void TrueTransferOperator::MultTranspose(const Vector& x, Vector& y) const
 {
    hFESpace.GetRestrictionMatrix()->MultTranspose(x, tmpH);
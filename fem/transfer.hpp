@@ -27,6 +27,8 @@ class TransferOperator : public Operator
 {
 private:
    Operator* opr;
+   /// Scratch vector for the generic fallback path of AddMult().
+   mutable Vector tmp;
 
 public:
    /// Constructs a transfer operator from \p lFESpace to \p hFESpace.
@@ -51,6 +53,11 @@ public:
    /** The vector \p x corresponding to the fine space is restricted to the vector
        \p y corresponding to the coarse space. */
    virtual void MultTranspose(const Vector& x, Vector& y) const override;
+
+   /// @brief Add the prolongation of \p x to \p y, i.e. compute y += P x.
+   /** Fuses the prolongation with the coarse-grid correction update, saving
+       an intermediate vector and a separate axpy, see Multigrid::Cycle(). */
+   void AddMult(const Vector& x, Vector& y) const;
 };
 
 /// Matrix-free transfer operator between finite element spaces on the same mesh
@@ -80,6 +87,9 @@ public:
    /** The vector \p x corresponding to the fine space is restricted to the vector
    \p y corresponding to the coarse space. */
    virtual void MultTranspose(const Vector& x, Vector& y) const override;
+
+   /// @brief Add the prolongation of \p x to \p y, i.e. compute y += P x.
+   void AddMult(const Vector& x, Vector& y) const;
 };
 
 /// @brief Matrix-free transfer operator between finite element spaces on the same
@@ -122,6 +132,12 @@ public:
    /** The vector \p x corresponding to the fine space is restricted to the vector
    \p y corresponding to the coarse space. */
    virtual void MultTranspose(const Vector& x, Vector& y) const override;
+
+   /// @brief Add the prolongation of \p x to \p y, i.e. compute y += P x.
+   /** The element restriction transpose at the end of the prolongation
+       accumulates into \p y, so no intermediate fine-space vector is
+       needed. */
+   void AddMult(const Vector& x, Vector& y) const;
 };
 
 #ifdef MFEM_USE_MPI
@@ -155,6 +171,9 @@ public:
    /** The true dof vector \p x corresponding to the fine space is restricted to
        the true dof vector \p y corresponding to the coarse space. */
    virtual void MultTranspose(const Vector& x, Vector& y) const override;
+
+   /// @brief Add the prolongation of \p x to \p y, i.e. compute y += P x.
+   void AddMult(const Vector& x, Vector& y) const;
 };
 #endif
 
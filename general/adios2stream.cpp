@@ -146,6 +146,7 @@ void adios2stream::SetParameters(
 {
    io.SetParameters(parameters);
    refine = SetBoolParameter("RefinedData", parameters, true);
+   full_data = SetBoolParameter("FullData", parameters, false);
 }
 
 void adios2stream::SetParameter(const std::string key,
@@ -156,6 +157,10 @@ void adios2stream::SetParameter(const std::string key,
    {
       refine = SetBoolParameter("RefinedData", io.Parameters(), true);
    }
+   if (key == "FullData")
+   {
+      full_data = SetBoolParameter("FullData", io.Parameters(), false);
+   }
 }
 
 void adios2stream::BeginStep()
@@ -499,7 +504,16 @@ void adios2stream::Print(const Mesh& mesh, const mode print_mode)
          }
          else
          {
-            grid_function->Print(*this, "vertices");
+            adios2::Variable<double> varVertices = io.InquireVariable<double>("vertices");
+            // zero-copy access to adios2 buffer to put non-contiguous to contiguous memory
+            adios2::Variable<double>::Span spanVertices = engine.Put(varVertices);
+
+            const double* data = grid_function->HostRead();
+            const size_t size = static_cast<size_t>(grid_function->Size());
+            for (size_t i = 0; i < size; ++i)
+            {
+               spanVertices[i] = data[i];
+            }
          }
       }
    };
@@ -560,9 +574,6 @@ void adios2stream::Save(const GridFunction& grid_function,
    };
 
    // BODY OF FUNCTION STARTS HERE
-   const std::map<std::string, std::string> parameters = io.Parameters();
-   const bool full_data = SetBoolParameter("FullData", parameters, false);
-
    if (!full_data && !refine)
    {
       return;
@@ -643,8 +654,17 @@ void adios2stream::Save(const GridFunction& grid_function,
       lf_SafeDefine(variable_name +"/full", tuples, components,
                     fes->GetOrdering(),
                     std::string(fes->FEColl()->Name()) );
-      // calls Vector::Print
-      grid_function.Print(*this, variable_name+"/full");
+
+      // zero-copy access to adios2 buffer, so the engine doesn't have to hold
+      // the caller's pointer until the step is drained
+      adios2::Variable<double> variable_full =
+         io.InquireVariable<double>(variable_name + "/full");
+      adios2::Variable<double>::Span span_full = engine.Put<double>(variable_full);
+      const double* data = grid_function.HostRead();
+      for (size_t i = 0; i < size; ++i)
+      {
+         span_full[i] = data[i];
+      }
 
       if (!refine && type == adios2stream::data_type::point_data)
       {
@@ -191,6 +191,10 @@ private:
    /** true: refine solution at Save */
    bool refine = true;
 
+   /** true: save the full grid function data as well ("FullData" parameter),
+    *  cached to avoid copying the engine parameters at every Save */
+   bool full_data = false;
+
    /** refinement level at Save and Print */
    int refinement_level = 1;
 
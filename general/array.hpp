@@ -22,6 +22,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <iterator>
 
 namespace mfem
 {
@@ -157,6 +158,10 @@ public:
    /// Append another array to this array, resize if necessary.
    inline int Append(const Array<T> &els) { return Append(els, els.Size()); }
 
+   /// Append the range [first,last) to this array, resize if necessary.
+   template <class InputIt>
+   inline int Append(InputIt first, InputIt last);
+
    /// Prepend an 'el' to the array, resize if necessary.
    inline int Prepend(const T &el);
 
@@ -329,6 +334,49 @@ inline bool operator!=(const Array<T> &LHS, const Array<T> &RHS)
 }
 
 
+/** @brief Array with inline storage for its first @a N entries.
+
+    SmallArray behaves exactly like Array<T>, but its initial capacity is a
+    buffer inside the object itself, so short-lived arrays of bounded size
+    (e.g. the 4-27 entry dof lists filled by FiniteElementSpace and Mesh
+    query methods) avoid heap allocation entirely. When the size grows past
+    @a N, the array transparently switches to heap storage and behaves like
+    a plain Array<T> from then on.
+
+    Since the inline buffer belongs to the object, a SmallArray must not
+    give its data away: do not use Swap(), StealData(), or MakeDataOwner()
+    while the data still points to the inline buffer. */
+template <class T, int N>
+class SmallArray : public Array<T>
+{
+   T buffer[N];
+
+   void InitBuffer() { this->data.Wrap(buffer, N, false); this->size = 0; }
+
+public:
+   /// Creates an empty array with inline capacity @a N.
+   SmallArray() { InitBuffer(); }
+
+   /// Creates an array of @a asize elements.
+   explicit SmallArray(int asize) { InitBuffer(); this->SetSize(asize); }
+
+   /// Deep copy from @a src, an Array (or SmallArray) of the same type.
+   SmallArray(const Array<T> &src) { InitBuffer(); src.Copy(*this); }
+
+   /// Copy constructor: deep copy from @a src.
+   SmallArray(const SmallArray &src) : Array<T>()
+   { InitBuffer(); src.Copy(*this); }
+
+   /// Assignment operator: deep copy from @a src.
+   SmallArray &operator=(const Array<T> &src)
+   { src.Copy(*this); return *this; }
+
+   /// Assignment operator: deep copy from @a src.
+   SmallArray &operator=(const SmallArray &src)
+   { src.Copy(*this); return *this; }
+};
+
+
 template <class T>
 class Array2D;
 
@@ -743,6 +791,18 @@ inline int Array<T>::Append(const T *els, int nels)
    return size;
 }
 
+template <class T> template <class InputIt>
+inline int Array<T>::Append(InputIt first, InputIt last)
+{
+   const int old_size = size;
+   SetSize(size + (int)std::distance(first, last));
+   for (int i = old_size; first != last; ++first, ++i)
+   {
+      data[i] = *first;
+   }
+   return size;
+}
+
 template <class T>
 inline int Array<T>::Prepend(const T &el)
 {
@@ -53,8 +53,16 @@
 #define MFEM_SYNC_THREAD
 #define MFEM_THREAD_ID(k) 0
 #define MFEM_THREAD_SIZE(k) 1
+#ifdef MFEM_USE_OPENMP
+// On the host, the loops emulating the blocked thread structure of the device
+// kernels have independent iterations, just like the device threads they
+// stand in for, so they can be annotated for SIMD vectorization.
+#define MFEM_FOREACH_THREAD(i,k,N) \
+   _Pragma("omp simd") for(int i=0; i<N; i++)
+#else
 #define MFEM_FOREACH_THREAD(i,k,N) for(int i=0; i<N; i++)
 #endif
+#endif
 
 template <typename T>
 MFEM_HOST_DEVICE T AtomicAdd(T &add, const T val)
@@ -63,8 +71,14 @@ MFEM_HOST_DEVICE T AtomicAdd(T &add, const T val)
      (defined(MFEM_USE_HIP)  && defined(__HIP_DEVICE_COMPILE__)))
    return atomicAdd(&add,val);
 #else
-   T old = add;
+   T old;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp atomic capture
+   { old = add; add += val; }
+#else
+   old = add;
    add += val;
+#endif
    return old;
 #endif
 }
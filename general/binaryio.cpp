@@ -12,6 +12,8 @@
 #include "binaryio.hpp"
 #include "error.hpp"
 
+#include <algorithm>
+
 namespace mfem
 {
 namespace bin_io
@@ -24,30 +26,78 @@ static const char *b64str
 
 void WriteBase64(std::ostream &out, const void *bytes, size_t nbytes)
 {
+   // Encode into a bounded local buffer flushed with bulk stream writes:
+   // inserting the four output characters of every input triple one at a
+   // time dominates the cost of large binary VTU output otherwise.
+   const size_t buf_cap = 1 << 20; // encoded bytes per stream write
+   std::vector<char> buf;
+   buf.reserve(std::min(buf_cap, 4*(nbytes/3) + 8));
    const unsigned char *in = static_cast<const unsigned char *>(bytes);
    const unsigned char *end = in + nbytes;
    while (end - in >= 3)
    {
-      out << b64str[in[0] >> 2];
-      out << b64str[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-      out << b64str[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
-      out << b64str[in[2] & 0x3f];
+      buf.push_back(b64str[in[0] >> 2]);
+      buf.push_back(b64str[((in[0] & 0x03) << 4) | (in[1] >> 4)]);
+      buf.push_back(b64str[((in[1] & 0x0f) << 2) | (in[2] >> 6)]);
+      buf.push_back(b64str[in[2] & 0x3f]);
       in += 3;
+      if (buf.size() + 4 > buf_cap)
+      {
+         out.write(buf.data(), buf.size());
+         buf.clear();
+      }
    }
    if (end - in > 0) // Padding
    {
-      out << b64str[in[0] >> 2];
+      buf.push_back(b64str[in[0] >> 2]);
       if (end - in == 1)
       {
-         out << b64str[(in[0] & 0x03) << 4];
-         out << '=';
+         buf.push_back(b64str[(in[0] & 0x03) << 4]);
+         buf.push_back('=');
       }
       else // end - in == 2
       {
-         out << b64str[((in[0] & 0x03) << 4) | (in[1] >> 4)];
-         out << b64str[(in[1] & 0x0f) << 2];
+         buf.push_back(b64str[((in[0] & 0x03) << 4) | (in[1] >> 4)]);
+         buf.push_back(b64str[(in[1] & 0x0f) << 2]);
       }
-      out << '=';
+      buf.push_back('=');
+   }
+   out.write(buf.data(), buf.size());
+}
+
+template <size_t width>
+static void ByteSwapFixed(unsigned char *bytes, size_t n)
+{
+   for (size_t i = 0; i < n; i++)
+   {
+      unsigned char *b = bytes + i*width;
+      for (size_t j = 0; j < width/2; j++)
+      {
+         const unsigned char t = b[j];
+         b[j] = b[width-1-j];
+         b[width-1-j] = t;
+      }
+   }
+}
+
+void ByteSwap(void *data, size_t width, size_t n)
+{
+   unsigned char *bytes = static_cast<unsigned char *>(data);
+   switch (width)
+   {
+      case 1: break;
+      case 2: ByteSwapFixed<2>(bytes, n); break;
+      case 4: ByteSwapFixed<4>(bytes, n); break;
+      case 8: ByteSwapFixed<8>(bytes, n); break;
+      default:
+         for (size_t i = 0; i < n; i++)
+         {
+            unsigned char *b = bytes + i*width;
+            for (size_t j = 0; j < width/2; j++)
+            {
+               std::swap(b[j], b[width-1-j]);
+            }
+         }
    }
 }
 
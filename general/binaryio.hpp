@@ -41,6 +41,20 @@ inline T read(std::istream& is)
    return value;
 }
 
+/// Write 'n' values from 'data' to the stream with one stream operation.
+template <typename T>
+inline void write_array(std::ostream &os, const T *data, size_t n)
+{
+   os.write(reinterpret_cast<const char*>(data), n*sizeof(T));
+}
+
+/// Read 'n' values from the stream into 'data' with one stream operation.
+template <typename T>
+inline void read_array(std::istream &is, T *data, size_t n)
+{
+   is.read(reinterpret_cast<char*>(data), n*sizeof(T));
+}
+
 template <typename T>
 void AppendBytes(std::vector<char> &vec, const T &val)
 {
@@ -48,6 +62,20 @@ void AppendBytes(std::vector<char> &vec, const T &val)
    vec.insert(vec.end(), ptr, ptr + sizeof(T));
 }
 
+/// Append the bytes of 'n' values from 'data' to the byte buffer 'vec'.
+template <typename T>
+void AppendArray(std::vector<char> &vec, const T *data, size_t n)
+{
+   const char *ptr = reinterpret_cast<const char*>(data);
+   vec.insert(vec.end(), ptr, ptr + n*sizeof(T));
+}
+
+/** @brief Reverse, in place, the byte order of 'n' values of 'width'
+    bytes each, e.g. to read binary files written on a machine of the
+    other endianness. The common fixed widths use loops simple enough for
+    the compiler to vectorize. */
+void ByteSwap(void *data, size_t width, size_t n);
+
 void WriteBase64(std::ostream &out, const void *bytes, size_t length);
 
 } // namespace mfem::bin_io
@@ -25,8 +25,13 @@
 #include "text.hpp"
 #include "sort_pairs.hpp"
 #include "globals.hpp"
+#include "forall.hpp"
 
 #include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
 #include <map>
 
 using namespace std;
@@ -348,6 +353,158 @@ GroupCommunicator::GroupCommunicator(GroupTopology &gt, Mode m)
    num_requests = 0;
    request_marker = NULL;
    buf_offsets = NULL;
+   buf_on_device = false;
+   node_aware = false;
+   node_comm = MPI_COMM_NULL;
+   node_win = MPI_WIN_NULL;
+   node_win_base = NULL;
+   node_barrier_pending = false;
+}
+
+MemoryType GroupCommunicator::GetBufferMemoryType()
+{
+   return Device::Allows(Backend::DEVICE_MASK) ?
+          MemoryType::HOST_PINNED : Device::GetHostMemoryType();
+}
+
+void GroupCommunicator::WaitNodeBarrier() const
+{
+   if (node_barrier_pending)
+   {
+      MPI_Wait(&node_barrier, MPI_STATUS_IGNORE);
+      node_barrier_pending = false;
+   }
+}
+
+void GroupCommunicator::PostNodeBarrier() const
+{
+#if MPI_VERSION >= 3
+   MPI_Ibarrier(node_comm, &node_barrier);
+   node_barrier_pending = true;
+#endif
+}
+
+void GroupCommunicator::SetNodeAware(bool on)
+{
+#if MPI_VERSION >= 3
+   if (on == node_aware) { return; }
+   MFEM_VERIFY(comm_lock == 0, "object is already in use");
+   if (!on)
+   {
+      WaitNodeBarrier();
+      MPI_Win_free(&node_win);
+      MPI_Comm_free(&node_comm);
+      node_win_base = NULL;
+      node_aware = false;
+      return;
+   }
+   MFEM_VERIFY(mode == byNeighbor, "node-aware mode requires mode byNeighbor");
+   MFEM_VERIFY(!buf_on_device,
+               "node-aware mode cannot be combined with UseDevice()");
+   MFEM_VERIFY(nbr_send_groups.Size() > 0, "the object is not finalized");
+
+   // Split off the ranks sharing this compute node and map the global ranks
+   // of the node to their node ranks.
+   MPI_Comm_split_type(gtopo.GetComm(), MPI_COMM_TYPE_SHARED, gtopo.MyRank(),
+                       MPI_INFO_NULL, &node_comm);
+   int node_size;
+   MPI_Comm_size(node_comm, &node_size);
+   Array<int> node_to_global(node_size);
+   int my_rank = gtopo.MyRank();
+   MPI_Allgather(&my_rank, 1, MPI_INT, node_to_global.GetData(), 1, MPI_INT,
+                 node_comm);
+   std::map<int, int> global_to_node;
+   for (int i = 0; i < node_size; i++)
+   {
+      global_to_node[node_to_global[i]] = i;
+   }
+
+   // Flag the intra-node neighbors and lay out this rank's send chunks in
+   // its window segment: first the broadcast chunks, then the reduce chunks.
+   const int num_nbrs = nbr_send_groups.Size();
+   nbr_node_rank.SetSize(num_nbrs);
+   nbr_node_rank = -1;
+   int total = 0;
+   for (int d = 0; d < 2; d++)
+   {
+      win_send_offset[d].SetSize(num_nbrs);
+      win_send_offset[d] = -1;
+   }
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      const int glob_rank = gtopo.GetNeighborRank(nbr);
+      const std::map<int, int>::iterator it = global_to_node.find(glob_rank);
+      if (it == global_to_node.end()) { continue; }
+      nbr_node_rank[nbr] = it->second;
+      for (int d = 0; d < 2; d++)
+      {
+         // in Reduce operations send_groups <--> recv_groups
+         const Table &send_groups = (d == 0) ? nbr_send_groups :
+                                    nbr_recv_groups;
+         const int num_send_groups = send_groups.RowSize(nbr);
+         const int *grp_list = send_groups.GetRow(nbr);
+         win_send_offset[d][nbr] = total;
+         for (int i = 0; i < num_send_groups; i++)
+         {
+            total += group_ldof.RowSize(grp_list[i]);
+         }
+      }
+   }
+
+   // Allocate the shared window, sized for the largest data type used by the
+   // Bcast/Reduce instantiations, and query the neighbors' segments.
+   MPI_Win_allocate_shared((MPI_Aint)total*sizeof(double), 1, MPI_INFO_NULL,
+                           node_comm, &node_win_base, &node_win);
+   nbr_win_base.SetSize(num_nbrs);
+   nbr_win_base = NULL;
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      if (nbr_node_rank[nbr] < 0) { continue; }
+      MPI_Aint seg_size;
+      int disp_unit;
+      void *base;
+      MPI_Win_shared_query(node_win, nbr_node_rank[nbr], &seg_size,
+                           &disp_unit, &base);
+      nbr_win_base[nbr] = (char*)base;
+   }
+
+   // Exchange with each intra-node neighbor the offsets, inside the owner's
+   // window, of the chunks destined to the other side.
+   Array<int> send_off(2*num_nbrs), recv_off(2*num_nbrs);
+   Array<MPI_Request> off_requests(2*num_nbrs);
+   int off_request_counter = 0;
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      if (nbr_node_rank[nbr] < 0) { continue; }
+      send_off[2*nbr+0] = win_send_offset[0][nbr];
+      send_off[2*nbr+1] = win_send_offset[1][nbr];
+      MPI_Isend(&send_off[2*nbr], 2, MPI_INT, gtopo.GetNeighborRank(nbr),
+                46822, gtopo.GetComm(), &off_requests[off_request_counter++]);
+      MPI_Irecv(&recv_off[2*nbr], 2, MPI_INT, gtopo.GetNeighborRank(nbr),
+                46822, gtopo.GetComm(), &off_requests[off_request_counter++]);
+   }
+   MPI_Waitall(off_request_counter, off_requests.GetData(),
+               MPI_STATUSES_IGNORE);
+   for (int d = 0; d < 2; d++)
+   {
+      win_recv_offset[d].SetSize(num_nbrs);
+      win_recv_offset[d] = -1;
+   }
+   for (int nbr = 1; nbr < num_nbrs; nbr++)
+   {
+      if (nbr_node_rank[nbr] < 0) { continue; }
+      win_recv_offset[0][nbr] = recv_off[2*nbr+0];
+      win_recv_offset[1][nbr] = recv_off[2*nbr+1];
+   }
+
+   node_barrier_pending = false;
+   node_aware = true;
+#else
+   if (on)
+   {
+      MFEM_ABORT("node-aware mode requires an MPI version >= 3");
+   }
+#endif
 }
 
 void GroupCommunicator::Create(const Array<int> &ldof_group)
@@ -585,6 +742,60 @@ void GroupCommunicator::GetNeighborLDofTable(Table &nbr_ldof) const
    nbr_ldof.ShiftUpI();
 }
 
+const Array<int> &GroupCommunicator::GetBcastDofMap(int layout, bool send) const
+{
+   Array<int> &map = bcast_dof_map[send][layout];
+   if (map.Size() == group_buf_size) { return map; }
+
+   // Mirror the buffer traversal of BcastBegin()/BcastEnd() in byNeighbor
+   // mode: for each neighbor, first the send groups, then the recv groups,
+   // with the dofs of each group ordered as in CopyGroupToBuffer().
+   map.SetSize(group_buf_size);
+   map = -1;
+   int offset = 0;
+   for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+   {
+      const int num_send_groups = nbr_send_groups.RowSize(nbr);
+      const int *send_list = nbr_send_groups.GetRow(nbr);
+      for (int i = 0; i < num_send_groups; i++)
+      {
+         const int gr = send_list[i];
+         const int nldofs = group_ldof.RowSize(gr);
+         if (send)
+         {
+            const int *dofs = (layout == 2) ? group_ltdof.GetRow(gr) :
+                              group_ldof.GetRow(gr);
+            for (int j = 0; j < nldofs; j++)
+            {
+               map[offset + j] = (layout == 1) ? group_ldof.GetI()[gr] + j :
+                                 dofs[j];
+            }
+         }
+         offset += nldofs;
+      }
+      const int num_recv_groups = nbr_recv_groups.RowSize(nbr);
+      const int *recv_list = nbr_recv_groups.GetRow(nbr);
+      for (int i = 0; i < num_recv_groups; i++)
+      {
+         const int gr = recv_list[i];
+         const int nldofs = group_ldof.RowSize(gr);
+         if (!send)
+         {
+            const int *dofs = (layout == 2) ? group_ltdof.GetRow(gr) :
+                              group_ldof.GetRow(gr);
+            for (int j = 0; j < nldofs; j++)
+            {
+               map[offset + j] = (layout == 1) ? group_ldof.GetI()[gr] + j :
+                                 dofs[j];
+            }
+         }
+         offset += nldofs;
+      }
+   }
+   MFEM_ASSERT(offset == group_buf_size, "");
+   return map;
+}
+
 template <class T>
 T *GroupCommunicator::CopyGroupToBuffer(const T *ldata, T *buf, int group,
                                         int layout) const
@@ -698,7 +909,9 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 {
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // In node-aware mode the node barriers below must be posted even when
+   // this rank has nothing to communicate.
+   if (group_buf_size == 0 && !node_aware) { return; }
 
    int request_counter = 0;
    switch (mode)
@@ -708,7 +921,7 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
          T *buf;
          if (layout != 1)
          {
-            group_buf.SetSize(group_buf_size*sizeof(T));
+            group_buf.SetSize(group_buf_size*sizeof(T), GetBufferMemoryType());
             buf = (T *)group_buf.GetData();
             MFEM_VERIFY(layout != 2 || group_ltdof.Size() == group_ldof.Size(),
                         "'group_ltdof' is not set, use SetLTDofTable()");
@@ -768,8 +981,31 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
-         group_buf.SetSize(group_buf_size*sizeof(T));
-         T *buf = (T *)group_buf.GetData();
+         // Before repacking any shared window segment, make sure all node
+         // ranks are done reading the data of the previous exchange.
+         if (node_aware) { WaitNodeBarrier(); }
+         group_buf.SetSize(group_buf_size*sizeof(T), GetBufferMemoryType());
+         T *buf;
+         if (buf_on_device)
+         {
+            // Pack all send positions with one device kernel; the receive
+            // positions are skipped through their map entries of -1.
+            const int *d_map = GetBcastDofMap(layout, true).Read();
+            T *d_buf = (T*)mfem::Write(group_buf.GetMemory(), group_buf.Size());
+            const T *d_ldata = ldata;
+            MFEM_FORALL(i, group_buf_size,
+            {
+               const int j = d_map[i];
+               if (j >= 0) { d_buf[i] = d_ldata[j]; }
+            });
+            // Bring the packed buffer to the (pinned) host for MPI.
+            buf = (T*)mfem::HostReadWrite(group_buf.GetMemory(),
+                                          group_buf.Size());
+         }
+         else
+         {
+            buf = (T *)group_buf.GetData();
+         }
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
             const int num_send_groups = nbr_send_groups.RowSize(nbr);
@@ -780,19 +1016,47 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
                //    need to copy the data in order to send it.
                T *buf_start = buf;
                const int *grp_list = nbr_send_groups.GetRow(nbr);
-               for (int i = 0; i < num_send_groups; i++)
+               const bool nbr_on_node = node_aware && nbr_node_rank[nbr] >= 0;
+               if (nbr_on_node)
                {
-                  buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+                  // Pack directly into this rank's segment of the shared
+                  // window; the neighbor reads it in BcastEnd().
+                  T *wbuf = (T*)(void*)node_win_base +
+                            win_send_offset[0][nbr];
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     wbuf = CopyGroupToBuffer(ldata, wbuf, grp_list[i],
+                                              layout);
+                  }
+               }
+               if (buf_on_device || nbr_on_node)
+               {
+                  // group_buf is not used for this neighbor; just advance
+                  // past its chunk to keep the buffer offsets intact
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     buf += group_ldof.RowSize(grp_list[i]);
+                  }
+               }
+               else
+               {
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+                  }
+               }
+               if (!nbr_on_node)
+               {
+                  MPI_Isend(buf_start,
+                            buf - buf_start,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            40822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+                  request_marker[request_counter] = -1; // mark as send req.
+                  request_counter++;
                }
-               MPI_Isend(buf_start,
-                         buf - buf_start,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         40822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
-               request_marker[request_counter] = -1; // mark as send request
-               request_counter++;
             }
 
             const int num_recv_groups = nbr_recv_groups.RowSize(nbr);
@@ -808,20 +1072,25 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
                {
                   recv_size += group_ldof.RowSize(grp_list[i]);
                }
-               MPI_Irecv(buf,
-                         recv_size,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         40822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
-               request_marker[request_counter] = nbr;
-               request_counter++;
+               if (!(node_aware && nbr_node_rank[nbr] >= 0))
+               {
+                  MPI_Irecv(buf,
+                            recv_size,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            40822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+                  request_marker[request_counter] = nbr;
+                  request_counter++;
+               }
                buf_offsets[nbr] = buf - (T*)group_buf.GetData();
                buf += recv_size;
             }
          }
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
+         // Signal that this rank's shared window segment is ready.
+         if (node_aware) { PostNodeBarrier(); }
          break;
       }
    }
@@ -865,6 +1134,23 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
+         if (buf_on_device)
+         {
+            MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+            // The host buffer was filled by MPI; unpack all receive positions
+            // with one device kernel, skipping the send positions through
+            // their map entries of -1.
+            const int *d_map = GetBcastDofMap(layout, false).Read();
+            const T *d_buf = (const T*)mfem::Read(group_buf.GetMemory(),
+                                                  group_buf.Size());
+            T *d_ldata = ldata;
+            MFEM_FORALL(i, group_buf_size,
+            {
+               const int j = d_map[i];
+               if (j >= 0) { d_ldata[j] = d_buf[i]; }
+            });
+            break;
+         }
          // copy the received data from the buffer to ldata, as it arrives
          int idx;
          while (MPI_Waitany(num_requests, requests, &idx, MPI_STATUS_IGNORE),
@@ -884,6 +1170,32 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
                }
             }
          }
+         if (node_aware)
+         {
+            // All node ranks have packed their windows once the barrier
+            // posted in BcastBegin() completes; read the chunks destined to
+            // this rank directly from the neighbors' segments.
+            WaitNodeBarrier();
+            for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+            {
+               if (nbr_node_rank[nbr] < 0) { continue; }
+               const int num_recv_groups = nbr_recv_groups.RowSize(nbr);
+               if (num_recv_groups > 0)
+               {
+                  const int *grp_list = nbr_recv_groups.GetRow(nbr);
+                  const T *buf = (const T*)(void*)nbr_win_base[nbr] +
+                                 win_recv_offset[0][nbr];
+                  for (int i = 0; i < num_recv_groups; i++)
+                  {
+                     buf = CopyGroupFromBuffer(buf, ldata, grp_list[i],
+                                               layout);
+                  }
+               }
+            }
+            // Let the neighbors know their segments can be reused; completed
+            // at the beginning of the next exchange.
+            PostNodeBarrier();
+         }
          break;
       }
    }
@@ -897,10 +1209,12 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
 {
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // In node-aware mode the node barriers below must be posted even when
+   // this rank has nothing to communicate.
+   if (group_buf_size == 0 && !node_aware) { return; }
 
    int request_counter = 0;
-   group_buf.SetSize(group_buf_size*sizeof(T));
+   group_buf.SetSize(group_buf_size*sizeof(T), GetBufferMemoryType());
    T *buf = (T *)group_buf.GetData();
    switch (mode)
    {
@@ -955,6 +1269,8 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
 
       case byNeighbor: // ***** Communication by neighbors *****
       {
+         // Wait for the node ranks to finish reading the previous exchange.
+         if (node_aware) { WaitNodeBarrier(); }
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
             // In Reduce operation: send_groups <--> recv_groups
@@ -963,20 +1279,41 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
             {
                T *buf_start = buf;
                const int *grp_list = nbr_recv_groups.GetRow(nbr);
-               for (int i = 0; i < num_send_groups; i++)
+               const bool nbr_on_node = node_aware && nbr_node_rank[nbr] >= 0;
+               if (nbr_on_node)
                {
-                  const int layout = 0; // ldata is an array on all ldofs
-                  buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+                  // Pack directly into this rank's segment of the shared
+                  // window; the neighbor reads it in ReduceEnd().
+                  T *wbuf = (T*)(void*)node_win_base +
+                            win_send_offset[1][nbr];
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     const int layout = 0; // ldata is an array on all ldofs
+                     wbuf = CopyGroupToBuffer(ldata, wbuf, grp_list[i],
+                                              layout);
+                  }
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     buf += group_ldof.RowSize(grp_list[i]);
+                  }
+               }
+               else
+               {
+                  for (int i = 0; i < num_send_groups; i++)
+                  {
+                     const int layout = 0; // ldata is an array on all ldofs
+                     buf = CopyGroupToBuffer(ldata, buf, grp_list[i], layout);
+                  }
+                  MPI_Isend(buf_start,
+                            buf - buf_start,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            43822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+                  request_marker[request_counter] = -1; // mark as send req.
+                  request_counter++;
                }
-               MPI_Isend(buf_start,
-                         buf - buf_start,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         43822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
-               request_marker[request_counter] = -1; // mark as send request
-               request_counter++;
             }
 
             // In Reduce operation: send_groups <--> recv_groups
@@ -989,20 +1326,25 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
                {
                   recv_size += group_ldof.RowSize(grp_list[i]);
                }
-               MPI_Irecv(buf,
-                         recv_size,
-                         MPITypeMap<T>::mpi_type,
-                         gtopo.GetNeighborRank(nbr),
-                         43822,
-                         gtopo.GetComm(),
-                         &requests[request_counter]);
-               request_marker[request_counter] = nbr;
-               request_counter++;
+               if (!(node_aware && nbr_node_rank[nbr] >= 0))
+               {
+                  MPI_Irecv(buf,
+                            recv_size,
+                            MPITypeMap<T>::mpi_type,
+                            gtopo.GetNeighborRank(nbr),
+                            43822,
+                            gtopo.GetComm(),
+                            &requests[request_counter]);
+                  request_marker[request_counter] = nbr;
+                  request_counter++;
+               }
                buf_offsets[nbr] = buf - (T*)group_buf.GetData();
                buf += recv_size;
             }
          }
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
+         // Signal that this rank's shared window segment is ready.
+         if (node_aware) { PostNodeBarrier(); }
          break;
       }
    }
@@ -1057,6 +1399,9 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
       case byNeighbor: // ***** Communication by neighbors *****
       {
          MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
+         // All node ranks have packed their windows once the barrier posted
+         // in ReduceBegin() completes.
+         if (node_aware) { WaitNodeBarrier(); }
 
          for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
          {
@@ -1065,7 +1410,17 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
             if (num_recv_groups > 0)
             {
                const int *grp_list = nbr_send_groups.GetRow(nbr);
-               const T *buf = (T*)group_buf.GetData() + buf_offsets[nbr];
+               const T *buf;
+               if (node_aware && nbr_node_rank[nbr] >= 0)
+               {
+                  // read directly from the neighbor's window segment
+                  buf = (const T*)(void*)nbr_win_base[nbr] +
+                        win_recv_offset[1][nbr];
+               }
+               else
+               {
+                  buf = (T*)group_buf.GetData() + buf_offsets[nbr];
+               }
                for (int i = 0; i < num_recv_groups; i++)
                {
                   buf = ReduceGroupFromBuffer(buf, ldata, grp_list[i],
@@ -1073,6 +1428,9 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
                }
             }
          }
+         // Let the neighbors know their segments can be reused; completed at
+         // the beginning of the next exchange.
+         if (node_aware) { PostNodeBarrier(); }
          break;
       }
    }
@@ -1277,6 +1635,7 @@ void GroupCommunicator::PrintInfo(std::ostream &out) const
 
 GroupCommunicator::~GroupCommunicator()
 {
+   if (node_aware) { SetNodeAware(false); }
    delete [] buf_offsets;
    delete [] request_marker;
    // delete [] statuses;
@@ -1421,6 +1780,159 @@ MPI_Comm ReorderRanksZCurve(MPI_Comm comm)
 }
 #endif // __bgq__
 
+// Rank-to-file partition used by AggregatedWrite/AggregatedRead: ranks are
+// split into contiguous, nearly equal groups, one group per file.
+static int AggFileId(int rank, int nranks, int nfiles)
+{
+   return (int)(((long)rank*nfiles)/nranks);
+}
+
+static int AggFirstRank(int file_id, int nranks, int nfiles)
+{
+   // smallest rank r with AggFileId(r) == file_id
+   return (int)(((long)file_id*nranks + nfiles - 1)/nfiles);
+}
+
+static std::string AggFileName(const std::string &fname_prefix, int file_id,
+                               int pad_digits)
+{
+   std::ostringstream fname;
+   fname << fname_prefix << '.' << std::setfill('0') << std::setw(pad_digits)
+         << file_id;
+   return fname.str();
+}
+
+static const char agg_file_header[] = "MFEM aggregated file v1.0\n";
+
+// Largest per-call transfer: keep the MPI count argument well below INT_MAX.
+static const MPI_Offset agg_chunk_size = 1 << 30;
+
+void AggregatedWrite(MPI_Comm comm, const std::string &fname_prefix,
+                     int num_files, const std::string &data, int pad_digits)
+{
+   int rank, nranks;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &nranks);
+   num_files = std::min(std::max(num_files, 1), nranks);
+
+   const int file_id = AggFileId(rank, nranks, num_files);
+   MPI_Comm fcomm;
+   MPI_Comm_split(comm, file_id, rank, &fcomm);
+   int frank, fsize;
+   MPI_Comm_rank(fcomm, &frank);
+   MPI_Comm_size(fcomm, &fsize);
+
+   long my_size = (long)data.size();
+   Array<long> sizes(fsize);
+   MPI_Allgather(&my_size, 1, MPI_LONG, sizes.GetData(), 1, MPI_LONG, fcomm);
+
+   const MPI_Offset header_size =
+      (MPI_Offset)strlen(agg_file_header) + 2*sizeof(int)
+      + fsize*sizeof(long);
+   MPI_Offset offset = header_size;
+   for (int i = 0; i < frank; i++) { offset += sizes[i]; }
+
+   const std::string fname = AggFileName(fname_prefix, file_id, pad_digits);
+   MPI_File fh;
+   int err = MPI_File_open(fcomm, fname.c_str(),
+                           MPI_MODE_CREATE | MPI_MODE_WRONLY,
+                           MPI_INFO_NULL, &fh);
+   MFEM_VERIFY(err == MPI_SUCCESS, "error opening file: " << fname);
+   MPI_File_set_size(fh, 0); // truncate a pre-existing file
+
+   if (frank == 0)
+   {
+      std::ostringstream header;
+      header << agg_file_header;
+      const int first_rank = AggFirstRank(file_id, nranks, num_files);
+      header.write((const char*)&fsize, sizeof(int));
+      header.write((const char*)&first_rank, sizeof(int));
+      header.write((const char*)sizes.GetData(), fsize*sizeof(long));
+      const std::string hdr = header.str();
+      MPI_File_write_at(fh, 0, hdr.data(), (int)hdr.size(), MPI_BYTE,
+                        MPI_STATUS_IGNORE);
+   }
+
+   // All ranks of the group must make the same number of collective calls.
+   long rounds = (my_size + agg_chunk_size - 1)/agg_chunk_size;
+   MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, MPI_LONG, MPI_MAX, fcomm);
+   MPI_Offset written = 0;
+   for (long r = 0; r < rounds; r++)
+   {
+      const int count = (int)std::min((MPI_Offset)my_size - written,
+                                      agg_chunk_size);
+      MPI_File_write_at_all(fh, offset + written, data.data() + written,
+                            std::max(count, 0), MPI_BYTE, MPI_STATUS_IGNORE);
+      written += std::max(count, 0);
+   }
+
+   MPI_File_close(&fh);
+   MPI_Comm_free(&fcomm);
+}
+
+void AggregatedRead(MPI_Comm comm, const std::string &fname_prefix,
+                    int num_files, std::string &data, int pad_digits)
+{
+   int rank, nranks;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &nranks);
+   num_files = std::min(std::max(num_files, 1), nranks);
+
+   const int file_id = AggFileId(rank, nranks, num_files);
+   MPI_Comm fcomm;
+   MPI_Comm_split(comm, file_id, rank, &fcomm);
+   int frank, fsize;
+   MPI_Comm_rank(fcomm, &frank);
+   MPI_Comm_size(fcomm, &fsize);
+
+   const std::string fname = AggFileName(fname_prefix, file_id, pad_digits);
+   MPI_File fh;
+   int err = MPI_File_open(fcomm, fname.c_str(), MPI_MODE_RDONLY,
+                           MPI_INFO_NULL, &fh);
+   MFEM_VERIFY(err == MPI_SUCCESS, "error opening file: " << fname);
+
+   // Every rank reads the (small) header to learn its chunk offset and size.
+   const int magic_len = (int)strlen(agg_file_header);
+   const MPI_Offset header_size =
+      (MPI_Offset)magic_len + 2*sizeof(int) + fsize*sizeof(long);
+   std::string header((size_t)header_size, '\0');
+   MPI_File_read_at(fh, 0, &header[0], (int)header_size, MPI_BYTE,
+                    MPI_STATUS_IGNORE);
+   MFEM_VERIFY(header.compare(0, magic_len, agg_file_header) == 0,
+               "invalid aggregated file: " << fname);
+   int file_fsize, file_first_rank;
+   memcpy(&file_fsize, &header[magic_len], sizeof(int));
+   memcpy(&file_first_rank, &header[magic_len + sizeof(int)], sizeof(int));
+   MFEM_VERIFY(file_fsize == fsize &&
+               file_first_rank == AggFirstRank(file_id, nranks, num_files),
+               "aggregated file " << fname << " was written by a different"
+               " rank/file decomposition");
+   Array<long> sizes(fsize);
+   memcpy(sizes.GetData(), &header[magic_len + 2*sizeof(int)],
+          fsize*sizeof(long));
+
+   MPI_Offset offset = header_size;
+   for (int i = 0; i < frank; i++) { offset += sizes[i]; }
+   const long my_size = sizes[frank];
+   data.resize((size_t)my_size);
+
+   long rounds = (my_size + agg_chunk_size - 1)/agg_chunk_size;
+   MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, MPI_LONG, MPI_MAX, fcomm);
+   MPI_Offset done = 0;
+   for (long r = 0; r < rounds; r++)
+   {
+      const int count = (int)std::min((MPI_Offset)my_size - done,
+                                      agg_chunk_size);
+      MPI_File_read_at_all(fh, offset + done,
+                           my_size ? &data[0] + done : NULL,
+                           std::max(count, 0), MPI_BYTE, MPI_STATUS_IGNORE);
+      done += std::max(count, 0);
+   }
+
+   MPI_File_close(&fh);
+   MPI_Comm_free(&fcomm);
+}
+
 } // namespace mfem
 
 #endif
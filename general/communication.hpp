@@ -21,6 +21,7 @@
 #include "sets.hpp"
 #include "globals.hpp"
 #include <mpi.h>
+#include <string>
 
 
 namespace mfem
@@ -165,6 +166,39 @@ protected:
    int *request_marker;
    int *buf_offsets; // size = max(number of groups, number of neighbors)
    Table nbr_send_groups, nbr_recv_groups; // nbr 0 = me
+   bool buf_on_device;
+   /** Flattened buffer-position to ldof maps used by the device pack/unpack
+       kernels in byNeighbor mode: index [1] is for sending, [0] for receiving,
+       with one map per data layout, see CopyGroupToBuffer(). Positions that
+       belong to the opposite direction are marked with -1. */
+   mutable Array<int> bcast_dof_map[2][3];
+
+   /** @brief Return the buffer-position to ldof map for the given @a layout
+       and direction (@a send = true/false), building it on first use. */
+   const Array<int> &GetBcastDofMap(int layout, bool send) const;
+
+   /** Node-aware two-level communication, see SetNodeAware(): intra-node
+       neighbors exchange their aggregated per-neighbor chunks through an
+       MPI-3 shared memory window instead of point-to-point messages. */
+   bool node_aware;
+   MPI_Comm node_comm; // the ranks of gtopo.GetComm() on this compute node
+   MPI_Win node_win;   // shared window holding this rank's send chunks
+   char *node_win_base;        // local segment of node_win
+   Array<int> nbr_node_rank;   // rank in node_comm, or -1 for remote nbrs
+   Array<char*> nbr_win_base;  // window segments of the intra-node nbrs
+   /** Offsets (in elements) of the aggregated chunks inside the windows,
+       indexed [0] for broadcast and [1] for reduce: win_send_offset is the
+       start of this rank's chunk for a neighbor inside its own window, and
+       win_recv_offset the start, inside the neighbor's window, of the chunk
+       destined to this rank. */
+   Array<int> win_send_offset[2], win_recv_offset[2];
+   mutable MPI_Request node_barrier; // pending MPI_Ibarrier on node_comm
+   mutable bool node_barrier_pending;
+
+   /// Complete the pending non-blocking node barrier, if any.
+   void WaitNodeBarrier() const;
+   /// Start a non-blocking barrier over node_comm.
+   void PostNodeBarrier() const;
 
 public:
    /// Construct a GroupCommunicator object.
@@ -201,6 +235,35 @@ public:
    /// Get a const reference to the associated GroupTopology object
    const GroupTopology &GetGroupTopology() const { return gtopo; }
 
+   /** @brief Enable or disable device-side packing and unpacking of the
+       communication buffers; supported in byNeighbor mode only. */
+   /** When enabled, the @a ldata arrays passed to BcastBegin() and BcastEnd()
+       must be device pointers obtained through Read(), Write(), or
+       ReadWrite(), and the buffers are packed and unpacked with device
+       kernels driven by the group Table layouts; the MPI staging copies go
+       through page-locked host memory, see GetBufferMemoryType(). The
+       Reduce*() methods always pack and unpack on the host, since the
+       reduction operations are host function pointers. */
+   void UseDevice(bool on = true) { buf_on_device = on; }
+
+   /** @brief Return the MemoryType used for the communication buffers:
+       page-locked (pinned) host memory when a device backend is enabled, and
+       the default host memory type otherwise. */
+   static MemoryType GetBufferMemoryType();
+
+   /** @brief Enable or disable the node-aware two-level exchange mode;
+       supported in byNeighbor mode only and requires MPI version >= 3. */
+   /** When enabled, the aggregated chunks exchanged with neighbors residing
+       on the same compute node are routed through an MPI-3 shared memory
+       window instead of point-to-point messages: each rank packs its
+       intra-node chunks into its own window segment and the destination
+       ranks read them directly, with a pair of non-blocking node barriers
+       keeping consecutive exchanges ordered. Inter-node neighbors keep using
+       one aggregated message per neighbor. Must be called collectively over
+       all ranks of the communicator, after Finalize(); cannot be combined
+       with UseDevice(). */
+   void SetNodeAware(bool on = true);
+
    /// Dofs to be sent to communication neighbors
    void GetNeighborLTDofTable(Table &nbr_ltdof) const;
 
@@ -508,6 +571,30 @@ template<> struct MPITypeMap<double> { static const MPI_Datatype mpi_type; };
 MPI_Comm ReorderRanksZCurve(MPI_Comm comm);
 
 
+/** @brief Write each rank's buffer @a data into one of @a num_files aggregate
+    files using MPI-IO collective writes.
+
+    The ranks of @a comm are split into @a num_files contiguous groups (the
+    value is clamped to [1, number of ranks]); group g writes the file
+    "<fname_prefix>.<g>" with the group-id zero-padded to @a pad_digits. Each
+    file starts with a small header (format line, group size, first rank, and
+    the per-rank chunk sizes) followed by the rank chunks in rank order, so at
+    16k ranks the file system sees @a num_files creates instead of 16k. The
+    chunks are written with matched collective calls, chunked to stay below
+    the 2 GB count limit of MPI-IO. Reload with AggregatedRead() on the same
+    number of ranks and files. */
+void AggregatedWrite(MPI_Comm comm, const std::string &fname_prefix,
+                     int num_files, const std::string &data,
+                     int pad_digits = 6);
+
+/** @brief Read back this rank's chunk from aggregate files written by
+    AggregatedWrite() with the same @a num_files on the same number of ranks.
+
+    Aborts if the file headers do not match the calling decomposition. */
+void AggregatedRead(MPI_Comm comm, const std::string &fname_prefix,
+                    int num_files, std::string &data, int pad_digits = 6);
+
+
 } // namespace mfem
 
 #endif
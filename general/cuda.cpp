@@ -61,6 +61,21 @@ void* CuMallocManaged(void** dptr, size_t bytes)
    return *dptr;
 }
 
+void* CuMemAllocHostPinned(void **ptr, size_t bytes)
+{
+#ifdef MFEM_USE_CUDA
+#ifdef MFEM_TRACK_CUDA_MEM
+   mfem::out << "CuMemAllocHostPinned(): allocating " << bytes << " bytes ... "
+             << std::flush;
+#endif
+   MFEM_GPU_CHECK(cudaMallocHost(ptr, bytes));
+#ifdef MFEM_TRACK_CUDA_MEM
+   mfem::out << "done: " << *ptr << std::endl;
+#endif
+#endif
+   return *ptr;
+}
+
 void* CuMemFree(void *dptr)
 {
 #ifdef MFEM_USE_CUDA
@@ -76,6 +91,21 @@ void* CuMemFree(void *dptr)
    return dptr;
 }
 
+void* CuMemFreeHostPinned(void *ptr)
+{
+#ifdef MFEM_USE_CUDA
+#ifdef MFEM_TRACK_CUDA_MEM
+   mfem::out << "CuMemFreeHostPinned(): deallocating memory @ " << ptr
+             << " ... " << std::flush;
+#endif
+   MFEM_GPU_CHECK(cudaFreeHost(ptr));
+#ifdef MFEM_TRACK_CUDA_MEM
+   mfem::out << "done." << std::endl;
+#endif
+#endif
+   return ptr;
+}
+
 void* CuMemcpyHtoD(void* dst, const void* src, size_t bytes)
 {
 #ifdef MFEM_USE_CUDA
@@ -161,4 +191,137 @@ int CuGetDeviceCount()
    return num_gpus;
 }
 
+// The CUDA graph API (stream capture) was introduced in CUDA 10 and the
+// capture modes used below in CUDA 10.1.
+#if defined(MFEM_USE_CUDA) && CUDART_VERSION >= 10010
+#define MFEM_USE_CUDA_GRAPHS
+#endif
+
+#ifdef MFEM_USE_CUDA_GRAPHS
+// Capture cannot use the default (legacy) stream, so while it is active the
+// kernel launches in CuWrap1D/2D/3D are redirected to this stream through
+// CuKernelStream().
+static cudaStream_t capture_stream = NULL;
+static bool capture_active = false;
+#endif
+
+// Stream pool and event pool used by the tag-based multi-stream interface;
+// entries are created on first use.
+static int stream_tag = 0;
+#ifdef MFEM_USE_CUDA
+static cudaStream_t stream_pool[MFEM_CUDA_STREAMS] = { NULL };
+static cudaEvent_t event_pool[MFEM_CUDA_EVENTS] = { NULL };
+
+static cudaStream_t CuPoolStream(int tag)
+{
+   if (tag == 0) { return NULL; }
+   cudaStream_t &stream = stream_pool[tag-1];
+   if (stream == NULL) { MFEM_GPU_CHECK(cudaStreamCreate(&stream)); }
+   return stream;
+}
+#endif
+
+void* CuKernelStream()
+{
+#ifdef MFEM_USE_CUDA_GRAPHS
+   if (capture_active) { return capture_stream; }
+#endif
+#ifdef MFEM_USE_CUDA
+   return CuPoolStream(stream_tag);
+#else
+   return NULL;
+#endif
+}
+
+void CuSetStreamTag(int tag)
+{
+   MFEM_VERIFY(0 <= tag && tag <= MFEM_CUDA_STREAMS, "invalid stream tag!");
+   stream_tag = tag;
+}
+
+int CuGetStreamTag()
+{
+   return stream_tag;
+}
+
+void CuStreamSync()
+{
+#ifdef MFEM_USE_CUDA
+   MFEM_GPU_CHECK(cudaStreamSynchronize(CuPoolStream(stream_tag)));
+#endif
+}
+
+void CuEventRecord(int event)
+{
+   MFEM_VERIFY(0 <= event && event < MFEM_CUDA_EVENTS, "invalid event!");
+#ifdef MFEM_USE_CUDA
+   cudaEvent_t &ev = event_pool[event];
+   if (ev == NULL)
+   {
+      MFEM_GPU_CHECK(cudaEventCreateWithFlags(&ev, cudaEventDisableTiming));
+   }
+   MFEM_GPU_CHECK(cudaEventRecord(ev, CuPoolStream(stream_tag)));
+#endif
+}
+
+void CuEventWait(int event)
+{
+   MFEM_VERIFY(0 <= event && event < MFEM_CUDA_EVENTS, "invalid event!");
+#ifdef MFEM_USE_CUDA
+   cudaEvent_t ev = event_pool[event];
+   MFEM_VERIFY(ev != NULL, "event " << event << " has not been recorded!");
+   MFEM_GPU_CHECK(cudaStreamWaitEvent(CuPoolStream(stream_tag), ev, 0));
+#endif
+}
+
+void CuGraphBeginCapture()
+{
+#ifdef MFEM_USE_CUDA_GRAPHS
+   if (capture_stream == NULL)
+   {
+      MFEM_GPU_CHECK(cudaStreamCreate(&capture_stream));
+   }
+   MFEM_GPU_CHECK(cudaStreamBeginCapture(capture_stream,
+                                         cudaStreamCaptureModeThreadLocal));
+   capture_active = true;
+#else
+   MFEM_ABORT("CUDA >= 10.1 is required for graph capture!");
+#endif
+}
+
+void* CuGraphEndCapture()
+{
+#ifdef MFEM_USE_CUDA_GRAPHS
+   capture_active = false;
+   cudaGraph_t graph = NULL;
+   MFEM_GPU_CHECK(cudaStreamEndCapture(capture_stream, &graph));
+   cudaGraphExec_t graph_exec = NULL;
+   MFEM_GPU_CHECK(cudaGraphInstantiate(&graph_exec, graph, NULL, NULL, 0));
+   MFEM_GPU_CHECK(cudaGraphDestroy(graph));
+   return graph_exec;
+#else
+   MFEM_ABORT("CUDA >= 10.1 is required for graph capture!");
+   return NULL;
+#endif
+}
+
+void CuGraphLaunch(void *graph_exec)
+{
+#ifdef MFEM_USE_CUDA_GRAPHS
+   MFEM_GPU_CHECK(cudaGraphLaunch((cudaGraphExec_t)graph_exec, NULL));
+#else
+   MFEM_CONTRACT_VAR(graph_exec);
+   MFEM_ABORT("CUDA >= 10.1 is required for graph capture!");
+#endif
+}
+
+void CuGraphDestroy(void *graph_exec)
+{
+#ifdef MFEM_USE_CUDA_GRAPHS
+   MFEM_GPU_CHECK(cudaGraphExecDestroy((cudaGraphExec_t)graph_exec));
+#else
+   MFEM_CONTRACT_VAR(graph_exec);
+#endif
+}
+
 } // namespace mfem
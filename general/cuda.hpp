@@ -18,6 +18,13 @@
 // CUDA block size used by MFEM.
 #define MFEM_CUDA_BLOCKS 256
 
+// Number of streams in the CUDA stream pool used by MFEM, see CuSetStreamTag().
+#define MFEM_CUDA_STREAMS 8
+
+// Number of events available for cross-stream dependencies, see CuEventRecord()
+// and CuEventWait().
+#define MFEM_CUDA_EVENTS 32
+
 #ifdef MFEM_USE_CUDA
 #define MFEM_DEVICE __device__
 #define MFEM_LAMBDA __host__
@@ -63,9 +70,15 @@ void* CuMemAlloc(void **d_ptr, size_t bytes);
 /// Allocates managed device memory
 void* CuMallocManaged(void **d_ptr, size_t bytes);
 
+/// Allocates page-locked (pinned) host memory
+void* CuMemAllocHostPinned(void **ptr, size_t bytes);
+
 /// Frees device memory and returns destination ptr.
 void* CuMemFree(void *d_ptr);
 
+/// Frees page-locked (pinned) host memory and returns destination ptr.
+void* CuMemFreeHostPinned(void *ptr);
+
 /// Copies memory from Host to Device and returns destination ptr.
 void* CuMemcpyHtoD(void *d_dst, const void *h_src, size_t bytes);
 
@@ -87,6 +100,51 @@ void* CuMemcpyDtoHAsync(void *h_dst, const void *d_src, size_t bytes);
 /// Check the error code returned by cudaGetLastError(), aborting on error.
 void CuCheckLastError();
 
+/** @brief Return the CUDA stream (as an opaque pointer) on which MFEM kernels
+    are launched: the internal capture stream while a CUDA graph capture is
+    active, otherwise the pool stream selected with CuSetStreamTag() — the
+    default stream (NULL) for tag 0. */
+void* CuKernelStream();
+
+/** @brief Select the CUDA stream used for subsequent MFEM kernel launches.
+    Tag 0, the initial setting, is the default stream; tags 1 to
+    #MFEM_CUDA_STREAMS select streams from an internal pool created on first
+    use. */
+/** Kernels launched with different tags may execute concurrently; use
+    CuEventRecord() and CuEventWait() to order them where one depends on the
+    output of another. The default stream keeps its legacy semantics, i.e. it
+    synchronizes with all pool streams, so host-visible copies and kernels on
+    tag 0 remain ordered with respect to the pool. */
+void CuSetStreamTag(int tag);
+
+/// Return the stream tag set with CuSetStreamTag().
+int CuGetStreamTag();
+
+/// Synchronize the host with the stream selected with CuSetStreamTag().
+void CuStreamSync();
+
+/** @brief Record event @a event (0 to #MFEM_CUDA_EVENTS-1) on the stream
+    selected with CuSetStreamTag(). */
+void CuEventRecord(int event);
+
+/** @brief Make the stream selected with CuSetStreamTag() wait for the last
+    recording of event @a event, without blocking the host. */
+void CuEventWait(int event);
+
+/// Start capturing subsequent MFEM kernel launches into a CUDA graph.
+/** Requires CUDA >= 10.1; aborts when the graph API is not available. */
+void CuGraphBeginCapture();
+
+/** @brief End the capture started with CuGraphBeginCapture() and return the
+    instantiated executable graph (as an opaque pointer). */
+void* CuGraphEndCapture();
+
+/// Launch the executable graph returned by CuGraphEndCapture().
+void CuGraphLaunch(void *graph_exec);
+
+/// Destroy the executable graph returned by CuGraphEndCapture().
+void CuGraphDestroy(void *graph_exec);
+
 /// Get the number of CUDA devices
 int CuGetDeviceCount();
 
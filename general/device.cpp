@@ -18,6 +18,7 @@
 #include <unordered_map>
 #include <string>
 #include <map>
+#include <cstdlib> // getenv, atoi, for the rank-to-GPU affinity
 
 namespace mfem
 {
@@ -345,16 +346,53 @@ void Device::Enable()
    Get().UpdateMemoryTypeAndClass();
 }
 
+#if defined(MFEM_USE_CUDA) || defined(MFEM_USE_HIP)
+/// Local (intra-node) rank of this process, read from the environment of the
+/// common MPI launchers; -1 when not running under a recognized launcher.
+/// Reading the environment instead of calling MPI keeps this usable before
+/// MPI_Init() and in non-MPI builds.
+static int GetLocalRank()
+{
+   const char *vars[] =
+   {
+      "OMPI_COMM_WORLD_LOCAL_RANK", "MV2_COMM_WORLD_LOCAL_RANK",
+      "MPI_LOCALRANKID", "SLURM_LOCALID", "PALS_LOCAL_RANKID"
+   };
+   for (unsigned v = 0; v < sizeof(vars)/sizeof(vars[0]); v++)
+   {
+      const char *env = getenv(vars[v]);
+      if (env) { return atoi(env); }
+   }
+   return -1;
+}
+
+/** Map this process to a GPU of the node. An explicitly requested nonzero
+    device id always wins; otherwise, when launched with several ranks per
+    node, the ranks are spread round-robin over the node's GPUs so each rank
+    talks to the GPU nearest to the socket its launcher pinned it to (the
+    launchers assign local ranks following the machine topology). Set
+    MFEM_DEVICE_AFFINITY=0 to disable the automatic mapping. */
+static int DeviceAffinity(const int dev, const int ngpu)
+{
+   if (dev != 0 || ngpu < 2) { return dev; }
+   const char *env = getenv("MFEM_DEVICE_AFFINITY");
+   if (env && !strcmp(env, "0")) { return dev; }
+   const int local_rank = GetLocalRank();
+   return (local_rank >= 0) ? local_rank % ngpu : dev;
+}
+#endif // MFEM_USE_CUDA || MFEM_USE_HIP
+
 #ifdef MFEM_USE_CUDA
-static void DeviceSetup(const int dev, int &ngpu)
+static void DeviceSetup(int &dev, int &ngpu)
 {
    ngpu = CuGetDeviceCount();
    MFEM_VERIFY(ngpu > 0, "No CUDA device found!");
+   dev = DeviceAffinity(dev, ngpu);
    MFEM_GPU_CHECK(cudaSetDevice(dev));
 }
 #endif
 
-static void CudaDeviceSetup(const int dev, int &ngpu)
+static void CudaDeviceSetup(int &dev, int &ngpu)
 {
 #ifdef MFEM_USE_CUDA
    DeviceSetup(dev, ngpu);
@@ -364,22 +402,20 @@ static void CudaDeviceSetup(const int dev, int &ngpu)
 #endif
 }
 
-static void HipDeviceSetup(const int dev, int &ngpu)
+static void HipDeviceSetup(int &dev, int &ngpu)
 {
 #ifdef MFEM_USE_HIP
-   int deviceId;
-   MFEM_GPU_CHECK(hipGetDevice(&deviceId));
-   hipDeviceProp_t props;
-   MFEM_GPU_CHECK(hipGetDeviceProperties(&props, deviceId));
-   MFEM_VERIFY(dev==deviceId,"");
-   ngpu = 1;
+   MFEM_GPU_CHECK(hipGetDeviceCount(&ngpu));
+   MFEM_VERIFY(ngpu > 0, "No HIP device found!");
+   dev = DeviceAffinity(dev, ngpu);
+   MFEM_GPU_CHECK(hipSetDevice(dev));
 #else
    MFEM_CONTRACT_VAR(dev);
    MFEM_CONTRACT_VAR(ngpu);
 #endif
 }
 
-static void RajaDeviceSetup(const int dev, int &ngpu)
+static void RajaDeviceSetup(int &dev, int &ngpu)
 {
 #ifdef MFEM_USE_CUDA
    if (ngpu <= 0) { DeviceSetup(dev, ngpu); }
@@ -392,6 +428,21 @@ static void RajaDeviceSetup(const int dev, int &ngpu)
 static void OccaDeviceSetup(const int dev)
 {
 #ifdef MFEM_USE_OCCA
+   // OCCA keeps a persistent on-disk cache of compiled kernels, keyed by the
+   // device mode and a hash of the kernel source and properties, in
+   // OCCA_CACHE_DIR (by default ~/.occa). The MFEM_OCCA_CACHE_DIR environment
+   // variable redirects that cache to a durable location, e.g. a shared
+   // filesystem, so kernels are not recompiled on every run. This has to be
+   // set before the first OCCA call initializes its environment.
+   const char *occa_cache_dir = getenv("MFEM_OCCA_CACHE_DIR");
+   if (occa_cache_dir)
+   {
+#ifndef _WIN32
+      setenv("OCCA_CACHE_DIR", occa_cache_dir, 1);
+#else
+      _putenv_s("OCCA_CACHE_DIR", occa_cache_dir);
+#endif
+   }
    const int cpu  = Device::Allows(Backend::OCCA_CPU);
    const int omp  = Device::Allows(Backend::OCCA_OMP);
    const int cuda = Device::Allows(Backend::OCCA_CUDA);
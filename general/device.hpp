@@ -14,6 +14,7 @@
 
 #include "globals.hpp"
 #include "mem_manager.hpp"
+#include "cuda.hpp"
 
 namespace mfem
 {
@@ -211,6 +212,10 @@ public:
          and evaluation of the operator and enables the 'cuda' backend to avoid
          transfer between host and device.
        * The 'debug' backend should not be combined with other device backends.
+       * With the default @a dev and several MPI ranks per node, each rank is
+         automatically mapped to one of the node's GPUs, round-robin over the
+         launcher-provided local rank; set MFEM_DEVICE_AFFINITY=0 to disable
+         the mapping and an explicit nonzero @a dev to override it.
    */
    void Configure(const std::string &device, const int dev = 0);
 
@@ -269,6 +274,63 @@ public:
 };
 
 
+/** @brief Capture and replay of a fixed sequence of device kernels as a single
+    CUDA graph. */
+/** With the CUDA backend enabled, the first call to Apply() runs the given
+    callback while recording the kernels it launches and instantiates the
+    recorded sequence as a CUDA graph; subsequent calls replay the graph with
+    one launch, eliminating the per-kernel launch latency. Typical use is to
+    wrap the kernel sequence of an Operator::Mult() that is applied many times,
+    e.g. inside an iterative solver.
+
+    The captured graph bakes in the device pointers, sizes and scalar
+    parameters seen during the recording, and the callback must consist of
+    device work only (kernel launches and asynchronous copies) — no host reads
+    of device data. Call Reset() to invalidate the recording whenever any of
+    the captured state changes, e.g. after a mesh or space update.
+
+    Without the CUDA backend, Apply() simply invokes the callback every time,
+    so code using this class remains valid on all backends. */
+class DeviceGraph
+{
+   void *graph_exec;
+
+public:
+   DeviceGraph() : graph_exec(NULL) { }
+
+   ~DeviceGraph() { Reset(); }
+
+   /// Return true if a kernel sequence has been captured.
+   bool Captured() const { return graph_exec != NULL; }
+
+   /// Invalidate the captured graph; the next Apply() captures again.
+   void Reset()
+   {
+      if (graph_exec) { CuGraphDestroy(graph_exec); graph_exec = NULL; }
+   }
+
+   /** @brief Execute @a body, capturing its kernel sequence on first use and
+       replaying the captured graph afterwards. */
+   template <typename BODY> void Apply(BODY &&body)
+   {
+      if (Device::Allows(Backend::CUDA))
+      {
+         if (!graph_exec)
+         {
+            // Kernels are recorded, not executed, during the capture; the
+            // graph launch below performs the actual first application.
+            CuGraphBeginCapture();
+            body();
+            graph_exec = CuGraphEndCapture();
+         }
+         CuGraphLaunch(graph_exec);
+         return;
+      }
+      body();
+   }
+};
+
+
 // Inline Memory access functions using the mfem::Device DeviceMemoryClass or
 // the mfem::Device HostMemoryClass.
 
@@ -17,6 +17,7 @@
 #include "backends.hpp"
 #include "device.hpp"
 #include "mem_manager.hpp"
+#include "tuner.hpp"
 #include "../linalg/dtensor.hpp"
 
 namespace mfem
@@ -39,11 +40,13 @@ const int MAX_Q1D = 14;
 // Implementation of MFEM's "parallel for" (forall) device/host kernel
 // interfaces supporting RAJA, CUDA, OpenMP, and sequential backends.
 
-// The MFEM_FORALL wrapper
+// The MFEM_FORALL wrapper; the source location identifies the launch site to
+// the launch-parameter autotuner, see KernelTuner in tuner.hpp.
 #define MFEM_FORALL(i,N,...)                             \
    ForallWrap<1>(true,N,                                 \
                  [=] MFEM_DEVICE (int i) {__VA_ARGS__},  \
-                 [&] MFEM_LAMBDA (int i) {__VA_ARGS__})
+                 [&] MFEM_LAMBDA (int i) {__VA_ARGS__},\
+                 0,0,0,__FILE__,__LINE__)
 
 // MFEM_FORALL with a 2D CUDA block
 #define MFEM_FORALL_2D(i,N,X,Y,BZ,...)                   \
@@ -65,7 +68,23 @@ const int MAX_Q1D = 14;
 #define MFEM_FORALL_SWITCH(use_dev,i,N,...)              \
    ForallWrap<1>(use_dev,N,                              \
                  [=] MFEM_DEVICE (int i) {__VA_ARGS__},  \
-                 [&] MFEM_LAMBDA (int i) {__VA_ARGS__})
+                 [&] MFEM_LAMBDA (int i) {__VA_ARGS__},\
+                 0,0,0,__FILE__,__LINE__)
+
+// The MFEM_REDUCE wrapper: sum-reduction over the range [0,N). The kernel
+// body must 'return' the contribution of index i; the sum of all the
+// contributions is assigned to 'res'. All backends are supported: on GPU the
+// contributions are folded with a shared-memory block reduction followed by
+// one atomic per block, with OpenMP the loop uses a 'reduction(+)' clause.
+#define MFEM_REDUCE(i,N,res,...)                                  \
+   res = ReduceWrap(true,N,                                       \
+                    [=] MFEM_DEVICE (int i) -> double {__VA_ARGS__}, \
+                    [&] MFEM_LAMBDA (int i) -> double {__VA_ARGS__})
+
+// Portable atomic update usable inside MFEM_FORALL bodies on all backends; it
+// expands to the AtomicAdd() function defined in backends.hpp and returns the
+// old value.
+#define MFEM_ATOMIC_ADD(ref,val) AtomicAdd(ref,val)
 
 
 /// OpenMP backend
@@ -85,6 +104,67 @@ void OmpWrap(const int N, HBODY &&h_body)
 #endif
 }
 
+/// OpenMP backend for the 2D and 3D forall variants. On the host, the blocked
+/// thread structure of the device kernels collapses into the per-element body:
+/// MFEM_THREAD_ID is 0 and the MFEM_FOREACH_THREAD loops run in full, with
+/// their iterations vectorized, see MFEM_FOREACH_THREAD in backends.hpp. The
+/// elements are distributed statically so each thread works on a contiguous
+/// tile of elements and keeps its basis tables in cache.
+template <typename HBODY>
+void OmpWrap2D(const int N, HBODY &&h_body,
+               const int /*X*/, const int /*Y*/, const int /*BZ*/)
+{
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for schedule(static)
+   for (int k = 0; k < N; k++)
+   {
+      h_body(k);
+   }
+#else
+   MFEM_CONTRACT_VAR(N);
+   MFEM_CONTRACT_VAR(h_body);
+   MFEM_ABORT("OpenMP requested for MFEM but OpenMP is not enabled!");
+#endif
+}
+
+/// OpenMP backend for the 3D forall variant, see OmpWrap2D().
+template <typename HBODY>
+void OmpWrap3D(const int N, HBODY &&h_body,
+               const int /*X*/, const int /*Y*/, const int /*Z*/)
+{
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for schedule(static)
+   for (int k = 0; k < N; k++)
+   {
+      h_body(k);
+   }
+#else
+   MFEM_CONTRACT_VAR(N);
+   MFEM_CONTRACT_VAR(h_body);
+   MFEM_ABORT("OpenMP requested for MFEM but OpenMP is not enabled!");
+#endif
+}
+
+/// OpenMP backend for the MFEM_REDUCE wrapper.
+template <typename HBODY>
+double OmpReduceSum(const int N, HBODY &&h_body)
+{
+#ifdef MFEM_USE_OPENMP
+   double sum = 0.0;
+   #pragma omp parallel for reduction(+:sum)
+   for (int k = 0; k < N; k++)
+   {
+      sum += h_body(k);
+   }
+   return sum;
+#else
+   MFEM_CONTRACT_VAR(N);
+   MFEM_CONTRACT_VAR(h_body);
+   MFEM_ABORT("OpenMP requested for MFEM but OpenMP is not enabled!");
+   return 0.0;
+#endif
+}
+
 
 /// RAJA Cuda backend
 #if defined(MFEM_USE_RAJA) && defined(RAJA_ENABLE_CUDA)
@@ -204,7 +284,18 @@ void CuWrap1D(const int N, DBODY &&d_body)
 {
    if (N==0) { return; }
    const int GRID = (N+BLCK-1)/BLCK;
-   CuKernel1D<<<GRID,BLCK>>>(N, d_body);
+   CuKernel1D<<<GRID,BLCK,0,(cudaStream_t)CuKernelStream()>>>(N, d_body);
+   MFEM_GPU_CHECK(cudaGetLastError());
+}
+
+/// Variant of CuWrap1D() with a runtime block size, used by the
+/// launch-parameter autotuner, see KernelTuner in tuner.hpp.
+template <typename DBODY>
+void CuWrap1D(const int N, DBODY &&d_body, const int BLCK)
+{
+   if (N==0) { return; }
+   const int GRID = (N+BLCK-1)/BLCK;
+   CuKernel1D<<<GRID,BLCK,0,(cudaStream_t)CuKernelStream()>>>(N, d_body);
    MFEM_GPU_CHECK(cudaGetLastError());
 }
 
@@ -216,7 +307,7 @@ void CuWrap2D(const int N, DBODY &&d_body,
    MFEM_VERIFY(BZ>0, "");
    const int GRID = (N+BZ-1)/BZ;
    const dim3 BLCK(X,Y,BZ);
-   CuKernel2D<<<GRID,BLCK>>>(N,d_body,BZ);
+   CuKernel2D<<<GRID,BLCK,0,(cudaStream_t)CuKernelStream()>>>(N,d_body,BZ);
    MFEM_GPU_CHECK(cudaGetLastError());
 }
 
@@ -227,10 +318,43 @@ void CuWrap3D(const int N, DBODY &&d_body,
    if (N==0) { return; }
    const int GRID = N;
    const dim3 BLCK(X,Y,Z);
-   CuKernel3D<<<GRID,BLCK>>>(N,d_body);
+   CuKernel3D<<<GRID,BLCK,0,(cudaStream_t)CuKernelStream()>>>(N,d_body);
    MFEM_GPU_CHECK(cudaGetLastError());
 }
 
+template <typename BODY> __global__ static
+void CuReduceSumKernel(const int N, double *sum, BODY body)
+{
+   __shared__ double s_sum[MFEM_CUDA_BLOCKS];
+   const int n = blockDim.x*blockIdx.x + threadIdx.x;
+   const int tid = threadIdx.x;
+   s_sum[tid] = (n < N) ? body(n) : 0.0;
+   for (int workers = blockDim.x>>1; workers > 0; workers >>= 1)
+   {
+      __syncthreads();
+      if (tid < workers) { s_sum[tid] += s_sum[tid+workers]; }
+   }
+   if (tid == 0) { AtomicAdd(*sum, s_sum[0]); }
+}
+
+template <typename DBODY>
+double CuReduceSum(const int N, DBODY &&d_body)
+{
+   double sum = 0.0;
+   if (N == 0) { return sum; }
+   const int BLCK = MFEM_CUDA_BLOCKS;
+   const int GRID = (N+BLCK-1)/BLCK;
+   double *d_sum = NULL;
+   CuMemAlloc((void**)&d_sum, sizeof(double));
+   CuMemcpyHtoD(d_sum, &sum, sizeof(double));
+   CuReduceSumKernel<<<GRID,BLCK,0,(cudaStream_t)CuKernelStream()>>>
+   (N, d_sum, d_body);
+   MFEM_GPU_CHECK(cudaGetLastError());
+   CuMemcpyDtoH(&sum, d_sum, sizeof(double));
+   CuMemFree(d_sum);
+   return sum;
+}
+
 #endif // MFEM_USE_CUDA
 
 
@@ -270,6 +394,17 @@ void HipWrap1D(const int N, DBODY &&d_body)
    MFEM_GPU_CHECK(hipGetLastError());
 }
 
+/// Variant of HipWrap1D() with a runtime block size, used by the
+/// launch-parameter autotuner, see KernelTuner in tuner.hpp.
+template <typename DBODY>
+void HipWrap1D(const int N, DBODY &&d_body, const int BLCK)
+{
+   if (N==0) { return; }
+   const int GRID = (N+BLCK-1)/BLCK;
+   hipLaunchKernelGGL(HipKernel1D,GRID,BLCK,0,0,N,d_body);
+   MFEM_GPU_CHECK(hipGetLastError());
+}
+
 template <typename DBODY>
 void HipWrap2D(const int N, DBODY &&d_body,
                const int X, const int Y, const int BZ)
@@ -292,19 +427,65 @@ void HipWrap3D(const int N, DBODY &&d_body,
    MFEM_GPU_CHECK(hipGetLastError());
 }
 
+template <typename BODY> __global__ static
+void HipReduceSumKernel(const int N, double *sum, BODY body)
+{
+   __shared__ double s_sum[MFEM_HIP_BLOCKS];
+   const int n = hipBlockDim_x*hipBlockIdx_x + hipThreadIdx_x;
+   const int tid = hipThreadIdx_x;
+   s_sum[tid] = (n < N) ? body(n) : 0.0;
+   for (int workers = hipBlockDim_x>>1; workers > 0; workers >>= 1)
+   {
+      __syncthreads();
+      if (tid < workers) { s_sum[tid] += s_sum[tid+workers]; }
+   }
+   if (tid == 0) { AtomicAdd(*sum, s_sum[0]); }
+}
+
+template <typename DBODY>
+double HipReduceSum(const int N, DBODY &&d_body)
+{
+   double sum = 0.0;
+   if (N == 0) { return sum; }
+   const int BLCK = MFEM_HIP_BLOCKS;
+   const int GRID = (N+BLCK-1)/BLCK;
+   double *d_sum = NULL;
+   HipMemAlloc((void**)&d_sum, sizeof(double));
+   HipMemcpyHtoD(d_sum, &sum, sizeof(double));
+   hipLaunchKernelGGL(HipReduceSumKernel,GRID,BLCK,0,0,N,d_sum,d_body);
+   MFEM_GPU_CHECK(hipGetLastError());
+   HipMemcpyDtoH(&sum, d_sum, sizeof(double));
+   HipMemFree(d_sum);
+   return sum;
+}
+
 #endif // MFEM_USE_HIP
 
 
-/// The forall kernel body wrapper
+#if defined(MFEM_USE_CUDA) || defined(MFEM_USE_HIP)
+// Candidate 1D block sizes tried by the launch-parameter autotuner; the
+// hardwired default is among them, so disabled tuning loses nothing.
+static const int forall_block_sizes[4] = { 128, 256, 512, 1024 };
+#endif
+
+/// The forall kernel body wrapper. For the 1D variant, @a kernel and @a line
+/// identify the launch site to the launch-parameter autotuner, which selects
+/// the block size when tuning is enabled; see KernelTuner in tuner.hpp. The
+/// block dimensions of the 2D and 3D variants are part of the kernel
+/// contract (shared arrays and synchronization are laid out on them), so
+/// they are always launched as requested.
 template <const int DIM, typename DBODY, typename HBODY>
 inline void ForallWrap(const bool use_dev, const int N,
                        DBODY &&d_body, HBODY &&h_body,
-                       const int X=0, const int Y=0, const int Z=0)
+                       const int X=0, const int Y=0, const int Z=0,
+                       const char *kernel=NULL, const int line=0)
 {
    MFEM_CONTRACT_VAR(X);
    MFEM_CONTRACT_VAR(Y);
    MFEM_CONTRACT_VAR(Z);
    MFEM_CONTRACT_VAR(d_body);
+   MFEM_CONTRACT_VAR(kernel);
+   MFEM_CONTRACT_VAR(line);
    if (!use_dev) { goto backend_cpu; }
 
 #if defined(MFEM_USE_RAJA) && defined(RAJA_ENABLE_CUDA)
@@ -322,7 +503,15 @@ inline void ForallWrap(const bool use_dev, const int N,
 #ifdef MFEM_USE_CUDA
    // Handle all allowed CUDA backends
    if (DIM == 1 && Device::Allows(Backend::CUDA_MASK))
-   { return CuWrap1D(N, d_body); }
+   {
+      if (kernel && KernelTuner::Enabled())
+      {
+         CuWrap1D(N, d_body, KernelTuner::Choose(kernel, line, N,
+                                                 forall_block_sizes, 4));
+         return KernelTuner::EndLaunch();
+      }
+      return CuWrap1D(N, d_body);
+   }
 
    if (DIM == 2 && Device::Allows(Backend::CUDA_MASK))
    { return CuWrap2D(N, d_body, X, Y, Z); }
@@ -334,7 +523,15 @@ inline void ForallWrap(const bool use_dev, const int N,
 #ifdef MFEM_USE_HIP
    // Handle all allowed HIP backends
    if (DIM == 1 && Device::Allows(Backend::HIP_MASK))
-   { return HipWrap1D(N, d_body); }
+   {
+      if (kernel && KernelTuner::Enabled())
+      {
+         HipWrap1D(N, d_body, KernelTuner::Choose(kernel, line, N,
+                                                  forall_block_sizes, 4));
+         return KernelTuner::EndLaunch();
+      }
+      return HipWrap1D(N, d_body);
+   }
 
    if (DIM == 2 && Device::Allows(Backend::HIP_MASK))
    { return HipWrap2D(N, d_body, X, Y, Z); }
@@ -353,7 +550,14 @@ inline void ForallWrap(const bool use_dev, const int N,
 
 #ifdef MFEM_USE_OPENMP
    // Handle all allowed OpenMP backends
-   if (Device::Allows(Backend::OMP_MASK)) { return OmpWrap(N, h_body); }
+   if (DIM == 1 && Device::Allows(Backend::OMP_MASK))
+   { return OmpWrap(N, h_body); }
+
+   if (DIM == 2 && Device::Allows(Backend::OMP_MASK))
+   { return OmpWrap2D(N, h_body, X, Y, Z); }
+
+   if (DIM == 3 && Device::Allows(Backend::OMP_MASK))
+   { return OmpWrap3D(N, h_body, X, Y, Z); }
 #endif
 
 #ifdef MFEM_USE_RAJA
@@ -369,6 +573,41 @@ backend_cpu:
    for (int k = 0; k < N; k++) { h_body(k); }
 }
 
+/// The reduction kernel body wrapper, see MFEM_REDUCE
+template <typename DBODY, typename HBODY>
+inline double ReduceWrap(const bool use_dev, const int N,
+                         DBODY &&d_body, HBODY &&h_body)
+{
+   MFEM_CONTRACT_VAR(d_body);
+   double sum = 0.0;
+   if (!use_dev) { goto backend_cpu; }
+
+#ifdef MFEM_USE_CUDA
+   // Handle all allowed CUDA backends
+   if (Device::Allows(Backend::CUDA_MASK))
+   { return CuReduceSum(N, d_body); }
+#endif
+
+#ifdef MFEM_USE_HIP
+   // Handle all allowed HIP backends
+   if (Device::Allows(Backend::HIP_MASK))
+   { return HipReduceSum(N, d_body); }
+#endif
+
+   if (Device::Allows(Backend::DEBUG_DEVICE)) { goto backend_cpu; }
+
+#ifdef MFEM_USE_OPENMP
+   // Handle all allowed OpenMP backends
+   if (Device::Allows(Backend::OMP_MASK))
+   { return OmpReduceSum(N, h_body); }
+#endif
+
+backend_cpu:
+   // Handle Backend::CPU and any other allowed backend not handled above.
+   for (int k = 0; k < N; k++) { sum += h_body(k); }
+   return sum;
+}
+
 } // namespace mfem
 
 #endif // MFEM_FORALL_HPP
@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "hash.hpp"
+#include "error.hpp"
+
+#include <algorithm>
+
+namespace mfem
+{
+
+const std::uint64_t ConcurrentHashTable::EmptyKey;
+const int ConcurrentHashTable::PendingKey;
+
+ConcurrentHashTable::ConcurrentHashTable(int capacity)
+   : num_keys(0), finalized(false)
+{
+   MFEM_VERIFY(capacity > 0, "invalid capacity: " << capacity);
+   // keep the load factor at 1/2 or less; the slot count is a power of two
+   std::size_t num_slots = 16;
+   while (num_slots < 2*(std::size_t)capacity) { num_slots *= 2; }
+   hash_mask = num_slots - 1;
+   slots = std::vector<Slot>(num_slots);
+   for (std::size_t i = 0; i < num_slots; i++)
+   {
+      slots[i].key12.store(EmptyKey, std::memory_order_relaxed);
+      slots[i].key3.store(PendingKey, std::memory_order_relaxed);
+   }
+}
+
+int ConcurrentHashTable::Probe(int p1, int p2, int p3, bool insert)
+{
+   const std::uint64_t k12 = PackKey(p1, p2);
+   std::uint64_t h = HashKey(k12, p3);
+   for (std::size_t probes = 0; probes <= hash_mask; probes++, h++)
+   {
+      Slot &slot = slots[h & hash_mask];
+      std::uint64_t cur = slot.key12.load(std::memory_order_acquire);
+      if (cur == EmptyKey)
+      {
+         if (!insert) { return -1; }
+         if (slot.key12.compare_exchange_strong(cur, k12,
+                                                std::memory_order_acq_rel))
+         {
+            slot.key3.store(p3, std::memory_order_release);
+            num_keys.fetch_add(1, std::memory_order_relaxed);
+            return (int)(h & hash_mask);
+         }
+         // lost the race: 'cur' now holds the winner's key, fall through
+      }
+      if (cur == k12)
+      {
+         // wait for the claiming thread to publish the third index
+         int q3;
+         while ((q3 = slot.key3.load(std::memory_order_acquire)) == PendingKey)
+         { }
+         if (q3 == p3) { return (int)(h & hash_mask); }
+      }
+   }
+   if (insert) { MFEM_ABORT("capacity exceeded: " << hash_mask + 1 << " slots"); }
+   return -1;
+}
+
+void ConcurrentHashTable::Finalize()
+{
+   MFEM_VERIFY(!finalized, "the table is already finalized");
+   struct SlotKey
+   {
+      std::uint64_t k12;
+      int p3, slot;
+      bool operator<(const SlotKey &other) const
+      { return (k12 != other.k12) ? (k12 < other.k12) : (p3 < other.p3); }
+   };
+   std::vector<SlotKey> keys;
+   keys.reserve(Size());
+   for (std::size_t i = 0; i < slots.size(); i++)
+   {
+      const std::uint64_t k12 = slots[i].key12.load(std::memory_order_acquire);
+      if (k12 == EmptyKey) { continue; }
+      SlotKey key;
+      key.k12 = k12;
+      key.p3 = slots[i].key3.load(std::memory_order_acquire);
+      key.slot = (int)i;
+      keys.push_back(key);
+   }
+   MFEM_VERIFY((int)keys.size() == Size(), "internal error");
+   ParallelSort(keys.begin(), keys.end());
+   slot_id.assign(slots.size(), -1);
+   for (std::size_t rank = 0; rank < keys.size(); rank++)
+   {
+      slot_id[keys[rank].slot] = (int)rank;
+   }
+   finalized = true;
+}
+
+int ConcurrentHashTable::FindId(int p1, int p2) const
+{
+   MFEM_ASSERT(finalized, "Finalize() must be called before FindId()");
+   if (p1 > p2) { std::swap(p1, p2); }
+   const int slot = const_cast<ConcurrentHashTable*>(this)
+                    ->Probe(p1, p2, -1, false);
+   return (slot >= 0) ? slot_id[slot] : -1;
+}
+
+int ConcurrentHashTable::FindId(int p1, int p2, int p3, int p4) const
+{
+   MFEM_ASSERT(finalized, "Finalize() must be called before FindId()");
+   internal::sort4_ext(p1, p2, p3, p4);
+   const int slot = const_cast<ConcurrentHashTable*>(this)
+                    ->Probe(p1, p2, p3, false);
+   return (slot >= 0) ? slot_id[slot] : -1;
+}
+
+} // namespace mfem
@@ -15,6 +15,11 @@
 #include "../config/config.hpp"
 #include "array.hpp"
 #include "globals.hpp"
+#include "sort_pairs.hpp"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <vector>
 
 namespace mfem
 {
@@ -528,6 +533,107 @@ void HashTable<T>::PrintMemoryDetail() const
              << " + " << unused.MemoryUsage();
 }
 
+
+/** @brief Fixed-capacity concurrent hash table for integer pair and
+ *  quadruple keys, such as the vertex pairs identifying mesh edges and the
+ *  vertex quadruples identifying mesh faces.
+ *
+ *  Unlike HashTable, this container supports concurrent insertion from
+ *  multiple threads: the open-addressing slots are claimed with atomic
+ *  compare-and-swap operations and duplicate keys are detected on the fly.
+ *  Because the insertion order is nondeterministic under concurrency, ids
+ *  are not assigned during insertion; instead, Finalize() sorts the keys
+ *  and numbers them 0, 1, ... in lexicographic key order, so the resulting
+ *  ids are independent of the thread schedule. The intended usage is:
+ *
+ *  1. construct with an upper bound on the number of distinct keys,
+ *  2. Insert() keys concurrently (duplicates are fine),
+ *  3. Finalize() on one thread,
+ *  4. FindId() concurrently (read-only).
+ *
+ *  The capacity is fixed at construction: the table never rehashes, which
+ *  is what makes lock-free insertion possible. Exceeding the capacity
+ *  aborts. Keys follow the HashTable conventions: the order of the indices
+ *  is irrelevant, and for quadruples the largest index is dropped (see
+ *  Hashed4).
+ */
+class ConcurrentHashTable
+{
+protected:
+   struct Slot
+   {
+      std::atomic<std::uint64_t> key12; ///< packed (p1,p2), or #EmptyKey
+      std::atomic<int> key3;            ///< p3 (-1 for pairs), or #PendingKey
+   };
+
+   static const std::uint64_t EmptyKey = ~std::uint64_t(0);
+   static const int PendingKey = INT_MIN;
+
+   std::vector<Slot> slots;
+   std::vector<int> slot_id; ///< slot index -> id, filled by Finalize()
+   std::atomic<int> num_keys;
+   std::uint64_t hash_mask;
+   bool finalized;
+
+   static std::uint64_t PackKey(int p1, int p2)
+   { return (std::uint64_t(std::uint32_t(p1)) << 32) | std::uint32_t(p2); }
+
+   static std::uint64_t HashKey(std::uint64_t k12, int p3)
+   {
+      // mix of the split-mix generator, applied to the combined key
+      std::uint64_t h = k12 ^ (std::uint64_t(std::uint32_t(p3))*0x9e3779b97f4a7c15ull);
+      h = (h ^ (h >> 30))*0xbf58476d1ce4e5b9ull;
+      h = (h ^ (h >> 27))*0x94d049bb133111ebull;
+      return h ^ (h >> 31);
+   }
+
+   /// Return the slot index of key (p1,p2,p3), claiming an empty slot when
+   /// @a insert is true. The key must be normalized. Return -1 if not found.
+   int Probe(int p1, int p2, int p3, bool insert);
+
+public:
+   /// Create a table able to hold at least @a capacity distinct keys.
+   explicit ConcurrentHashTable(int capacity);
+
+   /// Insert the pair key (p1,p2). Duplicate insertions are allowed.
+   /** Thread-safe with respect to other Insert() calls. */
+   void Insert(int p1, int p2)
+   {
+      if (p1 > p2) { std::swap(p1, p2); }
+      Probe(p1, p2, -1, true);
+   }
+
+   /// Insert the quadruple key (p1,p2,p3,p4); p4 is optional, see Hashed4.
+   /** Thread-safe with respect to other Insert() calls. */
+   void Insert(int p1, int p2, int p3, int p4 = -1)
+   {
+      internal::sort4_ext(p1, p2, p3, p4);
+      Probe(p1, p2, p3, true);
+   }
+
+   /// Return the number of distinct keys inserted so far.
+   int Size() const { return num_keys.load(std::memory_order_acquire); }
+
+   /** @brief Assign the ids: the keys are sorted and numbered 0, 1, ... in
+       lexicographic order, independently of the order of insertion. Must be
+       called from a single thread after all insertions. */
+   void Finalize();
+
+   /// Find the id of the pair key (p1,p2); return -1 if it is not present.
+   /** The table must be finalized. Thread-safe. */
+   int FindId(int p1, int p2) const;
+
+   /// Find the id of the quadruple key; return -1 if it is not present.
+   /** The table must be finalized. Thread-safe. */
+   int FindId(int p1, int p2, int p3, int p4 = -1) const;
+
+   long MemoryUsage() const
+   {
+      return slots.size()*(long)sizeof(Slot) +
+             slot_id.size()*(long)sizeof(int);
+   }
+};
+
 } // namespace mfem
 
 #endif
@@ -0,0 +1,156 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "jit.hpp"
+#include "error.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+#ifndef _WIN32
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// -1: consult the MFEM_JIT environment variable, 0: disabled, 1: enabled.
+static int jit_enabled = -1;
+
+// Hash of the generated source -> loaded symbol (NULL records a failed
+// compilation, so the compiler is invoked at most once per source).
+static std::map<unsigned long long, void*> jit_kernels;
+
+// FNV-1a, the same construction used for hashing elsewhere in the library.
+static unsigned long long JitHash(const std::string &s)
+{
+   unsigned long long hash = 0xcbf29ce484222325ull;
+   for (size_t i = 0; i < s.size(); i++)
+   {
+      hash = (hash ^ static_cast<unsigned char>(s[i]))*0x100000001b3ull;
+   }
+   return hash;
+}
+
+#ifndef _WIN32
+static std::string JitCacheDir()
+{
+   const char *env = std::getenv("MFEM_JIT_CACHE");
+   std::ostringstream dir;
+   if (env && env[0] != '\0') { dir << env; }
+   else { dir << "/tmp/mfem-jit-" << getuid(); }
+   mkdir(dir.str().c_str(), 0700); // ok if it already exists
+   return dir.str();
+}
+
+static const char *JitEnv(const char *name, const char *def)
+{
+   const char *env = std::getenv(name);
+   return (env && env[0] != '\0') ? env : def;
+}
+#endif
+
+} // namespace internal
+
+using namespace internal;
+
+bool Jit::Enabled()
+{
+   if (jit_enabled < 0)
+   {
+      const char *env = std::getenv("MFEM_JIT");
+      jit_enabled = (env && env[0] != '\0' && env[0] != '0') ? 1 : 0;
+   }
+   return jit_enabled != 0;
+}
+
+void Jit::Enable() { jit_enabled = 1; }
+
+void Jit::Disable() { jit_enabled = 0; }
+
+void *Jit::Compile(const std::string &symbol, const std::string &source)
+{
+#ifdef _WIN32
+   MFEM_CONTRACT_VAR(symbol);
+   MFEM_CONTRACT_VAR(source);
+   return NULL; // runtime loading is not implemented on Windows
+#else
+   const unsigned long long hash = JitHash(symbol + source);
+   std::map<unsigned long long, void*>::iterator it = jit_kernels.find(hash);
+   if (it != jit_kernels.end()) { return it->second; }
+   jit_kernels[hash] = NULL; // overwritten below on success
+
+   const std::string dir = JitCacheDir();
+   std::ostringstream base;
+   base << dir << "/mjit-" << std::hex << hash;
+   const std::string lib_file = base.str() + ".so";
+
+   struct stat sb;
+   if (stat(lib_file.c_str(), &sb) != 0)
+   {
+      const std::string src_file = base.str() + ".cpp";
+      const std::string log_file = base.str() + ".log";
+      const std::string tmp_file = base.str() + ".tmp.so";
+      {
+         std::ofstream src(src_file.c_str());
+         src << source;
+         if (!src)
+         {
+            MFEM_WARNING("JIT: error writing source file: " << src_file);
+            return NULL;
+         }
+      }
+      std::ostringstream cmd;
+      cmd << JitEnv("MFEM_JIT_CXX", "c++") << ' '
+          << JitEnv("MFEM_JIT_CXXFLAGS", "-O3 -std=c++11")
+          << " -shared -fPIC -I" << MFEM_SOURCE_DIR
+          << " -o " << tmp_file << ' ' << src_file
+          << " > " << log_file << " 2>&1";
+      if (std::system(cmd.str().c_str()) != 0)
+      {
+         MFEM_WARNING("JIT: compilation failed, see " << log_file);
+         return NULL;
+      }
+      // rename() is atomic: concurrent processes never load a partial library
+      if (std::rename(tmp_file.c_str(), lib_file.c_str()) != 0)
+      {
+         MFEM_WARNING("JIT: error renaming " << tmp_file);
+         return NULL;
+      }
+   }
+
+   void *handle = dlopen(lib_file.c_str(), RTLD_NOW | RTLD_LOCAL);
+   if (!handle)
+   {
+      MFEM_WARNING("JIT: dlopen failed: " << dlerror());
+      return NULL;
+   }
+   void *kernel = dlsym(handle, symbol.c_str());
+   if (!kernel)
+   {
+      MFEM_WARNING("JIT: symbol '" << symbol << "' not found in " << lib_file);
+      return NULL;
+   }
+   jit_kernels[hash] = kernel;
+   return kernel;
+#endif
+}
+
+} // namespace mfem
@@ -0,0 +1,68 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_JIT
+#define MFEM_JIT
+
+#include "../config/config.hpp"
+#include <string>
+
+namespace mfem
+{
+
+/** @brief Just-in-time compilation of specialized kernels.
+
+    The partial assembly sources ship fully specialized (compile-time D1D and
+    Q1D) kernels only for a fixed list of polynomial orders (see
+    fem/kernel_dispatch.hpp); other orders run through slower runtime-sized
+    fallback loops. When the JIT engine is enabled, the dispatch code
+    instead generates a small source file instantiating the exact (dim, D1D,
+    Q1D) specialization, compiles it into a shared library with the host C++
+    compiler, and loads the kernel with dlopen(), giving templated-kernel
+    speed for arbitrary orders without shipping every instantiation.
+
+    Compiled libraries are cached on disk keyed by a hash of the generated
+    source, so each specialization is built at most once per machine. The
+    engine is disabled by default and controlled by:
+
+      - MFEM_JIT=1        enable the engine (or call Jit::Enable()),
+      - MFEM_JIT_CACHE    cache directory (default: /tmp/mfem-jit-<uid>),
+      - MFEM_JIT_CXX      compiler command (default: c++),
+      - MFEM_JIT_CXXFLAGS compiler flags (default: -O3 -std=c++11).
+
+    The generated sources re-include the kernel translation units from
+    MFEM_SOURCE_DIR, so the engine requires the MFEM sources at the location
+    recorded at configure time. Compilation failures are reported with a
+    warning, remembered, and the caller falls back to the runtime-sized
+    kernels, so enabling the engine can never produce wrong results. */
+class Jit
+{
+public:
+   /// Return true if the engine is enabled (MFEM_JIT=1 or Enable() called).
+   static bool Enabled();
+
+   /// Enable the engine, overriding the MFEM_JIT environment variable.
+   static void Enable();
+
+   /// Disable the engine. Already-loaded kernels remain in use.
+   static void Disable();
+
+   /** @brief Compile @a source (unless cached) and return the address of its
+       extern "C" symbol @a symbol, or NULL on failure.
+
+       Failures are cached: repeated calls with the same source return NULL
+       immediately without re-invoking the compiler. */
+   static void *Compile(const std::string &symbol, const std::string &source);
+};
+
+} // namespace mfem
+
+#endif
@@ -137,6 +137,115 @@ size_t Stack <Elem, Num>::MemoryUsage() const
 }
 
 
+/** @brief Bump-pointer arena for transient, element-local scratch memory.
+
+    Alloc() carves uninitialized storage out of large chunks; there is no
+    per-allocation free. Reset() recycles all outstanding allocations at once,
+    keeping the (merged) chunk, so steady-state use performs no heap traffic.
+    Each thread gets its own arena through ThreadInstance(), so assembly loops
+    can draw scratch matrices without contending on the global allocator. */
+class ScratchArena
+{
+private:
+   struct Chunk
+   {
+      Chunk *prev;
+      size_t capacity; ///< Bytes available after the header.
+   };
+
+   Chunk *last;
+   size_t used;  ///< Bytes used in the last chunk.
+   size_t total; ///< Total capacity of all chunks.
+
+   static size_t Align(size_t bytes)
+   { return (bytes + 15) & ~size_t(15); }
+
+   Chunk *NewChunk(size_t bytes)
+   {
+      Chunk *c = reinterpret_cast<Chunk*>(new char[sizeof(Chunk) + bytes]);
+      c->prev = NULL;
+      c->capacity = bytes;
+      total += bytes;
+      return c;
+   }
+
+   static char *ChunkData(Chunk *c)
+   { return reinterpret_cast<char*>(c) + sizeof(Chunk); }
+
+   // Not copyable.
+   ScratchArena(const ScratchArena &);
+   ScratchArena &operator=(const ScratchArena &);
+
+public:
+   /// Create an arena whose first chunk holds @a min_bytes bytes.
+   explicit ScratchArena(size_t min_bytes = 64*1024)
+      : last(NULL), used(0), total(0) { last = NewChunk(Align(min_bytes)); }
+
+   ~ScratchArena() { Clear(); }
+
+   /// Return a pointer to @a bytes bytes of uninitialized scratch storage.
+   void *Alloc(size_t bytes)
+   {
+      bytes = Align(bytes);
+      if (used + bytes > last->capacity)
+      {
+         // Chain a chunk big enough for the request; the next Reset() will
+         // merge all chunks into one of the combined size.
+         const size_t grow = 2*last->capacity;
+         Chunk *c = NewChunk(bytes > grow ? bytes : grow);
+         c->prev = last;
+         last = c;
+         used = 0;
+      }
+      void *p = ChunkData(last) + used;
+      used += bytes;
+      return p;
+   }
+
+   /// Typed version of Alloc(): space for @a n elements of type @a Elem.
+   template <class Elem>
+   Elem *Alloc(size_t n) { return static_cast<Elem*>(Alloc(n*sizeof(Elem))); }
+
+   /** @brief Recycle all allocations at once, invalidating every pointer
+       previously returned by Alloc(). Overflow chunks are merged into one
+       chunk of the combined size so that subsequent cycles stay
+       allocation-free. */
+   void Reset()
+   {
+      if (last && last->prev)
+      {
+         const size_t want = total;
+         Clear();
+         last = NewChunk(want);
+      }
+      used = 0;
+   }
+
+   /// Free all chunks owned by the arena.
+   void Clear()
+   {
+      while (last != NULL)
+      {
+         Chunk *prev = last->prev;
+         delete [] reinterpret_cast<char*>(last);
+         last = prev;
+      }
+      used = 0;
+      total = 0;
+   }
+
+   /// Return the number of bytes allocated from the heap by the arena.
+   size_t MemoryUsage() const { return total; }
+
+   /// Per-thread arena instance used for element-local scratch.
+   static ScratchArena &ThreadInstance()
+   {
+      static thread_local ScratchArena arena;
+      return arena;
+   }
+};
+
+
 template <class Elem, int Num>
 class MemAllocNode
 {
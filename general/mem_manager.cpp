@@ -13,10 +13,18 @@
 #include "mem_manager.hpp"
 
 #include <list>
+#include <map>
 #include <cstring> // std::memcpy, std::memcmp
+#include <cstdlib> // std::getenv, std::atol
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <algorithm> // std::max
 
+#ifdef MFEM_USE_MPI
+#include <mpi.h> // for the HOST_SHARED memory space
+#endif
+
 // Uncomment to try _WIN32 platform
 //#define _WIN32
 //#define _aligned_malloc(s,a) malloc(s)
@@ -25,6 +33,9 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sys/mman.h>
+#ifdef __linux__
+#include <sys/syscall.h> // SYS_mbind, for the NUMA interleave policy
+#endif
 #define mfem_memalign(p,a,s) posix_memalign(p,a,s)
 #define mfem_aligned_free free
 #else
@@ -72,6 +83,8 @@ MemoryType MemoryManager::GetDualMemoryType_(MemoryType mt)
       case MemoryType::HOST_64:        return MemoryType::DEVICE;
       case MemoryType::HOST_DEBUG:     return MemoryType::DEVICE_DEBUG;
       case MemoryType::HOST_UMPIRE:    return MemoryType::DEVICE_UMPIRE;
+      case MemoryType::HOST_PINNED:    return MemoryType::DEVICE;
+      case MemoryType::HOST_SHARED:    return MemoryType::DEVICE;
       case MemoryType::MANAGED:        return MemoryType::MANAGED;
       case MemoryType::DEVICE:         return MemoryType::HOST;
       case MemoryType::DEVICE_DEBUG:   return MemoryType::HOST_DEBUG;
@@ -91,6 +104,8 @@ static void MFEM_VERIFY_TYPES(const MemoryType h_mt, const MemoryType d_mt)
       (h_mt == MemoryType::HOST_DEBUG && d_mt == MemoryType::DEVICE_DEBUG) ||
       (h_mt == MemoryType::MANAGED && d_mt == MemoryType::MANAGED) ||
       (h_mt == MemoryType::HOST_64 && d_mt == MemoryType::DEVICE) ||
+      (h_mt == MemoryType::HOST_PINNED && d_mt == MemoryType::DEVICE) ||
+      (h_mt == MemoryType::HOST_SHARED && d_mt == MemoryType::DEVICE) ||
       (h_mt == MemoryType::HOST_32 && d_mt == MemoryType::DEVICE) ||
       (h_mt == MemoryType::HOST && d_mt == MemoryType::DEVICE);
    MFEM_VERIFY(sync, "");
@@ -137,6 +152,7 @@ struct Memory
    const size_t bytes;
    const MemoryType h_mt, d_mt;
    mutable bool h_rw, d_rw;
+   std::string label; ///< optional user label, see Memory<T>::SetLabel()
    Memory(void *p, size_t b, MemoryType h, MemoryType d):
       h_ptr(p), d_ptr(nullptr), bytes(b), h_mt(h), d_mt(d),
       h_rw(true), d_rw(true) { }
@@ -151,20 +167,44 @@ struct Alias
    const MemoryType h_mt;
 };
 
+/// Per-tag transfer statistics, indexed by direction as in
+/// MemoryManager::transfer_bytes (0 = device-to-host, 1 = host-to-device)
+struct TransferStat
+{
+   long count[2];
+   size_t bytes[2];
+   TransferStat() { count[0] = count[1] = 0; bytes[0] = bytes[1] = 0; }
+};
+
 /// Maps for the Memory and the Alias classes
 typedef std::unordered_map<const void*, Memory> MemoryMap;
 typedef std::unordered_map<const void*, Alias> AliasMap;
+typedef std::map<std::string, TransferStat> TransferStatMap;
 
 struct Maps
 {
    MemoryMap memories;
    AliasMap aliases;
+   TransferStatMap transfers; ///< traced transfers, see SetTransferTrace()
 };
 
 } // namespace mfem::internal
 
 static internal::Maps *maps;
 
+// Pooling of device allocations, see MemoryManager::SetDeviceMemoryPool().
+static bool device_mem_pool = false;
+
+// Pooling of pinned host allocations and the cap on the unused pinned memory
+// the pool may retain, see MemoryManager::SetPinnedMemoryPool().
+static bool pinned_mem_pool = false;
+static size_t pinned_mem_pool_max = (size_t) 256 << 20;
+
+// NUMA placement policy for the large allocations of the default host memory
+// space, see MemoryManager::SetNumaPolicy().
+enum NumaPolicy { NUMA_DEFAULT, NUMA_FIRST_TOUCH, NUMA_INTERLEAVE };
+static NumaPolicy numa_policy = NUMA_DEFAULT;
+
 namespace internal
 {
 
@@ -198,10 +238,96 @@ public:
    { return std::memcpy(dst, src, bytes); }
    virtual void *DtoH(void *dst, const void *src, size_t bytes)
    { return std::memcpy(dst, src, bytes); }
+   // Asynchronous transfers used by the prefetch path; the default
+   // implementations fall back to the synchronous copies.
+   virtual void *HtoDAsync(void *dst, const void *src, size_t bytes)
+   { return HtoD(dst, src, bytes); }
+   virtual void *DtoHAsync(void *dst, const void *src, size_t bytes)
+   { return DtoH(dst, src, bytes); }
 };
 
-/// The default std:: host memory space
-class StdHostMemorySpace : public HostMemorySpace { };
+#if defined(__linux__) && !defined(_WIN32)
+/// Number of NUMA memory nodes of the machine, from sysfs; 1 on failure.
+static int NumaNodeCount()
+{
+   static int nodes = 0;
+   if (nodes) { return nodes; }
+   while (nodes < 8*(int)sizeof(unsigned long))
+   {
+      std::ostringstream path;
+      path << "/sys/devices/system/node/node" << nodes;
+      if (access(path.str().c_str(), F_OK)) { break; }
+      nodes++;
+   }
+   if (nodes == 0) { nodes = 1; }
+   return nodes;
+}
+
+/// Request round-robin page placement over all NUMA nodes for the (page
+/// aligned interior of the) range via the mbind system call. Best effort:
+/// pages that were already touched keep their placement and errors are
+/// ignored, leaving the allocation with the default policy.
+static void NumaInterleave(void *ptr, size_t bytes)
+{
+   const int nodes = NumaNodeCount();
+   if (nodes < 2) { return; }
+   const uintptr_t page = (uintptr_t) sysconf(_SC_PAGESIZE);
+   const uintptr_t beg = ((uintptr_t) ptr + page - 1) & ~(page - 1);
+   const uintptr_t end = ((uintptr_t) ptr + bytes) & ~(page - 1);
+   if (end <= beg) { return; }
+   unsigned long node_mask =
+      (nodes >= 8*(int)sizeof(unsigned long)) ? ~0ul : ((1ul << nodes) - 1);
+#ifdef SYS_mbind
+   const int MPOL_INTERLEAVE_ = 3; // <linux/mempolicy.h>
+   syscall(SYS_mbind, beg, end - beg, MPOL_INTERLEAVE_, &node_mask,
+           (unsigned long) (nodes + 1), 0ul);
+#else
+   MFEM_CONTRACT_VAR(node_mask);
+#endif
+}
+#endif // __linux__
+
+/// Touch one byte of every page of the new allocation from the OpenMP
+/// threads, with the same static schedule as the compute loops, so each page
+/// is placed on the NUMA node of the socket that will work on it. The memory
+/// is uninitialized either way, so the written zeros are not observable.
+static void NumaFirstTouch(void *ptr, size_t bytes)
+{
+   const size_t page = 0x1000;
+   unsigned char *p = (unsigned char*) ptr;
+   const long n_pages = (long) ((bytes + page - 1)/page);
+#if defined(MFEM_USE_OPENMP)
+   #pragma omp parallel for schedule(static)
+#endif
+   for (long i = 0; i < n_pages; i++) { p[i*page] = 0; }
+}
+
+/// Apply the configured NUMA policy to a new host allocation; small
+/// allocations are left alone -- they are served from already-placed pages
+/// of the allocator's free lists anyway.
+static void ApplyNumaPolicy(void *ptr, size_t bytes)
+{
+   if (numa_policy == NUMA_DEFAULT || !ptr || bytes < ((size_t) 1 << 20))
+   {
+      return;
+   }
+   if (numa_policy == NUMA_FIRST_TOUCH) { return NumaFirstTouch(ptr, bytes); }
+#if defined(__linux__) && !defined(_WIN32)
+   NumaInterleave(ptr, bytes);
+#endif
+}
+
+/// The default std:: host memory space, with optional NUMA placement of the
+/// large allocations, see MemoryManager::SetNumaPolicy().
+class StdHostMemorySpace : public HostMemorySpace
+{
+public:
+   void Alloc(void **ptr, size_t bytes)
+   {
+      *ptr = std::malloc(bytes);
+      ApplyNumaPolicy(*ptr, bytes);
+   }
+};
 
 /// The No host memory space
 struct NoHostMemorySpace : public HostMemorySpace
@@ -229,6 +355,156 @@ public:
    void Dealloc(void *ptr) { mfem_aligned_free(ptr); }
 };
 
+/// Round up to the next power-of-two size class, starting at 256 bytes;
+/// used by the pooling memory spaces so buffers freed by one request can be
+/// reused by any other request from the same class.
+static size_t PoolSizeClass(size_t bytes)
+{
+   size_t sc = 0x100;
+   while (sc < bytes) { sc *= 2; }
+   return sc;
+}
+
+/// The page-locked (pinned) host memory space; without a CUDA or HIP device
+/// it falls back to the default std:: host memory space
+class HostPinnedMemorySpace : public HostMemorySpace
+{
+public:
+   HostPinnedMemorySpace(): HostMemorySpace() { }
+   void Alloc(void **ptr, size_t bytes)
+   {
+#if defined(MFEM_USE_CUDA)
+      CuMemAllocHostPinned(ptr, bytes);
+#elif defined(MFEM_USE_HIP)
+      HipMemAllocHostPinned(ptr, bytes);
+#else
+      *ptr = std::malloc(bytes);
+#endif
+   }
+   void Dealloc(void *ptr)
+   {
+#if defined(MFEM_USE_CUDA)
+      CuMemFreeHostPinned(ptr);
+#elif defined(MFEM_USE_HIP)
+      HipMemFreeHostPinned(ptr);
+#else
+      std::free(ptr);
+#endif
+   }
+};
+
+/** The pooling pinned host memory space: pinned allocations are expensive
+    (they synchronize the device), so freed buffers are kept in free lists of
+    power-of-two size classes and reused, up to the retained-bytes cap set
+    with MemoryManager::SetPinnedMemoryPool(). */
+class PooledHostPinnedMemorySpace : public HostPinnedMemorySpace
+{
+   std::multimap<size_t, void*> free_list;
+   std::map<void*, size_t> sizes; ///< Size class of every live allocation.
+   size_t cached = 0; ///< Total bytes currently held in #free_list.
+
+public:
+   ~PooledHostPinnedMemorySpace()
+   {
+      for (std::multimap<size_t, void*>::iterator it = free_list.begin();
+           it != free_list.end(); ++it)
+      {
+         HostPinnedMemorySpace::Dealloc(it->second);
+      }
+   }
+   void Alloc(void **ptr, size_t bytes)
+   {
+      const size_t sc = PoolSizeClass(bytes);
+      const std::multimap<size_t, void*>::iterator it = free_list.find(sc);
+      if (it != free_list.end())
+      {
+         *ptr = it->second;
+         free_list.erase(it);
+         cached -= sc;
+         return;
+      }
+      // Allocate the full size class so the buffer can be reused by any
+      // request from the same class.
+      HostPinnedMemorySpace::Alloc(ptr, sc);
+      sizes[*ptr] = sc;
+   }
+   void Dealloc(void *ptr)
+   {
+      const std::map<void*, size_t>::iterator it = sizes.find(ptr);
+      MFEM_ASSERT(it != sizes.end(), "unknown pinned pool pointer!");
+      const size_t sc = it->second;
+      if (cached + sc > pinned_mem_pool_max)
+      {
+         sizes.erase(it);
+         return HostPinnedMemorySpace::Dealloc(ptr);
+      }
+      free_list.insert(std::make_pair(sc, ptr));
+      cached += sc;
+   }
+};
+
+#ifdef MFEM_USE_MPI
+/// The MPI-3 shared-memory window host memory space; without MPI it falls
+/// back to the default std:: host memory space
+/** All ranks of a compute node receive the same address, backed by a single
+    physical copy of the data owned by the node-root rank. Allocation and
+    deallocation are collective over the ranks of the node communicator and
+    must be performed in the same order on all of them. The contents should
+    be written by one rank per node and synchronized with a barrier before
+    the other ranks read them. */
+class SharedHostMemorySpace : public HostMemorySpace
+{
+   MPI_Comm node_comm;
+   bool comm_ready;
+   std::unordered_map<void*, MPI_Win> windows;
+
+   void Init()
+   {
+      int mpi_is_initialized = 0;
+      MPI_Initialized(&mpi_is_initialized);
+      MFEM_VERIFY(mpi_is_initialized,
+                  "host-shared memory requires an initialized MPI");
+      MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                          MPI_INFO_NULL, &node_comm);
+      comm_ready = true;
+   }
+
+public:
+   SharedHostMemorySpace(): HostMemorySpace(), comm_ready(false) { }
+   void Alloc(void **ptr, size_t bytes)
+   {
+      if (!comm_ready) { Init(); }
+      int node_rank;
+      MPI_Comm_rank(node_comm, &node_rank);
+      // the node-root rank provides the physical memory, the other ranks
+      // query its base address in their own address space
+      MPI_Win win;
+      void *base = nullptr;
+      const MPI_Aint win_bytes = (node_rank == 0) ? (MPI_Aint)bytes : 0;
+      MPI_Win_allocate_shared(win_bytes, 1, MPI_INFO_NULL, node_comm,
+                              &base, &win);
+      if (node_rank != 0)
+      {
+         MPI_Aint query_bytes;
+         int disp_unit;
+         MPI_Win_shared_query(win, 0, &query_bytes, &disp_unit, &base);
+      }
+      *ptr = base;
+      windows[base] = win;
+   }
+   void Dealloc(void *ptr)
+   {
+      std::unordered_map<void*, MPI_Win>::iterator it = windows.find(ptr);
+      MFEM_VERIFY(it != windows.end(), "invalid host-shared pointer");
+      MPI_Win win = it->second;
+      windows.erase(it);
+      MPI_Win_free(&win);
+   }
+};
+#else
+class SharedHostMemorySpace : public StdHostMemorySpace { };
+#endif // MFEM_USE_MPI
+
 #ifndef _WIN32
 static uintptr_t pagesize = 0;
 static uintptr_t pagemask = 0;
@@ -402,6 +678,10 @@ public:
    { return CuMemcpyDtoD(dst, src, bytes); }
    void *DtoH(void *dst, const void *src, size_t bytes)
    { return CuMemcpyDtoH(dst, src, bytes); }
+   void *HtoDAsync(void *dst, const void *src, size_t bytes)
+   { return CuMemcpyHtoDAsync(dst, src, bytes); }
+   void *DtoHAsync(void *dst, const void *src, size_t bytes)
+   { return CuMemcpyDtoHAsync(dst, src, bytes); }
 };
 
 /// The HIP device memory space
@@ -417,6 +697,10 @@ public:
    { return HipMemcpyDtoD(dst, src, bytes); }
    void *DtoH(void *dst, const void *src, size_t bytes)
    { return HipMemcpyDtoH(dst, src, bytes); }
+   void *HtoDAsync(void *dst, const void *src, size_t bytes)
+   { return HipMemcpyHtoDAsync(dst, src, bytes); }
+   void *DtoHAsync(void *dst, const void *src, size_t bytes)
+   { return HipMemcpyDtoHAsync(dst, src, bytes); }
 };
 
 /// The UVM device memory space.
@@ -464,6 +748,64 @@ public:
    { return std::memcpy(dst, src, bytes); }
 };
 
+/** The pooling device memory space: wraps another DeviceMemorySpace and
+    keeps the deallocated buffers in free lists of power-of-two size classes
+    for reuse, see MemoryManager::SetDeviceMemoryPool(). */
+class PooledDeviceMemorySpace : public DeviceMemorySpace
+{
+   DeviceMemorySpace * const base; // Owned.
+   std::multimap<size_t, void*> free_list;
+
+public:
+   PooledDeviceMemorySpace(DeviceMemorySpace *space): base(space) { }
+   ~PooledDeviceMemorySpace()
+   {
+      for (std::multimap<size_t, void*>::iterator it = free_list.begin();
+           it != free_list.end(); ++it)
+      {
+         Memory block(nullptr, it->first, MemoryType::HOST,
+                      MemoryType::DEVICE);
+         block.d_ptr = it->second;
+         base->Dealloc(block);
+      }
+      delete base;
+   }
+   void Alloc(Memory &m)
+   {
+      const size_t sc = PoolSizeClass(m.bytes);
+      const std::multimap<size_t, void*>::iterator it = free_list.find(sc);
+      if (it != free_list.end())
+      {
+         m.d_ptr = it->second;
+         free_list.erase(it);
+         return;
+      }
+      // Allocate the full size class so the buffer can be reused by any
+      // request from the same class.
+      Memory block(m.h_ptr, sc, m.h_mt, m.d_mt);
+      base->Alloc(block);
+      m.d_ptr = block.d_ptr;
+   }
+   void Dealloc(Memory &m)
+   { free_list.insert(std::make_pair(PoolSizeClass(m.bytes), m.d_ptr)); }
+   void Protect(const Memory &m) { base->Protect(m); }
+   void Unprotect(const Memory &m) { base->Unprotect(m); }
+   void AliasProtect(const void *ptr, size_t bytes)
+   { base->AliasProtect(ptr, bytes); }
+   void AliasUnprotect(const void *ptr, size_t bytes)
+   { base->AliasUnprotect(ptr, bytes); }
+   void *HtoD(void *dst, const void *src, size_t bytes)
+   { return base->HtoD(dst, src, bytes); }
+   void *DtoD(void *dst, const void *src, size_t bytes)
+   { return base->DtoD(dst, src, bytes); }
+   void *DtoH(void *dst, const void *src, size_t bytes)
+   { return base->DtoH(dst, src, bytes); }
+   void *HtoDAsync(void *dst, const void *src, size_t bytes)
+   { return base->HtoDAsync(dst, src, bytes); }
+   void *DtoHAsync(void *dst, const void *src, size_t bytes)
+   { return base->DtoHAsync(dst, src, bytes); }
+};
+
 #ifndef MFEM_USE_UMPIRE
 class UmpireHostMemorySpace : public NoHostMemorySpace { };
 class UmpireDeviceMemorySpace : public NoDeviceMemorySpace { };
@@ -575,6 +917,18 @@ public:
       // HOST_DEBUG is delayed, as it reroutes signals
       host[static_cast<int>(MT::HOST_DEBUG)] = nullptr;
       host[static_cast<int>(MT::HOST_UMPIRE)] = new UmpireHostMemorySpace();
+      // MFEM_PINNED_POOL=<MiB> enables pooled pinned allocations, see
+      // MemoryManager::SetPinnedMemoryPool()
+      if (const char *env = std::getenv("MFEM_PINNED_POOL"))
+      {
+         const long mib = std::atol(env);
+         pinned_mem_pool = (mib > 0);
+         if (mib > 0) { pinned_mem_pool_max = (size_t) mib << 20; }
+      }
+      host[static_cast<int>(MT::HOST_PINNED)] =
+         pinned_mem_pool ? new PooledHostPinnedMemorySpace()
+         : new HostPinnedMemorySpace();
+      host[static_cast<int>(MT::HOST_SHARED)] = new SharedHostMemorySpace();
       host[static_cast<int>(MT::MANAGED)] = new UvmHostMemorySpace();
 
       // Filling the device memory backends, shifting with the device size
@@ -629,14 +983,16 @@ private:
          case MT::DEVICE_DEBUG: return new MmuDeviceMemorySpace();
          case MT::DEVICE:
          {
+            DeviceMemorySpace *dev = nullptr;
 #if defined(MFEM_USE_CUDA)
-            return new CudaDeviceMemorySpace();
+            dev = new CudaDeviceMemorySpace();
 #elif defined(MFEM_USE_HIP)
-            return new HipDeviceMemorySpace();
+            dev = new HipDeviceMemorySpace();
 #else
             MFEM_ABORT("No device memory controller!");
-            break;
 #endif
+            if (device_mem_pool) { dev = new PooledDeviceMemorySpace(dev); }
+            return dev;
          }
          default: MFEM_ABORT("Unknown device memory controller!");
       }
@@ -874,6 +1230,32 @@ void *MemoryManager::Write_(void *h_ptr, MemoryType h_mt, MemoryClass mc,
    }
 }
 
+void MemoryManager::Prefetch_(void *h_ptr, MemoryType h_mt, MemoryClass mc,
+                              size_t bytes, unsigned &flags)
+{
+   CheckHostMemoryType_(h_mt, h_ptr);
+   if (bytes > 0) { MFEM_VERIFY(flags & Mem::REGISTERED,""); }
+   MFEM_ASSERT(MemoryClassCheck_(mc, h_ptr, h_mt, bytes, flags),"");
+   // Same flag updates as Read_, with the copies issued asynchronously; the
+   // kernels consuming the prefetched data run on the same (default) stream,
+   // so marking the destination valid at issue time is safe.
+   if (IsHostMemory(GetMemoryType(mc)) && mc < MemoryClass::DEVICE)
+   {
+      const bool copy = !(flags & Mem::VALID_HOST);
+      flags |= Mem::VALID_HOST;
+      if (flags & Mem::ALIAS) { mm.GetAliasHostPtr(h_ptr, bytes, copy, true); }
+      else { mm.GetHostPtr(h_ptr, bytes, copy, true); }
+   }
+   else
+   {
+      const bool copy = !(flags & Mem::VALID_DEVICE);
+      flags |= Mem::VALID_DEVICE;
+      if (flags & Mem::ALIAS)
+      { mm.GetAliasDevicePtr(h_ptr, bytes, copy, true); }
+      else { mm.GetDevicePtr(h_ptr, bytes, copy, true); }
+   }
+}
+
 void MemoryManager::SyncAlias_(const void *base_h_ptr, void *alias_h_ptr,
                                size_t alias_bytes, unsigned base_flags,
                                unsigned &alias_flags)
@@ -1084,12 +1466,11 @@ void MemoryManager::Insert(void *h_ptr, size_t bytes,
       return;
    }
    MFEM_VERIFY_TYPES(h_mt, d_mt);
-#ifdef MFEM_DEBUG
    auto res =
-#endif
       maps->memories.emplace(h_ptr, internal::Memory(h_ptr, bytes, h_mt, d_mt));
+   if (res.second) { AccountAlloc(h_mt, bytes); }
 #ifdef MFEM_DEBUG
-   if (res.second == false)
+   else
    {
       auto &m = res.first->second;
       MFEM_VERIFY(m.bytes >= bytes && m.h_mt == h_mt && m.d_mt == d_mt,
@@ -1107,6 +1488,7 @@ void MemoryManager::InsertDevice(void *d_ptr, void *h_ptr, size_t bytes,
    internal::Memory &mem = maps->memories.at(h_ptr);
    if (d_ptr == NULL) { ctrl->Device(d_mt)->Alloc(mem); }
    else { mem.d_ptr = d_ptr; }
+   AccountAlloc(d_mt, bytes);
 }
 
 void MemoryManager::InsertAlias(const void *base_ptr, void *alias_ptr,
@@ -1150,7 +1532,12 @@ void MemoryManager::Erase(void *h_ptr, bool free_dev_ptr)
    auto mem_map_iter = maps->memories.find(h_ptr);
    if (mem_map_iter == maps->memories.end()) { mfem_error("Unknown pointer!"); }
    internal::Memory &mem = mem_map_iter->second;
-   if (mem.d_ptr && free_dev_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem);}
+   AccountDealloc(mem.h_mt, mem.bytes);
+   if (mem.d_ptr)
+   {
+      if (free_dev_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem); }
+      AccountDealloc(mem.d_mt, mem.bytes);
+   }
    maps->memories.erase(mem_map_iter);
 }
 
@@ -1165,7 +1552,7 @@ void MemoryManager::EraseAlias(void *alias_ptr)
 }
 
 void *MemoryManager::GetDevicePtr(const void *h_ptr, size_t bytes,
-                                  bool copy_data)
+                                  bool copy_data, bool async)
 {
    if (!h_ptr)
    {
@@ -1176,20 +1563,27 @@ void *MemoryManager::GetDevicePtr(const void *h_ptr, size_t bytes,
    const MemoryType &h_mt = mem.h_mt;
    const MemoryType &d_mt = mem.d_mt;
    MFEM_VERIFY_TYPES(h_mt, d_mt);
-   if (!mem.d_ptr) { ctrl->Device(d_mt)->Alloc(mem); }
+   if (!mem.d_ptr)
+   {
+      ctrl->Device(d_mt)->Alloc(mem);
+      AccountAlloc(d_mt, mem.bytes);
+   }
    // Aliases might have done some protections
    ctrl->Device(d_mt)->Unprotect(mem);
    if (copy_data)
    {
       MFEM_ASSERT(bytes <= mem.bytes, "invalid copy size");
-      ctrl->Device(d_mt)->HtoD(mem.d_ptr, h_ptr, bytes);
+      if (trace_transfers || transfer_guard_bytes)
+      { RecordTransfer(true, bytes, mem.label.c_str()); }
+      if (async) { ctrl->Device(d_mt)->HtoDAsync(mem.d_ptr, h_ptr, bytes); }
+      else { ctrl->Device(d_mt)->HtoD(mem.d_ptr, h_ptr, bytes); }
    }
    ctrl->Host(h_mt)->Protect(mem, bytes);
    return mem.d_ptr;
 }
 
 void *MemoryManager::GetAliasDevicePtr(const void *alias_ptr, size_t bytes,
-                                       bool copy)
+                                       bool copy, bool async)
 {
    if (!alias_ptr)
    {
@@ -1205,7 +1599,11 @@ void *MemoryManager::GetAliasDevicePtr(const void *alias_ptr, size_t bytes,
    const MemoryType &h_mt = mem.h_mt;
    const MemoryType &d_mt = mem.d_mt;
    MFEM_VERIFY_TYPES(h_mt, d_mt);
-   if (!mem.d_ptr) { ctrl->Device(d_mt)->Alloc(mem); }
+   if (!mem.d_ptr)
+   {
+      ctrl->Device(d_mt)->Alloc(mem);
+      AccountAlloc(d_mt, mem.bytes);
+   }
    void *alias_h_ptr = static_cast<char*>(mem.h_ptr) + offset;
    void *alias_d_ptr = static_cast<char*>(mem.d_ptr) + offset;
    MFEM_ASSERT(alias_h_ptr == alias_ptr, "internal error");
@@ -1213,12 +1611,19 @@ void *MemoryManager::GetAliasDevicePtr(const void *alias_ptr, size_t bytes,
    mem.d_rw = false;
    ctrl->Device(d_mt)->AliasUnprotect(alias_d_ptr, bytes);
    ctrl->Host(h_mt)->AliasUnprotect(alias_ptr, bytes);
-   if (copy) { ctrl->Device(d_mt)->HtoD(alias_d_ptr, alias_h_ptr, bytes); }
+   if (copy)
+   {
+      if (trace_transfers || transfer_guard_bytes)
+      { RecordTransfer(true, bytes, mem.label.c_str()); }
+      if (async) { ctrl->Device(d_mt)->HtoDAsync(alias_d_ptr, alias_h_ptr, bytes); }
+      else { ctrl->Device(d_mt)->HtoD(alias_d_ptr, alias_h_ptr, bytes); }
+   }
    ctrl->Host(h_mt)->AliasProtect(alias_ptr, bytes);
    return alias_d_ptr;
 }
 
-void *MemoryManager::GetHostPtr(const void *ptr, size_t bytes, bool copy)
+void *MemoryManager::GetHostPtr(const void *ptr, size_t bytes, bool copy,
+                                bool async)
 {
    const internal::Memory &mem = maps->memories.at(ptr);
    MFEM_ASSERT(mem.h_ptr == ptr, "internal error");
@@ -1229,13 +1634,19 @@ void *MemoryManager::GetHostPtr(const void *ptr, size_t bytes, bool copy)
    // Aliases might have done some protections
    ctrl->Host(h_mt)->Unprotect(mem, bytes);
    if (mem.d_ptr) { ctrl->Device(d_mt)->Unprotect(mem); }
-   if (copy && mem.d_ptr) { ctrl->Device(d_mt)->DtoH(mem.h_ptr, mem.d_ptr, bytes); }
+   if (copy && mem.d_ptr)
+   {
+      if (trace_transfers || transfer_guard_bytes)
+      { RecordTransfer(false, bytes, mem.label.c_str()); }
+      if (async) { ctrl->Device(d_mt)->DtoHAsync(mem.h_ptr, mem.d_ptr, bytes); }
+      else { ctrl->Device(d_mt)->DtoH(mem.h_ptr, mem.d_ptr, bytes); }
+   }
    if (mem.d_ptr) { ctrl->Device(d_mt)->Protect(mem); }
    return mem.h_ptr;
 }
 
 void *MemoryManager::GetAliasHostPtr(const void *ptr, size_t bytes,
-                                     bool copy_data)
+                                     bool copy_data, bool async)
 {
    const internal::Alias &alias = maps->aliases.at(ptr);
    const internal::Memory *const mem = alias.mem;
@@ -1249,7 +1660,13 @@ void *MemoryManager::GetAliasHostPtr(const void *ptr, size_t bytes,
    ctrl->Host(h_mt)->AliasUnprotect(alias_h_ptr, bytes);
    if (mem->d_ptr) { ctrl->Device(d_mt)->AliasUnprotect(alias_d_ptr, bytes); }
    if (copy_data && mem->d_ptr)
-   { ctrl->Device(d_mt)->DtoH(const_cast<void*>(ptr), alias_d_ptr, bytes); }
+   {
+      if (trace_transfers || transfer_guard_bytes)
+      { RecordTransfer(false, bytes, mem->label.c_str()); }
+      if (async)
+      { ctrl->Device(d_mt)->DtoHAsync(const_cast<void*>(ptr), alias_d_ptr, bytes); }
+      else { ctrl->Device(d_mt)->DtoH(const_cast<void*>(ptr), alias_d_ptr, bytes); }
+   }
    if (mem->d_ptr) { ctrl->Device(d_mt)->AliasProtect(alias_d_ptr, bytes); }
    return alias_h_ptr;
 }
@@ -1257,6 +1674,10 @@ void *MemoryManager::GetAliasHostPtr(const void *ptr, size_t bytes,
 void MemoryManager::Init()
 {
    if (exists) { return; }
+   if (const char *env = std::getenv("MFEM_NUMA_POLICY"))
+   {
+      SetNumaPolicy(env);
+   }
    maps = new internal::Maps();
    ctrl = new internal::Ctrl();
    ctrl->Configure();
@@ -1275,6 +1696,29 @@ void MemoryManager::Configure(const MemoryType host_mt,
    device_mem_type = device_mt;
 }
 
+void MemoryManager::SetDeviceMemoryPool(bool enable)
+{
+   device_mem_pool = enable;
+}
+
+void MemoryManager::SetPinnedMemoryPool(bool enable, size_t max_cached_bytes)
+{
+   pinned_mem_pool = enable;
+   pinned_mem_pool_max = max_cached_bytes;
+}
+
+void MemoryManager::SetNumaPolicy(const char *policy)
+{
+   if (!policy || !strcmp(policy, "default")) { numa_policy = NUMA_DEFAULT; }
+   else if (!strcmp(policy, "firsttouch")) { numa_policy = NUMA_FIRST_TOUCH; }
+   else if (!strcmp(policy, "interleave")) { numa_policy = NUMA_INTERLEAVE; }
+   else
+   {
+      MFEM_WARNING("unknown NUMA policy '" << policy << "', expected "
+                   "'firsttouch', 'interleave' or 'default'");
+   }
+}
+
 #ifdef MFEM_USE_UMPIRE
 void MemoryManager::SetUmpireAllocatorNames(const char *h_name,
                                             const char *d_name)
@@ -1294,6 +1738,8 @@ void MemoryManager::Destroy()
       if (mem_h_ptr) { ctrl->Host(mem.h_mt)->Dealloc(mem.h_ptr); }
       if (mem.d_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem); }
    }
+   for (int i = 0; i < MemoryTypeSize; i++) { live_bytes[i] = 0; }
+   ResetTransferStats();
    delete maps; maps = nullptr;
    delete ctrl; ctrl = nullptr;
    host_mem_type = MemoryType::HOST;
@@ -1344,6 +1790,127 @@ int MemoryManager::PrintAliases(std::ostream &out)
    return n_out;
 }
 
+void MemoryManager::AccountAlloc(MemoryType mt, size_t bytes)
+{
+   const int i = static_cast<int>(mt);
+   live_bytes[i] += bytes;
+   if (live_bytes[i] > peak_bytes[i]) { peak_bytes[i] = live_bytes[i]; }
+}
+
+void MemoryManager::AccountDealloc(MemoryType mt, size_t bytes)
+{
+   const int i = static_cast<int>(mt);
+   MFEM_ASSERT(live_bytes[i] >= bytes, "memory accounting error");
+   live_bytes[i] -= bytes;
+}
+
+void MemoryManager::RecordTransfer(bool to_device, size_t bytes,
+                                   const char *label)
+{
+   const char *key = transfer_tag ? transfer_tag :
+                     (label && label[0]) ? label : "<untagged>";
+   if (transfer_guard_bytes && bytes > transfer_guard_bytes)
+   {
+      MFEM_ABORT("guarded " << (to_device ? "host-to-device"
+                                : "device-to-host")
+                 << " transfer of " << bytes << " bytes (limit "
+                 << transfer_guard_bytes << " bytes), tag '" << key << "'");
+   }
+   if (!trace_transfers) { return; }
+   transfer_bytes[to_device] += bytes;
+   transfer_count[to_device]++;
+   internal::TransferStat &stat = maps->transfers[key];
+   stat.count[to_device]++;
+   stat.bytes[to_device] += bytes;
+}
+
+const char *MemoryManager::SetTransferTag(const char *tag)
+{
+   const char *prev = transfer_tag;
+   transfer_tag = tag;
+   return prev;
+}
+
+void MemoryManager::ResetTransferStats()
+{
+   transfer_bytes[0] = transfer_bytes[1] = 0;
+   transfer_count[0] = transfer_count[1] = 0;
+   if (maps) { maps->transfers.clear(); }
+}
+
+void MemoryManager::PrintTransferStats(std::ostream &out)
+{
+   out << "Traced host<->device transfers (count, bytes):\n"
+       << "  host-to-device: " << transfer_count[1] << ", "
+       << transfer_bytes[1] << '\n'
+       << "  device-to-host: " << transfer_count[0] << ", "
+       << transfer_bytes[0] << '\n';
+   if (!maps->transfers.empty())
+   {
+      out << "By tag (host-to-device count, bytes;"
+          " device-to-host count, bytes):\n";
+      for (const auto &t : maps->transfers)
+      {
+         const internal::TransferStat &stat = t.second;
+         out << "  " << t.first << ": " << stat.count[1] << ", "
+             << stat.bytes[1] << "; " << stat.count[0] << ", "
+             << stat.bytes[0] << '\n';
+      }
+   }
+   out.flush();
+}
+
+void MemoryManager::SetPtrLabel(const void *h_ptr, const char *label)
+{
+   if (!h_ptr) { return; }
+   auto mem_map_iter = maps->memories.find(h_ptr);
+   if (mem_map_iter != maps->memories.end())
+   {
+      mem_map_iter->second.label = label ? label : "";
+      return;
+   }
+   auto alias_map_iter = maps->aliases.find(h_ptr);
+   if (alias_map_iter != maps->aliases.end())
+   {
+      alias_map_iter->second.mem->label = label ? label : "";
+   }
+}
+
+void MemoryManager::PrintUsage(std::ostream &out)
+{
+   out << "Memory usage by type (live/high-water, in bytes):\n";
+   for (int i = 0; i < MemoryTypeSize; i++)
+   {
+      if (live_bytes[i] == 0 && peak_bytes[i] == 0) { continue; }
+      out << "  " << MemoryTypeName[i] << ": "
+          << live_bytes[i] << " / " << peak_bytes[i] << '\n';
+   }
+   // group the registered allocations by label: count, host bytes and
+   // device bytes per label
+   struct LabelUsage { long count; size_t h_bytes, d_bytes; };
+   std::map<std::string, LabelUsage> labels;
+   for (const auto &n : maps->memories)
+   {
+      const internal::Memory &mem = n.second;
+      const std::string &key = mem.label.empty() ? "<unlabeled>" : mem.label;
+      LabelUsage &usage = labels[key]; // zero-initialized when inserted
+      usage.count++;
+      usage.h_bytes += mem.bytes;
+      if (mem.d_ptr) { usage.d_bytes += mem.bytes; }
+   }
+   if (!labels.empty())
+   {
+      out << "Registered allocations by label"
+          " (count, host bytes, device bytes):\n";
+      for (const auto &l : labels)
+      {
+         out << "  " << l.first << ": " << l.second.count << ", "
+             << l.second.h_bytes << ", " << l.second.d_bytes << '\n';
+      }
+   }
+   out.flush();
+}
+
 int MemoryManager::CompareHostAndDevice_(void *h_ptr, size_t size,
                                          unsigned flags)
 {
@@ -1384,6 +1951,15 @@ void MemoryManager::CheckHostMemoryType_(MemoryType h_mt, void *h_ptr)
 
 MemoryManager mm;
 
+size_t MemoryManager::live_bytes[MemoryTypeSize] = { 0, };
+size_t MemoryManager::peak_bytes[MemoryTypeSize] = { 0, };
+
+bool MemoryManager::trace_transfers = false;
+size_t MemoryManager::transfer_guard_bytes = 0;
+const char *MemoryManager::transfer_tag = nullptr;
+size_t MemoryManager::transfer_bytes[2] = { 0, 0 };
+long MemoryManager::transfer_count[2] = { 0, 0 };
+
 bool MemoryManager::exists = false;
 
 #ifdef MFEM_USE_UMPIRE
@@ -1397,6 +1973,7 @@ MemoryType MemoryManager::device_mem_type = MemoryType::HOST;
 const char *MemoryTypeName[MemoryTypeSize] =
 {
    "host-std", "host-32", "host-64", "host-debug", "host-umpire",
+   "host-pinned", "host-shared",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
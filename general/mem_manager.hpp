@@ -32,6 +32,12 @@ enum class MemoryType
    HOST_64,        ///< Host memory; aligned at 64 bytes
    HOST_DEBUG,     ///< Host memory; allocated from a "host-debug" pool
    HOST_UMPIRE,    ///< Host memory; using Umpire
+   HOST_PINNED,    ///< Host memory; page-locked via CUDA or HIP *MallocHost
+   HOST_SHARED,    /**< Host memory; one physical copy per compute node,
+                        shared by all its MPI ranks through an MPI-3
+                        shared-memory window. Allocation and deallocation are
+                        collective over the ranks of a node; without MPI it
+                        falls back to standard allocation. */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -58,7 +64,8 @@ extern const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, MANAGED } */
+                                 HOST_UMPIRE, HOST_PINNED, HOST_SHARED,
+                                 MANAGED } */
    HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
    HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
    DEVICE,  ///< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE, MANAGED }
@@ -227,6 +234,13 @@ public:
    void ClearOwnerFlags() const
    { flags = flags & ~(OWNS_HOST | OWNS_DEVICE | OWNS_INTERNAL); }
 
+   /** @brief Attach a human-readable label to this allocation, shown in the
+       memory usage report of the MemoryManager, see
+       MemoryManager::PrintUsage(). Only allocations registered with the
+       memory manager (e.g. any memory that has been used on a device) can
+       be labeled; for unregistered host memory this method is a no-op. */
+   inline void SetLabel(const char *label);
+
    /// Read the internal device flag.
    bool UseDevice() const { return flags & USE_DEVICE; }
 
@@ -386,6 +400,18 @@ public:
        the same MemoryClass. */
    inline T *Write(MemoryClass mc, int size);
 
+   /// Asynchronously make the memory valid for access with the given
+   /// MemoryClass, overlapping the transfer with other host work.
+   /** Issues the host-device copy that a subsequent Read() or ReadWrite()
+       with the same MemoryClass would otherwise perform synchronously. With
+       the CUDA and HIP backends the copy is issued with *MemcpyAsync on the
+       default stream (use pinned host memory to actually overlap); kernels
+       are launched on the same stream, so they are ordered after the
+       prefetch. Without a device backend the copy is performed immediately.
+
+       The parameter @a size must not exceed the Capacity(). */
+   inline void Prefetch(MemoryClass mc, int size) const;
+
    /// Copy the host/device pointer validity flags from @a other to @a *this.
    /** This method synchronizes the pointer validity flags of two Memory objects
        that use the same host/device pointers, or when @a *this is an alias
@@ -492,6 +518,40 @@ private:
    /// Allow to detect if a global memory manager instance exists.
    static bool exists;
 
+   /// Number of bytes currently registered, per memory type.
+   static size_t live_bytes[MemoryTypeSize];
+
+   /// High-water mark of #live_bytes, per memory type.
+   static size_t peak_bytes[MemoryTypeSize];
+
+   /// Add @a bytes to the live counter of @a mt, updating the high-water
+   /// mark.
+   static void AccountAlloc(MemoryType mt, size_t bytes);
+
+   /// Subtract @a bytes from the live counter of @a mt.
+   static void AccountDealloc(MemoryType mt, size_t bytes);
+
+   /// True while transfer tracing is enabled, see SetTransferTrace().
+   static bool trace_transfers;
+
+   /// Single-transfer size limit in bytes, see SetTransferGuard().
+   static size_t transfer_guard_bytes;
+
+   /// Current source tag charged for traced transfers; may be NULL.
+   static const char *transfer_tag;
+
+   /// Total traced bytes and transfer counts, indexed by direction
+   /// (0 = device-to-host, 1 = host-to-device).
+   static size_t transfer_bytes[2];
+   static long transfer_count[2];
+
+   /** @brief Record a host<->device transfer of @a bytes charged to the
+       current tag, or to the allocation @a label when no tag is set.
+       Aborts when the transfer exceeds the guard limit. Called only when
+       tracing or the guard is active. */
+   static void RecordTransfer(bool to_device, size_t bytes,
+                              const char *label);
+
    /// Return true if the global memory manager instance exists.
    static bool Exists() { return exists; }
 
@@ -539,6 +599,12 @@ private: // Static methods used by the Memory<T> class
    static void *Write_(void *h_ptr, MemoryType h_mt,  MemoryClass mc,
                        size_t bytes, unsigned &flags);
 
+   /// Issue the copy that would validate h_ptr for access with the given
+   /// MemoryClass asynchronously and update the validity flags, see
+   /// Memory<T>::Prefetch().
+   static void Prefetch_(void *h_ptr, MemoryType h_mt, MemoryClass mc,
+                         size_t bytes, unsigned &flags);
+
    static void SyncAlias_(const void *base_h_ptr, void *alias_h_ptr,
                           size_t alias_bytes, unsigned base_flags,
                           unsigned &alias_flags);
@@ -600,19 +666,23 @@ private:
 
    /// Return the corresponding device pointer of h_ptr,
    /// allocating and moving the data if needed
-   void *GetDevicePtr(const void *h_ptr, size_t bytes, bool copy_data);
+   void *GetDevicePtr(const void *h_ptr, size_t bytes, bool copy_data,
+                      bool async = false);
 
    /// Return the corresponding device pointer of alias_ptr,
    /// allocating and moving the data if needed
-   void *GetAliasDevicePtr(const void *alias_ptr, size_t bytes, bool copy_data);
+   void *GetAliasDevicePtr(const void *alias_ptr, size_t bytes, bool copy_data,
+                           bool async = false);
 
    /// Return the corresponding host pointer of d_ptr,
    /// allocating and moving the data if needed
-   void *GetHostPtr(const void *d_ptr, size_t bytes, bool copy_data);
+   void *GetHostPtr(const void *d_ptr, size_t bytes, bool copy_data,
+                    bool async = false);
 
    /// Return the corresponding host pointer of alias_ptr,
    /// allocating and moving the data if needed
-   void *GetAliasHostPtr(const void *alias_ptr, size_t bytes, bool copy_data);
+   void *GetAliasHostPtr(const void *alias_ptr, size_t bytes, bool copy_data,
+                         bool async = false);
 
 public:
    MemoryManager();
@@ -625,6 +695,50 @@ public:
    /// This method will be called when configuring a device.
    void Configure(const MemoryType h_mt, const MemoryType d_mt);
 
+   /** @brief Enable or disable pooling of device memory allocations.
+
+       When enabled, device buffers released through Memory are kept in free
+       lists of power-of-two size classes and reused by subsequent
+       allocations, so that e.g. mesh adaptation cycles which repeatedly
+       resize Vector%s of similar sizes stop calling the device allocator.
+       The pooled buffers are returned to the device when the memory manager
+       is destroyed.
+
+       Must be called before the first device allocation. Has no effect on
+       the DEVICE_DEBUG and DEVICE_UMPIRE memory types: the former exists to
+       detect invalid accesses (which pooling would mask) and the latter
+       provides its own pooling. */
+   static void SetDeviceMemoryPool(bool enable);
+
+   /** @brief Enable or disable pooling of the page-locked (pinned) host
+       allocations, i.e. the HOST_PINNED memory type. */
+   /** Pinned allocations are expensive -- they synchronize the device -- so
+       freed buffers are kept in free lists of power-of-two size classes and
+       reused, retaining at most @a max_cached_bytes of unused pinned memory;
+       buffers evicted over that cap, and all cached buffers at destruction
+       of the memory manager, are returned to the system. The pool can also
+       be enabled with the MFEM_PINNED_POOL environment variable, set to the
+       cap in MiB (0 disables).
+
+       Must be called before the first pinned allocation. */
+   static void SetPinnedMemoryPool(bool enable,
+                                   size_t max_cached_bytes = (size_t) 256 << 20);
+
+   /** @brief Set the NUMA placement policy applied to the large allocations
+       of the default host memory type: "firsttouch", "interleave" or
+       "default". */
+   /** With "firsttouch", the pages of a new allocation are touched up front
+       by all OpenMP threads with the same static schedule as the compute
+       loops, so each page is placed on the NUMA node of the socket that will
+       work on it. With "interleave", the pages are spread round-robin over
+       all NUMA nodes, which evens out the memory traffic of unstructured
+       access patterns. The policy is applied on a best-effort basis to
+       allocations of one MiB and up; already-touched pages keep their
+       placement. The MFEM_NUMA_POLICY environment variable provides the
+       initial setting. Only effective on Linux, silently ignored
+       elsewhere. */
+   static void SetNumaPolicy(const char *policy);
+
 #ifdef MFEM_USE_UMPIRE
    /// Set the host and device UMpire allocator names
    void SetUmpireAllocatorNames(const char *h_name, const char *d_name);
@@ -652,6 +766,72 @@ public:
    /// returning the number of printed pointers
    int PrintAliases(std::ostream &out = mfem::out);
 
+   /** @brief Attach a label to the registered allocation containing
+       @a h_ptr; used by PrintUsage(). Unknown pointers are ignored. Prefer
+       the Memory<T>::SetLabel() wrapper. */
+   void SetPtrLabel(const void *h_ptr, const char *label);
+
+   /** @brief Return the number of bytes of the given MemoryType currently
+       registered with the memory manager.
+
+       Note that host allocations of type MemoryType::HOST are registered
+       only once they are used on a device, so in host-only runs this method
+       generally under-reports the true usage. */
+   static size_t GetLiveBytes(MemoryType mt)
+   { return live_bytes[static_cast<int>(mt)]; }
+
+   /// Return the high-water mark, in bytes, of the given MemoryType.
+   static size_t GetPeakBytes(MemoryType mt)
+   { return peak_bytes[static_cast<int>(mt)]; }
+
+   /** @brief Print the live and high-water number of bytes per MemoryType,
+       followed by the registered allocations grouped by their label, see
+       Memory<T>::SetLabel(). */
+   void PrintUsage(std::ostream &out = mfem::out);
+
+   /** @brief Enable or disable tracing of the host<->device transfers
+       issued when the validity flags of a Memory object are updated, e.g.
+       by Vector::HostRead() on device-valid data.
+
+       While enabled, every such transfer is counted, with its size, in
+       per-direction totals and in a per-tag aggregate keyed by the active
+       SetTransferTag() tag, or by the allocation label when no tag is set.
+       Disabled by default; the tracing adds one branch per pointer access
+       when off. */
+   static void SetTransferTrace(bool enable) { trace_transfers = enable; }
+
+   /** @brief Abort when a single traced host<->device transfer exceeds
+       @a max_bytes; pass 0 (the default) to disable the guard.
+
+       The abort message reports the direction, size and the active
+       tag/label, so CI benchmarks can pinpoint unintended host bounces in
+       hot loops. The guard is active even when transfer tracing is off. */
+   static void SetTransferGuard(size_t max_bytes)
+   { transfer_guard_bytes = max_bytes; }
+
+   /** @brief Set the source tag charged for subsequent traced transfers
+       and return the previous tag, so call sites can restore it.
+
+       The string is not copied: the caller must keep it alive while the
+       tag is active. Pass NULL to charge transfers to allocation labels
+       again. */
+   static const char *SetTransferTag(const char *tag);
+
+   /// Total traced bytes transferred in the given direction.
+   static size_t GetTransferBytes(bool to_device)
+   { return transfer_bytes[to_device]; }
+
+   /// Total number of traced transfers in the given direction.
+   static long GetTransferCount(bool to_device)
+   { return transfer_count[to_device]; }
+
+   /// Reset the traced transfer totals and the per-tag aggregates.
+   static void ResetTransferStats();
+
+   /** @brief Print the traced transfer totals, followed by the count and
+       bytes per direction for every tag/label that triggered a transfer. */
+   void PrintTransferStats(std::ostream &out = mfem::out);
+
    static MemoryType GetHostMemoryType() { return host_mem_type; }
    static MemoryType GetDeviceMemoryType() { return device_mem_type; }
 };
@@ -859,6 +1039,19 @@ inline const T *Memory<T>::Read(MemoryClass mc, int size) const
    return (const T*)MemoryManager::Read_(h_ptr, h_mt, mc, bytes, flags);
 }
 
+template <typename T>
+inline void Memory<T>::Prefetch(MemoryClass mc, int size) const
+{
+   const size_t bytes = size * sizeof(T);
+   if (!(flags & REGISTERED))
+   {
+      if (mc == MemoryClass::HOST) { return; }
+      MemoryManager::Register_(h_ptr, nullptr, capacity*sizeof(T), h_mt,
+                               flags & OWNS_HOST, flags & ALIAS, flags);
+   }
+   MemoryManager::Prefetch_(h_ptr, h_mt, mc, bytes, flags);
+}
+
 template <typename T>
 inline T *Memory<T>::Write(MemoryClass mc, int size)
 {
@@ -983,6 +1176,12 @@ inline int Memory<T>::CompareHostAndDevice(int size) const
 /// The (single) global memory manager object
 extern MemoryManager mm;
 
+template <typename T>
+inline void Memory<T>::SetLabel(const char *label)
+{
+   if (flags & REGISTERED) { mm.SetPtrLabel(h_ptr, label); }
+}
+
 } // namespace mfem
 
 #endif // MFEM_MEM_MANAGER_HPP
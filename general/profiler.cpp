@@ -0,0 +1,295 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "profiler.hpp"
+#include "backends.hpp"
+#include "device.hpp"
+#include "error.hpp"
+#include "tic_toc.hpp"
+
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+#ifdef MFEM_USE_CUDA
+// Pool of CUDA event pairs, one pair per nesting level of the region stack.
+struct ProfilerEventPair
+{
+   cudaEvent_t begin, end;
+};
+#endif
+
+/// One node in the profiler region tree.
+struct ProfilerRegionNode
+{
+   std::string name;
+   int parent;
+   long calls;
+   double total;        ///< accumulated wall-clock time, in seconds
+   double device_total; ///< accumulated CUDA event time, in seconds
+   std::map<std::string,int> children;
+
+   ProfilerRegionNode(const std::string &name_, int parent_)
+      : name(name_), parent(parent_), calls(0), total(0.0), device_total(0.0)
+   { }
+};
+
+/// One active entry on the region stack.
+struct ProfilerFrame
+{
+   int region;
+   double start;
+};
+
+/// One completed region instance, for the chrome-trace output.
+struct ProfilerTraceEvent
+{
+   int region;
+   double start, duration;
+};
+
+struct ProfilerState
+{
+   bool enabled;
+   mfem::StopWatch clock;
+   std::vector<ProfilerRegionNode> regions;
+   std::vector<ProfilerFrame> stack;
+   std::vector<ProfilerTraceEvent> trace;
+#ifdef MFEM_USE_CUDA
+   std::vector<ProfilerEventPair> events;
+#endif
+
+   ProfilerState() : enabled(false) { }
+};
+
+static ProfilerState profiler;
+
+#ifdef MFEM_USE_CUDA
+static bool UseDeviceEvents()
+{
+   return Device::Allows(Backend::CUDA_MASK);
+}
+#endif
+
+// Depth-first walk of the region tree printing one line per node.
+static void PrintRegionNode(std::ostream &out, int node, int depth,
+                            double parent_total)
+{
+   const ProfilerRegionNode &r = profiler.regions[node];
+   if (node > 0)
+   {
+      out << std::setw(10) << r.calls << ' '
+          << std::setw(12) << std::fixed << std::setprecision(6) << r.total;
+      if (r.device_total > 0.0)
+      {
+         out << ' ' << std::setw(12) << r.device_total;
+      }
+      else
+      {
+         out << ' ' << std::setw(12) << ' ';
+      }
+      out << ' ' << std::setw(6) << std::setprecision(1)
+          << (parent_total > 0.0 ? 100.0*r.total/parent_total : 100.0) << "%  ";
+      for (int i = 1; i < depth; i++) { out << "  "; }
+      out << r.name << '\n';
+   }
+   for (std::map<std::string,int>::const_iterator it = r.children.begin();
+        it != r.children.end(); ++it)
+   {
+      PrintRegionNode(out, it->second, depth + 1, node > 0 ? r.total : -1.0);
+   }
+}
+
+static void WriteJSONString(std::ostream &out, const std::string &s)
+{
+   out << '"';
+   for (size_t i = 0; i < s.size(); i++)
+   {
+      const char c = s[i];
+      if (c == '"' || c == '\\') { out << '\\' << c; }
+      else if (static_cast<unsigned char>(c) < 0x20) { out << ' '; }
+      else { out << c; }
+   }
+   out << '"';
+}
+
+} // namespace internal
+
+using namespace internal;
+
+void Profiler::Enable()
+{
+   if (profiler.enabled) { return; }
+   profiler.enabled = true;
+   if (profiler.regions.empty())
+   {
+      // node 0 is the synthetic root holding the top-level regions
+      profiler.regions.push_back(ProfilerRegionNode("<root>", -1));
+      profiler.clock.Start();
+   }
+}
+
+void Profiler::Disable()
+{
+   MFEM_VERIFY(profiler.stack.empty(),
+               "cannot disable the profiler inside an active region");
+   profiler.enabled = false;
+}
+
+bool Profiler::IsEnabled() { return profiler.enabled; }
+
+void Profiler::Clear()
+{
+   MFEM_VERIFY(profiler.stack.empty(),
+               "cannot clear the profiler inside an active region");
+   profiler.regions.clear();
+   profiler.trace.clear();
+   if (profiler.enabled)
+   {
+      profiler.regions.push_back(ProfilerRegionNode("<root>", -1));
+      profiler.clock.Start();
+   }
+}
+
+void Profiler::BeginRegion(const char *name)
+{
+   if (!profiler.enabled) { return; }
+   const int parent = profiler.stack.empty() ? 0 :
+                      profiler.stack.back().region;
+   ProfilerRegionNode &pr = profiler.regions[parent];
+   int node;
+   std::map<std::string,int>::iterator it = pr.children.find(name);
+   if (it != pr.children.end())
+   {
+      node = it->second;
+   }
+   else
+   {
+      node = static_cast<int>(profiler.regions.size());
+      pr.children[name] = node;
+      profiler.regions.push_back(ProfilerRegionNode(name, parent));
+   }
+   ProfilerFrame frame;
+   frame.region = node;
+#ifdef MFEM_USE_CUDA
+   if (UseDeviceEvents())
+   {
+      const size_t depth = profiler.stack.size();
+      if (depth >= profiler.events.size())
+      {
+         ProfilerEventPair pair;
+         MFEM_GPU_CHECK(cudaEventCreate(&pair.begin));
+         MFEM_GPU_CHECK(cudaEventCreate(&pair.end));
+         profiler.events.push_back(pair);
+      }
+      MFEM_GPU_CHECK(cudaEventRecord(profiler.events[depth].begin));
+   }
+#endif
+   frame.start = profiler.clock.RealTime();
+   profiler.stack.push_back(frame);
+}
+
+void Profiler::EndRegion()
+{
+   if (!profiler.enabled) { return; }
+   MFEM_ASSERT(!profiler.stack.empty(), "no active profiler region");
+   const ProfilerFrame frame = profiler.stack.back();
+   const double now = profiler.clock.RealTime();
+   profiler.stack.pop_back();
+   ProfilerRegionNode &r = profiler.regions[frame.region];
+   r.calls++;
+   r.total += now - frame.start;
+#ifdef MFEM_USE_CUDA
+   if (UseDeviceEvents())
+   {
+      const ProfilerEventPair &pair = profiler.events[profiler.stack.size()];
+      MFEM_GPU_CHECK(cudaEventRecord(pair.end));
+      MFEM_GPU_CHECK(cudaEventSynchronize(pair.end));
+      float ms = 0.0f;
+      MFEM_GPU_CHECK(cudaEventElapsedTime(&ms, pair.begin, pair.end));
+      r.device_total += 1e-3*ms;
+   }
+#endif
+   ProfilerTraceEvent event;
+   event.region = frame.region;
+   event.start = frame.start;
+   event.duration = now - frame.start;
+   profiler.trace.push_back(event);
+}
+
+void Profiler::PrintReport(std::ostream &out)
+{
+   MFEM_VERIFY(profiler.stack.empty(),
+               "cannot print the profiler report inside an active region");
+   if (profiler.regions.empty()) { return; }
+   out << "\n     calls    wall [s]   device [s]  %prnt  region\n";
+   PrintRegionNode(out, 0, 0, -1.0);
+   out.flush();
+}
+
+void Profiler::WriteChromeTrace(std::ostream &out)
+{
+   out << "{\"traceEvents\":[";
+   for (size_t i = 0; i < profiler.trace.size(); i++)
+   {
+      const ProfilerTraceEvent &event = profiler.trace[i];
+      if (i > 0) { out << ','; }
+      out << "\n{\"ph\":\"X\",\"pid\":0,\"tid\":0,\"name\":";
+      WriteJSONString(out, profiler.regions[event.region].name);
+      out << ",\"ts\":" << std::fixed << std::setprecision(3)
+          << 1e6*event.start
+          << ",\"dur\":" << 1e6*event.duration << '}';
+   }
+   out << "\n]}\n";
+   out.flush();
+}
+
+#ifdef MFEM_USE_MPI
+void Profiler::PrintSummary(MPI_Comm comm, std::ostream &out)
+{
+   MFEM_VERIFY(profiler.stack.empty(),
+               "cannot print the profiler summary inside an active region");
+   int rank, size;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &size);
+   const int nr = static_cast<int>(profiler.regions.size());
+   std::vector<double> totals(nr), t_min(nr), t_max(nr), t_sum(nr);
+   for (int i = 0; i < nr; i++) { totals[i] = profiler.regions[i].total; }
+   MPI_Reduce(totals.data(), t_min.data(), nr, MPI_DOUBLE, MPI_MIN, 0, comm);
+   MPI_Reduce(totals.data(), t_max.data(), nr, MPI_DOUBLE, MPI_MAX, 0, comm);
+   MPI_Reduce(totals.data(), t_sum.data(), nr, MPI_DOUBLE, MPI_SUM, 0, comm);
+   if (rank != 0) { return; }
+   out << "\n    min [s]      max [s]      avg [s]   calls  region\n";
+   for (int i = 1; i < nr; i++)
+   {
+      const ProfilerRegionNode &r = profiler.regions[i];
+      out << std::setw(11) << std::fixed << std::setprecision(6) << t_min[i]
+          << ' ' << std::setw(12) << t_max[i]
+          << ' ' << std::setw(12) << t_sum[i]/size
+          << ' ' << std::setw(7) << r.calls << "  ";
+      int depth = 0;
+      for (int p = r.parent; p > 0; p = profiler.regions[p].parent)
+      { depth++; }
+      for (int d = 0; d < depth; d++) { out << "  "; }
+      out << r.name << '\n';
+   }
+   out.flush();
+}
+#endif
+
+} // namespace mfem
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_PROFILER
+#define MFEM_PROFILER
+
+#include "../config/config.hpp"
+#include "globals.hpp"
+
+#ifdef MFEM_USE_MPI
+#include <mpi.h>
+#endif
+
+#include <iostream>
+
+namespace mfem
+{
+
+/** @brief Lightweight hierarchical profiler with scoped regions.
+
+    The profiler maintains a tree of named regions: entering a region while
+    another one is active makes it a child of the active region, so the same
+    region name can appear at several places in the tree with separately
+    accumulated statistics. Regions are usually created with the RAII macro
+    #MFEM_PROFILE_SCOPE which has negligible overhead when profiling is
+    disabled (the default).
+
+    When the CUDA backend is enabled, each region additionally measures the
+    device time spent between its begin and end points using CUDA events, so
+    kernels launched asynchronously through MFEM_FORALL are attributed to the
+    region that launched them.
+
+    The profiler is not thread-safe; regions must be entered and exited from
+    the same (host) thread. */
+class Profiler
+{
+public:
+   /// Enable the profiler and start the global clock.
+   static void Enable();
+
+   /// Disable the profiler. Accumulated statistics are kept.
+   static void Disable();
+
+   /// Return true if the profiler is currently enabled.
+   static bool IsEnabled();
+
+   /// Discard all accumulated statistics and trace events.
+   static void Clear();
+
+   /** @brief Enter the region @a name, making it a child of the currently
+       active region. Prefer the macro #MFEM_PROFILE_SCOPE. */
+   static void BeginRegion(const char *name);
+
+   /// Exit the most recently entered region.
+   static void EndRegion();
+
+   /** @brief Print an indented report of the region tree with call counts,
+       total wall-clock time and, when available, device time. */
+   static void PrintReport(std::ostream &out = mfem::out);
+
+   /** @brief Write all recorded region instances as a chrome-trace JSON
+       document ("traceEvents" array) that can be loaded in the
+       chrome://tracing or Perfetto viewers. */
+   static void WriteChromeTrace(std::ostream &out);
+
+#ifdef MFEM_USE_MPI
+   /** @brief Print, on rank 0 of @a comm, the region tree with min/max/avg
+       wall-clock times over the ranks. All ranks must call this method and
+       must have entered the same regions in the same order. */
+   static void PrintSummary(MPI_Comm comm, std::ostream &out = mfem::out);
+#endif
+};
+
+/// RAII helper entering a profiler region for the lifetime of the object.
+class ProfilerRegion
+{
+   const bool active;
+
+public:
+   ProfilerRegion(const char *name) : active(Profiler::IsEnabled())
+   { if (active) { Profiler::BeginRegion(name); } }
+
+   ~ProfilerRegion() { if (active) { Profiler::EndRegion(); } }
+};
+
+} // namespace mfem
+
+/// Time the enclosing scope as the profiler region @a name.
+#define MFEM_PROFILE_SCOPE(name) \
+   mfem::ProfilerRegion mfem_profiler_region_scope_(name)
+
+#endif
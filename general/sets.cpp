@@ -15,6 +15,55 @@
 namespace mfem
 {
 
+void DisjointSets::SetSize(int size)
+{
+   parent.SetSize(size);
+   rank.SetSize(size);
+   for (int i = 0; i < size; i++)
+   {
+      parent[i] = i;
+      rank[i] = 0;
+   }
+}
+
+int DisjointSets::Find(int i)
+{
+   int root = i;
+   while (parent[root] != root)
+   {
+      root = parent[root];
+   }
+   // compress the path traversed above
+   while (parent[i] != root)
+   {
+      const int next = parent[i];
+      parent[i] = root;
+      i = next;
+   }
+   return root;
+}
+
+int DisjointSets::Union(int i, int j)
+{
+   i = Find(i);
+   j = Find(j);
+   if (i == j)
+   {
+      return i;
+   }
+   if (rank[i] < rank[j])
+   {
+      Swap(i, j);
+   }
+   parent[j] = i;
+   if (rank[i] == rank[j])
+   {
+      rank[i]++;
+   }
+   return i;
+}
+
+
 IntegerSet::IntegerSet(IntegerSet &s)
    : me(s.me.Size())
 {
@@ -79,26 +128,45 @@ void IntegerSet::Recreate(const int n, const int *p)
 }
 
 
+// FNV-1a hash of the (sorted) entries of a set.
+static size_t SetHash(Array<int> &s)
+{
+   size_t h = (size_t) 0xcbf29ce484222325ull;
+   for (int i = 0; i < s.Size(); i++)
+   {
+      h = (h ^ (size_t) s[i]) * (size_t) 0x100000001b3ull;
+   }
+   return h;
+}
+
 int ListOfIntegerSets::Insert(IntegerSet &s)
 {
-   for (int i = 0; i < TheList.Size(); i++)
-      if (*TheList[i] == s)
+   const size_t h = SetHash(s);
+   auto range = hash_index.equal_range(h);
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      if (*TheList[it->second] == s)
       {
-         return i;
+         return it->second;
       }
+   }
 
    TheList.Append(new IntegerSet(s));
+   hash_index.emplace(h, TheList.Size()-1);
 
    return TheList.Size()-1;
 }
 
 int ListOfIntegerSets::Lookup(IntegerSet &s)
 {
-   for (int i = 0; i < TheList.Size(); i++)
-      if (*TheList[i] == s)
+   auto range = hash_index.equal_range(SetHash(s));
+   for (auto it = range.first; it != range.second; ++it)
+   {
+      if (*TheList[it->second] == s)
       {
-         return i;
+         return it->second;
       }
+   }
 
    mfem_error("ListOfIntegerSets::Lookup (), integer set not found.");
    return -1;
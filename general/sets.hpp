@@ -16,9 +16,38 @@
 #include "array.hpp"
 #include "table.hpp"
 
+#include <unordered_map>
+
 namespace mfem
 {
 
+/** @brief A disjoint-set (union-find) structure over the integers 0, ...,
+    size-1, stored in flat arrays with union by rank and path compression, so
+    that any sequence of n Union() and Find() operations costs effectively
+    O(n). */
+class DisjointSets
+{
+private:
+   Array<int> parent, rank;
+
+public:
+   /// Create @a size singleton sets {0}, {1}, ..., {size-1}.
+   explicit DisjointSets(int size = 0) { SetSize(size); }
+
+   /// Reset the structure to @a size singleton sets, discarding all unions.
+   void SetSize(int size);
+
+   /// Return the number of elements.
+   int Size() const { return parent.Size(); }
+
+   /// Return the representative element of the set containing @a i.
+   int Find(int i);
+
+   /** @brief Merge the sets containing @a i and @a j. Returns the
+       representative element of the merged set. */
+   int Union(int i, int j);
+};
+
 /// A set of integers
 class IntegerSet
 {
@@ -60,6 +89,9 @@ class ListOfIntegerSets
 {
 private:
    Array<IntegerSet *> TheList;
+   /// Hash of each set's entries -> its index in #TheList, so that Insert()
+   /// and Lookup() avoid scanning the whole list.
+   std::unordered_multimap<size_t, int> hash_index;
 
 public:
 
@@ -13,7 +13,12 @@
 #define MFEM_SORT_PAIRS
 
 #include "../config/config.hpp"
+#include "array.hpp"
 #include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
 
 namespace mfem
 {
@@ -83,6 +88,91 @@ void SortTriple (Triple<A, B, C> *triples, int size)
    std::sort(triples, triples + size);
 }
 
+namespace internal
+{
+
+// Shared implementation of ParallelSort and ParallelStableSort: sort the two
+// halves of the range (recursively, in separate threads) and merge them. The
+// merge is stable, so the stable variant only needs stable leaf sorts.
+template <class Iterator, class Compare>
+void ParallelSortRange(Iterator first, Iterator last, Compare comp,
+                       int levels, bool stable)
+{
+   const std::ptrdiff_t n = last - first;
+   if (levels <= 0 || n < 100000)
+   {
+      if (stable) { std::stable_sort(first, last, comp); }
+      else { std::sort(first, last, comp); }
+      return;
+   }
+   const Iterator mid = first + n/2;
+   std::thread worker([=]()
+   { ParallelSortRange(first, mid, comp, levels - 1, stable); });
+   ParallelSortRange(mid, last, comp, levels - 1, stable);
+   worker.join();
+   std::inplace_merge(first, mid, last, comp);
+}
+
+// Number of times a range can be split before the number of pieces exceeds
+// the hardware concurrency.
+inline int ParallelSortLevels()
+{
+   const unsigned hw = std::thread::hardware_concurrency();
+   int levels = 0;
+   for (unsigned pieces = 1; pieces < hw; pieces *= 2) { levels++; }
+   return levels;
+}
+
+} // namespace mfem::internal
+
+/** @brief Sort the range [first,last) with respect to @a comp using multiple
+    threads.
+
+    Small ranges (under 100k entries) are sorted serially; larger ones are
+    split across the available hardware threads with a final parallel merge.
+    Equivalent elements are not kept in order, see ParallelStableSort(). */
+template <class Iterator, class Compare>
+void ParallelSort(Iterator first, Iterator last, Compare comp)
+{
+   internal::ParallelSortRange(first, last, comp,
+                               internal::ParallelSortLevels(), false);
+}
+
+/// Sort the range [first,last) with operator< using multiple threads.
+template <class Iterator>
+void ParallelSort(Iterator first, Iterator last)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type value_type;
+   ParallelSort(first, last, std::less<value_type>());
+}
+
+/** @brief Stable sort of the range [first,last) with respect to @a comp
+    using multiple threads: equivalent elements keep their relative order. */
+template <class Iterator, class Compare>
+void ParallelStableSort(Iterator first, Iterator last, Compare comp)
+{
+   internal::ParallelSortRange(first, last, comp,
+                               internal::ParallelSortLevels(), true);
+}
+
+/// Stable sort of the range [first,last) with operator< in multiple threads.
+template <class Iterator>
+void ParallelStableSort(Iterator first, Iterator last)
+{
+   typedef typename std::iterator_traits<Iterator>::value_type value_type;
+   ParallelStableSort(first, last, std::less<value_type>());
+}
+
+/** @brief Sort @a list using multiple threads and remove the duplicate
+    entries, like Array::Sort() followed by Array::Unique(). */
+template <class T>
+void ParallelSortUnique(Array<T> &list)
+{
+   ParallelSort(list.begin(), list.end());
+   T *new_end = std::unique(list.begin(), list.end());
+   list.SetSize(static_cast<int>(new_end - list.begin()));
+}
+
 }
 
 #endif
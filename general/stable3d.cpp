@@ -13,22 +13,36 @@
 #include "error.hpp"
 #include "stable3d.hpp"
 
+#include <cstdint>
+
 using namespace std;
 
 namespace mfem
 {
 
-STable3D::STable3D (int nr)
+// 64-bit mix of a sorted triplet, finalized as in MurmurHash3 so that all
+// bits of the slot index depend on all three entries.
+static inline uint64_t TripletHash (int r, int c, int f)
 {
-   int i;
+   uint64_t h = (uint64_t) r * 0x9e3779b97f4a7c15ull;
+   h ^= (uint64_t) c + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+   h ^= (uint64_t) f + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+   h ^= h >> 33;
+   h *= 0xff51afd7ed558ccdull;
+   h ^= h >> 33;
+   return h;
+}
 
-   Size = nr;
-   Rows = new STable3DNode *[nr];
-   for (i = 0; i < nr; i++)
-   {
-      Rows[i] = NULL;
-   }
+STable3D::STable3D (int nr)
+{
    NElem = 0;
+   // a tet mesh with 'nr' vertices has roughly 10*nr faces; start at about
+   // half that and keep the load factor below 1/2, doubling as needed
+   capacity = 16;
+   while (capacity < 4*nr) { capacity *= 2; }
+   mask = capacity - 1;
+   slots.SetSize(4*capacity);
+   slots = -1;
 }
 
 inline void Sort3 (int &r, int &c, int &f)
@@ -61,34 +75,58 @@ inline void Sort3 (int &r, int &c, int &f)
    }
 }
 
-int STable3D::Push (int r, int c, int f)
+int STable3D::FindSlot (int r, int c, int f) const
 {
-   STable3DNode *node;
+   int s = (int)(TripletHash(r, c, f) & (uint64_t) mask);
+   while (true)
+   {
+      const int *slot = &slots[4*s];
+      if (slot[0] < 0 || (slot[0] == r && slot[1] == c && slot[2] == f))
+      {
+         return s;
+      }
+      s = (s + 1) & mask;
+   }
+}
+
+void STable3D::Grow ()
+{
+   Array<int> old_slots;
+   mfem::Swap(old_slots, slots);
 
+   capacity *= 2;
+   mask = capacity - 1;
+   slots.SetSize(4*capacity);
+   slots = -1;
+
+   for (int s = 0; s < old_slots.Size(); s += 4)
+   {
+      if (old_slots[s] < 0) { continue; }
+      const int ns = FindSlot(old_slots[s], old_slots[s+1], old_slots[s+2]);
+      for (int k = 0; k < 4; k++) { slots[4*ns+k] = old_slots[s+k]; }
+   }
+}
+
+int STable3D::Push (int r, int c, int f)
+{
    MFEM_ASSERT(r != c && c != f && f != r,
                "STable3D::Push : r = " << r << ", c = " << c << ", f = " << f);
 
    Sort3 (r, c, f);
 
-   for (node = Rows[r]; node != NULL; node = node->Prev)
+   if (2*(NElem + 1) > capacity) { Grow(); }
+
+   const int s = FindSlot(r, c, f);
+   int *slot = &slots[4*s];
+   if (slot[0] >= 0)
    {
-      if (node->Column == c)
-         if (node->Floor == f)
-         {
-            return node->Number;
-         }
+      return slot[3];
    }
 
-#ifdef MFEM_USE_MEMALLOC
-   node = NodesMem.Alloc ();
-#else
-   node = new STable3DNode;
-#endif
-   node->Column = c;
-   node->Floor  = f;
-   node->Number = NElem;
-   node->Prev   = Rows[r];
-   Rows[r] = node;
+   slot[0] = r;
+   slot[1] = c;
+   slot[2] = f;
+   slot[3] = NElem;
 
    NElem++;
    return (NElem-1);
@@ -96,17 +134,12 @@ int STable3D::Push (int r, int c, int f)
 
 int STable3D::operator() (int r, int c, int f) const
 {
-   STable3DNode *node;
-
    Sort3 (r, c, f);
 
-   for (node = Rows[r]; node != NULL; node = node->Prev)
+   const int s = FindSlot(r, c, f);
+   if (slots[4*s] >= 0)
    {
-      if (node->Column == c)
-         if (node->Floor == f)
-         {
-            return node->Number;
-         }
+      return slots[4*s+3];
    }
 
    MFEM_ABORT("(r,c,f) = (" << r << "," << c << "," << f << ")");
@@ -116,20 +149,10 @@ int STable3D::operator() (int r, int c, int f) const
 
 int STable3D::Index (int r, int c, int f) const
 {
-   STable3DNode *node;
-
    Sort3 (r, c, f);
 
-   for (node = Rows[r]; node != NULL; node = node->Prev)
-   {
-      if (node->Column == c)
-         if (node->Floor == f)
-         {
-            return node->Number;
-         }
-   }
-
-   return -1;
+   const int s = FindSlot(r, c, f);
+   return (slots[4*s] >= 0) ? slots[4*s+3] : -1;
 }
 
 int STable3D::Push4 (int r, int c, int f, int t)
@@ -185,38 +208,26 @@ int STable3D::operator() (int r, int c, int f, int t) const
 
 STable3D::~STable3D ()
 {
-#ifdef MFEM_USE_MEMALLOC
-   // NodesMem.Clear();  // this is done implicitly
-#else
-   for (int i = 0; i < Size; i++)
-   {
-      STable3DNode *aux, *node_p = Rows[i];
-      while (node_p != NULL)
-      {
-         aux = node_p;
-         node_p = node_p->Prev;
-         delete aux;
-      }
-   }
-#endif
-   delete [] Rows;
 }
 
 void STable3D::Print(std::ostream & out) const
 {
    out << NElem << endl;
-   for (int row = 0; row < Size; row++)
+   // list the triplets ordered by their assigned numbers
+   Array<int> entries(3*NElem);
+   for (int s = 0; s < capacity; s++)
    {
-      STable3DNode *node_p = Rows[row];
-      while (node_p != NULL)
-      {
-         out << row
-             << ' ' << node_p->Column
-             << ' ' << node_p->Floor
-             << ' ' << node_p->Number
-             << endl;
-         node_p = node_p->Prev;
-      }
+      const int *slot = &slots[4*s];
+      if (slot[0] < 0) { continue; }
+      for (int k = 0; k < 3; k++) { entries[3*slot[3]+k] = slot[k]; }
+   }
+   for (int i = 0; i < NElem; i++)
+   {
+      out << entries[3*i]
+          << ' ' << entries[3*i+1]
+          << ' ' << entries[3*i+2]
+          << ' ' << i
+          << endl;
    }
 }
 
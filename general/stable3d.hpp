@@ -12,37 +12,39 @@
 #ifndef MFEM_STABLE3D
 #define MFEM_STABLE3D
 
-#include "mem_alloc.hpp"
+#include "array.hpp"
 #include "../general/globals.hpp"
 
 namespace mfem
 {
 
-class STable3DNode
-{
-public:
-   STable3DNode *Prev;
-   int Column, Floor, Number;
-};
+/** @brief Symmetric 3D Table: a set of unique (row, column, floor) triplets.
+    The number of each triplet is assigned by counting them from zero as they
+    are pushed into the table. Diagonals of any kind are not allowed so the
+    row, column and floor must all be different for each entry. Only one entry
+    is stored for all 6 symmetric permutations of a triplet.
 
-/** @brief Symmetric 3D Table stored as an array of rows each of which has a
-    stack of column, floor, number nodes. The number of the node is assigned by
-    counting the nodes from zero as they are pushed into the table. Diagonals of
-    any kind are not allowed so the row, column and floor must all be different
-    for each node. Only one node is stored for all 6 symmetric entries that are
-    indexable by unique triplets of row, column, and floor. */
+    The table is stored as a flat open-addressing hash keyed on the sorted
+    triplet with a 64-bit mixed hash and linear probing, so lookups touch a
+    contiguous slot sequence instead of chasing list nodes. */
 class STable3D
 {
 private:
-   int Size, NElem;
-   STable3DNode **Rows;
+   int NElem;
+   int capacity, mask; ///< capacity is a power of two, mask = capacity-1
+   /// Flat slot array, 4 ints per slot: sorted triplet and its number; a
+   /// negative first entry marks an empty slot.
+   Array<int> slots;
 
-#ifdef MFEM_USE_MEMALLOC
-   MemAlloc <STable3DNode, 1024> NodesMem;
-#endif
+   /** @brief Return the slot index where the sorted triplet (r,c,f) is
+       stored, or of the empty slot where it belongs. */
+   int FindSlot(int r, int c, int f) const;
+
+   /// Double the capacity and re-insert all stored triplets.
+   void Grow();
 
 public:
-   /// Construct the table with a total of 'nr' rows.
+   /// Construct an empty table sized for a mesh with 'nr' vertices.
    explicit STable3D (int nr);
 
    /** @brief Check to see if this entry is in the table and add it to the table
@@ -120,6 +120,35 @@ public:
    const Memory<int> &GetIMemory() const { return I; }
    const Memory<int> &GetJMemory() const { return J; }
 
+   /** @name Device views of the I and J arrays
+
+       The device copies are cached by the Memory objects and kept valid
+       across calls, so repeated consumers (e.g. restriction operators) do
+       not re-upload the table. Note that modifying the table through the
+       host-only methods above does not invalidate a cached device copy;
+       use the HostWrite/ReadWrite views when mixing host modification with
+       device access. */
+   ///@{
+   const int *ReadI(bool on_dev = true) const
+   { return mfem::Read(I, I.Capacity(), on_dev); }
+   const int *ReadJ(bool on_dev = true) const
+   { return mfem::Read(J, J.Capacity(), on_dev); }
+   int *WriteI(bool on_dev = true)
+   { return mfem::Write(I, I.Capacity(), on_dev); }
+   int *WriteJ(bool on_dev = true)
+   { return mfem::Write(J, J.Capacity(), on_dev); }
+   int *ReadWriteI(bool on_dev = true)
+   { return mfem::ReadWrite(I, I.Capacity(), on_dev); }
+   int *ReadWriteJ(bool on_dev = true)
+   { return mfem::ReadWrite(J, J.Capacity(), on_dev); }
+   const int *HostReadI() const { return ReadI(false); }
+   const int *HostReadJ() const { return ReadJ(false); }
+   int *HostWriteI() { return WriteI(false); }
+   int *HostWriteJ() { return WriteJ(false); }
+   int *HostReadWriteI() { return ReadWriteI(false); }
+   int *HostReadWriteJ() { return ReadWriteJ(false); }
+   ///@}
+
    /// @brief Sort the column (TYPE II) indices in each row.
    void SortRows();
 
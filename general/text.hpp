@@ -18,11 +18,13 @@
 #include <string>
 #include <limits>
 #include <algorithm>
+#include <cstdio>
+#include <vector>
 
 namespace mfem
 {
 
-// Utilities for text parsing
+// Utilities for text parsing and formatting
 
 /// Check if the stream starts with @a comment_char. If so skip it.
 inline void skip_comment_lines(std::istream &is, const char comment_char)
@@ -75,6 +77,62 @@ inline int to_int(const std::string& str)
    return i;
 }
 
+/** @brief Buffered text writer for printing large objects.
+
+    Values are formatted with snprintf into a preallocated chunk which is
+    handed to the underlying std::ostream with a single write() when full,
+    avoiding the per-value operator<< overhead of the stream when, e.g., a
+    large mesh or grid function is saved. Doubles are written with the
+    precision the stream had at construction time, so the output matches
+    the one of the unbuffered code. The buffer is flushed on destruction. */
+class BufferedTextWriter
+{
+public:
+   explicit BufferedTextWriter(std::ostream &os, int capacity = 1 << 20)
+      : os(os), precision((int) os.precision()), buf(capacity), used(0) { }
+
+   ~BufferedTextWriter() { Flush(); }
+
+   /// Hand the characters accumulated so far to the stream.
+   void Flush()
+   {
+      if (used) { os.write(buf.data(), used); used = 0; }
+   }
+
+   /// Append the single character @a c.
+   void WriteChar(char c)
+   {
+      if (used == (int) buf.size()) { Flush(); }
+      buf[used++] = c;
+   }
+
+   /// Append the integer @a value in decimal.
+   void WriteInt(long value)
+   {
+      Reserve(24);
+      used += std::snprintf(&buf[used], 24, "%ld", value);
+   }
+
+   /// Append @a value like 'os << value' with the captured precision.
+   void WriteDouble(double value)
+   {
+      Reserve(40);
+      used += std::snprintf(&buf[used], 40, "%.*g", precision, value);
+   }
+
+private:
+   /// Flush if fewer than @a n characters of the buffer are left.
+   void Reserve(int n)
+   {
+      if (used + n > (int) buf.size()) { Flush(); }
+   }
+
+   std::ostream &os;
+   const int precision;
+   std::vector<char> buf;
+   int used;
+};
+
 }
 
 #endif
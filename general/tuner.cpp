@@ -0,0 +1,256 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "tuner.hpp"
+#include "cuda.hpp"
+#include "hip.hpp"
+#include "device.hpp"
+#include "error.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+namespace internal
+{
+
+// How many timed launches of every candidate before deciding the winner; the
+// best (smallest) time is kept, making the decision robust to one-off stalls.
+static const int tuner_repeats = 3;
+
+/// The measurement state of one (launch site, size bucket) key.
+struct TunerEntry
+{
+   std::vector<int> values; ///< The candidate values.
+   std::vector<double> best_time; ///< Per candidate, min over the repeats.
+   std::vector<int> trials;
+   int winner = -1; ///< The winning candidate value, -1 while measuring.
+};
+
+struct TunerState
+{
+   bool enabled = false;
+   std::string cache_path; ///< Empty with the in-memory only setting.
+   std::string device_tag;
+   std::map<std::string, TunerEntry> entries;
+   std::map<std::string, int> cached; ///< Winners loaded from the cache file.
+
+   // The measurement armed by the last KernelTuner::Choose() call.
+   TunerEntry *pending = NULL;
+   std::string pending_key;
+   int pending_candidate = -1;
+   std::chrono::steady_clock::time_point start_time;
+
+   TunerState();
+};
+
+/// Wait for all device work to complete, so that host timing brackets the
+/// kernel launched in between two calls.
+static void TunerSyncDevice()
+{
+#if defined(MFEM_USE_CUDA) || defined(MFEM_USE_HIP)
+   if (Device::IsEnabled()) { MFEM_DEVICE_SYNC; }
+#endif
+}
+
+/// A tag identifying the device the measurements are valid for; cache file
+/// entries recorded under a different tag are skipped on load.
+static std::string TunerDeviceTag()
+{
+#if defined(MFEM_USE_CUDA)
+   if (Device::IsAvailable())
+   {
+      int dev = 0;
+      cudaDeviceProp prop;
+      if (cudaGetDevice(&dev) == cudaSuccess &&
+          cudaGetDeviceProperties(&prop, dev) == cudaSuccess)
+      {
+         return std::string("cuda:") + prop.name;
+      }
+   }
+   return "cuda";
+#elif defined(MFEM_USE_HIP)
+   if (Device::IsAvailable())
+   {
+      int dev = 0;
+      hipDeviceProp_t prop;
+      if (hipGetDevice(&dev) == hipSuccess &&
+          hipGetDeviceProperties(&prop, dev) == hipSuccess)
+      {
+         return std::string("hip:") + prop.name;
+      }
+   }
+   return "hip";
+#else
+   return "cpu";
+#endif
+}
+
+TunerState::TunerState()
+{
+   const char *env = std::getenv("MFEM_KERNEL_TUNING");
+   if (!env || env[0] == '\0' || !std::strcmp(env, "0")) { return; }
+   enabled = true;
+   if (std::strcmp(env, "1")) { cache_path = env; }
+   device_tag = TunerDeviceTag();
+   if (cache_path.empty()) { return; }
+
+   // Load the winners recorded for this device in earlier runs. Each line is
+   // "<device tag>|<site>|<bucket> <winner>"; the site may contain spaces so
+   // the winner is separated from the key by the last space.
+   std::ifstream cache(cache_path.c_str());
+   std::string line;
+   while (std::getline(cache, line))
+   {
+      if (line.empty() || line[0] == '#') { continue; }
+      const size_t sep = line.rfind(' ');
+      if (sep == std::string::npos) { continue; }
+      const std::string key = line.substr(0, sep);
+      if (key.compare(0, device_tag.size() + 1, device_tag + "|")) { continue; }
+      cached[key.substr(device_tag.size() + 1)] = std::atoi(&line[sep + 1]);
+   }
+}
+
+static TunerState &Tuner()
+{
+   static TunerState state;
+   return state;
+}
+
+/// Append a decided winner to the cache file, if one was configured.
+static void TunerSaveWinner(const std::string &key, int winner)
+{
+   TunerState &state = Tuner();
+   if (state.cache_path.empty()) { return; }
+   std::ofstream cache(state.cache_path.c_str(),
+                       std::ios::out | std::ios::app);
+   if (!cache)
+   {
+      MFEM_WARNING("kernel tuning: cannot write the cache file '"
+                   << state.cache_path << "'");
+      state.cache_path.clear();
+      return;
+   }
+   cache << state.device_tag << '|' << key << ' ' << winner << '\n';
+}
+
+/// Bucket the problem size to the next power of two, so each site is tuned
+/// once per magnitude instead of once per exact size.
+static long TunerSizeBucket(long size)
+{
+   long bucket = 1;
+   while (bucket < size) { bucket *= 2; }
+   return bucket;
+}
+
+} // namespace internal
+
+bool KernelTuner::Enabled()
+{
+   return internal::Tuner().enabled;
+}
+
+int KernelTuner::Choose(const char *kernel, int line, long size,
+                        const int *candidates, int num_candidates)
+{
+   internal::TunerState &state = internal::Tuner();
+   if (!state.enabled || !kernel || num_candidates < 1)
+   {
+      return candidates[0];
+   }
+   MFEM_ASSERT(state.pending == NULL, "unfinished previous measurement, "
+               "KernelTuner::EndLaunch() was not called");
+
+   std::ostringstream oss;
+   oss << kernel << ':' << line << '|' << internal::TunerSizeBucket(size);
+   const std::string key = oss.str();
+
+   internal::TunerEntry &entry = state.entries[key];
+   if (entry.winner >= 0) { return entry.winner; }
+
+   // A winner loaded from the cache file skips the measurement, provided it
+   // is still one of the candidates (the candidate set may change between
+   // library versions).
+   std::map<std::string, int>::const_iterator it = state.cached.find(key);
+   if (it != state.cached.end())
+   {
+      for (int c = 0; c < num_candidates; c++)
+      {
+         if (candidates[c] == it->second)
+         {
+            entry.winner = it->second;
+            return entry.winner;
+         }
+      }
+   }
+
+   if (entry.values.empty())
+   {
+      entry.values.assign(candidates, candidates + num_candidates);
+      entry.best_time.assign(num_candidates, 0.0);
+      entry.trials.assign(num_candidates, 0);
+   }
+
+   // measure the candidate with the fewest timed launches so far
+   int c_min = 0;
+   for (int c = 1; c < num_candidates; c++)
+   {
+      if (entry.trials[c] < entry.trials[c_min]) { c_min = c; }
+   }
+   internal::TunerSyncDevice();
+   state.pending = &entry;
+   state.pending_key = key;
+   state.pending_candidate = c_min;
+   state.start_time = std::chrono::steady_clock::now();
+   return entry.values[c_min];
+}
+
+void KernelTuner::EndLaunch()
+{
+   internal::TunerState &state = internal::Tuner();
+   if (!state.pending) { return; }
+   internal::TunerSyncDevice();
+   const double dt = std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() -
+                        state.start_time).count();
+   internal::TunerEntry &entry = *state.pending;
+   const int c = state.pending_candidate;
+   state.pending = NULL;
+
+   if (entry.trials[c] == 0 || dt < entry.best_time[c])
+   {
+      entry.best_time[c] = dt;
+   }
+   entry.trials[c]++;
+
+   // decide the winner once every candidate went through all its repeats
+   for (size_t i = 0; i < entry.trials.size(); i++)
+   {
+      if (entry.trials[i] < internal::tuner_repeats) { return; }
+   }
+   size_t best = 0;
+   for (size_t i = 1; i < entry.best_time.size(); i++)
+   {
+      if (entry.best_time[i] < entry.best_time[best]) { best = i; }
+   }
+   entry.winner = entry.values[best];
+   internal::TunerSaveWinner(state.pending_key, entry.winner);
+}
+
+} // namespace mfem
@@ -0,0 +1,69 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_TUNER_HPP
+#define MFEM_TUNER_HPP
+
+#include "../config/config.hpp"
+
+namespace mfem
+{
+
+/** @brief Online autotuner for device kernel launch parameters.
+
+    The launch parameters that are not fixed by the kernels themselves --
+    currently the block size of the 1D MFEM_FORALL kernels, see ForallWrap()
+    in forall.hpp -- default to one hardwired value which is rarely the best
+    choice on every device. When tuning is enabled, the first few launches of
+    each kernel run with different candidate values and are timed with full
+    device synchronization; once every candidate has been measured the
+    fastest one is locked in and applied with no further overhead. Kernels
+    are keyed by their launch site and a power-of-two problem-size bucket, so
+    the same loop tuned at different sizes can settle on different winners.
+
+    The engine is disabled by default and controlled by:
+
+      - MFEM_KERNEL_TUNING=1       enable with an in-memory cache only,
+      - MFEM_KERNEL_TUNING=<file>  enable and persist the winners to <file>,
+                                   reloaded on the next run so later runs skip
+                                   the measurement phase entirely.
+
+    The cache records the device configuration string; entries recorded on a
+    different device configuration are ignored, so one cache file can hold
+    the winners for several devices. Note that while a kernel is still being
+    measured its launches are synchronous, so tuning should not be enabled
+    when timing a whole application from the outside.
+
+    Kernels with other genuinely free launch parameters can call Choose() and
+    EndLaunch() directly to select among custom candidate values. */
+class KernelTuner
+{
+public:
+   /// Return true if tuning was requested via MFEM_KERNEL_TUNING.
+   static bool Enabled();
+
+   /** @brief Select one of the @a num_candidates values in @a candidates for
+       the launch site @a kernel (typically __FILE__) at line @a line with
+       problem size @a size. */
+   /** While the site is being measured the returned value cycles through the
+       candidates and the launch is timed: the caller must submit the kernel
+       and then call EndLaunch() right away. Once decided, the winning value
+       is returned directly and EndLaunch() becomes a no-op. */
+   static int Choose(const char *kernel, int line, long size,
+                     const int *candidates, int num_candidates);
+
+   /// Complete the measurement armed by the last call to Choose(), if any.
+   static void EndLaunch();
+};
+
+} // namespace mfem
+
+#endif // MFEM_TUNER_HPP
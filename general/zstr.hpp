@@ -40,6 +40,11 @@
 #include <sstream>
 #include <cstring>
 #include <string>
+#include <algorithm>
+#include <deque>
+#include <future>
+#include <thread>
+#include <vector>
 
 #ifdef MFEM_USE_ZLIB
 #include <zlib.h>
@@ -708,11 +713,173 @@ public:
 namespace mfem
 {
 
+#ifdef MFEM_USE_ZLIB
+/** @brief Output stream buffer that compresses blocks of its input in
+    parallel.
+
+    The input sequence is cut into fixed-size blocks and every block is
+    deflated on its own worker task as an independent gzip member; the
+    compressed members are written to the sink stream buffer in input
+    order. Concatenated gzip members form a valid gzip stream, so the
+    output reads back through zstr::istreambuf/ifgzstream (or gzip
+    itself) exactly like serially compressed data. At most @a num_threads
+    blocks are in flight at a time; with one thread the buffer
+    degenerates to blockwise serial compression on the writing thread. */
+class par_gzstreambuf : public std::streambuf
+{
+public:
+   /// @a num_threads <= 0 selects the hardware concurrency.
+   explicit par_gzstreambuf(std::streambuf *_sbuf_p, int _num_threads = 0,
+                            std::size_t _block_size = default_block_size,
+                            int _level = Z_DEFAULT_COMPRESSION)
+      : sbuf_p(_sbuf_p), level(_level), block_size(_block_size),
+        any_submitted(false)
+   {
+      assert(sbuf_p);
+      if (_num_threads <= 0)
+      {
+         _num_threads = (int)std::thread::hardware_concurrency();
+      }
+      num_threads = std::max(1, _num_threads);
+      in_buff = new char[block_size];
+      setp(in_buff, in_buff + block_size);
+   }
+
+   par_gzstreambuf(const par_gzstreambuf &) = delete;
+   par_gzstreambuf &operator=(const par_gzstreambuf &) = delete;
+
+   virtual ~par_gzstreambuf()
+   {
+      // Errors are ignored here for the same reason as in
+      // zstr::ostreambuf::~ostreambuf(): flush/close the stream
+      // explicitly to see them.
+      try { sync(); }
+      catch (...) {}
+      delete [] in_buff;
+   }
+
+   virtual std::streambuf::int_type overflow(std::streambuf::int_type c =
+                                                traits_type::eof())
+   {
+      if (!submit_block() || !wait_for_slot())
+      {
+         setp(nullptr, nullptr);
+         return traits_type::eof();
+      }
+      setp(in_buff, in_buff + block_size);
+      return traits_type::eq_int_type(c, traits_type::eof())
+             ? traits_type::not_eof(c) : sputc(c);
+   }
+
+   virtual int sync()
+   {
+      if (!pptr()) { return -1; }
+      // an empty stream still gets one (empty) gzip member, like the
+      // serial zstr::ostreambuf
+      if (!submit_block(!any_submitted)) { return -1; }
+      while (!pending.empty())
+      {
+         if (!write_front()) { return -1; }
+      }
+      return 0;
+   }
+
+private:
+   /// Deflate @a data as one complete gzip member.
+   static std::vector<char> compress_block(std::vector<char> data, int level)
+   {
+      zstr::detail::z_stream_wrapper zs(false, level);
+      std::vector<char> out(deflateBound(&zs, data.size()) + 32);
+      zs.next_in = reinterpret_cast<Bytef *>(data.data());
+      zs.avail_in = data.size();
+      zs.next_out = reinterpret_cast<Bytef *>(out.data());
+      zs.avail_out = out.size();
+      int ret = deflate(&zs, Z_FINISH);
+      if (ret != Z_STREAM_END)
+      {
+         throw zstr::Exception(&zs, ret);
+      }
+      out.resize(out.size() - zs.avail_out);
+      return out;
+   }
+
+   /// Hand the current put area to a worker task; no-op when it is empty
+   /// unless @a force is set.
+   bool submit_block(bool force = false)
+   {
+      const std::size_t n = pptr() - pbase();
+      if (n == 0 && !force) { return true; }
+      std::vector<char> data(pbase(), pbase() + n);
+      try
+      {
+         pending.push_back(std::async(std::launch::async, compress_block,
+                                      std::move(data), level));
+      }
+      catch (...)
+      {
+         return false;
+      }
+      any_submitted = true;
+      pbump(-(int)n);
+      return true;
+   }
+
+   /// Keep fewer blocks in flight than worker threads.
+   bool wait_for_slot()
+   {
+      while ((int)pending.size() >= num_threads)
+      {
+         if (!write_front()) { return false; }
+      }
+      return true;
+   }
+
+   /// Write the oldest compressed block to the sink, preserving order.
+   bool write_front()
+   {
+      std::vector<char> out;
+      try
+      {
+         out = pending.front().get();
+      }
+      catch (...)
+      {
+         pending.pop_front();
+         throw; // compression errors surface like zstr::ostreambuf ones
+      }
+      pending.pop_front();
+      const std::streamsize sz = (std::streamsize)out.size();
+      return sbuf_p->sputn(out.data(), sz) == sz;
+   }
+
+   std::streambuf *sbuf_p;
+   char *in_buff;
+   int level;
+   int num_threads;
+   std::size_t block_size;
+   bool any_submitted;
+   std::deque<std::future<std::vector<char>>> pending;
+
+   static const std::size_t default_block_size = (std::size_t)4 << 20;
+}; // class par_gzstreambuf
+#endif
+
 class ofgzstream
    : private zstr::detail::strict_fstream_holder<strict_fstream::ofstream>,
      public std::ostream
 {
 public:
+   /** @brief Number of threads used to compress subsequently opened
+       streams: 1 (the default) compresses serially on the writing
+       thread, 0 selects the hardware concurrency, and any other value
+       gives that many workers, see par_gzstreambuf. Uncompressed
+       streams are unaffected. */
+   static int &CompressionThreads()
+   {
+      static int num_threads = 1;
+      return num_threads;
+   }
+
    explicit ofgzstream(const std::string &filename,
                        bool compression = false)
       : zstr::detail::strict_fstream_holder<strict_fstream::ofstream>(filename,
@@ -722,7 +889,14 @@ public:
 #ifdef MFEM_USE_ZLIB
       if (compression)
       {
-         strbuf = new zstr::ostreambuf(_fs.rdbuf());
+         if (CompressionThreads() != 1)
+         {
+            strbuf = new par_gzstreambuf(_fs.rdbuf(), CompressionThreads());
+         }
+         else
+         {
+            strbuf = new zstr::ostreambuf(_fs.rdbuf());
+         }
          rdbuf(strbuf);
       }
       else
@@ -746,7 +920,14 @@ public:
       // level (it is always set to 6).
       if (std::string(open_mode_chars).find('z') != std::string::npos)
       {
-         strbuf = new zstr::ostreambuf(_fs.rdbuf());
+         if (CompressionThreads() != 1)
+         {
+            strbuf = new par_gzstreambuf(_fs.rdbuf(), CompressionThreads());
+         }
+         else
+         {
+            strbuf = new zstr::ostreambuf(_fs.rdbuf());
+         }
          rdbuf(strbuf);
       }
       else
@@ -26,7 +26,8 @@ BlockMatrix::BlockMatrix(const Array<int> & offsets):
    nColBlocks(offsets.Size()-1),
    row_offsets(const_cast< Array<int>& >(offsets).GetData(), offsets.Size()),
    col_offsets(const_cast< Array<int>& >(offsets).GetData(), offsets.Size()),
-   Aij(nRowBlocks, nColBlocks)
+   Aij(nRowBlocks, nColBlocks),
+   monolithic(NULL)
 {
    Aij = (SparseMatrix *)NULL;
 }
@@ -41,7 +42,8 @@ BlockMatrix::BlockMatrix(const Array<int> & row_offsets_,
                row_offsets_.Size()),
    col_offsets(const_cast< Array<int>& >(col_offsets_).GetData(),
                col_offsets_.Size()),
-   Aij(nRowBlocks, nColBlocks)
+   Aij(nRowBlocks, nColBlocks),
+   monolithic(NULL)
 {
    Aij = (SparseMatrix *)NULL;
 }
@@ -49,6 +51,7 @@ BlockMatrix::BlockMatrix(const Array<int> & row_offsets_,
 
 BlockMatrix::~BlockMatrix()
 {
+   delete monolithic;
    if (owns_blocks)
    {
       for (SparseMatrix ** it = Aij.GetRow(0);
@@ -78,6 +81,7 @@ void BlockMatrix::SetBlock(int i, int j, SparseMatrix * mat)
    }
 #endif
    Aij(i,j) = mat;
+   ClearMonolithic();
 }
 
 SparseMatrix & BlockMatrix::GetBlock(int i, int j)
@@ -246,6 +250,7 @@ void BlockMatrix::EliminateRowCol(int rc, DiagonalPolicy dpolicy)
       if (Aij(jjblock,iiblock)) { Aij(jjblock,iiblock)->EliminateCol(idx); }
    }
    Aij(iiblock, iiblock)->EliminateRowCol(idx,dpolicy);
+   ClearMonolithic();
 }
 
 void BlockMatrix::EliminateRowCol(Array<int> & ess_bc_dofs, Vector & sol,
@@ -318,6 +323,7 @@ void BlockMatrix::EliminateRowCol(Array<int> & ess_bc_dofs, Vector & sol,
          }
       }
    }
+   ClearMonolithic();
 }
 
 void BlockMatrix::EliminateZeroRows(const double threshold)
@@ -371,6 +377,7 @@ void BlockMatrix::EliminateZeroRows(const double threshold)
          }
       }
    }
+   ClearMonolithic();
 }
 
 void BlockMatrix::Finalize(int skip_zeros, bool fix_empty_rows)
@@ -386,6 +393,7 @@ void BlockMatrix::Finalize(int skip_zeros, bool fix_empty_rows)
          }
       }
    }
+   ClearMonolithic();
 }
 
 void BlockMatrix::Mult(const Vector & x, Vector & y) const
@@ -473,84 +481,80 @@ void BlockMatrix::AddMultTranspose(const Vector & x, Vector & y,
 
 SparseMatrix * BlockMatrix::CreateMonolithic() const
 {
-   int nnz = NumNonZeroElems();
+   const int nrows = row_offsets[nRowBlocks];
+   const int nnz = NumNonZeroElems();
 
-   int * i_amono = Memory<int>(row_offsets[nRowBlocks]+2);
+   int * i_amono = Memory<int>(nrows+1);
    int * j_amono = Memory<int>(nnz);
    double * data = Memory<double>(nnz);
 
-   for (int i = 0; i < row_offsets[nRowBlocks]+2; i++)
-   {
-      i_amono[i] = 0;
-   }
-
-   int * i_amono_construction = i_amono+1;
-
+   // Count pass: number of entries in each monolithic row.
+   i_amono[0] = 0;
    for (int iblock = 0; iblock != nRowBlocks; ++iblock)
    {
-      for (int irow(row_offsets[iblock]); irow < row_offsets[iblock+1]; ++irow)
+      const int nrow = row_offsets[iblock+1] - row_offsets[iblock];
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int local_row = 0; local_row < nrow; ++local_row)
       {
-         int local_row = irow - row_offsets[iblock];
-         int ind = i_amono_construction[irow];
+         int ind = 0;
          for (int jblock = 0; jblock < nColBlocks; ++jblock)
          {
             if (Aij(iblock,jblock) != NULL)
-               ind += Aij(iblock, jblock)->GetI()[local_row+1]
-                      - Aij(iblock, jblock)->GetI()[local_row];
+            {
+               const int * i_aij = Aij(iblock, jblock)->GetI();
+               ind += i_aij[local_row+1] - i_aij[local_row];
+            }
          }
-         i_amono_construction[irow+1] = ind;
+         i_amono[row_offsets[iblock] + local_row + 1] = ind;
       }
    }
+   for (int irow = 0; irow < nrows; ++irow)
+   {
+      i_amono[irow+1] += i_amono[irow];
+   }
 
-   // Fill in the jarray and copy the data
+   // Fill pass: each monolithic row is filled independently of the others.
    for (int iblock = 0; iblock != nRowBlocks; ++iblock)
    {
-      for (int jblock = 0; jblock != nColBlocks; ++jblock)
+      const int nrow = row_offsets[iblock+1] - row_offsets[iblock];
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int local_row = 0; local_row < nrow; ++local_row)
       {
-         if (Aij(iblock,jblock) != NULL)
+         int pos = i_amono[row_offsets[iblock] + local_row];
+         for (int jblock = 0; jblock < nColBlocks; ++jblock)
          {
-            int nrow = row_offsets[iblock+1]-row_offsets[iblock];
-            int * i_aij = Aij(iblock, jblock)->GetI();
-            int * j_aij = Aij(iblock, jblock)->GetJ();
-            double * data_aij = Aij(iblock, jblock)->GetData();
-            int *i_it = i_amono_construction+row_offsets[iblock];
-
-            int loc_start_index = 0;
-            int loc_end_index = 0;
-            int glob_start_index = 0;
-
-            int shift(col_offsets[jblock]);
-            for (int * i_it_aij(i_aij+1); i_it_aij != i_aij+nrow+1; ++i_it_aij)
+            if (Aij(iblock,jblock) == NULL) { continue; }
+            const int * i_aij = Aij(iblock, jblock)->GetI();
+            const int * j_aij = Aij(iblock, jblock)->GetJ();
+            const double * data_aij = Aij(iblock, jblock)->GetData();
+            const int shift = col_offsets[jblock];
+            for (int k = i_aij[local_row]; k < i_aij[local_row+1]; ++k)
             {
-               glob_start_index = *i_it;
-
-#ifdef MFEM_DEBUG
-               if (glob_start_index > nnz)
-               {
-                  mfem::out<<"glob_start_index = " << glob_start_index << "\n";
-                  mfem::out<<"Block:" << iblock << " " << jblock << "\n";
-                  mfem::out<<std::endl;
-               }
-#endif
-               loc_end_index = *(i_it_aij);
-               for (int cnt = 0; cnt < loc_end_index-loc_start_index; cnt++)
-               {
-                  data[glob_start_index+cnt] = data_aij[loc_start_index+cnt];
-                  j_amono[glob_start_index+cnt] = j_aij[loc_start_index+cnt] + shift;
-               }
-
-               *i_it += loc_end_index-loc_start_index;
-               ++i_it;
-               loc_start_index = loc_end_index;
+               j_amono[pos] = j_aij[k] + shift;
+               data[pos] = data_aij[k];
+               ++pos;
             }
          }
       }
    }
 
-   return new SparseMatrix(i_amono, j_amono, data, row_offsets[nRowBlocks],
+   return new SparseMatrix(i_amono, j_amono, data, nrows,
                            col_offsets[nColBlocks]);
 }
 
+const SparseMatrix & BlockMatrix::GetMonolithic() const
+{
+   if (monolithic == NULL)
+   {
+      monolithic = CreateMonolithic();
+   }
+   return *monolithic;
+}
+
 void BlockMatrix::PrintMatlab(std::ostream & os) const
 {
 
@@ -88,6 +88,15 @@ public:
 
    //! Returns a monolithic CSR matrix that represents this operator.
    SparseMatrix * CreateMonolithic() const;
+
+   /** @brief Return a monolithic CSR representation of this operator, created
+       lazily with CreateMonolithic() on the first call and cached.
+
+       The cached matrix is deleted when a block is replaced with SetBlock()
+       or the blocks are modified with the elimination methods. Solvers that
+       only need the action of the operator can use the BlockMatrix directly,
+       without forming the monolithic matrix. */
+   const SparseMatrix & GetMonolithic() const;
    //! Export the monolithic matrix to file.
    void PrintMatlab(std::ostream & os = mfem::out) const;
 
@@ -155,6 +164,11 @@ private:
    //! 2D array that stores each block of the BlockMatrix. Aij(iblock, jblock)
    //! == NULL if block (iblock, jblock) is all zeros.
    Array2D<SparseMatrix *> Aij;
+   //! Monolithic CSR matrix cached by GetMonolithic(). Owned.
+   mutable SparseMatrix *monolithic;
+
+   //! Delete the cached monolithic matrix, if any.
+   void ClearMonolithic() { delete monolithic; monolithic = NULL; }
 };
 
 //! Transpose a BlockMatrix: result = A'
@@ -15,9 +15,22 @@
 #include "blockvector.hpp"
 #include "blockoperator.hpp"
 
+#include <algorithm>
+
 namespace mfem
 {
 
+/// Size of the largest block described by 'offsets'.
+static int MaxBlockSize(const Array<int> &offsets)
+{
+   int max_size = 0;
+   for (int i = 0; i < offsets.Size()-1; ++i)
+   {
+      max_size = std::max(max_size, offsets[i+1] - offsets[i]);
+   }
+   return max_size;
+}
+
 BlockOperator::BlockOperator(const Array<int> & offsets)
    : Operator(offsets.Last()),
      owns_blocks(0),
@@ -31,6 +44,8 @@ BlockOperator::BlockOperator(const Array<int> & offsets)
    op = static_cast<Operator *>(NULL);
    row_offsets.MakeRef(offsets);
    col_offsets.MakeRef(offsets);
+   tmp.UseDevice(true);
+   tmp.SetSize(MaxBlockSize(row_offsets));
 }
 
 BlockOperator::BlockOperator(const Array<int> & row_offsets_,
@@ -47,6 +62,9 @@ BlockOperator::BlockOperator(const Array<int> & row_offsets_,
    op = static_cast<Operator *>(NULL);
    row_offsets.MakeRef(row_offsets_);
    col_offsets.MakeRef(col_offsets_);
+   tmp.UseDevice(true);
+   tmp.SetSize(std::max(MaxBlockSize(row_offsets),
+                        MaxBlockSize(col_offsets)));
 }
 
 void BlockOperator::SetDiagonalBlock(int iblock, Operator *op, double c)
@@ -272,6 +290,10 @@ BlockLowerTriangularPreconditioner::BlockLowerTriangularPreconditioner(
 {
    op = static_cast<Operator *>(NULL);
    offsets.MakeRef(offsets_);
+   tmp.UseDevice(true);
+   tmp.SetSize(MaxBlockSize(offsets));
+   tmp2.UseDevice(true);
+   tmp2.SetSize(MaxBlockSize(offsets));
 }
 
 void BlockLowerTriangularPreconditioner::SetDiagonalBlock(int iblock,
@@ -305,28 +327,38 @@ void BlockLowerTriangularPreconditioner::Mult (const Vector & x,
    yblock.Update(y.GetData(),offsets);
    xblock.Update(x.GetData(),offsets);
 
-   y = 0.0;
    for (int iRow=0; iRow < nBlocks; ++iRow)
    {
-      tmp.SetSize(offsets[iRow+1] - offsets[iRow]);
-      tmp2.SetSize(offsets[iRow+1] - offsets[iRow]);
-      tmp2 = 0.0;
-      tmp2 += xblock.GetBlock(iRow);
+      // Skip the copy into the workspace when this row has no off-diagonal
+      // couplings and the diagonal block can be applied to the input directly.
+      bool coupled = false;
       for (int jCol=0; jCol < iRow; ++jCol)
       {
-         if (op(iRow,jCol))
+         if (op(iRow,jCol)) { coupled = true; break; }
+      }
+      const Vector *rhs = &xblock.GetBlock(iRow);
+      if (coupled)
+      {
+         tmp.SetSize(offsets[iRow+1] - offsets[iRow]);
+         tmp2.SetSize(offsets[iRow+1] - offsets[iRow]);
+         tmp2 = xblock.GetBlock(iRow);
+         for (int jCol=0; jCol < iRow; ++jCol)
          {
-            op(iRow,jCol)->Mult(yblock.GetBlock(jCol), tmp);
-            tmp2 -= tmp;
+            if (op(iRow,jCol))
+            {
+               op(iRow,jCol)->Mult(yblock.GetBlock(jCol), tmp);
+               tmp2 -= tmp;
+            }
          }
+         rhs = &tmp2;
       }
       if (op(iRow,iRow))
       {
-         op(iRow,iRow)->Mult(tmp2, yblock.GetBlock(iRow));
+         op(iRow,iRow)->Mult(*rhs, yblock.GetBlock(iRow));
       }
       else
       {
-         yblock.GetBlock(iRow) = tmp2;
+         yblock.GetBlock(iRow) = *rhs;
       }
    }
 }
@@ -341,28 +373,38 @@ void BlockLowerTriangularPreconditioner::MultTranspose (const Vector & x,
    yblock.Update(y.GetData(),offsets);
    xblock.Update(x.GetData(),offsets);
 
-   y = 0.0;
    for (int iRow=nBlocks-1; iRow >=0; --iRow)
    {
-      tmp.SetSize(offsets[iRow+1] - offsets[iRow]);
-      tmp2.SetSize(offsets[iRow+1] - offsets[iRow]);
-      tmp2 = 0.0;
-      tmp2 += xblock.GetBlock(iRow);
+      // Same workspace-skipping logic as in Mult(), with the roles of the
+      // rows and columns exchanged.
+      bool coupled = false;
       for (int jCol=iRow+1; jCol < nBlocks; ++jCol)
       {
-         if (op(jCol,iRow))
+         if (op(jCol,iRow)) { coupled = true; break; }
+      }
+      const Vector *rhs = &xblock.GetBlock(iRow);
+      if (coupled)
+      {
+         tmp.SetSize(offsets[iRow+1] - offsets[iRow]);
+         tmp2.SetSize(offsets[iRow+1] - offsets[iRow]);
+         tmp2 = xblock.GetBlock(iRow);
+         for (int jCol=iRow+1; jCol < nBlocks; ++jCol)
          {
-            op(jCol,iRow)->MultTranspose(yblock.GetBlock(jCol), tmp);
-            tmp2 -= tmp;
+            if (op(jCol,iRow))
+            {
+               op(jCol,iRow)->MultTranspose(yblock.GetBlock(jCol), tmp);
+               tmp2 -= tmp;
+            }
          }
+         rhs = &tmp2;
       }
       if (op(iRow,iRow))
       {
-         op(iRow,iRow)->MultTranspose(tmp2, yblock.GetBlock(iRow));
+         op(iRow,iRow)->MultTranspose(*rhs, yblock.GetBlock(iRow));
       }
       else
       {
-         yblock.GetBlock(iRow) = tmp2;
+         yblock.GetBlock(iRow) = *rhs;
       }
    }
 }
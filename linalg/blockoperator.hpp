@@ -121,7 +121,9 @@ private:
    //! 2D array that stores a coefficient for each block of the operator.
    Array2D<double> coef;
 
-   //! Temporary Vectors used to efficiently apply the Mult and MultTranspose methods.
+   //! Temporary Vectors used to efficiently apply the Mult and MultTranspose
+   //! methods; 'tmp' is preallocated to the largest block size by the
+   //! constructors so that no allocation happens during the application.
    mutable BlockVector xblock;
    mutable BlockVector yblock;
    mutable Vector tmp;
@@ -275,7 +277,8 @@ private:
    Array2D<Operator *> op;
 
    //! Temporary Vectors used to efficiently apply the Mult and MultTranspose
-   //! methods.
+   //! methods; preallocated to the largest block size by the constructor and
+   //! only used for rows that have off-diagonal couplings.
    mutable BlockVector xblock;
    mutable BlockVector yblock;
    mutable Vector tmp;
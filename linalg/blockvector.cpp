@@ -10,6 +10,7 @@
 // CONTRIBUTING.md for details.
 
 #include "../general/array.hpp"
+#include "../general/forall.hpp"
 #include "vector.hpp"
 #include "blockvector.hpp"
 
@@ -24,6 +25,16 @@ void BlockVector::SetBlocks()
          Memory<double>(data, blockOffsets[i], BlockSize(i)),
          BlockSize(i), true);
    }
+   SetDeviceOffsets();
+}
+
+void BlockVector::SetDeviceOffsets()
+{
+   deviceOffsets.SetSize(numBlocks+1);
+   for (int i = 0; i <= numBlocks; ++i)
+   {
+      deviceOffsets[i] = blockOffsets[i];
+   }
 }
 
 BlockVector::BlockVector():
@@ -101,6 +112,7 @@ void BlockVector::Update(Vector & data, const Array<int> & bOffsets)
    {
       blocks[i].MakeRef(data, blockOffsets[i], BlockSize(i));
    }
+   SetDeviceOffsets();
 }
 
 void BlockVector::Update(const Array<int> &bOffsets)
@@ -182,4 +194,66 @@ void BlockVector::GetBlockView(int i, Vector & blockView)
       BlockSize(i), true);
 }
 
+void BlockVector::SyncToBlocks() const
+{
+   for (int i = 0; i < numBlocks; ++i)
+   {
+      blocks[i].SyncMemory(*this);
+   }
+}
+
+void BlockVector::SyncFromBlocks() const
+{
+   for (int i = 0; i < numBlocks; ++i)
+   {
+      const_cast<BlockVector&>(*this).SyncAliasMemory(blocks[i]);
+   }
+}
+
+void BlockVector::ScaleBlocks(const Vector &sv)
+{
+   MFEM_ASSERT(sv.Size() == numBlocks,
+               "incompatible number of scaling entries");
+
+   SyncFromBlocks();
+
+   const bool use_dev = UseDevice() || sv.UseDevice();
+   const int nb = numBlocks;
+   auto d_off = deviceOffsets.Read(use_dev);
+   auto d_sv = sv.Read(use_dev);
+   auto d_y = ReadWrite(use_dev);
+   MFEM_FORALL_SWITCH(use_dev, i, Size(),
+   {
+      int b = 0;
+      while (b < nb-1 && i >= d_off[b+1]) { b++; }
+      d_y[i] *= d_sv[b];
+   });
+   SyncToBlocks();
+}
+
+void BlockVector::AddBlocks(const Vector &sv, const BlockVector &x)
+{
+   MFEM_ASSERT(sv.Size() == numBlocks,
+               "incompatible number of scaling entries");
+   MFEM_ASSERT(x.Size() == Size() && x.NumBlocks() == numBlocks,
+               "incompatible BlockVector");
+
+   SyncFromBlocks();
+   x.SyncFromBlocks();
+
+   const bool use_dev = UseDevice() || sv.UseDevice() || x.UseDevice();
+   const int nb = numBlocks;
+   auto d_off = deviceOffsets.Read(use_dev);
+   auto d_sv = sv.Read(use_dev);
+   auto d_x = x.Read(use_dev);
+   auto d_y = ReadWrite(use_dev);
+   MFEM_FORALL_SWITCH(use_dev, i, Size(),
+   {
+      int b = 0;
+      while (b < nb-1 && i >= d_off[b+1]) { b++; }
+      d_y[i] += d_sv[b] * d_x[i];
+   });
+   SyncToBlocks();
+}
+
 }
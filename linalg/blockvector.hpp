@@ -44,8 +44,14 @@ protected:
    /** This array is owned. */
    Vector *blocks;
 
+   //! Copy of the offsets usable in device kernels, see ScaleBlocks().
+   Array<int> deviceOffsets;
+
    void SetBlocks();
 
+   //! Copy #blockOffsets into #deviceOffsets.
+   void SetDeviceOffsets();
+
 public:
    //! empty constructor
    BlockVector();
@@ -91,6 +97,30 @@ public:
    //! Get the i-th vector in the block
    void GetBlockView(int i, Vector & blockView);
 
+   /** @brief Synchronize the memory location flags of the big/monolithic
+       block-vector with its sub-vector blocks. The big/monolithic vector has
+       the correct memory location flags. */
+   /** After this call, operations that are uniform across the blocks can use
+       the methods of the base class Vector, which treat the underlying
+       contiguous storage as one vector and launch a single kernel. */
+   void SyncToBlocks() const;
+
+   /** @brief Synchronize the memory location flags of the big/monolithic
+       block-vector with its sub-vector blocks. The sub-vector blocks have the
+       correct memory location flags. */
+   void SyncFromBlocks() const;
+
+   /** @brief Scale the i-th block by the i-th entry of @a sv using a single
+       kernel launch. The size of @a sv must be NumBlocks(). */
+   void ScaleBlocks(const Vector &sv);
+
+   /** @brief Add the i-th entry of @a sv times the i-th block of @a x to the
+       i-th block of this vector using a single kernel launch.
+
+       The block structure of @a x must match this vector and the size of
+       @a sv must be NumBlocks(). */
+   void AddBlocks(const Vector &sv, const BlockVector &x);
+
    int BlockSize(int i) { return blockOffsets[i+1] - blockOffsets[i]; }
 
    //! Update method
@@ -116,12 +116,13 @@ public:
    Convention GetConvention() const { return convention_; }
 
 protected:
-   // Let this be hidden from the public interface since the implementation
-   // depends on internal members
-   void Mult(const Vector &x_r, const Vector &x_i,
-             Vector &y_r, Vector &y_i) const;
-   void MultTranspose(const Vector &x_r, const Vector &x_i,
-                      Vector &y_r, Vector &y_i) const;
+   // Let these be hidden from the public interface since the implementation
+   // depends on internal members; derived classes may override them to
+   // provide specialized matvec kernels.
+   virtual void Mult(const Vector &x_r, const Vector &x_i,
+                     Vector &y_r, Vector &y_i) const;
+   virtual void MultTranspose(const Vector &x_r, const Vector &x_i,
+                              Vector &y_r, Vector &y_i) const;
 
 protected:
    Operator * Op_Real_;
@@ -146,6 +147,16 @@ protected:
     require access to the CSR matrix data such as SuperLU, STRUMPACK, or similar
     sparse linear solvers.
 
+    In addition, when both the real and the imaginary part are present, the
+    action of the operator is computed with a fused complex matvec over an
+    interleaved complex CSR copy of the data instead of four real
+    SparseMatrix::Mult() calls: the column pattern is the union of the two
+    patterns and each nonzero stores its (real, imaginary) pair contiguously,
+    roughly halving the memory traffic per matvec. The interleaved data is
+    built on the first matvec; call ResetInterleavedData() if the entries of
+    real() or imag() are changed afterwards. Both conventions are supported;
+    MultTranspose() uses the generic block path.
+
     See ComplexOperator documentation above for more information.
  */
 class ComplexSparseMatrix : public ComplexOperator
@@ -171,7 +182,27 @@ public:
        operator. */
    SparseMatrix * GetSystemMatrix() const;
 
+   /// Discard the cached interleaved data used by the fused matvec; it will
+   /// be rebuilt on the next matvec. Call this method after changing the
+   /// entries of real() or imag().
+   void ResetInterleavedData()
+   { z_I.DeleteAll(); z_J.DeleteAll(); z_D.Destroy(); }
+
    virtual Type GetType() const { return MFEM_ComplexSparseMat; }
+
+   using ComplexOperator::Mult;
+
+protected:
+   virtual void Mult(const Vector &x_r, const Vector &x_i,
+                     Vector &y_r, Vector &y_i) const;
+
+   /// Build the interleaved complex CSR data used by the fused matvec.
+   void BuildInterleavedData() const;
+
+   // Interleaved complex CSR data: z_J holds the union of the real and
+   // imaginary column patterns, z_D the (real, imaginary) value pairs.
+   mutable Array<int> z_I, z_J;
+   mutable Vector z_D;
 };
 
 #ifdef MFEM_USE_SUITESPARSE
@@ -17,6 +17,7 @@
 #include "vector.hpp"
 #include "matrix.hpp"
 #include "densemat.hpp"
+#include "simd.hpp"
 #include "kernels.hpp"
 #include "../general/forall.hpp"
 #include "../general/table.hpp"
@@ -2000,6 +2001,120 @@ bool LinearSolve(DenseMatrix& A, double* X, double TOL)
    return true;
 }
 
+// Flop-count threshold above which the tiled GEMM paths below are used
+// instead of the simple triple loops in kernels.hpp.
+static const int tiled_gemm_threshold = 32*32*32;
+
+/** Tiled, vectorized GEMM for mid-size products when LAPACK is not used:
+    a = b * c with a (ah x aw), b (ah x bw), c (bw x aw), column-major. The
+    column blocks of @a a are independent and are distributed over OpenMP
+    threads when enabled. */
+static void TiledMult(const int ah, const int aw, const int bw,
+                      const double *bd, const double *cd, double *ad)
+{
+   static const int S = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double, S, MFEM_SIMD_BYTES> vreal_t;
+   static const int TJ = 64; // tile of columns of a
+   static const int TK = 64; // tile of the inner dimension
+
+   for (int i = 0; i < ah*aw; i++) { ad[i] = 0.0; }
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int j0 = 0; j0 < aw; j0 += TJ)
+   {
+      const int j1 = std::min(aw, j0 + TJ);
+      for (int k0 = 0; k0 < bw; k0 += TK)
+      {
+         const int k1 = std::min(bw, k0 + TK);
+         for (int j = j0; j < j1; j++)
+         {
+            double *aj = ad + j*ah;
+            const double *cj = cd + j*bw;
+            int i = 0;
+            for ( ; i + S <= ah; i += S)
+            {
+               vreal_t acc;
+               MFEM_VECTORIZE_LOOP
+               for (int l = 0; l < S; l++) { acc[l] = aj[i+l]; }
+               for (int k = k0; k < k1; k++)
+               {
+                  const double ckj = cj[k];
+                  const double *bk = bd + k*ah + i;
+                  vreal_t bv;
+                  MFEM_VECTORIZE_LOOP
+                  for (int l = 0; l < S; l++) { bv[l] = bk[l]; }
+                  acc.fma(bv, ckj);
+               }
+               MFEM_VECTORIZE_LOOP
+               for (int l = 0; l < S; l++) { aj[i+l] = acc[l]; }
+            }
+            for ( ; i < ah; i++)
+            {
+               double d = aj[i];
+               for (int k = k0; k < k1; k++) { d += cj[k]*bd[i+k*ah]; }
+               aj[i] = d;
+            }
+         }
+      }
+   }
+}
+
+/** Tiled, vectorized product with a transposed second factor for mid-size
+    matrices: abt = a * b^t with a (ah x aw), b (bh x aw), abt (ah x bh),
+    column-major; same tiling strategy as TiledMult(). */
+static void TiledMultABt(const int ah, const int aw, const int bh,
+                         const double *ad, const double *bd, double *cd)
+{
+   static const int S = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double, S, MFEM_SIMD_BYTES> vreal_t;
+   static const int TJ = 64;
+   static const int TK = 64;
+
+   for (int i = 0; i < ah*bh; i++) { cd[i] = 0.0; }
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int j0 = 0; j0 < bh; j0 += TJ)
+   {
+      const int j1 = std::min(bh, j0 + TJ);
+      for (int k0 = 0; k0 < aw; k0 += TK)
+      {
+         const int k1 = std::min(aw, k0 + TK);
+         for (int j = j0; j < j1; j++)
+         {
+            double *cj = cd + j*ah;
+            int i = 0;
+            for ( ; i + S <= ah; i += S)
+            {
+               vreal_t acc;
+               MFEM_VECTORIZE_LOOP
+               for (int l = 0; l < S; l++) { acc[l] = cj[i+l]; }
+               for (int k = k0; k < k1; k++)
+               {
+                  const double bjk = bd[j+k*bh];
+                  const double *ak = ad + k*ah + i;
+                  vreal_t av;
+                  MFEM_VECTORIZE_LOOP
+                  for (int l = 0; l < S; l++) { av[l] = ak[l]; }
+                  acc.fma(av, bjk);
+               }
+               MFEM_VECTORIZE_LOOP
+               for (int l = 0; l < S; l++) { cj[i+l] = acc[l]; }
+            }
+            for ( ; i < ah; i++)
+            {
+               double d = cj[i];
+               for (int k = k0; k < k1; k++) { d += bd[j+k*bh]*ad[i+k*ah]; }
+               cj[i] = d;
+            }
+         }
+      }
+   }
+}
+
 void Mult(const DenseMatrix &b, const DenseMatrix &c, DenseMatrix &a)
 {
    MFEM_ASSERT(a.Height() == b.Height() && a.Width() == c.Width() &&
@@ -2019,7 +2134,14 @@ void Mult(const DenseMatrix &b, const DenseMatrix &c, DenseMatrix &a)
    double *ad = a.Data();
    const double *bd = b.Data();
    const double *cd = c.Data();
-   kernels::Mult(ah,aw,bw,bd,cd,ad);
+   if ((double)ah*aw*bw >= tiled_gemm_threshold)
+   {
+      TiledMult(ah, aw, bw, bd, cd, ad);
+   }
+   else
+   {
+      kernels::Mult(ah,aw,bw,bd,cd,ad);
+   }
 #endif
 }
 
@@ -2415,7 +2537,14 @@ void MultABt(const DenseMatrix &A, const DenseMatrix &B, DenseMatrix &ABt)
    const double *bd = B.Data();
    double *cd = ABt.Data();
 
-   kernels::MultABt(ah, aw, bh, ad, bd, cd);
+   if ((double)ah*aw*bh >= tiled_gemm_threshold)
+   {
+      TiledMultABt(ah, aw, bh, ad, bd, cd);
+   }
+   else
+   {
+      kernels::MultABt(ah, aw, bh, ad, bd, cd);
+   }
 #elif 1
    const int ah = A.Height();
    const int bh = B.Height();
@@ -3595,4 +3724,130 @@ void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X)
 
 }
 
+void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, DenseTensor &X)
+{
+   const int m = Mlu.SizeI();
+   const int r = X.SizeJ();
+   const int NE = Mlu.SizeK();
+
+   auto data_all = mfem::Reshape(Mlu.Read(), m, m, NE);
+   auto piv_all = mfem::Reshape(P.Read(), m, NE);
+   auto x_all = mfem::Reshape(X.ReadWrite(), m, r, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      for (int c = 0; c < r; c++)
+      {
+         kernels::LUSolve(&data_all(0,0,e), m, &piv_all(0,e), &x_all(0,c,e));
+      }
+   });
+}
+
+void BatchBlockFactor(const DenseTensor &Mlu, const Array<int> &P,
+                      DenseTensor &A12, DenseTensor &A21, DenseTensor &A22)
+{
+   const int m = Mlu.SizeI();
+   const int r = A22.SizeI();
+   const int NE = Mlu.SizeK();
+   MFEM_ASSERT(A12.SizeI() == m && A12.SizeJ() == r && A12.SizeK() == NE &&
+               A21.SizeI() == r && A21.SizeJ() == m && A21.SizeK() == NE &&
+               A22.SizeJ() == r && A22.SizeK() == NE,
+               "incompatible dimensions of the block tensors");
+   if (m == 0 || NE == 0) { return; }
+
+   auto data_all = mfem::Reshape(Mlu.Read(), m, m, NE);
+   auto piv_all = mfem::Reshape(P.Read(), m, NE);
+   auto a12_all = mfem::Reshape(A12.ReadWrite(), m, r, NE);
+   auto a21_all = mfem::Reshape(A21.ReadWrite(), r, m, NE);
+   auto a22_all = mfem::Reshape(A22.ReadWrite(), r, r, NE);
+
+   MFEM_FORALL(e, NE,
+   {
+      // A12 <- P A12
+      for (int i = 0; i < m; i++)
+      {
+         const int piv = piv_all(i,e);
+         if (piv != i)
+         {
+            for (int j = 0; j < r; j++)
+            {
+               mfem::kernels::internal::Swap<double>(a12_all(i,j,e),
+                                                     a12_all(piv,j,e));
+            }
+         }
+      }
+      // A12 <- L^{-1} A12, L unit lower triangular
+      for (int j = 0; j < r; j++)
+      {
+         for (int i = 1; i < m; i++)
+         {
+            double sum = a12_all(i,j,e);
+            for (int k = 0; k < i; k++)
+            {
+               sum -= data_all(i,k,e)*a12_all(k,j,e);
+            }
+            a12_all(i,j,e) = sum;
+         }
+      }
+      // A21 <- A21 U^{-1}
+      for (int j = 0; j < m; j++)
+      {
+         const double u_jj_inv = 1.0/data_all(j,j,e);
+         for (int i = 0; i < r; i++)
+         {
+            a21_all(i,j,e) *= u_jj_inv;
+         }
+         for (int k = j+1; k < m; k++)
+         {
+            const double u_jk = data_all(j,k,e);
+            for (int i = 0; i < r; i++)
+            {
+               a21_all(i,k,e) -= a21_all(i,j,e)*u_jk;
+            }
+         }
+      }
+      // A22 <- A22 - A21 A12
+      for (int j = 0; j < r; j++)
+      {
+         for (int k = 0; k < m; k++)
+         {
+            const double a_kj = a12_all(k,j,e);
+            for (int i = 0; i < r; i++)
+            {
+               a22_all(i,j,e) -= a21_all(i,k,e)*a_kj;
+            }
+         }
+      }
+   });
+}
+
+void BatchInverse(DenseTensor &M, DenseTensor &Minv)
+{
+   const int m = M.SizeI();
+   const int NE = M.SizeK();
+   MFEM_ASSERT(Minv.SizeI() == m && Minv.SizeJ() == m && Minv.SizeK() == NE,
+               "incompatible dimensions of the output tensor");
+
+   Array<int> P;
+   BatchLUFactor(M, P);
+
+   auto lu_all = mfem::Reshape(M.Read(), m, m, NE);
+   auto piv_all = mfem::Reshape(P.Read(), m, NE);
+   auto inv_all = mfem::Reshape(Minv.Write(), m, m, NE);
+
+   // Solve for the columns of the identity directly in the output tensor:
+   // LUSolve() applies the pivots and both substitutions in place.
+   MFEM_FORALL(e, NE,
+   {
+      for (int c = 0; c < m; c++)
+      {
+         for (int i = 0; i < m; i++)
+         {
+            inv_all(i,c,e) = (i == c) ? 1.0 : 0.0;
+         }
+         kernels::LUSolve(&lu_all(0,0,e), m, &piv_all(0,e), &inv_all(0,c,e));
+      }
+   });
+}
+
 } // namespace mfem
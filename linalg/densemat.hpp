@@ -14,6 +14,7 @@
 
 #include "../config/config.hpp"
 #include "../general/globals.hpp"
+#include "../general/mem_alloc.hpp"
 #include "matrix.hpp"
 
 namespace mfem
@@ -58,6 +59,12 @@ public:
    DenseMatrix(double *d, int h, int w)
       : Matrix(h, w) { UseExternalData(d, h, w); }
 
+   /// Construct a DenseMatrix backed by scratch memory from @a arena.
+   /** The matrix does not own the data; all such matrices are invalidated
+       together by ScratchArena::Reset(). */
+   DenseMatrix(ScratchArena &arena, int h, int w)
+      : Matrix(h, w) { UseExternalData(arena.Alloc<double>(h*w), h, w); }
+
    /// Change the data array and the size of the DenseMatrix.
    /** The DenseMatrix does not assume ownership of the data array, i.e. it will
        not delete the data array @a d. This method should not be used with
@@ -746,6 +753,16 @@ public:
       tdata.New(i*j*k);
    }
 
+   /// Construct a DenseTensor backed by scratch memory from @a arena.
+   /** The tensor does not own the data; all such tensors are invalidated
+       together by ScratchArena::Reset(). */
+   DenseTensor(ScratchArena &arena, int i, int j, int k)
+      : Mk(NULL, i, j)
+   {
+      nk = k;
+      tdata.Wrap(arena.Alloc<double>(i*j*k), i*j*k, false);
+   }
+
    /// Copy constructor: deep copy
    DenseTensor(const DenseTensor &other)
       : Mk(NULL, other.Mk.height, other.Mk.width), nk(other.nk)
@@ -884,6 +901,48 @@ void BatchLUFactor(DenseTensor &Mlu, Array<int> &P, const double TOL = 0.0);
     dimension m x n. */
 void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, Vector &X);
 
+/** @brief Solve batch linear systems with multiple right-hand sides
+
+    Assuming L.U = P.A for n factored matrices (m x m), compute X <- A X for
+    the r companion vectors of each matrix.
+
+    @param [in] Mlu batch of LU factors for matrix M - dimension m x m x n.
+    @param [in] P array storing pivot information - dimension m x n.
+    @param [in, out] X tensor storing the right-hand sides and then the
+    solutions - dimension m x r x n. */
+void BatchLUSolve(const DenseTensor &Mlu, const Array<int> &P, DenseTensor &X);
+
+/** @brief Batched 2x2 block factorization step
+
+    Batched equivalent of LUFactors::BlockFactor(): for each of the n systems,
+    given the LU factors of the (m x m) block A11 as produced by
+    BatchLUFactor(), overwrite the off-diagonal and trailing blocks with
+       A12 <- U12 = L^{-1} P A12
+       A21 <- L21 = A21 U^{-1}
+       A22 <- S22 = A22 - L21 U12,
+    where S22 is the Schur complement. The resulting blocks can be used with
+    LUFactors::BlockForwSolve()/BlockBackSolve(), and S22 can be factored
+    with another BatchLUFactor() call.
+
+    @param [in] Mlu batch of LU factors of the A11 blocks - dimension
+    m x m x n.
+    @param [in] P pivot information from BatchLUFactor() - dimension m x n.
+    @param [in, out] A12 batch of (1,2) blocks - dimension m x r x n.
+    @param [in, out] A21 batch of (2,1) blocks - dimension r x m x n.
+    @param [in, out] A22 batch of (2,2) blocks - dimension r x r x n. */
+void BatchBlockFactor(const DenseTensor &Mlu, const Array<int> &P,
+                      DenseTensor &A12, DenseTensor &A21, DenseTensor &A22);
+
+/** @brief Compute the inverses of a batch of matrices
+
+    Invert n matrices of size (m x m) in a single batched kernel launch. On
+    return, Minv(.,.,k) is the inverse of the k-th input matrix, and M is
+    overwritten with its LU factors as produced by BatchLUFactor().
+
+    @param [in, out] M batch of square matrices - dimension m x m x n.
+    @param [out] Minv batch of inverse matrices - dimension m x m x n. */
+void BatchInverse(DenseTensor &M, DenseTensor &Minv);
+
 
 // Inline methods
 
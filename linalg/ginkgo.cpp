@@ -17,10 +17,12 @@
 #include "sparsemat.hpp"
 #include "../general/globals.hpp"
 #include "../general/error.hpp"
+#include "../general/device.hpp"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
 #include <cmath>
+#include <map>
 
 namespace mfem
 {
@@ -28,26 +30,28 @@ namespace mfem
 namespace GinkgoWrappers
 {
 
-GinkgoIterativeSolverBase::GinkgoIterativeSolverBase(
-   const std::string &exec_type, int print_iter, int max_num_iter,
-   double RTOLERANCE, double ATOLERANCE)
-   : exec_type(exec_type),
-     print_lvl(print_iter),
-     max_iter(max_num_iter),
-     rel_tol(sqrt(RTOLERANCE)),
-     abs_tol(sqrt(ATOLERANCE))
+std::shared_ptr<gko::Executor>
+GinkgoIterativeSolverBase::GetExecutor(const std::string &exec_type)
 {
+   // One executor per execution paradigm is shared by all Ginkgo solver
+   // objects in the program: executor creation (in particular for CUDA) is
+   // expensive and the executor only represents the device.
+   static std::map<std::string, std::shared_ptr<gko::Executor>> executors;
+   auto it = executors.find(exec_type);
+   if (it != executors.end()) { return it->second; }
+
+   std::shared_ptr<gko::Executor> exec;
    if (exec_type == "reference")
    {
-      executor = gko::ReferenceExecutor::create();
+      exec = gko::ReferenceExecutor::create();
    }
    else if (exec_type == "omp")
    {
-      executor = gko::OmpExecutor::create();
+      exec = gko::OmpExecutor::create();
    }
    else if (exec_type == "cuda" && gko::CudaExecutor::get_num_devices() > 0)
    {
-      executor = gko::CudaExecutor::create(0, gko::OmpExecutor::create());
+      exec = gko::CudaExecutor::create(0, gko::OmpExecutor::create());
    }
    else
    {
@@ -55,6 +59,21 @@ GinkgoIterativeSolverBase::GinkgoIterativeSolverBase(
                 " exec_type needs to be one of the three strings: \"reference\", \"cuda\" or \"omp\" "
                 << std::endl;
    }
+   if (exec) { executors[exec_type] = exec; }
+   return exec;
+}
+
+GinkgoIterativeSolverBase::GinkgoIterativeSolverBase(
+   const std::string &exec_type, int print_iter, int max_num_iter,
+   double RTOLERANCE, double ATOLERANCE)
+   : exec_type(exec_type),
+     print_lvl(print_iter),
+     max_iter(max_num_iter),
+     rel_tol(sqrt(RTOLERANCE)),
+     abs_tol(sqrt(ATOLERANCE))
+{
+   executor = GetExecutor(exec_type);
+
    using ResidualCriterionFactory = gko::stop::ResidualNormReduction<>;
    residual_criterion             = ResidualCriterionFactory::build()
                                     .with_reduction_factor(rel_tol)
@@ -67,15 +86,20 @@ GinkgoIterativeSolverBase::GinkgoIterativeSolverBase(
                      .with_max_iters(max_iter)
                      .on(executor))
       .on(executor);
+
+   // Add the convergence logger object to the combined factory to retrieve
+   // the solver and other data. See the different masks available in Ginkgo's
+   // documentation
+   convergence_logger = gko::log::Convergence<>::create(
+                           executor, gko::log::Logger::criterion_check_completed_mask);
+   combined_factory->add_logger(convergence_logger);
 }
 
 void
 GinkgoIterativeSolverBase::initialize_ginkgo_log(gko::matrix::Dense<double>* b)
 {
-   // Add the logger object. See the different masks available in Ginkgo's
-   // documentation
-   convergence_logger = gko::log::Convergence<>::create(
-                           executor, gko::log::Logger::criterion_check_completed_mask);
+   // Add the residual logger object. See the different masks available in
+   // Ginkgo's documentation
    residual_logger = std::make_shared<ResidualLogger<>>(executor,
                                                         gko::lend(system_matrix),b);
 
@@ -91,44 +115,49 @@ GinkgoIterativeSolverBase::apply(Vector &solution,
 
    MFEM_VERIFY(system_matrix, "System matrix not initialized");
    MFEM_VERIFY(executor, "executor is not initialized");
+   MFEM_VERIFY(convergence_logger, "convergence logger not initialized" );
    MFEM_VERIFY(rhs.Size() == solution.Size(),
                "Mismatching sizes for rhs and solution");
-   // Create the rhs vector in Ginkgo's format.
-   std::vector<double> f(rhs.Size());
-   std::copy(rhs.GetData(), rhs.GetData() + rhs.Size(), f.begin());
+
+   // Access the data of the mfem vectors where the executor expects it: when
+   // the data and the executor are in the same place, Ginkgo uses the arrays
+   // in place, without copies; otherwise, the data is copied over to the
+   // executor.
+   const bool on_device = (executor != executor->get_master()) &&
+                          Device::Allows(Backend::CUDA_MASK);
+   auto data_exec = on_device ? executor : executor->get_master();
+
+   // Create a view of the rhs vector in Ginkgo's format. Ginkgo does not
+   // modify the rhs data.
    auto b =
       vec::create(executor,
                   gko::dim<2>(rhs.Size(), 1),
-                  val_array::view(executor->get_master(), rhs.Size(), f.data()),
+                  val_array::view(data_exec, rhs.Size(),
+                                  const_cast<double*>(
+                                     on_device ? rhs.Read() : rhs.HostRead())),
                   1);
 
-   // Create the solution vector in Ginkgo's format.
-   std::vector<double> u(solution.Size());
-   std::copy(solution.GetData(), solution.GetData() + solution.Size(), u.begin());
+   // Create a view of the solution vector in Ginkgo's format.
    auto x = vec::create(executor,
                         gko::dim<2>(solution.Size(), 1),
-                        val_array::view(executor->get_master(),
+                        val_array::view(data_exec,
                                         solution.Size(),
-                                        u.data()),
+                                        on_device ? solution.ReadWrite()
+                                        : solution.HostReadWrite()),
                         1);
 
-   // Create the logger object to log some data from the solvers to confirm
-   // convergence.
-   initialize_ginkgo_log(gko::lend(b));
-
-   MFEM_VERIFY(convergence_logger, "convergence logger not initialized" );
    if (print_lvl==1)
    {
+      // Create the logger object to log some data from the solvers to
+      // confirm convergence.
+      initialize_ginkgo_log(gko::lend(b));
       MFEM_VERIFY(residual_logger, "residual logger not initialized" );
       solver_gen->add_logger(residual_logger);
    }
 
-   // Generate the solver from the solver using the system matrix.
-   auto solver = solver_gen->generate(system_matrix);
-
-   // Add the convergence logger object to the combined factory to retrieve the
-   // solver and other data
-   combined_factory->add_logger(convergence_logger);
+   // Generate the solver from the system matrix, reusing the solver (and its
+   // workspace) from a previous call when the matrix has not changed.
+   if (!solver) { solver = solver_gen->generate(system_matrix); }
 
    // Finally, apply the solver to b and get the solution in x.
    solver->apply(gko::lend(b), gko::lend(x));
@@ -152,23 +181,13 @@ GinkgoIterativeSolverBase::apply(Vector &solution,
 
    // Ginkgo works with a relative residual norm through its
    // ResidualNormReduction criterion. Therefore, to get the normalized
-   // residual, we divide by the norm of the rhs.
+   // residual, we divide by the norm of the rhs. The norm is computed on the
+   // executor and the scalar result is brought back to the host.
+   auto b_norm_exec = vec::create(executor, gko::dim<2> {1, 1});
+   b->compute_norm2(b_norm_exec.get());
    auto b_norm = gko::matrix::Dense<double>::create(executor->get_master(),
                                                     gko::dim<2> {1, 1});
-   if (executor != executor->get_master())
-   {
-      auto b_master = vec::create(executor->get_master(),
-                                  gko::dim<2>(rhs.Size(), 1),
-                                  val_array::view(executor->get_master(),
-                                                  rhs.Size(),
-                                                  f.data()),
-                                  1);
-      b_master->compute_norm2(b_norm.get());
-   }
-   else
-   {
-      b->compute_norm2(b_norm.get());
-   }
+   b_norm->copy_from(b_norm_exec.get());
 
    MFEM_VERIFY(b_norm.get()->at(0, 0) != 0.0, " rhs norm is zero");
    // Some residual norm and convergence print outs. As both
@@ -189,6 +208,7 @@ GinkgoIterativeSolverBase::apply(Vector &solution,
    if (print_lvl ==1)
    {
       residual_logger->write();
+      solver_gen->remove_logger(gko::lend(residual_logger));
    }
    if (converged!=0)
    {
@@ -203,9 +223,9 @@ GinkgoIterativeSolverBase::apply(Vector &solution,
                 << fin_res_norm << '\n';
    }
 
-   // Check if the solution is on a CUDA device, if so, copy it over to the
-   // host.
-   if (executor != executor->get_master())
+   // When the solution was computed through a view, it is already in place in
+   // the mfem vector. Otherwise, copy it back from the executor.
+   if (executor != data_exec)
    {
       auto x_master = vec::create(executor->get_master(),
                                   gko::dim<2>(solution.Size(), 1),
@@ -213,12 +233,10 @@ GinkgoIterativeSolverBase::apply(Vector &solution,
                                                   solution.Size(),
                                                   x->get_values()),
                                   1);
-      x.reset(x_master.release());
+      std::copy(x_master->get_values(),
+                x_master->get_values() + solution.Size(),
+                solution.HostWrite());
    }
-   // Finally copy over the solution vector to mfem's solution vector.
-   std::copy(x->get_values(),
-             x->get_values() + solution.Size(),
-             solution.GetData());
 }
 
 void
@@ -227,31 +245,34 @@ GinkgoIterativeSolverBase::initialize(
 {
    // Needs to be a square matrix
    MFEM_VERIFY(matrix->Height() == matrix->Width(), "System matrix is not square");
+   // Needs the CSR arrays of the matrix
+   MFEM_VERIFY(matrix->Finalized(), "System matrix is not finalized");
 
    const int N = matrix->Size();
+   const int nnz = matrix->NumNonZeroElems();
    using mtx = gko::matrix::Csr<double, int>;
-   std::shared_ptr<mtx> system_matrix_compute;
-   system_matrix_compute   = mtx::create(executor->get_master(),
-                                         gko::dim<2>(N),
-                                         matrix->NumNonZeroElems());
-   double *mat_values   = system_matrix_compute->get_values();
-   int *mat_row_ptrs = system_matrix_compute->get_row_ptrs();
-   int *mat_col_idxs = system_matrix_compute->get_col_idxs();
-   mat_row_ptrs[0] =0;
-   for (int r=0; r< N; ++r)
-   {
-      const int* col = matrix->GetRowColumns(r);
-      const double * val = matrix->GetRowEntries(r);
-      mat_row_ptrs[r+1] = mat_row_ptrs[r] + matrix->RowSize(r);
-      for (int cj=0; cj < matrix->RowSize(r); cj++ )
-      {
-         mat_values[mat_row_ptrs[r]+cj] = val[cj];
-         mat_col_idxs[mat_row_ptrs[r]+cj] = col[cj];
-      }
-   }
+   // Create the system matrix as a view of mfem's CSR arrays, without copying
+   // the data: when the executor is a device executor, the device pointers of
+   // the matrix are used in place; when the data and the executor are in
+   // different places, Ginkgo copies the data over to the executor. Ginkgo
+   // does not modify the system matrix.
+   const bool on_device = (executor != executor->get_master()) &&
+                          Device::Allows(Backend::CUDA_MASK);
+   auto data_exec = on_device ? executor : executor->get_master();
+   double *mat_values = const_cast<double*>(
+      on_device ? matrix->ReadData() : matrix->HostReadData());
+   int *mat_row_ptrs = const_cast<int*>(
+      on_device ? matrix->ReadI() : matrix->HostReadI());
+   int *mat_col_idxs = const_cast<int*>(
+      on_device ? matrix->ReadJ() : matrix->HostReadJ());
    system_matrix =
-      mtx::create(executor, gko::dim<2>(N), matrix->NumNonZeroElems());
-   system_matrix->copy_from(system_matrix_compute.get());
+      mtx::create(executor, gko::dim<2>(N),
+                  gko::Array<double>::view(data_exec, nnz, mat_values),
+                  gko::Array<int>::view(data_exec, nnz, mat_col_idxs),
+                  gko::Array<int>::view(data_exec, N + 1, mat_row_ptrs));
+   // The system matrix has changed: the solver (and its workspace) will be
+   // re-generated by the next apply()
+   solver.reset();
 }
 
 void
@@ -249,7 +249,9 @@ public:
    virtual ~GinkgoIterativeSolverBase() = default;
 
    /**
-    * Initialize the matrix and copy over its data to Ginkgo's data structures.
+    * Initialize the system matrix as a view of the CSR arrays of @p matrix.
+    * The data is used in place, without copies, when it is accessible from
+    * the executor; otherwise it is copied over to the executor.
     */
    void
    initialize(const SparseMatrix *matrix);
@@ -270,6 +272,15 @@ public:
          Vector &            solution,
          const Vector &      rhs);
 
+   /**
+    * Return the shared Ginkgo executor associated with @p exec_type, creating
+    * it on first use. Executor creation (in particular for CUDA) is
+    * expensive, and the executor only represents the device, so one executor
+    * per execution paradigm is shared by all Ginkgo solver objects.
+    */
+   static std::shared_ptr<gko::Executor>
+   GetExecutor(const std::string &exec_type);
+
 
 protected:
    int print_lvl;
@@ -285,6 +296,13 @@ protected:
     */
    std::shared_ptr<gko::LinOpFactory> solver_gen;
 
+   /**
+    * The solver generated from the factory, kept alive between apply() calls
+    * so that its workspace is reused. It is re-generated when initialize()
+    * sets a new system matrix.
+    */
+   std::shared_ptr<gko::LinOp> solver;
+
    /**
     * The residual criterion object that controls the reduction of the residual
     * based on the tolerance set in the solver_control member.
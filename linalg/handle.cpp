@@ -249,6 +249,60 @@ void OperatorHandle::ConvertFrom(OperatorHandle &A)
    own_oper = true;
 }
 
+void OperatorHandle::ConvertFrom(OperatorHandle &A, long epoch)
+{
+   if (oper != NULL && conv_src == A.Ptr())
+   {
+      if (conv_epoch == epoch) { return; } // same values: cache hit
+      if (oper == A.Ptr())
+      {
+         // The conversion shares the source's storage, so the held operator
+         // sees the new values already; only the tag needs updating.
+         conv_epoch = epoch;
+         return;
+      }
+      // materialized conversion with changed values: rebuild below
+   }
+   ConvertFrom(A);
+   conv_src = A.Ptr();
+   conv_epoch = epoch;
+}
+
+void OperatorHandle::UpdatePtAP(OperatorHandle &A, OperatorHandle &P)
+{
+   switch (A.Type())
+   {
+      case Operator::ANY_TYPE:
+      {
+         // the RAPOperator only references A and P, so nothing was
+         // materialized and the product follows the new values by itself
+         if (Is<RAPOperator>()) { return; }
+         break;
+      }
+      case Operator::MFEM_SPARSEMAT:
+      {
+         SparseMatrix *prod = own_oper ? Is<SparseMatrix>() : NULL;
+         SparseMatrix *pP = P.As<SparseMatrix>();
+         if (prod && prod->Finalized() &&
+             prod->Height() == pP->Width() && prod->Width() == pP->Width())
+         {
+            SparseMatrix *R  = mfem::Transpose(*pP);
+            SparseMatrix *RA = mfem::Mult(*R, *A.As<SparseMatrix>());
+            delete R;
+            // refill the values of the existing product, reusing its
+            // sparsity structure
+            mfem::Mult(*RA, *pP, prod);
+            delete RA;
+            return;
+         }
+         break;
+      }
+      default: break;
+   }
+   // no reusable product held (or the backend cannot refill in place)
+   MakePtAP(A, P);
+}
+
 void OperatorHandle::EliminateRowsCols(OperatorHandle &A,
                                        const Array<int> &ess_dof_list)
 {
@@ -39,6 +39,12 @@ protected:
    Operator::Type type_id;
    bool           own_oper;
 
+   /// Source operator of the last cached conversion, see
+   /// ConvertFrom(OperatorHandle &, long).
+   const Operator *conv_src;
+   /// Epoch tag of the last cached conversion, or -1 when empty.
+   long            conv_epoch;
+
    Operator::Type CheckType(Operator::Type tid);
 
    template <typename OpType>
@@ -53,12 +59,14 @@ public:
    /** @brief Create an OperatorHandle with type id = Operator::MFEM_SPARSEMAT
        without allocating the actual matrix. */
    OperatorHandle()
-      : oper(NULL), type_id(Operator::MFEM_SPARSEMAT), own_oper(false) { }
+      : oper(NULL), type_id(Operator::MFEM_SPARSEMAT), own_oper(false),
+        conv_src(NULL), conv_epoch(-1) { }
 
    /** @brief Create a OperatorHandle with a specified type id, @a tid, without
        allocating the actual matrix. */
    explicit OperatorHandle(Operator::Type tid)
-      : oper(NULL), type_id(CheckType(tid)), own_oper(false) { }
+      : oper(NULL), type_id(CheckType(tid)), own_oper(false),
+        conv_src(NULL), conv_epoch(-1) { }
 
    /// Create an OperatorHandle for the given OpType pointer, @a A.
    /** Presently, OpType can be SparseMatrix, HypreParMatrix, or PetscParMatrix.
@@ -67,7 +75,8 @@ public:
 
        It is expected that @a A points to a valid object. */
    template <typename OpType>
-   explicit OperatorHandle(OpType *A, bool own_A = true) { pSet(A, own_A); }
+   explicit OperatorHandle(OpType *A, bool own_A = true)
+      : conv_src(NULL), conv_epoch(-1) { pSet(A, own_A); }
 
    ~OperatorHandle() { if (own_oper) { delete oper; } }
 
@@ -118,6 +127,8 @@ public:
       if (own_oper) { delete oper; }
       oper = NULL;
       own_oper = false;
+      conv_src = NULL;
+      conv_epoch = -1;
    }
 
    /// Invoke Clear() and set a new type id.
@@ -182,6 +193,26 @@ public:
       ConvertFrom(Ah);
    }
 
+   /** @brief Convert the given OperatorHandle @a A to the currently set type
+       id, reusing the previously converted operator when possible. */
+   /** The tag @a epoch identifies the values of @a A: callers bump it
+       whenever the values of the source change, e.g. after each reassembly.
+       When this handle already holds a conversion of the same source
+       operator, the call is a no-op if the epoch matches, and a cheap rebind
+       (no reallocation) if only the values changed and the two
+       representations share storage; a full ConvertFrom() is performed
+       otherwise. */
+   void ConvertFrom(OperatorHandle &A, long epoch);
+
+   /** @brief Update a product previously built by MakePtAP() after the
+       values of @a A changed but its structure did not. */
+   /** When this handle holds a PtAP product of matching type and dimensions,
+       the product is recomputed into the existing matrix (values only,
+       reusing its sparsity structure) instead of being reallocated; when it
+       does not, or the backend cannot refill in place, the call falls back
+       to MakePtAP(). */
+   void UpdatePtAP(OperatorHandle &A, OperatorHandle &P);
+
    /** @brief Reset the OperatorHandle to be the eliminated part of @a A after
        elimination of the essential dofs @a ess_dof_list. */
    void EliminateRowsCols(OperatorHandle &A, const Array<int> &ess_dof_list);
@@ -15,11 +15,13 @@
 
 #include "linalg.hpp"
 #include "../fem/fem.hpp"
+#include "../general/forall.hpp"
 
 #include <fstream>
 #include <iomanip>
 #include <cmath>
 #include <cstdlib>
+#include <cstring>
 
 #ifdef MFEM_USE_SUNDIALS
 #include <nvector/nvector_parallel.h>
@@ -81,6 +83,22 @@ HypreParVector::HypreParVector(MPI_Comm comm, HYPRE_Int glob_size,
    own_ParVector = 1;
 }
 
+HypreParVector::HypreParVector(MPI_Comm comm, HYPRE_Int glob_size,
+                               Memory<double> &mem, HYPRE_Int *col) : Vector()
+{
+   x = hypre_ParVectorCreate(comm,glob_size,col);
+   hypre_ParVectorSetDataOwner(x,1); // owns the seq vector
+   hypre_SeqVectorSetDataOwner(hypre_ParVectorLocalVector(x),0);
+   hypre_ParVectorSetPartitioningOwner(x,0);
+   double tmp = 0.0;
+   hypre_VectorData(hypre_ParVectorLocalVector(x)) = &tmp;
+   // If hypre_ParVectorLocalVector(x) and &tmp are non-NULL,
+   // hypre_ParVectorInitialize(x) does not allocate memory!
+   hypre_ParVectorInitialize(x);
+   own_ParVector = 1;
+   WrapMemoryReadWrite(mem);
+}
+
 HypreParVector::HypreParVector(const HypreParVector &y) : Vector()
 {
    x = hypre_ParVectorCreate(y.x -> comm, y.x -> global_size,
@@ -163,6 +181,38 @@ void HypreParVector::SetData(double *_data)
    Vector::SetData(_data);
 }
 
+void HypreParVector::WrapMemoryRead(const Memory<double> &mem)
+{
+   const int lsize = internal::to_int(
+                        hypre_VectorSize(hypre_ParVectorLocalVector(x)));
+   MFEM_ASSERT(mem.Capacity() >= lsize, "invalid size!");
+   // hypre operates on the host view of mem; MFEM operations access mem
+   // itself, so no copy of the data is made.
+   hypre_VectorData(hypre_ParVectorLocalVector(x)) =
+      const_cast<double*>(mem.Read(MemoryClass::HOST, lsize));
+   NewMemoryAndSize(mem, lsize, false);
+}
+
+void HypreParVector::WrapMemoryWrite(Memory<double> &mem)
+{
+   const int lsize = internal::to_int(
+                        hypre_VectorSize(hypre_ParVectorLocalVector(x)));
+   MFEM_ASSERT(mem.Capacity() >= lsize, "invalid size!");
+   hypre_VectorData(hypre_ParVectorLocalVector(x)) =
+      mem.Write(MemoryClass::HOST, lsize);
+   NewMemoryAndSize(mem, lsize, false);
+}
+
+void HypreParVector::WrapMemoryReadWrite(Memory<double> &mem)
+{
+   const int lsize = internal::to_int(
+                        hypre_VectorSize(hypre_ParVectorLocalVector(x)));
+   MFEM_ASSERT(mem.Capacity() >= lsize, "invalid size!");
+   hypre_VectorData(hypre_ParVectorLocalVector(x)) =
+      mem.ReadWrite(MemoryClass::HOST, lsize);
+   NewMemoryAndSize(mem, lsize, false);
+}
+
 HYPRE_Int HypreParVector::Randomize(HYPRE_Int seed)
 {
    return hypre_ParVectorSetRandomValues(x,seed);
@@ -239,6 +289,7 @@ void HypreParMatrix::Init()
 {
    A = NULL;
    X = Y = NULL;
+   diag_view = offd_view = NULL;
    diagOwner = offdOwner = colMapOwner = -1;
    ParCSROwner = 1;
 }
@@ -926,6 +977,26 @@ void HypreParMatrix::GetOffd(SparseMatrix &offd, HYPRE_Int* &cmap) const
    cmap = A->col_map_offd;
 }
 
+const SparseMatrix &HypreParMatrix::DiagView() const
+{
+   if (diag_view == NULL)
+   {
+      diag_view = new SparseMatrix;
+      MakeWrapper(A->diag, *diag_view);
+   }
+   return *diag_view;
+}
+
+const SparseMatrix &HypreParMatrix::OffdView() const
+{
+   if (offd_view == NULL)
+   {
+      offd_view = new SparseMatrix;
+      MakeWrapper(A->offd, *offd_view);
+   }
+   return *offd_view;
+}
+
 void HypreParMatrix::GetBlocks(Array2D<HypreParMatrix*> &blocks,
                                bool interleaved_rows,
                                bool interleaved_cols) const
@@ -1520,6 +1591,8 @@ void HypreParMatrix::Destroy()
 {
    if ( X != NULL ) { delete X; }
    if ( Y != NULL ) { delete Y; }
+   delete diag_view;
+   delete offd_view;
 
    if (A == NULL) { return; }
 
@@ -1691,6 +1764,68 @@ HypreParMatrix * RAP(const HypreParMatrix * Rt, const HypreParMatrix *A,
    return new HypreParMatrix(rap);
 }
 
+/// Copy the values of 'src' into 'dst', verifying that the two local CSR
+/// matrices have the same sparsity pattern.
+static void CopyCSRValues(hypre_CSRMatrix *dst, hypre_CSRMatrix *src)
+{
+   const HYPRE_Int nr = hypre_CSRMatrixNumRows(dst);
+   MFEM_VERIFY(nr == hypre_CSRMatrixNumRows(src),
+               "the sparsity pattern of the product has changed");
+   const HYPRE_Int nnz = hypre_CSRMatrixI(dst)[nr];
+   MFEM_VERIFY(nnz == hypre_CSRMatrixI(src)[nr] &&
+               memcmp(hypre_CSRMatrixI(dst), hypre_CSRMatrixI(src),
+                      (nr+1)*sizeof(HYPRE_Int)) == 0 &&
+               memcmp(hypre_CSRMatrixJ(dst), hypre_CSRMatrixJ(src),
+                      nnz*sizeof(HYPRE_Int)) == 0,
+               "the sparsity pattern of the product has changed");
+   memcpy(hypre_CSRMatrixData(dst), hypre_CSRMatrixData(src),
+          nnz*sizeof(double));
+}
+
+void HypreParMatrix::ReRAP(const HypreParMatrix &A_, const HypreParMatrix &P)
+{
+   ReRAP(P, A_, P);
+}
+
+void HypreParMatrix::ReRAP(const HypreParMatrix &Rt, const HypreParMatrix &A_,
+                           const HypreParMatrix &P)
+{
+   HYPRE_Int P_owns_its_col_starts =
+      hypre_ParCSRMatrixOwnsColStarts((hypre_ParCSRMatrix*)P);
+   HYPRE_Int Rt_owns_its_col_starts =
+      hypre_ParCSRMatrixOwnsColStarts((hypre_ParCSRMatrix*)Rt);
+
+   hypre_ParCSRMatrix *rap;
+   hypre_BoomerAMGBuildCoarseOperator(Rt, A_, P, &rap);
+
+   /* see the notes in RAP(): hypre_BoomerAMGBuildCoarseOperator steals the
+      col_starts from Rt and P */
+   hypre_ParCSRMatrixSetRowStartsOwner(rap, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(rap, 0);
+
+   if (P_owns_its_col_starts)
+   {
+      hypre_ParCSRMatrixSetColStartsOwner((hypre_ParCSRMatrix*)P, 1);
+   }
+   if (Rt_owns_its_col_starts)
+   {
+      hypre_ParCSRMatrixSetColStartsOwner((hypre_ParCSRMatrix*)Rt, 1);
+   }
+
+   hypre_CSRMatrix *offd = hypre_ParCSRMatrixOffd(A);
+   hypre_CSRMatrix *rap_offd = hypre_ParCSRMatrixOffd(rap);
+   MFEM_VERIFY(hypre_CSRMatrixNumCols(offd) ==
+               hypre_CSRMatrixNumCols(rap_offd) &&
+               memcmp(hypre_ParCSRMatrixColMapOffd(A),
+                      hypre_ParCSRMatrixColMapOffd(rap),
+                      hypre_CSRMatrixNumCols(offd)*sizeof(HYPRE_Int)) == 0,
+               "the off-diagonal structure of the product has changed");
+   CopyCSRValues(hypre_ParCSRMatrixDiag(A), hypre_ParCSRMatrixDiag(rap));
+   CopyCSRValues(offd, rap_offd);
+
+   hypre_ParCSRMatrixDestroy(rap);
+}
+
 // Helper function for HypreParMatrixFromBlocks. Note that scalability to
 // extremely large processor counts is limited by the use of MPI_Allgather.
 void GatherBlockOffsetData(MPI_Comm comm, const int rank, const int nprocs,
@@ -2025,6 +2160,130 @@ void EliminateBC(HypreParMatrix &A, HypreParMatrix &Ae,
    }
 }
 
+HypreBCEliminator::HypreBCEliminator(const Array<int> &rows_cols)
+   : Ae(NULL), diag_nnz(0), offd_nnz(0)
+{
+   get_sorted_rows_cols(rows_cols, ess_dofs);
+}
+
+void HypreBCEliminator::BuildPattern(const HypreParMatrix &A)
+{
+   hypre_ParCSRMatrix *parA  = A;
+   hypre_ParCSRMatrix *parAe = *Ae;
+
+   hypre_CSRMatrix *A_diag  = hypre_ParCSRMatrixDiag(parA);
+   hypre_CSRMatrix *A_offd  = hypre_ParCSRMatrixOffd(parA);
+   hypre_CSRMatrix *Ae_diag = hypre_ParCSRMatrixDiag(parAe);
+   hypre_CSRMatrix *Ae_offd = hypre_ParCSRMatrixOffd(parAe);
+
+   diag_nnz = hypre_CSRMatrixNumNonzeros(A_diag);
+   offd_nnz = hypre_CSRMatrixNumNonzeros(A_offd);
+
+   const HYPRE_Int nrows = hypre_CSRMatrixNumRows(A_diag);
+
+   // For each entry of Ae_diag, find the position of the entry with the same
+   // (row, col) in A_diag; entries on the eliminated diagonal receive 1 in A
+   // and are recorded separately.
+   {
+      const HYPRE_Int *A_i  = hypre_CSRMatrixI(A_diag);
+      const HYPRE_Int *A_j  = hypre_CSRMatrixJ(A_diag);
+      const HYPRE_Int *Ae_i = hypre_CSRMatrixI(Ae_diag);
+      const HYPRE_Int *Ae_j = hypre_CSRMatrixJ(Ae_diag);
+
+      diag_pos.SetSize(hypre_CSRMatrixNumNonzeros(Ae_diag));
+      diag_ones.SetSize(0);
+      for (HYPRE_Int r = 0; r < nrows; r++)
+      {
+         for (HYPRE_Int k = Ae_i[r]; k < Ae_i[r+1]; k++)
+         {
+            const HYPRE_Int col = Ae_j[k];
+            HYPRE_Int j = A_i[r];
+            while (A_j[j] != col) { j++; MFEM_ASSERT(j < A_i[r+1], ""); }
+            diag_pos[k] = j;
+            if (col == r) { diag_ones.Append(k); }
+         }
+      }
+   }
+
+   // Same for the offd blocks, matching global column indices through the
+   // column maps since Ae_offd uses its own compressed column numbering.
+   {
+      const HYPRE_Int *A_i  = hypre_CSRMatrixI(A_offd);
+      const HYPRE_Int *A_j  = hypre_CSRMatrixJ(A_offd);
+      const HYPRE_Int *Ae_i = hypre_CSRMatrixI(Ae_offd);
+      const HYPRE_Int *Ae_j = hypre_CSRMatrixJ(Ae_offd);
+      const HYPRE_Int *A_cmap  = hypre_ParCSRMatrixColMapOffd(parA);
+      const HYPRE_Int *Ae_cmap = hypre_ParCSRMatrixColMapOffd(parAe);
+
+      offd_pos.SetSize(hypre_CSRMatrixNumNonzeros(Ae_offd));
+      for (HYPRE_Int r = 0; r < nrows; r++)
+      {
+         for (HYPRE_Int k = Ae_i[r]; k < Ae_i[r+1]; k++)
+         {
+            const HYPRE_Int gcol = Ae_cmap[Ae_j[k]];
+            HYPRE_Int j = A_i[r];
+            while (A_cmap[A_j[j]] != gcol) { j++; MFEM_ASSERT(j < A_i[r+1], ""); }
+            offd_pos[k] = j;
+         }
+      }
+   }
+}
+
+const HypreParMatrix &HypreBCEliminator::Eliminate(HypreParMatrix &A)
+{
+   if (!Ae)
+   {
+      // First call: full structural elimination + record the pattern.
+      hypre_ParCSRMatrix *ae;
+      internal::hypre_ParCSRMatrixEliminateAAe(
+         A, &ae, ess_dofs.Size(), ess_dofs.GetData());
+      Ae = new HypreParMatrix(ae);
+      BuildPattern(A);
+      return *Ae;
+   }
+
+   hypre_ParCSRMatrix *parA  = A;
+   hypre_ParCSRMatrix *parAe = *Ae;
+
+   hypre_CSRMatrix *A_diag  = hypre_ParCSRMatrixDiag(parA);
+   hypre_CSRMatrix *A_offd  = hypre_ParCSRMatrixOffd(parA);
+
+   MFEM_VERIFY(hypre_CSRMatrixNumNonzeros(A_diag) == diag_nnz &&
+               hypre_CSRMatrixNumNonzeros(A_offd) == offd_nnz &&
+               A.Height() == Ae->Height(),
+               "matrix sparsity pattern does not match the cached"
+               " elimination pattern");
+
+   // Values-only elimination: move the recorded entries of A into Ae and set
+   // the eliminated diagonal to identity, reproducing the result of
+   // HypreParMatrix::EliminateRowsCols() without rescanning the structure.
+   double *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   double *Ae_diag_data = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(parAe));
+   for (int k = 0; k < diag_pos.Size(); k++)
+   {
+      const HYPRE_Int j = diag_pos[k];
+      Ae_diag_data[k] = A_diag_data[j];
+      A_diag_data[j] = 0.0;
+   }
+   for (int m = 0; m < diag_ones.Size(); m++)
+   {
+      const HYPRE_Int k = diag_ones[m];
+      Ae_diag_data[k] -= 1.0;
+      A_diag_data[diag_pos[k]] = 1.0;
+   }
+
+   double *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   double *Ae_offd_data = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(parAe));
+   for (int k = 0; k < offd_pos.Size(); k++)
+   {
+      const HYPRE_Int j = offd_pos[k];
+      Ae_offd_data[k] = A_offd_data[j];
+      A_offd_data[j] = 0.0;
+   }
+
+   return *Ae;
+}
+
 // Taubin or "lambda-mu" scheme, which alternates between positive and
 // negative step sizes to approximate low-pass filter effect.
 
@@ -2375,6 +2634,41 @@ void HypreSmoother::Mult(const HypreParVector &b, HypreParVector &x) const
       return;
    }
 
+   // Native path for the l1-scaled Jacobi smoother: the update is a matvec
+   // plus pointwise kernels, so it can run through MFEM's device kernels
+   // without bouncing the vectors through hypre's host-side relaxation
+   // driver. (l1-GS stays in hypre: its on-rank sweep is sequential.)
+   if (type == 1 && l1_norms && relax_times >= 1)
+   {
+      if (V == NULL)
+      {
+         V = new HypreParVector(*A);
+      }
+      const Vector l1(l1_norms, height);
+      const double w = relax_weight;
+      const int n = height;
+      int sweep = 0;
+      if (!iterative_mode)
+      {
+         // First sweep from the zero initial guess: x = w D_{l1}^{-1} b.
+         auto B_d = b.Read();
+         auto D_d = l1.Read();
+         auto X_d = x.Write();
+         MFEM_FORALL(i, n, X_d[i] = w*B_d[i]/D_d[i]; );
+         sweep = 1;
+      }
+      for (; sweep < relax_times; sweep++)
+      {
+         A->Mult(x, *V); // handles the halo exchange
+         auto B_d = b.Read();
+         auto D_d = l1.Read();
+         auto V_d = V->Read();
+         auto X_d = x.ReadWrite();
+         MFEM_FORALL(i, n, X_d[i] += w*(B_d[i] - V_d[i])/D_d[i]; );
+      }
+      return;
+   }
+
    b.HostRead();
    if (!iterative_mode)
    {
@@ -2441,24 +2735,28 @@ void HypreSmoother::Mult(const Vector &b, Vector &x) const
       return;
    }
 
-   auto b_data = b.HostRead();
-   auto x_data = iterative_mode ? x.HostReadWrite() : x.HostWrite();
-
    if (B == NULL)
    {
       B = new HypreParVector(A->GetComm(),
                              A -> GetGlobalNumRows(),
-                             const_cast<double*>(b_data),
+                             (double*)NULL,
                              A -> GetRowStarts());
       X = new HypreParVector(A->GetComm(),
                              A -> GetGlobalNumCols(),
-                             x_data,
+                             (double*)NULL,
                              A -> GetColStarts());
    }
+
+   // B and X share the memory of b and x: only the host views needed by
+   // hypre are synchronized, no data is copied in or out of the wrappers.
+   B -> WrapMemoryRead(b.GetMemory());
+   if (iterative_mode)
+   {
+      X -> WrapMemoryReadWrite(x.GetMemory());
+   }
    else
    {
-      B -> SetData(const_cast<double*>(b_data));
-      X -> SetData(x_data);
+      X -> WrapMemoryWrite(x.GetMemory());
    }
 
    Mult(*B, *X);
@@ -3672,7 +3970,6 @@ void HypreAMS::Init(ParFiniteElementSpace *edge_fespace)
    HYPRE_AMSSetPrintLevel(ams, 1);
 
    // define the nodal linear finite element space associated with edge_fespace
-   FiniteElementCollection *vert_fec;
    if (trace_space)
    {
       vert_fec = new H1_Trace_FECollection(p, dim);
@@ -3681,41 +3978,13 @@ void HypreAMS::Init(ParFiniteElementSpace *edge_fespace)
    {
       vert_fec = new H1_FECollection(p, dim);
    }
-   ParFiniteElementSpace *vert_fespace = new ParFiniteElementSpace(pmesh,
-                                                                   vert_fec);
+   vert_fespace = new ParFiniteElementSpace(pmesh, vert_fec);
 
    // generate and set the vertex coordinates
+   x = y = z = NULL;
    if (p == 1)
    {
-      ParGridFunction x_coord(vert_fespace);
-      ParGridFunction y_coord(vert_fespace);
-      ParGridFunction z_coord(vert_fespace);
-      double *coord;
-      for (int i = 0; i < pmesh->GetNV(); i++)
-      {
-         coord = pmesh -> GetVertex(i);
-         x_coord(i) = coord[0];
-         y_coord(i) = coord[1];
-         if (sdim == 3) { z_coord(i) = coord[2]; }
-      }
-      x = x_coord.ParallelProject();
-      y = y_coord.ParallelProject();
-      if (sdim == 2)
-      {
-         z = NULL;
-         HYPRE_AMSSetCoordinateVectors(ams, *x, *y, NULL);
-      }
-      else
-      {
-         z = z_coord.ParallelProject();
-         HYPRE_AMSSetCoordinateVectors(ams, *x, *y, *z);
-      }
-   }
-   else
-   {
-      x = NULL;
-      y = NULL;
-      z = NULL;
+      UpdateCoordinates();
    }
 
    // generate and set the discrete gradient
@@ -3779,8 +4048,15 @@ void HypreAMS::Init(ParFiniteElementSpace *edge_fespace)
       delete vert_fespace_d;
    }
 
-   delete vert_fespace;
-   delete vert_fec;
+   if (p > 1)
+   {
+      // the vertex space is kept in the lowest-order setup only, where it is
+      // needed to update the coordinate vectors, see UpdateCoordinates()
+      delete vert_fespace;
+      delete vert_fec;
+      vert_fespace = NULL;
+      vert_fec = NULL;
+   }
 
    if (rt_trace_space)
    {
@@ -3802,6 +4078,43 @@ void HypreAMS::Init(ParFiniteElementSpace *edge_fespace)
    error_mode = IGNORE_HYPRE_ERRORS;
 }
 
+void HypreAMS::UpdateCoordinates()
+{
+   if (!vert_fespace) { return; } // high-order setup: no coordinates are used
+
+   ParMesh *pmesh = vert_fespace->GetParMesh();
+   const int sdim = pmesh->SpaceDimension();
+
+   ParGridFunction x_coord(vert_fespace);
+   ParGridFunction y_coord(vert_fespace);
+   ParGridFunction z_coord(vert_fespace);
+   double *coord;
+   for (int i = 0; i < pmesh->GetNV(); i++)
+   {
+      coord = pmesh -> GetVertex(i);
+      x_coord(i) = coord[0];
+      y_coord(i) = coord[1];
+      if (sdim == 3) { z_coord(i) = coord[2]; }
+   }
+   delete x;
+   delete y;
+   delete z;
+   x = x_coord.ParallelProject();
+   y = y_coord.ParallelProject();
+   if (sdim == 2)
+   {
+      z = NULL;
+      HYPRE_AMSSetCoordinateVectors(ams, *x, *y, NULL);
+   }
+   else
+   {
+      z = z_coord.ParallelProject();
+      HYPRE_AMSSetCoordinateVectors(ams, *x, *y, *z);
+   }
+
+   setup_called = 0; // redo the AMS setup with the new coordinates
+}
+
 void HypreAMS::SetOperator(const Operator &op)
 {
    const HypreParMatrix *new_A = dynamic_cast<const HypreParMatrix *>(&op);
@@ -3831,6 +4144,9 @@ HypreAMS::~HypreAMS()
    delete Pix;
    delete Piy;
    delete Piz;
+
+   delete vert_fespace;
+   delete vert_fec;
 }
 
 void HypreAMS::SetPrintLevel(int print_lvl)
@@ -3889,7 +4205,7 @@ void HypreADS::Init(ParFiniteElementSpace *face_fespace)
 
    // define the nodal and edge finite element spaces associated with face_fespace
    ParMesh *pmesh = (ParMesh *) face_fespace->GetMesh();
-   FiniteElementCollection *vert_fec, *edge_fec;
+   FiniteElementCollection *edge_fec;
    if (trace_space)
    {
       vert_fec = new H1_Trace_FECollection(p, 3);
@@ -3901,35 +4217,15 @@ void HypreADS::Init(ParFiniteElementSpace *face_fespace)
       edge_fec = new ND_FECollection(p, 3);
    }
 
-   ParFiniteElementSpace *vert_fespace = new ParFiniteElementSpace(pmesh,
-                                                                   vert_fec);
+   vert_fespace = new ParFiniteElementSpace(pmesh, vert_fec);
    ParFiniteElementSpace *edge_fespace = new ParFiniteElementSpace(pmesh,
                                                                    edge_fec);
 
    // generate and set the vertex coordinates
+   x = y = z = NULL;
    if (p == 1)
    {
-      ParGridFunction x_coord(vert_fespace);
-      ParGridFunction y_coord(vert_fespace);
-      ParGridFunction z_coord(vert_fespace);
-      double *coord;
-      for (int i = 0; i < pmesh->GetNV(); i++)
-      {
-         coord = pmesh -> GetVertex(i);
-         x_coord(i) = coord[0];
-         y_coord(i) = coord[1];
-         z_coord(i) = coord[2];
-      }
-      x = x_coord.ParallelProject();
-      y = y_coord.ParallelProject();
-      z = z_coord.ParallelProject();
-      HYPRE_ADSSetCoordinateVectors(ads, *x, *y, *z);
-   }
-   else
-   {
-      x = NULL;
-      y = NULL;
-      z = NULL;
+      UpdateCoordinates();
    }
 
    // generate and set the discrete curl
@@ -4053,8 +4349,15 @@ void HypreADS::Init(ParFiniteElementSpace *face_fespace)
       delete vert_fespace_d;
    }
 
-   delete vert_fec;
-   delete vert_fespace;
+   if (p > 1)
+   {
+      // the vertex space is kept in the lowest-order setup only, where it is
+      // needed to update the coordinate vectors, see UpdateCoordinates()
+      delete vert_fec;
+      delete vert_fespace;
+      vert_fec = NULL;
+      vert_fespace = NULL;
+   }
    delete edge_fec;
    delete edge_fespace;
 
@@ -4072,6 +4375,34 @@ void HypreADS::Init(ParFiniteElementSpace *face_fespace)
    error_mode = IGNORE_HYPRE_ERRORS;
 }
 
+void HypreADS::UpdateCoordinates()
+{
+   if (!vert_fespace) { return; } // high-order setup: no coordinates are used
+
+   ParMesh *pmesh = vert_fespace->GetParMesh();
+
+   ParGridFunction x_coord(vert_fespace);
+   ParGridFunction y_coord(vert_fespace);
+   ParGridFunction z_coord(vert_fespace);
+   double *coord;
+   for (int i = 0; i < pmesh->GetNV(); i++)
+   {
+      coord = pmesh -> GetVertex(i);
+      x_coord(i) = coord[0];
+      y_coord(i) = coord[1];
+      z_coord(i) = coord[2];
+   }
+   delete x;
+   delete y;
+   delete z;
+   x = x_coord.ParallelProject();
+   y = y_coord.ParallelProject();
+   z = z_coord.ParallelProject();
+   HYPRE_ADSSetCoordinateVectors(ads, *x, *y, *z);
+
+   setup_called = 0; // redo the ADS setup with the new coordinates
+}
+
 void HypreADS::SetOperator(const Operator &op)
 {
    const HypreParMatrix *new_A = dynamic_cast<const HypreParMatrix *>(&op);
@@ -4108,6 +4439,9 @@ HypreADS::~HypreADS()
    delete ND_Pix;
    delete ND_Piy;
    delete ND_Piz;
+
+   delete vert_fespace;
+   delete vert_fec;
 }
 
 void HypreADS::SetPrintLevel(int print_lvl)
@@ -4265,6 +4599,8 @@ HypreLOBPCG::SetOperator(Operator & A)
 {
    HYPRE_Int locSize = A.Width();
 
+   delete [] part;
+
    if (HYPRE_AssumedPartitionCheck())
    {
       part = new HYPRE_Int[2];
@@ -4360,23 +4696,66 @@ HypreLOBPCG::SetInitialVectors(int num_vecs, HypreParVector ** vecs)
    // Ensure all vectors are in the proper subspace
    if ( subSpaceProj != NULL )
    {
-      HypreParVector y(*x);
-      y = multi_vec->GetVector(0);
+      ApplySubSpaceProjector();
+   }
+}
 
-      for (int i=1; i<nev; i++)
-      {
-         subSpaceProj->Mult(multi_vec->GetVector(i),
-                            multi_vec->GetVector(i-1));
-      }
-      subSpaceProj->Mult(y,
-                         multi_vec->GetVector(nev-1));
+void
+HypreLOBPCG::ApplySubSpaceProjector()
+{
+   HypreParVector y(*x);
+   y = multi_vec->GetVector(0);
+
+   for (int i=1; i<nev; i++)
+   {
+      subSpaceProj->Mult(multi_vec->GetVector(i),
+                         multi_vec->GetVector(i-1));
+   }
+   subSpaceProj->Mult(y,
+                      multi_vec->GetVector(nev-1));
+}
+
+void
+HypreLOBPCG::ProjectInitialVectors(const Operator &P)
+{
+   MFEM_VERIFY(x != NULL, "HypreLOBPCG::ProjectInitialVectors():"
+               " call SetOperator() with the new operator first");
+   MFEM_VERIFY(multi_vec != NULL, "HypreLOBPCG::ProjectInitialVectors():"
+               " no eigenvectors from a previous Solve()");
+   MFEM_VERIFY(P.Height() == x->Size() &&
+               P.Width() == multi_vec->GetVector(0).Size(),
+               "HypreLOBPCG::ProjectInitialVectors():"
+               " the transfer operator sizes do not match the old and new"
+               " discretizations");
+
+   HypreMultiVector *new_vec = new HypreMultiVector(nev, *x, interpreter);
+
+   // Apply the transfer operator to all eigenvectors as one block
+   Array<const Vector *> X(nev);
+   Array<Vector *> Y(nev);
+   for (int i=0; i<nev; i++)
+   {
+      X[i] = &multi_vec->GetVector(i);
+      Y[i] = &new_vec->GetVector(i);
+   }
+   P.ArrayMult(X, Y);
+
+   delete multi_vec;
+   multi_vec = new_vec;
+
+   // Ensure all vectors are in the proper subspace
+   if ( subSpaceProj != NULL )
+   {
+      ApplySubSpaceProjector();
    }
 }
 
 void
 HypreLOBPCG::Solve()
 {
-   // Initialize HypreMultiVector object if necessary
+   // Initialize HypreMultiVector object if necessary; once created, the
+   // multivector is reused by subsequent calls, so re-solves start from the
+   // previous eigenvectors.
    if ( multi_vec == NULL )
    {
       MFEM_ASSERT(x != NULL, "In HypreLOBPCG::Solve()");
@@ -4386,15 +4765,7 @@ HypreLOBPCG::Solve()
 
       if ( subSpaceProj != NULL )
       {
-         HypreParVector y(*x);
-         y = multi_vec->GetVector(0);
-
-         for (int i=1; i<nev; i++)
-         {
-            subSpaceProj->Mult(multi_vec->GetVector(i),
-                               multi_vec->GetVector(i-1));
-         }
-         subSpaceProj->Mult(y, multi_vec->GetVector(nev-1));
+         ApplySubSpaceProjector();
       }
    }
 
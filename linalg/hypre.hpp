@@ -101,6 +101,16 @@ public:
        hypre_partitioning_descr "here" for a description of the @a col array. */
    HypreParVector(MPI_Comm comm, HYPRE_Int glob_size, double *_data,
                   HYPRE_Int *col);
+   /** @brief Creates a vector that wraps the data of @a mem without copying.
+
+       The base Vector shares @a mem itself, so device-resident data is used
+       directly by MFEM operations, while hypre operates on the host view of
+       @a mem which the memory manager keeps coherent. @a mem is not owned
+       and must stay valid for the lifetime of the wrapper; see
+       WrapMemoryReadWrite() and @ref hypre_partitioning_descr "here" for a
+       description of the @a col array. */
+   HypreParVector(MPI_Comm comm, HYPRE_Int glob_size, Memory<double> &mem,
+                  HYPRE_Int *col);
    /// Creates vector compatible with y
    HypreParVector(const HypreParVector &y);
    /// Creates vector compatible with (i.e. in the domain of) A or A^T
@@ -150,6 +160,22 @@ public:
        HypreParVector(MPI_Comm, HYPRE_Int, double *, HYPRE_Int *). */
    void SetData(double *_data);
 
+   /** @brief Replace the data of the Vector and the hypre_ParVector with a
+       read-only view of @a mem without copying.
+
+       The host view of @a mem is updated, if needed, for use by hypre, while
+       MFEM operations access @a mem directly, including any device-resident
+       copy. The contents of the vector must not be modified while the view
+       is in use. Must be used only for HypreParVector%s that do not own
+       their data, see SetData(). */
+   void WrapMemoryRead(const Memory<double> &mem);
+   /** @brief Replace the data of the Vector and the hypre_ParVector with a
+       write-only view of @a mem (no copy); the previous contents of @a mem
+       are not preserved. See WrapMemoryRead(). */
+   void WrapMemoryWrite(Memory<double> &mem);
+   /// Replace the data with a read-write view of @a mem, see WrapMemoryRead().
+   void WrapMemoryReadWrite(Memory<double> &mem);
+
    /// Set random values
    HYPRE_Int Randomize(HYPRE_Int seed);
 
@@ -187,6 +213,9 @@ private:
    /// Auxiliary vectors for typecasting
    mutable HypreParVector *X, *Y;
 
+   /// Cached views of the diag and offd blocks, see DiagView() and OffdView().
+   mutable SparseMatrix *diag_view, *offd_view;
+
    // Flags indicating ownership of A->diag->{i,j,data}, A->offd->{i,j,data},
    // and A->col_map_offd.
    // The possible values for diagOwner are:
@@ -388,6 +417,18 @@ public:
    /// Get the local off-diagonal block. NOTE: 'offd' will not own any data.
    void GetOffd(SparseMatrix &offd, HYPRE_Int* &cmap) const;
 
+   /** @brief Return a cached SparseMatrix view of the local diagonal block
+       that shares its data with hypre's CSR matrix.
+
+       The view is created on the first call and reused afterwards, so
+       repeated conversions do not move any data (with HYPRE_BIGINT, the I
+       and J arrays are converted once when the view is created). The view
+       is owned by this matrix and is valid as long as the matrix is not
+       modified. */
+   const SparseMatrix &DiagView() const;
+   /// Return a cached view of the local off-diagonal block, see DiagView().
+   const SparseMatrix &OffdView() const;
+
    /** Split the matrix into M x N equally sized blocks of parallel matrices.
        The size of 'blocks' must already be set to M x N. */
    void GetBlocks(Array2D<HypreParMatrix*> &blocks,
@@ -397,6 +438,25 @@ public:
    /// Returns the transpose of *this
    HypreParMatrix * Transpose() const;
 
+   /** @brief Update this matrix, previously created with mfem::RAP(&A, &P),
+       with the values of the product for a new @a A with unchanged sparsity
+       pattern.
+
+       The triple product is recomputed and its values are copied into this
+       matrix, which keeps its structure, partitioning and communication
+       package, so references to it (e.g. in dependent objects and already
+       constructed solvers) remain valid. An error is raised if the sparsity
+       pattern of the product has changed, e.g. after mesh adaptation.
+
+       Note: hypre does not expose a symbolic/numeric split of the triple
+       product, so the structure is recomputed internally as well; the saving
+       is in not having to rebuild everything that references the product. */
+   void ReRAP(const HypreParMatrix &A, const HypreParMatrix &P);
+
+   /// Analogous to ReRAP(A, P) for a product created with mfem::RAP(&Rt, &A, &P).
+   void ReRAP(const HypreParMatrix &Rt, const HypreParMatrix &A,
+              const HypreParMatrix &P);
+
    /// Returns the number of rows in the diagonal block of the ParCSRMatrix
    int GetNumRows() const
    {
@@ -587,6 +647,51 @@ HypreParMatrix * HypreParMatrixFromBlocks(Array2D<HypreParMatrix*> &blocks,
 void EliminateBC(HypreParMatrix &A, HypreParMatrix &Ae,
                  const Array<int> &ess_dof_list, const Vector &X, Vector &B);
 
+/** @brief Reusable essential-BC eliminator for a HypreParMatrix that is
+    reassembled with an unchanged sparsity pattern.
+
+    The first call to Eliminate() performs the full structural elimination,
+    see HypreParMatrix::EliminateRowsCols(const Array<int> &), and records
+    the positions of all matrix entries that elimination modifies, keyed to
+    the essential dof list given at construction. Subsequent calls skip the
+    structural scan and the neighbor communication, applying a values-only
+    sweep and updating the stored eliminated matrix Ae in place — useful,
+    e.g., when a time-dependent operator is rebuilt every step with the same
+    mesh and essential dofs. */
+class HypreBCEliminator
+{
+protected:
+   Array<HYPRE_Int> ess_dofs; ///< Sorted local indices of the rows/cols.
+   HypreParMatrix *Ae; ///< The eliminated entries, owned; NULL until used.
+   /** @name Cached elimination pattern
+       Positions of the entries of the diag and offd blocks of Ae in the data
+       arrays of the corresponding blocks of the eliminated matrix, plus the
+       subset of diag entries that receive 1 on the eliminated diagonal. The
+       block sizes are kept to check that later matrices match the pattern. */
+   ///@{
+   Array<HYPRE_Int> diag_pos, offd_pos, diag_ones;
+   HYPRE_Int diag_nnz, offd_nnz;
+   ///@}
+
+   /// Record the elimination pattern by matching @a A against @a *Ae.
+   void BuildPattern(const HypreParMatrix &A);
+
+public:
+   /// Prepare elimination of the rows/cols listed in @a rows_cols.
+   HypreBCEliminator(const Array<int> &rows_cols);
+
+   /** @brief Eliminate the essential rows/cols from @a A, returning the
+       matrix of eliminated entries so that the modified matrix and the
+       returned matrix sum to the original one.
+
+       The returned matrix is owned by this object and is overwritten by the
+       next call. After the first call, @a A must have the same local
+       sparsity pattern as the matrix passed first. */
+   const HypreParMatrix &Eliminate(HypreParMatrix &A);
+
+   ~HypreBCEliminator() { delete Ae; }
+};
+
 
 /// Parallel smoothers in hypre
 class HypreSmoother : public Solver
@@ -1146,6 +1251,11 @@ private:
    HypreParMatrix *G;
    /// Nedelec interpolation matrix and its components
    HypreParMatrix *Pi, *Pix, *Piy, *Piz;
+   /** Nodal space and collection used to evaluate the vertex coordinates;
+       owned, kept only in the lowest-order setup to allow coordinate updates
+       under mesh motion, see UpdateCoordinates(). */
+   ParFiniteElementSpace *vert_fespace;
+   FiniteElementCollection *vert_fec;
 
 public:
    HypreAMS(ParFiniteElementSpace *edge_fespace);
@@ -1154,6 +1264,15 @@ public:
 
    virtual void SetOperator(const Operator &op);
 
+   /** @brief Update the vertex coordinate vectors after a change in the mesh
+       node positions, e.g. under mesh motion with fixed topology.
+
+       The topology-dependent part of the setup (the discrete gradient and
+       interpolation matrices) is reused; the AMS setup is redone with the new
+       coordinates on the next solve. No-op in the high-order setup, which
+       does not use vertex coordinates. */
+   void UpdateCoordinates();
+
    void SetPrintLevel(int print_lvl);
 
    /// Set this option when solving a curl-curl problem with zero mass term
@@ -1189,6 +1308,11 @@ private:
    HypreParMatrix *ND_Pi, *ND_Pix, *ND_Piy, *ND_Piz;
    /// Raviart-Thomas interpolation matrix and its components
    HypreParMatrix *RT_Pi, *RT_Pix, *RT_Piy, *RT_Piz;
+   /** Nodal space and collection used to evaluate the vertex coordinates;
+       owned, kept only in the lowest-order setup to allow coordinate updates
+       under mesh motion, see UpdateCoordinates(). */
+   ParFiniteElementSpace *vert_fespace;
+   FiniteElementCollection *vert_fec;
 
 public:
    HypreADS(ParFiniteElementSpace *face_fespace);
@@ -1197,6 +1321,15 @@ public:
 
    virtual void SetOperator(const Operator &op);
 
+   /** @brief Update the vertex coordinate vectors after a change in the mesh
+       node positions, e.g. under mesh motion with fixed topology.
+
+       The topology-dependent part of the setup (the discrete gradient, curl,
+       and interpolation matrices) is reused; the ADS setup is redone with the
+       new coordinates on the next solve. No-op in the high-order setup, which
+       does not use vertex coordinates. */
+   void UpdateCoordinates();
+
    void SetPrintLevel(int print_lvl);
 
    /// The typecast to HYPRE_Solver returns the internal ads object
@@ -1300,6 +1433,9 @@ private:
       mv_MultiVectorPtr & GetMultiVector() { return mv_ptr; }
    };
 
+   /// Project all vectors of #multi_vec into the subspace of #subSpaceProj.
+   void ApplySubSpaceProjector();
+
    static void    * OperatorMatvecCreate( void *A, void *x );
    static HYPRE_Int OperatorMatvec( void *matvec_data,
                                     HYPRE_Complex alpha,
@@ -1337,7 +1473,28 @@ public:
    void SetMassMatrix(Operator & M);
    void SetSubSpaceProjector(Operator & proj) { subSpaceProj = &proj; }
 
-   /// Solve the eigenproblem
+   /** @brief Warm-start the next Solve() with the eigenvectors of a previous
+       one, mapped to the current discretization by the operator @a P.
+
+       Intended for re-solves after small mesh or operator perturbations:
+       call SetOperator() with the new operator first, then pass the
+       old-to-new transfer operator (e.g. the prolongation between the two
+       spaces) as @a P. The stored eigenvectors are replaced with their
+       images under @a P, applied as one block through the multi-RHS engine
+       (Operator::ArrayMult), and the subspace projector, if set, is
+       re-applied.
+
+       When the discretization is unchanged, no call is needed: the
+       multivector persists across Solve() calls, so a re-solve already
+       starts from the previous eigenvectors. */
+   void ProjectInitialVectors(const Operator &P);
+
+   /** @brief Solve the eigenproblem.
+
+       The eigenvector storage is created on the first call and reused
+       afterwards, so repeated calls warm-start from the current contents of
+       the multivector (the previous eigenvectors, vectors given with
+       SetInitialVectors(), or the images set by ProjectInitialVectors()). */
    void Solve();
 
    /// Collect the converged eigenvalues
@@ -22,6 +22,7 @@
 #include "../general/globals.hpp"
 
 #include "matrix.hpp"
+#include "simd.hpp"
 #include "tmatrix.hpp"
 #include "tlayout.hpp"
 #include "ttensor.hpp"
@@ -134,6 +135,16 @@ void CalcInverse(const T *data, T *inv_data)
    TAssignHD<AssignOp::Mult>(layout_t(), inv_data, static_cast<T>(1.0)/det);
 }
 
+/** @brief Return the adjugate of a square matrix of size dim with given @a
+    data into the matrix with data @a adj_data. */
+template<int dim, typename T>
+MFEM_HOST_DEVICE inline
+void CalcAdjugate(const T *data, T *adj_data)
+{
+   typedef ColumnMajorLayout2D<dim,dim> layout_t;
+   TAdjugateHD<T>(layout_t(), data, layout_t(), adj_data);
+}
+
 /** @brief Compute C = A + alpha*B, where the matrices A, B and C are of size @a
     height x @a width with data @a Adata, @a Bdata and @a Cdata. */
 template<typename TALPHA, typename TA, typename TB, typename TC>
@@ -211,6 +222,122 @@ template<int dim> MFEM_HOST_DEVICE
 double CalcSingularvalue(const double *data, const int i);
 
 
+/** @name Batched operations on small matrices
+
+    The functions in this group operate on @a n square matrices of size dim x
+    dim stored consecutively in column-major layout, i.e. on the data of a
+    (dim x dim x n) DenseTensor. The matrix loop is blocked with AutoSIMD
+    vectors of width MFEM_SIMD_BYTES so that the per-point arithmetic
+    vectorizes across matrices; a scalar loop handles the remainder. Host
+    only. */
+///@{
+
+/// Compute the determinants @a det of @a n matrices with given @a data.
+template<int dim>
+inline void BatchedDet(const int n, const double *data, double *det)
+{
+   constexpr int d2 = dim*dim;
+   constexpr int S = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double,S,MFEM_SIMD_BYTES> simd_t;
+   const int nb = n - n%S;
+   for (int i = 0; i < nb; i += S)
+   {
+      simd_t A[d2];
+      for (int k = 0; k < d2; k++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int s = 0; s < S; s++) { A[k][s] = data[(i+s)*d2 + k]; }
+      }
+      const simd_t d = Det<dim>(A);
+      MFEM_VECTORIZE_LOOP
+      for (int s = 0; s < S; s++) { det[i+s] = d[s]; }
+   }
+   for (int i = nb; i < n; i++) { det[i] = Det<dim>(data + i*d2); }
+}
+
+/// Compute the adjugates @a adj_data of @a n matrices with given @a data.
+template<int dim>
+inline void BatchedCalcAdjugate(const int n, const double *data,
+                                double *adj_data)
+{
+   constexpr int d2 = dim*dim;
+   constexpr int S = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double,S,MFEM_SIMD_BYTES> simd_t;
+   const int nb = n - n%S;
+   for (int i = 0; i < nb; i += S)
+   {
+      simd_t A[d2], B[d2];
+      for (int k = 0; k < d2; k++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int s = 0; s < S; s++) { A[k][s] = data[(i+s)*d2 + k]; }
+      }
+      CalcAdjugate<dim>(A, B);
+      for (int k = 0; k < d2; k++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int s = 0; s < S; s++) { adj_data[(i+s)*d2 + k] = B[k][s]; }
+      }
+   }
+   for (int i = nb; i < n; i++)
+   {
+      CalcAdjugate<dim>(data + i*d2, adj_data + i*d2);
+   }
+}
+
+/// Compute the inverses @a inv_data of @a n matrices with given @a data.
+template<int dim>
+inline void BatchedCalcInverse(const int n, const double *data,
+                               double *inv_data)
+{
+   constexpr int d2 = dim*dim;
+   constexpr int S = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double,S,MFEM_SIMD_BYTES> simd_t;
+   const int nb = n - n%S;
+   for (int i = 0; i < nb; i += S)
+   {
+      simd_t A[d2], B[d2];
+      for (int k = 0; k < d2; k++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int s = 0; s < S; s++) { A[k][s] = data[(i+s)*d2 + k]; }
+      }
+      // Inverse through the adjugate: AutoSIMD is not constructible from a
+      // scalar, so the generic CalcInverse() does not instantiate with it.
+      CalcAdjugate<dim>(A, B);
+      const simd_t r = 1.0/Det<dim>(A);
+      for (int k = 0; k < d2; k++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int s = 0; s < S; s++) { inv_data[(i+s)*d2 + k] = B[k][s]*r[s]; }
+      }
+   }
+   for (int i = nb; i < n; i++)
+   {
+      CalcInverse<dim>(data + i*d2, inv_data + i*d2);
+   }
+}
+
+/** @brief Compute the spectra of @a n matrices with given @a data, returning
+    the eigenvalues in @a lambda (dim per matrix) and the eigenvectors in @a
+    vec (dim x dim per matrix, listed consecutively).
+
+    The eigenvalue iteration branches per matrix, so this is a plain loop over
+    CalcEigenvalues() kept here for uniformity with the other batched forms. */
+template<int dim>
+inline void BatchedCalcEigenvalues(const int n, const double *data,
+                                   double *lambda, double *vec)
+{
+   constexpr int d2 = dim*dim;
+   for (int i = 0; i < n; i++)
+   {
+      CalcEigenvalues<dim>(data + i*d2, lambda + i*dim, vec + i*d2);
+   }
+}
+
+///@}
+
+
 // Utility functions for CalcEigenvalues and CalcSingularvalue
 namespace internal
 {
@@ -23,6 +23,7 @@
 #include "blockmatrix.hpp"
 #include "blockoperator.hpp"
 #include "sparsesmoothers.hpp"
+#include "mixedprec.hpp"
 #include "densemat.hpp"
 #include "ode.hpp"
 #include "solvers.hpp"
@@ -0,0 +1,112 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mixedprec.hpp"
+#include "../general/forall.hpp"
+
+namespace mfem
+{
+
+void FloatVector::Set(const Vector &x)
+{
+   SetSize(x.Size());
+   auto d_x = x.Read();
+   auto d_y = Write();
+   MFEM_FORALL(i, x.Size(), d_y[i] = (float)d_x[i];);
+}
+
+void FloatVector::Get(Vector &x) const
+{
+   MFEM_ASSERT(x.Size() == Size(), "incompatible sizes");
+   auto d_x = Read();
+   auto d_y = x.Write();
+   MFEM_FORALL(i, Size(), d_y[i] = (double)d_x[i];);
+}
+
+FloatSparseMatrix::FloatSparseMatrix(const SparseMatrix &A_)
+   : FloatOperator(A_.Height(), A_.Width()), A(A_)
+{
+   MFEM_VERIFY(A.Finalized(), "the matrix must be finalized");
+   const int nnz = A.NumNonZeroElems();
+   data.SetSize(nnz);
+   const double *h_data = A.HostReadData();
+   for (int i = 0; i < nnz; i++) { data[i] = (float)h_data[i]; }
+}
+
+void FloatSparseMatrix::Mult(const FloatVector &x, FloatVector &y) const
+{
+   MFEM_ASSERT(x.Size() == width && y.Size() == height,
+               "incompatible vector sizes");
+   auto d_I = A.ReadI();
+   auto d_J = A.ReadJ();
+   auto d_val = data.Read();
+   auto d_x = x.Read();
+   auto d_y = y.Write();
+   MFEM_FORALL(i, height,
+   {
+      double sum = 0.0; // fp64 accumulation of the fp32 products
+      const int end = d_I[i+1];
+      for (int j = d_I[i]; j < end; j++)
+      {
+         sum += (double)(d_val[j] * d_x[d_J[j]]);
+      }
+      d_y[i] = (float)sum;
+   });
+}
+
+FloatJacobiSmoother::FloatJacobiSmoother(const SparseMatrix &A, double damping)
+   : FloatOperator(A.Height())
+{
+   MFEM_VERIFY(A.Height() == A.Width(), "the matrix must be square");
+   Vector diag(height);
+   A.GetDiag(diag);
+   dinv.SetSize(height);
+   for (int i = 0; i < height; i++)
+   {
+      MFEM_VERIFY(diag(i) != 0.0, "zero diagonal entry in row " << i);
+      dinv[i] = (float)(damping / diag(i));
+   }
+}
+
+void FloatJacobiSmoother::Mult(const FloatVector &x, FloatVector &y) const
+{
+   MFEM_ASSERT(x.Size() == width && y.Size() == height,
+               "incompatible vector sizes");
+   auto d_dinv = dinv.Read();
+   auto d_x = x.Read();
+   auto d_y = y.Write();
+   MFEM_FORALL(i, height, d_y[i] = d_dinv[i] * d_x[i];);
+}
+
+MixedPrecisionSolver::MixedPrecisionSolver(const FloatOperator &op)
+   : Solver(op.Height(), op.Width()), oper(&op)
+{
+   xf.SetSize(width);
+   yf.SetSize(height);
+}
+
+void MixedPrecisionSolver::SetOperator(const Operator &op)
+{
+   // The fp32 operator is fixed at construction; this method is called by
+   // IterativeSolver::SetOperator() with the system operator, so just check
+   // that the sizes are compatible.
+   MFEM_VERIFY(op.Height() == height && op.Width() == width,
+               "incompatible operator sizes");
+}
+
+void MixedPrecisionSolver::Mult(const Vector &x, Vector &y) const
+{
+   xf.Set(x);
+   oper->Mult(xf, yf);
+   yf.Get(y);
+}
+
+}
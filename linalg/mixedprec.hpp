@@ -0,0 +1,133 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MIXEDPREC
+#define MFEM_MIXEDPREC
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "vector.hpp"
+#include "operator.hpp"
+#include "sparsemat.hpp"
+
+namespace mfem
+{
+
+/** @brief Single-precision vector storage, used by the mixed-precision
+    operators.
+
+    FloatVector is an Array<float> with device support through the usual
+    Read()/Write() methods. The conversions to and from (double) Vector run
+    as device kernels. */
+class FloatVector : public Array<float>
+{
+public:
+   FloatVector() { }
+   explicit FloatVector(int size) : Array<float>(size) { }
+
+   /// Set this vector to the single-precision rounding of @a x.
+   void Set(const Vector &x);
+
+   /// Copy this vector into the double-precision vector @a x.
+   void Get(Vector &x) const;
+};
+
+/** @brief Abstract operator acting on single-precision data.
+
+    Counterpart of Operator for fp32 application, used by
+    MixedPrecisionSolver to run preconditioners in single precision inside a
+    double-precision Krylov solver. */
+class FloatOperator
+{
+protected:
+   int height, width;
+
+public:
+   explicit FloatOperator(int s = 0) { height = width = s; }
+   FloatOperator(int h, int w) { height = h; width = w; }
+
+   /// Get the height of the operator.
+   int Height() const { return height; }
+   /// Get the width of the operator.
+   int Width() const { return width; }
+
+   /// Operator application in single precision: y = A(x).
+   virtual void Mult(const FloatVector &x, FloatVector &y) const = 0;
+
+   virtual ~FloatOperator() { }
+};
+
+/** @brief Single-precision copy of a SparseMatrix.
+
+    Stores the values of a finalized SparseMatrix in fp32 (halving the memory
+    traffic of the matrix data), sharing the integer CSR arrays with the
+    original matrix. The matrix-vector product accumulates each row in fp64
+    before rounding the result, so the extra rounding error per row is a
+    single fp32 rounding. */
+class FloatSparseMatrix : public FloatOperator
+{
+protected:
+   const SparseMatrix &A; ///< The source matrix; used for the CSR structure.
+   Array<float> data;     ///< Single-precision copy of the matrix values.
+
+public:
+   /// Create a single-precision copy of the finalized matrix @a A.
+   explicit FloatSparseMatrix(const SparseMatrix &A);
+
+   /// Matrix-vector product, fp32 data with fp64 row accumulation.
+   virtual void Mult(const FloatVector &x, FloatVector &y) const;
+};
+
+/** @brief Jacobi smoother applied in single precision.
+
+    Stores the (inverted, scaled) diagonal of a SparseMatrix in fp32 and
+    applies y = damping D^{-1} x as a single-precision device kernel. */
+class FloatJacobiSmoother : public FloatOperator
+{
+protected:
+   Array<float> dinv; ///< Single-precision scaled inverse diagonal.
+
+public:
+   FloatJacobiSmoother(const SparseMatrix &A, double damping = 1.0);
+
+   virtual void Mult(const FloatVector &x, FloatVector &y) const;
+};
+
+/** @brief Run a single-precision preconditioner inside a double-precision
+    Krylov solver.
+
+    The wrapper rounds the input Vector to fp32, applies the given
+    FloatOperator, and promotes the result back to fp64, so any FloatOperator
+    can be passed where a Solver is expected, e.g. as the preconditioner of
+    CGSolver or GMRESSolver. Since preconditioner applications only need to
+    approximate the inverse, the fp32 rounding typically leaves the Krylov
+    convergence unaffected while the preconditioner runs at fp32 memory
+    traffic and throughput. */
+class MixedPrecisionSolver : public Solver
+{
+protected:
+   const FloatOperator *oper; ///< The fp32 preconditioner, not owned.
+   mutable FloatVector xf, yf; ///< Single-precision work vectors.
+
+public:
+   explicit MixedPrecisionSolver(const FloatOperator &op);
+
+   /** @brief No-op size check: the fp32 operator is set at construction.
+       Called by IterativeSolver::SetOperator() with the system operator. */
+   virtual void SetOperator(const Operator &op);
+
+   /// Apply the fp32 operator: round @a x down, apply, promote into @a y.
+   virtual void Mult(const Vector &x, Vector &y) const;
+};
+
+}
+
+#endif
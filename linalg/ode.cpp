@@ -143,6 +143,17 @@ ExplicitRKSolver::ExplicitRKSolver(int _s, const double *_a, const double *_b,
    b = _b;
    c = _c;
    k = new Vector[s];
+   Minv = NULL;
+   ak.SetSize(s);
+   vk.SetSize(s);
+   for (int i = 0; i < s; i++) { vk[i] = &k[i]; }
+}
+
+void ExplicitRKSolver::SetMassInverse(Solver &Minv_)
+{
+   MFEM_VERIFY(!Minv_.iterative_mode,
+               "the mass inverse must not be in iterative mode");
+   Minv = &Minv_;
 }
 
 void ExplicitRKSolver::Init(TimeDependentOperator &_f)
@@ -154,6 +165,7 @@ void ExplicitRKSolver::Init(TimeDependentOperator &_f)
    {
       k[i].SetSize(n, mem_type);
    }
+   if (Minv) { z.SetSize(n, mem_type); }
 }
 
 void ExplicitRKSolver::Step(Vector &x, double &t, double &dt)
@@ -166,22 +178,46 @@ void ExplicitRKSolver::Step(Vector &x, double &t, double &dt)
    // --------+---------------------
    //         | b[0] b[1] ... b[s-1]
 
+   // In mass-weighted mode (Minv set) the stage vectors hold the plain
+   // right-hand sides G(y,t) and the mass inverse is applied to the fused
+   // combination of each update; otherwise they hold f(y,t) = M^{-1} G(y,t).
+   if (Minv) { z.SetSize(x.Size()); }
+
    f->SetTime(t);
-   f->Mult(x, k[0]);
+   if (Minv) { f->ExplicitMult(x, k[0]); }
+   else { f->Mult(x, k[0]); }
    for (int l = 0, i = 1; i < s; i++)
    {
-      add(x, a[l++]*dt, k[0], y);
-      for (int j = 1; j < i; j++)
+      // Fused stage update: y = x + dt*sum_j a(i,j)*k_j in one pass.
+      for (int j = 0; j < i; j++) { ak[j] = a[l++]*dt; }
+      if (Minv)
       {
-         y.Add(a[l++]*dt, k[j]);
+         z = 0.0;
+         z.AddScaled(i, ak, vk);
+         Minv->Mult(z, y);
+         y += x;
+      }
+      else
+      {
+         y.AddScaled(x, i, ak, vk);
       }
 
       f->SetTime(t + c[i-1]*dt);
-      f->Mult(y, k[i]);
+      if (Minv) { f->ExplicitMult(y, k[i]); }
+      else { f->Mult(y, k[i]); }
    }
-   for (int i = 0; i < s; i++)
+   // Fused final update: x += dt*sum_i b_i*k_i in one pass.
+   for (int i = 0; i < s; i++) { ak[i] = b[i]*dt; }
+   if (Minv)
+   {
+      z = 0.0;
+      z.AddScaled(s, ak, vk);
+      Minv->Mult(z, y);
+      x += y;
+   }
+   else
    {
-      x.Add(b[i]*dt, k[i]);
+      x.AddScaled(s, ak, vk);
    }
    t += dt;
 }
@@ -344,6 +380,154 @@ const double RK8Solver::c[] =
 };
 
 
+EmbeddedRKSolver::EmbeddedRKSolver(int _s, const double *_a, const double *_b,
+                                   const double *_bs, const double *_c,
+                                   int _order)
+{
+   s = _s;
+   a = _a;
+   b = _b;
+   bs = _bs;
+   c = _c;
+   order = _order;
+   k = new Vector[s];
+   ak.SetSize(s);
+   vk.SetSize(s);
+   for (int i = 0; i < s; i++) { vk[i] = &k[i]; }
+   rtol = 1e-6;
+   atol = 1e-9;
+   safety = 0.9;
+   // PI controller exponents of Gustafsson type
+   kappaI = 0.7/order;
+   kappaP = 0.4/order;
+   err_prev = 1.0;
+   last_err = 0.0;
+   naccepted = nrejected = 0;
+}
+
+void EmbeddedRKSolver::Init(TimeDependentOperator &_f)
+{
+   ODESolver::Init(_f);
+   int n = f->Width();
+   y.SetSize(n, mem_type);
+   e.SetSize(n, mem_type);
+   for (int i = 0; i < s; i++)
+   {
+      k[i].SetSize(n, mem_type);
+   }
+   err_prev = 1.0;
+   last_err = 0.0;
+   naccepted = nrejected = 0;
+}
+
+void EmbeddedRKSolver::Step(Vector &x, double &t, double &dt)
+{
+   //   0    |
+   //  c[0]  | a[0]
+   //  c[1]  | a[1] a[2]
+   //  ...   |    ...
+   // -------+----------------------
+   //        | b[0]  b[1]  ... b[s-1]   (order #order)
+   //        | bs[0] bs[1] ... bs[s-1]  (embedded, order #order - 1)
+   const int n = x.Size();
+
+   // the first stage depends only on (t, x) and is reused across rejected
+   // attempts
+   f->SetTime(t);
+   f->Mult(x, k[0]);
+
+   while (true)
+   {
+      for (int l = 0, i = 1; i < s; i++)
+      {
+         // Fused stage update: y = x + dt*sum_j a(i,j)*k_j in one pass.
+         for (int j = 0; j < i; j++) { ak[j] = a[l++]*dt; }
+         y.AddScaled(x, i, ak, vk);
+
+         f->SetTime(t + c[i-1]*dt);
+         f->Mult(y, k[i]);
+      }
+      // candidate solution: y = x + dt*sum_i b_i*k_i
+      for (int i = 0; i < s; i++) { ak[i] = b[i]*dt; }
+      y.AddScaled(x, s, ak, vk);
+      // error estimate: e = dt*sum_i (b_i - bs_i)*k_i
+      for (int i = 0; i < s; i++) { ak[i] = (b[i] - bs[i])*dt; }
+      e = 0.0;
+      e.AddScaled(s, ak, vk);
+
+      // weighted RMS norm of the error estimate
+      const double *d_e = e.HostRead();
+      const double *d_x = x.HostRead();
+      const double *d_y = y.HostRead();
+      double sum = 0.0;
+      for (int i = 0; i < n; i++)
+      {
+         const double scale =
+            atol + rtol*std::max(std::fabs(d_x[i]), std::fabs(d_y[i]));
+         const double w = d_e[i]/scale;
+         sum += w*w;
+      }
+      last_err = sqrt(sum/n);
+
+      if (last_err <= 1.0)
+      {
+         // accept: commit the candidate and propose the next step size
+         x = y;
+         t += dt;
+         naccepted++;
+         const double err = std::max(last_err, 1e-10);
+         double factor = safety*pow(err, -kappaI)*pow(err_prev, kappaP);
+         factor = std::min(factor, 5.0);
+         err_prev = err;
+         dt *= factor;
+         return;
+      }
+
+      // reject: x and t are untouched, shrink the step and retry using the
+      // buffers already allocated
+      nrejected++;
+      double factor = safety*pow(last_err, -1.0/order);
+      factor = std::max(factor, 0.2);
+      dt *= factor;
+      MFEM_VERIFY(t + dt != t, "time step underflow in EmbeddedRKSolver");
+   }
+}
+
+EmbeddedRKSolver::~EmbeddedRKSolver()
+{
+   delete [] k;
+}
+
+const double AdaptiveRK23Solver::a[] =
+{
+   1./2.,
+   0., 3./4.,
+   2./9., 1./3., 4./9.
+};
+const double AdaptiveRK23Solver::b[] = { 2./9., 1./3., 4./9., 0. };
+const double AdaptiveRK23Solver::bs[] = { 7./24., 1./4., 1./3., 1./8. };
+const double AdaptiveRK23Solver::c[] = { 1./2., 3./4., 1. };
+
+const double AdaptiveRK45Solver::a[] =
+{
+   1./5.,
+   3./40., 9./40.,
+   44./45., -56./15., 32./9.,
+   19372./6561., -25360./2187., 64448./6561., -212./729.,
+   9017./3168., -355./33., 46732./5247., 49./176., -5103./18656.,
+   35./384., 0., 500./1113., 125./192., -2187./6784., 11./84.
+};
+const double AdaptiveRK45Solver::b[] =
+{ 35./384., 0., 500./1113., 125./192., -2187./6784., 11./84., 0. };
+const double AdaptiveRK45Solver::bs[] =
+{
+   5179./57600., 0., 7571./16695., 393./640., -92097./339200., 187./2100.,
+   1./40.
+};
+const double AdaptiveRK45Solver::c[] =
+{ 1./5., 3./10., 4./5., 8./9., 1., 1. };
+
+
 AdamsBashforthSolver::AdamsBashforthSolver(int _s, const double *_a)
 {
    smax = std::min(_s,5);
@@ -413,10 +597,15 @@ void AdamsBashforthSolver::Step(Vector &x, double &t, double &dt)
    {
       f->SetTime(t);
       f->Mult(x, k[idx[0]]);
+      // Fused history update: x += dt*sum_i a_i*k_i in one pass.
+      Array<double> ak(s);
+      Array<const Vector *> vk(s);
       for (int i = 0; i < s; i++)
       {
-         x.Add(a[i]*dt, k[idx[i]]);
+         ak[i] = a[i]*dt;
+         vk[i] = &k[idx[i]];
       }
+      x.AddScaled(s, ak, vk);
    }
    else
    {
@@ -508,9 +697,17 @@ void AdamsMoultonSolver::Step(Vector &x, double &t, double &dt)
    if (s >= smax-1)
    {
       f->SetTime(t);
-      for (int i = 1; i < smax; i++)
+      if (smax > 1)
       {
-         x.Add(a[i]*dt, k[idx[i]]);
+         // Fused history update: x += dt*sum_i a_i*k_i in one pass.
+         Array<double> ak(smax-1);
+         Array<const Vector *> vk(smax-1);
+         for (int i = 1; i < smax; i++)
+         {
+            ak[i-1] = a[i]*dt;
+            vk[i-1] = &k[idx[i]];
+         }
+         x.AddScaled(smax-1, ak, vk);
       }
       f->ImplicitSolve(a[0]*dt, x, k[idx[0]]);
       x.Add(a[0]*dt, k[idx[0]]);
@@ -686,6 +883,153 @@ void SDIRK33Solver::Step(Vector &x, double &t, double &dt)
 }
 
 
+IMEXRKSolver::IMEXRKSolver(int _s, const double *_aE, const double *_aI,
+                           const double *_bE, const double *_bI,
+                           const double *_c)
+{
+   s = _s;
+   aE = _aE;
+   aI = _aI;
+   bE = _bE;
+   bI = _bI;
+   c = _c;
+   gamma = aI[(s+1) + 1]; // the constant diagonal aI(1,1) = ... = aI(s,s)
+   kE = new Vector[s+1];
+   kI = new Vector[s+1]; // kI[0] is unused (ARS form)
+   ak.SetSize(2*s+1);
+   vk.SetSize(2*s+1);
+}
+
+void IMEXRKSolver::Init(TimeDependentOperator &_f)
+{
+   ODESolver::Init(_f);
+   int n = f->Width();
+   y.SetSize(n, mem_type);
+   for (int i = 0; i <= s; i++)
+   {
+      kE[i].SetSize(n, mem_type);
+      kI[i].SetSize(n, mem_type);
+   }
+}
+
+void IMEXRKSolver::Step(Vector &x, double &t, double &dt)
+{
+   // Stage i = 1,...,s:
+   //   y_i = x + dt*( sum_{j<i} aE(i,j)*kE_j + sum_{0<j<i} aI(i,j)*kI_j )
+   //   solve kI_i = f2(y_i + gamma*dt*kI_i, t + c_i*dt)
+   //   kE_i = f1(y_i + gamma*dt*kI_i, t + c_i*dt)
+   // Update:
+   //   x += dt*( sum_i bE(i)*kE_i + sum_{i>0} bI(i)*kI_i )
+   // Every implicit solve uses the same coefficient gamma*dt, so the
+   // operator can reuse one Helmholtz-type setup for all stages.
+   f->SetTime(t);
+   f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_1);
+   f->Mult(x, kE[0]);
+   for (int i = 1; i <= s; i++)
+   {
+      // Fused stage update in one pass over the stage vectors
+      int n = 0;
+      for (int j = 0; j < i; j++)
+      {
+         ak[n] = aE[i*(s+1) + j]*dt;
+         vk[n++] = &kE[j];
+      }
+      for (int j = 1; j < i; j++)
+      {
+         ak[n] = aI[i*(s+1) + j]*dt;
+         vk[n++] = &kI[j];
+      }
+      y.AddScaled(x, n, ak, vk);
+
+      f->SetTime(t + c[i]*dt);
+      f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_2);
+      f->ImplicitSolve(gamma*dt, y, kI[i]);
+      // the explicit term is evaluated at the full stage value
+      y.Add(gamma*dt, kI[i]);
+      f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_1);
+      f->Mult(y, kE[i]);
+   }
+   int n = 0;
+   for (int i = 0; i <= s; i++)
+   {
+      ak[n] = bE[i]*dt;
+      vk[n++] = &kE[i];
+   }
+   for (int i = 1; i <= s; i++)
+   {
+      ak[n] = bI[i]*dt;
+      vk[n++] = &kI[i];
+   }
+   x.AddScaled(n, ak, vk);
+   f->SetEvalMode(TimeDependentOperator::NORMAL);
+   t += dt;
+}
+
+IMEXRKSolver::~IMEXRKSolver()
+{
+   delete [] kE;
+   delete [] kI;
+}
+
+//   0  |  0          0  |  0
+//   1  |  1  0       1  |  0  1
+// -----+------     -----+------
+//      |  1  0          |  0  1
+const double IMEXEulerSolver::aE[] = { 0., 0., 1., 0. };
+const double IMEXEulerSolver::aI[] = { 0., 0., 0., 1. };
+const double IMEXEulerSolver::bE[] = { 1., 0. };
+const double IMEXEulerSolver::bI[] = { 0., 1. };
+const double IMEXEulerSolver::c[]  = { 0., 1. };
+
+// ARS(2,2,2), with a = 1 - sqrt(2)/2 and d = 1 - 1/(2a):
+//   0  |  0            0  |  0
+//   a  |  a   0        a  |  0   a
+//   1  |  d  1-d  0    1  |  0  1-a  a
+// -----+-----------  -----+-----------
+//      |  d  1-d  0        |  0  1-a  a
+const double IMEXRK222Solver::aE[] =
+{
+   0., 0., 0.,
+   1. - sqrt(2.)/2., 0., 0.,
+   1. - 1./(2. - sqrt(2.)), 1./(2. - sqrt(2.)), 0.
+};
+const double IMEXRK222Solver::aI[] =
+{
+   0., 0., 0.,
+   0., 1. - sqrt(2.)/2., 0.,
+   0., sqrt(2.)/2., 1. - sqrt(2.)/2.
+};
+const double IMEXRK222Solver::bE[] =
+{ 1. - 1./(2. - sqrt(2.)), 1./(2. - sqrt(2.)), 0. };
+const double IMEXRK222Solver::bI[] =
+{ 0., sqrt(2.)/2., 1. - sqrt(2.)/2. };
+const double IMEXRK222Solver::c[] = { 0., 1. - sqrt(2.)/2., 1. };
+
+// ARS(2,3,3), with a = (3 + sqrt(3))/6:
+//   0   |  0              0   |  0
+//   a   |  a    0         a   |  0    a
+//  1-a  | a-1 2(1-a) 0   1-a  |  0  1-2a  a
+// ------+--------------  -----+-------------
+//       |  0  1/2  1/2        |  0  1/2  1/2
+const double IMEXRK233Solver::aE[] =
+{
+   0., 0., 0.,
+   (3. + sqrt(3.))/6., 0., 0.,
+   (3. + sqrt(3.))/6. - 1., 2.*(1. - (3. + sqrt(3.))/6.), 0.
+};
+const double IMEXRK233Solver::aI[] =
+{
+   0., 0., 0.,
+   0., (3. + sqrt(3.))/6., 0.,
+   0., 1. - (3. + sqrt(3.))/3., (3. + sqrt(3.))/6.
+};
+const double IMEXRK233Solver::bE[] = { 0., 0.5, 0.5 };
+const double IMEXRK233Solver::bI[] = { 0., 0.5, 0.5 };
+const double IMEXRK233Solver::c[] = { 0., (3. + sqrt(3.))/6.,
+                                      1. - (3. + sqrt(3.))/6.
+                                    };
+
+
 void GeneralizedAlphaSolver::Init(TimeDependentOperator &_f)
 {
    ODESolver::Init(_f);
@@ -186,11 +186,29 @@ private:
    int s;
    const double *a, *b, *c;
    Vector y, *k;
+   /// Accumulated stage combination, used in mass-weighted mode.
+   Vector z;
+   /// Optional mass inverse for mass-weighted mode, not owned.
+   Solver *Minv;
+   /// Pooled per-step workspace for the fused stage updates.
+   Array<double> ak;
+   Array<const Vector *> vk;
 
 public:
    ExplicitRKSolver(int _s, const double *_a, const double *_b,
                     const double *_c);
 
+   /** @brief Work in mass-weighted variables: for an operator of the form
+       M dx/dt = G(x,t), the stage vectors store the right-hand sides G(y,t)
+       obtained from TimeDependentOperator::ExplicitMult() (which must be
+       implemented), and @a Minv_ — an approximation of M^{-1}, not owned,
+       not in iterative mode — is applied to the fused stage combination of
+       each update instead of being embedded in every
+       TimeDependentOperator::Mult() call. One application per stage state is
+       still required, but each one acts on a single accumulated vector and
+       the right-hand side evaluation itself stays mass-free. */
+   void SetMassInverse(Solver &Minv_);
+
    void Init(TimeDependentOperator &_f) override;
 
    void Step(Vector &x, double &t, double &dt) override;
@@ -223,6 +241,88 @@ public:
 };
 
 
+/** @brief Base class for embedded-pair explicit Runge-Kutta methods with
+    built-in error estimation and PI step size control. */
+/** Each call to Step() attempts the current step size and compares the
+    higher and lower order solutions of the pair. When the weighted error
+    exceeds 1 the step is rejected and retried with a reduced step size;
+    the state vector is only overwritten on acceptance and all stage and
+    candidate buffers are preallocated in Init(), so rejections cost only
+    the stage arithmetic. The first stage is evaluated once per Step() call
+    and reused across rejected attempts.
+
+    On return, @a t and @a x correspond to the accepted step, @a dt is the
+    controller's proposal for the next step. The weighted error of the last
+    attempt is available from GetLastError() together with the
+    accepted/rejected step counters. */
+class EmbeddedRKSolver : public ODESolver
+{
+private:
+   int s, order;
+   const double *a, *b, *bs, *c;
+   Vector y, e, *k;
+   /// Pooled per-step workspace for the fused stage updates.
+   Array<double> ak;
+   Array<const Vector *> vk;
+
+   double rtol, atol;
+   double safety;
+   double kappaI, kappaP; ///< PI controller exponents, scaled by 1/#order
+   double err_prev;  ///< weighted error of the last accepted step
+   double last_err;  ///< weighted error of the last attempted step
+   long naccepted, nrejected;
+
+protected:
+   EmbeddedRKSolver(int _s, const double *_a, const double *_b,
+                    const double *_bs, const double *_c, int _order);
+
+public:
+   /// Set the relative and absolute error tolerances (default 1e-6, 1e-9).
+   void SetTolerances(double rtol_, double atol_)
+   { rtol = rtol_; atol = atol_; }
+
+   /// Weighted error estimate of the last attempted step; acceptance
+   /// corresponds to values <= 1.
+   double GetLastError() const { return last_err; }
+
+   /// Number of accepted steps since Init().
+   long GetNumAcceptedSteps() const { return naccepted; }
+
+   /// Number of rejected step attempts since Init().
+   long GetNumRejectedSteps() const { return nrejected; }
+
+   void Init(TimeDependentOperator &_f) override;
+
+   void Step(Vector &x, double &t, double &dt) override;
+
+   virtual ~EmbeddedRKSolver();
+};
+
+
+/** The 4-stage, 3(2) embedded pair of Bogacki and Shampine, "A 3(2) pair of
+    Runge-Kutta formulas" (1989). */
+class AdaptiveRK23Solver : public EmbeddedRKSolver
+{
+private:
+   static const double a[6], b[4], bs[4], c[3];
+
+public:
+   AdaptiveRK23Solver() : EmbeddedRKSolver(4, a, b, bs, c, 3) { }
+};
+
+
+/** The 7-stage, 5(4) embedded pair of Dormand and Prince, "A family of
+    embedded Runge-Kutta formulae" (1980). */
+class AdaptiveRK45Solver : public EmbeddedRKSolver
+{
+private:
+   static const double a[21], b[7], bs[7], c[6];
+
+public:
+   AdaptiveRK45Solver() : EmbeddedRKSolver(7, a, b, bs, c, 5) { }
+};
+
+
 /** An explicit Adams-Bashforth method. */
 class AdamsBashforthSolver : public ODESolver
 {
@@ -460,6 +560,87 @@ public:
 };
 
 
+/** @brief Base class for IMEX (implicit-explicit) additive Runge-Kutta
+    methods of the ARS family, for operators with an additive split
+    f(x,t) = f1(x,t) + f2(x,t) with non-stiff f1 and stiff f2. */
+/** The explicit term f1 is evaluated through
+    TimeDependentOperator::Mult() with the evaluation mode set to
+    TimeDependentOperator::ADDITIVE_TERM_1, and the implicit term f2 is
+    solved for through TimeDependentOperator::ImplicitSolve() with the mode
+    set to TimeDependentOperator::ADDITIVE_TERM_2; the associated operator
+    must support both, see TimeDependentOperator::SetEvalMode().
+
+    The implicit tableau is singly diagonal: every call to ImplicitSolve()
+    passes the same coefficient gamma*dt, so an operator that caches its
+    Helmholtz-type setup keyed on the time step rebuilds it at most once per
+    step size change rather than once per stage. All stage vectors are
+    allocated once in Init() and reused by every step. */
+class IMEXRKSolver : public ODESolver
+{
+private:
+   int s; ///< number of implicit stages; there are s+1 explicit stages
+   /** Row-major (s+1)x(s+1) Butcher matrices of the explicit (#aE) and
+       implicit (#aI) schemes, with weights #bE, #bI and abscissae #c of
+       size s+1. Column 0 of #aI and bI[0] are zero (ARS form) and the
+       diagonal aI(i,i), i >= 1, is the constant #gamma. */
+   const double *aE, *aI, *bE, *bI, *c;
+   double gamma;
+   Vector y, *kE, *kI;
+   /// Pooled per-step workspace for the fused stage updates.
+   Array<double> ak;
+   Array<const Vector *> vk;
+
+protected:
+   IMEXRKSolver(int _s, const double *_aE, const double *_aI,
+                const double *_bE, const double *_bI, const double *_c);
+
+public:
+   void Init(TimeDependentOperator &_f) override;
+
+   void Step(Vector &x, double &t, double &dt) override;
+
+   virtual ~IMEXRKSolver();
+};
+
+
+/** IMEX forward-backward Euler: explicit Euler for the non-stiff term and
+    backward Euler for the stiff term; the ARS(1,1,1) scheme. */
+class IMEXEulerSolver : public IMEXRKSolver
+{
+private:
+   static const double aE[4], aI[4], bE[2], bI[2], c[2];
+
+public:
+   IMEXEulerSolver() : IMEXRKSolver(1, aE, aI, bE, bI, c) { }
+};
+
+
+/** Two-implicit-stage, second order IMEX method ARS(2,2,2) from Ascher,
+    Ruuth & Spiteri, "Implicit-explicit Runge-Kutta methods for
+    time-dependent partial differential equations" (1997). The implicit
+    scheme is L-stable. */
+class IMEXRK222Solver : public IMEXRKSolver
+{
+private:
+   static const double aE[9], aI[9], bE[3], bI[3], c[3];
+
+public:
+   IMEXRK222Solver() : IMEXRKSolver(2, aE, aI, bE, bI, c) { }
+};
+
+
+/** Two-implicit-stage, third order IMEX method ARS(2,3,3) from Ascher,
+    Ruuth & Spiteri (1997). The implicit scheme is A-stable. */
+class IMEXRK233Solver : public IMEXRKSolver
+{
+private:
+   static const double aE[9], aI[9], bE[3], bI[3], c[3];
+
+public:
+   IMEXRK233Solver() : IMEXRKSolver(2, aE, aI, bE, bI, c) { }
+};
+
+
 /// Generalized-alpha ODE solver from "A generalized-α method for integrating
 /// the filtered Navier–Stokes equations with a stabilized finite element
 /// method" by K.E. Jansen, C.H. Whiting and G.M. Hulbert.
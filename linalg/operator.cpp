@@ -19,6 +19,28 @@
 namespace mfem
 {
 
+void Operator::ArrayMult(const Array<const Vector *> &X,
+                         Array<Vector *> &Y) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "incompatible arrays!");
+   for (int i = 0; i < X.Size(); i++)
+   {
+      MFEM_ASSERT(X[i] && Y[i], "invalid array entry!");
+      Mult(*X[i], *Y[i]);
+   }
+}
+
+void Operator::ArrayMultTranspose(const Array<const Vector *> &X,
+                                  Array<Vector *> &Y) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "incompatible arrays!");
+   for (int i = 0; i < X.Size(); i++)
+   {
+      MFEM_ASSERT(X[i] && Y[i], "invalid array entry!");
+      MultTranspose(*X[i], *Y[i]);
+   }
+}
+
 void Operator::InitTVectors(const Operator *Po, const Operator *Ri,
                             const Operator *Pi,
                             Vector &x, Vector &b,
@@ -317,6 +339,24 @@ ProductOperator::ProductOperator(const Operator *A, const Operator *B,
    }
 }
 
+void ProductOperator::Reset(const Operator *A_, const Operator *B_,
+                            bool ownA_, bool ownB_)
+{
+   MFEM_VERIFY(MatchesShapes(A_, B_),
+               "the new factors must have the same sizes as the current ones");
+   {
+      const Solver* SolverB = dynamic_cast<const Solver*>(B_);
+      if (SolverB)
+      {
+         MFEM_VERIFY(!(SolverB->iterative_mode),
+                     "Operator B of a ProductOperator should not be in iterative mode");
+      }
+   }
+   if (ownA && A != A_) { delete A; }
+   if (ownB && B != B_) { delete B; }
+   A = A_; B = B_; ownA = ownA_; ownB = ownB_;
+}
+
 ProductOperator::~ProductOperator()
 {
    if (ownA) { delete A; }
@@ -326,35 +366,121 @@ ProductOperator::~ProductOperator()
 
 RAPOperator::RAPOperator(const Operator &Rt_, const Operator &A_,
                          const Operator &P_)
-   : Operator(Rt_.Width(), P_.Width()), Rt(Rt_), A(A_), P(P_)
+   : Operator(Rt_.Width(), P_.Width()), Rt(&Rt_), A(&A_), P(&P_)
 {
-   MFEM_VERIFY(Rt.Height() == A.Height(),
-               "incompatible Operators: Rt.Height() = " << Rt.Height()
-               << ", A.Height() = " << A.Height());
-   MFEM_VERIFY(A.Width() == P.Height(),
-               "incompatible Operators: A.Width() = " << A.Width()
-               << ", P.Height() = " << P.Height());
+   MFEM_VERIFY(Rt->Height() == A->Height(),
+               "incompatible Operators: Rt.Height() = " << Rt->Height()
+               << ", A.Height() = " << A->Height());
+   MFEM_VERIFY(A->Width() == P->Height(),
+               "incompatible Operators: A.Width() = " << A->Width()
+               << ", P.Height() = " << P->Height());
+
+   {
+      const Solver* SolverA = dynamic_cast<const Solver*>(A);
+      if (SolverA)
+      {
+         MFEM_VERIFY(!(SolverA->iterative_mode),
+                     "Operator A of an RAPOperator should not be in iterative mode");
+      }
+
+      const Solver* SolverP = dynamic_cast<const Solver*>(P);
+      if (SolverP)
+      {
+         MFEM_VERIFY(!(SolverP->iterative_mode),
+                     "Operator P of an RAPOperator should not be in iterative mode");
+      }
+   }
+
+   mem_class = Rt->GetMemoryClass()*P->GetMemoryClass();
+   MemoryType mem_type = GetMemoryType(A->GetMemoryClass()*mem_class);
+   Px.SetSize(P->Height(), mem_type);
+   APx.SetSize(A->Height(), mem_type);
+}
 
+void RAPOperator::Reset(const Operator &Rt_, const Operator &A_,
+                        const Operator &P_)
+{
+   MFEM_VERIFY(MatchesShapes(Rt_, A_, P_),
+               "the new factors must have the same sizes as the current ones");
    {
-      const Solver* SolverA = dynamic_cast<const Solver*>(&A);
+      const Solver* SolverA = dynamic_cast<const Solver*>(&A_);
       if (SolverA)
       {
          MFEM_VERIFY(!(SolverA->iterative_mode),
                      "Operator A of an RAPOperator should not be in iterative mode");
       }
 
-      const Solver* SolverP = dynamic_cast<const Solver*>(&P);
+      const Solver* SolverP = dynamic_cast<const Solver*>(&P_);
       if (SolverP)
       {
          MFEM_VERIFY(!(SolverP->iterative_mode),
                      "Operator P of an RAPOperator should not be in iterative mode");
       }
    }
+   Rt = &Rt_; A = &A_; P = &P_;
+   // The memory class may change with the new factors; resize the work
+   // vectors only if the memory type they need changes.
+   mem_class = Rt->GetMemoryClass()*P->GetMemoryClass();
+   MemoryType mem_type = GetMemoryType(A->GetMemoryClass()*mem_class);
+   if (mem_type != Px.GetMemory().GetMemoryType())
+   {
+      Px.Destroy();
+      APx.Destroy();
+      Px.SetSize(P->Height(), mem_type);
+      APx.SetSize(A->Height(), mem_type);
+   }
+}
 
-   mem_class = Rt.GetMemoryClass()*P.GetMemoryClass();
-   MemoryType mem_type = GetMemoryType(A.GetMemoryClass()*mem_class);
-   Px.SetSize(P.Height(), mem_type);
-   APx.SetSize(A.Height(), mem_type);
+void RAPOperator::ArrayMult(const Array<const Vector *> &X,
+                            Array<Vector *> &Y) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "incompatible arrays!");
+   const int nv = X.Size();
+   if (nv == 0) { return; }
+   const MemoryType mem_type = Px.GetMemory().GetMemoryType();
+   Array<Vector *> Pxs(nv), APxs(nv);
+   Array<const Vector *> Pxs_c(nv), APxs_c(nv);
+   for (int i = 0; i < nv; i++)
+   {
+      Pxs[i] = new Vector(P->Height(), mem_type);
+      APxs[i] = new Vector(A->Height(), mem_type);
+      Pxs_c[i] = Pxs[i];
+      APxs_c[i] = APxs[i];
+   }
+   P->ArrayMult(X, Pxs);
+   A->ArrayMult(Pxs_c, APxs);
+   Rt->ArrayMultTranspose(APxs_c, Y);
+   for (int i = 0; i < nv; i++)
+   {
+      delete Pxs[i];
+      delete APxs[i];
+   }
+}
+
+void RAPOperator::ArrayMultTranspose(const Array<const Vector *> &X,
+                                     Array<Vector *> &Y) const
+{
+   MFEM_ASSERT(X.Size() == Y.Size(), "incompatible arrays!");
+   const int nv = X.Size();
+   if (nv == 0) { return; }
+   const MemoryType mem_type = Px.GetMemory().GetMemoryType();
+   Array<Vector *> Pxs(nv), APxs(nv);
+   Array<const Vector *> Pxs_c(nv), APxs_c(nv);
+   for (int i = 0; i < nv; i++)
+   {
+      Pxs[i] = new Vector(P->Height(), mem_type);
+      APxs[i] = new Vector(A->Height(), mem_type);
+      Pxs_c[i] = Pxs[i];
+      APxs_c[i] = APxs[i];
+   }
+   Rt->ArrayMult(X, APxs);
+   A->ArrayMultTranspose(APxs_c, Pxs);
+   P->ArrayMultTranspose(Pxs_c, Y);
+   for (int i = 0; i < nv; i++)
+   {
+      delete Pxs[i];
+      delete APxs[i];
+   }
 }
 
 
@@ -394,6 +520,44 @@ TripleProductOperator::TripleProductOperator(
    t2.SetSize(B->Height(), mem_type);
 }
 
+void TripleProductOperator::Reset(const Operator *A_, const Operator *B_,
+                                  const Operator *C_,
+                                  bool ownA_, bool ownB_, bool ownC_)
+{
+   MFEM_VERIFY(MatchesShapes(A_, B_, C_),
+               "the new factors must have the same sizes as the current ones");
+   {
+      const Solver* SolverB = dynamic_cast<const Solver*>(B_);
+      if (SolverB)
+      {
+         MFEM_VERIFY(!(SolverB->iterative_mode),
+                     "Operator B of a TripleProductOperator should not be in iterative mode");
+      }
+
+      const Solver* SolverC = dynamic_cast<const Solver*>(C_);
+      if (SolverC)
+      {
+         MFEM_VERIFY(!(SolverC->iterative_mode),
+                     "Operator C of a TripleProductOperator should not be in iterative mode");
+      }
+   }
+   if (ownA && A != A_) { delete A; }
+   if (ownB && B != B_) { delete B; }
+   if (ownC && C != C_) { delete C; }
+   A = A_; B = B_; C = C_; ownA = ownA_; ownB = ownB_; ownC = ownC_;
+   // The memory class may change with the new factors; resize the work
+   // vectors only if the memory type they need changes.
+   mem_class = A->GetMemoryClass()*C->GetMemoryClass();
+   MemoryType mem_type = GetMemoryType(mem_class*B->GetMemoryClass());
+   if (mem_type != t1.GetMemory().GetMemoryType())
+   {
+      t1.Destroy();
+      t2.Destroy();
+      t1.SetSize(C->Height(), mem_type);
+      t2.SetSize(B->Height(), mem_type);
+   }
+}
+
 TripleProductOperator::~TripleProductOperator()
 {
    if (ownA) { delete A; }
@@ -402,11 +566,100 @@ TripleProductOperator::~TripleProductOperator()
 }
 
 
+OperatorChainCache::~OperatorChainCache()
+{
+   for (int i = 0; i < transpose.Size(); i++) { delete transpose[i]; }
+   for (int i = 0; i < product.Size(); i++) { delete product[i]; }
+   for (int i = 0; i < rap.Size(); i++) { delete rap[i]; }
+   for (int i = 0; i < triple.Size(); i++) { delete triple[i]; }
+}
+
+TransposeOperator *OperatorChainCache::Transpose(const Operator &A)
+{
+   const int slot = n_transpose++;
+   if (slot == transpose.Size())
+   {
+      transpose.Append(new TransposeOperator(A));
+   }
+   else if (transpose[slot]->MatchesShapes(A))
+   {
+      transpose[slot]->Reset(A);
+   }
+   else
+   {
+      delete transpose[slot];
+      transpose[slot] = new TransposeOperator(A);
+   }
+   return transpose[slot];
+}
+
+ProductOperator *OperatorChainCache::Product(const Operator *A,
+                                             const Operator *B)
+{
+   const int slot = n_product++;
+   if (slot == product.Size())
+   {
+      product.Append(new ProductOperator(A, B, false, false));
+   }
+   else if (product[slot]->MatchesShapes(A, B))
+   {
+      product[slot]->Reset(A, B, false, false);
+   }
+   else
+   {
+      delete product[slot];
+      product[slot] = new ProductOperator(A, B, false, false);
+   }
+   return product[slot];
+}
+
+RAPOperator *OperatorChainCache::RAP(const Operator &Rt, const Operator &A,
+                                     const Operator &P)
+{
+   const int slot = n_rap++;
+   if (slot == rap.Size())
+   {
+      rap.Append(new RAPOperator(Rt, A, P));
+   }
+   else if (rap[slot]->MatchesShapes(Rt, A, P))
+   {
+      rap[slot]->Reset(Rt, A, P);
+   }
+   else
+   {
+      delete rap[slot];
+      rap[slot] = new RAPOperator(Rt, A, P);
+   }
+   return rap[slot];
+}
+
+TripleProductOperator *OperatorChainCache::TripleProduct(const Operator *A,
+                                                         const Operator *B,
+                                                         const Operator *C)
+{
+   const int slot = n_triple++;
+   if (slot == triple.Size())
+   {
+      triple.Append(new TripleProductOperator(A, B, C, false, false, false));
+   }
+   else if (triple[slot]->MatchesShapes(A, B, C))
+   {
+      triple[slot]->Reset(A, B, C, false, false, false);
+   }
+   else
+   {
+      delete triple[slot];
+      triple[slot] = new TripleProductOperator(A, B, C, false, false, false);
+   }
+   return triple[slot];
+}
+
+
 ConstrainedOperator::ConstrainedOperator(Operator *A, const Array<int> &list,
                                          bool _own_A,
                                          DiagonalPolicy _diag_policy)
    : Operator(A->Height(), A->Width()), A(A), own_A(_own_A),
-     diag_policy(_diag_policy)
+     w_zeroed(false), diag_policy(_diag_policy)
 {
    // 'mem_class' should work with A->Mult() and MFEM_FORALL():
    mem_class = A->GetMemoryClass()*Device::GetDeviceMemoryClass();
@@ -416,11 +669,15 @@ ConstrainedOperator::ConstrainedOperator(Operator *A, const Array<int> &list,
    // typically z and w are large vectors, so store them on the device
    z.SetSize(height, mem_type); z.UseDevice(true);
    w.SetSize(height, mem_type); w.UseDevice(true);
+   // compacted workspace with one entry per constrained dof
+   xb.SetSize(constraint_list.Size(), mem_type); xb.UseDevice(true);
 }
 
 void ConstrainedOperator::EliminateRHS(const Vector &x, Vector &b) const
 {
-   w = 0.0;
+   // only the constrained entries of 'w' are ever set to nonzero values, so
+   // the full-vector clear is needed just once
+   if (!w_zeroed) { w = 0.0; w_zeroed = true; }
    const int csz = constraint_list.Size();
    auto idx = constraint_list.Read();
    auto d_x = x.Read();
@@ -436,12 +693,15 @@ void ConstrainedOperator::EliminateRHS(const Vector &x, Vector &b) const
    A->Mult(w, z);
    b -= z;
 
-   // Use read+write access - we are modifying sub-vector of b
+   // Use read+write access - we are modifying sub-vectors of b and w; the
+   // constrained entries of w are reset to zero for the next call
    auto d_b = b.ReadWrite();
+   auto d_w2 = w.ReadWrite();
    MFEM_FORALL(i, csz,
    {
       const int id = idx[i];
       d_b[id] = d_x[id];
+      d_w2[id] = 0.0;
    });
 }
 
@@ -454,17 +714,26 @@ void ConstrainedOperator::Mult(const Vector &x, Vector &y) const
       return;
    }
 
-   z = x;
-
+   // Save the constrained entries of 'x' in the compacted workspace 'xb' and
+   // zero them in place, so that A acts on (x_i,0) without copying 'x' into a
+   // full-size temporary.
    auto idx = constraint_list.Read();
-   // Use read+write access - we are modifying sub-vector of z
-   auto d_z = z.ReadWrite();
-   MFEM_FORALL(i, csz, d_z[idx[i]] = 0.0;);
+   auto d_xb = xb.Write();
+   // Use read+write access - we are modifying sub-vector of x
+   auto d_x = const_cast<Vector&>(x).ReadWrite();
+   MFEM_FORALL(i, csz,
+   {
+      const int id = idx[i];
+      d_xb[i] = d_x[id];
+      d_x[id] = 0.0;
+   });
 
-   A->Mult(z, y);
+   A->Mult(x, y);
 
-   auto d_x = x.Read();
-   // Use read+write access - we are modifying sub-vector of y
+   // Restore the constrained entries of 'x' and apply the diagonal policy to
+   // 'y' in a single compacted pass.
+   auto d_xb2 = xb.Read();
+   auto d_x2 = const_cast<Vector&>(x).ReadWrite();
    auto d_y = y.ReadWrite();
    switch (diag_policy)
    {
@@ -472,13 +741,15 @@ void ConstrainedOperator::Mult(const Vector &x, Vector &y) const
          MFEM_FORALL(i, csz,
          {
             const int id = idx[i];
-            d_y[id] = d_x[id];
+            d_x2[id] = d_xb2[i];
+            d_y[id] = d_xb2[i];
          });
          break;
       case DIAG_ZERO:
          MFEM_FORALL(i, csz,
          {
             const int id = idx[i];
+            d_x2[id] = d_xb2[i];
             d_y[id] = 0.0;
          });
          break;
@@ -92,6 +92,20 @@ public:
    virtual void MultTranspose(const Vector &x, Vector &y) const
    { mfem_error("Operator::MultTranspose() is not overloaded!"); }
 
+   /** @brief Operator application on a group of vectors: `Y[i]=A(X[i])`.
+
+       The arrays @a X and @a Y must have the same size and all their entries
+       must be non-NULL. The default implementation calls Mult() on each pair
+       of vectors; operators that can amortize setup or data movement across
+       several vectors should override this method. */
+   virtual void ArrayMult(const Array<const Vector *> &X,
+                          Array<Vector *> &Y) const;
+
+   /** @brief Action of the transpose operator on a group of vectors:
+       `Y[i]=A^t(X[i])`, see ArrayMult(). */
+   virtual void ArrayMultTranspose(const Array<const Vector *> &X,
+                                   Array<Vector *> &Y) const;
+
    /** @brief Evaluate the gradient operator at the point @a x. The default
        behavior in class Operator is to generate an error. */
    virtual Operator &GetGradient(const Vector &x) const
@@ -697,24 +711,47 @@ public:
 class TransposeOperator : public Operator
 {
 private:
-   const Operator &A;
+   const Operator *A;
 
 public:
    /// Construct the transpose of a given operator @a *a.
    TransposeOperator(const Operator *a)
-      : Operator(a->Width(), a->Height()), A(*a) { }
+      : Operator(a->Width(), a->Height()), A(a) { }
 
    /// Construct the transpose of a given operator @a a.
    TransposeOperator(const Operator &a)
-      : Operator(a.Width(), a.Height()), A(a) { }
+      : Operator(a.Width(), a.Height()), A(&a) { }
+
+   /// True if @a a has the same sizes as the currently wrapped operator.
+   bool MatchesShapes(const Operator &a) const
+   { return a.Height() == width && a.Width() == height; }
+
+   /** @brief Replace the wrapped operator by @a a, which must have the same
+       sizes; used to rebind a cached chain, see OperatorChainCache. */
+   void Reset(const Operator &a)
+   {
+      MFEM_VERIFY(MatchesShapes(a), "the new operator must have the same "
+                  "sizes as the current one");
+      A = &a;
+   }
 
    /// Operator application. Apply the transpose of the original Operator.
    virtual void Mult(const Vector &x, Vector &y) const
-   { A.MultTranspose(x, y); }
+   { A->MultTranspose(x, y); }
 
    /// Application of the transpose. Apply the original Operator.
    virtual void MultTranspose(const Vector &x, Vector &y) const
-   { A.Mult(x, y); }
+   { A->Mult(x, y); }
+
+   /// Group application, see Operator::ArrayMult().
+   virtual void ArrayMult(const Array<const Vector *> &X,
+                          Array<Vector *> &Y) const
+   { A->ArrayMultTranspose(X, Y); }
+
+   /// Group application of the transpose, see Operator::ArrayMult().
+   virtual void ArrayMultTranspose(const Array<const Vector *> &X,
+                                   Array<Vector *> &Y) const
+   { A->ArrayMult(X, Y); }
 };
 
 
@@ -728,6 +765,18 @@ class ProductOperator : public Operator
 public:
    ProductOperator(const Operator *A, const Operator *B, bool ownA, bool ownB);
 
+   /// True if @a A_ and @a B_ have the same sizes as the current factors.
+   bool MatchesShapes(const Operator *A_, const Operator *B_) const
+   {
+      return A_->Height() == A->Height() && A_->Width() == A->Width() &&
+             B_->Height() == B->Height() && B_->Width() == B->Width();
+   }
+
+   /** @brief Replace the factors by @a A_ and @a B_, which must have the same
+       sizes as the current ones; owned factors being replaced are deleted.
+       The intermediate vector is kept, see OperatorChainCache. */
+   void Reset(const Operator *A_, const Operator *B_, bool ownA_, bool ownB_);
+
    virtual void Mult(const Vector &x, Vector &y) const
    { B->Mult(x, z); A->Mult(z, y); }
 
@@ -742,9 +791,9 @@ public:
 class RAPOperator : public Operator
 {
 private:
-   const Operator & Rt;
-   const Operator & A;
-   const Operator & P;
+   const Operator *Rt;
+   const Operator *A;
+   const Operator *P;
    mutable Vector Px;
    mutable Vector APx;
    MemoryClass mem_class;
@@ -753,15 +802,38 @@ public:
    /// Construct the RAP operator given R^T, A and P.
    RAPOperator(const Operator &Rt_, const Operator &A_, const Operator &P_);
 
+   /// True if the given factors have the same sizes as the current ones.
+   bool MatchesShapes(const Operator &Rt_, const Operator &A_,
+                      const Operator &P_) const
+   {
+      return Rt_.Height() == Rt->Height() && Rt_.Width() == Rt->Width() &&
+             A_.Height() == A->Height() && A_.Width() == A->Width() &&
+             P_.Height() == P->Height() && P_.Width() == P->Width();
+   }
+
+   /** @brief Replace the factors, which must have the same sizes as the
+       current ones; the intermediate vectors are kept, see
+       OperatorChainCache. */
+   void Reset(const Operator &Rt_, const Operator &A_, const Operator &P_);
+
    virtual MemoryClass GetMemoryClass() const { return mem_class; }
 
    /// Operator application.
    virtual void Mult(const Vector & x, Vector & y) const
-   { P.Mult(x, Px); A.Mult(Px, APx); Rt.MultTranspose(APx, y); }
+   { P->Mult(x, Px); A->Mult(Px, APx); Rt->MultTranspose(APx, y); }
 
    /// Application of the transpose.
    virtual void MultTranspose(const Vector & x, Vector & y) const
-   { Rt.Mult(x, APx); A.MultTranspose(APx, Px); P.MultTranspose(Px, y); }
+   { Rt->Mult(x, APx); A->MultTranspose(APx, Px); P->MultTranspose(Px, y); }
+
+   /** @brief Group application, see Operator::ArrayMult(). Each factor is
+       applied to all vectors before moving on to the next factor. */
+   virtual void ArrayMult(const Array<const Vector *> &X,
+                          Array<Vector *> &Y) const;
+
+   /// Group application of the transpose, see ArrayMult().
+   virtual void ArrayMultTranspose(const Array<const Vector *> &X,
+                                   Array<Vector *> &Y) const;
 };
 
 
@@ -779,6 +851,21 @@ public:
    TripleProductOperator(const Operator *A, const Operator *B,
                          const Operator *C, bool ownA, bool ownB, bool ownC);
 
+   /// True if the given factors have the same sizes as the current ones.
+   bool MatchesShapes(const Operator *A_, const Operator *B_,
+                      const Operator *C_) const
+   {
+      return A_->Height() == A->Height() && A_->Width() == A->Width() &&
+             B_->Height() == B->Height() && B_->Width() == B->Width() &&
+             C_->Height() == C->Height() && C_->Width() == C->Width();
+   }
+
+   /** @brief Replace the factors, which must have the same sizes as the
+       current ones; owned factors being replaced are deleted. The
+       intermediate vectors are kept, see OperatorChainCache. */
+   void Reset(const Operator *A_, const Operator *B_, const Operator *C_,
+              bool ownA_, bool ownB_, bool ownC_);
+
    virtual MemoryClass GetMemoryClass() const { return mem_class; }
 
    virtual void Mult(const Vector &x, Vector &y) const
@@ -791,6 +878,56 @@ public:
 };
 
 
+/** @brief Cache of composite operator chains (TransposeOperator,
+    ProductOperator, RAPOperator, TripleProductOperator) reused across
+    repeated rebuilds.
+
+    Code that reconstructs the same composite chains every time the underlying
+    forms are rebuilt (e.g. coupled multi-physics assembly) can request its
+    chains through a cache instead of creating them anew: call Reuse() at the
+    start of each rebuild pass, then request the chains in the same order as
+    in the previous pass. A request whose factor shapes match those of the
+    cached chain in the corresponding slot rebinds the factor pointers in
+    place, keeping the chain object and its internal work vectors; on a shape
+    mismatch the cached chain is replaced. The cache owns the chains it
+    returns and deletes them in its destructor; product and triple product
+    chains are created without taking ownership of their factors. */
+class OperatorChainCache
+{
+private:
+   Array<TransposeOperator *> transpose;
+   Array<ProductOperator *> product;
+   Array<RAPOperator *> rap;
+   Array<TripleProductOperator *> triple;
+   /// Number of entries handed out since the last call to Reuse().
+   int n_transpose, n_product, n_rap, n_triple;
+
+public:
+   OperatorChainCache()
+      : n_transpose(0), n_product(0), n_rap(0), n_triple(0) { }
+
+   /// Delete all cached chains.
+   ~OperatorChainCache();
+
+   /// Start a new rebuild pass: all cached chains become reusable again.
+   void Reuse() { n_transpose = n_product = n_rap = n_triple = 0; }
+
+   /// Return A^T, reusing a cached TransposeOperator when the sizes match.
+   TransposeOperator *Transpose(const Operator &A);
+
+   /// Return A*B, reusing a cached ProductOperator when the shapes match.
+   ProductOperator *Product(const Operator *A, const Operator *B);
+
+   /// Return Rt^T*A*P, reusing a cached RAPOperator when the shapes match.
+   RAPOperator *RAP(const Operator &Rt, const Operator &A, const Operator &P);
+
+   /// Return A*B*C, reusing a cached TripleProductOperator when the shapes
+   /// match.
+   TripleProductOperator *TripleProduct(const Operator *A, const Operator *B,
+                                        const Operator *C);
+};
+
+
 /** @brief Square Operator for imposing essential boundary conditions using only
     the action, Mult(), of a given unconstrained Operator.
 
@@ -804,6 +941,10 @@ protected:
    Operator *A;                 ///< The unconstrained Operator.
    bool own_A;                  ///< Ownership flag for A.
    mutable Vector z, w;         ///< Auxiliary vectors.
+   /// Compacted workspace holding the constrained entries of the input vector.
+   mutable Vector xb;
+   /// True if the constrained entries of #w are known to be zero.
+   mutable bool w_zeroed;
    MemoryClass mem_class;
    DiagonalPolicy diag_policy;  ///< Diagonal policy for constrained dofs
 
@@ -844,7 +985,12 @@ public:
            z = A((x_i,0));  y_i = z_i;  y_b = x_b;
 
        where the "_b" subscripts denote the essential (boundary) indices/dofs of
-       the vectors, and "_i" -- the rest of the entries. */
+       the vectors, and "_i" -- the rest of the entries.
+
+       To avoid copying @a x into a full-size temporary, the entries x_b are
+       saved in a compacted workspace and zeroed in place before calling
+       A->Mult(); they are restored before the method returns, so @a x is
+       unchanged on exit. */
    virtual void Mult(const Vector &x, Vector &y) const;
 
    /// Destructor: destroys the unconstrained Operator, if owned.
@@ -65,8 +65,10 @@ static PetscErrorCode __mfem_pc_shell_destroy(PC);
 static PetscErrorCode __mfem_pc_shell_view(PC,PetscViewer);
 static PetscErrorCode __mfem_mat_shell_apply(Mat,Vec,Vec);
 static PetscErrorCode __mfem_mat_shell_apply_transpose(Mat,Vec,Vec);
+static PetscErrorCode __mfem_mat_shell_get_diagonal(Mat,Vec);
 static PetscErrorCode __mfem_mat_shell_destroy(Mat);
 static PetscErrorCode __mfem_mat_shell_copy(Mat,Mat,MatStructure);
+static PetscErrorCode __mfem_mat_shell_reuse(Mat,mfem::Operator*,PetscBool*);
 static PetscErrorCode __mfem_array_container_destroy(void*);
 static PetscErrorCode __mfem_matarray_container_destroy(void*);
 static PetscErrorCode __mfem_monitor_ctx_destroy(void**);
@@ -828,6 +830,9 @@ void PetscParMatrix::MakeWrapper(MPI_Comm comm, const Operator* op, Mat *A)
    ierr = MatShellSetOperation(*A,MATOP_MULT_TRANSPOSE,
                                (void (*)())__mfem_mat_shell_apply_transpose);
    PCHKERRQ(A,ierr);
+   ierr = MatShellSetOperation(*A,MATOP_GET_DIAGONAL,
+                               (void (*)())__mfem_mat_shell_get_diagonal);
+   PCHKERRQ(A,ierr);
    ierr = MatShellSetOperation(*A,MATOP_COPY,
                                (void (*)())__mfem_mat_shell_copy);
    PCHKERRQ(A,ierr);
@@ -2300,7 +2305,7 @@ void PetscBCHandler::ZeroBC(const Vector &x, Vector &y)
 
 PetscLinearSolver::PetscLinearSolver(MPI_Comm comm, const std::string &prefix,
                                      bool wrapin)
-   : PetscSolver(), Solver(), wrap(wrapin)
+   : PetscSolver(), Solver(), wrap(wrapin), wpA(NULL), wop(NULL)
 {
    KSP ksp;
    ierr = KSPCreate(comm,&ksp); CCHKERRQ(comm,ierr);
@@ -2311,7 +2316,7 @@ PetscLinearSolver::PetscLinearSolver(MPI_Comm comm, const std::string &prefix,
 
 PetscLinearSolver::PetscLinearSolver(const PetscParMatrix &A,
                                      const std::string &prefix)
-   : PetscSolver(), Solver(), wrap(false)
+   : PetscSolver(), Solver(), wrap(false), wpA(NULL), wop(NULL)
 {
    KSP ksp;
    ierr = KSPCreate(A.GetComm(),&ksp); CCHKERRQ(A.GetComm(),ierr);
@@ -2323,7 +2328,7 @@ PetscLinearSolver::PetscLinearSolver(const PetscParMatrix &A,
 
 PetscLinearSolver::PetscLinearSolver(const HypreParMatrix &A, bool wrapin,
                                      const std::string &prefix)
-   : PetscSolver(), Solver(), wrap(wrapin)
+   : PetscSolver(), Solver(), wrap(wrapin), wpA(NULL), wop(NULL)
 {
    KSP ksp;
    ierr = KSPCreate(A.GetComm(),&ksp); CCHKERRQ(A.GetComm(),ierr);
@@ -2344,18 +2349,38 @@ void PetscLinearSolver::SetOperator(const Operator &op)
    bool delete_pA = false;
    if (!pA)
    {
-      if (hA)
+      if (wrap)
       {
-         // Create MATSHELL object or convert into a format suitable to construct preconditioners
-         pA = new PetscParMatrix(hA, wrap ? PETSC_MATSHELL : PETSC_MATAIJ);
+         // Create (or reuse) a MATSHELL object: the wrapper only stores a
+         // pointer to op, so it can be kept alive in wpA and reused as long
+         // as the operator to be wrapped does not change
+         if (!wpA || wop != &op ||
+             wpA->Height() != op.Height() || wpA->Width() != op.Width())
+         {
+            delete wpA;
+            if (hA)
+            {
+               wpA = new PetscParMatrix(hA, PETSC_MATSHELL);
+            }
+            else
+            {
+               wpA = new PetscParMatrix(PetscObjectComm(obj),oA,PETSC_MATSHELL);
+            }
+            wop = &op;
+         }
+         pA = wpA;
+      }
+      else if (hA)
+      {
+         // Convert into a format suitable to construct preconditioners
+         pA = new PetscParMatrix(hA, PETSC_MATAIJ);
          delete_pA = true;
       }
       else if (oA) // fallback to general operator
       {
-         // Create MATSHELL or MATNEST (if oA is a BlockOperator) object
+         // Create MATAIJ or MATNEST (if oA is a BlockOperator) object
          // If oA is a BlockOperator, Operator::Type is relevant to the subblocks
-         pA = new PetscParMatrix(PetscObjectComm(obj),oA,
-                                 wrap ? PETSC_MATSHELL : PETSC_MATAIJ);
+         pA = new PetscParMatrix(PetscObjectComm(obj),oA,PETSC_MATAIJ);
          delete_pA = true;
       }
    }
@@ -2410,18 +2435,36 @@ void PetscLinearSolver::SetOperator(const Operator &op, const Operator &pop)
    bool delete_pA = false;
    if (!pA)
    {
-      if (hA)
+      if (wrap)
+      {
+         // Create (or reuse) a MATSHELL object, see SetOperator(const Operator&)
+         if (!wpA || wop != &op ||
+             wpA->Height() != op.Height() || wpA->Width() != op.Width())
+         {
+            delete wpA;
+            if (hA)
+            {
+               wpA = new PetscParMatrix(hA, PETSC_MATSHELL);
+            }
+            else
+            {
+               wpA = new PetscParMatrix(PetscObjectComm(obj),oA,PETSC_MATSHELL);
+            }
+            wop = &op;
+         }
+         pA = wpA;
+      }
+      else if (hA)
       {
-         // Create MATSHELL object or convert into a format suitable to construct preconditioners
-         pA = new PetscParMatrix(hA, wrap ? PETSC_MATSHELL : PETSC_MATAIJ);
+         // Convert into a format suitable to construct preconditioners
+         pA = new PetscParMatrix(hA, PETSC_MATAIJ);
          delete_pA = true;
       }
       else if (oA) // fallback to general operator
       {
-         // Create MATSHELL or MATNEST (if oA is a BlockOperator) object
+         // Create MATAIJ or MATNEST (if oA is a BlockOperator) object
          // If oA is a BlockOperator, Operator::Type is relevant to the subblocks
-         pA = new PetscParMatrix(PetscObjectComm(obj),oA,
-                                 wrap ? PETSC_MATSHELL : PETSC_MATAIJ);
+         pA = new PetscParMatrix(PetscObjectComm(obj),oA,PETSC_MATAIJ);
          delete_pA = true;
       }
    }
@@ -2573,6 +2616,7 @@ PetscLinearSolver::~PetscLinearSolver()
 {
    MPI_Comm comm;
    KSP ksp = (KSP)obj;
+   delete wpA;
    ierr = PetscObjectGetComm((PetscObject)ksp,&comm); PCHKERRQ(ksp,ierr);
    ierr = KSPDestroy(&ksp); CCHKERRQ(comm,ierr);
 }
@@ -3775,6 +3819,20 @@ static PetscErrorCode __mfem_ts_ijacobian(TS ts, PetscReal t, Vec x,
    bool delete_pA = false;
    mfem::PetscParMatrix *pA = const_cast<mfem::PetscParMatrix *>
                               (dynamic_cast<const mfem::PetscParMatrix *>(&J));
+   if (!pA && ts_ctx->jacType == mfem::Operator::PETSC_MATSHELL &&
+       !ts_ctx->bchandler)
+   {
+      // When a MATSHELL Jacobian is requested, try to recycle the shell
+      // matrix from the previous iteration instead of rebuilding it
+      PetscBool reused;
+      ierr = __mfem_mat_shell_reuse(P,&J,&reused); CHKERRQ(ierr);
+      if (reused)
+      {
+         ierr = PetscObjectStateGet((PetscObject)P,&ts_ctx->cached_ijacstate);
+         CHKERRQ(ierr);
+         PetscFunctionReturn(0);
+      }
+   }
    if (!pA || (ts_ctx->jacType != mfem::Operator::ANY_TYPE &&
                pA->GetType() != ts_ctx->jacType))
    {
@@ -4056,6 +4114,20 @@ static PetscErrorCode __mfem_ts_rhsjacobian(TS ts, PetscReal t, Vec x,
    bool delete_pA = false;
    mfem::PetscParMatrix *pA = const_cast<mfem::PetscParMatrix *>
                               (dynamic_cast<const mfem::PetscParMatrix *>(&J));
+   if (!pA && ts_ctx->jacType == mfem::Operator::PETSC_MATSHELL &&
+       !ts_ctx->bchandler)
+   {
+      // When a MATSHELL Jacobian is requested, try to recycle the shell
+      // matrix from the previous iteration instead of rebuilding it
+      PetscBool reused;
+      ierr = __mfem_mat_shell_reuse(P,&J,&reused); CHKERRQ(ierr);
+      if (reused)
+      {
+         ierr = PetscObjectStateGet((PetscObject)A,&ts_ctx->cached_rhsjacstate);
+         CHKERRQ(ierr);
+         PetscFunctionReturn(0);
+      }
+   }
    if (!pA || (ts_ctx->jacType != mfem::Operator::ANY_TYPE &&
                pA->GetType() != ts_ctx->jacType))
    {
@@ -4192,6 +4264,15 @@ static PetscErrorCode __mfem_snes_jacobian(SNES snes, Vec x, Mat A, Mat P,
    bool delete_pA = false;
    mfem::PetscParMatrix *pA = const_cast<mfem::PetscParMatrix *>
                               (dynamic_cast<const mfem::PetscParMatrix *>(&J));
+   if (!pA && snes_ctx->jacType == mfem::Operator::PETSC_MATSHELL &&
+       !snes_ctx->bchandler)
+   {
+      // When a MATSHELL Jacobian is requested, try to recycle the shell
+      // matrix from the previous iteration instead of rebuilding it
+      PetscBool reused;
+      ierr = __mfem_mat_shell_reuse(P,&J,&reused); CHKERRQ(ierr);
+      if (reused) { PetscFunctionReturn(0); }
+   }
    if (!pA || (snes_ctx->jacType != mfem::Operator::ANY_TYPE &&
                pA->GetType() != snes_ctx->jacType))
    {
@@ -4408,6 +4489,34 @@ static PetscErrorCode __mfem_mat_shell_apply_transpose(Mat A, Vec x, Vec y)
    PetscFunctionReturn(0);
 }
 
+static PetscErrorCode __mfem_mat_shell_get_diagonal(Mat A, Vec d)
+{
+   mfem::Operator *op;
+   PetscErrorCode ierr;
+
+   PetscFunctionBeginUser;
+   ierr = MatShellGetContext(A,(void **)&op); CHKERRQ(ierr);
+   if (!op) { SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_LIB,"Missing operator"); }
+   mfem::PetscParVector dd(d,true);
+   // Probe the wrapped operator for diagonal extraction; this enables
+   // diagonal-based preconditioners (e.g. -pc_type jacobi) on MATSHELL
+   // without assembling the full matrix
+   mfem::HypreParMatrix *hop = dynamic_cast<mfem::HypreParMatrix *>(op);
+   mfem::SparseMatrix   *sop = dynamic_cast<mfem::SparseMatrix *>(op);
+   mfem::BilinearForm   *bop = dynamic_cast<mfem::BilinearForm *>(op);
+   if (hop) { hop->GetDiag(dd); }
+   else if (sop) { sop->GetDiag(dd); }
+   else if (bop) { bop->AssembleDiagonal(dd); } // partially assembled forms
+   else
+   {
+      SETERRQ(PetscObjectComm((PetscObject)A),PETSC_ERR_SUP,
+              "Operator does not support diagonal extraction");
+   }
+   // need to tell PETSc the Vec has been updated
+   ierr = PetscObjectStateIncrease((PetscObject)d); CHKERRQ(ierr);
+   PetscFunctionReturn(0);
+}
+
 static PetscErrorCode __mfem_mat_shell_copy(Mat A, Mat B, MatStructure str)
 {
    mfem::Operator *op;
@@ -4426,6 +4535,30 @@ static PetscErrorCode __mfem_mat_shell_destroy(Mat A)
    PetscFunctionReturn(0);
 }
 
+// Recycles an existing MATSHELL by updating the operator it points to;
+// the shell matrix only stores a pointer to the operator, so the SNES/TS
+// Jacobian callbacks can avoid rebuilding a wrapper at every iteration
+static PetscErrorCode __mfem_mat_shell_reuse(Mat P, mfem::Operator *op,
+                                             PetscBool *reused)
+{
+   PetscBool      isshell;
+   PetscInt       m,n;
+   PetscErrorCode ierr;
+
+   PetscFunctionBeginUser;
+   *reused = PETSC_FALSE;
+   ierr = PetscObjectTypeCompare((PetscObject)P,MATSHELL,&isshell);
+   CHKERRQ(ierr);
+   if (!isshell) { PetscFunctionReturn(0); }
+   ierr = MatGetLocalSize(P,&m,&n); CHKERRQ(ierr);
+   if (m != op->Height() || n != op->Width()) { PetscFunctionReturn(0); }
+   ierr = MatShellSetContext(P,(void *)op); CHKERRQ(ierr);
+   // need to tell PETSc the Mat has been updated
+   ierr = PetscObjectStateIncrease((PetscObject)P); CHKERRQ(ierr);
+   *reused = PETSC_TRUE;
+   PetscFunctionReturn(0);
+}
+
 static PetscErrorCode __mfem_pc_shell_view(PC pc, PetscViewer viewer)
 {
    __mfem_pc_shell_ctx *ctx;
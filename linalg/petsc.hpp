@@ -612,6 +612,14 @@ class PetscLinearSolver : public PetscSolver, public Solver
 private:
    /// Internal flag to handle HypreParMatrix conversion or not.
    bool wrap;
+   /** @brief Cached MATSHELL wrapper, reused across SetOperator() calls.
+
+       The shell matrix only stores a pointer to the wrapped operator, so it
+       can be reused as long as the operator is unchanged; this avoids
+       rebuilding the wrapper at every nonlinear or time-stepping iteration. */
+   PetscParMatrix *wpA;
+   /// Operator associated with the cached wrapper @a wpA.
+   const Operator *wop;
    void MultKernel(const Vector &b, Vector &x, bool trans) const;
 
 public:
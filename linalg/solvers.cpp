@@ -12,6 +12,7 @@
 #include "linalg.hpp"
 #include "../general/forall.hpp"
 #include "../general/globals.hpp"
+#include "../general/profiler.hpp"
 #include "../fem/bilinearform.hpp"
 #include <iostream>
 #include <iomanip>
@@ -67,6 +68,35 @@ double IterativeSolver::Dot(const Vector &x, const Vector &y) const
 #endif
 }
 
+void IterativeSolver::StartDots(const int n, double *dots) const
+{
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+#if MPI_VERSION >= 3
+      MPI_Iallreduce(MPI_IN_PLACE, dots, n, MPI_DOUBLE, MPI_SUM, comm,
+                     &dot_req);
+#else
+      MPI_Allreduce(MPI_IN_PLACE, dots, n, MPI_DOUBLE, MPI_SUM, comm);
+#endif
+   }
+#else
+   MFEM_CONTRACT_VAR(n);
+   MFEM_CONTRACT_VAR(dots);
+#endif
+}
+
+void IterativeSolver::EndDots() const
+{
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0 && dot_req != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&dot_req, MPI_STATUS_IGNORE);
+      dot_req = MPI_REQUEST_NULL;
+   }
+#endif
+}
+
 void IterativeSolver::SetPrintLevel(int print_lvl)
 {
 #ifndef MFEM_USE_MPI
@@ -179,6 +209,271 @@ void OperatorJacobiSmoother::Mult(const Vector &x, Vector &y) const
    MFEM_FORALL(i, N, Y[i] += DI[i] * R[i]; );
 }
 
+OperatorL1JacobiSmoother::OperatorL1JacobiSmoother(BilinearForm &a,
+                                                   const Array<int> &ess_tdofs,
+                                                   const double dmpng)
+   : OperatorJacobiSmoother(AssembleL1Diagonal(a), ess_tdofs, dmpng)
+{
+   SetOperator(a);
+}
+
+Vector OperatorL1JacobiSmoother::AssembleL1Diagonal(BilinearForm &a)
+{
+   const FiniteElementSpace &fes = *a.FESpace();
+
+   Vector l_diag(fes.GetVSize());
+   l_diag = 0.0;
+
+   Array<int> vdofs;
+   DenseMatrix elmat;
+   for (int e = 0; e < fes.GetNE(); e++)
+   {
+      a.ComputeElementMatrix(e, elmat);
+      fes.GetElementVDofs(e, vdofs);
+      for (int i = 0; i < vdofs.Size(); i++)
+      {
+         double sum = 0.0;
+         for (int j = 0; j < vdofs.Size(); j++)
+         {
+            sum += std::abs(elmat(i, j));
+         }
+         const int vi = vdofs[i];
+         l_diag((vi >= 0) ? vi : -1-vi) += sum;
+      }
+   }
+
+   const Operator *P = fes.GetProlongationMatrix();
+   if (P)
+   {
+      Vector t_diag(P->Width());
+      P->MultTranspose(l_diag, t_diag);
+      return t_diag;
+   }
+   return l_diag;
+}
+
+OperatorPolynomialJacobiSmoother::OperatorPolynomialJacobiSmoother(
+   BilinearForm &a, const Array<int> &ess_tdofs, int order_,
+   const double dmpng)
+   :
+   Solver(a.FESpace()->GetTrueVSize()),
+   N(height),
+   order(order_),
+   dinv(N),
+   damping(dmpng),
+   ess_tdof_list(ess_tdofs),
+   residual(N)
+{
+   Vector diag(N);
+   a.AssembleDiagonal(diag);
+   oper = &a;
+   Setup(diag);
+}
+
+OperatorPolynomialJacobiSmoother::OperatorPolynomialJacobiSmoother(
+   const Vector &d, const Array<int> &ess_tdofs, int order_,
+   const double dmpng)
+   :
+   Solver(d.Size()),
+   N(d.Size()),
+   order(order_),
+   dinv(N),
+   damping(dmpng),
+   ess_tdof_list(ess_tdofs),
+   residual(N),
+   oper(NULL)
+{
+   Setup(d);
+}
+
+void OperatorPolynomialJacobiSmoother::Setup(const Vector &diag)
+{
+   residual.UseDevice(true);
+   const double delta = damping;
+   auto D = diag.Read();
+   auto DI = dinv.Write();
+   MFEM_FORALL(i, N, DI[i] = delta / D[i]; );
+   auto I = ess_tdof_list.Read();
+   MFEM_FORALL(i, ess_tdof_list.Size(), DI[I[i]] = delta; );
+}
+
+void OperatorPolynomialJacobiSmoother::Mult(const Vector &x, Vector &y) const
+{
+   MFEM_ASSERT(x.Size() == N, "invalid input vector");
+   MFEM_ASSERT(y.Size() == N, "invalid output vector");
+   MFEM_VERIFY(order <= 1 || oper,
+               "the operator must be set for order > 1");
+
+   y.UseDevice(true);
+   y = 0.0;
+
+   for (int k = 0; k < order; k++)
+   {
+      if (k == 0)
+      {
+         residual = x;
+      }
+      else
+      {
+         oper->Mult(y, residual);         // A y
+         subtract(x, residual, residual); // b - A y
+      }
+      auto DI = dinv.Read();
+      auto R = residual.Read();
+      auto Y = y.ReadWrite();
+      MFEM_FORALL(i, N, Y[i] += DI[i] * R[i]; );
+   }
+}
+
+OperatorElementBlockSmoother::OperatorElementBlockSmoother(
+   BilinearForm &a, const Array<int> &ess_tdofs, const double damping)
+   :
+   Solver(a.FESpace()->GetTrueVSize()),
+   fes(a.FESpace()),
+   P(fes->GetProlongationMatrix()),
+   elem_inv(fes->GetNE()),
+   scale(height),
+   ess_tdof_list(ess_tdofs),
+   residual(height),
+   corr(height),
+   r_l(fes->GetVSize()),
+   y_l(fes->GetVSize()),
+   oper(&a)
+{
+   // mark the essential dofs on the L-vector level
+   Vector t_mark(height), l_mark(fes->GetVSize());
+   t_mark = 0.0;
+   for (int i = 0; i < ess_tdof_list.Size(); i++)
+   {
+      t_mark(ess_tdof_list[i]) = 1.0;
+   }
+   if (P) { P->Mult(t_mark, l_mark); }
+   else { l_mark = t_mark; }
+
+   // l1 row sums of the operator on the L-vector level, used below to
+   // safeguard the element blocks
+   Vector l1_diag(fes->GetVSize());
+   l1_diag = 0.0;
+
+   Array<int> vdofs;
+   DenseMatrix elmat;
+   for (int e = 0; e < fes->GetNE(); e++)
+   {
+      a.ComputeElementMatrix(e, elmat);
+      fes->GetElementVDofs(e, vdofs);
+      for (int i = 0; i < vdofs.Size(); i++)
+      {
+         double sum = 0.0;
+         for (int j = 0; j < vdofs.Size(); j++)
+         {
+            sum += std::abs(elmat(i, j));
+         }
+         const int li = (vdofs[i] >= 0) ? vdofs[i] : -1-vdofs[i];
+         l1_diag(li) += sum;
+      }
+   }
+
+   Vector l_count(fes->GetVSize());
+   l_count = 0.0;
+
+   for (int e = 0; e < fes->GetNE(); e++)
+   {
+      a.ComputeElementMatrix(e, elmat);
+      fes->GetElementVDofs(e, vdofs);
+      for (int i = 0; i < vdofs.Size(); i++)
+      {
+         const int li = (vdofs[i] >= 0) ? vdofs[i] : -1-vdofs[i];
+         if (l_mark(li) != 0.0)
+         {
+            // eliminate the essential dof from the block
+            for (int j = 0; j < vdofs.Size(); j++)
+            {
+               elmat(i, j) = elmat(j, i) = 0.0;
+            }
+            elmat(i, i) = 1.0;
+         }
+         else
+         {
+            // l1 safeguard: add the couplings of the dof outside this
+            // element to the diagonal, making the block SPD even when the
+            // element matrix is singular (see the class documentation)
+            double sum = 0.0;
+            for (int j = 0; j < vdofs.Size(); j++)
+            {
+               sum += std::abs(elmat(i, j));
+            }
+            elmat(i, i) += l1_diag(li) - sum;
+         }
+         l_count(li) += 1.0;
+      }
+      elem_inv[e] = new DenseMatrixInverse(elmat);
+   }
+
+   // number of elements sharing each true dof
+   Vector t_count(height);
+   if (P) { P->MultTranspose(l_count, t_count); }
+   else { t_count = l_count; }
+
+   for (int i = 0; i < height; i++)
+   {
+      scale(i) = std::sqrt(damping/t_count(i));
+   }
+}
+
+OperatorElementBlockSmoother::~OperatorElementBlockSmoother()
+{
+   for (int e = 0; e < elem_inv.Size(); e++)
+   {
+      delete elem_inv[e];
+   }
+}
+
+void OperatorElementBlockSmoother::Mult(const Vector &x, Vector &y) const
+{
+   MFEM_ASSERT(x.Size() == height, "invalid input vector");
+   MFEM_ASSERT(y.Size() == height, "invalid output vector");
+
+   if (iterative_mode && oper)
+   {
+      oper->Mult(y, residual);         // A x
+      subtract(x, residual, residual); // b - A x
+   }
+   else
+   {
+      residual = x;
+      y = 0.0;
+   }
+
+   // symmetrized overlap scaling, see the class documentation
+   for (int i = 0; i < height; i++)
+   {
+      residual(i) *= scale(i);
+   }
+
+   if (P) { P->Mult(residual, r_l); }
+   else { r_l = residual; }
+
+   y_l = 0.0;
+   Array<int> vdofs;
+   Vector r_e, c_e;
+   for (int e = 0; e < elem_inv.Size(); e++)
+   {
+      fes->GetElementVDofs(e, vdofs);
+      r_l.GetSubVector(vdofs, r_e);
+      c_e.SetSize(r_e.Size());
+      elem_inv[e]->Mult(r_e, c_e);
+      y_l.AddElementVector(vdofs, c_e);
+   }
+
+   if (P) { P->MultTranspose(y_l, corr); }
+   else { corr = y_l; }
+
+   for (int i = 0; i < height; i++)
+   {
+      y(i) += scale(i)*corr(i);
+   }
+}
+
 OperatorChebyshevSmoother::OperatorChebyshevSmoother(Operator* oper_,
                                                      const Vector &d,
                                                      const Array<int>& ess_tdofs,
@@ -193,7 +488,15 @@ OperatorChebyshevSmoother::OperatorChebyshevSmoother(Operator* oper_,
    coeffs(order),
    ess_tdof_list(ess_tdofs),
    residual(N),
-   oper(oper_) { Setup(); }
+   oper(oper_),
+   power_iterations(0),
+   power_tolerance(0.0)
+{
+#ifdef MFEM_USE_MPI
+   power_comm = MPI_COMM_NULL;
+#endif
+   Setup();
+}
 
 #ifdef MFEM_USE_MPI
 OperatorChebyshevSmoother::OperatorChebyshevSmoother(Operator* oper_,
@@ -214,21 +517,41 @@ OperatorChebyshevSmoother::OperatorChebyshevSmoother(Operator* oper_,
      coeffs(order),
      ess_tdof_list(ess_tdofs),
      residual(N),
-     oper(oper_)
+     oper(oper_),
+     power_iterations(power_iterations),
+     power_tolerance(power_tolerance)
 {
-   OperatorJacobiSmoother invDiagOperator(diag, ess_tdofs, 1.0);
+#ifdef MFEM_USE_MPI
+   power_comm = comm;
+#endif
+   EstimateMaxEigenvalue();
+   Setup();
+}
+
+void OperatorChebyshevSmoother::EstimateMaxEigenvalue()
+{
+   OperatorJacobiSmoother invDiagOperator(diag, ess_tdof_list, 1.0);
    ProductOperator diagPrecond(&invDiagOperator, oper, false, false);
 
 #ifdef MFEM_USE_MPI
-   PowerMethod powerMethod(comm);
+   PowerMethod powerMethod(power_comm);
 #else
    PowerMethod powerMethod;
 #endif
    Vector ev(oper->Width());
    max_eig_estimate = powerMethod.EstimateLargestEigenvalue(diagPrecond, ev,
                                                             power_iterations, power_tolerance);
+}
 
-   Setup();
+void OperatorChebyshevSmoother::SetOperator(const Operator &op_)
+{
+   if (&op_ == oper) { return; } // cached estimate and coefficients are valid
+   oper = &op_;
+   if (power_iterations > 0)
+   {
+      EstimateMaxEigenvalue();
+      Setup();
+   }
 }
 
 void OperatorChebyshevSmoother::Setup()
@@ -322,29 +645,37 @@ void OperatorChebyshevSmoother::Mult(const Vector& x, Vector &y) const
 
    residual = x;
    helperVector.SetSize(x.Size());
+   helperVector.UseDevice(true);
 
    y.UseDevice(true);
-   y = 0.0;
 
+   // All polynomial terms are applied with a single fused sweep per order:
+   // the inverse-diagonal scaling and the weighted contribution to y happen
+   // in one pass, and the operator output buffer is swapped into the
+   // residual instead of being copied.
+   const int n = N;
+   Vector *r = &residual, *h = &helperVector;
    for (int k = 0; k < order; ++k)
    {
-      // Apply
       if (k > 0)
       {
-         oper->Mult(residual, helperVector);
-         residual = helperVector;
+         oper->Mult(*r, *h);
+         Swap(r, h);
       }
 
-      // Scale residual by inverse diagonal
-      const int n = N;
+      const double c_k = coeffs[k];
       auto Dinv = dinv.Read();
-      auto R = residual.ReadWrite();
-      MFEM_FORALL(i, n, R[i] *= Dinv[i]; );
-
-      // Add weighted contribution to y
-      auto Y = y.ReadWrite();
-      auto C = coeffs.Read();
-      MFEM_FORALL(i, n, Y[i] += C[k] * R[i]; );
+      auto R = r->ReadWrite();
+      if (k == 0)
+      {
+         auto Y = y.Write();
+         MFEM_FORALL(i, n, R[i] *= Dinv[i]; Y[i] = c_k * R[i]; );
+      }
+      else
+      {
+         auto Y = y.ReadWrite();
+         MFEM_FORALL(i, n, R[i] *= Dinv[i]; Y[i] += c_k * R[i]; );
+      }
    }
 }
 
@@ -356,6 +687,7 @@ void SLISolver::UpdateVectors()
 
 void SLISolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PROFILE_SCOPE("SLISolver::Mult");
    int i;
 
    // Optimized preconditioned SLI with fixed number of iterations and given
@@ -432,6 +764,7 @@ void SLISolver::Mult(const Vector &b, Vector &x) const
    // start iteration
    converged = 0;
    final_iter = max_iter;
+   double dot_loc = 0.0; // local dot product used in deferred-norm mode
    for (i = 1; true; )
    {
       if (prec) //  x = x + B (b - A x)
@@ -449,12 +782,21 @@ void SLISolver::Mult(const Vector &b, Vector &x) const
       if (prec)
       {
          prec->Mult(r, z); //  z = B r
-         nom = sqrt(Dot(z, z));
+         if (!deferred_norms) { nom = sqrt(Dot(z, z)); }
       }
-      else
+      else if (!deferred_norms)
       {
          nom = sqrt(Dot(r, r));
       }
+      if (deferred_norms)
+      {
+         // Complete the reduction started in the previous iteration and
+         // start the one for this iteration: the norm tested (and printed)
+         // below lags the residual by one iteration.
+         if (i > 1) { EndDots(); nom = sqrt(dot_loc); }
+         dot_loc = prec ? (z * z) : (r * r);
+         StartDots(1, &dot_loc);
+      }
 
       cf = nom/nomold;
       if (print_level == 1)
@@ -482,6 +824,13 @@ void SLISolver::Mult(const Vector &b, Vector &x) const
       }
    }
 
+   if (deferred_norms)
+   {
+      // complete the last pending reduction and report the freshest norm
+      EndDots();
+      nom = sqrt(dot_loc);
+   }
+
    if (print_level >= 0 && !converged)
    {
       mfem::err << "SLI: No convergence!" << '\n';
@@ -534,6 +883,7 @@ void CGSolver::UpdateVectors()
 
 void CGSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PROFILE_SCOPE("CGSolver::Mult");
    int i;
    double r0, den, nom, nom0, betanom, alpha, beta;
 
@@ -578,141 +928,580 @@ void CGSolver::Mult(const Vector &b, Vector &x) const
       final_norm = nom;
       return;
    }
-   r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
-   if (nom <= r0)
+   r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
+   if (nom <= r0)
+   {
+      converged = 1;
+      final_iter = 0;
+      final_norm = sqrt(nom);
+      return;
+   }
+
+   oper->Mult(d, z);  // z = A d
+   den = Dot(z, d);
+   MFEM_ASSERT(IsFinite(den), "den = " << den);
+   if (den <= 0.0)
+   {
+      if (Dot(d, d) > 0.0 && print_level >= 0)
+      {
+         mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
+                   << den << '\n';
+      }
+      if (den == 0.0)
+      {
+         converged = 0;
+         final_iter = 0;
+         final_norm = sqrt(nom);
+         return;
+      }
+   }
+
+   // start iteration
+   converged = 0;
+   final_iter = max_iter;
+   for (i = 1; true; )
+   {
+      alpha = nom/den;
+      add(x,  alpha, d, x);     //  x = x + alpha d
+      add(r, -alpha, z, r);     //  r = r - alpha A d
+
+      if (prec)
+      {
+         prec->Mult(r, z);      //  z = B r
+         betanom = Dot(r, z);
+      }
+      else
+      {
+         betanom = Dot(r, r);
+      }
+      MFEM_ASSERT(IsFinite(betanom), "betanom = " << betanom);
+      if (betanom < 0.0)
+      {
+         if (print_level >= 0)
+         {
+            mfem::out << "PCG: The preconditioner is not positive definite. (Br, r) = "
+                      << betanom << '\n';
+         }
+         converged = 0;
+         final_iter = i;
+         break;
+      }
+
+      if (print_level == 1)
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << betanom << '\n';
+      }
+
+      Monitor(i, betanom, r, x);
+
+      if (betanom < r0)
+      {
+         if (print_level == 2)
+         {
+            mfem::out << "Number of PCG iterations: " << i << '\n';
+         }
+         else if (print_level == 3)
+         {
+            mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                      << betanom << '\n';
+         }
+         converged = 1;
+         final_iter = i;
+         break;
+      }
+
+      if (++i > max_iter)
+      {
+         break;
+      }
+
+      beta = betanom/nom;
+      if (prec)
+      {
+         add(z, beta, d, d);   //  d = z + beta d
+      }
+      else
+      {
+         add(r, beta, d, d);
+      }
+      oper->Mult(d, z);       //  z = A d
+      den = Dot(d, z);
+      MFEM_ASSERT(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (Dot(d, d) > 0.0 && print_level >= 0)
+         {
+            mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
+                      << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      nom = betanom;
+   }
+   if (print_level >= 0 && !converged)
+   {
+      if (print_level != 1)
+      {
+         if (print_level != 3)
+         {
+            mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
+                      << nom0 << " ...\n";
+         }
+         mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                   << betanom << '\n';
+      }
+      mfem::out << "PCG: No convergence!" << '\n';
+   }
+   if (print_level >= 1 || (print_level >= 0 && !converged))
+   {
+      mfem::out << "Average reduction factor = "
+                << pow (betanom/nom0, 0.5/final_iter) << '\n';
+   }
+   final_norm = sqrt(betanom);
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+void CGSolver::ArrayMult(const Array<const Vector *> &B,
+                         Array<Vector *> &X) const
+{
+   MFEM_ASSERT(B.Size() == X.Size(), "incompatible arrays!");
+   const int ns = B.Size();
+   if (ns == 0) { return; }
+   if (ns == 1) { Mult(*B[0], *X[0]); return; }
+
+   // One CG recurrence per right-hand side: the operator and preconditioner
+   // are applied to all unconverged systems at once through ArrayMult() and
+   // their inner products are fused into one reduction per stage.
+   Array<Vector *> R(ns), D(ns), Z(ns);
+   for (int k = 0; k < ns; k++)
+   {
+      R[k] = new Vector(width);
+      D[k] = new Vector(width);
+      Z[k] = new Vector(width);
+   }
+   Vector noms(ns), dens(ns), betanoms(ns), r0s(ns), dots(ns);
+   Array<bool> active(ns);
+   Array<const Vector *> ins(ns);
+   Array<Vector *> outs(ns);
+   active = true;
+   int n_active = ns;
+   converged = 1;
+   final_iter = 0;
+
+   if (iterative_mode)
+   {
+      for (int k = 0; k < ns; k++) { ins[k] = X[k]; }
+      oper->ArrayMult(ins, R);
+      for (int k = 0; k < ns; k++)
+      {
+         subtract(*B[k], *R[k], *R[k]);   // r = b - A x
+      }
+   }
+   else
+   {
+      for (int k = 0; k < ns; k++)
+      {
+         *R[k] = *B[k];
+         *X[k] = 0.0;
+      }
+   }
+
+   if (prec)
+   {
+      for (int k = 0; k < ns; k++) { ins[k] = R[k]; }
+      prec->ArrayMult(ins, Z);            // z = B r
+      for (int k = 0; k < ns; k++) { *D[k] = *Z[k]; }
+   }
+   else
+   {
+      for (int k = 0; k < ns; k++) { *D[k] = *R[k]; }
+   }
+   for (int k = 0; k < ns; k++) { noms(k) = (*D[k]) * (*R[k]); }
+   StartDots(ns, noms.GetData());
+   EndDots();
+   betanoms = noms;
+
+   for (int k = 0; k < ns; k++)
+   {
+      MFEM_ASSERT(IsFinite(noms(k)), "nom = " << noms(k));
+      if (noms(k) < 0.0)
+      {
+         if (print_level >= 0)
+         {
+            mfem::out << "PCG: The preconditioner is not positive definite. "
+                      "(Br, r) = " << noms(k) << '\n';
+         }
+         converged = 0;
+         active[k] = false;
+         n_active--;
+         continue;
+      }
+      r0s(k) = std::max(noms(k)*rel_tol*rel_tol, abs_tol*abs_tol);
+      if (noms(k) <= r0s(k))
+      {
+         active[k] = false;
+         n_active--;
+      }
+   }
+
+   // z = A d for the active systems, den = (A d, d) fused
+   if (n_active > 0)
+   {
+      ins.SetSize(ns);
+      outs.SetSize(ns);
+      int na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (active[k]) { ins[na] = D[k]; outs[na] = Z[k]; na++; }
+      }
+      ins.SetSize(na);
+      outs.SetSize(na);
+      oper->ArrayMult(ins, outs);
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (active[k]) { dots(na++) = (*D[k]) * (*Z[k]); }
+      }
+      StartDots(na, dots.GetData());
+      EndDots();
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (active[k])
+         {
+            dens(k) = dots(na++);
+            MFEM_ASSERT(IsFinite(dens(k)), "den = " << dens(k));
+            if (dens(k) <= 0.0)
+            {
+               if (print_level >= 0)
+               {
+                  mfem::out << "PCG: The operator is not positive definite. "
+                            "(Ad, d) = " << dens(k) << '\n';
+               }
+               if (dens(k) == 0.0)
+               {
+                  converged = 0;
+                  active[k] = false;
+                  n_active--;
+               }
+            }
+         }
+      }
+   }
+
+   for (int i = 1; n_active > 0; )
+   {
+      for (int k = 0; k < ns; k++)
+      {
+         if (!active[k]) { continue; }
+         const double alpha = noms(k)/dens(k);
+         add(*X[k],  alpha, *D[k], *X[k]);   //  x = x + alpha d
+         add(*R[k], -alpha, *Z[k], *R[k]);   //  r = r - alpha A d
+      }
+
+      ins.SetSize(ns);
+      outs.SetSize(ns);
+      int na = 0;
+      if (prec)
+      {
+         for (int k = 0; k < ns; k++)
+         {
+            if (active[k]) { ins[na] = R[k]; outs[na] = Z[k]; na++; }
+         }
+         ins.SetSize(na);
+         outs.SetSize(na);
+         prec->ArrayMult(ins, outs);       //  z = B r
+      }
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (!active[k]) { continue; }
+         dots(na++) = prec ? (*R[k]) * (*Z[k]) : (*R[k]) * (*R[k]);
+      }
+      StartDots(na, dots.GetData());
+      EndDots();
+      na = 0;
+      double max_betanom = 0.0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (!active[k]) { continue; }
+         betanoms(k) = dots(na++);
+         MFEM_ASSERT(IsFinite(betanoms(k)), "betanom = " << betanoms(k));
+         if (betanoms(k) < 0.0)
+         {
+            if (print_level >= 0)
+            {
+               mfem::out << "PCG: The preconditioner is not positive definite."
+                         " (Br, r) = " << betanoms(k) << '\n';
+            }
+            converged = 0;
+            active[k] = false;
+            n_active--;
+            final_iter = i;
+            continue;
+         }
+         if (betanoms(k) < r0s(k))
+         {
+            active[k] = false;
+            n_active--;
+            final_iter = i;
+            continue;
+         }
+         max_betanom = std::max(max_betanom, betanoms(k));
+      }
+
+      if (print_level == 1 && n_active > 0)
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  max (B r, r) = "
+                   << max_betanom << "  (" << n_active << " active)" << '\n';
+      }
+
+      if (n_active == 0) { break; }
+
+      if (++i > max_iter)
+      {
+         converged = 0;
+         final_iter = max_iter;
+         break;
+      }
+
+      for (int k = 0; k < ns; k++)
+      {
+         if (!active[k]) { continue; }
+         const double beta = betanoms(k)/noms(k);
+         if (prec)
+         {
+            add(*Z[k], beta, *D[k], *D[k]);   //  d = z + beta d
+         }
+         else
+         {
+            add(*R[k], beta, *D[k], *D[k]);
+         }
+      }
+      ins.SetSize(ns);
+      outs.SetSize(ns);
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (active[k]) { ins[na] = D[k]; outs[na] = Z[k]; na++; }
+      }
+      ins.SetSize(na);
+      outs.SetSize(na);
+      oper->ArrayMult(ins, outs);            //  z = A d
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (active[k]) { dots(na++) = (*D[k]) * (*Z[k]); }
+      }
+      StartDots(na, dots.GetData());
+      EndDots();
+      na = 0;
+      for (int k = 0; k < ns; k++)
+      {
+         if (!active[k]) { continue; }
+         dens(k) = dots(na++);
+         MFEM_ASSERT(IsFinite(dens(k)), "den = " << dens(k));
+         if (dens(k) <= 0.0)
+         {
+            if ((*D[k]) * (*D[k]) > 0.0 && print_level >= 0)
+            {
+               mfem::out << "PCG: The operator is not positive definite. "
+                         "(Ad, d) = " << dens(k) << '\n';
+            }
+            if (dens(k) == 0.0)
+            {
+               converged = 0;
+               active[k] = false;
+               n_active--;
+               final_iter = i;
+            }
+         }
+         noms(k) = betanoms(k);
+      }
+   }
+
+   if (print_level >= 0 && !converged)
+   {
+      mfem::out << "PCG: No convergence!" << '\n';
+   }
+   double max_betanom = 0.0;
+   for (int k = 0; k < ns; k++)
+   {
+      max_betanom = std::max(max_betanom, betanoms(k));
+   }
+   final_norm = sqrt(max_betanom);
+
+   for (int k = 0; k < ns; k++)
+   {
+      delete R[k];
+      delete D[k];
+      delete Z[k];
+   }
+}
+
+void PipelinedCGSolver::UpdateVectors()
+{
+   r.SetSize(width);
+   u.SetSize(width);
+   w.SetSize(width);
+   mv.SetSize(width);
+   nv.SetSize(width);
+   z.SetSize(width);
+   q.SetSize(width);
+   p.SetSize(width);
+   s.SetSize(width);
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   int i;
+   double r0, gamma, gamma_old, delta, alpha, beta, nom0;
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
    {
-      converged = 1;
-      final_iter = 0;
-      final_norm = sqrt(nom);
-      return;
+      r = b;
+      x = 0.0;
    }
 
-   oper->Mult(d, z);  // z = A d
-   den = Dot(z, d);
-   MFEM_ASSERT(IsFinite(den), "den = " << den);
-   if (den <= 0.0)
+   if (prec)
    {
-      if (Dot(d, d) > 0.0 && print_level >= 0)
-      {
-         mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
-                   << den << '\n';
-      }
-      if (den == 0.0)
-      {
-         converged = 0;
-         final_iter = 0;
-         final_norm = sqrt(nom);
-         return;
-      }
+      prec->Mult(r, u);  // u = B r
+   }
+   else
+   {
+      u = r;
    }
+   oper->Mult(u, w);     // w = A u
 
-   // start iteration
+   z = 0.0; q = 0.0; p = 0.0; s = 0.0;
+   alpha = gamma = gamma_old = 1.0;
+   r0 = nom0 = 0.0;
    converged = 0;
    final_iter = max_iter;
-   for (i = 1; true; )
-   {
-      alpha = nom/den;
-      add(x,  alpha, d, x);     //  x = x + alpha d
-      add(r, -alpha, z, r);     //  r = r - alpha A d
 
+   for (i = 0; true; i++)
+   {
+      // Fused local partial dots; the single reduction is overlapped with
+      // the preconditioner and operator applications below.
+      double dots[2] = { u*r, u*w };
+      StartDots(2, dots);
       if (prec)
       {
-         prec->Mult(r, z);      //  z = B r
-         betanom = Dot(r, z);
+         prec->Mult(w, mv); // m = B w
       }
       else
       {
-         betanom = Dot(r, r);
+         mv = w;
       }
-      MFEM_ASSERT(IsFinite(betanom), "betanom = " << betanom);
-      if (betanom < 0.0)
+      oper->Mult(mv, nv);   // n = A m
+      EndDots();
+      gamma = dots[0];      // (B r, r)
+      delta = dots[1];      // (B r, A B r)
+      MFEM_ASSERT(IsFinite(gamma), "gamma = " << gamma);
+      MFEM_ASSERT(IsFinite(delta), "delta = " << delta);
+
+      if (gamma < 0.0)
       {
          if (print_level >= 0)
          {
-            mfem::out << "PCG: The preconditioner is not positive definite. (Br, r) = "
-                      << betanom << '\n';
+            mfem::out << "PipelinedPCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << gamma << '\n';
          }
          converged = 0;
          final_iter = i;
          break;
       }
 
-      if (print_level == 1)
+      if (print_level == 1 || (i == 0 && print_level == 3))
       {
          mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
-                   << betanom << '\n';
+                   << gamma << '\n';
       }
+      Monitor(i, gamma, r, x);
 
-      Monitor(i, betanom, r, x);
-
-      if (betanom < r0)
+      if (i == 0)
+      {
+         nom0 = gamma;
+         r0 = std::max(gamma*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      if (gamma <= r0)
       {
          if (print_level == 2)
          {
-            mfem::out << "Number of PCG iterations: " << i << '\n';
+            mfem::out << "Number of PipelinedPCG iterations: " << i << '\n';
          }
          else if (print_level == 3)
          {
             mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
-                      << betanom << '\n';
+                      << gamma << '\n';
          }
          converged = 1;
          final_iter = i;
          break;
       }
-
-      if (++i > max_iter)
+      if (i == max_iter)
       {
          break;
       }
 
-      beta = betanom/nom;
-      if (prec)
+      if (i == 0)
       {
-         add(z, beta, d, d);   //  d = z + beta d
+         if (delta <= 0.0)
+         {
+            if (print_level >= 0)
+            {
+               mfem::out << "PipelinedPCG: The operator is not positive "
+                         "definite. (Ad, d) = " << delta << '\n';
+            }
+            if (delta == 0.0)
+            {
+               final_iter = 0;
+               break;
+            }
+         }
+         beta = 0.0;
+         alpha = gamma/delta;
       }
       else
       {
-         add(r, beta, d, d);
-      }
-      oper->Mult(d, z);       //  z = A d
-      den = Dot(d, z);
-      MFEM_ASSERT(IsFinite(den), "den = " << den);
-      if (den <= 0.0)
-      {
-         if (Dot(d, d) > 0.0 && print_level >= 0)
-         {
-            mfem::out << "PCG: The operator is not positive definite. (Ad, d) = "
-                      << den << '\n';
-         }
-         if (den == 0.0)
-         {
-            final_iter = i;
-            break;
-         }
+         beta = gamma/gamma_old;
+         alpha = gamma/(delta - beta*gamma/alpha);
       }
-      nom = betanom;
+
+      add(nv, beta, z, z); // z = n + beta z  (= A B s)
+      add(mv, beta, q, q); // q = m + beta q  (= B s)
+      add(u, beta, p, p);  // p = u + beta p
+      add(w, beta, s, s);  // s = w + beta s  (= A p)
+
+      x.Add(alpha, p);
+      r.Add(-alpha, s);
+      u.Add(-alpha, q);
+      w.Add(-alpha, z);
+
+      gamma_old = gamma;
    }
+
    if (print_level >= 0 && !converged)
    {
-      if (print_level != 1)
-      {
-         if (print_level != 3)
-         {
-            mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
-                      << nom0 << " ...\n";
-         }
-         mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
-                   << betanom << '\n';
-      }
-      mfem::out << "PCG: No convergence!" << '\n';
+      mfem::out << "PipelinedPCG: No convergence!" << '\n';
    }
-   if (print_level >= 1 || (print_level >= 0 && !converged))
+   if (final_iter > 0 && (print_level >= 1 || (print_level >= 0 && !converged)))
    {
       mfem::out << "Average reduction factor = "
-                << pow (betanom/nom0, 0.5/final_iter) << '\n';
+                << pow (gamma/nom0, 0.5/final_iter) << '\n';
    }
-   final_norm = sqrt(betanom);
+   final_norm = sqrt(std::abs(gamma));
 
    Monitor(final_iter, final_norm, r, x, true);
 }
@@ -797,6 +1586,7 @@ inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
 
 void GMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PROFILE_SCOPE("GMRESSolver::Mult");
    // Generalized Minimum Residual method following the algorithm
    // on p. 20 of the SIAM Templates book.
 
@@ -804,8 +1594,11 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
 
    DenseMatrix H(m+1, m);
    Vector s(m+1), cs(m+1), sn(m+1);
-   Vector r(n), w(n);
-   Array<Vector *> v;
+   Vector dots(m+2);
+   r.SetSize(n);
+   r.UseDevice(true);
+   w.SetSize(n);
+   w.UseDevice(true);
 
    double resid;
    int i, j, k;
@@ -864,11 +1657,15 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
 
    Monitor(0, beta, r, x);
 
-   v.SetSize(m+1, NULL);
+   v.SetSize(m+1, NULL); // grow the basis if necessary; the vectors persist
+   for (i = 0; i <= m; i++)
+   {
+      if (v[i]) { v[i]->SetSize(n); } // no-op unless the operator changed
+   }
 
    for (j = 1; j <= max_iter; )
    {
-      if (v[0] == NULL) { v[0] = new Vector(n); }
+      if (v[0] == NULL) { v[0] = new Vector(n); v[0]->UseDevice(true); }
       v[0]->Set(1.0/beta, r);
       s = 0.0; s(0) = beta;
 
@@ -884,15 +1681,38 @@ void GMRESSolver::Mult(const Vector &b, Vector &x) const
             oper->Mult(*v[i], w);
          }
 
-         for (k = 0; k <= i; k++)
+         if (!deferred_norms)
          {
-            H(k,i) = Dot(w, *v[k]);  // H(k,i) = w * v[k]
-            w.Add(-H(k,i), *v[k]);   // w -= H(k,i) * v[k]
-         }
+            for (k = 0; k <= i; k++)
+            {
+               H(k,i) = Dot(w, *v[k]);  // H(k,i) = w * v[k]
+               w.Add(-H(k,i), *v[k]);   // w -= H(k,i) * v[k]
+            }
 
-         H(i+1,i) = Norm(w);           // H(i+1,i) = ||w||
+            H(i+1,i) = Norm(w);        // H(i+1,i) = ||w||
+         }
+         else
+         {
+            // Classical Gram-Schmidt with the i+2 dot products fused into a
+            // single reduction; ||w|| after the projection is recovered from
+            // the Pythagorean identity.
+            for (k = 0; k <= i; k++) { dots(k) = w * (*v[k]); }
+            dots(i+1) = w * w;
+            StartDots(i+2, dots.GetData());
+            EndDots();
+            double w_norm2 = dots(i+1);
+            for (k = 0; k <= i; k++)
+            {
+               H(k,i) = dots(k);        // H(k,i) = w * v[k]
+               w.Add(-H(k,i), *v[k]);   // w -= H(k,i) * v[k]
+               w_norm2 -= H(k,i)*H(k,i);
+            }
+            // fall back to a direct norm if cancellation made the
+            // Pythagorean update unreliable
+            H(i+1,i) = (w_norm2 > 0.0) ? sqrt(w_norm2) : Norm(w);
+         }
          MFEM_ASSERT(IsFinite(H(i+1,i)), "Norm(w) = " << H(i+1,i));
-         if (v[i+1] == NULL) { v[i+1] = new Vector(n); }
+         if (v[i+1] == NULL) { v[i+1] = new Vector(n); v[i+1]->UseDevice(true); }
          v[i+1]->Set(1.0/H(i+1,i), w); // v[i+1] = w / H(i+1,i)
 
          for (k = 0; k < i; k++)
@@ -975,8 +1795,11 @@ finish:
    }
 
    Monitor(final_iter, final_norm, r, x, true);
+}
 
-   for (i = 0; i < v.Size(); i++)
+GMRESSolver::~GMRESSolver()
+{
+   for (int i = 0; i < v.Size(); i++)
    {
       delete v[i];
    }
@@ -986,7 +1809,8 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 {
    DenseMatrix H(m+1,m);
    Vector s(m+1), cs(m+1), sn(m+1);
-   Vector r(b.Size());
+   r.SetSize(b.Size());
+   r.UseDevice(true);
 
    int i, j, k;
 
@@ -1023,18 +1847,19 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 
    Monitor(0, beta, r, x);
 
-   Array<Vector*> v(m+1);
-   Array<Vector*> z(m+1);
+   // grow the bases if necessary; the vectors persist between calls
+   v.SetSize(m+1, NULL);
+   z.SetSize(m+1, NULL);
    for (i= 0; i<=m; i++)
    {
-      v[i] = NULL;
-      z[i] = NULL;
+      if (v[i]) { v[i]->SetSize(b.Size()); } // no-op unless the operator changed
+      if (z[i]) { z[i]->SetSize(b.Size()); }
    }
 
    j = 1;
    while (j <= max_iter)
    {
-      if (v[0] == NULL) { v[0] = new Vector(b.Size()); }
+      if (v[0] == NULL) { v[0] = new Vector(b.Size()); v[0]->UseDevice(true); }
       (*v[0]) = 0.0;
       v[0] -> Add (1.0/beta, r);   // v[0] = r / ||r||
       s = 0.0; s(0) = beta;
@@ -1042,7 +1867,7 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
       for (i = 0; i < m && j <= max_iter; i++, j++)
       {
 
-         if (z[i] == NULL) { z[i] = new Vector(b.Size()); }
+         if (z[i] == NULL) { z[i] = new Vector(b.Size()); z[i]->UseDevice(true); }
          (*z[i]) = 0.0;
 
          if (prec)
@@ -1062,7 +1887,11 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
          }
 
          H(i+1,i)  = Norm(r);       // H(i+1,i) = ||r||
-         if (v[i+1] == NULL) { v[i+1] = new Vector(b.Size()); }
+         if (v[i+1] == NULL)
+         {
+            v[i+1] = new Vector(b.Size());
+            v[i+1]->UseDevice(true);
+         }
          (*v[i+1]) = 0.0;
          v[i+1] -> Add (1.0/H(i+1,i), r); // v[i+1] = r / H(i+1,i)
 
@@ -1096,12 +1925,6 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
             {
                mfem::out << "Number of FGMRES iterations: " << final_iter << endl;
             }
-
-            for (i= 0; i<=m; i++)
-            {
-               if (v[i]) { delete v[i]; }
-               if (z[i]) { delete z[i]; }
-            }
             return;
          }
       }
@@ -1127,21 +1950,10 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
          {
             mfem::out << "Number of FGMRES iterations: " << final_iter << endl;
          }
-
-         for (i= 0; i<=m; i++)
-         {
-            if (v[i]) { delete v[i]; }
-            if (z[i]) { delete z[i]; }
-         }
          return;
       }
    }
 
-   for (i = 0; i <= m; i++)
-   {
-      if (v[i]) { delete v[i]; }
-      if (z[i]) { delete z[i]; }
-   }
    converged = 0;
 
    if (print_level >= 0)
@@ -1152,6 +1964,12 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
    return;
 }
 
+FGMRESSolver::~FGMRESSolver()
+{
+   for (int i = 0; i < v.Size(); i++) { delete v[i]; }
+   for (int i = 0; i < z.Size(); i++) { delete z[i]; }
+}
+
 
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, double &tol, double atol, int printit)
@@ -1180,17 +1998,26 @@ void GMRES(const Operator &A, Solver &B, const Vector &b, Vector &x,
 void BiCGSTABSolver::UpdateVectors()
 {
    p.SetSize(width);
+   p.UseDevice(true);
    phat.SetSize(width);
+   phat.UseDevice(true);
    s.SetSize(width);
+   s.UseDevice(true);
    shat.SetSize(width);
+   shat.UseDevice(true);
    t.SetSize(width);
+   t.UseDevice(true);
    v.SetSize(width);
+   v.UseDevice(true);
    r.SetSize(width);
+   r.UseDevice(true);
    rtilde.SetSize(width);
+   rtilde.UseDevice(true);
 }
 
 void BiCGSTABSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PROFILE_SCOPE("BiCGSTABSolver::Mult");
    // BiConjugate Gradient Stabilized method following the algorithm
    // on p. 27 of the SIAM Templates book.
 
@@ -1364,6 +2191,7 @@ void MINRESSolver::SetOperator(const Operator &op)
 
 void MINRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PROFILE_SCOPE("MINRESSolver::Mult");
    // Based on the MINRES algorithm on p. 86, Fig. 6.9 in
    // "Iterative Krylov Methods for Large Linear Systems",
    // by Henk A. van der Vorst, 2003.
@@ -1587,6 +2415,8 @@ void NewtonSolver::Mult(const Vector &b, Vector &x) const
 
    prec->iterative_mode = false;
 
+   double norm_prev = norm;
+
    // x_{i+1} = x_i - [DF(x_i)]^{-1} [F(x_i)-b]
    for (it = 0; true; it++)
    {
@@ -1615,7 +2445,13 @@ void NewtonSolver::Mult(const Vector &b, Vector &x) const
          break;
       }
 
-      prec->SetOperator(oper->GetGradient(x));
+      // Refresh the Jacobian, unless reuse is enabled and the residual norm
+      // is still being reduced fast enough, see SetJacobianReuseRate().
+      if (it == 0 || jac_reuse_rate <= 0.0 || norm > jac_reuse_rate*norm_prev)
+      {
+         prec->SetOperator(oper->GetGradient(x));
+      }
+      norm_prev = norm;
 
       prec->Mult(r, c);  // c = [DF(x_i)]^{-1} [F(x_i)-b]
 
@@ -1641,6 +2477,193 @@ void NewtonSolver::Mult(const Vector &b, Vector &x) const
    final_norm = norm;
 }
 
+void AndersonSolver::SetOperator(const Operator &op)
+{
+   oper = &op;
+   height = op.Height();
+   width = op.Width();
+   MFEM_ASSERT(height == width, "square Operator is required.");
+
+   r.SetSize(width);
+   f.SetSize(width);
+   x_prev.SetSize(width);
+   f_prev.SetSize(width);
+}
+
+void AndersonSolver::SetHistoryDepth(int m)
+{
+   depth = m;
+   // release the history vectors that are no longer needed
+   for (int i = depth; i < dx_hist.Size(); i++)
+   {
+      delete dx_hist[i];
+      delete df_hist[i];
+   }
+   if (dx_hist.Size() > depth)
+   {
+      dx_hist.SetSize(depth);
+      df_hist.SetSize(depth);
+   }
+}
+
+void AndersonSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_ASSERT(oper != NULL, "the Operator is not set (use SetOperator).");
+   MFEM_ASSERT(prec != NULL, "the Solver is not set (use SetSolver).");
+   MFEM_VERIFY(depth > 0, "the history depth must be positive.");
+
+   int it;
+   double norm0, norm, norm_goal;
+   const bool have_b = (b.Size() == Height());
+
+   if (!iterative_mode)
+   {
+      x = 0.0;
+   }
+
+   dx_hist.SetSize(depth, NULL);
+   df_hist.SetSize(depth, NULL);
+   for (int i = 0; i < depth; i++)
+   {
+      if (dx_hist[i] == NULL)
+      {
+         dx_hist[i] = new Vector(width);
+         df_hist[i] = new Vector(width);
+      }
+      else
+      {
+         dx_hist[i]->SetSize(width); // no-op unless the operator changed
+         df_hist[i]->SetSize(width);
+      }
+   }
+
+   prec->iterative_mode = false;
+
+   oper->Mult(x, r);
+   if (have_b) { subtract(b, r, r); }
+   else { r.Neg(); }           // r = b - F(x)
+
+   norm0 = norm = Norm(r);
+   norm_goal = std::max(rel_tol*norm, abs_tol);
+
+   prec->Mult(r, f);           // f = M [b - F(x)]
+
+   int head = -1, cols = 0;
+
+   for (it = 0; true; it++)
+   {
+      MFEM_ASSERT(IsFinite(norm), "norm = " << norm);
+      if (print_level >= 0)
+      {
+         mfem::out << "Anderson iteration " << setw(2) << it
+                   << " : ||r|| = " << norm;
+         if (it > 0)
+         {
+            mfem::out << ", ||r||/||r_0|| = " << norm/norm0;
+         }
+         mfem::out << '\n';
+      }
+      Monitor(it, norm, r, x);
+
+      if (norm <= norm_goal)
+      {
+         converged = 1;
+         break;
+      }
+
+      if (it >= max_iter)
+      {
+         converged = 0;
+         break;
+      }
+
+      if (it > 0)
+      {
+         // store the differences of the last two iterates in the history
+         head = (head + 1) % depth;
+         subtract(x, x_prev, *dx_hist[head]);
+         subtract(f, f_prev, *df_hist[head]);
+         if (cols < depth) { cols++; }
+      }
+      x_prev = x;
+      f_prev = f;
+
+      if (cols == 0)
+      {
+         x.Add(beta, f);          // plain (damped) fixed-point step
+      }
+      else
+      {
+         // minimize the preconditioned residual over the history:
+         // solve the (regularized) normal equations (dF^T dF) gamma = dF^T f
+         DenseMatrix G(cols);
+         Vector rhs(cols), gamma(cols);
+         for (int i = 0; i < cols; i++)
+         {
+            const Vector &df_i = *df_hist[(head - i + depth) % depth];
+            rhs(i) = Dot(df_i, f);
+            for (int j = 0; j <= i; j++)
+            {
+               const Vector &df_j = *df_hist[(head - j + depth) % depth];
+               G(i,j) = G(j,i) = Dot(df_i, df_j);
+            }
+         }
+         double reg = 0.0;
+         for (int i = 0; i < cols; i++) { reg = std::max(reg, G(i,i)); }
+         bool accept = IsFinite(reg) && reg > 0.0;
+         if (accept)
+         {
+            reg *= 1e-12; // guard against a (nearly) collinear history
+            for (int i = 0; i < cols; i++) { G(i,i) += reg; }
+            DenseMatrixInverse G_inv(G);
+            G_inv.Mult(rhs, gamma);
+            for (int i = 0; i < cols; i++)
+            {
+               if (!IsFinite(gamma(i))) { accept = false; break; }
+            }
+         }
+         if (accept)
+         {
+            // x += beta*f - sum_i gamma_i (dx_i + beta*df_i)
+            x.Add(beta, f);
+            for (int i = 0; i < cols; i++)
+            {
+               const int h = (head - i + depth) % depth;
+               x.Add(-gamma(i), *dx_hist[h]);
+               x.Add(-beta*gamma(i), *df_hist[h]);
+            }
+         }
+         else
+         {
+            // degenerate (e.g. overflowed) history: drop it and fall back to
+            // a plain fixed-point step
+            head = -1;
+            cols = 0;
+            x.Add(beta, f);
+         }
+      }
+
+      oper->Mult(x, r);
+      if (have_b) { subtract(b, r, r); }
+      else { r.Neg(); }
+      norm = Norm(r);
+
+      prec->Mult(r, f);
+   }
+
+   final_iter = it;
+   final_norm = norm;
+}
+
+AndersonSolver::~AndersonSolver()
+{
+   for (int i = 0; i < dx_hist.Size(); i++)
+   {
+      delete dx_hist[i];
+      delete df_hist[i];
+   }
+}
+
 void LBFGSSolver::Mult(const Vector &b, Vector &x) const
 {
    MFEM_VERIFY(oper != NULL, "the Operator is not set (use SetOperator).");
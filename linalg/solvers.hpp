@@ -29,6 +29,7 @@ namespace mfem
 {
 
 class BilinearForm;
+class FiniteElementSpace;
 
 /// Abstract base class for an iterative solver monitor
 class IterativeSolverMonitor
@@ -67,6 +68,8 @@ class IterativeSolver : public Solver
 private:
    int dot_prod_type; // 0 - local, 1 - global over 'comm'
    MPI_Comm comm;
+   /// Pending reduction started by StartDots().
+   mutable MPI_Request dot_req = MPI_REQUEST_NULL;
 #endif
 
 protected:
@@ -77,12 +80,24 @@ protected:
    int max_iter, print_level;
    double rel_tol, abs_tol;
 
+   /// Deferred-norm mode, see SetDeferredNorms().
+   bool deferred_norms = false;
+
    // stats
    mutable int final_iter, converged;
    mutable double final_norm;
 
    double Dot(const Vector &x, const Vector &y) const;
    double Norm(const Vector &x) const { return sqrt(Dot(x, x)); }
+
+   /** @brief Begin a fused reduction of @a n locally computed partial dot
+       products stored in @a dots. In MPI runs this starts a single
+       non-blocking all-reduce that can be overlapped with computation until
+       EndDots() is called; otherwise the local values are already final and
+       the call is a no-op. */
+   void StartDots(const int n, double *dots) const;
+   /// Complete the reduction started by StartDots().
+   void EndDots() const;
    void Monitor(int it, double norm, const Vector& r, const Vector& x,
                 bool final=false) const;
 
@@ -112,6 +127,20 @@ public:
    void SetMonitor(IterativeSolverMonitor &m)
    { monitor = &m; m.SetIterativeSolver(*this); }
 
+   /** @brief Enable or disable deferred convergence norms.
+
+       When enabled, solvers that support it (currently SLISolver and
+       GMRESSolver) avoid the blocking reduction performed in every iteration.
+       SLISolver starts a non-blocking reduction for the residual norm and
+       completes it only after the next iterate has been computed, so the
+       reduction overlaps the operator and preconditioner applications and
+       convergence is detected one iteration late. GMRESSolver fuses the
+       Gram-Schmidt dot products and the norm of the new basis vector into a
+       single reduction per iteration using classical (instead of modified)
+       Gram-Schmidt, which can be less robust for ill-conditioned Krylov
+       bases. Has no effect in serial runs. */
+   void SetDeferredNorms(bool defer = true) { deferred_norms = defer; }
+
 #ifdef MFEM_USE_MPI
    /** @brief Return the associated MPI communicator, or MPI_COMM_NULL if no
        communicator is set. */
@@ -160,6 +189,68 @@ private:
    const Operator *oper;
 };
 
+/// l1-scaled Jacobi smoothing for a given bilinear form (no matrix necessary).
+/** Same as OperatorJacobiSmoother, but smoothing with the l1 diagonal
+    d_i = sum_j |a_ij|, accumulated from the element matrices of the form
+    without assembling a global matrix. For SPD problems the resulting
+    iteration is convergent without damping. */
+class OperatorL1JacobiSmoother : public OperatorJacobiSmoother
+{
+public:
+   OperatorL1JacobiSmoother(BilinearForm &a,
+                            const Array<int> &ess_tdof_list,
+                            const double damping = 1.0);
+
+   /** Compute the l1 diagonal of @a a on the true dofs from its element
+       matrices. Can be used to set up the other smoothers in this family,
+       e.g. OperatorChebyshevSmoother, with l1 scaling. */
+   static Vector AssembleL1Diagonal(BilinearForm &a);
+};
+
+/// Polynomial Jacobi smoothing, no matrix necessary.
+/** Performs @a order damped Jacobi iterations with zero initial guess in
+    every application, i.e. implements the matrix polynomial
+    S = [I - (I - s D^{-1} A)^order] A^{-1} matrix-free, where s is the
+    damping factor. With order = 1 this reduces to OperatorJacobiSmoother;
+    higher orders give stronger smoothing for order-1 extra operator
+    applications per iteration. */
+class OperatorPolynomialJacobiSmoother : public Solver
+{
+public:
+   /** Setup the smoother with the diagonal of @a a obtained by calling
+       a.AssembleDiagonal(). It is assumed that the underlying operator acts
+       as the identity on entries in ess_tdof_list, corresponding to
+       (assembled) DIAG_ONE policy or ConstrainedOperator in the matrix-free
+       setting. */
+   OperatorPolynomialJacobiSmoother(BilinearForm &a,
+                                    const Array<int> &ess_tdof_list,
+                                    int order, const double damping = 1.0);
+
+   /** Application is by the *inverse* of the given vector, e.g. the l1
+       diagonal computed by OperatorL1JacobiSmoother::AssembleL1Diagonal().
+       The operator to smooth must be set with SetOperator() if order > 1. */
+   OperatorPolynomialJacobiSmoother(const Vector &d,
+                                    const Array<int> &ess_tdof_list,
+                                    int order, const double damping = 1.0);
+   ~OperatorPolynomialJacobiSmoother() {}
+
+   void Mult(const Vector &x, Vector &y) const;
+   void MultTranspose(const Vector &x, Vector &y) const { Mult(x, y); }
+   void SetOperator(const Operator &op) { oper = &op; }
+
+private:
+   const int N;
+   const int order;
+   Vector dinv;
+   const double damping;
+   const Array<int> &ess_tdof_list;
+   mutable Vector residual;
+
+   const Operator *oper;
+
+   void Setup(const Vector &diag);
+};
+
 /// Chebyshev accelerated smoothing with given vector, no matrix necessary
 /** Potentially useful with tensorized operators, for example. This is just a
     very basic Chebyshev iteration, if you want tolerances, iteration control,
@@ -201,10 +292,11 @@ public:
 
    void MultTranspose(const Vector &x, Vector &y) const { Mult(x, y); }
 
-   void SetOperator(const Operator &op_)
-   {
-      oper = &op_;
-   }
+   /** Rebind the smoother to @a op_. When the smoother was constructed with
+       an internally estimated eigenvalue, the estimate (and the Chebyshev
+       coefficients) are recomputed for the new operator; the estimate is
+       cached, so setting the same operator again is free. */
+   void SetOperator(const Operator &op_);
 
    void Setup();
 
@@ -219,6 +311,58 @@ private:
    mutable Vector residual;
    mutable Vector helperVector;
    const Operator* oper;
+
+   /// Power method parameters; power_iterations == 0 means the eigenvalue
+   /// estimate was supplied by the user and is kept on SetOperator().
+   int power_iterations;
+   double power_tolerance;
+#ifdef MFEM_USE_MPI
+   MPI_Comm power_comm;
+#endif
+
+   /// (Re)estimate the largest eigenvalue of D^{-1} 'oper' by power method.
+   void EstimateMaxEigenvalue();
+};
+
+
+/// Element-block smoothing using element matrices, no global matrix necessary.
+/** Symmetrized additive Schwarz iteration whose subdomains are the mesh
+    elements: y = s C^{-1/2} [sum_e P_e^T B_e^{-1} P_e] C^{-1/2} x, where s is
+    the damping factor and the diagonal matrix C counts the elements sharing
+    each dof. The blocks B_e are the element matrices (the same matrices the
+    ELEMENT assembly level computes, with essential dofs eliminated),
+    l1-safeguarded by adding to each diagonal entry the sum of |a_ij| over the
+    couplings of the dof outside the element, which makes the blocks SPD even
+    when the element matrices themselves are singular (e.g. for the pure
+    diffusion operator). The blocks are LU-factored once at construction. This
+    is basic element-block Jacobi iteration; for tolerances, iteration
+    control, etc. wrap with SLISolver. */
+class OperatorElementBlockSmoother : public Solver
+{
+public:
+   /** Setup the smoother for the bilinear form @a a. It is assumed that the
+       underlying operator acts as the identity on entries in ess_tdof_list,
+       corresponding to (assembled) DIAG_ONE policy or ConstrainedOperator in
+       the matrix-free setting. */
+   OperatorElementBlockSmoother(BilinearForm &a,
+                                const Array<int> &ess_tdof_list,
+                                const double damping = 1.0);
+   ~OperatorElementBlockSmoother();
+
+   void Mult(const Vector &x, Vector &y) const;
+   void MultTranspose(const Vector &x, Vector &y) const { Mult(x, y); }
+   void SetOperator(const Operator &op) { oper = &op; }
+
+private:
+   const FiniteElementSpace *fes;
+   const Operator *P; // prolongation of 'fes', NULL if identity
+   Array<DenseMatrixInverse *> elem_inv;
+   Vector scale; // damping^{1/2} C^{-1/2} on true dofs
+   const Array<int> &ess_tdof_list;
+   mutable Vector residual, corr;
+   mutable Vector r_l, y_l; // L-vector work arrays
+
+   const Operator *oper;
 };
 
 
@@ -273,6 +417,46 @@ public:
    { IterativeSolver::SetOperator(op); UpdateVectors(); }
 
    virtual void Mult(const Vector &b, Vector &x) const;
+
+   /** @brief Solve one linear system per right-hand side in @a B,
+       simultaneously.
+
+       All systems share the operator and preconditioner, whose applications
+       are grouped across the right-hand sides via Operator::ArrayMult(), and
+       the inner products of all unconverged systems are fused into a single
+       global reduction per stage. Each system runs its own CG recurrence and
+       drops out of the grouped applications once it reaches the prescribed
+       tolerance. GetConverged() reports whether all systems converged;
+       GetNumIterations() and GetFinalNorm() report the largest iteration
+       count and final norm over the systems. */
+   virtual void ArrayMult(const Array<const Vector *> &B,
+                          Array<Vector *> &X) const;
+};
+
+/// Pipelined (Ghysels-Vanroose) conjugate gradient method.
+/** Merges the two reductions of a PCG iteration into a single one and, in
+    MPI runs, overlaps it with the preconditioner and operator applications
+    via a non-blocking all-reduce. The recurrences are mathematically
+    equivalent to CGSolver but round differently, so iteration counts can
+    differ slightly. Tolerances are squared, as in CGSolver. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, mv, nv, z, q, p, s;
+
+   void UpdateVectors();
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm _comm) : IterativeSolver(_comm) { }
+#endif
+
+   virtual void SetOperator(const Operator &op)
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   virtual void Mult(const Vector &b, Vector &x) const;
 };
 
 /// Conjugate gradient method. (tolerances are squared)
@@ -292,6 +476,10 @@ class GMRESSolver : public IterativeSolver
 protected:
    int m; // see SetKDim()
 
+   /// Krylov basis and work vectors, reused between calls to Mult().
+   mutable Array<Vector *> v;
+   mutable Vector r, w;
+
 public:
    GMRESSolver() { m = 50; }
 
@@ -300,9 +488,17 @@ public:
 #endif
 
    /// Set the number of iteration to perform between restarts, default is 50.
-   void SetKDim(int dim) { m = dim; }
+   void SetKDim(int dim)
+   {
+      m = dim;
+      // release the basis vectors that are no longer needed
+      for (int i = m+1; i < v.Size(); i++) { delete v[i]; }
+      if (v.Size() > m+1) { v.SetSize(m+1); }
+   }
 
    virtual void Mult(const Vector &b, Vector &x) const;
+
+   virtual ~GMRESSolver();
 };
 
 /// FGMRES method
@@ -311,6 +507,10 @@ class FGMRESSolver : public IterativeSolver
 protected:
    int m;
 
+   /// Krylov bases and work vector, reused between calls to Mult().
+   mutable Array<Vector *> v, z;
+   mutable Vector r;
+
 public:
    FGMRESSolver() { m = 50; }
 
@@ -318,9 +518,19 @@ public:
    FGMRESSolver(MPI_Comm _comm) : IterativeSolver(_comm) { m = 50; }
 #endif
 
-   void SetKDim(int dim) { m = dim; }
+   void SetKDim(int dim)
+   {
+      m = dim;
+      // release the basis vectors that are no longer needed
+      for (int i = m+1; i < v.Size(); i++) { delete v[i]; }
+      for (int i = m+1; i < z.Size(); i++) { delete z[i]; }
+      if (v.Size() > m+1) { v.SetSize(m+1); }
+      if (z.Size() > m+1) { z.SetSize(m+1); }
+   }
 
    virtual void Mult(const Vector &b, Vector &x) const;
+
+   virtual ~FGMRESSolver();
 };
 
 /// GMRES method. (tolerances are squared)
@@ -408,11 +618,13 @@ class NewtonSolver : public IterativeSolver
 protected:
    mutable Vector r, c;
 
+   double jac_reuse_rate; // see SetJacobianReuseRate()
+
 public:
-   NewtonSolver() { }
+   NewtonSolver() { jac_reuse_rate = 0.0; }
 
 #ifdef MFEM_USE_MPI
-   NewtonSolver(MPI_Comm _comm) : IterativeSolver(_comm) { }
+   NewtonSolver(MPI_Comm _comm) : IterativeSolver(_comm) { jac_reuse_rate = 0.0; }
 #endif
    virtual void SetOperator(const Operator &op);
 
@@ -420,6 +632,16 @@ public:
    /** This method is equivalent to calling SetPreconditioner(). */
    virtual void SetSolver(Solver &solver) { prec = &solver; }
 
+   /** @brief Reuse the Jacobian from a previous iteration while the residual
+       norm is reduced by at least a factor of @a rate per iteration.
+
+       With 0.0 < @a rate < 1.0, the Jacobian is recomputed only in the first
+       iteration and whenever the observed reduction of the residual norm
+       falls behind @a rate, trading extra (cheap) iterations with a frozen
+       Jacobian for skipped gradient assemblies and solver setups. The
+       default, 0.0, recomputes the Jacobian in every iteration. */
+   void SetJacobianReuseRate(double rate) { jac_reuse_rate = rate; }
+
    /// Solve the nonlinear system with right-hand side @a b.
    /** If `b.Size() != Height()`, then @a b is assumed to be zero. */
    virtual void Mult(const Vector &b, Vector &x) const;
@@ -436,6 +658,54 @@ public:
    virtual void ProcessNewState(const Vector &x) const { }
 };
 
+/** @brief Anderson-accelerated fixed-point solver for the equation F(x)=b,
+    where F is an operator set with SetOperator().
+
+    The solver set with SetSolver() defines the underlying fixed-point
+    iteration x -> x + M(b - F(x)); Anderson mixing accelerates it by
+    combining the last m iterates (see SetHistoryDepth()) so that the
+    preconditioned residual is minimized in the least-squares sense. For
+    mildly nonlinear problems, M is typically a linear solve with a frozen
+    Jacobian, reused over the whole solve, in which case the method behaves
+    like a nonlinear GMRES with depth-m restarts. The history is kept in a
+    circular store of Vector pairs, allocated once per operator size. */
+class AndersonSolver : public IterativeSolver
+{
+protected:
+   int depth;   // see SetHistoryDepth()
+   double beta; // see SetMixingParameter()
+
+   /// Circular history of iterate and residual differences.
+   mutable Array<Vector *> dx_hist, df_hist;
+   mutable Vector r, f, x_prev, f_prev;
+
+public:
+   AndersonSolver() { depth = 4; beta = 1.0; }
+
+#ifdef MFEM_USE_MPI
+   AndersonSolver(MPI_Comm _comm)
+      : IterativeSolver(_comm) { depth = 4; beta = 1.0; }
+#endif
+
+   virtual void SetOperator(const Operator &op);
+
+   /// Set the solver defining the fixed-point map, see the class description.
+   virtual void SetSolver(Solver &solver) { prec = &solver; }
+
+   /// Set the number of previous iterates combined per step, default is 4.
+   void SetHistoryDepth(int m);
+
+   /** Set the damping parameter of the underlying fixed-point iteration,
+       default is 1.0 (no damping). */
+   void SetMixingParameter(double beta_) { beta = beta_; }
+
+   /// Solve the nonlinear system with right-hand side @a b.
+   /** If `b.Size() != Height()`, then @a b is assumed to be zero. */
+   virtual void Mult(const Vector &b, Vector &x) const;
+
+   virtual ~AndersonSolver();
+};
+
 /** L-BFGS method for solving F(x)=b for a given operator F, by minimizing
     the norm of F(x) - b. Requires only the action of the operator F. */
 class LBFGSSolver : public NewtonSolver
@@ -12,6 +12,7 @@
 // Implementation of sparse matrix
 
 #include "linalg.hpp"
+#include "simd.hpp"
 #include "../general/forall.hpp"
 #include "../general/table.hpp"
 #include "../general/sort_pairs.hpp"
@@ -70,6 +71,8 @@ SparseMatrix::SparseMatrix(int nrows, int ncols)
    NodesMem = new RowNodeAlloc;
 #endif
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -89,6 +92,8 @@ SparseMatrix::SparseMatrix(int *i, int *j, double *data, int m, int n)
    NodesMem = NULL;
 #endif
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -122,6 +127,8 @@ SparseMatrix::SparseMatrix(int *i, int *j, double *data, int m, int n,
       }
    }
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -145,6 +152,8 @@ SparseMatrix::SparseMatrix(int nrows, int ncols, int rowsize)
       I[i] = i * rowsize;
    }
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -212,6 +221,8 @@ SparseMatrix::SparseMatrix(const SparseMatrix &mat, bool copy_graph)
    At = NULL;
    isSorted = mat.isSorted;
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -241,6 +252,8 @@ SparseMatrix::SparseMatrix(const Vector &v)
       A[r] = v[r];
    }
 
+   ResetCachedLayouts();
+
    InitCuSparse();
 }
 
@@ -277,6 +290,7 @@ void SparseMatrix::SetEmpty()
    ColPtrJ = NULL;
    ColPtrNode = NULL;
    At = NULL;
+   ResetCachedLayouts();
 #ifdef MFEM_USE_MEMALLOC
    NodesMem = NULL;
 #endif
@@ -625,6 +639,12 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const double a) const
       return;
    }
 
+   if (!sellI.Empty() && Device::IsDisabled())
+   {
+      AddMultSIMD(x, y, a);
+      return;
+   }
+
 #ifndef MFEM_USE_LEGACY_OPENMP
    const int height = this->height;
    const int nnz = J.Capacity();
@@ -718,6 +738,81 @@ void SparseMatrix::AddMult(const Vector &x, Vector &y, const double a) const
 #endif
 }
 
+void SparseMatrix::MultMulti(const DenseMatrix &X, DenseMatrix &Y) const
+{
+   Y = 0.0;
+   AddMultMulti(X, Y);
+}
+
+void SparseMatrix::AddMultMulti(const DenseMatrix &X, DenseMatrix &Y,
+                                const double a) const
+{
+   MFEM_ASSERT(width == X.Height(), "Input block height (" << X.Height()
+               << ") must match matrix width (" << width << ")");
+   MFEM_ASSERT(height == Y.Height(), "Output block height (" << Y.Height()
+               << ") must match matrix height (" << height << ")");
+   MFEM_ASSERT(X.Width() == Y.Width(), "Input block width (" << X.Width()
+               << ") must match output block width (" << Y.Width() << ")");
+   MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
+
+   const int nv = X.Width();
+   const int nnz = J.Capacity();
+   const int *Ip = HostRead(I, height+1);
+   const int *Jp = HostRead(J, nnz);
+   const double *Ap = HostRead(A, nnz);
+   const double *xp = X.Data();
+   double *yp = Y.Data();
+
+   // Process the right-hand sides four at a time so that each row of the
+   // matrix, once loaded, is applied to the whole block of vectors.
+   int v = 0;
+   for ( ; v + 4 <= nv; v += 4)
+   {
+      const double *x0 = xp + (v+0)*width;
+      const double *x1 = xp + (v+1)*width;
+      const double *x2 = xp + (v+2)*width;
+      const double *x3 = xp + (v+3)*width;
+      double *y0 = yp + (v+0)*height;
+      double *y1 = yp + (v+1)*height;
+      double *y2 = yp + (v+2)*height;
+      double *y3 = yp + (v+3)*height;
+      for (int i = 0; i < height; i++)
+      {
+         double d0 = 0.0, d1 = 0.0, d2 = 0.0, d3 = 0.0;
+         const int end = Ip[i+1];
+         for (int j = Ip[i]; j < end; j++)
+         {
+            const double Aj = Ap[j];
+            const int Jj = Jp[j];
+            d0 += Aj * x0[Jj];
+            d1 += Aj * x1[Jj];
+            d2 += Aj * x2[Jj];
+            d3 += Aj * x3[Jj];
+         }
+         y0[i] += a * d0;
+         y1[i] += a * d1;
+         y2[i] += a * d2;
+         y3[i] += a * d3;
+      }
+   }
+   // Remainder columns, one vector at a time.
+   for ( ; v < nv; v++)
+   {
+      const double *xv = xp + v*width;
+      double *yv = yp + v*height;
+      for (int i = 0; i < height; i++)
+      {
+         double d = 0.0;
+         const int end = Ip[i+1];
+         for (int j = Ip[i]; j < end; j++)
+         {
+            d += Ap[j] * xv[Jp[j]];
+         }
+         yv[i] += a * d;
+      }
+   }
+}
+
 void SparseMatrix::MultTranspose(const Vector &x, Vector &y) const
 {
    if (Finalized()) { y.UseDevice(true); }
@@ -753,6 +848,10 @@ void SparseMatrix::AddMultTranspose(const Vector &x, Vector &y,
    {
       At->AddMult(x, y, a);
    }
+   else if (!cscI.Empty() && Device::IsDisabled())
+   {
+      AddMultTransposeCSC(x, y, a);
+   }
    else
    {
       MFEM_VERIFY(Device::IsDisabled(), "transpose action on device is not "
@@ -784,6 +883,162 @@ void SparseMatrix::ResetTranspose() const
    At = NULL;
 }
 
+void SparseMatrix::BuildTransposeView() const
+{
+   MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
+   if (!cscI.Empty()) { return; }
+
+   const int *Ip = HostRead(I, height+1);
+   const int nnz = Ip[height];
+   const int *Jp = HostRead(J, nnz);
+
+   cscI.New(width+1);
+   int *cIp = cscI;
+   for (int c = 0; c <= width; c++) { cIp[c] = 0; }
+   for (int k = 0; k < nnz; k++) { cIp[Jp[k]+1]++; }
+   for (int c = 0; c < width; c++) { cIp[c+1] += cIp[c]; }
+
+   cscRow.New(nnz);
+   cscPerm.New(nnz);
+   int *cRp = cscRow;
+   int *cPp = cscPerm;
+   for (int i = 0; i < height; i++)
+   {
+      for (int k = Ip[i]; k < Ip[i+1]; k++)
+      {
+         const int pos = cIp[Jp[k]]++;
+         cRp[pos] = i;
+         cPp[pos] = k;
+      }
+   }
+   // Restore the column offsets shifted by the counting pass above.
+   for (int c = width; c > 0; c--) { cIp[c] = cIp[c-1]; }
+   cIp[0] = 0;
+}
+
+void SparseMatrix::ResetTransposeView() const
+{
+   cscI.Delete(); cscI.Reset();
+   cscRow.Delete(); cscRow.Reset();
+   cscPerm.Delete(); cscPerm.Reset();
+}
+
+void SparseMatrix::AddMultTransposeCSC(const Vector &x, Vector &y,
+                                       const double a) const
+{
+   const int *cIp = cscI;
+   const int *cRp = cscRow;
+   const int *cPp = cscPerm;
+   const double *Ap = HostRead(A, J.Capacity());
+   const double *xp = x.HostRead();
+   double *yp = y.HostReadWrite();
+
+   // The CSC view turns the row-wise scatter of the reference path into a
+   // race-free gather over the columns of the matrix.
+   for (int c = 0; c < width; c++)
+   {
+      double d = 0.0;
+      const int end = cIp[c+1];
+      for (int k = cIp[c]; k < end; k++)
+      {
+         d += Ap[cPp[k]] * xp[cRp[k]];
+      }
+      yp[c] += a * d;
+   }
+}
+
+void SparseMatrix::BuildSIMDLayout() const
+{
+   MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
+   if (!sellI.Empty()) { return; }
+
+   static const int C = MFEM_SIMD_BYTES/sizeof(double);
+   const int *Ip = HostRead(I, height+1);
+   const int nnz = Ip[height];
+   const int *Jp = HostRead(J, nnz);
+   const double *Ap = HostRead(A, nnz);
+   const int nchunks = (height + C - 1)/C;
+
+   // Chunk offsets: each chunk is padded to its longest row.
+   sellI.New(nchunks+1);
+   int *sIp = sellI;
+   sIp[0] = 0;
+   for (int c = 0; c < nchunks; c++)
+   {
+      const int rend = std::min(height, (c+1)*C);
+      int w = 0;
+      for (int r = c*C; r < rend; r++)
+      {
+         w = std::max(w, Ip[r+1] - Ip[r]);
+      }
+      sIp[c+1] = sIp[c] + w*C;
+   }
+
+   // Fill the lane-interleaved values and indices; padded entries get a zero
+   // value and a (safe) zero column index.
+   const int nnz_pad = sIp[nchunks];
+   sellJ.New(nnz_pad);
+   sellA.New(nnz_pad);
+   int *sJp = sellJ;
+   double *sAp = sellA;
+   for (int c = 0; c < nchunks; c++)
+   {
+      const int base = sIp[c];
+      const int w = (sIp[c+1] - base)/C;
+      for (int l = 0; l < C; l++)
+      {
+         const int r = c*C + l;
+         const int rs = (r < height) ? Ip[r] : 0;
+         const int rw = (r < height) ? Ip[r+1] - Ip[r] : 0;
+         for (int s = 0; s < w; s++)
+         {
+            const int k = base + s*C + l;
+            sJp[k] = (s < rw) ? Jp[rs+s] : 0;
+            sAp[k] = (s < rw) ? Ap[rs+s] : 0.0;
+         }
+      }
+   }
+}
+
+void SparseMatrix::ClearSIMDLayout() const
+{
+   sellI.Delete(); sellI.Reset();
+   sellJ.Delete(); sellJ.Reset();
+   sellA.Delete(); sellA.Reset();
+}
+
+void SparseMatrix::AddMultSIMD(const Vector &x, Vector &y, const double a) const
+{
+   static const int C = MFEM_SIMD_BYTES/sizeof(double);
+   typedef AutoSIMD<double, C, MFEM_SIMD_BYTES> vreal_t;
+
+   const int nchunks = (height + C - 1)/C;
+   const int *sIp = sellI;
+   const int *sJp = sellJ;
+   const double *sAp = sellA;
+   const double *xp = x.HostRead();
+   double *yp = y.HostReadWrite();
+
+   for (int c = 0; c < nchunks; c++)
+   {
+      const int base = sIp[c];
+      const int w = (sIp[c+1] - base)/C;
+      vreal_t d;
+      d = 0.0;
+      for (int s = 0; s < w; s++)
+      {
+         const double *Ac = sAp + base + s*C;
+         const int *Jc = sJp + base + s*C;
+         vreal_t av, xv;
+         MFEM_VECTORIZE_LOOP
+         for (int l = 0; l < C; l++) { av[l] = Ac[l]; xv[l] = xp[Jc[l]]; }
+         d.fma(av, xv);
+      }
+      const int rend = std::min(C, height - c*C);
+      for (int l = 0; l < rend; l++) { yp[c*C + l] += a*d[l]; }
+   }
+}
+
 void SparseMatrix::PartMult(
    const Array<int> &rows, const Vector &x, Vector &y) const
 {
@@ -1378,6 +1633,20 @@ int SparseMatrix::NumNonZeroElems() const
    }
 }
 
+long SparseMatrix::MemoryUsage() const
+{
+   if (A != NULL)  // matrix is finalized
+   {
+      return (height + 1)*(long)sizeof(int) +
+             NumNonZeroElems()*(long)(sizeof(int) + sizeof(double));
+   }
+   else
+   {
+      return height*(long)sizeof(RowNode*) +
+             NumNonZeroElems()*(long)sizeof(RowNode);
+   }
+}
+
 double SparseMatrix::MaxNorm() const
 {
    double m = 0.0;
@@ -3130,6 +3399,12 @@ void SparseMatrix::Destroy()
    I.Delete();
    J.Delete();
    A.Delete();
+   cscI.Delete();
+   cscRow.Delete();
+   cscPerm.Delete();
+   sellI.Delete();
+   sellJ.Delete();
+   sellA.Delete();
 
    if (Rows != NULL)
    {
@@ -3339,71 +3614,71 @@ SparseMatrix *TransposeAbstractSparseMatrix (const AbstractSparseMatrix &A,
 SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
                     SparseMatrix *OAB)
 {
-   int nrowsA, ncolsA, nrowsB, ncolsB;
-   const int *A_i, *A_j, *B_i, *B_j;
-   int *C_i, *C_j, *B_marker;
-   const double *A_data, *B_data;
-   double *C_data;
-   int ia, ib, ic, ja, jb, num_nonzeros;
-   int row_start, counter;
-   double a_entry, b_entry;
    SparseMatrix *C;
+   int *C_i, *C_j;
+   double *C_data;
 
-   nrowsA = A.Height();
-   ncolsA = A.Width();
-   nrowsB = B.Height();
-   ncolsB = B.Width();
+   const int nrowsA = A.Height();
+   const int ncolsA = A.Width();
+   const int nrowsB = B.Height();
+   const int ncolsB = B.Width();
 
    MFEM_VERIFY(ncolsA == nrowsB,
                "number of columns of A (" << ncolsA
                << ") must equal number of rows of B (" << nrowsB << ")");
 
-   A_i    = A.GetI();
-   A_j    = A.GetJ();
-   A_data = A.GetData();
-   B_i    = B.GetI();
-   B_j    = B.GetJ();
-   B_data = B.GetData();
-
-   B_marker = new int[ncolsB];
-
-   for (ib = 0; ib < ncolsB; ib++)
-   {
-      B_marker[ib] = -1;
-   }
+   const int *A_i    = A.GetI();
+   const int *A_j    = A.GetJ();
+   const double *A_data = A.GetData();
+   const int *B_i    = B.GetI();
+   const int *B_j    = B.GetJ();
+   const double *B_data = B.GetData();
 
    if (OAB == NULL)
    {
       C_i = Memory<int>(nrowsA+1);
+      C_i[0] = 0;
 
-      C_i[0] = num_nonzeros = 0;
-      for (ic = 0; ic < nrowsA; ic++)
+      // Symbolic pass: the rows of C are independent, so they are counted in
+      // parallel, each thread merging with its own marker array.
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel
+#endif
       {
-         for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+         Array<int> B_marker(ncolsB);
+         B_marker = -1;
+#ifdef MFEM_USE_OPENMP
+         #pragma omp for
+#endif
+         for (int ic = 0; ic < nrowsA; ic++)
          {
-            ja = A_j[ia];
-            for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+            int row_nnz = 0;
+            for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
             {
-               jb = B_j[ib];
-               if (B_marker[jb] != ic)
+               const int ja = A_j[ia];
+               for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
                {
-                  B_marker[jb] = ic;
-                  num_nonzeros++;
+                  const int jb = B_j[ib];
+                  if (B_marker[jb] != ic)
+                  {
+                     B_marker[jb] = ic;
+                     row_nnz++;
+                  }
                }
             }
+            C_i[ic+1] = row_nnz;
          }
-         C_i[ic+1] = num_nonzeros;
       }
+      for (int ic = 0; ic < nrowsA; ic++)
+      {
+         C_i[ic+1] += C_i[ic];
+      }
+      const int num_nonzeros = C_i[nrowsA];
 
       C_j    = Memory<int>(num_nonzeros);
       C_data = Memory<double>(num_nonzeros);
 
       C = new SparseMatrix(C_i, C_j, C_data, nrowsA, ncolsB);
-
-      for (ib = 0; ib < ncolsB; ib++)
-      {
-         B_marker[ib] = -1;
-      }
    }
    else
    {
@@ -3416,50 +3691,61 @@ SparseMatrix *Mult (const SparseMatrix &A, const SparseMatrix &B,
                   << " ncolsB = " << ncolsB
                   << ", C->Width() = " << C->Width());
 
-      // C_i    = C -> GetI(); // not used
+      C_i    = C -> GetI();
       C_j    = C -> GetJ();
       C_data = C -> GetData();
    }
 
-   counter = 0;
-   for (ic = 0; ic < nrowsA; ic++)
+   // Numeric pass, reusing the row offsets C_i computed (or given) above.
+   // The entries of each row are produced in merge-discovery order, the same
+   // order in which the symbolic pass counted them, so with a pre-allocated
+   // output matrix the existing sparsity pattern is filled in place.
+   int mismatch = 0;
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel reduction(+:mismatch)
+#endif
    {
-      // row_start = C_i[ic];
-      row_start = counter;
-      for (ia = A_i[ic]; ia < A_i[ic+1]; ia++)
+      Array<int> B_marker(ncolsB);
+      B_marker = -1;
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for
+#endif
+      for (int ic = 0; ic < nrowsA; ic++)
       {
-         ja = A_j[ia];
-         a_entry = A_data[ia];
-         for (ib = B_i[ja]; ib < B_i[ja+1]; ib++)
+         const int row_start = C_i[ic];
+         int counter = row_start;
+         for (int ia = A_i[ic]; ia < A_i[ic+1]; ia++)
          {
-            jb = B_j[ib];
-            b_entry = B_data[ib];
-            if (B_marker[jb] < row_start)
+            const int ja = A_j[ia];
+            const double a_entry = A_data[ia];
+            for (int ib = B_i[ja]; ib < B_i[ja+1]; ib++)
             {
-               B_marker[jb] = counter;
-               if (OAB == NULL)
+               const int jb = B_j[ib];
+               const double b_entry = B_data[ib];
+               if (B_marker[jb] < row_start)
                {
-                  C_j[counter] = jb;
+                  B_marker[jb] = counter;
+                  if (OAB == NULL)
+                  {
+                     C_j[counter] = jb;
+                  }
+                  C_data[counter] = a_entry*b_entry;
+                  counter++;
+               }
+               else
+               {
+                  C_data[B_marker[jb]] += a_entry*b_entry;
                }
-               C_data[counter] = a_entry*b_entry;
-               counter++;
-            }
-            else
-            {
-               C_data[B_marker[jb]] += a_entry*b_entry;
             }
          }
+         if (counter != C_i[ic+1]) { mismatch++; }
       }
    }
 
    MFEM_VERIFY(
-      OAB == NULL || counter == OAB->NumNonZeroElems(),
-      "With pre-allocated output matrix, number of non-zeros ("
-      << OAB->NumNonZeroElems()
-      << ") did not match number of entries changed from matrix-matrix multiply, "
-      << counter);
-
-   delete [] B_marker;
+      OAB == NULL || mismatch == 0,
+      "With pre-allocated output matrix, the sparsity pattern did not match"
+      " the product in " << mismatch << " row(s)");
 
    return C;
 }
@@ -3891,6 +4177,12 @@ void SparseMatrix::Swap(SparseMatrix &other)
    mfem::Swap(ColPtrJ, other.ColPtrJ);
    mfem::Swap(ColPtrNode, other.ColPtrNode);
    mfem::Swap(At, other.At);
+   mfem::Swap(cscI, other.cscI);
+   mfem::Swap(cscRow, other.cscRow);
+   mfem::Swap(cscPerm, other.cscPerm);
+   mfem::Swap(sellI, other.sellI);
+   mfem::Swap(sellJ, other.sellJ);
+   mfem::Swap(sellA, other.sellA);
 
 #ifdef MFEM_USE_MEMALLOC
    mfem::Swap(NodesMem, other.NodesMem);
@@ -75,6 +75,29 @@ protected:
    /// Transpose of A. Owned. Used to perform MultTranspose() on devices.
    mutable SparseMatrix *At;
 
+   /// @name Index-only CSC view of the matrix, used by AddMultTranspose().
+   /** Built on demand by BuildTransposeView(). The values are not duplicated:
+       #cscPerm maps each CSC position to its index in the #A array, so the
+       transpose action costs two index arrays instead of a full copy of the
+       matrix as made by BuildTranspose(). */
+   ///@{
+   mutable Memory<int> cscI;    ///< Column offsets, size #width+1.
+   mutable Memory<int> cscRow;  ///< Row indices, size #I[#height].
+   mutable Memory<int> cscPerm; ///< Positions in #A, size #I[#height].
+   ///@}
+
+   /// @name Opt-in padded-row (SELL-type) copy of the CSR arrays.
+   /** Built on demand by BuildSIMDLayout() and used by the vectorized host
+       kernel in AddMult(). Rows are grouped in chunks of the SIMD width and
+       padded to the longest row in the chunk, with values and column indices
+       interleaved chunk-wise so that consecutive lanes read consecutive
+       memory. */
+   ///@{
+   mutable Memory<int> sellI; ///< Chunk offsets, size height/chunk + 1.
+   mutable Memory<int> sellJ; ///< Padded, lane-interleaved column indices.
+   mutable Memory<double> sellA; ///< Padded, lane-interleaved values.
+   ///@}
+
 #ifdef MFEM_USE_MEMALLOC
    typedef MemAlloc <RowNode, 1024> RowNodeAlloc;
    RowNodeAlloc * NodesMem;
@@ -86,6 +109,19 @@ protected:
    void Destroy();   // Delete all owned data
    void SetEmpty();  // Init all entries with empty values
 
+   /// Init the cached CSC and padded-row layouts with empty values.
+   void ResetCachedLayouts() const
+   {
+      cscI.Reset(); cscRow.Reset(); cscPerm.Reset();
+      sellI.Reset(); sellJ.Reset(); sellA.Reset();
+   }
+
+   /// Vectorized host kernel: y += a * A * x using the padded-row layout.
+   void AddMultSIMD(const Vector &x, Vector &y, const double a) const;
+
+   /// Host kernel: y += a * At * x using the index-only CSC view.
+   void AddMultTransposeCSC(const Vector &x, Vector &y, const double a) const;
+
    bool useCuSparse{true}; // Use cuSPARSE if available
 
    // Initialize cuSPARSE
@@ -262,6 +298,10 @@ public:
    /*! This method can be called for matrices finalized or not. */
    int ActualWidth() const;
 
+   /// Returns the number of bytes used by the matrix data.
+   /*! This method can be called for matrices finalized or not. */
+   long MemoryUsage() const;
+
    /// Sort the column indices corresponding to each row.
    void SortColumnIndices();
 
@@ -302,6 +342,17 @@ public:
    /// y += A * x (default)  or  y += a * A * x
    void AddMult(const Vector &x, Vector &y, const double a = 1.0) const;
 
+   /** @brief Block matrix-vector product: Y = A X, where the columns of the
+       width x k matrix @a X are multiplied simultaneously. */
+   /** The rows of the matrix are streamed once per block of right-hand sides,
+       so applying the matrix to many vectors is significantly cheaper than k
+       separate calls to Mult(). Requires a finalized (CSR) matrix. */
+   void MultMulti(const DenseMatrix &X, DenseMatrix &Y) const;
+
+   /// Block version of AddMult(): Y += a * A * X, column by column.
+   void AddMultMulti(const DenseMatrix &X, DenseMatrix &Y,
+                     const double a = 1.0) const;
+
    /// Multiply a vector with the transposed matrix. y = At * x
    void MultTranspose(const Vector &x, Vector &y) const;
 
@@ -334,6 +385,42 @@ public:
        more details. */
    void ResetTranspose() const;
 
+   /** @brief Build an index-only CSC view of the matrix which will be used by
+       AddMultTranspose() and MultTranspose() on the host. */
+   /** Unlike BuildTranspose(), the values of the matrix are not copied: a
+       one-time pass builds column offsets, row indices, and a permutation
+       into the value array, so the transpose action becomes a gather over
+       columns with roughly half the memory overhead of an explicit transpose.
+       The view takes precedence only when the internal transpose from
+       BuildTranspose() is not present.
+
+       Warning: changing the sparsity pattern of this matrix invalidates the
+       view; call ResetTransposeView() to drop it. Value-only changes remain
+       valid since the view references #A by position.
+       This method can only be used when the sparse matrix is finalized. */
+   void BuildTransposeView() const;
+
+   /** Reset (destroy) the internal CSC view. See BuildTransposeView() for
+       more details. */
+   void ResetTransposeView() const;
+
+   /** @brief Build an internal padded-row (SELL-type) layout which will be
+       used by a vectorized row kernel in Mult() and AddMult() on the host. */
+   /** Rows are grouped in chunks of the SIMD width (see MFEM_SIMD_BYTES) and
+       padded with explicit zeros to the longest row in each chunk, which
+       allows the row products of a whole chunk to be computed with the
+       AutoSIMD types. The extra storage is bounded by the row-length
+       variation within each chunk.
+
+       Warning: any changes in this matrix will invalidate the alternative
+       layout; call ClearSIMDLayout() and this method again to rebuild it.
+       This method can only be used when the sparse matrix is finalized. */
+   void BuildSIMDLayout() const;
+
+   /** Reset (destroy) the internal padded-row layout. See BuildSIMDLayout()
+       for more details. */
+   void ClearSIMDLayout() const;
+
    void PartMult(const Array<int> &rows, const Vector &x, Vector &y) const;
    void PartAddMult(const Array<int> &rows, const Vector &x, Vector &y,
                     const double a=1.0) const;
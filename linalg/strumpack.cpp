@@ -121,6 +121,7 @@ void STRUMPACKSolver::Init( int argc, char* argv[] )
 
    factor_verbose_ = false;
    solve_verbose_ = false;
+   reuse_symbolic_ = false;
 
    solver_ = new StrumpackSparseSolverMPIDist<double,int>(comm_, argc, argv,
                                                           false);
@@ -190,6 +191,11 @@ void STRUMPACKSolver::SetAbsTol( double atol )
    solver_->options().set_abs_tol( atol );
 }
 
+void STRUMPACKSolver::SetReuseSymbolicFactorization( bool reuse )
+{
+   reuse_symbolic_ = reuse;
+}
+
 
 void STRUMPACKSolver::Mult( const Vector & x, Vector & y ) const
 {
@@ -228,12 +234,27 @@ void STRUMPACKSolver::Mult( const Vector & x, Vector & y ) const
 void STRUMPACKSolver::SetOperator( const Operator & op )
 {
    // Verify that we have a compatible operator
-   APtr_ = dynamic_cast<const STRUMPACKRowLocMatrix*>(&op);
-   if ( APtr_ == NULL )
+   const STRUMPACKRowLocMatrix * APtr =
+      dynamic_cast<const STRUMPACKRowLocMatrix*>(&op);
+   if ( APtr == NULL )
    {
       mfem_error("STRUMPACKSolver::SetOperator : not STRUMPACKRowLocMatrix!");
    }
 
+#if STRUMPACK_VERSION_MAJOR >= 4
+   if ( reuse_symbolic_ && APtr_ != NULL &&
+        op.Height() == height && op.Width() == width )
+   {
+      // Values-only update: the symbolic analysis and reordering of the
+      // current factorization are reused, only the numerical factorization
+      // is redone by the next Mult(), see SetReuseSymbolicFactorization()
+      APtr_ = APtr;
+      solver_->update_matrix_values( *(APtr_->getA()) );
+      return;
+   }
+#endif
+   APtr_ = APtr;
+
    solver_->set_matrix( *(APtr_->getA()) );
 
    // Set mfem::Operator member data
@@ -92,6 +92,16 @@ public:
    void SetRelTol( double rtol );
    void SetAbsTol( double atol );
 
+   /**
+    * Indicate that the matrices passed to subsequent SetOperator() calls keep
+    * the sparsity pattern of the current one, only the values changing, as in
+    * quasi-static runs. When enabled, the symbolic analysis and reordering of
+    * the current factorization are reused and only the numerical
+    * factorization is redone by the next Mult(). Requires STRUMPACK 4 or
+    * later; with older versions the full setup is repeated.
+    */
+   void SetReuseSymbolicFactorization( bool reuse );
+
    /**
     * STRUMPACK is an (approximate) direct solver. It can be used as a direct
     * solver or as a preconditioner. To use STRUMPACK as only a preconditioner,
@@ -157,6 +167,7 @@ protected:
 
    bool factor_verbose_;
    bool solve_verbose_;
+   bool reuse_symbolic_; // see SetReuseSymbolicFactorization()
 
    const STRUMPACKRowLocMatrix * APtr_;
    strumpack::StrumpackSparseSolverMPIDist<double,int> * solver_;
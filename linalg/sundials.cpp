@@ -240,6 +240,7 @@ void SundialsNVector::_SetDataAndSize_()
          size = NV_LENGTH_S(local_x);
          data.Wrap(NV_DATA_S(local_x), size, false);
          if (known) { data.ClearOwnerFlags(); }
+         bound_h_ptr = NV_DATA_S(local_x);
          break;
       }
 #ifdef MFEM_USE_CUDA
@@ -252,6 +253,7 @@ void SundialsNVector::_SetDataAndSize_()
          data.Wrap(h_ptr, d_ptr, size, Device::GetHostMemoryType(), false);
          if (known) { data.ClearOwnerFlags(); }
          UseDevice(true);
+         bound_h_ptr = h_ptr;
          break;
       }
 #endif
@@ -262,6 +264,7 @@ void SundialsNVector::_SetDataAndSize_()
          size = NV_LENGTH_S(x);
          data.Wrap(NV_DATA_P(x), NV_LOCLENGTH_P(x), false);
          if (known) { data.ClearOwnerFlags(); }
+         bound_h_ptr = NV_DATA_P(x);
          break;
       }
 #endif
@@ -270,6 +273,56 @@ void SundialsNVector::_SetDataAndSize_()
    }
 }
 
+void SundialsNVector::MakeRef(N_Vector nv)
+{
+   if (x == nv && bound_h_ptr != NULL)
+   {
+#ifdef MFEM_USE_MPI
+      N_Vector local_x = MPIPlusX() ? N_VGetLocalVector_MPIPlusX(x) : x;
+#else
+      N_Vector local_x = x;
+#endif
+      const N_Vector_ID id = N_VGetVectorID(local_x);
+      // Fast path for persistent wrappers: when the data of the N_Vector did
+      // not move since the last binding, reuse the existing memory
+      // registration and only reset the validity flags to the state that a
+      // fresh wrap would produce.
+      if (id == SUNDIALS_NVEC_SERIAL &&
+          NV_DATA_S(local_x) == bound_h_ptr && NV_LENGTH_S(local_x) == size)
+      {
+         HostWrite();
+         return;
+      }
+#ifdef MFEM_USE_CUDA
+      if (id == SUNDIALS_NVEC_CUDA &&
+          N_VGetHostArrayPointer_Cuda(local_x) == bound_h_ptr &&
+          (int)N_VGetLength_Cuda(local_x) == size)
+      {
+         Write(true);
+         return;
+      }
+#endif
+#ifdef MFEM_USE_MPI
+      if (id == SUNDIALS_NVEC_PARALLEL &&
+          NV_DATA_P(x) == bound_h_ptr && NV_LOCLENGTH_P(x) == size)
+      {
+         HostWrite();
+         return;
+      }
+#endif
+   }
+   if (own_NVector)
+   {
+#ifdef MFEM_USE_MPI
+      if (MPIPlusX()) { N_VDestroy(N_VGetLocalVector_MPIPlusX(x)); }
+#endif
+      N_VDestroy(x);
+      own_NVector = 0;
+   }
+   x = nv;
+   _SetDataAndSize_();
+}
+
 SundialsNVector::SundialsNVector()
    : Vector()
 {
@@ -457,12 +510,15 @@ static int LSFree(SUNLinearSolver LS)
 int CVODESolver::RHS(realtype t, const N_Vector y, N_Vector ydot,
                      void *user_data)
 {
-   // At this point the up-to-date data for N_Vector y and ydot is on the device.
-   const SundialsNVector mfem_y(y);
-   SundialsNVector mfem_ydot(ydot);
-
    CVODESolver *self = static_cast<CVODESolver*>(user_data);
 
+   // At this point the up-to-date data for N_Vector y and ydot is on the
+   // device. Rebind the persistent wrappers instead of creating new ones.
+   SundialsNVector &mfem_y = self->wrap1;
+   SundialsNVector &mfem_ydot = self->wrap2;
+   mfem_y.MakeRef(y);
+   mfem_ydot.MakeRef(ydot);
+
    // Compute y' = f(t, y)
    self->f->SetTime(t);
    self->f->Mult(mfem_y, mfem_ydot);
@@ -495,11 +551,14 @@ int CVODESolver::LinSysSetup(realtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                              booleantype jok, booleantype *jcur, realtype gamma,
                              void*, N_Vector, N_Vector, N_Vector)
 {
-   // Get data from N_Vectors
-   const SundialsNVector mfem_y(y);
-   const SundialsNVector mfem_fy(fy);
    CVODESolver *self = static_cast<CVODESolver*>(GET_CONTENT(A));
 
+   // Get data from N_Vectors, reusing the persistent wrappers
+   SundialsNVector &mfem_y = self->wrap1;
+   SundialsNVector &mfem_fy = self->wrap2;
+   mfem_y.MakeRef(y);
+   mfem_fy.MakeRef(fy);
+
    // Compute the linear system
    self->f->SetTime(t);
    return (self->f->SUNImplicitSetup(mfem_y, mfem_fy, jok, jcur, gamma));
@@ -508,9 +567,11 @@ int CVODESolver::LinSysSetup(realtype t, N_Vector y, N_Vector fy, SUNMatrix A,
 int CVODESolver::LinSysSolve(SUNLinearSolver LS, SUNMatrix, N_Vector x,
                              N_Vector b, realtype tol)
 {
-   SundialsNVector mfem_x(x);
-   const SundialsNVector mfem_b(b);
    CVODESolver *self = static_cast<CVODESolver*>(GET_CONTENT(LS));
+   SundialsNVector &mfem_x = self->wrap1;
+   SundialsNVector &mfem_b = self->wrap2;
+   mfem_x.MakeRef(x);
+   mfem_b.MakeRef(b);
    // Solve the linear system
    return (self->f->SUNImplicitSolve(mfem_b, mfem_x, tol));
 }
@@ -1161,11 +1222,14 @@ CVODESSolver::~CVODESSolver()
 int ARKStepSolver::RHS1(realtype t, const N_Vector y, N_Vector ydot,
                         void *user_data)
 {
-   // Get data from N_Vectors
-   const SundialsNVector mfem_y(y);
-   SundialsNVector mfem_ydot(ydot);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(user_data);
 
+   // Get data from N_Vectors, reusing the persistent wrappers
+   SundialsNVector &mfem_y = self->wrap1;
+   SundialsNVector &mfem_ydot = self->wrap2;
+   mfem_y.MakeRef(y);
+   mfem_ydot.MakeRef(ydot);
+
    // Compute f(t, y) in y' = f(t, y) or fe(t, y) in y' = fe(t, y) + fi(t, y)
    self->f->SetTime(t);
    if (self->rk_type == IMEX)
@@ -1181,11 +1245,14 @@ int ARKStepSolver::RHS1(realtype t, const N_Vector y, N_Vector ydot,
 int ARKStepSolver::RHS2(realtype t, const N_Vector y, N_Vector ydot,
                         void *user_data)
 {
-   // Get data from N_Vectors
-   const SundialsNVector mfem_y(y);
-   SundialsNVector mfem_ydot(ydot);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(user_data);
 
+   // Get data from N_Vectors, reusing the persistent wrappers
+   SundialsNVector &mfem_y = self->wrap1;
+   SundialsNVector &mfem_ydot = self->wrap2;
+   mfem_y.MakeRef(y);
+   mfem_ydot.MakeRef(ydot);
+
    // Compute fi(t, y) in y' = fe(t, y) + fi(t, y)
    self->f->SetTime(t);
    self->f->SetEvalMode(TimeDependentOperator::ADDITIVE_TERM_2);
@@ -1200,11 +1267,14 @@ int ARKStepSolver::LinSysSetup(realtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                                realtype gamma,
                                void*, N_Vector, N_Vector, N_Vector)
 {
-   // Get data from N_Vectors
-   const SundialsNVector mfem_y(y);
-   const SundialsNVector mfem_fy(fy);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(GET_CONTENT(A));
 
+   // Get data from N_Vectors, reusing the persistent wrappers
+   SundialsNVector &mfem_y = self->wrap1;
+   SundialsNVector &mfem_fy = self->wrap2;
+   mfem_y.MakeRef(y);
+   mfem_fy.MakeRef(fy);
+
    // Compute the linear system
    self->f->SetTime(t);
    if (self->rk_type == IMEX)
@@ -1217,9 +1287,11 @@ int ARKStepSolver::LinSysSetup(realtype t, N_Vector y, N_Vector fy, SUNMatrix A,
 int ARKStepSolver::LinSysSolve(SUNLinearSolver LS, SUNMatrix, N_Vector x,
                                N_Vector b, realtype tol)
 {
-   SundialsNVector mfem_x(x);
-   const SundialsNVector mfem_b(b);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(GET_CONTENT(LS));
+   SundialsNVector &mfem_x = self->wrap1;
+   SundialsNVector &mfem_b = self->wrap2;
+   mfem_x.MakeRef(x);
+   mfem_b.MakeRef(b);
 
    // Solve the linear system
    if (self->rk_type == IMEX)
@@ -1242,9 +1314,11 @@ int ARKStepSolver::MassSysSetup(realtype t, SUNMatrix M,
 int ARKStepSolver::MassSysSolve(SUNLinearSolver LS, SUNMatrix, N_Vector x,
                                 N_Vector b, realtype tol)
 {
-   SundialsNVector mfem_x(x);
-   const SundialsNVector mfem_b(b);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(GET_CONTENT(LS));
+   SundialsNVector &mfem_x = self->wrap1;
+   SundialsNVector &mfem_b = self->wrap2;
+   mfem_x.MakeRef(x);
+   mfem_b.MakeRef(b);
 
    // Solve the mass matrix system
    return (self->f->SUNMassSolve(mfem_b, mfem_x, tol));
@@ -1252,9 +1326,11 @@ int ARKStepSolver::MassSysSolve(SUNLinearSolver LS, SUNMatrix, N_Vector x,
 
 int ARKStepSolver::MassMult1(SUNMatrix M, N_Vector x, N_Vector v)
 {
-   const SundialsNVector mfem_x(x);
-   SundialsNVector mfem_v(v);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(GET_CONTENT(M));
+   SundialsNVector &mfem_x = self->wrap1;
+   SundialsNVector &mfem_v = self->wrap2;
+   mfem_x.MakeRef(x);
+   mfem_v.MakeRef(v);
 
    // Compute the mass matrix-vector product
    return (self->f->SUNMassMult(mfem_x, mfem_v));
@@ -1263,9 +1339,11 @@ int ARKStepSolver::MassMult1(SUNMatrix M, N_Vector x, N_Vector v)
 int ARKStepSolver::MassMult2(N_Vector x, N_Vector v, realtype t,
                              void* mtimes_data)
 {
-   const SundialsNVector mfem_x(x);
-   SundialsNVector mfem_v(v);
    ARKStepSolver *self = static_cast<ARKStepSolver*>(mtimes_data);
+   SundialsNVector &mfem_x = self->wrap1;
+   SundialsNVector &mfem_v = self->wrap2;
+   mfem_x.MakeRef(x);
+   mfem_v.MakeRef(v);
 
    // Compute the mass matrix-vector product
    self->f->SetTime(t);
@@ -56,6 +56,11 @@ protected:
    /// The actual SUNDIALS object
    N_Vector x;
 
+   /** Host data pointer of #x captured by the last _SetDataAndSize_() call;
+       used by MakeRef(N_Vector) to detect that the N_Vector data did not move
+       and the existing memory registration can be reused. */
+   double *bound_h_ptr = NULL;
+
    friend class SundialsSolver;
 
    /// Set data and length of internal N_Vector x from 'this'.
@@ -124,6 +129,14 @@ public:
        @warning This method should be called only when OwnsData() is false. */
    void SetDataAndSize(double *d, int s, long glob_size = 0);
 
+   /// Reset the wrapper to reference the N_Vector @a nv without ownership.
+   /** When @a nv and its data pointers did not change since the last binding,
+       the existing memory-manager registration is reused and only the
+       validity flags are reset, so persistent wrappers can be rebound on
+       every SUNDIALS callback invocation without re-registering the host and
+       device pointers of the callback N_Vectors each time. */
+   void MakeRef(N_Vector nv);
+
    /// Reset the Vector to be a reference to a sub-vector of @a base.
    inline void MakeRef(Vector &base, int offset, int s)
    {
@@ -209,6 +222,13 @@ protected:
    SUNLinearSolver    LSM;    ///< Linear solver for M.
    SUNNonlinearSolver NLS;    ///< Nonlinear solver.
 
+   /** Persistent wrappers for the N_Vector arguments of the static SUNDIALS
+       callback functions, see SundialsNVector::MakeRef(N_Vector). Rebinding
+       these instead of creating new wrappers on each callback avoids
+       re-registering the host and device data pointers with the memory
+       manager twice per RHS evaluation. */
+   SundialsNVector wrap1, wrap2;
+
 #ifdef MFEM_USE_MPI
    bool Parallel() const
    { return (Y->MPIPlusX() || Y->GetNVectorID() == SUNDIALS_NVEC_PARALLEL); }
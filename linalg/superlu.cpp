@@ -218,7 +218,9 @@ SuperLUSolver::SuperLUSolver( MPI_Comm comm )
      npcol_(0),
      firstSolveWithThisA_(false),
      gridInitialized_(false),
-     LUStructInitialized_(false)
+     LUStructInitialized_(false),
+     reusePattern_(false),
+     samePattern_(false)
 {
    this->Init();
 }
@@ -239,7 +241,9 @@ SuperLUSolver::SuperLUSolver( SuperLURowLocMatrix & A )
      npcol_(0),
      firstSolveWithThisA_(true),
      gridInitialized_(false),
-     LUStructInitialized_(false)
+     LUStructInitialized_(false),
+     reusePattern_(false),
+     samePattern_(false)
 {
    height = A.Height();
    width  = A.Width();
@@ -429,6 +433,11 @@ void SuperLUSolver::SetSymmetricPattern( bool sym )
    options->SymPattern = opt;
 }
 
+void SuperLUSolver::SetReusePattern( bool reuse )
+{
+   reusePattern_ = reuse;
+}
+
 void SuperLUSolver::SetupGrid()
 {
    gridinfo_t * grid = (gridinfo_t*)gridPtr_;
@@ -490,10 +499,21 @@ void SuperLUSolver::Mult( const Vector & x, Vector & y ) const
    {
       options->Fact = FACTORED; // Indicate the factored form of A is supplied.
    }
+   else if ( samePattern_ && LUStructInitialized_ )
+   {
+      // This is the first solve with this A but the sparsity pattern (and row
+      // permutation) are unchanged, see SetReusePattern(): the symbolic
+      // factorization is kept and only the numerical factorization is redone.
+      firstSolveWithThisA_ = false;
+
+      options->Fact = SamePattern_SameRowPerm;
+   }
    else // This is the first solve with this A
    {
       firstSolveWithThisA_ = false;
 
+      options->Fact = DOFACT;
+
       // Make sure that the parameters have been initialized The only parameter
       // we might have to worry about is ScalePermstruct, if the user is
       // supplying a row or column permutation.
@@ -579,12 +599,42 @@ void SuperLUSolver::Mult( const Vector & x, Vector & y ) const
 void SuperLUSolver::SetOperator( const Operator & op )
 {
    // Verify that we have a compatible operator
-   APtr_ = dynamic_cast<const SuperLURowLocMatrix*>(&op);
-   if ( APtr_ == NULL )
+   const SuperLURowLocMatrix * APtr =
+      dynamic_cast<const SuperLURowLocMatrix*>(&op);
+   if ( APtr == NULL )
    {
       mfem_error("SuperLUSolver::SetOperator : not SuperLURowLocMatrix!");
    }
 
+   // A values-only update can reuse the symbolic factorization as long as the
+   // sizes (and, per the contract of SetReusePattern(), the sparsity pattern
+   // and row permutation) are unchanged
+   samePattern_ = reusePattern_ && APtr_ != NULL && LUStructInitialized_ &&
+                  op.Height() == height && op.Width() == width;
+
+   if ( LUStructInitialized_ && !samePattern_ )
+   {
+      // Release the data structures of the previous factorization
+      superlu_dist_options_t * options = (superlu_dist_options_t*)optionsPtr_;
+      ScalePermstruct_t * SPstruct    = (ScalePermstruct_t*)ScalePermstructPtr_;
+      LUstruct_t        * LUstruct    = (LUstruct_t*)LUstructPtr_;
+      SOLVEstruct_t     * SOLVEstruct = (SOLVEstruct_t*)SOLVEstructPtr_;
+      gridinfo_t        * grid        = (gridinfo_t*)gridPtr_;
+
+      ScalePermstructFree(SPstruct);
+      Destroy_LU(width, grid, LUstruct);
+      LUstructFree(LUstruct);
+
+      if ( options->SolveInitialized )
+      {
+         dSolveFinalize(options, SOLVEstruct);
+      }
+
+      LUStructInitialized_ = false;
+   }
+
+   APtr_ = APtr;
+
    // Everything is OK so finish setting the operator
    firstSolveWithThisA_ = true;
 
@@ -118,6 +118,13 @@ public:
    void SetLookAheadElimTree( bool                   etree );
    void SetSymmetricPattern ( bool                     sym );
 
+   /** Indicate that the matrices supplied to subsequent calls to
+       SetOperator() keep the sparsity pattern (and row permutation) of the
+       current one, only the values changing, as in quasi-static runs. The
+       symbolic analysis of the current factorization is then reused and only
+       the numerical factorization is redone by the next solve. */
+   void SetReusePattern     ( bool                   reuse );
+
 private:
    void Init();
 
@@ -150,6 +157,8 @@ protected:
    mutable bool  firstSolveWithThisA_;
    bool          gridInitialized_;
    mutable bool  LUStructInitialized_;
+   bool          reusePattern_; // see SetReusePattern()
+   bool          samePattern_;  // values-only update since last factorization
 
 }; // mfem::SuperLUSolver class
 
@@ -50,6 +50,14 @@ Vector::Vector(const Vector &v)
    UseDevice(v.UseDevice());
 }
 
+Vector::Vector(Vector &&v)
+{
+   data = v.data;
+   size = v.size;
+   v.data.Reset();
+   v.size = 0;
+}
+
 void Vector::Load(std::istream **in, int np, int *dim)
 {
    int i, j, s;
@@ -128,6 +136,19 @@ Vector &Vector::operator=(const Vector &v)
    return *this;
 }
 
+Vector &Vector::operator=(Vector &&v)
+{
+   if (this != &v)
+   {
+      data.Delete();
+      data = v.data;
+      size = v.size;
+      v.data.Reset();
+      v.size = 0;
+   }
+   return *this;
+}
+
 Vector &Vector::operator=(double value)
 {
    const bool use_dev = UseDevice();
@@ -213,6 +234,91 @@ Vector &Vector::Add(const double a, const Vector &Va)
    return *this;
 }
 
+Vector &Vector::AddScaled(const int n, const double *a,
+                          const Vector *const *v)
+{
+   // Launch in blocks of up to 8 terms so the coefficient and pointer
+   // arrays can be captured by value in the device kernel.
+   const int block = 8;
+   for (int o = 0; o < n; o += block)
+   {
+      const int nb = std::min(block, n - o);
+      const int N = size;
+      bool use_dev = UseDevice();
+      double da[8];
+      const double *dv[8];
+      for (int i = 0; i < nb; i++)
+      {
+         MFEM_ASSERT(size == v[o+i]->size, "incompatible Vectors!");
+         use_dev = use_dev || v[o+i]->UseDevice();
+      }
+      for (int i = 0; i < nb; i++)
+      {
+         da[i] = a[o+i];
+         dv[i] = v[o+i]->Read(use_dev);
+      }
+      auto y = ReadWrite(use_dev);
+      MFEM_FORALL_SWITCH(use_dev, j, N,
+      {
+         double d = y[j];
+         for (int i = 0; i < nb; i++) { d += da[i]*dv[i][j]; }
+         y[j] = d;
+      });
+   }
+   return *this;
+}
+
+Vector &Vector::AddScaled(const Vector &x, const int n, const double *a,
+                          const Vector *const *v)
+{
+   MFEM_ASSERT(size == x.size, "incompatible Vectors!");
+
+   if (n == 0) { return operator=(x); }
+
+   const int block = 8;
+   for (int o = 0; o < n; o += block)
+   {
+      const int nb = std::min(block, n - o);
+      const int N = size;
+      bool use_dev = UseDevice() || x.UseDevice();
+      double da[8];
+      const double *dv[8];
+      for (int i = 0; i < nb; i++)
+      {
+         MFEM_ASSERT(size == v[o+i]->size, "incompatible Vectors!");
+         use_dev = use_dev || v[o+i]->UseDevice();
+      }
+      for (int i = 0; i < nb; i++)
+      {
+         da[i] = a[o+i];
+         dv[i] = v[o+i]->Read(use_dev);
+      }
+      if (o == 0)
+      {
+         // First block also streams in x, fusing the copy with the update.
+         auto d_x = x.Read(use_dev);
+         auto y = Write(use_dev);
+         MFEM_FORALL_SWITCH(use_dev, j, N,
+         {
+            double d = d_x[j];
+            for (int i = 0; i < nb; i++) { d += da[i]*dv[i][j]; }
+            y[j] = d;
+         });
+      }
+      else
+      {
+         auto y = ReadWrite(use_dev);
+         MFEM_FORALL_SWITCH(use_dev, j, N,
+         {
+            double d = y[j];
+            for (int i = 0; i < nb; i++) { d += da[i]*dv[i][j]; }
+            y[j] = d;
+         });
+      }
+   }
+   return *this;
+}
+
 Vector &Vector::Set(const double a, const Vector &Va)
 {
    MFEM_ASSERT(size == Va.size, "incompatible Vectors!");
@@ -739,6 +845,15 @@ double Vector::Norml2() const
       return 0.0;
    } // end if 0 == size
 
+   if (UseDevice() && !Device::IsDisabled())
+   {
+      // Stay resident on the device: compute sqrt(x.x) with the device dot
+      // kernels instead of staging the data through the host. Note that this
+      // path does not apply the overflow-safe scaling of the host algorithm
+      // below, matching the convention of the device dot product itself.
+      return std::sqrt((*this)*(*this));
+   }
+
    data.Read(MemoryClass::HOST, size);
    if (1 == size)
    {
@@ -817,23 +932,6 @@ double Vector::Normlp(double p) const
    return Normlinf(); // else p >= infinity()
 }
 
-double Vector::Max() const
-{
-   if (size == 0) { return -infinity(); }
-
-   double max = data[0];
-
-   for (int i = 1; i < size; i++)
-   {
-      if (data[i] > max)
-      {
-         max = data[i];
-      }
-   }
-
-   return max;
-}
-
 double Vector::Sum() const
 {
    double sum = 0.0;
@@ -892,6 +990,48 @@ static double cuVectorMin(const int N, const double *X)
    return min;
 }
 
+static __global__ void cuKernelMax(const int N, double *gdsr, const double *x)
+{
+   __shared__ double s_max[MFEM_CUDA_BLOCKS];
+   const int n = blockDim.x*blockIdx.x + threadIdx.x;
+   if (n>=N) { return; }
+   const int bid = blockIdx.x;
+   const int tid = threadIdx.x;
+   const int bbd = bid*blockDim.x;
+   const int rid = bbd+tid;
+   s_max[tid] = x[n];
+   for (int workers=blockDim.x>>1; workers>0; workers>>=1)
+   {
+      __syncthreads();
+      if (tid >= workers) { continue; }
+      if (rid >= N) { continue; }
+      const int dualTid = tid + workers;
+      if (dualTid >= N) { continue; }
+      const int rdd = bbd+dualTid;
+      if (rdd >= N) { continue; }
+      if (dualTid >= blockDim.x) { continue; }
+      s_max[tid] = fmax(s_max[tid], s_max[dualTid]);
+   }
+   if (tid==0) { gdsr[bid] = s_max[0]; }
+}
+
+static double cuVectorMax(const int N, const double *X)
+{
+   const int tpb = MFEM_CUDA_BLOCKS;
+   const int blockSize = MFEM_CUDA_BLOCKS;
+   const int gridSize = (N+blockSize-1)/blockSize;
+   const int max_sz = (N%tpb)==0? (N/tpb) : (1+N/tpb);
+   cuda_reduce_buf.SetSize(max_sz);
+   Memory<double> &buf = cuda_reduce_buf.GetMemory();
+   double *d_max = buf.Write(MemoryClass::DEVICE, max_sz);
+   cuKernelMax<<<gridSize,blockSize>>>(N, d_max, X);
+   MFEM_GPU_CHECK(cudaGetLastError());
+   const double *h_max = buf.Read(MemoryClass::HOST, max_sz);
+   double max = -std::numeric_limits<double>::infinity();
+   for (int i = 0; i < max_sz; i++) { max = fmax(max, h_max[i]); }
+   return max;
+}
+
 static __global__ void cuKernelDot(const int N, double *gdsr,
                                    const double *x, const double *y)
 {
@@ -918,21 +1058,56 @@ static __global__ void cuKernelDot(const int N, double *gdsr,
    if (tid==0) { gdsr[bid] = s_dot[0]; }
 }
 
+static __global__ void cuKernelSum(const int N, double *gdsr, const double *x)
+{
+   __shared__ double s_sum[MFEM_CUDA_BLOCKS];
+   const int n = blockDim.x*blockIdx.x + threadIdx.x;
+   if (n>=N) { return; }
+   const int bid = blockIdx.x;
+   const int tid = threadIdx.x;
+   const int bbd = bid*blockDim.x;
+   const int rid = bbd+tid;
+   s_sum[tid] = x[n];
+   for (int workers=blockDim.x>>1; workers>0; workers>>=1)
+   {
+      __syncthreads();
+      if (tid >= workers) { continue; }
+      if (rid >= N) { continue; }
+      const int dualTid = tid + workers;
+      if (dualTid >= N) { continue; }
+      const int rdd = bbd+dualTid;
+      if (rdd >= N) { continue; }
+      if (dualTid >= blockDim.x) { continue; }
+      s_sum[tid] += s_sum[dualTid];
+   }
+   if (tid==0) { gdsr[bid] = s_sum[0]; }
+}
+
 static double cuVectorDot(const int N, const double *X, const double *Y)
 {
    const int tpb = MFEM_CUDA_BLOCKS;
    const int blockSize = MFEM_CUDA_BLOCKS;
    const int gridSize = (N+blockSize-1)/blockSize;
    const int dot_sz = (N%tpb)==0? (N/tpb) : (1+N/tpb);
-   cuda_reduce_buf.SetSize(dot_sz, MemoryType::DEVICE);
+   // Double buffer: the partial sums stay on the device and are folded by
+   // repeated block reductions; only the final scalar is read on the host.
+   cuda_reduce_buf.SetSize(2*dot_sz, MemoryType::DEVICE);
    Memory<double> &buf = cuda_reduce_buf.GetMemory();
-   double *d_dot = buf.Write(MemoryClass::DEVICE, dot_sz);
+   double *d_dot = buf.Write(MemoryClass::DEVICE, 2*dot_sz);
    cuKernelDot<<<gridSize,blockSize>>>(N, d_dot, X, Y);
    MFEM_GPU_CHECK(cudaGetLastError());
-   const double *h_dot = buf.Read(MemoryClass::HOST, dot_sz);
-   double dot = 0.0;
-   for (int i = 0; i < dot_sz; i++) { dot += h_dot[i]; }
-   return dot;
+   double *d_a = d_dot, *d_b = d_dot + dot_sz;
+   int n = dot_sz;
+   while (n > 1)
+   {
+      const int grid = (n+blockSize-1)/blockSize;
+      cuKernelSum<<<grid,blockSize>>>(n, d_b, d_a);
+      MFEM_GPU_CHECK(cudaGetLastError());
+      std::swap(d_a, d_b);
+      n = grid;
+   }
+   const double *h_dot = buf.Read(MemoryClass::HOST, 2*dot_sz);
+   return h_dot[d_a - d_dot];
 }
 #endif // MFEM_USE_CUDA
 
@@ -981,6 +1156,48 @@ static double hipVectorMin(const int N, const double *X)
    return min;
 }
 
+static __global__ void hipKernelMax(const int N, double *gdsr, const double *x)
+{
+   __shared__ double s_max[MFEM_CUDA_BLOCKS];
+   const int n = hipBlockDim_x*hipBlockIdx_x + hipThreadIdx_x;
+   if (n>=N) { return; }
+   const int bid = hipBlockIdx_x;
+   const int tid = hipThreadIdx_x;
+   const int bbd = bid*hipBlockDim_x;
+   const int rid = bbd+tid;
+   s_max[tid] = x[n];
+   for (int workers=hipBlockDim_x>>1; workers>0; workers>>=1)
+   {
+      __syncthreads();
+      if (tid >= workers) { continue; }
+      if (rid >= N) { continue; }
+      const int dualTid = tid + workers;
+      if (dualTid >= N) { continue; }
+      const int rdd = bbd+dualTid;
+      if (rdd >= N) { continue; }
+      if (dualTid >= hipBlockDim_x) { continue; }
+      s_max[tid] = fmax(s_max[tid], s_max[dualTid]);
+   }
+   if (tid==0) { gdsr[bid] = s_max[0]; }
+}
+
+static double hipVectorMax(const int N, const double *X)
+{
+   const int tpb = MFEM_CUDA_BLOCKS;
+   const int blockSize = MFEM_CUDA_BLOCKS;
+   const int gridSize = (N+blockSize-1)/blockSize;
+   const int max_sz = (N%tpb)==0 ? (N/tpb) : (1+N/tpb);
+   cuda_reduce_buf.SetSize(max_sz);
+   Memory<double> &buf = cuda_reduce_buf.GetMemory();
+   double *d_max = buf.Write(MemoryClass::DEVICE, max_sz);
+   hipLaunchKernelGGL(hipKernelMax,gridSize,blockSize,0,0,N,d_max,X);
+   MFEM_GPU_CHECK(hipGetLastError());
+   const double *h_max = buf.Read(MemoryClass::HOST, max_sz);
+   double max = -std::numeric_limits<double>::infinity();
+   for (int i = 0; i < max_sz; i++) { max = fmax(max, h_max[i]); }
+   return max;
+}
+
 static __global__ void hipKernelDot(const int N, double *gdsr,
                                     const double *x, const double *y)
 {
@@ -1007,21 +1224,56 @@ static __global__ void hipKernelDot(const int N, double *gdsr,
    if (tid==0) { gdsr[bid] = s_dot[0]; }
 }
 
+static __global__ void hipKernelSum(const int N, double *gdsr, const double *x)
+{
+   __shared__ double s_sum[MFEM_CUDA_BLOCKS];
+   const int n = hipBlockDim_x*hipBlockIdx_x + hipThreadIdx_x;
+   if (n>=N) { return; }
+   const int bid = hipBlockIdx_x;
+   const int tid = hipThreadIdx_x;
+   const int bbd = bid*hipBlockDim_x;
+   const int rid = bbd+tid;
+   s_sum[tid] = x[n];
+   for (int workers=hipBlockDim_x>>1; workers>0; workers>>=1)
+   {
+      __syncthreads();
+      if (tid >= workers) { continue; }
+      if (rid >= N) { continue; }
+      const int dualTid = tid + workers;
+      if (dualTid >= N) { continue; }
+      const int rdd = bbd+dualTid;
+      if (rdd >= N) { continue; }
+      if (dualTid >= hipBlockDim_x) { continue; }
+      s_sum[tid] += s_sum[dualTid];
+   }
+   if (tid==0) { gdsr[bid] = s_sum[0]; }
+}
+
 static double hipVectorDot(const int N, const double *X, const double *Y)
 {
    const int tpb = MFEM_CUDA_BLOCKS;
    const int blockSize = MFEM_CUDA_BLOCKS;
    const int gridSize = (N+blockSize-1)/blockSize;
    const int dot_sz = (N%tpb)==0 ? (N/tpb) : (1+N/tpb);
-   cuda_reduce_buf.SetSize(dot_sz);
+   // Double buffer: the partial sums stay on the device and are folded by
+   // repeated block reductions; only the final scalar is read on the host.
+   cuda_reduce_buf.SetSize(2*dot_sz);
    Memory<double> &buf = cuda_reduce_buf.GetMemory();
-   double *d_dot = buf.Write(MemoryClass::DEVICE, dot_sz);
+   double *d_dot = buf.Write(MemoryClass::DEVICE, 2*dot_sz);
    hipLaunchKernelGGL(hipKernelDot,gridSize,blockSize,0,0,N,d_dot,X,Y);
    MFEM_GPU_CHECK(hipGetLastError());
-   const double *h_dot = buf.Read(MemoryClass::HOST, dot_sz);
-   double dot = 0.0;
-   for (int i = 0; i < dot_sz; i++) { dot += h_dot[i]; }
-   return dot;
+   double *d_a = d_dot, *d_b = d_dot + dot_sz;
+   int n = dot_sz;
+   while (n > 1)
+   {
+      const int grid = (n+blockSize-1)/blockSize;
+      hipLaunchKernelGGL(hipKernelSum,grid,blockSize,0,0,n,d_b,d_a);
+      MFEM_GPU_CHECK(hipGetLastError());
+      std::swap(d_a, d_b);
+      n = grid;
+   }
+   const double *h_dot = buf.Read(MemoryClass::HOST, 2*dot_sz);
+   return h_dot[d_a - d_dot];
 }
 #endif // MFEM_USE_HIP
 
@@ -1158,6 +1410,74 @@ vector_min_cpu:
    return minimum;
 }
 
+double Vector::Max() const
+{
+   if (size == 0) { return -infinity(); }
+
+   const bool use_dev = UseDevice();
+   auto m_data = Read(use_dev);
+
+   if (!use_dev) { goto vector_max_cpu; }
+
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca())
+   {
+      return occa::linalg::max<double,double>(OccaMemoryRead(data, size));
+   }
+#endif
+
+#ifdef MFEM_USE_CUDA
+   if (Device::Allows(Backend::CUDA_MASK))
+   {
+      return cuVectorMax(size, m_data);
+   }
+#endif
+
+#ifdef MFEM_USE_HIP
+   if (Device::Allows(Backend::HIP_MASK))
+   {
+      return hipVectorMax(size, m_data);
+   }
+#endif
+
+#ifdef MFEM_USE_OPENMP
+   if (Device::Allows(Backend::OMP_MASK))
+   {
+      double maximum = m_data[0];
+      #pragma omp parallel for reduction(max:maximum)
+      for (int i = 0; i < size; i++)
+      {
+         maximum = std::max(maximum, m_data[i]);
+      }
+      return maximum;
+   }
+#endif
+
+   if (Device::Allows(Backend::DEBUG_DEVICE))
+   {
+      const int N = size;
+      auto m_data = Read();
+      Vector max(1);
+      max = -infinity();
+      max.UseDevice(true);
+      auto d_max = max.ReadWrite();
+      MFEM_FORALL(i, N, d_max[0] = (d_max[0]>m_data[i])?d_max[0]:m_data[i];);
+      max.HostReadWrite();
+      return max[0];
+   }
+
+vector_max_cpu:
+   double maximum = data[0];
+   for (int i = 1; i < size; i++)
+   {
+      if (m_data[i] > maximum)
+      {
+         maximum = m_data[i];
+      }
+   }
+   return maximum;
+}
+
 
 #ifdef MFEM_USE_SUNDIALS
 
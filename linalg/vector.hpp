@@ -63,6 +63,9 @@ public:
    /// Copy constructor. Allocates a new data array and copies the data.
    Vector(const Vector &);
 
+   /// Move constructor. "Steals" data from its argument.
+   Vector(Vector &&v);
+
    /// @brief Creates vector of size s.
    /// @warning Entries are not initialized to zero!
    explicit Vector(int s);
@@ -231,6 +234,9 @@ public:
        assignment operator. */
    Vector &operator=(const Vector &v);
 
+   /// Move assignment. "Steals" data from its argument.
+   Vector &operator=(Vector &&v);
+
    /// Redefine '=' for vector = constant.
    Vector &operator=(double value);
 
@@ -249,6 +255,15 @@ public:
    /// (*this) += a * Va
    Vector &Add(const double a, const Vector &Va);
 
+   /** @brief Fused multi-term axpy: (*this) += sum_i a[i] * (*v[i]),
+       i = 0,...,n-1, computed in a single pass over memory. */
+   Vector &AddScaled(const int n, const double *a, const Vector *const *v);
+
+   /** @brief Fused multi-term axpy: (*this) = x + sum_i a[i] * (*v[i]),
+       i = 0,...,n-1, computed in a single pass over memory. */
+   Vector &AddScaled(const Vector &x, const int n, const double *a,
+                     const Vector *const *v);
+
    /// (*this) = a * x
    Vector &Set(const double a, const Vector &x);
 
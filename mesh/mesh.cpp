@@ -13,6 +13,8 @@
 
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
+#include "../general/forall.hpp"
+#include "../linalg/kernels.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/binaryio.hpp"
 #include "../general/text.hpp"
@@ -27,8 +29,11 @@
 #include <limits>
 #include <cmath>
 #include <cstring>
+#include <cstdint>
 #include <ctime>
 #include <functional>
+#include <algorithm>
+#include <vector>
 
 // Include the METIS header, if using version 5. If using METIS 4, the needed
 // declarations are inlined below, i.e. no header is needed.
@@ -477,6 +482,199 @@ void Mesh::GetBdrElementTransformation(int i, IsoparametricTransformation* ElTr)
    }
 }
 
+void Mesh::TransformElements(const IntegrationRule &ir, DenseTensor &pts)
+{
+   const int ne = GetNE();
+   pts.SetSize(spaceDim, ir.GetNPoints(), ne);
+   IsoparametricTransformation T;
+   for (int i = 0; i < ne; i++)
+   {
+      GetElementTransformation(i, &T);
+      T.Transform(ir, pts(i));
+   }
+}
+
+void Mesh::TransformBdrElements(const IntegrationRule &ir, DenseTensor &pts)
+{
+   const int nbe = GetNBE();
+   pts.SetSize(spaceDim, ir.GetNPoints(), nbe);
+   IsoparametricTransformation T;
+   for (int i = 0; i < nbe; i++)
+   {
+      GetBdrElementTransformation(i, &T);
+      T.Transform(ir, pts(i));
+   }
+}
+
+/** Newton solve for the reference coordinates of a batch of physical points,
+    one point per thread. The element mapping and its Jacobian are evaluated
+    from the lexicographically ordered nodal E-vector and the 1D Lagrange
+    basis, reconstructed on the fly from the 1D node locations @a nodes1d and
+    their barycentric weights @a baryw. */
+template <int DIM>
+static void BatchInvTransformKernel(const int npts, const int d1d,
+                                    const int ne, const Array<int> &elem_ids,
+                                    const Vector &nodes1d, const Vector &baryw,
+                                    const Vector &e_vec,
+                                    const DenseMatrix &phys_pts,
+                                    const int max_iter, const double phys_tol,
+                                    DenseMatrix &ref_pts,
+                                    Array<int> &converged)
+{
+   int nd = d1d;
+   for (int d = 1; d < DIM; d++) { nd *= d1d; }
+   const auto el = elem_ids.Read();
+   const auto z = nodes1d.Read();
+   const auto w = baryw.Read();
+   const auto E = Reshape(e_vec.Read(), nd, DIM, ne);
+   const auto X = Reshape(phys_pts.Read(), DIM, npts);
+   auto Y = Reshape(ref_pts.Write(), DIM, npts);
+   auto conv = converged.Write();
+   const double tol2 = phys_tol*phys_tol;
+   MFEM_FORALL(j, npts,
+   {
+      const int e = el[j];
+      double xt[DIM], xi[DIM];
+      for (int d = 0; d < DIM; d++) { xt[d] = X(d,j); xi[d] = 0.5; }
+      double bv[DIM][MAX_D1D], bg[DIM][MAX_D1D];
+      bool ok = false;
+      for (int it = 0; it < max_iter; it++)
+      {
+         for (int d = 0; d < DIM; d++)
+         {
+            for (int i = 0; i < d1d; i++)
+            {
+               double v = 1.0, dv = 0.0;
+               for (int k = 0; k < d1d; k++)
+               {
+                  if (k == i) { continue; }
+                  dv = dv*(xi[d] - z[k]) + v;
+                  v *= (xi[d] - z[k]);
+               }
+               bv[d][i] = w[i]*v;
+               bg[d][i] = w[i]*dv;
+            }
+         }
+         double F[DIM], J[DIM*DIM];
+         for (int d = 0; d < DIM; d++) { F[d] = 0.0; }
+         for (int d = 0; d < DIM*DIM; d++) { J[d] = 0.0; }
+         const int n2 = (DIM == 3) ? d1d : 1;
+         for (int i2 = 0; i2 < n2; i2++)
+         {
+            for (int i1 = 0; i1 < d1d; i1++)
+            {
+               for (int i0 = 0; i0 < d1d; i0++)
+               {
+                  const double b2 = (DIM == 3) ? bv[2][i2] : 1.0;
+                  const double s = bv[0][i0]*bv[1][i1]*b2;
+                  double g[DIM];
+                  g[0] = bg[0][i0]*bv[1][i1]*b2;
+                  if (DIM > 1) { g[1] = bv[0][i0]*bg[1][i1]*b2; }
+                  if (DIM > 2) { g[2] = bv[0][i0]*bv[1][i1]*bg[2][i2]; }
+                  const int dof = i0 + d1d*(i1 + d1d*i2);
+                  for (int c = 0; c < DIM; c++)
+                  {
+                     const double node = E(dof, c, e);
+                     F[c] += s*node;
+                     for (int d = 0; d < DIM; d++) { J[c+DIM*d] += g[d]*node; }
+                  }
+               }
+            }
+         }
+         double r[DIM], res2 = 0.0;
+         for (int c = 0; c < DIM; c++) { r[c] = F[c] - xt[c]; res2 += r[c]*r[c]; }
+         if (res2 <= tol2) { ok = true; break; }
+         const double det = kernels::Det<DIM>(J);
+         if (!(det > 0.0 || det < 0.0)) { break; }
+         double Jinv[DIM*DIM];
+         kernels::CalcInverse<DIM>(J, Jinv);
+         for (int d = 0; d < DIM; d++)
+         {
+            double dx = 0.0;
+            for (int c = 0; c < DIM; c++) { dx += Jinv[d+DIM*c]*r[c]; }
+            xi[d] -= dx;
+         }
+      }
+      conv[j] = ok ? 1 : 0;
+      for (int d = 0; d < DIM; d++) { Y(d,j) = xi[d]; }
+   });
+}
+
+void Mesh::BatchInverseTransform(const Array<int> &elem_ids,
+                                 const DenseMatrix &phys_pts,
+                                 DenseMatrix &ref_pts, Array<int> &converged,
+                                 int max_iter, double phys_tol)
+{
+   const int npts = phys_pts.Width();
+   MFEM_VERIFY(elem_ids.Size() == npts,
+               "'elem_ids' and 'phys_pts' sizes do not match");
+   MFEM_VERIFY(phys_pts.Height() == spaceDim, "invalid point dimension");
+   ref_pts.SetSize(Dim, npts);
+   converged.SetSize(npts);
+   if (npts == 0) { return; }
+
+   EnsureNodes();
+   const FiniteElementSpace *fes = Nodes->FESpace();
+   const FiniteElement *fe = (GetNE() > 0) ? fes->GetFE(0) : NULL;
+   const TensorBasisElement *tfe =
+      dynamic_cast<const TensorBasisElement*>(fe);
+   const bool batched = tfe && Dim == spaceDim && (Dim == 2 || Dim == 3) &&
+                        GetNumGeometries(Dim) <= 1 &&
+                        tfe->GetBasisType() != BasisType::Positive &&
+                        fe->GetOrder() + 1 <= MAX_D1D;
+   if (batched)
+   {
+      const int p = fe->GetOrder(), d1d = p + 1;
+      // 1D interpolation nodes and their barycentric weights.
+      Vector nodes1d(d1d), baryw(d1d);
+      const double *pts1d = poly1d.GetPoints(p, tfe->GetBasisType());
+      for (int i = 0; i < d1d; i++) { nodes1d(i) = pts1d[i]; }
+      for (int i = 0; i < d1d; i++)
+      {
+         double prod = 1.0;
+         for (int k = 0; k < d1d; k++)
+         {
+            if (k != i) { prod *= nodes1d(i) - nodes1d(k); }
+         }
+         baryw(i) = 1.0/prod;
+      }
+      const Operator *R =
+         fes->GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
+      Vector e_vec(R->Height());
+      R->Mult(*Nodes, e_vec);
+      switch (Dim)
+      {
+         case 2: BatchInvTransformKernel<2>(npts, d1d, GetNE(), elem_ids,
+                                               nodes1d, baryw, e_vec, phys_pts,
+                                               max_iter, phys_tol, ref_pts,
+                                               converged); return;
+         case 3: BatchInvTransformKernel<3>(npts, d1d, GetNE(), elem_ids,
+                                               nodes1d, baryw, e_vec, phys_pts,
+                                               max_iter, phys_tol, ref_pts,
+                                               converged); return;
+      }
+   }
+
+   // General fallback: point-wise Newton through the standard inverse
+   // transformation (simplices, mixed meshes, positive bases, embedded
+   // meshes with Dim < spaceDim).
+   IsoparametricTransformation T;
+   InverseElementTransformation inv_tr;
+   inv_tr.SetSolverType(InverseElementTransformation::Newton);
+   inv_tr.SetMaxIter(max_iter);
+   Vector pt(spaceDim);
+   IntegrationPoint ip;
+   for (int j = 0; j < npts; j++)
+   {
+      GetElementTransformation(elem_ids[j], &T);
+      inv_tr.SetTransformation(T);
+      phys_pts.GetColumn(j, pt);
+      const int res = inv_tr.Transform(pt, ip);
+      converged[j] = (res != InverseElementTransformation::Unknown) ? 1 : 0;
+      ip.Get(&ref_pts(0,j), Dim);
+   }
+}
+
 void Mesh::GetFaceTransformation(int FaceNo, IsoparametricTransformation *FTr)
 {
    FTr->Attribute = (Dim == 1) ? 1 : faces[FaceNo]->GetAttribute();
@@ -771,8 +969,12 @@ const GeometricFactors* Mesh::GetGeometricFactors(const IntegrationRule& ir,
    for (int i = 0; i < geom_factors.Size(); i++)
    {
       GeometricFactors *gf = geom_factors[i];
-      if (gf->IntRule == &ir && (gf->computed_factors & flags) == flags)
+      // A compressed cached object can only serve callers that allow
+      // compression; a full one serves everyone.
+      if (gf->IntRule == &ir &&
+          (!gf->compressed || (flags & GeometricFactors::COMPRESSED)))
       {
+         gf->Compute(flags); // no-op when all factors are already computed
          return gf;
       }
    }
@@ -791,9 +993,9 @@ const FaceGeometricFactors* Mesh::GetFaceGeometricFactors(
    for (int i = 0; i < face_geom_factors.Size(); i++)
    {
       FaceGeometricFactors *gf = face_geom_factors[i];
-      if (gf->IntRule == &ir && (gf->computed_factors & flags) == flags &&
-          gf->type==type)
+      if (gf->IntRule == &ir && gf->type == type)
       {
+         gf->Compute(flags); // no-op when all factors are already computed
          return gf;
       }
    }
@@ -819,6 +1021,136 @@ void Mesh::DeleteGeometricFactors()
    face_geom_factors.SetSize(0);
 }
 
+void Mesh::RefreshGeometricFactors()
+{
+   for (int i = 0; i < geom_factors.Size(); i++)
+   {
+      geom_factors[i]->Refresh();
+   }
+   for (int i = 0; i < face_geom_factors.Size(); i++)
+   {
+      face_geom_factors[i]->Refresh();
+   }
+}
+
+void Mesh::UpdateGeometricFactors(const Array<int> &elems)
+{
+   // face quadrature geometry is not updated selectively: drop any cached
+   // face factors and let them be recomputed on demand
+   for (int i = 0; i < face_geom_factors.Size(); i++)
+   {
+      delete face_geom_factors[i];
+   }
+   face_geom_factors.SetSize(0);
+
+   for (int i = 0; i < geom_factors.Size(); i++)
+   {
+      geom_factors[i]->Update(elems);
+   }
+}
+
+void Mesh::UpdateGeometricFactorsByNodes(const Array<int> &node_dofs)
+{
+   if (geom_factors.Size() == 0 && face_geom_factors.Size() == 0) { return; }
+
+   MFEM_VERIFY(Nodes, "the mesh has no nodes");
+   const FiniteElementSpace *fes = Nodes->FESpace();
+
+   Array<int> dof_marker(fes->GetNDofs());
+   dof_marker = 0;
+   for (int i = 0; i < node_dofs.Size(); i++)
+   {
+      dof_marker[node_dofs[i]] = 1;
+   }
+
+   Array<int> elems, dofs;
+   for (int e = 0; e < GetNE(); e++)
+   {
+      fes->GetElementDofs(e, dofs);
+      for (int j = 0; j < dofs.Size(); j++)
+      {
+         if (dof_marker[dofs[j]]) { elems.Append(e); break; }
+      }
+   }
+   UpdateGeometricFactors(elems);
+}
+
+void Mesh::GetElementQualityMetrics(const IntegrationRule &ir,
+                                    Vector &min_detJ, Vector &max_detJ,
+                                    Vector &aspect_ratio, Vector &skew)
+{
+   MFEM_VERIFY(Dim == spaceDim, "surface meshes are not supported");
+   MFEM_VERIFY(GetNumGeometries(Dim) <= 1, "mixed meshes are not supported");
+
+   const int NE = GetNE(), NQ = ir.GetNPoints(), dim = Dim;
+
+   min_detJ.SetSize(NE);
+   max_detJ.SetSize(NE);
+   aspect_ratio.SetSize(NE);
+   skew.SetSize(NE);
+   if (NE == 0) { return; }
+
+   const GeometricFactors *geom =
+      GetGeometricFactors(ir, GeometricFactors::JACOBIANS |
+                          GeometricFactors::DETERMINANTS);
+
+   // J: (NQ x SDIM x DIM x NE), detJ: (NQ x NE), column-major
+   const double *J = geom->J.HostRead();
+   const double *detJ = geom->detJ.HostRead();
+
+   for (int e = 0; e < NE; e++)
+   {
+      const double *dJ = detJ + e*NQ;
+      double dmin = dJ[0], dmax = dJ[0];
+      for (int q = 1; q < NQ; q++)
+      {
+         dmin = std::min(dmin, dJ[q]);
+         dmax = std::max(dmax, dJ[q]);
+      }
+      min_detJ(e) = dmin;
+      max_detJ(e) = dmax;
+
+      const double *Je = J + e*NQ*dim*dim;
+      double aspect = 1.0, cos_max = 0.0;
+      for (int q = 0; q < NQ; q++)
+      {
+         double norm[3]; // column norms of J
+         for (int j = 0; j < dim; j++)
+         {
+            double n2 = 0.0;
+            for (int i = 0; i < dim; i++)
+            {
+               const double Jij = Je[q + NQ*(i + dim*j)];
+               n2 += Jij*Jij;
+            }
+            norm[j] = std::sqrt(n2);
+         }
+         double lmin = norm[0], lmax = norm[0];
+         for (int j = 1; j < dim; j++)
+         {
+            lmin = std::min(lmin, norm[j]);
+            lmax = std::max(lmax, norm[j]);
+         }
+         aspect = std::max(aspect, lmax/lmin);
+
+         for (int j = 0; j < dim; j++)
+         {
+            for (int k = j+1; k < dim; k++)
+            {
+               double dot = 0.0;
+               for (int i = 0; i < dim; i++)
+               {
+                  dot += Je[q + NQ*(i + dim*j)]*Je[q + NQ*(i + dim*k)];
+               }
+               cos_max = std::max(cos_max, std::fabs(dot)/(norm[j]*norm[k]));
+            }
+         }
+      }
+      aspect_ratio(e) = aspect;
+      skew(e) = cos_max;
+   }
+}
+
 void Mesh::GetLocalFaceTransformation(
    int face_type, int elem_type, IsoparametricTransformation &Transf, int info)
 {
@@ -868,48 +1200,59 @@ void Mesh::GetLocalFaceTransformation(
 
 FaceElementTransformations *Mesh::GetFaceElementTransformations(int FaceNo,
                                                                 int mask)
+{
+   GetFaceElementTransformations(FaceNo, FaceElemTr, Transformation,
+                                 Transformation2, mask);
+   return &FaceElemTr;
+}
+
+void Mesh::GetFaceElementTransformations(int FaceNo,
+                                         FaceElementTransformations &FElTr,
+                                         IsoparametricTransformation &ElTr1,
+                                         IsoparametricTransformation &ElTr2,
+                                         int mask)
 {
    FaceInfo &face_info = faces_info[FaceNo];
 
    int cmask = 0;
-   FaceElemTr.SetConfigurationMask(cmask);
-   FaceElemTr.Elem1 = NULL;
-   FaceElemTr.Elem2 = NULL;
+   FElTr.SetConfigurationMask(cmask);
+   FElTr.Elem1 = NULL;
+   FElTr.Elem2 = NULL;
 
    // setup the transformation for the first element
-   FaceElemTr.Elem1No = face_info.Elem1No;
+   FElTr.Elem1No = face_info.Elem1No;
    if (mask & FaceElementTransformations::HAVE_ELEM1)
    {
-      GetElementTransformation(FaceElemTr.Elem1No, &Transformation);
-      FaceElemTr.Elem1 = &Transformation;
+      GetElementTransformation(FElTr.Elem1No, &ElTr1);
+      FElTr.Elem1 = &ElTr1;
       cmask |= 1;
    }
 
    //  setup the transformation for the second element
    //     return NULL in the Elem2 field if there's no second element, i.e.
    //     the face is on the "boundary"
-   FaceElemTr.Elem2No = face_info.Elem2No;
+   FElTr.Elem2No = face_info.Elem2No;
    if ((mask & FaceElementTransformations::HAVE_ELEM2) &&
-       FaceElemTr.Elem2No >= 0)
+       FElTr.Elem2No >= 0)
    {
 #ifdef MFEM_DEBUG
       if (NURBSext && (mask & FaceElementTransformations::HAVE_ELEM1))
       { MFEM_ABORT("NURBS mesh not supported!"); }
 #endif
-      GetElementTransformation(FaceElemTr.Elem2No, &Transformation2);
-      FaceElemTr.Elem2 = &Transformation2;
+      GetElementTransformation(FElTr.Elem2No, &ElTr2);
+      FElTr.Elem2 = &ElTr2;
       cmask |= 2;
    }
 
    // setup the face transformation
    if (mask & FaceElementTransformations::HAVE_FACE)
    {
-      GetFaceTransformation(FaceNo, &FaceElemTr);
+      GetFaceTransformation(FaceNo, &FElTr);
       cmask |= 16;
    }
    else
    {
-      FaceElemTr.SetGeometryType(GetFaceGeometryType(FaceNo));
+      FElTr.SetGeometryType(GetFaceGeometryType(FaceNo));
    }
 
    // setup Loc1 & Loc2
@@ -918,42 +1261,40 @@ FaceElementTransformations *Mesh::GetFaceElementTransformations(int FaceNo,
    {
       int elem_type = GetElementType(face_info.Elem1No);
       GetLocalFaceTransformation(face_type, elem_type,
-                                 FaceElemTr.Loc1.Transf, face_info.Elem1Inf);
+                                 FElTr.Loc1.Transf, face_info.Elem1Inf);
       cmask |= 4;
    }
    if ((mask & FaceElementTransformations::HAVE_LOC2) &&
-       FaceElemTr.Elem2No >= 0)
+       FElTr.Elem2No >= 0)
    {
       int elem_type = GetElementType(face_info.Elem2No);
       GetLocalFaceTransformation(face_type, elem_type,
-                                 FaceElemTr.Loc2.Transf, face_info.Elem2Inf);
+                                 FElTr.Loc2.Transf, face_info.Elem2Inf);
 
       // NC meshes: prepend slave edge/face transformation to Loc2
       if (Nonconforming() && IsSlaveFace(face_info))
       {
-         ApplyLocalSlaveTransformation(FaceElemTr, face_info, false);
+         ApplyLocalSlaveTransformation(FElTr, face_info, false);
       }
       cmask |= 8;
    }
 
-   FaceElemTr.SetConfigurationMask(cmask);
+   FElTr.SetConfigurationMask(cmask);
 
    // This check can be useful for internal debugging, however it will fail on
    // periodic boundary faces, so we keep it disabled in general.
 #if 0
 #ifdef MFEM_DEBUG
-   double dist = FaceElemTr.CheckConsistency();
+   double dist = FElTr.CheckConsistency();
    if (dist >= 1e-12)
    {
       mfem::out << "\nInternal error: face id = " << FaceNo
                 << ", dist = " << dist << '\n';
-      FaceElemTr.CheckConsistency(1); // print coordinates
+      FElTr.CheckConsistency(1); // print coordinates
       MFEM_ABORT("internal error");
    }
 #endif
 #endif
-
-   return &FaceElemTr;
 }
 
 bool Mesh::IsSlaveFace(const FaceInfo &fi) const
@@ -1028,6 +1369,36 @@ FaceElementTransformations *Mesh::GetBdrFaceTransformations(int BdrElemNo)
    return tr;
 }
 
+bool Mesh::GetBdrFaceTransformations(int BdrElemNo,
+                                     FaceElementTransformations &FElTr,
+                                     IsoparametricTransformation &ElTr1,
+                                     IsoparametricTransformation &ElTr2)
+{
+   int fn;
+   if (Dim == 3)
+   {
+      fn = be_to_face[BdrElemNo];
+   }
+   else if (Dim == 2)
+   {
+      fn = be_to_edge[BdrElemNo];
+   }
+   else
+   {
+      fn = boundary[BdrElemNo]->GetVertices()[0];
+   }
+   // Check if the face is interior, shared, or non-conforming.
+   if (FaceIsTrueInterior(fn) || faces_info[fn].NCFace >= 0)
+   {
+      return false;
+   }
+   GetFaceElementTransformations(fn, FElTr, ElTr1, ElTr2, 21);
+   FElTr.Attribute = boundary[BdrElemNo]->GetAttribute();
+   FElTr.ElementNo = BdrElemNo;
+   FElTr.ElementType = ElementTransformation::BDR_FACE;
+   return true;
+}
+
 void Mesh::GetFaceElements(int Face, int *Elem1, int *Elem2) const
 {
    *Elem1 = faces_info[Face].Elem1No;
@@ -1173,6 +1544,10 @@ void Mesh::ResetLazyData()
    DeleteGeometricFactors();
    nbInteriorFaces = -1;
    nbBoundaryFaces = -1;
+   vtu_topology.sequence = -1;
+   element_bvh.sequence = -1;
+   attr_elem_lists.sequence = -1;
+   vert_adj.sequence = -1;
 }
 
 void Mesh::SetAttributes()
@@ -1206,6 +1581,57 @@ void Mesh::SetAttributes()
    }
 }
 
+#ifdef MFEM_USE_MPI
+
+/** Replace the allocation of 'mem' with an identical HOST_SHARED one; the
+    node-root rank provides the contents, which all ranks of the node hold
+    as replicas on entry. */
+template <typename T>
+static void MakeHostShared(Memory<T> &mem, int size,
+                           int node_rank, MPI_Comm node_comm)
+{
+   if (size <= 0 || mem.Empty()) { return; }
+   Memory<T> smem(size, MemoryType::HOST_SHARED);
+   if (node_rank == 0)
+   {
+      std::memcpy((T*)smem, (const T*)mem, size*sizeof(T));
+   }
+   MPI_Barrier(node_comm);
+   mem.Delete();
+   mem = smem;
+}
+
+static void MakeHostShared(Table *table, int node_rank, MPI_Comm node_comm)
+{
+   if (!table || table->Size() < 0) { return; }
+   MakeHostShared(table->GetIMemory(), table->Size()+1, node_rank, node_comm);
+   MakeHostShared(table->GetJMemory(), table->Size_of_connections(),
+                  node_rank, node_comm);
+}
+
+void Mesh::ShareReadOnlyData()
+{
+   MPI_Comm node_comm;
+   MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0,
+                       MPI_INFO_NULL, &node_comm);
+   int node_rank;
+   MPI_Comm_rank(node_comm, &node_rank);
+
+   MakeHostShared(vertices.GetMemory(), vertices.Size(),
+                  node_rank, node_comm);
+   MakeHostShared(faces_info.GetMemory(), faces_info.Size(),
+                  node_rank, node_comm);
+   MakeHostShared(el_to_edge, node_rank, node_comm);
+   MakeHostShared(el_to_face, node_rank, node_comm);
+   MakeHostShared(bel_to_edge, node_rank, node_comm);
+   MakeHostShared(face_edge, node_rank, node_comm);
+   MakeHostShared(edge_vertex, node_rank, node_comm);
+
+   MPI_Comm_free(&node_comm);
+}
+
+#endif // MFEM_USE_MPI
+
 void Mesh::InitMesh(int _Dim, int _spaceDim, int NVert, int NElem, int NBdrElem)
 {
    SetEmpty();
@@ -3362,12 +3788,32 @@ Element *Mesh::ReadElement(std::istream &input)
    return el;
 }
 
+void Mesh::PrintElementWithoutAttr(const Element *el, BufferedTextWriter &out)
+{
+   out.WriteInt(el->GetGeometryType());
+   const int nv = el->GetNVertices();
+   const int *v = el->GetVertices();
+   for (int j = 0; j < nv; j++)
+   {
+      out.WriteChar(' ');
+      out.WriteInt(v[j]);
+   }
+   out.WriteChar('\n');
+}
+
 void Mesh::PrintElement(const Element *el, std::ostream &out)
 {
    out << el->GetAttribute() << ' ';
    PrintElementWithoutAttr(el, out);
 }
 
+void Mesh::PrintElement(const Element *el, BufferedTextWriter &out)
+{
+   out.WriteInt(el->GetAttribute());
+   out.WriteChar(' ');
+   PrintElementWithoutAttr(el, out);
+}
+
 void Mesh::SetMeshGen()
 {
    meshgen = mesh_geoms = 0;
@@ -3446,6 +3892,10 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       }
       ReadMFEMMesh(input, mfem_v11, curved);
    }
+   else if (mesh_type == "MFEM binary mesh v1.0")
+   {
+      ReadMFEMBinaryMesh(input, curved, read_gf, finalize_topo);
+   }
    else if (mesh_type == "linemesh") // 1D mesh
    {
       ReadLineMesh(input);
@@ -4215,6 +4665,31 @@ int Mesh::GetNFbyType(FaceType type) const
    return nf;
 }
 
+void Mesh::GetFaceBatchInfo(FaceType type, Array<int> &face_index,
+                            Array<int> &elem_ids, Array<int> &elem_info) const
+{
+   const int nf = GetNFbyType(type);
+   face_index.SetSize(nf);
+   elem_ids.SetSize(2*nf);
+   elem_info.SetSize(2*nf);
+   int i = 0;
+   for (int f = 0; f < GetNumFaces(); f++)
+   {
+      int e1, e2, inf1, inf2;
+      GetFaceElements(f, &e1, &e2);
+      GetFaceInfos(f, &inf1, &inf2);
+      const bool interior = (e2 >= 0 || inf2 >= 0);
+      if ((type == FaceType::Interior) != interior) { continue; }
+      face_index[i] = f;
+      elem_ids[2*i+0] = e1;
+      elem_ids[2*i+1] = e2;
+      elem_info[2*i+0] = inf1;
+      elem_info[2*i+1] = inf2;
+      i++;
+   }
+   MFEM_ASSERT(i == nf, "internal error");
+}
+
 #if (!defined(MFEM_USE_MPI) || defined(MFEM_DEBUG))
 static const char *fixed_or_not[] = { "fixed", "NOT FIXED" };
 #endif
@@ -4865,39 +5340,70 @@ Table *Mesh::GetEdgeVertexTable() const
    return edge_vertex;
 }
 
-Table *Mesh::GetVertexToElementTable()
+void Mesh::UpdateVertexAdjacencyTables()
 {
-   int i, j, nv, *v;
-
-   Table *vert_elem = new Table;
+   VertexAdjacencyTables &adj = vert_adj;
+   if (adj.sequence == sequence) { return; }
 
-   vert_elem->MakeI(NumOfVertices);
-
-   for (i = 0; i < NumOfElements; i++)
+   adj.vert_elem.MakeI(NumOfVertices);
+   for (int i = 0; i < NumOfElements; i++)
    {
-      nv = elements[i]->GetNVertices();
-      v  = elements[i]->GetVertices();
-      for (j = 0; j < nv; j++)
+      const int nv = elements[i]->GetNVertices();
+      const int *v = elements[i]->GetVertices();
+      for (int j = 0; j < nv; j++)
+      {
+         adj.vert_elem.AddAColumnInRow(v[j]);
+      }
+   }
+   adj.vert_elem.MakeJ();
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const int nv = elements[i]->GetNVertices();
+      const int *v = elements[i]->GetVertices();
+      for (int j = 0; j < nv; j++)
       {
-         vert_elem->AddAColumnInRow(v[j]);
+         adj.vert_elem.AddConnection(v[j], i);
       }
    }
+   adj.vert_elem.ShiftUpI();
 
-   vert_elem->MakeJ();
+   // symmetrize the DSTable, which stores each edge only in the row of its
+   // smaller vertex
+   DSTable v_to_v(NumOfVertices);
+   GetVertexToVertexTable(v_to_v);
 
-   for (i = 0; i < NumOfElements; i++)
+   Array<Connection> conn;
+   conn.Reserve(2*v_to_v.NumberOfEntries());
+   for (int i = 0; i < NumOfVertices; i++)
    {
-      nv = elements[i]->GetNVertices();
-      v  = elements[i]->GetVertices();
-      for (j = 0; j < nv; j++)
+      for (DSTable::RowIterator it(v_to_v, i); !it; ++it)
       {
-         vert_elem->AddConnection(v[j], i);
+         conn.Append(Connection(i, it.Column()));
+         conn.Append(Connection(it.Column(), i));
       }
    }
+   conn.Sort();
+   conn.Unique();
+   adj.vert_vert.MakeFromList(NumOfVertices, conn);
+
+   adj.sequence = sequence;
+}
 
-   vert_elem->ShiftUpI();
+const Table &Mesh::VertexToElementTable()
+{
+   UpdateVertexAdjacencyTables();
+   return vert_adj.vert_elem;
+}
+
+const Table &Mesh::VertexToVertexTable()
+{
+   UpdateVertexAdjacencyTables();
+   return vert_adj.vert_vert;
+}
 
-   return vert_elem;
+Table *Mesh::GetVertexToElementTable()
+{
+   return new Table(VertexToElementTable());
 }
 
 Table *Mesh::GetFaceToElementTable() const
@@ -6586,7 +7092,7 @@ void Mesh::SetNode(int i, const double *coord)
    }
 }
 
-void Mesh::MoveNodes(const Vector &displacements)
+void Mesh::MoveNodes(const Vector &displacements, bool refresh_geom_factors)
 {
    if (Nodes)
    {
@@ -6596,6 +7102,7 @@ void Mesh::MoveNodes(const Vector &displacements)
    {
       MoveVertices(displacements);
    }
+   if (refresh_geom_factors) { RefreshGeometricFactors(); }
 }
 
 void Mesh::GetNodes(Vector &node_coord) const
@@ -6610,7 +7117,7 @@ void Mesh::GetNodes(Vector &node_coord) const
    }
 }
 
-void Mesh::SetNodes(const Vector &node_coord)
+void Mesh::SetNodes(const Vector &node_coord, bool refresh_geom_factors)
 {
    if (Nodes)
    {
@@ -6620,6 +7127,7 @@ void Mesh::SetNodes(const Vector &node_coord)
    {
       SetVertices(node_coord);
    }
+   if (refresh_geom_factors) { RefreshGeometricFactors(); }
 }
 
 void Mesh::NewNodes(GridFunction &nodes, bool make_owner)
@@ -6686,12 +7194,17 @@ void Mesh::UniformRefinement2D_base(bool update_nodes)
       NumOfEdges = GetElementToEdgeTable(*el_to_edge, be_to_edge);
    }
 
+   // Assign the index of the new interior vertex of each quad ahead of the
+   // refinement sweep; the numbering depends on the element order.
    int quad_counter = 0;
-   for (int i = 0; i < NumOfElements; i++)
+   Array<int> quad_index;
+   if (HasGeometry(Geometry::SQUARE))
    {
-      if (elements[i]->GetType() == Element::QUADRILATERAL)
+      quad_index.SetSize(NumOfElements);
+      for (int i = 0; i < NumOfElements; i++)
       {
-         quad_counter++;
+         quad_index[i] = (elements[i]->GetType() == Element::QUADRILATERAL) ?
+                         quad_counter++ : -1;
       }
    }
 
@@ -6703,27 +7216,41 @@ void Mesh::UniformRefinement2D_base(bool update_nodes)
 
    vertices.SetSize(oelem + quad_counter);
    new_elements.SetSize(4 * NumOfElements);
-   quad_counter = 0;
 
-   for (int i = 0, j = 0; i < NumOfElements; i++)
+   // Compute the edge midpoint vertices in a sweep over the edges, so that
+   // each new vertex is written exactly once and the loop can be threaded.
+   {
+      Array<int> edge_vert(2*NumOfEdges);
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         const int *v = elements[i]->GetVertices();
+         const int *e = el_to_edge->GetRow(i);
+         const int ne = elements[i]->GetNEdges();
+         for (int j = 0; j < ne; j++)
+         {
+            const int *ev = elements[i]->GetEdgeVertices(j);
+            edge_vert[2*e[j]] = v[ev[0]];
+            edge_vert[2*e[j]+1] = v[ev[1]];
+         }
+      }
+      #pragma omp parallel for
+      for (int i = 0; i < NumOfEdges; i++)
+      {
+         AverageVertices(&edge_vert[2*i], 2, oedge+i);
+      }
+   }
+
+   #pragma omp parallel for
+   for (int i = 0; i < NumOfElements; i++)
    {
       const Element::Type el_type = elements[i]->GetType();
       const int attr = elements[i]->GetAttribute();
       int *v = elements[i]->GetVertices();
       const int *e = el_to_edge->GetRow(i);
-      int vv[2];
+      int j = 4*i;
 
       if (el_type == Element::TRIANGLE)
       {
-         for (int ei = 0; ei < 3; ei++)
-         {
-            for (int k = 0; k < 2; k++)
-            {
-               vv[k] = v[tri_t::Edges[ei][k]];
-            }
-            AverageVertices(vv, 2, oedge+e[ei]);
-         }
-
          new_elements[j++] =
             new Triangle(v[0], oedge+e[0], oedge+e[2], attr);
          new_elements[j++] =
@@ -6735,19 +7262,9 @@ void Mesh::UniformRefinement2D_base(bool update_nodes)
       }
       else if (el_type == Element::QUADRILATERAL)
       {
-         const int qe = quad_counter;
-         quad_counter++;
+         const int qe = quad_index[i];
          AverageVertices(v, 4, oelem+qe);
 
-         for (int ei = 0; ei < 4; ei++)
-         {
-            for (int k = 0; k < 2; k++)
-            {
-               vv[k] = v[quad_t::Edges[ei][k]];
-            }
-            AverageVertices(vv, 2, oedge+e[ei]);
-         }
-
          new_elements[j++] =
             new Quadrilateral(v[0], oedge+e[0], oelem+qe, oedge+e[3], attr);
          new_elements[j++] =
@@ -6767,13 +7284,14 @@ void Mesh::UniformRefinement2D_base(bool update_nodes)
 
    // refine boundary elements
    new_boundary.SetSize(2 * NumOfBdrElements);
-   for (int i = 0, j = 0; i < NumOfBdrElements; i++)
+   #pragma omp parallel for
+   for (int i = 0; i < NumOfBdrElements; i++)
    {
       const int attr = boundary[i]->GetAttribute();
       int *v = boundary[i]->GetVertices();
 
-      new_boundary[j++] = new Segment(v[0], oedge+be_to_edge[i], attr);
-      new_boundary[j++] = new Segment(oedge+be_to_edge[i], v[1], attr);
+      new_boundary[2*i] = new Segment(v[0], oedge+be_to_edge[i], attr);
+      new_boundary[2*i+1] = new Segment(oedge+be_to_edge[i], v[1], attr);
 
       FreeElement(boundary[i]);
    }
@@ -6876,15 +7394,17 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
       }
    }
 
+   // Assign the index of the new interior vertex of each hex ahead of the
+   // refinement sweep; the numbering depends on the element order.
    int hex_counter = 0;
+   Array<int> hex_index;
    if (HasGeometry(Geometry::CUBE))
    {
+      hex_index.SetSize(elements.Size());
       for (int i = 0; i < elements.Size(); i++)
       {
-         if (elements[i]->GetType() == Element::HEXAHEDRON)
-         {
-            hex_counter++;
-         }
+         hex_index[i] = (elements[i]->GetType() == Element::HEXAHEDRON) ?
+                        hex_counter++ : -1;
       }
    }
 
@@ -6948,35 +7468,81 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
    new_elements.SetSize(8 * NumOfElements);
    CoarseFineTr.embeddings.SetSize(new_elements.Size());
 
-   hex_counter = 0;
-   for (int i = 0, j = 0; i < NumOfElements; i++)
+   // Compute the edge midpoint and quad face midpoint vertices in sweeps
+   // over the edges and faces, so that each new vertex is written exactly
+   // once and the loops can be threaded.
    {
-      const Element::Type el_type = elements[i]->GetType();
-      const int attr = elements[i]->GetAttribute();
-      int *v = elements[i]->GetVertices();
-      const int *e = el_to_edge->GetRow(i);
-      int vv[4], ev[12];
-
-      if (e2v.Size())
+      Array<int> edge_vert(2*NumOfEdges);
+      for (int i = 0; i < NumOfElements; i++)
       {
-         const int ne = el_to_edge->RowSize(i);
-         for (int k = 0; k < ne; k++) { ev[k] = e2v[e[k]]; }
-         e = ev;
+         const int *v = elements[i]->GetVertices();
+         const int *e = el_to_edge->GetRow(i);
+         const int ne = elements[i]->GetNEdges();
+         for (int j = 0; j < ne; j++)
+         {
+            const int ei = e2v.Size() ? e2v[e[j]] : e[j];
+            const int *ev = elements[i]->GetEdgeVertices(j);
+            edge_vert[2*ei] = v[ev[0]];
+            edge_vert[2*ei+1] = v[ev[1]];
+         }
       }
-
-      switch (el_type)
+      #pragma omp parallel for
+      for (int i = 0; i < NumOfEdges; i++)
       {
-         case Element::TETRAHEDRON:
+         AverageVertices(&edge_vert[2*i], 2, oedge+i);
+      }
+   }
+   if (NumOfQuadFaces > 0)
+   {
+      #pragma omp parallel for
+      for (int i = 0; i < faces.Size(); i++)
+      {
+         if (faces[i]->GetType() == Element::QUADRILATERAL)
+         {
+            AverageVertices(faces[i]->GetVertices(), 4,
+                            oface + (f2qf.Size() ? f2qf[i] : i));
+         }
+      }
+   }
+
+   // Pre-allocate the tetrahedron children: with MFEM_USE_MEMALLOC the
+   // allocations draw from the shared TetMemory pool and must not run inside
+   // the threaded refinement sweep below.
+   if (HasGeometry(Geometry::TETRAHEDRON))
+   {
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         if (elements[i]->GetType() == Element::TETRAHEDRON)
+         {
+            for (int k = 0; k < 8; k++)
+            {
+               new_elements[8*i+k] = NewElement(Geometry::TETRAHEDRON);
+            }
+         }
+      }
+   }
+
+   #pragma omp parallel for
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const Element::Type el_type = elements[i]->GetType();
+      const int attr = elements[i]->GetAttribute();
+      int *v = elements[i]->GetVertices();
+      const int *e = el_to_edge->GetRow(i);
+      int j = 8*i;
+      int ev[12];
+
+      if (e2v.Size())
+      {
+         const int ne = el_to_edge->RowSize(i);
+         for (int k = 0; k < ne; k++) { ev[k] = e2v[e[k]]; }
+         e = ev;
+      }
+
+      switch (el_type)
+      {
+         case Element::TETRAHEDRON:
          {
-            for (int ei = 0; ei < 6; ei++)
-            {
-               for (int k = 0; k < 2; k++)
-               {
-                  vv[k] = v[tet_t::Edges[ei][k]];
-               }
-               AverageVertices(vv, 2, oedge+e[ei]);
-            }
-
             // Algorithm for choosing refinement type:
             // 0: smallest octahedron diagonal
             // 1: best aspect ratio
@@ -6985,9 +7551,12 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             // 0: (v0,v1)-(v2,v3), 1: (v0,v2)-(v1,v3), 2: (v0,v3)-(v1,v2)
             // 0:      e0-e5,      1:      e1-e4,      2:      e2-e3
             int rt;
-            ElementTransformation *T = GetElementTransformation(i);
-            T->SetIntPoint(&Geometries.GetCenter(Geometry::TETRAHEDRON));
-            const DenseMatrix &J = T->Jacobian();
+            // use a local transformation object: the shared one returned by
+            // GetElementTransformation(int) is not safe in the threaded sweep
+            IsoparametricTransformation T;
+            GetElementTransformation(i, &T);
+            T.SetIntPoint(&Geometries.GetCenter(Geometry::TETRAHEDRON));
+            const DenseMatrix &J = T.Jacobian();
             if (rt_algo == 0)
             {
                // smallest octahedron diagonal
@@ -7099,43 +7668,25 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             };
             const int (&mv)[4][4] = mv_all[rt];
 
-#ifndef MFEM_USE_MEMALLOC
-            new_elements[j+0] =
-               new Tetrahedron(v[0], oedge+e[0], oedge+e[1], oedge+e[2], attr);
-            new_elements[j+1] =
-               new Tetrahedron(oedge+e[0], v[1], oedge+e[3], oedge+e[4], attr);
-            new_elements[j+2] =
-               new Tetrahedron(oedge+e[1], oedge+e[3], v[2], oedge+e[5], attr);
-            new_elements[j+3] =
-               new Tetrahedron(oedge+e[2], oedge+e[4], oedge+e[5], v[3], attr);
-
-            for (int k = 0; k < 4; k++)
-            {
-               new_elements[j+4+k] =
-                  new Tetrahedron(oedge+e[mv[k][0]], oedge+e[mv[k][1]],
-                                  oedge+e[mv[k][2]], oedge+e[mv[k][3]], attr);
-            }
-#else
             Tetrahedron *tet;
-            new_elements[j+0] = tet = TetMemory.Alloc();
+            tet = (Tetrahedron*) new_elements[j+0];
             tet->Init(v[0], oedge+e[0], oedge+e[1], oedge+e[2], attr);
 
-            new_elements[j+1] = tet = TetMemory.Alloc();
+            tet = (Tetrahedron*) new_elements[j+1];
             tet->Init(oedge+e[0], v[1], oedge+e[3], oedge+e[4], attr);
 
-            new_elements[j+2] = tet = TetMemory.Alloc();
+            tet = (Tetrahedron*) new_elements[j+2];
             tet->Init(oedge+e[1], oedge+e[3], v[2], oedge+e[5], attr);
 
-            new_elements[j+3] = tet = TetMemory.Alloc();
+            tet = (Tetrahedron*) new_elements[j+3];
             tet->Init(oedge+e[2], oedge+e[4], oedge+e[5], v[3], attr);
 
             for (int k = 0; k < 4; k++)
             {
-               new_elements[j+4+k] = tet = TetMemory.Alloc();
+               tet = (Tetrahedron*) new_elements[j+4+k];
                tet->Init(oedge+e[mv[k][0]], oedge+e[mv[k][1]],
                          oedge+e[mv[k][2]], oedge+e[mv[k][3]], attr);
             }
-#endif
             for (int k = 0; k < 4; k++)
             {
                CoarseFineTr.embeddings[j+k].parent = i;
@@ -7146,8 +7697,6 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
                CoarseFineTr.embeddings[j+4+k].parent = i;
                CoarseFineTr.embeddings[j+4+k].matrix = 4*(rt+1)+k;
             }
-
-            j += 8;
          }
          break;
 
@@ -7155,24 +7704,6 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
          {
             const int *f = el_to_face->GetRow(i);
 
-            for (int fi = 2; fi < 5; fi++)
-            {
-               for (int k = 0; k < 4; k++)
-               {
-                  vv[k] = v[pri_t::FaceVert[fi][k]];
-               }
-               AverageVertices(vv, 4, oface + f2qf[f[fi]]);
-            }
-
-            for (int ei = 0; ei < 9; ei++)
-            {
-               for (int k = 0; k < 2; k++)
-               {
-                  vv[k] = v[pri_t::Edges[ei][k]];
-               }
-               AverageVertices(vv, 2, oedge+e[ei]);
-            }
-
             const int qf2 = f2qf[f[2]];
             const int qf3 = f2qf[f[3]];
             const int qf4 = f2qf[f[4]];
@@ -7214,8 +7745,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
          case Element::HEXAHEDRON:
          {
             const int *f = el_to_face->GetRow(i);
-            const int he = hex_counter;
-            hex_counter++;
+            const int he = hex_index[i];
 
             const int *qf;
             int qf_data[6];
@@ -7231,24 +7761,6 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             AverageVertices(v, 8, oelem+he);
 
-            for (int fi = 0; fi < 6; fi++)
-            {
-               for (int k = 0; k < 4; k++)
-               {
-                  vv[k] = v[hex_t::FaceVert[fi][k]];
-               }
-               AverageVertices(vv, 4, oface + qf[fi]);
-            }
-
-            for (int ei = 0; ei < 12; ei++)
-            {
-               for (int k = 0; k < 2; k++)
-               {
-                  vv[k] = v[hex_t::Edges[ei][k]];
-               }
-               AverageVertices(vv, 2, oedge+e[ei]);
-            }
-
             new_elements[j++] =
                new Hexahedron(v[0], oedge+e[0], oface+qf[0],
                               oedge+e[3], oedge+e[8], oface+qf[1],
@@ -7288,18 +7800,25 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             MFEM_ABORT("Unknown 3D element type \"" << el_type << "\"");
             break;
       }
+   }
+   // The parent tetrahedra are returned to the TetMemory pool, so free the
+   // parents outside of the threaded sweep.
+   for (int i = 0; i < NumOfElements; i++)
+   {
       FreeElement(elements[i]);
    }
    mfem::Swap(elements, new_elements);
 
    // refine boundary elements
    new_boundary.SetSize(4 * NumOfBdrElements);
-   for (int i = 0, j = 0; i < NumOfBdrElements; i++)
+   #pragma omp parallel for
+   for (int i = 0; i < NumOfBdrElements; i++)
    {
       const Element::Type bdr_el_type = boundary[i]->GetType();
       const int attr = boundary[i]->GetAttribute();
       int *v = boundary[i]->GetVertices();
       const int *e = bel_to_edge->GetRow(i);
+      int j = 4*i;
       int ev[4];
 
       if (e2v.Size())
@@ -7427,6 +7946,317 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
    if (update_nodes) { UpdateNodes(); }
 }
 
+/// Hashed items mapping a vertex pair/triple to an edge/face index; used by
+/// Mesh::UpdateTablesAfterBisection.
+struct IndexedPair : public Hashed2 { int index; };
+struct IndexedTriple : public Hashed4 { int index; };
+
+// Check whether an element was created or modified by the current bisection,
+// i.e. whether it references a vertex created by it.
+static inline bool HasNewVertex(const Element *el, int old_nv)
+{
+   const int *v = el->GetVertices();
+   const int nv = el->GetNVertices();
+   for (int j = 0; j < nv; j++)
+   {
+      if (v[j] >= old_nv) { return true; }
+   }
+   return false;
+}
+
+void Mesh::UpdateTablesAfterBisection(const HashTable<Hashed2> &v_to_v,
+                                      const Array<int> &old_edge_vert,
+                                      int old_nv, int old_ne, int old_nbe)
+{
+   int i, j;
+
+   // The bisection modifies the marked elements in place and appends their
+   // second halves, so the elements and boundary elements that need new rows
+   // in the tables are exactly those that reference a midpoint vertex; all
+   // other rows are copied unchanged. Note that every vertex pair (triple) of
+   // a descendant of a bisected tetrahedron (boundary triangle) with all
+   // vertices from the coarse mesh is an edge (face) of its coarse ancestor,
+   // so the surviving coarse edges and faces of the changed elements can be
+   // looked up in the hash tables built from the stale rows below.
+
+   if (el_to_edge != NULL)
+   {
+      MFEM_ASSERT(bel_to_edge != NULL, "boundary edge table not generated");
+
+      // Recover the vertex-pair-to-index map for the edges of the bisected
+      // elements from their stale rows in 'el_to_edge'.
+      HashTable<IndexedPair> edge_ids;
+      for (i = 0; i < old_ne; i++)
+      {
+         if (!HasNewVertex(elements[i], old_nv)) { continue; }
+         const int *row = el_to_edge->GetRow(i);
+         for (j = 0; j < 6; j++)
+         {
+            edge_ids.Get(old_edge_vert[2*row[j]],
+                         old_edge_vert[2*row[j]+1])->index = row[j];
+         }
+      }
+      // The bisected coarse edges are not referenced anymore: recycle their
+      // indices. (Bisected midpoint edges never received an index.)
+      Array<int> free_edges;
+      for (i = 0; i < v_to_v.NumIds(); i++)
+      {
+         const Hashed2 &bisected = v_to_v[i];
+         if (bisected.p1 < old_nv && bisected.p2 < old_nv)
+         {
+            const IndexedPair *p = edge_ids.Find(bisected.p1, bisected.p2);
+            MFEM_ASSERT(p != NULL, "bisected edge not found");
+            free_edges.Append(p->index);
+         }
+      }
+
+      // Fill the new element-to-edge table: the rows of the changed elements
+      // are resolved through 'edge_ids' for surviving coarse edges, while the
+      // new edges are numbered on first encounter, reusing the freed indices
+      // first so that the numbering stays dense.
+      int next_edge = NumOfEdges;
+      HashTable<IndexedPair> new_edge_ids;
+      Table *e2e = new Table;
+      e2e->SetDims(NumOfElements, 6*NumOfElements);
+      for (i = 0; i <= NumOfElements; i++) { e2e->GetI()[i] = 6*i; }
+      for (i = 0; i < NumOfElements; i++)
+      {
+         int *row = e2e->GetJ() + 6*i;
+         if (i < old_ne && !HasNewVertex(elements[i], old_nv))
+         {
+            const int *old_row = el_to_edge->GetRow(i);
+            for (j = 0; j < 6; j++) { row[j] = old_row[j]; }
+            continue;
+         }
+         const int *v = elements[i]->GetVertices();
+         for (j = 0; j < 6; j++)
+         {
+            const int *ev = elements[i]->GetEdgeVertices(j);
+            const int v0 = v[ev[0]], v1 = v[ev[1]];
+            if (v0 < old_nv && v1 < old_nv)
+            {
+               const IndexedPair *p = edge_ids.Find(v0, v1);
+               MFEM_ASSERT(p != NULL, "edge not found");
+               row[j] = p->index;
+            }
+            else if (const IndexedPair *p = new_edge_ids.Find(v0, v1))
+            {
+               row[j] = p->index;
+            }
+            else
+            {
+               IndexedPair *q = new_edge_ids.Get(v0, v1);
+               if (free_edges.Size() > 0)
+               {
+                  q->index = free_edges.Last();
+                  free_edges.DeleteLast();
+               }
+               else
+               {
+                  q->index = next_edge++;
+               }
+               row[j] = q->index;
+            }
+         }
+      }
+      MFEM_ASSERT(free_edges.Size() == 0, "freed edge indices not reused");
+      delete el_to_edge;
+      el_to_edge = e2e;
+      NumOfEdges = next_edge;
+
+      // Update the boundary-element-to-edge table: the edges of a boundary
+      // triangle are edges of the adjacent tetrahedron, so by this point all
+      // of them are present in 'edge_ids' or 'new_edge_ids'.
+      Table *b2e = new Table;
+      b2e->SetDims(NumOfBdrElements, 3*NumOfBdrElements);
+      for (i = 0; i <= NumOfBdrElements; i++) { b2e->GetI()[i] = 3*i; }
+      for (i = 0; i < NumOfBdrElements; i++)
+      {
+         int *row = b2e->GetJ() + 3*i;
+         if (i < old_nbe && !HasNewVertex(boundary[i], old_nv))
+         {
+            const int *old_row = bel_to_edge->GetRow(i);
+            for (j = 0; j < 3; j++) { row[j] = old_row[j]; }
+            continue;
+         }
+         const int *v = boundary[i]->GetVertices();
+         for (j = 0; j < 3; j++)
+         {
+            const int *ev = boundary[i]->GetEdgeVertices(j);
+            const int v0 = v[ev[0]], v1 = v[ev[1]];
+            const IndexedPair *p = (v0 < old_nv && v1 < old_nv) ?
+                                   edge_ids.Find(v0, v1) :
+                                   new_edge_ids.Find(v0, v1);
+            MFEM_ASSERT(p != NULL, "boundary edge not found");
+            row[j] = p->index;
+         }
+      }
+      delete bel_to_edge;
+      bel_to_edge = b2e;
+   }
+
+   if (el_to_face != NULL)
+   {
+      MFEM_ASSERT(faces.Size() == NumOfFaces, "faces were not generated");
+
+      // Recover the vertex-triple-to-index map for the faces of the bisected
+      // elements from their stale rows in 'el_to_face' and recycle the
+      // indices of the faces destroyed by the bisection, i.e. the faces that
+      // contain a bisected edge.
+      const int old_nfaces = NumOfFaces;
+      HashTable<IndexedTriple> face_ids;
+      Array<int> free_faces;
+      Array<bool> face_dead(old_nfaces);
+      face_dead = false;
+      for (i = 0; i < old_ne; i++)
+      {
+         if (!HasNewVertex(elements[i], old_nv)) { continue; }
+         const int *row = el_to_face->GetRow(i);
+         for (j = 0; j < 4; j++)
+         {
+            const int f = row[j];
+            const int *fv = faces[f]->GetVertices();
+            face_ids.Get(fv[0], fv[1], fv[2])->index = f;
+            if (!face_dead[f] &&
+                (v_to_v.FindId(fv[0], fv[1]) >= 0 ||
+                 v_to_v.FindId(fv[0], fv[2]) >= 0 ||
+                 v_to_v.FindId(fv[1], fv[2]) >= 0))
+            {
+               face_dead[f] = true;
+               free_faces.Append(f);
+            }
+         }
+      }
+
+      // Fill the new element-to-face table, numbering the new faces on first
+      // encounter as in the edge update above.
+      int next_face = NumOfFaces;
+      HashTable<IndexedTriple> new_face_ids;
+      Table *e2f = new Table;
+      e2f->SetDims(NumOfElements, 4*NumOfElements);
+      for (i = 0; i <= NumOfElements; i++) { e2f->GetI()[i] = 4*i; }
+      for (i = 0; i < NumOfElements; i++)
+      {
+         int *row = e2f->GetJ() + 4*i;
+         if (i < old_ne && !HasNewVertex(elements[i], old_nv))
+         {
+            const int *old_row = el_to_face->GetRow(i);
+            for (j = 0; j < 4; j++) { row[j] = old_row[j]; }
+            continue;
+         }
+         const int *v = elements[i]->GetVertices();
+         for (j = 0; j < 4; j++)
+         {
+            const int *fv = tet_t::FaceVert[j];
+            const int v0 = v[fv[0]], v1 = v[fv[1]], v2 = v[fv[2]];
+            if (v0 < old_nv && v1 < old_nv && v2 < old_nv)
+            {
+               const IndexedTriple *t = face_ids.Find(v0, v1, v2);
+               MFEM_ASSERT(t != NULL && !face_dead[t->index],
+                           "face not found");
+               row[j] = t->index;
+            }
+            else if (const IndexedTriple *t = new_face_ids.Find(v0, v1, v2))
+            {
+               row[j] = t->index;
+            }
+            else
+            {
+               IndexedTriple *u = new_face_ids.Get(v0, v1, v2);
+               if (free_faces.Size() > 0)
+               {
+                  u->index = free_faces.Last();
+                  free_faces.DeleteLast();
+               }
+               else
+               {
+                  u->index = next_face++;
+               }
+               row[j] = u->index;
+            }
+         }
+      }
+      MFEM_ASSERT(free_faces.Size() == 0, "freed face indices not reused");
+      delete el_to_face;
+      el_to_face = e2f;
+      NumOfFaces = next_face;
+
+      // Update 'be_to_face': a changed boundary element references a midpoint
+      // vertex, so its face was numbered above through 'new_face_ids'.
+      be_to_face.SetSize(NumOfBdrElements);
+      for (i = 0; i < NumOfBdrElements; i++)
+      {
+         if (i < old_nbe && !HasNewVertex(boundary[i], old_nv)) { continue; }
+         const int *v = boundary[i]->GetVertices();
+         const IndexedTriple *t = new_face_ids.Find(v[0], v[1], v[2]);
+         MFEM_ASSERT(t != NULL, "boundary face not found");
+         be_to_face[i] = t->index;
+      }
+
+      // Patch 'faces' and 'faces_info': reset the entries of the faces
+      // referenced by a changed element and re-generate them as in
+      // GenerateFaces(), in element order so that Elem1 is the lower-indexed
+      // side. The surviving faces shared between a changed and an unchanged
+      // element must be re-registered from both sides, so collect the
+      // unchanged neighbors from the old 'faces_info' first.
+      Array<bool> face_affected(NumOfFaces);
+      face_affected = false;
+      for (i = 0; i < NumOfElements; i++)
+      {
+         if (i < old_ne && !HasNewVertex(elements[i], old_nv)) { continue; }
+         const int *row = el_to_face->GetRow(i);
+         for (j = 0; j < 4; j++) { face_affected[row[j]] = true; }
+      }
+      Array<int> reg_elems;
+      for (int f = 0; f < old_nfaces; f++)
+      {
+         if (!face_affected[f] || face_dead[f]) { continue; }
+         const FaceInfo &fi = faces_info[f];
+         if (fi.Elem1No >= 0 && !HasNewVertex(elements[fi.Elem1No], old_nv))
+         {
+            reg_elems.Append(fi.Elem1No);
+         }
+         if (fi.Elem2No >= 0 && !HasNewVertex(elements[fi.Elem2No], old_nv))
+         {
+            reg_elems.Append(fi.Elem2No);
+         }
+      }
+      for (i = 0; i < NumOfElements; i++)
+      {
+         if (i >= old_ne || HasNewVertex(elements[i], old_nv))
+         {
+            reg_elems.Append(i);
+         }
+      }
+      reg_elems.Sort();
+      reg_elems.Unique();
+
+      faces.SetSize(NumOfFaces);
+      faces_info.SetSize(NumOfFaces);
+      for (int f = old_nfaces; f < NumOfFaces; f++) { faces[f] = NULL; }
+      for (int f = 0; f < NumOfFaces; f++)
+      {
+         if (f < old_nfaces && !face_affected[f]) { continue; }
+         FreeElement(faces[f]);
+         faces[f] = NULL;
+         faces_info[f].Elem1No = -1;
+         faces_info[f].NCFace = -1;
+      }
+      for (int k = 0; k < reg_elems.Size(); k++)
+      {
+         i = reg_elems[k];
+         const int *v = elements[i]->GetVertices();
+         const int *row = el_to_face->GetRow(i);
+         for (j = 0; j < 4; j++)
+         {
+            if (!face_affected[row[j]]) { continue; }
+            const int *fv = tet_t::FaceVert[j];
+            AddTriangleFaceElement(j, row[j], i, v[fv[0]], v[fv[1]], v[fv[2]]);
+         }
+      }
+   }
+}
+
 void Mesh::LocalRefinement(const Array<int> &marked_el, int type)
 {
    int i, j, ind, nedges;
@@ -7569,6 +8399,29 @@ void Mesh::LocalRefinement(const Array<int> &marked_el, int type)
                   "tetrahedral mesh is not marked for refinement:"
                   " call Finalize(true)");
 
+      // Capture the pre-refinement sizes and the edge vertices: the bisected
+      // elements are modified in place and no longer reference their original
+      // edges, while their rows in 'el_to_edge' are updated only in step 5.
+      const int old_nv = NumOfVertices;
+      const int old_ne = NumOfElements;
+      const int old_nbe = NumOfBdrElements;
+      Array<int> old_edge_vert;
+      if (el_to_edge != NULL)
+      {
+         old_edge_vert.SetSize(2*NumOfEdges);
+         for (i = 0; i < NumOfElements; i++)
+         {
+            const int *v = elements[i]->GetVertices();
+            const int *row = el_to_edge->GetRow(i);
+            for (j = 0; j < 6; j++)
+            {
+               const int *ev = elements[i]->GetEdgeVertices(j);
+               old_edge_vert[2*row[j]] = v[ev[0]];
+               old_edge_vert[2*row[j]+1] = v[ev[1]];
+            }
+         }
+      }
+
       // 2. Do the red refinement.
       int ii;
       switch (type)
@@ -7646,16 +8499,10 @@ void Mesh::LocalRefinement(const Array<int> &marked_el, int type)
       NumOfVertices = vertices.Size();
       NumOfBdrElements = boundary.Size();
 
-      // 5. Update element-to-edge and element-to-face relations.
-      if (el_to_edge != NULL)
-      {
-         NumOfEdges = GetElementToEdgeTable(*el_to_edge, be_to_edge);
-      }
-      if (el_to_face != NULL)
-      {
-         GetElementToFaceTable();
-         GenerateFaces();
-      }
+      // 5. Update element-to-edge and element-to-face relations, visiting
+      //    only the elements and boundary elements changed by the bisection.
+      UpdateTablesAfterBisection(v_to_v, old_edge_vert, old_nv, old_ne,
+                                 old_nbe);
 
    } //  end 'if (Dim == 3)'
 
@@ -7894,6 +8741,13 @@ void Mesh::Swap(Mesh& other, bool non_geometry)
 
    mfem::Swap(geom_factors, other.geom_factors);
 
+   // Swap() does not exchange #sequence, so the cached VTU topology and
+   // element BVH of both meshes cannot be trusted afterwards.
+   vtu_topology.sequence = -1;
+   other.vtu_topology.sequence = -1;
+   element_bvh.sequence = -1;
+   other.element_bvh.sequence = -1;
+
 #ifdef MFEM_USE_MEMALLOC
    TetMemory.Swap(other.TetMemory);
 #endif
@@ -8750,18 +9604,25 @@ void Mesh::Printer(std::ostream &out, std::string section_delimiter) const
        "# PRISM       = 6\n"
        "#\n";
 
+   // The large sections below are written with a BufferedTextWriter: the
+   // values are formatted in bulk into a preallocated buffer instead of
+   // going through operator<< one by one, see general/text.hpp.
+   BufferedTextWriter buf_out(out);
+
    out << "\ndimension\n" << Dim
        << "\n\nelements\n" << NumOfElements << '\n';
    for (i = 0; i < NumOfElements; i++)
    {
-      PrintElement(elements[i], out);
+      PrintElement(elements[i], buf_out);
    }
+   buf_out.Flush();
 
    out << "\nboundary\n" << NumOfBdrElements << '\n';
    for (i = 0; i < NumOfBdrElements; i++)
    {
-      PrintElement(boundary[i], out);
+      PrintElement(boundary[i], buf_out);
    }
+   buf_out.Flush();
 
    if (ncmesh)
    {
@@ -8778,13 +9639,15 @@ void Mesh::Printer(std::ostream &out, std::string section_delimiter) const
       out << spaceDim << '\n';
       for (i = 0; i < NumOfVertices; i++)
       {
-         out << vertices[i](0);
+         buf_out.WriteDouble(vertices[i](0));
          for (j = 1; j < spaceDim; j++)
          {
-            out << ' ' << vertices[i](j);
+            buf_out.WriteChar(' ');
+            buf_out.WriteDouble(vertices[i](j));
          }
-         out << '\n';
+         buf_out.WriteChar('\n');
       }
+      buf_out.Flush();
       out.flush();
    }
    else
@@ -8799,6 +9662,80 @@ void Mesh::Printer(std::ostream &out, std::string section_delimiter) const
    }
 }
 
+void Mesh::PrintBinary(std::ostream &out) const
+{
+   MFEM_VERIFY(!NURBSext && !ncmesh, "the binary mesh format does not support"
+               " NURBS or non-conforming meshes");
+
+   out << "MFEM binary mesh v1.0\n";
+   bin_io::write<int>(out, Dim);
+   bin_io::write<int>(out, spaceDim);
+
+   // Elements and boundary: the geometry types, the attributes, and the
+   // vertex indices of each section are stored as contiguous arrays, so a
+   // reader can load (or memory map) them with bulk operations.
+   for (int sec = 0; sec < 2; sec++)
+   {
+      const Array<Element *> &elems = (sec == 0) ? elements : boundary;
+      const int num = (sec == 0) ? NumOfElements : NumOfBdrElements;
+
+      bin_io::write<int>(out, num);
+      Array<int> ibuf(num);
+      for (int j = 0; j < num; j++)
+      {
+         ibuf[j] = elems[j]->GetGeometryType();
+      }
+      bin_io::write_array(out, ibuf.GetData(), num);
+      for (int j = 0; j < num; j++)
+      {
+         ibuf[j] = elems[j]->GetAttribute();
+      }
+      bin_io::write_array(out, ibuf.GetData(), num);
+      std::int64_t num_ind = 0;
+      for (int j = 0; j < num; j++) { num_ind += elems[j]->GetNVertices(); }
+      bin_io::write<std::int64_t>(out, num_ind);
+      for (int j = 0; j < num; j++)
+      {
+         out.write((const char*)elems[j]->GetVertices(),
+                   elems[j]->GetNVertices()*sizeof(int));
+      }
+   }
+
+   bin_io::write<int>(out, NumOfVertices);
+   if (spaceDim == 3)
+   {
+      // a Vertex stores 3 coordinates: write the whole section at once
+      if (NumOfVertices > 0)
+      {
+         out.write((const char*)&vertices[0](0),
+                   (size_t)NumOfVertices*3*sizeof(double));
+      }
+   }
+   else
+   {
+      for (int j = 0; j < NumOfVertices; j++)
+      {
+         out.write((const char*)&vertices[j](0), spaceDim*sizeof(double));
+      }
+   }
+
+   bin_io::write<int>(out, Nodes ? 1 : 0);
+   if (Nodes)
+   {
+      const FiniteElementSpace *nfes = Nodes->FESpace();
+      const char *name = nfes->FEColl()->Name();
+      const int name_len = (int)std::strlen(name);
+      bin_io::write<int>(out, name_len);
+      out.write(name, name_len);
+      bin_io::write<int>(out, nfes->GetVDim());
+      bin_io::write<int>(out, nfes->GetOrdering());
+      bin_io::write<std::int64_t>(out, Nodes->Size());
+      out.write((const char*)Nodes->GetData(),
+                (size_t)Nodes->Size()*sizeof(double));
+   }
+   out.flush();
+}
+
 void Mesh::PrintTopo(std::ostream &out,const Array<int> &e_to_k) const
 {
    int i;
@@ -9116,192 +10053,241 @@ void WriteBase64WithSizeAndClear(std::ostream &out, std::vector<char> &buf,
    buf.clear();
 }
 
-void Mesh::PrintVTU(std::ostream &out, int ref, VTKFormat format,
-                    bool high_order_output, int compression_level)
+// VTK cell type of the given geometry, cf. https://git.io/JvZLm
+static uint8_t VTKCellType(Geometry::Type geom, bool high_order)
 {
-   RefinedGeometry *RefG;
-   DenseMatrix pmat;
+   switch (geom)
+   {
+      case Geometry::POINT:       return 1;
+      case Geometry::SEGMENT:     return high_order ? 68 : 3;
+      case Geometry::TRIANGLE:    return high_order ? 69 : 5;
+      case Geometry::SQUARE:      return high_order ? 70 : 9;
+      case Geometry::TETRAHEDRON: return high_order ? 71 : 10;
+      case Geometry::CUBE:        return high_order ? 72 : 12;
+      case Geometry::PRISM:       return high_order ? 73 : 13;
+      default:
+         MFEM_ABORT("Unrecognized VTK element type \"" << geom << "\"");
+         return 0;
+   }
+}
 
-   const char *fmt_str = (format == VTKFormat::ASCII) ? "ascii" : "binary";
-   const char *type_str = (format != VTKFormat::BINARY32) ? "Float64" : "Float32";
-   std::vector<char> buf;
+void Mesh::UpdateVTUTopology(int ref, bool high_order)
+{
+   VTUTopology &topo = vtu_topology;
+   if (topo.sequence == sequence && topo.ref == ref &&
+       topo.high_order == high_order)
+   {
+      return;
+   }
+   topo.sequence = sequence;
+   topo.ref = ref;
+   topo.high_order = high_order;
 
-   // count the points, cells, size
-   int np = 0, nc_ref = 0, size = 0;
+   // count the points, cells, connectivity entries
+   int np = 0, ncells = 0, size = 0;
    for (int i = 0; i < GetNE(); i++)
    {
       Geometry::Type geom = GetElementBaseGeometry(i);
-      int nv = Geometries.GetVertices(geom)->GetNPoints();
-      RefG = GlobGeometryRefiner.Refine(geom, ref, 1);
+      RefinedGeometry *RefG = GlobGeometryRefiner.Refine(geom, ref, 1);
       np += RefG->RefPts.GetNPoints();
-      nc_ref += RefG->RefGeoms.Size() / nv;
-      size += (RefG->RefGeoms.Size() / nv) * (nv + 1);
-   }
-
-   out << "<Piece NumberOfPoints=\"" << np << "\" NumberOfCells=\""
-       << (high_order_output ? GetNE() : nc_ref) << "\">\n";
-
-   // print out the points
-   out << "<Points>\n";
-   out << "<DataArray type=\"" << type_str
-       << "\" NumberOfComponents=\"3\" format=\"" << fmt_str << "\">\n";
-   for (int i = 0; i < GetNE(); i++)
-   {
-      RefG = GlobGeometryRefiner.Refine(
-                GetElementBaseGeometry(i), ref, 1);
+      if (high_order)
+      {
+         ncells++;
+         size += RefG->RefPts.GetNPoints();
+      }
+      else
+      {
+         int nv = Geometries.GetVertices(geom)->GetNPoints();
+         ncells += RefG->RefGeoms.Size() / nv;
+         size += RefG->RefGeoms.Size();
+      }
+   }
+   topo.np = np;
+   topo.ncells = ncells;
+   topo.connectivity.SetSize(size);
+   topo.offsets.SetSize(ncells);
+   topo.types.SetSize(ncells);
 
-      GetElementTransformation(i)->Transform(RefG->RefPts, pmat);
+   // The node permutation of CreateVTKElementConnectivity() depends only on
+   // the geometry type, so compute it once per geometry, not per element.
+   Array<int> geom_connectivity[Geometry::NumGeom];
 
-      for (int j = 0; j < pmat.Width(); j++)
+   np = 0;
+   int cell = 0, conn = 0;
+   for (int i = 0; i < GetNE(); i++)
+   {
+      Geometry::Type geom = GetElementBaseGeometry(i);
+      const uint8_t vtk_cell_type = VTKCellType(geom, high_order);
+      if (high_order)
       {
-         WriteBinaryOrASCII(out, buf, pmat(0,j), " ", format);
-         if (pmat.Height() > 1)
-         {
-            WriteBinaryOrASCII(out, buf, pmat(1,j), " ", format);
-         }
-         else
+         Array<int> &local_connectivity = geom_connectivity[geom];
+         if (local_connectivity.Size() == 0)
          {
-            WriteBinaryOrASCII(out, buf, 0.0, " ", format);
+            CreateVTKElementConnectivity(local_connectivity, geom, ref);
          }
-         if (pmat.Height() > 2)
+         const int nnodes = local_connectivity.Size();
+         for (int j = 0; j < nnodes; j++)
          {
-            WriteBinaryOrASCII(out, buf, pmat(2,j), "", format);
+            topo.connectivity[conn++] = np + local_connectivity[j];
          }
-         else
+         np += nnodes;
+         topo.offsets[cell] = conn;
+         topo.types[cell++] = vtk_cell_type;
+      }
+      else
+      {
+         int nv = Geometries.GetVertices(geom)->GetNPoints();
+         RefinedGeometry *RefG = GlobGeometryRefiner.Refine(geom, ref, 1);
+         Array<int> &RG = RefG->RefGeoms;
+         for (int j = 0; j < RG.Size(); )
          {
-            WriteBinaryOrASCII(out, buf, 0.0, "", format);
+            for (int k = 0; k < nv; k++, j++)
+            {
+               topo.connectivity[conn++] = np + RG[j];
+            }
+            topo.offsets[cell] = conn;
+            topo.types[cell++] = vtk_cell_type;
          }
-         if (format == VTKFormat::ASCII) { out << '\n'; }
+         np += RefG->RefPts.GetNPoints();
       }
    }
-   if (format != VTKFormat::ASCII)
-   {
-      WriteBase64WithSizeAndClear(out, buf, compression_level);
-   }
-   out << "</DataArray>" << std::endl;
-   out << "</Points>" << std::endl;
+}
 
-   out << "<Cells>" << std::endl;
-   out << "<DataArray type=\"Int32\" Name=\"connectivity\" format=\""
-       << fmt_str << "\">" << std::endl;
-   // connectivity
-   std::vector<int> offset;
+void Mesh::PrintVTU(std::ostream &out, int ref, VTKFormat format,
+                    bool high_order_output, int compression_level)
+{
+   RefinedGeometry *RefG;
+   DenseMatrix pmat;
 
-   np = 0;
-   if (high_order_output)
+   const char *fmt_str = (format == VTKFormat::ASCII) ? "ascii" : "binary";
+   const char *type_str = (format != VTKFormat::BINARY32) ? "Float64" : "Float32";
+   std::vector<char> buf;
+
+   UpdateVTUTopology(ref, high_order_output);
+   const VTUTopology &topo = vtu_topology;
+
+   out << "<Piece NumberOfPoints=\"" << topo.np << "\" NumberOfCells=\""
+       << topo.ncells << "\">\n";
+
+   // print out the points
+   out << "<Points>\n";
+   out << "<DataArray type=\"" << type_str
+       << "\" NumberOfComponents=\"3\" format=\"" << fmt_str << "\">\n";
+   if (format == VTKFormat::BINARY)
    {
-      Array<int> local_connectivity;
-      for (int iel = 0; iel < GetNE(); iel++)
+      // Assemble the (zero-padded) coordinates into one contiguous Vector
+      // and encode it with a single call, instead of appending the values
+      // one by one to an intermediate byte buffer.
+      Vector points(3*topo.np);
+      int pt = 0;
+      for (int i = 0; i < GetNE(); i++)
       {
-         Geometry::Type geom = GetElementBaseGeometry(iel);
-         CreateVTKElementConnectivity(local_connectivity, geom, ref);
-         int nnodes = local_connectivity.Size();
-         for (int i=0; i<nnodes; ++i)
+         RefG = GlobGeometryRefiner.Refine(GetElementBaseGeometry(i), ref, 1);
+         GetElementTransformation(i)->Transform(RefG->RefPts, pmat);
+         for (int j = 0; j < pmat.Width(); j++)
          {
-            WriteBinaryOrASCII(out, buf, np+local_connectivity[i], " ", format);
+            points(pt++) = pmat(0,j);
+            points(pt++) = (pmat.Height() > 1) ? pmat(1,j) : 0.0;
+            points(pt++) = (pmat.Height() > 2) ? pmat(2,j) : 0.0;
          }
-         if (format == VTKFormat::ASCII) { out << '\n'; }
-         np += nnodes;
-         offset.push_back(np);
       }
+      WriteVTKEncodedCompressed(out, points.GetData(),
+                                points.Size()*sizeof(double),
+                                compression_level);
+      out << '\n';
    }
    else
    {
-      int coff = 0;
       for (int i = 0; i < GetNE(); i++)
       {
-         Geometry::Type geom = GetElementBaseGeometry(i);
-         int nv = Geometries.GetVertices(geom)->GetNPoints();
-         RefG = GlobGeometryRefiner.Refine(geom, ref, 1);
-         Array<int> &RG = RefG->RefGeoms;
-         for (int j = 0; j < RG.Size(); )
+         RefG = GlobGeometryRefiner.Refine(GetElementBaseGeometry(i), ref, 1);
+         GetElementTransformation(i)->Transform(RefG->RefPts, pmat);
+         for (int j = 0; j < pmat.Width(); j++)
          {
-            // out << nv;
-            coff = coff+nv;
-            offset.push_back(coff);
-
-            for (int k = 0; k < nv; k++, j++)
+            WriteBinaryOrASCII(out, buf, pmat(0,j), " ", format);
+            if (pmat.Height() > 1)
             {
-               WriteBinaryOrASCII(out, buf, np + RG[j], " ", format);
+               WriteBinaryOrASCII(out, buf, pmat(1,j), " ", format);
+            }
+            else
+            {
+               WriteBinaryOrASCII(out, buf, 0.0, " ", format);
+            }
+            if (pmat.Height() > 2)
+            {
+               WriteBinaryOrASCII(out, buf, pmat(2,j), "", format);
+            }
+            else
+            {
+               WriteBinaryOrASCII(out, buf, 0.0, "", format);
             }
             if (format == VTKFormat::ASCII) { out << '\n'; }
          }
-         np += RefG->RefPts.GetNPoints();
+      }
+      if (format != VTKFormat::ASCII)
+      {
+         WriteBase64WithSizeAndClear(out, buf, compression_level);
       }
    }
-   if (format != VTKFormat::ASCII)
+   out << "</DataArray>" << std::endl;
+   out << "</Points>" << std::endl;
+
+   // The topology sections are encoded directly from the cached arrays.
+   out << "<Cells>" << std::endl;
+   out << "<DataArray type=\"Int32\" Name=\"connectivity\" format=\""
+       << fmt_str << "\">" << std::endl;
+   if (format == VTKFormat::ASCII)
    {
-      WriteBase64WithSizeAndClear(out, buf, compression_level);
+      int cell = 0;
+      for (int j = 0; j < topo.connectivity.Size(); j++)
+      {
+         out << topo.connectivity[j];
+         if (j+1 == topo.offsets[cell]) { out << '\n'; cell++; }
+         else { out << ' '; }
+      }
+   }
+   else
+   {
+      WriteVTKEncodedCompressed(out, topo.connectivity.GetData(),
+                                topo.connectivity.Size()*sizeof(int),
+                                compression_level);
+      out << '\n';
    }
    out << "</DataArray>" << std::endl;
 
    out << "<DataArray type=\"Int32\" Name=\"offsets\" format=\""
        << fmt_str << "\">" << std::endl;
-   // offsets
-   for (size_t ii=0; ii<offset.size(); ii++)
+   if (format == VTKFormat::ASCII)
    {
-      WriteBinaryOrASCII(out, buf, offset[ii], "\n", format);
+      for (int i = 0; i < topo.offsets.Size(); i++)
+      {
+         out << topo.offsets[i] << '\n';
+      }
    }
-   if (format != VTKFormat::ASCII)
+   else
    {
-      WriteBase64WithSizeAndClear(out, buf, compression_level);
+      WriteVTKEncodedCompressed(out, topo.offsets.GetData(),
+                                topo.offsets.Size()*sizeof(int),
+                                compression_level);
+      out << '\n';
    }
    out << "</DataArray>" << std::endl;
+
    out << "<DataArray type=\"UInt8\" Name=\"types\" format=\""
        << fmt_str << "\">" << std::endl;
-   // cell types
-   for (int i = 0; i < GetNE(); i++)
+   if (format == VTKFormat::ASCII)
    {
-      Geometry::Type geom = GetElementBaseGeometry(i);
-      uint8_t vtk_cell_type = 5;
-
-      // VTK element types defined at: https://git.io/JvZLm
-      switch (geom)
-      {
-         case Geometry::POINT:
-            vtk_cell_type = 1;
-            break;
-         case Geometry::SEGMENT:
-            vtk_cell_type = high_order_output ? 68 : 3;
-            break;
-         case Geometry::TRIANGLE:
-            vtk_cell_type = high_order_output ? 69 : 5;
-            break;
-         case Geometry::SQUARE:
-            vtk_cell_type = high_order_output ? 70 : 9;
-            break;
-         case Geometry::TETRAHEDRON:
-            vtk_cell_type = high_order_output ? 71 : 10;
-            break;
-         case Geometry::CUBE:
-            vtk_cell_type = high_order_output ? 72 : 12;
-            break;
-         case Geometry::PRISM:
-            vtk_cell_type = high_order_output ? 73 : 13;
-            break;
-         default:
-            MFEM_ABORT("Unrecognized VTK element type \"" << geom << "\"");
-            break;
-      }
-
-      if (high_order_output)
+      for (int i = 0; i < topo.types.Size(); i++)
       {
-         WriteBinaryOrASCII(out, buf, vtk_cell_type, "\n", format);
-      }
-      else
-      {
-         int nv = Geometries.GetVertices(geom)->GetNPoints();
-         RefG = GlobGeometryRefiner.Refine(geom, ref, 1);
-         Array<int> &RG = RefG->RefGeoms;
-         for (int j = 0; j < RG.Size(); j += nv)
-         {
-            WriteBinaryOrASCII(out, buf, vtk_cell_type, "\n", format);
-         }
+         out << (int)topo.types[i] << '\n';
       }
    }
-   if (format != VTKFormat::ASCII)
+   else
    {
-      WriteBase64WithSizeAndClear(out, buf, compression_level);
+      WriteVTKEncodedCompressed(out, topo.types.GetData(),
+                                topo.types.Size()*sizeof(uint8_t),
+                                compression_level);
+      out << '\n';
    }
    out << "</DataArray>" << std::endl;
    out << "</Cells>" << std::endl;
@@ -10535,6 +11521,275 @@ std::ostream &operator<<(std::ostream &out, const Mesh &mesh)
    return out;
 }
 
+void Mesh::UpdateAttributeElementLists()
+{
+   AttributeElementLists &lists = attr_elem_lists;
+   if (lists.sequence == sequence && lists.elems.Size() == attributes.Size())
+   {
+      return;
+   }
+
+   lists.elems.MakeI(attributes.Size());
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const int row = attributes.FindSorted(GetAttribute(i));
+      MFEM_ASSERT(row >= 0, "element attribute not in Mesh::attributes");
+      lists.elems.AddAColumnInRow(row);
+   }
+   lists.elems.MakeJ();
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      lists.elems.AddConnection(attributes.FindSorted(GetAttribute(i)), i);
+   }
+   lists.elems.ShiftUpI();
+   lists.sequence = sequence;
+}
+
+const Table &Mesh::GetAttributeToElementTable()
+{
+   UpdateAttributeElementLists();
+   return attr_elem_lists.elems;
+}
+
+void Mesh::GetElementsWithAttribute(int attr, Array<int> &elems)
+{
+   UpdateAttributeElementLists();
+   elems.SetSize(0);
+   const int row = attributes.FindSorted(attr);
+   if (row < 0) { return; }
+   const Table &table = attr_elem_lists.elems;
+   elems.Append(table.GetRow(row), table.RowSize(row));
+}
+
+void Mesh::UpdateElementBVH()
+{
+   ElementBVH &bvh = element_bvh;
+   if (bvh.sequence == sequence && bvh.elems.Size() == NumOfElements)
+   {
+      return;
+   }
+
+   const int NE = NumOfElements;
+   // Per-element bounding boxes and centers, padded to 3D. For curved
+   // meshes the boxes of the element node positions are inflated, since a
+   // curved boundary can bulge beyond the hull of the nodes; containment is
+   // verified exactly in FindPoints(), so the inflation only needs to be
+   // generous enough to keep the right elements among the candidates.
+   Array<double> &elem_bounds = bvh.elem_bounds;
+   elem_bounds.SetSize(6*NE);
+   bvh.centers.SetSize(3*NE);
+   Array<int> vert;
+   Vector node_coords;
+   Array<int> vdofs;
+   const double rel_pad = Nodes ? 0.1 : 0.0;
+   for (int i = 0; i < NE; i++)
+   {
+      double *box = &elem_bounds[6*i];
+      for (int d = 0; d < 3; d++)
+      {
+         box[d] = (d < spaceDim) ? infinity() : 0.0;
+         box[3+d] = (d < spaceDim) ? -infinity() : 0.0;
+      }
+      if (Nodes)
+      {
+         Nodes->FESpace()->GetElementVDofs(i, vdofs);
+         Nodes->GetSubVector(vdofs, node_coords);
+         const int ndofs = vdofs.Size()/spaceDim;
+         const bool byNODES =
+            (Nodes->FESpace()->GetOrdering() == Ordering::byNODES);
+         for (int j = 0; j < ndofs; j++)
+         {
+            for (int d = 0; d < spaceDim; d++)
+            {
+               const double c = byNODES ? node_coords(d*ndofs + j) :
+                                node_coords(j*spaceDim + d);
+               box[d] = std::min(box[d], c);
+               box[3+d] = std::max(box[3+d], c);
+            }
+         }
+      }
+      else
+      {
+         GetElementVertices(i, vert);
+         for (int j = 0; j < vert.Size(); j++)
+         {
+            const double *c = vertices[vert[j]]();
+            for (int d = 0; d < spaceDim; d++)
+            {
+               box[d] = std::min(box[d], c[d]);
+               box[3+d] = std::max(box[3+d], c[d]);
+            }
+         }
+      }
+      for (int d = 0; d < spaceDim; d++)
+      {
+         const double pad = rel_pad*(box[3+d] - box[d]) + 1e-12;
+         box[d] -= pad;
+         box[3+d] += pad;
+         bvh.centers[3*i + d] = 0.5*(box[d] + box[3+d]);
+      }
+      for (int d = spaceDim; d < 3; d++) { bvh.centers[3*i + d] = 0.0; }
+   }
+
+   bvh.elems.SetSize(NE);
+   for (int i = 0; i < NE; i++) { bvh.elems[i] = i; }
+
+   // Build the tree top-down, splitting each node at the median of the
+   // element centers along the widest axis; ranges of at most 8 elements
+   // become leaves.
+   struct BuildNode { double box[6]; int child[2]; };
+   struct Range { int node, begin, end; };
+   std::vector<BuildNode> nodes(1);
+   std::vector<Range> stack(1, Range{0, 0, NE});
+   const double *centers = bvh.centers.GetData();
+   while (!stack.empty())
+   {
+      const Range r = stack.back();
+      stack.pop_back();
+      BuildNode nd;
+      for (int d = 0; d < 3; d++)
+      {
+         nd.box[d] = infinity();
+         nd.box[3+d] = -infinity();
+      }
+      for (int j = r.begin; j < r.end; j++)
+      {
+         const double *box = &elem_bounds[6*bvh.elems[j]];
+         for (int d = 0; d < 3; d++)
+         {
+            nd.box[d] = std::min(nd.box[d], box[d]);
+            nd.box[3+d] = std::max(nd.box[3+d], box[3+d]);
+         }
+      }
+      if (r.end - r.begin <= 8)
+      {
+         nd.child[0] = ~r.begin;
+         nd.child[1] = r.end - r.begin;
+      }
+      else
+      {
+         int axis = 0;
+         double cmin[3], cmax[3];
+         for (int d = 0; d < 3; d++) { cmin[d] = infinity(); cmax[d] = -infinity(); }
+         for (int j = r.begin; j < r.end; j++)
+         {
+            const double *c = centers + 3*bvh.elems[j];
+            for (int d = 0; d < 3; d++)
+            {
+               cmin[d] = std::min(cmin[d], c[d]);
+               cmax[d] = std::max(cmax[d], c[d]);
+            }
+         }
+         for (int d = 1; d < 3; d++)
+         {
+            if (cmax[d] - cmin[d] > cmax[axis] - cmin[axis]) { axis = d; }
+         }
+         const int mid = (r.begin + r.end)/2;
+         std::nth_element(&bvh.elems[r.begin], &bvh.elems[mid],
+                          &bvh.elems[0] + r.end,
+                          [centers,axis](int a, int b)
+         { return centers[3*a + axis] < centers[3*b + axis]; });
+         nd.child[0] = (int)nodes.size();
+         nd.child[1] = nd.child[0] + 1;
+         nodes.resize(nodes.size() + 2);
+         stack.push_back(Range{nd.child[0], r.begin, mid});
+         stack.push_back(Range{nd.child[1], mid, r.end});
+      }
+      nodes[r.node] = nd;
+   }
+
+   bvh.bounds.SetSize(6*(int)nodes.size());
+   bvh.children.SetSize(2*(int)nodes.size());
+   for (size_t n = 0; n < nodes.size(); n++)
+   {
+      for (int d = 0; d < 6; d++) { bvh.bounds[6*n + d] = nodes[n].box[d]; }
+      bvh.children[2*n] = nodes[n].child[0];
+      bvh.children[2*n + 1] = nodes[n].child[1];
+   }
+   bvh.sequence = sequence;
+}
+
+int Mesh::SearchElementBVH(const double *xyz, Array<int> &candidates) const
+{
+   const ElementBVH &bvh = element_bvh;
+   // squared distance from the point to a box, 0 when inside
+   auto box_dist = [xyz](const double *box)
+   {
+      double d2 = 0.0;
+      for (int d = 0; d < 3; d++)
+      {
+         const double gap = std::max(box[d] - xyz[d], xyz[d] - box[3+d]);
+         if (gap > 0.0) { d2 += gap*gap; }
+      }
+      return d2;
+   };
+
+   double best_dist = infinity();
+   int best_elem = -1;
+   int stack[64], top = 0;
+   stack[top++] = 0;
+   while (top > 0)
+   {
+      const int n = stack[--top];
+      // visit nodes whose box contains the point (candidate collection) or
+      // is closer than the best center found so far (nearest element)
+      if (box_dist(&bvh.bounds[6*n]) >= best_dist) { continue; }
+      const int c0 = bvh.children[2*n];
+      if (c0 < 0) // leaf
+      {
+         const int begin = ~c0, count = bvh.children[2*n + 1];
+         for (int j = begin; j < begin + count; j++)
+         {
+            const int e = bvh.elems[j];
+            const double *c = &bvh.centers[3*e];
+            const double d2 = (c[0] - xyz[0])*(c[0] - xyz[0]) +
+                              (c[1] - xyz[1])*(c[1] - xyz[1]) +
+                              (c[2] - xyz[2])*(c[2] - xyz[2]);
+            if (d2 < best_dist) { best_dist = d2; best_elem = e; }
+         }
+      }
+      else
+      {
+         // push the farther child first so the nearer one is visited next
+         const int c1 = bvh.children[2*n + 1];
+         const bool near0 = box_dist(&bvh.bounds[6*c0]) <=
+                            box_dist(&bvh.bounds[6*c1]);
+         stack[top++] = near0 ? c1 : c0;
+         stack[top++] = near0 ? c0 : c1;
+         MFEM_ASSERT(top <= 64, "BVH traversal stack overflow");
+      }
+   }
+
+   // second pass: collect the elements whose box contains the point
+   top = 0;
+   stack[top++] = 0;
+   while (top > 0)
+   {
+      const int n = stack[--top];
+      if (box_dist(&bvh.bounds[6*n]) > 0.0) { continue; }
+      const int c0 = bvh.children[2*n];
+      if (c0 < 0)
+      {
+         const int begin = ~c0, count = bvh.children[2*n + 1];
+         for (int j = begin; j < begin + count; j++)
+         {
+            const int e = bvh.elems[j];
+            if (box_dist(&bvh.elem_bounds[6*e]) == 0.0)
+            {
+               candidates.Append(e);
+            }
+         }
+      }
+      else
+      {
+         stack[top++] = c0;
+         stack[top++] = bvh.children[2*n + 1];
+         MFEM_ASSERT(top <= 64, "BVH traversal stack overflow");
+      }
+   }
+   return best_elem;
+}
+
 int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
                      Array<IntegrationPoint>& ips, bool warn,
                      InverseElementTransformation *inv_trans)
@@ -10551,40 +11806,55 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
    InverseElementTransformation *inv_tr = inv_trans;
    inv_tr = inv_tr ? inv_tr : new InverseElementTransformation;
 
-   // For each point in 'point_mat', find the element whose center is closest.
-   Vector min_dist(npts);
+   // For each point, query the BVH over the element bounding boxes for the
+   // elements whose box contains the point, and for the element with the
+   // closest center (used by the neighbor fallback below). The queries are
+   // read-only on the cached tree, so they can run concurrently.
+   UpdateElementBVH();
    Array<int> e_idx(npts);
-   min_dist = std::numeric_limits<double>::max();
-   e_idx = -1;
-
-   Vector pt(spaceDim);
-   for (int i = 0; i < GetNE(); i++)
+   std::vector<std::vector<int> > candidates(npts);
+   #pragma omp parallel for
+   for (int k = 0; k < npts; k++)
    {
-      GetElementTransformation(i)->Transform(
-         Geometries.GetCenter(GetElementBaseGeometry(i)), pt);
-      for (int k = 0; k < npts; k++)
-      {
-         double dist = pt.DistanceTo(data+k*spaceDim);
-         if (dist < min_dist(k))
-         {
-            min_dist(k) = dist;
-            e_idx[k] = i;
-         }
-      }
+      double xyz[3] = { 0.0, 0.0, 0.0 };
+      for (int d = 0; d < spaceDim; d++) { xyz[d] = data[k*spaceDim + d]; }
+      Array<int> cand;
+      e_idx[k] = SearchElementBVH(xyz, cand);
+      candidates[k].assign(cand.begin(), cand.end());
    }
 
-   // Checks if the points lie in the closest element
+   // Check the candidates with the exact inverse transformation.
    int pts_found = 0;
+   Vector pt;
    pt.NewDataAndSize(NULL, spaceDim);
    for (int k = 0; k < npts; k++)
    {
       pt.SetData(data+k*spaceDim);
-      inv_tr->SetTransformation(*GetElementTransformation(e_idx[k]));
-      int res = inv_tr->Transform(pt, ips[k]);
-      if (res == InverseElementTransformation::Inside)
+      for (size_t c = 0; c < candidates[k].size(); c++)
+      {
+         const int e = candidates[k][c];
+         inv_tr->SetTransformation(*GetElementTransformation(e));
+         int res = inv_tr->Transform(pt, ips[k]);
+         if (res == InverseElementTransformation::Inside)
+         {
+            elem_ids[k] = e;
+            pts_found++;
+            break;
+         }
+      }
+      // a strongly curved element can extend beyond its inflated box: also
+      // try the closest element when it was not among the candidates
+      if (elem_ids[k] < 0 &&
+          std::find(candidates[k].begin(), candidates[k].end(),
+                    e_idx[k]) == candidates[k].end())
       {
-         elem_ids[k] = e_idx[k];
-         pts_found++;
+         inv_tr->SetTransformation(*GetElementTransformation(e_idx[k]));
+         int res = inv_tr->Transform(pt, ips[k]);
+         if (res == InverseElementTransformation::Inside)
+         {
+            elem_ids[k] = e_idx[k];
+            pts_found++;
+         }
       }
    }
    if (pts_found != npts)
@@ -10650,12 +11920,95 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
 }
 
 
+/** Return true when the transformation of every mesh element has a constant
+    Jacobian, i.e. when the whole mesh is affine. Simplices with linear nodes
+    are always affine, while quadrilaterals, hexahedra and prisms are affine
+    exactly when the mixed terms of their multi-linear vertex map vanish; each
+    such term is a signed sum of four vertex positions, checked here up to a
+    round-off tolerance relative to the element size. */
+static bool DetectAffineMesh(const Mesh &mesh)
+{
+   if (mesh.GetNE() == 0) { return false; }
+   const GridFunction *nodes = mesh.GetNodes();
+   const FiniteElementSpace *fespace = nodes->FESpace();
+   if (fespace->GetOrder(0) > 1) { return false; } // curved mesh
+   const Geometry::Type geom = mesh.GetElementBaseGeometry(0);
+   if (geom == Geometry::SEGMENT || geom == Geometry::TRIANGLE ||
+       geom == Geometry::TETRAHEDRON)
+   {
+      return true;
+   }
+   // vertex indices of the terms v[i0] - v[i1] + v[i2] - v[i3]
+   static const int quad_terms[1][4] = { {0,1,2,3} };
+   static const int hex_terms[4][4] =
+   { {0,1,2,3}, {0,1,5,4}, {0,3,7,4}, {4,5,6,7} };
+   static const int pri_terms[2][4] = { {0,1,4,3}, {0,2,5,3} };
+   const int (*terms)[4];
+   int num_terms;
+   switch (geom)
+   {
+      case Geometry::SQUARE: terms = quad_terms; num_terms = 1; break;
+      case Geometry::CUBE:   terms = hex_terms;  num_terms = 4; break;
+      case Geometry::PRISM:  terms = pri_terms;  num_terms = 2; break;
+      default: return false;
+   }
+   const int vdim = fespace->GetVDim();
+   const int NE = fespace->GetNE();
+   Array<int> vdofs;
+   Vector loc;
+   for (int e = 0; e < NE; e++)
+   {
+      const int nd = fespace->GetFE(e)->GetDof();
+      fespace->GetElementVDofs(e, vdofs);
+      nodes->GetSubVector(vdofs, loc);
+      // characteristic element size, as the max deviation from vertex 0
+      double scale = 0.0;
+      for (int s = 0; s < vdim; s++)
+      {
+         for (int n = 1; n < nd; n++)
+         {
+            const double ds = fabs(loc(s*nd + n) - loc(s*nd));
+            if (ds > scale) { scale = ds; }
+         }
+      }
+      for (int t = 0; t < num_terms; t++)
+      {
+         for (int s = 0; s < vdim; s++)
+         {
+            // GetElementVDofs returns component-blocked vdofs for both
+            // orderings of the space
+            const double *v = &loc(s*nd);
+            const double r = v[terms[t][0]] - v[terms[t][1]] +
+                             v[terms[t][2]] - v[terms[t][3]];
+            if (fabs(r) > 1e-12*scale) { return false; }
+         }
+      }
+   }
+   return true;
+}
+
 GeometricFactors::GeometricFactors(const Mesh *mesh, const IntegrationRule &ir,
                                    int flags)
 {
    this->mesh = mesh;
    IntRule = &ir;
-   computed_factors = flags;
+   computed_factors = 0;
+
+   MFEM_VERIFY(mesh->GetNumGeometries(mesh->Dimension()) <= 1,
+               "mixed meshes are not supported!");
+
+   compressed = (flags & COMPRESSED) && DetectAffineMesh(*mesh);
+
+   Compute(flags);
+}
+
+void GeometricFactors::Compute(int flags)
+{
+   // Compute only the factors not computed yet, so that a cached object can
+   // be extended in place when a new flag combination is requested, see
+   // Mesh::GetGeometricFactors().
+   flags &= ~(computed_factors | COMPRESSED);
+   if (flags == 0) { return; }
 
    const GridFunction *nodes = mesh->GetNodes();
    const FiniteElementSpace *fespace = nodes->FESpace();
@@ -10664,7 +12017,22 @@ GeometricFactors::GeometricFactors(const Mesh *mesh, const IntegrationRule &ir,
    const int vdim = fespace->GetVDim();
    const int NE   = fespace->GetNE();
    const int ND   = fe->GetDof();
-   const int NQ   = ir.GetNPoints();
+   const int NQ   = IntRule->GetNPoints();
+
+   if (compressed)
+   {
+      // All elements are affine: store a single Jacobian and determinant per
+      // element, evaluated on the host by Update() at the reference element
+      // center. Coordinates, when requested, keep their full storage.
+      if (flags & COORDINATES) { X.SetSize(vdim*NQ*NE); }
+      if (flags & JACOBIANS) { J.SetSize(dim*vdim*NE); }
+      if (flags & DETERMINANTS) { detJ.SetSize(NE); }
+      computed_factors |= flags;
+      Array<int> all_elems(NE);
+      for (int i = 0; i < NE; i++) { all_elems[i] = i; }
+      Update(all_elems);
+      return;
+   }
 
    // For now, we are not using tensor product evaluation
    const Operator *elem_restr = fespace->GetElementRestriction(
@@ -10687,7 +12055,8 @@ GeometricFactors::GeometricFactors(const Mesh *mesh, const IntegrationRule &ir,
       eval_flags |= QuadratureInterpolator::DETERMINANTS;
    }
 
-   const QuadratureInterpolator *qi = fespace->GetQuadratureInterpolator(ir);
+   const QuadratureInterpolator *qi =
+      fespace->GetQuadratureInterpolator(*IntRule);
    // For now, we are not using tensor product evaluation (not implemented)
    qi->DisableTensorProducts();
    qi->SetOutputLayout(QVectorLayout::byNODES);
@@ -10701,6 +12070,96 @@ GeometricFactors::GeometricFactors(const Mesh *mesh, const IntegrationRule &ir,
    {
       qi->Mult(*nodes, eval_flags, X, J, detJ);
    }
+
+   computed_factors |= flags;
+}
+
+void GeometricFactors::Refresh()
+{
+   // Re-run the device evaluation for all factors computed so far; the
+   // SetSize() calls in Compute() are no-ops, so the existing arrays are
+   // simply refilled from the current nodes.
+   const int flags = computed_factors;
+   computed_factors = 0;
+   Compute(flags);
+}
+
+void GeometricFactors::Update(const Array<int> &elems)
+{
+   const GridFunction *nodes = mesh->GetNodes();
+   const FiniteElementSpace *fespace = nodes->FESpace();
+   const int vdim = fespace->GetVDim();
+   const int dim  = mesh->Dimension();
+   const int NQ   = IntRule->GetNPoints();
+   // In compressed mode the Jacobians and determinants have a single entry
+   // per element, evaluated at the reference element center.
+   const int NQJ  = compressed ? 1 : NQ;
+
+   double *x = (computed_factors & COORDINATES) ? X.HostReadWrite() : NULL;
+   double *j = (computed_factors & JACOBIANS) ? J.HostReadWrite() : NULL;
+   double *d = (computed_factors & DETERMINANTS) ? detJ.HostReadWrite() : NULL;
+
+   Array<int> vdofs;
+   Vector loc, shape;
+   DenseMatrix pos, dshape, Jq(vdim, dim);
+
+   for (int k = 0; k < elems.Size(); k++)
+   {
+      const int e = elems[k];
+      const FiniteElement *fe = fespace->GetFE(e);
+      const int nd = fe->GetDof();
+
+      fespace->GetElementVDofs(e, vdofs);
+      nodes->GetSubVector(vdofs, loc);
+      pos.SetSize(nd, vdim);
+      for (int n = 0; n < nd; n++)
+      {
+         for (int s = 0; s < vdim; s++)
+         {
+            // GetElementVDofs returns component-blocked vdofs for both
+            // orderings of the space
+            pos(n, s) = loc(s*nd + n);
+         }
+      }
+
+      shape.SetSize(nd);
+      dshape.SetSize(nd, dim);
+      for (int q = 0; q < (x ? NQ : NQJ); q++)
+      {
+         const IntegrationPoint &ip = IntRule->IntPoint(q);
+         if (x)
+         {
+            fe->CalcShape(ip, shape);
+            for (int s = 0; s < vdim; s++)
+            {
+               double xs = 0.0;
+               for (int n = 0; n < nd; n++) { xs += shape(n)*pos(n, s); }
+               x[q + NQ*(s + vdim*e)] = xs;
+            }
+         }
+         if ((j || d) && q < NQJ)
+         {
+            fe->CalcDShape(compressed ?
+                           Geometries.GetCenter(fe->GetGeomType()) : ip,
+                           dshape);
+            MultAtB(pos, dshape, Jq);
+            if (j)
+            {
+               for (int dr = 0; dr < dim; dr++)
+               {
+                  for (int s = 0; s < vdim; s++)
+                  {
+                     j[q + NQJ*(s + vdim*(dr + dim*e))] = Jq(s, dr);
+                  }
+               }
+            }
+            if (d)
+            {
+               d[q + NQJ*e] = (vdim == dim) ? Jq.Det() : Jq.Weight();
+            }
+         }
+      }
+   }
 }
 
 FaceGeometricFactors::FaceGeometricFactors(const Mesh *mesh,
@@ -10710,13 +12169,35 @@ FaceGeometricFactors::FaceGeometricFactors(const Mesh *mesh,
 {
    this->mesh = mesh;
    IntRule = &ir;
-   computed_factors = flags;
+   computed_factors = 0;
+
+   MFEM_VERIFY(mesh->GetNumGeometries(mesh->Dimension() - 1) <= 1,
+               "meshes with mixed face geometries are not supported!");
+
+   Compute(flags);
+}
+
+void FaceGeometricFactors::Refresh()
+{
+   // see GeometricFactors::Refresh()
+   const int flags = computed_factors;
+   computed_factors = 0;
+   Compute(flags);
+}
+
+void FaceGeometricFactors::Compute(int flags)
+{
+   // Compute only the factors not computed yet, so that a cached object can
+   // be extended in place when a new flag combination is requested, see
+   // Mesh::GetFaceGeometricFactors().
+   flags &= ~computed_factors;
+   if (flags == 0) { return; }
 
    const GridFunction *nodes = mesh->GetNodes();
    const FiniteElementSpace *fespace = nodes->FESpace();
    const int vdim = fespace->GetVDim();
    const int NF   = fespace->GetNFbyType(type);
-   const int NQ   = ir.GetNPoints();
+   const int NQ   = IntRule->GetNPoints();
 
    const Operator *face_restr = fespace->GetFaceRestriction(
                                    ElementDofOrdering::LEXICOGRAPHIC,
@@ -10733,7 +12214,7 @@ FaceGeometricFactors::FaceGeometricFactors(const Mesh *mesh,
    }
    if (flags & FaceGeometricFactors::JACOBIANS)
    {
-      J.SetSize(vdim*vdim*NQ*NF);
+      J.SetSize(vdim*(mesh->Dimension()-1)*NQ*NF);
       eval_flags |= FaceQuadratureInterpolator::DERIVATIVES;
    }
    if (flags & FaceGeometricFactors::DETERMINANTS)
@@ -10748,8 +12229,11 @@ FaceGeometricFactors::FaceGeometricFactors(const Mesh *mesh,
    }
 
    const FaceQuadratureInterpolator *qi = fespace->GetFaceQuadratureInterpolator(
-                                             ir, type);
-   qi->Mult(Fnodes, eval_flags, X, J, detJ, normal);
+                                             *IntRule, type);
+   Vector q_ntr; // normal traces are not needed here
+   qi->Mult(Fnodes, eval_flags, X, J, detJ, normal, q_ntr);
+
+   computed_factors |= flags;
 }
 
 NodeExtrudeCoefficient::NodeExtrudeCoefficient(const int dim, const int _n,
@@ -39,6 +39,7 @@ class KnotVector;
 class NURBSExtension;
 class FiniteElementSpace;
 class GridFunction;
+class BufferedTextWriter;
 struct Refinement;
 
 /** An enum type to specify if interior or boundary faces are desired. */
@@ -206,6 +207,88 @@ public:
    Array<FaceGeometricFactors*>
    face_geom_factors; ///< Optional face geometric factors.
 
+   /** Cached VTU topology arrays used by PrintVTU(): the connectivity,
+       offsets and cell-type sections depend only on the mesh topology and
+       the (ref, high_order) parameters, so they are rebuilt only when
+       #sequence or the parameters change and are encoded straight from the
+       cached arrays on every save. */
+   struct VTUTopology
+   {
+      long sequence;   ///< Mesh::sequence at build time, or -1 when empty
+      int ref;         ///< element subdivision number of the build
+      bool high_order; ///< high-order (Lagrange cell) variant
+      int np, ncells;  ///< total refined point and output cell counts
+      Array<int> connectivity, offsets;
+      Array<uint8_t> types;
+      VTUTopology() : sequence(-1), ref(-1), high_order(false) { }
+   };
+   VTUTopology vtu_topology;
+
+   /// Rebuild #vtu_topology if it does not match (@a ref, @a high_order) or
+   /// the current mesh #sequence.
+   void UpdateVTUTopology(int ref, bool high_order);
+
+   /** Cached bounding volume hierarchy over the element bounding boxes,
+       used by FindPoints() to locate points without scanning all elements.
+       Rebuilt when #sequence changes; invalidated by ResetLazyData(). The
+       tree nodes are stored breadth-independently in flat arrays: node i
+       occupies bounds[6*i..6*i+5] (min/max corners, padded to 3D) and
+       children[2*i..2*i+1], which holds the two child node indices for an
+       internal node or (~begin, count) into #elems for a leaf. */
+   struct ElementBVH
+   {
+      long sequence;        ///< Mesh::sequence at build time, or -1 when empty
+      Array<double> bounds; ///< 6 doubles per node: xyz min, xyz max
+      Array<int> children;  ///< 2 ints per node, see above
+      Array<int> elems;     ///< element ids referenced by the leaves
+      Array<double> elem_bounds; ///< 6 doubles per element: its own box
+      Array<double> centers;     ///< 3 doubles per element: element center
+      ElementBVH() : sequence(-1) { }
+   };
+   ElementBVH element_bvh;
+
+   /// Rebuild #element_bvh if it does not match the current mesh #sequence.
+   void UpdateElementBVH();
+
+   /** Cached element index lists grouped by attribute: row i of the table
+       lists the elements with attribute #attributes[i]. Used to iterate
+       only over the elements of given attributes, e.g. by attribute-
+       restricted domain integrators. Rebuilt when #sequence changes;
+       invalidated by ResetLazyData(). */
+   struct AttributeElementLists
+   {
+      long sequence; ///< Mesh::sequence at build time, or -1 when empty
+      Table elems;
+      AttributeElementLists() : sequence(-1) { }
+   };
+   AttributeElementLists attr_elem_lists;
+
+   /// Rebuild #attr_elem_lists if it does not match the current mesh
+   /// #sequence.
+   void UpdateAttributeElementLists();
+
+   /** Cached vertex adjacency tables: row v of #vert_elem lists the elements
+       containing vertex v and row v of #vert_vert lists the vertices
+       connected to vertex v by a mesh edge. Rebuilt when #sequence changes;
+       invalidated by ResetLazyData(). */
+   struct VertexAdjacencyTables
+   {
+      long sequence; ///< Mesh::sequence at build time, or -1 when empty
+      Table vert_elem;
+      Table vert_vert;
+      VertexAdjacencyTables() : sequence(-1) { }
+   };
+   VertexAdjacencyTables vert_adj;
+
+   /// Rebuild #vert_adj if it does not match the current mesh #sequence.
+   void UpdateVertexAdjacencyTables();
+
+   /** Find the elements whose (slightly inflated) bounding box contains the
+       3D-padded point @a xyz, appending them to @a candidates, and return
+       the element whose center is closest to the point. Requires an
+       up-to-date #element_bvh. */
+   int SearchElementBVH(const double *xyz, Array<int> &candidates) const;
+
    /// Used during initialization only.
    Array<Triple<int, int, int> > tmp_vertex_parents;
 
@@ -228,13 +311,19 @@ protected:
 
    Element *ReadElementWithoutAttr(std::istream &);
    static void PrintElementWithoutAttr(const Element *, std::ostream &);
+   /// Buffered variant, used by Printer() for large meshes.
+   static void PrintElementWithoutAttr(const Element *, BufferedTextWriter &);
 
    Element *ReadElement(std::istream &);
    static void PrintElement(const Element *, std::ostream &);
+   /// Buffered variant, used by Printer() for large meshes.
+   static void PrintElement(const Element *, BufferedTextWriter &);
 
    // Readers for different mesh formats, used in the Load() method.
    // The implementations of these methods are in mesh_readers.cpp.
    void ReadMFEMMesh(std::istream &input, bool mfem_v11, int &curved);
+   void ReadMFEMBinaryMesh(std::istream &input, int &curved, int &read_gf,
+                           bool &finalize_topo);
    void ReadLineMesh(std::istream &input);
    void ReadNetgen2DMesh(std::istream &input, int &curved);
    void ReadNetgen3DMesh(std::istream &input);
@@ -297,6 +386,21 @@ protected:
    /// Bisect a boundary triangle: boundary element with index @a i is bisected.
    void BdrBisection(int i, const HashTable<Hashed2> &);
 
+   /** @brief Update the edge and face tables after tetrahedral bisection, see
+       LocalRefinement, visiting only the elements and boundary elements
+       changed by the refinement.
+
+       Patches 'el_to_edge', 'bel_to_edge', 'el_to_face', 'be_to_face', the
+       'faces' and 'faces_info' arrays, and the edge and face counters. The
+       indices of the edges and faces destroyed by the bisection are reused
+       for the new ones, keeping the numbering dense without re-hashing the
+       whole mesh. @a v_to_v is the hash table of the bisected edges and
+       @a old_edge_vert lists the vertices of the edges as numbered before
+       the refinement. */
+   void UpdateTablesAfterBisection(const HashTable<Hashed2> &v_to_v,
+                                   const Array<int> &old_edge_vert,
+                                   int old_nv, int old_ne, int old_nbe);
+
    /** Uniform Refinement. Element with index i is refined uniformly. */
    void UniformRefinement(int i, const DSTable &, int *, int *, int *);
 
@@ -606,6 +710,21 @@ public:
 
    virtual void SetAttributes();
 
+#ifdef MFEM_USE_MPI
+   /** @brief Move the read-only mesh arrays into MPI-3 shared memory, keeping
+       one physical copy per compute node (see MemoryType::HOST_SHARED).
+
+       This method moves the vertices, the face information and the
+       connectivity Table%s into shared-memory windows, replacing the per-rank
+       duplicates of replicated-mesh workloads with a single copy per node.
+
+       The call is collective over MPI_COMM_WORLD and requires that all ranks
+       of each node hold identical copies of the mesh (e.g. each rank loaded
+       the same serial mesh). The mesh must not be modified (refined,
+       transformed, etc.) afterwards. */
+   void ShareReadOnlyData();
+#endif
+
    /** This is our integration with the Gecko library. The method finds an
        element ordering that will increase memory coherency by putting elements
        that are in physical proximity closer in memory. It can also be used to
@@ -756,6 +875,22 @@ public:
        visualization are counted as interior faces. */
    int GetNFbyType(FaceType type) const;
 
+   /** @brief Fill SoA connectivity buffers for all faces of the given
+       @a type, listed in the order the faces are laid out in
+       FaceGeometricFactors and in the face restriction operators (ascending
+       mesh face index). */
+   /** On return, for batch face i: @a face_index[i] is the mesh face index,
+       @a elem_ids[2*i+0] and @a elem_ids[2*i+1] are the adjacent elements
+       (-1 when there is no second element), and @a elem_info[2*i+0,1] hold
+       the corresponding 64*local_face_index + orientation codes as returned
+       by GetFaceInfos(). Face-loop assembly can split [0,nf) into contiguous
+       ranges and process them concurrently, reading quadrature-point data
+       from the shared FaceGeometricFactors object and setting up per-face
+       transformations with the re-entrant GetFaceElementTransformations()
+       overload. */
+   void GetFaceBatchInfo(FaceType type, Array<int> &face_index,
+                         Array<int> &elem_ids, Array<int> &elem_info) const;
+
    /// Utility function: sum integers from all processors (Allreduce).
    virtual long ReduceInt(int value) const { return value; }
 
@@ -778,6 +913,45 @@ public:
        for example, after the mesh nodes are modified externally. */
    void DeleteGeometricFactors();
 
+   /** @brief Recompute all cached GeometricFactors and FaceGeometricFactors
+       in place from the current mesh nodes. */
+   /** Unlike DeleteGeometricFactors(), the cached objects and their arrays
+       are kept and refilled by the device QuadratureInterpolator, so mesh
+       motion that preserves the topology (e.g. ALE stepping) pays for one
+       evaluation sweep instead of a teardown and lazy re-setup. */
+   void RefreshGeometricFactors();
+
+   /** @brief Selectively update all cached GeometricFactors after moving the
+       nodes of the elements @a elems, avoiding the full recomputation
+       triggered by DeleteGeometricFactors(). */
+   /** The factors of elements not listed in @a elems are kept as they are, so
+       the caller is responsible for listing every element whose nodes were
+       modified. Cached FaceGeometricFactors are simply discarded and rebuilt
+       on demand. */
+   void UpdateGeometricFactors(const Array<int> &elems);
+
+   /** @brief Same as UpdateGeometricFactors(), with the dirty elements
+       derived from the scalar dofs of the Nodes FE space that were moved. */
+   void UpdateGeometricFactorsByNodes(const Array<int> &node_dofs);
+
+   /** @brief Compute mesh quality measures for all elements in one batched
+       pass, reusing the GeometricFactors machinery instead of per-element
+       ElementTransformation evaluations. */
+   /** The Jacobian of the reference-to-physical map is sampled at the points
+       of @a ir in every element and the following per-element measures are
+       returned in arrays of size GetNE():
+       - @a min_detJ, @a max_detJ: minimum/maximum of det(J);
+       - @a aspect_ratio: maximum over sample points of the ratio of the
+         largest to the smallest column norm of J (1 for square/cube
+         elements);
+       - @a skew: maximum over sample points of |cos| of the angle between
+         two columns of J (0 for orthogonal columns, approaching 1 as the
+         element degenerates).
+       Supports meshes with a single element geometry and Dim == SpaceDim. */
+   void GetElementQualityMetrics(const IntegrationRule &ir,
+                                 Vector &min_detJ, Vector &max_detJ,
+                                 Vector &aspect_ratio, Vector &skew);
+
    /// Equals 1 + num_holes - num_loops
    inline int EulerNumber() const
    { return NumOfVertices - NumOfEdges + NumOfFaces - NumOfElements; }
@@ -961,6 +1135,41 @@ public:
    ElementTransformation * GetBdrElementTransformation(int i);
    void GetBdrElementTransformation(int i, IsoparametricTransformation *ElTr);
 
+   /** @brief Compute the physical coordinates of the points of @a ir on all
+       mesh elements.
+
+       On return, @a pts has the shape (spaceDim x ir.GetNPoints() x GetNE())
+       with pts(i) being the matrix of transformed points of element i. The
+       reference-space shape values are computed once per finite element and
+       integration rule and reused for every element, which is considerably
+       faster than constructing and applying the element transformations one
+       by one. For device-side evaluation see also GetGeometricFactors(). */
+   void TransformElements(const IntegrationRule &ir, DenseTensor &pts);
+
+   /// Boundary-element version of TransformElements().
+   void TransformBdrElements(const IntegrationRule &ir, DenseTensor &pts);
+
+   /** @brief Invert the element transformations for a batch of physical
+       points with a fixed-budget Newton iteration.
+
+       Column j of @a phys_pts (spaceDim x npts) is the physical point to
+       invert in element @a elem_ids[j]. On return, @a ref_pts is
+       (Dim x npts) with the computed reference coordinates and
+       @a converged[j] is nonzero iff the physical-space residual dropped
+       below @a phys_tol within @a max_iter Newton iterations. A converged
+       point may still lie outside the reference element when it is not
+       actually contained in elem_ids[j] - callers tracking particles across
+       elements should test the returned coordinates.
+
+       For meshes with a single tensor-product geometry and a nodal basis all
+       points are processed by one forall kernel; other meshes (simplices,
+       mixed geometries, positive bases, embedded surfaces) fall back to the
+       point-wise InverseElementTransformation. */
+   void BatchInverseTransform(const Array<int> &elem_ids,
+                              const DenseMatrix &phys_pts,
+                              DenseMatrix &ref_pts, Array<int> &converged,
+                              int max_iter = 16, double phys_tol = 1e-12);
+
    /** @brief Returns the transformation defining the given face element in a
        user-defined variable. */
    void GetFaceTransformation(int i, IsoparametricTransformation *FTr);
@@ -1017,6 +1226,19 @@ public:
    FaceElementTransformations *GetFaceElementTransformations(int FaceNo,
                                                              int mask = 31);
 
+   /** @brief Variant of GetFaceElementTransformations() that stores all data
+       in caller-owned objects: the element transformations are set up in
+       @a ElTr1 and @a ElTr2 and the result is assembled in @a FElTr. */
+   /** Since the shared internal transformation objects are not touched,
+       different faces can be processed concurrently from different threads;
+       on nonconforming meshes this additionally requires MFEM_THREAD_SAFE
+       for the slave-face correction. */
+   void GetFaceElementTransformations(int FaceNo,
+                                      FaceElementTransformations &FElTr,
+                                      IsoparametricTransformation &ElTr1,
+                                      IsoparametricTransformation &ElTr2,
+                                      int mask = 31);
+
    FaceElementTransformations *GetInteriorFaceTransformations (int FaceNo)
    {
       if (faces_info[FaceNo].Elem2No < 0) { return NULL; }
@@ -1025,6 +1247,16 @@ public:
 
    FaceElementTransformations *GetBdrFaceTransformations (int BdrElemNo);
 
+   /** @brief Variant of GetBdrFaceTransformations() that stores all data in
+       the caller-owned objects @a FElTr, @a ElTr1 and @a ElTr2, so that
+       different boundary elements can be processed concurrently. */
+   /** Returns false, leaving the objects untouched, when the boundary
+       element corresponds to an interior, shared, or nonconforming face. */
+   bool GetBdrFaceTransformations(int BdrElemNo,
+                                  FaceElementTransformations &FElTr,
+                                  IsoparametricTransformation &ElTr1,
+                                  IsoparametricTransformation &ElTr2);
+
    /// Return true if the given face is interior. @sa FaceIsTrueInterior().
    bool FaceIsInterior(int FaceNo) const
    {
@@ -1052,13 +1284,37 @@ public:
    /// Return the attribute of boundary element i.
    int GetBdrAttribute(int i) const { return boundary[i]->GetAttribute(); }
 
+   /** @brief Return the Table grouping the elements by attribute: row i
+       lists the indices of the elements with attribute #attributes[i].
+
+       The table is built on first use and cached until the mesh changes. */
+   const Table &GetAttributeToElementTable();
+
+   /// Return in @a elems the indices of the elements with attribute @a attr.
+   void GetElementsWithAttribute(int attr, Array<int> &elems);
+
    const Table &ElementToElementTable();
 
+   /** @brief Return the vertex-to-element Table: row v lists the elements
+       containing vertex v.
+
+       The table is built on first use and cached until the mesh changes. */
+   const Table &VertexToElementTable();
+
+   /** @brief Return the symmetric vertex-to-vertex Table: row v lists the
+       vertices connected to vertex v by a mesh edge.
+
+       The table is built on first use and cached until the mesh changes. */
+   const Table &VertexToVertexTable();
+
    const Table &ElementToFaceTable() const;
 
    const Table &ElementToEdgeTable() const;
 
-   ///  The returned Table must be destroyed by the caller
+   /** @brief Return a copy of the cached vertex-to-element Table, see
+       VertexToElementTable().
+
+       The returned Table must be destroyed by the caller. */
    Table *GetVertexToElementTable();
 
    /** Return the "face"-element Table. Here "face" refers to face (3D),
@@ -1097,9 +1353,23 @@ public:
    // Node operations for curved mesh.
    // They call the corresponding '...Vertices' method if the
    // mesh is not curved (i.e. Nodes == NULL).
-   void MoveNodes(const Vector &displacements);
+
+   /** @brief Add @a displacements to the mesh nodes.
+
+       When the mesh is curved, the update is a Vector operation on the node
+       GridFunction and runs on the device when the vectors are device
+       resident. With @a refresh_geom_factors set, all cached
+       GeometricFactors and FaceGeometricFactors are recomputed from the new
+       nodes right away, see RefreshGeometricFactors(). */
+   void MoveNodes(const Vector &displacements,
+                  bool refresh_geom_factors = false);
    void GetNodes(Vector &node_coord) const;
-   void SetNodes(const Vector &node_coord);
+   /** @brief Replace the mesh nodes with @a node_coord.
+
+       See MoveNodes() for the device and @a refresh_geom_factors
+       semantics. */
+   void SetNodes(const Vector &node_coord,
+                 bool refresh_geom_factors = false);
 
    /// Return a pointer to the internal node GridFunction (may be NULL).
    GridFunction *GetNodes() { return Nodes; }
@@ -1237,6 +1507,16 @@ public:
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &out) const;
 #endif
+   /** @brief Print the mesh in the binary "MFEM binary mesh v1.0" format.
+
+       The format stores the element, boundary, vertex, and (for curved
+       meshes) node sections as raw sectioned arrays with their sizes up
+       front, so a mesh can be loaded with a few bulk reads, or memory
+       mapped, instead of being parsed token by token. The data is written
+       in host byte order. Can be used as a converter for the ASCII formats:
+       load the mesh and print it with this method. NURBS and non-conforming
+       meshes are not supported. */
+   void PrintBinary(std::ostream &out) const;
    /// Print the mesh in VTK format (linear and quadratic meshes only).
    /// \see mfem::ofgzstream() for on-the-fly compression of ascii outputs
    void PrintVTK(std::ostream &out);
@@ -1388,15 +1668,41 @@ public:
    const IntegrationRule *IntRule;
    int computed_factors;
 
+   /** @brief True when the Jacobians and determinants are stored compressed,
+       with one entry per element instead of one per quadrature point. */
+   /** Set by the constructor when the #COMPRESSED flag is given and every
+       element of the mesh is detected to be affine (constant Jacobian);
+       otherwise the full per-quadrature-point storage is used. Coordinates
+       are never compressed. */
+   bool compressed;
+
    enum FactorFlags
    {
       COORDINATES  = 1 << 0,
       JACOBIANS    = 1 << 1,
       DETERMINANTS = 1 << 2,
+      /** @brief Allow compressed storage of the Jacobians and determinants
+          when all elements are affine; see the member #compressed. */
+      COMPRESSED   = 1 << 3,
    };
 
    GeometricFactors(const Mesh *mesh, const IntegrationRule &ir, int flags);
 
+   /** @brief Compute any factors requested in @a flags that have not been
+       computed yet; used by Mesh::GetGeometricFactors() to extend a cached
+       object in place when a new flag combination is requested. */
+   void Compute(int flags);
+
+   /** @brief Recompute all previously computed factors from the current mesh
+       nodes, reusing the existing arrays. See
+       Mesh::RefreshGeometricFactors(). */
+   void Refresh();
+
+   /** @brief Recompute the stored factors for the given elements only,
+       evaluating the current mesh nodes; entries of all other elements are
+       left untouched. See Mesh::UpdateGeometricFactors(). */
+   void Update(const Array<int> &elems);
+
    /// Mapped (physical) coordinates of all quadrature points.
    /** This array uses a column-major layout with dimensions (NQ x SDIM x NE)
        where
@@ -1408,7 +1714,7 @@ public:
    /// Jacobians of the element transformations at all quadrature points.
    /** This array uses a column-major layout with dimensions (NQ x SDIM x DIM x
        NE) where
-       - NQ = number of quadrature points per element,
+       - NQ = number of quadrature points per element, or 1 when #compressed,
        - SDIM = space dimension of the mesh = mesh.SpaceDimension(),
        - DIM = dimension of the mesh = mesh.Dimension(), and
        - NE = number of elements in the mesh. */
@@ -1416,7 +1722,8 @@ public:
 
    /// Determinants of the Jacobians at all quadrature points.
    /** This array uses a column-major layout with dimensions (NQ x NE) where
-       - NQ = number of quadrature points per element, and
+       - NQ = number of quadrature points per element, or 1 when #compressed,
+         and
        - NE = number of elements in the mesh. */
    Vector detJ;
 };
@@ -1444,6 +1751,16 @@ public:
    FaceGeometricFactors(const Mesh *mesh, const IntegrationRule &ir, int flags,
                         FaceType type);
 
+   /** @brief Compute any factors requested in @a flags that have not been
+       computed yet; used by Mesh::GetFaceGeometricFactors() to extend a cached
+       object in place when a new flag combination is requested. */
+   void Compute(int flags);
+
+   /** @brief Recompute all previously computed factors from the current mesh
+       nodes, reusing the existing arrays. See
+       Mesh::RefreshGeometricFactors(). */
+   void Refresh();
+
    /// Mapped (physical) coordinates of all quadrature points.
    /** This array uses a column-major layout with dimensions (NQ x SDIM x NF)
        where
@@ -1452,13 +1769,15 @@ public:
        - NF = number of faces in the mesh. */
    Vector X;
 
-   /// Jacobians of the element transformations at all quadrature points.
-   /** This array uses a column-major layout with dimensions (NQ x SDIM x DIM x
-       NF) where
+   /// Jacobians of the face transformations at all quadrature points.
+   /** This array uses a column-major layout with dimensions (NQ x SDIM x
+       (DIM-1) x NF) where
        - NQ = number of quadrature points per face,
        - SDIM = space dimension of the mesh = mesh.SpaceDimension(),
-       - DIM = dimension of the mesh = mesh.Dimension(), and
-       - NF = number of faces in the mesh. */
+       - DIM-1 = reference dimension of the faces, and
+       - NF = number of faces in the mesh.
+       The columns are the tangential derivatives of the face coordinates
+       along the reference face directions. */
    Vector J;
 
    /// Determinants of the Jacobians at all quadrature points.
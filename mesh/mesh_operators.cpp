@@ -11,6 +11,7 @@
 
 #include "mesh_operators.hpp"
 #include "pmesh.hpp"
+#include "../general/forall.hpp"
 
 namespace mfem
 {
@@ -67,6 +68,9 @@ ThresholdRefiner::ThresholdRefiner(ErrorEstimator &est)
 
    non_conforming = -1;
    nc_limit = 0;
+
+   hysteresis = 0.0;
+   skip_sequence = -1;
 }
 
 double ThresholdRefiner::GetNorm(const Vector &local_err, Mesh &mesh) const
@@ -78,6 +82,12 @@ double ThresholdRefiner::GetNorm(const Vector &local_err, Mesh &mesh) const
       return ParNormlp(local_err, total_norm_p, pmesh->GetComm());
    }
 #endif
+   if (total_norm_p == infinity())
+   {
+      // the local errors are non-negative, so the max norm reduces to Max(),
+      // which can run on the device
+      return local_err.Max();
+   }
    return local_err.Normlp(total_norm_p);
 }
 
@@ -109,11 +119,55 @@ int ThresholdRefiner::ApplyImpl(Mesh &mesh)
       threshold = std::max(total_err * total_fraction, local_err_goal);
    }
 
-   for (int el = 0; el < NE; el++)
+   // Scan the element errors against the threshold on the device and compact
+   // the scan flags into the marked-element list with a prefix sum. With
+   // hysteresis enabled, elements found far below the threshold are recorded
+   // in the skip mask and not re-examined while the mesh is unchanged.
+   Array<int> flags(NE);
+   const bool use_hyst = (hysteresis > 0.0);
+   if (use_hyst &&
+       (skip_sequence != current_sequence || skip_mask.Size() != NE))
    {
-      if (local_err(el) > threshold)
+      skip_mask.SetSize(NE);
+      skip_mask = 0;
+      skip_sequence = current_sequence;
+   }
+   {
+      const double *err = local_err.Read();
+      int *skip = use_hyst ? skip_mask.ReadWrite() : NULL;
+      auto f = flags.Write();
+      const double thr = threshold;
+      const double hyst_thr = hysteresis*threshold;
+      MFEM_FORALL(el, NE,
+      {
+         int mark = 0;
+         if (skip == NULL || skip[el] == 0)
+         {
+            const double e = err[el];
+            mark = (e > thr) ? 1 : 0;
+            if (skip != NULL && e < hyst_thr) { skip[el] = 1; }
+         }
+         f[el] = mark;
+      });
+   }
+   flags.HostReadWrite();
+   flags.PartialSum();
+   const int nmark = (NE > 0) ? flags[NE-1] : 0;
+   if (nmark > 0)
+   {
+      Array<int> marked_idx(nmark);
+      const int *ps = flags.Read();
+      auto mi = marked_idx.Write();
+      MFEM_FORALL(el, NE,
+      {
+         const int p = ps[el];
+         if (p > ((el > 0) ? ps[el-1] : 0)) { mi[p-1] = el; }
+      });
+      const int *h_mi = marked_idx.HostRead();
+      marked_elements.Reserve(nmark);
+      for (int i = 0; i < nmark; i++)
       {
-         marked_elements.Append(Refinement(el));
+         marked_elements.Append(Refinement(h_mi[i]));
       }
    }
 
@@ -142,6 +196,7 @@ void ThresholdRefiner::Reset()
    estimator.Reset();
    current_sequence = -1;
    num_marked_elements = 0;
+   skip_sequence = -1;
    // marked_elements.SetSize(0); // not necessary
 }
 
@@ -190,6 +190,10 @@ protected:
    int non_conforming;
    int nc_limit;
 
+   double hysteresis; // see SetHysteresis()
+   Array<int> skip_mask; // elements to skip while the mesh is unchanged
+   long skip_sequence;
+
    double GetNorm(const Vector &local_err, Mesh &mesh) const;
 
    /** @brief Apply the operator to the mesh.
@@ -244,6 +248,18 @@ public:
       this->nc_limit = nc_limit;
    }
 
+   /** @brief Enable incremental marking: elements whose error drops below
+       @a factor times the threshold during a scan are skipped in subsequent
+       scans until the mesh changes. The default value, 0, disables the
+       skipping.
+
+       Intended for evolution runs that call Apply() every step while the
+       mesh changes rarely, so that elements far below the threshold are not
+       re-examined each scan. Use only when element errors do not grow
+       between consecutive scans on an unchanged mesh, or choose a
+       conservative @a factor well below 1. */
+   void SetHysteresis(double factor) { hysteresis = factor; }
+
    /// Get the number of marked elements in the last Apply() call.
    long GetNumMarkedElements() const { return num_marked_elements; }
 
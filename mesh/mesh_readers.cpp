@@ -12,10 +12,13 @@
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
 #include "../general/text.hpp"
+#include "../general/binaryio.hpp"
 #include "gmsh.hpp"
 
 #include <iostream>
 #include <cstdio>
+#include <cstdint>
+#include <cstring>
 
 #ifdef MFEM_USE_NETCDF
 #include "netcdf.h"
@@ -114,6 +117,94 @@ void Mesh::ReadMFEMMesh(std::istream &input, bool mfem_v11, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+void Mesh::ReadMFEMBinaryMesh(std::istream &input, int &curved, int &read_gf,
+                              bool &finalize_topo)
+{
+   // Read the "MFEM binary mesh v1.0" format: sectioned arrays with their
+   // sizes up front, written by Mesh::PrintBinary().
+   Dim = bin_io::read<int>(input);
+   spaceDim = bin_io::read<int>(input);
+   MFEM_VERIFY(input.good(), "invalid mesh file");
+
+   // Elements and boundary: the geometry types, the attributes, and the
+   // vertex indices of each section are stored as contiguous arrays, so
+   // they are filled with bulk reads instead of token-by-token parsing.
+   for (int sec = 0; sec < 2; sec++)
+   {
+      Array<Element *> &elems = (sec == 0) ? elements : boundary;
+      int &num = (sec == 0) ? NumOfElements : NumOfBdrElements;
+
+      num = bin_io::read<int>(input);
+      MFEM_VERIFY(input.good() && num >= 0, "invalid mesh file");
+      elems.SetSize(num);
+      Array<int> geoms(num), attrs(num);
+      bin_io::read_array(input, geoms.GetData(), num);
+      bin_io::read_array(input, attrs.GetData(), num);
+      MFEM_VERIFY(input.good(), "invalid mesh file");
+      std::int64_t num_ind = bin_io::read<std::int64_t>(input);
+      for (int j = 0; j < num; j++)
+      {
+         Element *el = NewElement(geoms[j]);
+         el->SetAttribute(attrs[j]);
+         input.read((char*)el->GetVertices(),
+                    el->GetNVertices()*sizeof(int));
+         num_ind -= el->GetNVertices();
+         elems[j] = el;
+      }
+      MFEM_VERIFY(input.good() && num_ind == 0, "invalid mesh file");
+   }
+
+   NumOfVertices = bin_io::read<int>(input);
+   MFEM_VERIFY(input.good() && NumOfVertices >= 0, "invalid mesh file");
+   vertices.SetSize(NumOfVertices);
+   if (NumOfVertices > 0)
+   {
+      if (spaceDim == 3)
+      {
+         // a Vertex stores 3 coordinates: read the whole section at once
+         input.read((char*)&vertices[0](0),
+                    (size_t)NumOfVertices*3*sizeof(double));
+      }
+      else
+      {
+         for (int j = 0; j < NumOfVertices; j++)
+         {
+            input.read((char*)&vertices[j](0), spaceDim*sizeof(double));
+         }
+      }
+      MFEM_VERIFY(input.good(), "invalid mesh file");
+   }
+
+   if (bin_io::read<int>(input)) // nodes section present?
+   {
+      const int name_len = bin_io::read<int>(input);
+      MFEM_VERIFY(input.good() && name_len > 0, "invalid mesh file");
+      std::string name(name_len, '\0');
+      input.read(&name[0], name_len);
+      const int vdim = bin_io::read<int>(input);
+      const int ordering = bin_io::read<int>(input);
+      const std::int64_t ndof = bin_io::read<std::int64_t>(input);
+      MFEM_VERIFY(input.good(), "invalid mesh file");
+
+      // generate edges and faces so that the nodal FE space can be defined
+      FinalizeTopology();
+      finalize_topo = false;
+
+      FiniteElementCollection *fec = FiniteElementCollection::New(name.c_str());
+      FiniteElementSpace *fes = new FiniteElementSpace(this, fec, vdim,
+                                                       ordering);
+      Nodes = new GridFunction(fes);
+      Nodes->MakeOwner(fec); // Nodes will destroy 'fec' and 'fes'
+      own_nodes = 1;
+      MFEM_VERIFY(ndof == Nodes->Size(), "invalid mesh file");
+      input.read((char*)Nodes->GetData(), (size_t)ndof*sizeof(double));
+      MFEM_VERIFY(input.good(), "invalid mesh file");
+
+      curved = 1;
+      read_gf = 0;
+   }
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
@@ -903,14 +994,22 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
       MFEM_ABORT("Gmsh file : dsize != sizeof(double)");
    }
    getline(input, buff);
-   // There is a number 1 in binary format
+   // There is a number 1 in binary format; when it reads back with the
+   // bytes reversed, the file was written on a machine of the other
+   // endianness and every binary record is byte-swapped after reading.
+   bool swap_bytes = false;
    if (binary)
    {
       int one;
       input.read(reinterpret_cast<char*>(&one), sizeof(one));
       if (one != 1)
       {
-         MFEM_ABORT("Gmsh file : wrong binary format");
+         bin_io::ByteSwap(&one, sizeof(int), 1);
+         if (one != 1)
+         {
+            MFEM_ABORT("Gmsh file : wrong binary format");
+         }
+         swap_bytes = true;
       }
    }
 
@@ -919,6 +1018,13 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
    // starting from 1, not 0)
    map<int, int> vertices_map;
 
+   // Direct-lookup variant of 'vertices_map', built after the '$Nodes'
+   // section when the vertex numbering is (nearly) contiguous -- the common
+   // case. It replaces the per-node map searches in the binary '$Elements'
+   // reader; empty when the numbering is too sparse.
+   Array<int> dense_vertices_map;
+   int min_vertex_serial = 0;
+
    // Gmsh always outputs coordinates in 3D, but MFEM distinguishes between the
    // mesh element dimension (Dim) and the dimension of the space in which the
    // mesh is embedded (spaceDim). For example, a 2D MFEM mesh has Dim = 2 and
@@ -954,12 +1060,36 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
          int serial_number;
          const int gmsh_dim = 3; // Gmsh always outputs 3 coordinates
          double coord[gmsh_dim];
+         // In the binary format the vertex records have a fixed, packed size,
+         // so they are read in bulk into bounded chunks instead of with two
+         // stream reads per vertex.
+         const int vert_rec_size = sizeof(int) + gmsh_dim*sizeof(double);
+         const int vert_chunk = std::max(1, (1 << 22)/vert_rec_size);
+         vector<char> vert_block;
+         if (binary)
+         {
+            vert_block.resize((size_t)vert_rec_size*
+                              std::min(vert_chunk, NumOfVertices));
+         }
+         int buffered = 0, consumed = 0;
          for (int ver = 0; ver < NumOfVertices; ++ver)
          {
             if (binary)
             {
-               input.read(reinterpret_cast<char*>(&serial_number), sizeof(int));
-               input.read(reinterpret_cast<char*>(coord), gmsh_dim*sizeof(double));
+               if (consumed == buffered)
+               {
+                  buffered = std::min(vert_chunk, NumOfVertices - ver);
+                  input.read(&vert_block[0], (size_t)buffered*vert_rec_size);
+                  consumed = 0;
+               }
+               const char *rec = &vert_block[(size_t)(consumed++)*vert_rec_size];
+               std::memcpy(&serial_number, rec, sizeof(int));
+               std::memcpy(coord, rec + sizeof(int), gmsh_dim*sizeof(double));
+               if (swap_bytes)
+               {
+                  bin_io::ByteSwap(&serial_number, sizeof(int), 1);
+                  bin_io::ByteSwap(coord, sizeof(double), gmsh_dim);
+               }
             }
             else // ASCII
             {
@@ -997,6 +1127,25 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
          {
             MFEM_ABORT("Gmsh file : vertices indices are not unique");
          }
+
+         // build the direct-lookup table unless the numbering is so sparse
+         // that it would more than double the memory of 'vertices_map'
+         if (NumOfVertices > 0)
+         {
+            min_vertex_serial = vertices_map.begin()->first;
+            const long range =
+               (long)vertices_map.rbegin()->first - min_vertex_serial + 1;
+            if (range <= 2L*NumOfVertices)
+            {
+               dense_vertices_map.SetSize((int)range);
+               dense_vertices_map = -1;
+               for (map<int, int>::const_iterator it = vertices_map.begin();
+                    it != vertices_map.end(); ++it)
+               {
+                  dense_vertices_map[it->first - min_vertex_serial] = it->second;
+               }
+            }
+         }
       } // section '$Nodes'
       else if (buff == "$Elements") // reading mesh elements
       {
@@ -1312,10 +1461,20 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
             int header[header_size];
             int n_elem_one_type; // number of elements of a specific type
 
+            // The element records of one type block have a fixed size, so
+            // they are read in bulk into bounded chunks instead of one
+            // stream read per element; the buffers are reused across blocks.
+            vector<int> block;
+            vector<int> vert_indices;
+
             while (n_elem_part < num_of_all_elements)
             {
                input.read(reinterpret_cast<char*>(header),
                           header_size*sizeof(int));
+               if (swap_bytes)
+               {
+                  bin_io::ByteSwap(header, sizeof(int), header_size);
+               }
                type_of_element = header[0];
                n_elem_one_type = header[1];
                n_tags          = header[2];
@@ -1323,11 +1482,26 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
                n_elem_part += n_elem_one_type;
 
                const int n_elem_nodes = nodes_of_gmsh_element[type_of_element-1];
-               vector<int> data(1+n_tags+n_elem_nodes);
+               const int rec_size = 1 + n_tags + n_elem_nodes; // in ints
+               const int chunk = std::max(1, (1 << 22)/rec_size);
+               block.resize((size_t)rec_size*std::min(chunk, n_elem_one_type));
+               vert_indices.resize(n_elem_nodes);
+               int buffered = 0, consumed = 0;
                for (int el = 0; el < n_elem_one_type; ++el)
                {
-                  input.read(reinterpret_cast<char*>(&data[0]),
-                             data.size()*sizeof(int));
+                  if (consumed == buffered)
+                  {
+                     buffered = std::min(chunk, n_elem_one_type - el);
+                     input.read(reinterpret_cast<char*>(&block[0]),
+                                (size_t)buffered*rec_size*sizeof(int));
+                     if (swap_bytes)
+                     {
+                        bin_io::ByteSwap(&block[0], sizeof(int),
+                                         (size_t)buffered*rec_size);
+                     }
+                     consumed = 0;
+                  }
+                  const int *data = &block[(size_t)(consumed++)*rec_size];
                   int dd = 0; // index for data array
                   serial_number = data[dd++];
                   // physical domain - the most important value (to distinguish
@@ -1341,16 +1515,29 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
                   n_partitions = (n_tags > 2) ? data[dd++] : 0;
                   // we currently just skip the partitions if they exist, and go
                   // directly to vertices describing the mesh element
-                  vector<int> vert_indices(n_elem_nodes);
                   for (int vi = 0; vi < n_elem_nodes; ++vi)
                   {
-                     map<int, int>::const_iterator it =
-                        vertices_map.find(data[1+n_tags+vi]);
-                     if (it == vertices_map.end())
+                     const int index = data[1+n_tags+vi];
+                     int ver = -1;
+                     if (dense_vertices_map.Size() > 0)
+                     {
+                        const int off = index - min_vertex_serial;
+                        if (off >= 0 && off < dense_vertices_map.Size())
+                        {
+                           ver = dense_vertices_map[off];
+                        }
+                     }
+                     else
+                     {
+                        map<int, int>::const_iterator it =
+                           vertices_map.find(index);
+                        if (it != vertices_map.end()) { ver = it->second; }
+                     }
+                     if (ver < 0)
                      {
                         MFEM_ABORT("Gmsh file : vertex index doesn't exist");
                      }
-                     vert_indices[vi] = it->second;
+                     vert_indices[vi] = ver;
                   }
 
                   // non-positive attributes are not allowed in MFEM
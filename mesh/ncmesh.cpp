@@ -1817,6 +1817,57 @@ void NCMesh::Derefine(const Array<int> &derefs)
    {
       transforms.embeddings[i].parent = elements[fine_coarse[i]].index;
    }
+
+   // Free element slots are only reused by refinement, so repeated
+   // derefinement can leave most of 'elements' unused. Compact the storage
+   // once the free slots dominate its memory usage.
+   if (free_element_ids.Size() > elements.Size()/2)
+   {
+      CompactElements();
+   }
+}
+
+void NCMesh::CompactElements()
+{
+   // move the elements to temporary storage and rebuild 'elements' in
+   // hierarchy (DFS) order, skipping the free slots
+   BlockArray<Element> tmp_elements;
+   elements.Swap(tmp_elements);
+   free_element_ids.DeleteAll();
+
+   Array<int> index_map(tmp_elements.Size());
+   index_map = -1;
+
+   // copy the roots, their IDs (0..M-1) do not change
+   for (int i = 0; i < root_state.Size(); i++)
+   {
+      index_map[i] = elements.Append(tmp_elements[i]);
+   }
+
+   // copy the rest of the hierarchy, renumbering parent/child links
+   for (int i = 0; i < root_state.Size(); i++)
+   {
+      CopyElements(i, tmp_elements, index_map);
+   }
+
+   // renumber element links in Face::elem[]
+   for (face_iterator face = faces.begin(); face != faces.end(); ++face)
+   {
+      for (int i = 0; i < 2; i++)
+      {
+         if (face->elem[i] >= 0)
+         {
+            face->elem[i] = index_map[face->elem[i]];
+            MFEM_ASSERT(face->elem[i] >= 0, "");
+         }
+      }
+   }
+
+   // renumber 'leaf_elements' (the leaf order and Element::index are kept)
+   for (int i = 0; i < leaf_elements.Size(); i++)
+   {
+      leaf_elements[i] = index_map[leaf_elements[i]];
+   }
 }
 
 void NCMesh::InitDerefTransforms()
@@ -536,6 +536,12 @@ protected: // implementation
    void RefineElement(int elem, char ref_type);
    void DerefineElement(int elem);
 
+   /** Compact 'elements': remove the slots freed by DerefineElement and
+       renumber the hierarchy (parent/child links, Face::elem[] and
+       'leaf_elements' are updated). Called by Derefine when free slots
+       make up a substantial part of the element storage. */
+   void CompactElements();
+
    int AddElement(const Element &el)
    {
       if (free_element_ids.Size())
@@ -226,9 +226,7 @@ protected:
    void CheckBdrPatches();
 
    void GetPatchKnotVectors   (int p, Array<KnotVector *> &kv);
-   void GetPatchKnotVectors   (int p, Array<const KnotVector *> &kv) const;
    void GetBdrPatchKnotVectors(int p, Array<KnotVector *> &kv);
-   void GetBdrPatchKnotVectors(int p, Array<const KnotVector *> &kv) const;
 
    void SetOrderFromOrders();
    void SetOrdersFromKnotVectors();
@@ -362,6 +360,16 @@ public:
    // Knotvector read-only access function
    const KnotVector *GetKnotVector(int i) const { return knotVectors[i]; }
 
+   void GetPatchKnotVectors   (int p, Array<const KnotVector *> &kv) const;
+   void GetBdrPatchKnotVectors(int p, Array<const KnotVector *> &kv) const;
+
+   /// Return the index of the patch containing element @a elem.
+   int GetElementPatch(int elem) const { return el_to_patch[elem]; }
+
+   /// Return the Cartesian knot-span indices of element @a elem in its patch.
+   void GetElementIJK(int elem, Array<int> &ijk) const
+   { el_to_IJK.GetRow(elem, ijk); }
+
    // Mesh generation functions
    void GetElementTopo   (Array<Element *> &elements) const;
    void GetBdrElementTopo(Array<Element *> &boundary) const;
@@ -59,6 +59,7 @@ ParMesh::ParMesh(const ParMesh &pmesh, bool copy_nodes)
 
    // Do not copy face-neighbor data (can be generated if needed)
    have_face_nbr_data = false;
+   face_nbr_sequence = -1;
 
    // If pmesh has a ParNURBSExtension, it was copied by the Mesh copy ctor, so
    // there is no need to do anything here.
@@ -279,6 +280,7 @@ ParMesh::ParMesh(MPI_Comm comm, Mesh &mesh, int *partitioning_,
    }
 
    have_face_nbr_data = false;
+   face_nbr_sequence = -1;
 }
 
 
@@ -845,6 +847,7 @@ ParMesh::ParMesh(const ParNCMesh &pncmesh)
    Mesh::InitFromNCMesh(pncmesh);
    ReduceMeshGen();
    have_face_nbr_data = false;
+   face_nbr_sequence = -1;
 }
 
 void ParMesh::ComputeGlobalElementOffset() const
@@ -912,6 +915,7 @@ ParMesh::ParMesh(MPI_Comm comm, istream &input, bool refine)
    MPI_Comm_rank(MyComm, &MyRank);
 
    have_face_nbr_data = false;
+   face_nbr_sequence = -1;
    pncmesh = NULL;
 
    string ident;
@@ -1086,6 +1090,7 @@ ParMesh::ParMesh(ParMesh *orig_mesh, int ref_factor, int ref_type)
      glob_offset_sequence(-1),
      gtopo(orig_mesh->gtopo),
      have_face_nbr_data(false),
+     face_nbr_sequence(-1),
      pncmesh(NULL)
 {
    // Need to initialize:
@@ -1470,7 +1475,7 @@ void ParMesh::MarkTetMeshForRefinement(DSTable &v_to_v)
          sedge_ord_map[j].one = sedge_ord[k+j];
          sedge_ord_map[j].two = j;
       }
-      SortPairs<int, int>(sedge_ord_map, n);
+      ParallelSort(sedge_ord_map.begin(), sedge_ord_map.begin() + n);
       for (int j = 0; j < n; j++)
       {
          const int sedge_from = group_sedge.GetJ()[k+j];
@@ -1501,7 +1506,7 @@ void ParMesh::MarkTetMeshForRefinement(DSTable &v_to_v)
          }
       }
 
-      SortPairs<int, double>(ilen_len, order.Size());
+      ParallelSort(ilen_len.begin(), ilen_len.begin() + order.Size());
 
       double d_max = 0.;
       for (int i = 1; i < order.Size(); i++)
@@ -1695,8 +1700,9 @@ void ParMesh::GetFaceNbrElementTransformation(
 
    if (Nodes == NULL)
    {
-      const int nv = elem->GetNVertices();
-      const int *v = elem->GetVertices();
+      // use the flat connectivity table instead of chasing the Element pointer
+      const int nv = face_nbr_el_vert.RowSize(i);
+      const int *v = face_nbr_el_vert.GetRow(i);
 
       pointmat.SetSize(spaceDim, nv);
       for (int k = 0; k < spaceDim; k++)
@@ -1743,6 +1749,20 @@ void ParMesh::DeleteFaceNbrData()
    }
 
    have_face_nbr_data = false;
+   if (Conforming() && face_nbr_sequence == sequence)
+   {
+      // The topology has not changed since the exchange schedule was built:
+      // keep the elements, tables, and send schedule so that the next call to
+      // ExchangeFaceNbrData() only refreshes the coordinates.
+      return;
+   }
+   DestroyFaceNbrData();
+}
+
+void ParMesh::DestroyFaceNbrData()
+{
+   have_face_nbr_data = false;
+   face_nbr_sequence = -1;
    face_nbr_group.DeleteAll();
    face_nbr_elements_offset.DeleteAll();
    face_nbr_vertices_offset.DeleteAll();
@@ -1752,10 +1772,28 @@ void ParMesh::DeleteFaceNbrData()
    }
    face_nbr_elements.DeleteAll();
    face_nbr_vertices.DeleteAll();
+   face_nbr_el_vert.Clear();
    send_face_nbr_elements.Clear();
    send_face_nbr_vertices.Clear();
 }
 
+void ParMesh::BuildFaceNbrElementToVertexTable()
+{
+   const int ne = face_nbr_elements.Size();
+   face_nbr_el_vert.MakeI(ne);
+   for (int i = 0; i < ne; i++)
+   {
+      face_nbr_el_vert.AddColumnsInRow(i, face_nbr_elements[i]->GetNVertices());
+   }
+   face_nbr_el_vert.MakeJ();
+   for (int i = 0; i < ne; i++)
+   {
+      const Element *el = face_nbr_elements[i];
+      face_nbr_el_vert.AddConnections(i, el->GetVertices(), el->GetNVertices());
+   }
+   face_nbr_el_vert.ShiftUpI();
+}
+
 void ParMesh::SetCurvature(int order, bool discont, int space_dim, int ordering)
 {
    space_dim = (space_dim == -1) ? spaceDim : space_dim;
@@ -1783,11 +1821,25 @@ void ParMesh::ExchangeFaceNbrData()
       return;
    }
 
+   if (Conforming() && face_nbr_sequence == sequence)
+   {
+      // The topology has not changed since the exchange schedule was built,
+      // e.g. only the vertices or the nodes were moved: reuse the retained
+      // elements, tables, and send schedule and only refresh the coordinates.
+      have_face_nbr_data = true;
+      ExchangeFaceNbrNodes();
+      return;
+   }
+
+   // free anything retained for a previous topology, see DeleteFaceNbrData()
+   DestroyFaceNbrData();
+
    if (Nonconforming())
    {
       // with ParNCMesh we can set up face neighbors without communication
       pncmesh->GetFaceNeighbors(*this);
       have_face_nbr_data = true;
+      BuildFaceNbrElementToVertexTable();
 
       ExchangeFaceNbrNodes();
       return;
@@ -1854,10 +1906,14 @@ void ParMesh::ExchangeFaceNbrData()
 
    if (del_tables) { delete gr_sface; }
 
+   face_nbr_sequence = sequence;
+
    if ( have_face_nbr_data ) { return; }
 
    have_face_nbr_data = true;
 
+   BuildFaceNbrElementToVertexTable();
+
    ExchangeFaceNbrNodes();
 }
 
@@ -3376,6 +3432,176 @@ bool ParMesh::NonconformingDerefinement(Array<double> &elem_error,
 }
 
 
+template <typename T>
+static void AllGatherV(const Array<T> &local, Array<T> &global,
+                       MPI_Datatype datatype, MPI_Comm comm)
+{
+   int nranks, size = local.Size();
+   MPI_Comm_size(comm, &nranks);
+
+   Array<int> counts(nranks), displs(nranks);
+   MPI_Allgather(&size, 1, MPI_INT, counts.GetData(), 1, MPI_INT, comm);
+
+   displs[0] = 0;
+   for (int i = 1; i < nranks; i++)
+   {
+      displs[i] = displs[i-1] + counts[i-1];
+   }
+
+   global.SetSize(displs[nranks-1] + counts[nranks-1]);
+   MPI_Allgatherv(local.GetData(), size, datatype, global.GetData(),
+                  counts.GetData(), displs.GetData(), datatype, comm);
+}
+
+Mesh* ParMesh::GatherSerialMesh()
+{
+   // Assign global vertex numbers using an H1 order-1 space, in which local
+   // dof 'i' is exactly vertex 'i': the global true dof numbers of the space
+   // then merge the copies of shared vertices automatically.
+   H1_FECollection vert_fec(1, Dim);
+   ParFiniteElementSpace vert_fes(this, &vert_fec);
+
+   const int glob_nv = vert_fes.GlobalTrueVSize();
+
+   Array<HYPRE_Int> glob_vert(NumOfVertices);
+   for (int i = 0; i < NumOfVertices; i++)
+   {
+      glob_vert[i] = vert_fes.GetGlobalTDofNumber(i);
+   }
+
+   // dump the local elements and boundary elements, with attributes, geometry
+   // types and global vertex numbers
+   Array<HYPRE_Int> elem_data, bdr_data;
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const Element *el = elements[i];
+      elem_data.Append(el->GetAttribute());
+      elem_data.Append(el->GetGeometryType());
+      const int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNVertices(); j++)
+      {
+         elem_data.Append(glob_vert[v[j]]);
+      }
+   }
+   for (int i = 0; i < NumOfBdrElements; i++)
+   {
+      const Element *be = boundary[i];
+      bdr_data.Append(be->GetAttribute());
+      bdr_data.Append(be->GetGeometryType());
+      const int *v = be->GetVertices();
+      for (int j = 0; j < be->GetNVertices(); j++)
+      {
+         bdr_data.Append(glob_vert[v[j]]);
+      }
+   }
+
+   // dump the coordinates of the vertices owned by this processor
+   Array<HYPRE_Int> own_vert;
+   Array<double> own_coord;
+   for (int i = 0; i < NumOfVertices; i++)
+   {
+      if (vert_fes.GetLocalTDofNumber(i) < 0) { continue; }
+      own_vert.Append(glob_vert[i]);
+      for (int j = 0; j < spaceDim; j++)
+      {
+         own_coord.Append(vertices[i](j));
+      }
+   }
+
+   Array<HYPRE_Int> glob_elem_data, glob_bdr_data, glob_own_vert;
+   Array<double> glob_coord;
+   AllGatherV(elem_data, glob_elem_data, HYPRE_MPI_INT, MyComm);
+   AllGatherV(bdr_data, glob_bdr_data, HYPRE_MPI_INT, MyComm);
+   AllGatherV(own_vert, glob_own_vert, HYPRE_MPI_INT, MyComm);
+   AllGatherV(own_coord, glob_coord, MPI_DOUBLE, MyComm);
+
+   int glob_ne_nbe[2] = { NumOfElements, NumOfBdrElements };
+   MPI_Allreduce(MPI_IN_PLACE, glob_ne_nbe, 2, MPI_INT, MPI_SUM, MyComm);
+
+   Mesh *smesh = new Mesh(Dim, glob_nv, glob_ne_nbe[0], glob_ne_nbe[1],
+                          spaceDim);
+
+   Array<double> vert_coord(glob_nv*spaceDim);
+   for (int i = 0; i < glob_own_vert.Size(); i++)
+   {
+      for (int j = 0; j < spaceDim; j++)
+      {
+         vert_coord[glob_own_vert[i]*spaceDim + j] = glob_coord[i*spaceDim + j];
+      }
+   }
+   for (int i = 0; i < glob_nv; i++)
+   {
+      smesh->AddVertex(&vert_coord[i*spaceDim]);
+   }
+
+   // create the elements in processor rank order, i.e. element
+   // 'displs[rank] + i' of 'smesh' is local element 'i' of 'rank'
+   for (int pos = 0; pos < glob_elem_data.Size(); )
+   {
+      Element *el = smesh->NewElement(glob_elem_data[pos+1]);
+      el->SetAttribute(glob_elem_data[pos]);
+      pos += 2;
+      int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNVertices(); j++)
+      {
+         v[j] = glob_elem_data[pos++];
+      }
+      smesh->AddElement(el);
+   }
+   for (int pos = 0; pos < glob_bdr_data.Size(); )
+   {
+      Element *be = smesh->NewElement(glob_bdr_data[pos+1]);
+      be->SetAttribute(glob_bdr_data[pos]);
+      pos += 2;
+      int *v = be->GetVertices();
+      for (int j = 0; j < be->GetNVertices(); j++)
+      {
+         v[j] = glob_bdr_data[pos++];
+      }
+      smesh->AddBdrElement(be);
+   }
+
+   smesh->FinalizeTopology();
+   smesh->Finalize();
+
+   if (Nodes)
+   {
+      const FiniteElementSpace *nfes = Nodes->FESpace();
+      int order = NumOfElements ? nfes->GetOrder(0) : 0;
+      MPI_Allreduce(MPI_IN_PLACE, &order, 1, MPI_INT, MPI_MAX, MyComm);
+      const bool discont =
+         dynamic_cast<const L2_FECollection*>(nfes->FEColl()) != NULL;
+      smesh->SetCurvature(order, discont, spaceDim, nfes->GetOrdering());
+
+      // Transfer the node coordinates element by element: local dof 'j' of
+      // an element refers to the same reference point in both meshes, since
+      // the element vertices are in the same order (GetElementVDofs resolves
+      // the edge/face orientations, which may differ after renumbering).
+      Array<double> node_data;
+      Array<int> vdofs;
+      Vector vals;
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         nfes->GetElementVDofs(i, vdofs);
+         Nodes->GetSubVector(vdofs, vals);
+         node_data.Append(vals.GetData(), vals.Size());
+      }
+
+      Array<double> glob_node_data;
+      AllGatherV(node_data, glob_node_data, MPI_DOUBLE, MyComm);
+
+      GridFunction &snodes = *smesh->GetNodes();
+      for (int i = 0, pos = 0; i < smesh->GetNE(); i++)
+      {
+         snodes.FESpace()->GetElementVDofs(i, vdofs);
+         snodes.SetSubVector(vdofs, &glob_node_data[pos]);
+         pos += vdofs.Size();
+      }
+   }
+
+   return smesh;
+}
+
 void ParMesh::Rebalance()
 {
    RebalanceImpl(NULL); // default SFC-based partition
@@ -3390,8 +3616,76 @@ void ParMesh::RebalanceImpl(const Array<int> *partition)
 {
    if (Conforming())
    {
-      MFEM_ABORT("Load balancing is currently not supported for conforming"
-                 " meshes.");
+      MFEM_VERIFY(NURBSext == NULL, "Load balancing is not supported for "
+                  "NURBS meshes.");
+
+      DeleteFaceNbrData();
+
+      // A conforming mesh is rebalanced by gathering it on all processors
+      // and redistributing it through the standard ParMesh constructor. Note
+      // that this requires O(global mesh) memory on each processor.
+      Mesh *smesh = GatherSerialMesh();
+
+      Array<int> global_partition;
+      if (partition)
+      {
+         MFEM_VERIFY(partition->Size() == NumOfElements,
+                     "invalid partition size: " << partition->Size());
+         // concatenate the local partitions in rank order, matching the
+         // element numbering of the gathered mesh
+         AllGatherV(*partition, global_partition, MPI_INT, MyComm);
+      }
+
+      ParMesh *pmesh2 =
+         new ParMesh(MyComm, *smesh,
+                     partition ? global_partition.GetData() : NULL);
+      delete smesh;
+
+      attributes.Copy(pmesh2->attributes);
+      bdr_attributes.Copy(pmesh2->bdr_attributes);
+
+      Mesh::Swap(*pmesh2, false);
+
+      // take over the parallel structures of 'pmesh2' as well
+      mfem::Swap(shared_edges, pmesh2->shared_edges);
+      mfem::Swap(shared_trias, pmesh2->shared_trias);
+      mfem::Swap(shared_quads, pmesh2->shared_quads);
+      group_svert.Swap(pmesh2->group_svert);
+      group_sedge.Swap(pmesh2->group_sedge);
+      group_stria.Swap(pmesh2->group_stria);
+      group_squad.Swap(pmesh2->group_squad);
+      mfem::Swap(svert_lvert, pmesh2->svert_lvert);
+      mfem::Swap(sedge_ledge, pmesh2->sedge_ledge);
+      mfem::Swap(sface_lface, pmesh2->sface_lface);
+      pmesh2->gtopo.Copy(gtopo);
+
+      if (Nodes)
+      {
+         // rebuild the Nodes on 'this' from the redistributed nodes of
+         // 'pmesh2' (the local dof layouts of the two spaces coincide)
+         ParFiniteElementSpace *pfes =
+            new ParFiniteElementSpace(*pmesh2->Nodes->FESpace(), *this);
+         ParGridFunction *new_nodes = new ParGridFunction(pfes);
+         *new_nodes = *pmesh2->Nodes;
+         if (pmesh2->Nodes->OwnFEC())
+         {
+            new_nodes->MakeOwner(pmesh2->Nodes->OwnFEC());
+            pmesh2->Nodes->MakeOwner(NULL);
+            delete pmesh2->Nodes->FESpace();
+         }
+         delete Nodes;
+         Nodes = new_nodes;
+         own_nodes = 1;
+      }
+      delete pmesh2;
+
+      // Unlike the nonconforming case below, no update operator for the FE
+      // spaces on this mesh can be constructed, so we leave 'last_operation'
+      // at Mesh::NONE: the spaces and grid functions must be rebuilt.
+      last_operation = Mesh::NONE;
+      sequence++;
+
+      return;
    }
 
    // Make sure the Nodes use a ParFiniteElementSpace
@@ -4226,12 +4520,16 @@ void ParMesh::Print(std::ostream &out) const
        "# PRISM       = 6\n"
        "#\n";
 
+   // The large sections below are formatted in bulk, see general/text.hpp.
+   BufferedTextWriter buf_out(out);
+
    out << "\ndimension\n" << Dim
        << "\n\nelements\n" << NumOfElements << '\n';
    for (i = 0; i < NumOfElements; i++)
    {
-      PrintElement(elements[i], out);
+      PrintElement(elements[i], buf_out);
    }
+   buf_out.Flush();
 
    int num_bdr_elems = NumOfBdrElements;
    if (print_shared && Dim > 1)
@@ -4241,7 +4539,7 @@ void ParMesh::Print(std::ostream &out) const
    out << "\nboundary\n" << num_bdr_elems << '\n';
    for (i = 0; i < NumOfBdrElements; i++)
    {
-      PrintElement(boundary[i], out);
+      PrintElement(boundary[i], buf_out);
    }
 
    if (print_shared && Dim > 1)
@@ -4258,22 +4556,25 @@ void ParMesh::Print(std::ostream &out) const
       {
          // Modify the attributes of the faces (not used otherwise?)
          faces[(*s2l_face)[i]]->SetAttribute(shared_bdr_attr);
-         PrintElement(faces[(*s2l_face)[i]], out);
+         PrintElement(faces[(*s2l_face)[i]], buf_out);
       }
    }
+   buf_out.Flush();
    out << "\nvertices\n" << NumOfVertices << '\n';
    if (Nodes == NULL)
    {
       out << spaceDim << '\n';
       for (i = 0; i < NumOfVertices; i++)
       {
-         out << vertices[i](0);
+         buf_out.WriteDouble(vertices[i](0));
          for (j = 1; j < spaceDim; j++)
          {
-            out << ' ' << vertices[i](j);
+            buf_out.WriteChar(' ');
+            buf_out.WriteDouble(vertices[i](j));
          }
-         out << '\n';
+         buf_out.WriteChar('\n');
       }
+      buf_out.Flush();
       out.flush();
    }
    else
@@ -5365,6 +5666,49 @@ void ParMesh::ParPrint(ostream &out) const
    out << "\nmfem_mesh_end" << endl;
 }
 
+void ParMesh::Save(const char *fname_prefix, int pad_digits,
+                   int precision) const
+{
+   stringstream fname;
+   fname << fname_prefix << '.' << setfill('0') << setw(pad_digits) << MyRank;
+   ofstream ofs(fname.str().c_str());
+   ofs.precision(precision);
+   ParPrint(ofs);
+}
+
+ParMesh *ParMesh::Load(MPI_Comm comm, const char *fname_prefix,
+                       int pad_digits, bool refine)
+{
+   int rank;
+   MPI_Comm_rank(comm, &rank);
+   stringstream fname;
+   fname << fname_prefix << '.' << setfill('0') << setw(pad_digits) << rank;
+   named_ifgzstream ifs(fname.str().c_str());
+   if (!ifs)
+   {
+      MFEM_ABORT("ParMesh file not found: " << fname.str() << '\n');
+   }
+   return new ParMesh(comm, ifs, refine);
+}
+
+void ParMesh::SaveAggregated(const char *fname_prefix, int num_files,
+                             int pad_digits, int precision) const
+{
+   stringstream piece;
+   piece.precision(precision);
+   ParPrint(piece);
+   AggregatedWrite(MyComm, fname_prefix, num_files, piece.str(), pad_digits);
+}
+
+ParMesh *ParMesh::LoadAggregated(MPI_Comm comm, const char *fname_prefix,
+                                 int num_files, int pad_digits, bool refine)
+{
+   string piece;
+   AggregatedRead(comm, fname_prefix, num_files, piece, pad_digits);
+   istringstream ifs(piece);
+   return new ParMesh(comm, ifs, refine);
+}
+
 int ParMesh::FindPoints(DenseMatrix& point_mat, Array<int>& elem_id,
                         Array<IntegrationPoint>& ip, bool warn,
                         InverseElementTransformation *inv_trans)
@@ -5506,7 +5850,7 @@ ParMesh::~ParMesh()
    delete pncmesh;
    ncmesh = pncmesh = NULL;
 
-   DeleteFaceNbrData();
+   DestroyFaceNbrData();
 
    for (int i = 0; i < shared_edges.Size(); i++)
    {
@@ -33,7 +33,7 @@ class ParMesh : public Mesh
 {
 protected:
    ParMesh() : MyComm(0), NRanks(0), MyRank(-1),
-      have_face_nbr_data(false), pncmesh(NULL) {}
+      have_face_nbr_data(false), face_nbr_sequence(-1), pncmesh(NULL) {}
 
    MPI_Comm MyComm;
    int NRanks, MyRank;
@@ -129,6 +129,13 @@ protected:
 
    void ExchangeFaceNbrData(Table *gr_sface, int *s2l_face);
 
+   /// Rebuild face_nbr_el_vert from the received face-neighbor elements.
+   void BuildFaceNbrElementToVertexTable();
+
+   /// Unconditionally free all face-neighbor data, including any exchange
+   /// schedule retained by DeleteFaceNbrData() for an unchanged topology.
+   void DestroyFaceNbrData();
+
    /// Refine a mixed 2D mesh uniformly.
    virtual void UniformRefinement2D();
 
@@ -150,6 +157,12 @@ protected:
 
    void RebalanceImpl(const Array<int> *partition);
 
+   /** Replicate the global mesh on all processors by gathering the local
+       parts. Shared vertices are merged using a global vertex numbering
+       derived from an H1 order-1 space. Used by RebalanceImpl() for
+       conforming meshes. The caller owns the returned serial mesh. */
+   Mesh* GatherSerialMesh();
+
    void DeleteFaceNbrData();
 
    bool WantSkipSharedMaster(const NCMesh::Master &master) const;
@@ -248,11 +261,17 @@ public:
 
    // Face-neighbor elements and vertices
    bool             have_face_nbr_data;
+   /// Mesh::sequence at the time the face-neighbor exchange schedule was
+   /// built, or -1 when no schedule is available for the current topology.
+   long             face_nbr_sequence;
    Array<int>       face_nbr_group;
    Array<int>       face_nbr_elements_offset;
    Array<int>       face_nbr_vertices_offset;
    Array<Element *> face_nbr_elements;
    Array<Vertex>    face_nbr_vertices;
+   /// Flat element-to-vertex connectivity of the face-neighbor elements: row
+   /// @a i lists the face_nbr_vertices indices of face-neighbor element @a i.
+   Table            face_nbr_el_vert;
    // Local face-neighbor elements and vertices ordered by face-neighbor
    Table            send_face_nbr_elements;
    Table            send_face_nbr_vertices;
@@ -287,6 +306,12 @@ public:
    int GetFaceNbrGroup(int fn) const { return face_nbr_group[fn]; }
    int GetFaceNbrRank(int fn) const;
 
+   /** @brief Flat (CSR) element-to-vertex connectivity of the face-neighbor
+       elements: row @a i lists the face_nbr_vertices indices of face-neighbor
+       element @a i. Valid after ExchangeFaceNbrData(). */
+   const Table &GetFaceNbrElementToVertexTable() const
+   { return face_nbr_el_vert; }
+
    /** Similar to Mesh::GetFaceToElementTable with added face-neighbor elements
        with indices offset by the local number of elements. */
    Table *GetFaceToAllElementTable() const;
@@ -317,13 +342,18 @@ public:
    /// Utility function: sum integers from all processors (Allreduce).
    virtual long ReduceInt(int value) const;
 
-   /** Load balance the mesh by equipartitioning the global space-filling
-       sequence of elements. Works for nonconforming meshes only. */
+   /** Load balance the mesh. Nonconforming meshes are rebalanced by
+       equipartitioning the global space-filling sequence of elements.
+       Conforming meshes are gathered on all processors and repartitioned
+       with METIS (as at startup), which requires O(global mesh) memory on
+       each processor; unlike the nonconforming case, no update operator for
+       FE spaces on the mesh is created, so spaces and grid functions have
+       to be rebuilt after the call. */
    void Rebalance();
 
-   /** Load balance a nonconforming mesh using a user-defined partition.
-       Each local element 'i' is migrated to processor rank 'partition[i]',
-       for 0 <= i < GetNE(). */
+   /** Load balance the mesh using a user-defined partition. Each local
+       element 'i' is migrated to processor rank 'partition[i]', for
+       0 <= i < GetNE(). See the notes on conforming meshes in Rebalance(). */
    void Rebalance(const Array<int> &partition);
 
    /** Print the part of the mesh in the calling processor adding the interface
@@ -362,6 +392,45 @@ public:
    /// Save the mesh in a parallel mesh format.
    void ParPrint(std::ostream &out) const;
 
+   /** @brief Save the local piece of the mesh in the parallel mesh format,
+       one file per MPI rank, named "<fname_prefix>.<rank>" with the rank
+       zero-padded to @a pad_digits digits.
+
+       Every rank writes only its own piece (using ParPrint()), so the I/O is
+       fully parallel and the pieces can be reloaded with Load() in a later
+       run with the same number of ranks. */
+   void Save(const char *fname_prefix, int pad_digits = 6,
+             int precision = 16) const;
+
+   /** @brief Read a mesh written by Save(): every rank opens only its own
+       piece "<fname_prefix>.<rank>", so no rank ever holds the full serial
+       mesh and the startup memory is proportional to the local mesh size.
+
+       A serial mesh can be partitioned once, in a run that fits the full
+       mesh in memory, using ParMesh(MPI_Comm, Mesh&, int*) followed by
+       Save(); subsequent runs at the same rank count then start through this
+       method without the serial bottleneck. The returned ParMesh is
+       allocated with new and owned by the caller. */
+   static ParMesh *Load(MPI_Comm comm, const char *fname_prefix,
+                        int pad_digits = 6, bool refine = true);
+
+   /** @brief Save the mesh into @a num_files aggregate files written with
+       MPI-IO collective writes, instead of one file per rank.
+
+       Each rank serializes its piece with ParPrint() and the pieces are
+       aggregated into the files "<fname_prefix>.<file>" by AggregatedWrite(),
+       so the file system sees @a num_files creates instead of one per rank.
+       Reload with LoadAggregated() on the same number of ranks and files. */
+   void SaveAggregated(const char *fname_prefix, int num_files,
+                       int pad_digits = 6, int precision = 16) const;
+
+   /** @brief Read a mesh written by SaveAggregated() with the same
+       @a num_files on the same number of ranks. The returned ParMesh is
+       allocated with new and owned by the caller. */
+   static ParMesh *LoadAggregated(MPI_Comm comm, const char *fname_prefix,
+                                  int num_files, int pad_digits = 6,
+                                  bool refine = true);
+
    virtual int FindPoints(DenseMatrix& point_mat, Array<int>& elem_ids,
                           Array<IntegrationPoint>& ips, bool warn = true,
                           InverseElementTransformation *inv_trans = NULL);
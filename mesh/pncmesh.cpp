@@ -32,6 +32,8 @@ ParNCMesh::ParNCMesh(MPI_Comm comm, const NCMesh &ncmesh, int *part)
    MPI_Comm_size(MyComm, &NRanks);
    MPI_Comm_rank(MyComm, &MyRank);
 
+   layer_seed = false;
+
    // assign leaf elements to the processors by simply splitting the
    // sequence of leaf elements into 'NRanks' parts
    for (int i = 0; i < leaf_elements.Size(); i++)
@@ -52,6 +54,7 @@ ParNCMesh::ParNCMesh(const ParNCMesh &other)
    , MyComm(other.MyComm)
    , NRanks(other.NRanks)
    , MyRank(other.MyRank)
+   , layer_seed(false)
 {
    Update(); // mark all secondary stuff for recalculation
 }
@@ -85,8 +88,11 @@ void ParNCMesh::Update()
    shared_faces.Clear();
 
    element_type.SetSize(0);
-   ghost_layer.SetSize(0);
-   boundary_layer.SetSize(0);
+   if (!layer_seed)
+   {
+      ghost_layer.SetSize(0);
+      boundary_layer.SetSize(0);
+   }
 }
 
 void ParNCMesh::AssignLeafIndices()
@@ -570,8 +576,7 @@ bool ParNCMesh::GroupContains(GroupId id, int rank) const
 void ParNCMesh::CreateGroups(int nentities, Array<Connection> &index_rank,
                              Array<GroupId> &entity_group)
 {
-   index_rank.Sort();
-   index_rank.Unique();
+   ParallelSortUnique(index_rank);
 
    entity_group.SetSize(nentities);
    entity_group = 0;
@@ -767,6 +772,12 @@ void ParNCMesh::UpdateLayers()
 {
    if (element_type.Size()) { return; }
 
+   if (layer_seed)
+   {
+      UpdateLayersFromSeed();
+      return;
+   }
+
    int nleaves = leaf_elements.Size();
 
    element_type.SetSize(nleaves);
@@ -801,6 +812,82 @@ void ParNCMesh::UpdateLayers()
    }
 }
 
+void ParNCMesh::CollectSubtreeLeaves(int elem, Array<int> &leaves) const
+{
+   const Element &el = elements[elem];
+   if (!el.ref_type)
+   {
+      leaves.Append(elem);
+   }
+   else
+   {
+      for (int i = 0; i < 8 && el.child[i] >= 0; i++)
+      {
+         CollectSubtreeLeaves(el.child[i], leaves);
+      }
+   }
+}
+
+void ParNCMesh::UpdateLayersFromSeed()
+{
+   // 'ghost_layer' and 'boundary_layer' were kept from the pre-refinement
+   // state by Refine(). Refinement does not change element ranks and does not
+   // extend the region covered by the old layers, so the new layers can only
+   // contain leaf descendants of the old layer elements. We classify just the
+   // descendants here; all other leaves keep the type implied by their rank.
+
+   layer_seed = false;
+
+   int nleaves = leaf_elements.Size();
+
+   element_type.SetSize(nleaves);
+   for (int i = 0; i < nleaves; i++)
+   {
+      element_type[i] = (elements[leaf_elements[i]].rank == MyRank) ? 1 : 0;
+   }
+
+   // get the current leaf descendants of the old layers
+   Array<int> ghost_cand, local_cand;
+   for (int i = 0; i < ghost_layer.Size(); i++)
+   {
+      CollectSubtreeLeaves(ghost_layer[i], ghost_cand);
+   }
+   for (int i = 0; i < boundary_layer.Size(); i++)
+   {
+      CollectSubtreeLeaves(boundary_layer[i], local_cand);
+   }
+
+   // determine the new ghost layer: ghost candidates that neighbor our
+   // elements (all their local neighbors are among 'local_cand')
+   Array<int> ghosts;
+   NeighborExpand(local_cand, ghosts, &ghost_cand);
+   for (int i = 0; i < ghosts.Size(); i++)
+   {
+      element_type[elements[ghosts[i]].index] = 2;
+   }
+
+   // determine the new boundary layer: local candidates that neighbor the
+   // new ghost layer
+   Array<int> boundary;
+   NeighborExpand(ghosts, boundary, &local_cand);
+   for (int i = 0; i < boundary.Size(); i++)
+   {
+      element_type[elements[boundary[i]].index] = 3;
+   }
+
+   // rebuild the layer arrays in leaf element order, as in UpdateLayers()
+   ghost_layer.SetSize(0);
+   boundary_layer.SetSize(0);
+   for (int i = 0; i < nleaves; i++)
+   {
+      switch (element_type[i])
+      {
+         case 2: ghost_layer.Append(leaf_elements[i]); break;
+         case 3: boundary_layer.Append(leaf_elements[i]); break;
+      }
+   }
+}
+
 bool ParNCMesh::CheckElementType(int elem, int type)
 {
    Element &el = elements[elem];
@@ -1458,6 +1545,11 @@ void ParNCMesh::Refine(const Array<Refinement> &refinements)
       }
    }
 
+   // 'ghost_layer' and 'boundary_layer' still describe the pre-refinement
+   // state and ranks have not changed: let Update() keep them so that
+   // UpdateLayers() can classify only their descendants next time
+   layer_seed = (element_type.Size() > 0);
+
    Update();
 
    // make sure we can delete the send buffers
@@ -2210,20 +2302,31 @@ ParNCMesh::ElementSet::ElementSet(const ElementSet &other)
 
 void ParNCMesh::ElementSet::WriteInt(int value)
 {
-   // helper to put an int to the data array
-   data.Append(value & 0xff);
-   data.Append((value >> 8) & 0xff);
-   data.Append((value >> 16) & 0xff);
-   data.Append((value >> 24) & 0xff);
+   // helper to put an int to the data array, using a variable length
+   // encoding: 7 bits per byte starting from the lowest, the high bit of
+   // each byte marking a continuation (small root numbers take one byte)
+   unsigned uval = value + 1; // bias so the -1 end marker is a single zero
+   while (uval >= 0x80)
+   {
+      data.Append((uval & 0x7f) | 0x80);
+      uval >>= 7;
+   }
+   data.Append(uval);
 }
 
-int ParNCMesh::ElementSet::GetInt(int pos) const
+int ParNCMesh::ElementSet::GetInt(int &pos) const
 {
-   // helper to get an int from the data array
-   return (int) data[pos] +
-          ((int) data[pos+1] << 8) +
-          ((int) data[pos+2] << 16) +
-          ((int) data[pos+3] << 24);
+   // helper to get a variable length encoded int from the data array
+   unsigned uval = 0, byte;
+   int shift = 0;
+   do
+   {
+      byte = data[pos++];
+      uval |= (byte & 0x7f) << shift;
+      shift += 7;
+   }
+   while (byte & 0x80);
+   return ((int) uval) - 1;
 }
 
 void ParNCMesh::ElementSet::FlagElements(const Array<int> &elements, char flag)
@@ -2282,6 +2385,10 @@ void ParNCMesh::ElementSet::Encode(const Array<int> &elements)
 {
    FlagElements(elements, 1);
 
+   // the encoding takes at least one byte per marked element; reserving that
+   // much up front avoids most reallocations while the trees are written
+   data.Reserve(elements.Size());
+
    // Each refinement tree that contains at least one element from the set
    // is encoded as HEADER + TREE, where HEADER is the root element number and
    // TREE is the output of EncodeTree().
@@ -2364,7 +2471,6 @@ void ParNCMesh::ElementSet::Decode(Array<int> &elements) const
    int root, pos = 0;
    while ((root = GetInt(pos)) >= 0)
    {
-      pos += 4;
       DecodeTree(root, pos, elements);
    }
 }
@@ -2523,6 +2629,34 @@ void ParNCMesh::ChangeRemainingMeshIds(Array<MeshId> &ids, int pos,
    }
 }
 
+/** Write a non-negative int to a stream using the same variable length
+    encoding as ElementSet::WriteInt: stream element numbers, group numbers
+    and MPI ranks are typically small and then take a single byte. */
+static void write_enc(std::ostream &os, unsigned value)
+{
+   while (value >= 0x80)
+   {
+      write<unsigned char>(os, (value & 0x7f) | 0x80);
+      value >>= 7;
+   }
+   write<unsigned char>(os, value);
+}
+
+/// Inverse of write_enc.
+static unsigned read_enc(std::istream &is)
+{
+   unsigned value = 0, byte;
+   int shift = 0;
+   do
+   {
+      byte = read<unsigned char>(is);
+      value |= (byte & 0x7f) << shift;
+      shift += 7;
+   }
+   while (byte & 0x80);
+   return value;
+}
+
 void ParNCMesh::EncodeMeshIds(std::ostream &os, Array<MeshId> ids[])
 {
    std::map<int, int> stream_id;
@@ -2560,7 +2694,7 @@ void ParNCMesh::EncodeMeshIds(std::ostream &os, Array<MeshId> ids[])
       for (int i = 0; i < ids[type].Size(); i++)
       {
          const MeshId& id = ids[type][i];
-         write<int>(os, stream_id[id.element]); // TODO: variable 1-4 bytes
+         write_enc(os, stream_id[id.element]);
          write<char>(os, id.local);
       }
    }
@@ -2583,7 +2717,7 @@ void ParNCMesh::DecodeMeshIds(std::istream &is, Array<MeshId> ids[])
 
       for (int i = 0; i < ne; i++)
       {
-         int el_num = read<int>(is);
+         int el_num = read_enc(is);
          int elem = elems[el_num];
          Element &el = elements[elem];
 
@@ -2647,7 +2781,7 @@ void ParNCMesh::EncodeGroups(std::ostream &os, const Array<GroupId> &ids)
          write<short>(os, group.size());
          for (unsigned i = 0; i < group.size(); i++)
          {
-            write<int>(os, group[i]);
+            write_enc(os, group[i]);
          }
       }
       else
@@ -2661,7 +2795,7 @@ void ParNCMesh::EncodeGroups(std::ostream &os, const Array<GroupId> &ids)
    write<int>(os, ids.Size());
    for (int i = 0; i < ids.Size(); i++)
    {
-      write<GroupId>(os, stream_id[ids[i]]);
+      write_enc(os, stream_id[ids[i]]);
    }
 }
 
@@ -2682,7 +2816,7 @@ void ParNCMesh::DecodeGroups(std::istream &is, Array<GroupId> &ids)
          ranks.resize(size);
          for (int i = 0; i < size; i++)
          {
-            ranks[i] = read<int>(is);
+            ranks[i] = read_enc(is);
          }
          groups[id] = GetGroupId(ranks);
       }
@@ -2696,7 +2830,7 @@ void ParNCMesh::DecodeGroups(std::istream &is, Array<GroupId> &ids)
    ids.SetSize(read<int>(is));
    for (int i = 0; i < ids.Size(); i++)
    {
-      ids[i] = groups[read<GroupId>(is)];
+      ids[i] = groups[read_enc(is)];
    }
 }
 
@@ -2731,7 +2865,7 @@ void ParNCMesh::ElementValueMessage<ValueType, RefTypes, Tag>::Encode(int)
 
    for (unsigned i = 0; i < values.size(); i++)
    {
-      write<int>(ostream, element_index[elements[i]]); // element number
+      write_enc(ostream, element_index[elements[i]]); // element number
       write<ValueType>(ostream, values[i]);
    }
 
@@ -2756,7 +2890,7 @@ void ParNCMesh::ElementValueMessage<ValueType, RefTypes, Tag>::Decode(int)
    int count = read<int>(istream);
    for (int i = 0; i < count; i++)
    {
-      int index = read<int>(istream);
+      int index = read_enc(istream);
       MFEM_ASSERT(index >= 0 && (size_t) index < values.size(), "");
       values[index] = read<ValueType>(istream);
    }
@@ -2785,14 +2919,28 @@ void ParNCMesh::RebalanceDofMessage::SetElements(const Array<int> &elems,
 static void write_dofs(std::ostream &os, const std::vector<int> &dofs)
 {
    write<int>(os, dofs.size());
-   // TODO: we should compress the ints, mostly they are contiguous ranges
-   os.write((const char*) dofs.data(), dofs.size() * sizeof(int));
+   // the DOF numbers mostly form contiguous ranges, so we store the deltas
+   // between consecutive entries, zig-zag mapped to non-negative values --
+   // a run of consecutive DOFs then costs a single byte per entry
+   int prev = 0;
+   for (unsigned i = 0; i < dofs.size(); i++)
+   {
+      int delta = dofs[i] - prev;
+      write_enc(os, ((unsigned) delta << 1) ^ (unsigned)(delta >> 31));
+      prev = dofs[i];
+   }
 }
 
 static void read_dofs(std::istream &is, std::vector<int> &dofs)
 {
    dofs.resize(read<int>(is));
-   is.read((char*) dofs.data(), dofs.size() * sizeof(int));
+   int prev = 0;
+   for (unsigned i = 0; i < dofs.size(); i++)
+   {
+      unsigned uval = read_enc(is);
+      prev += (int)(uval >> 1) ^ -(int)(uval & 1);
+      dofs[i] = prev;
+   }
 }
 
 void ParNCMesh::RebalanceDofMessage::Encode(int)
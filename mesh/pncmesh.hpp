@@ -289,6 +289,11 @@ protected: // implementation
    Array<int> ghost_layer;    ///< list of elements whose 'element_type' == 2.
    Array<int> boundary_layer; ///< list of type 3 elements
 
+   /** If true, 'ghost_layer' and 'boundary_layer' have been kept from the
+       previous mesh state and only refinement has occurred since, so
+       UpdateLayers() can update the layers incrementally. Set by Refine(). */
+   bool layer_seed;
+
    virtual void Update();
 
    virtual bool IsGhost(const Element& el) const
@@ -342,6 +347,14 @@ protected: // implementation
 
    void UpdateLayers();
 
+   /** Recompute the layers from the previous 'ghost_layer' and
+       'boundary_layer' after refinement, visiting only their descendants
+       instead of all leaf elements. See 'layer_seed'. */
+   void UpdateLayersFromSeed();
+
+   /// Append the current leaf descendants of element 'elem' to 'leaves'.
+   void CollectSubtreeLeaves(int elem, Array<int> &leaves) const;
+
    void MakeSharedTable(int ngroups, int ent, Array<int> &shared_local,
                         Table &group_shared, Array<char> *entity_geom = NULL,
                         char geom = 0);
@@ -377,7 +390,7 @@ protected: // implementation
       void DecodeTree(int elem, int &pos, Array<int> &elements) const;
 
       void WriteInt(int value);
-      int  GetInt(int pos) const;
+      int  GetInt(int &pos) const;
       void FlagElements(const Array<int> &elements, char flag);
 
 #ifdef MFEM_DEBUG
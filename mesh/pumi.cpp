@@ -755,7 +755,7 @@ void ParPumiMesh::UpdateMesh(const ParMesh* AdaptedpMesh)
    delete pncmesh;
    pncmesh = NULL;
 
-   DeleteFaceNbrData();
+   DestroyFaceNbrData();
 
    for (int i = 0; i < shared_edges.Size(); i++)
    {
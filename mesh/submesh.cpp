@@ -0,0 +1,177 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mesh_headers.hpp"
+#include "submesh.hpp"
+#include "../fem/fem.hpp"
+
+#include <map>
+#include <vector>
+#include <algorithm>
+
+namespace mfem
+{
+
+SubMesh::SubMesh(const Mesh &parent_mesh, const Array<int> &attributes)
+   : parent(&parent_mesh)
+{
+   const int dim = parent_mesh.Dimension();
+   const int sdim = parent_mesh.SpaceDimension();
+   const int max_attr = parent_mesh.attributes.Size() ?
+                        parent_mesh.attributes.Max() : 0;
+
+   Array<int> attr_marker(max_attr);
+   attr_marker = 0;
+   for (int i = 0; i < attributes.Size(); i++)
+   {
+      const int attr = attributes[i];
+      MFEM_VERIFY(attr >= 1 && attr <= max_attr,
+                  "invalid attribute " << attr << " in the attribute set");
+      attr_marker[attr-1] = 1;
+   }
+
+   int nelem = 0;
+   for (int i = 0; i < parent_mesh.GetNE(); i++)
+   {
+      if (attr_marker[parent_mesh.GetAttribute(i)-1]) { nelem++; }
+   }
+   MFEM_VERIFY(nelem > 0, "the given attribute set selects no elements");
+
+   InitMesh(dim, sdim, 0, nelem, 0);
+
+   // Single pass over the parent elements: duplicate the selected ones,
+   // adding their vertices as they are first encountered and recording the
+   // element and vertex maps back to the parent mesh.
+   Array<int> vert_map(parent_mesh.GetNV());
+   vert_map = -1;
+   parent_element_ids.Reserve(nelem);
+   for (int i = 0; i < parent_mesh.GetNE(); i++)
+   {
+      if (!attr_marker[parent_mesh.GetAttribute(i)-1]) { continue; }
+      Element *el = parent_mesh.GetElement(i)->Duplicate(this);
+      const int nv = el->GetNVertices();
+      int *v = el->GetVertices();
+      for (int j = 0; j < nv; j++)
+      {
+         if (vert_map[v[j]] < 0)
+         {
+            vert_map[v[j]] = AddVertex(parent_mesh.GetVertex(v[j]));
+            parent_vertex_ids.Append(v[j]);
+         }
+         v[j] = vert_map[v[j]];
+      }
+      AddElement(el);
+      parent_element_ids.Append(i);
+   }
+
+   FinalizeTopology(); // also generates the boundary elements
+   InheritBoundaryAttributes();
+   Finalize();
+
+   // Inherit the curvature of the parent mesh, using the same nodal basis.
+   const GridFunction *parent_nodes = parent_mesh.GetNodes();
+   if (parent_nodes)
+   {
+      const FiniteElementSpace *pnfes = parent_nodes->FESpace();
+      FiniteElementCollection *nfec =
+         FiniteElementCollection::New(pnfes->FEColl()->Name());
+      FiniteElementSpace *nfes =
+         new FiniteElementSpace(this, nfec, pnfes->GetVDim(),
+                                pnfes->GetOrdering());
+      SetNodalFESpace(nfes);
+      Nodes->MakeOwner(nfec);
+      TransferField(*parent_nodes, *Nodes);
+   }
+}
+
+void SubMesh::InheritBoundaryAttributes()
+{
+   if (parent->GetNBE() == 0 || GetNBE() == 0) { return; }
+
+   // key the parent boundary elements by their sorted vertex sets
+   std::map<std::vector<int>, int> bdr_attr;
+   for (int i = 0; i < parent->GetNBE(); i++)
+   {
+      const Element *be = parent->GetBdrElement(i);
+      std::vector<int> key(be->GetVertices(),
+                           be->GetVertices() + be->GetNVertices());
+      std::sort(key.begin(), key.end());
+      bdr_attr[key] = be->GetAttribute();
+   }
+
+   for (int i = 0; i < GetNBE(); i++)
+   {
+      Element *be = boundary[i];
+      const int nv = be->GetNVertices();
+      const int *v = be->GetVertices();
+      std::vector<int> key(nv);
+      for (int j = 0; j < nv; j++) { key[j] = parent_vertex_ids[v[j]]; }
+      std::sort(key.begin(), key.end());
+      std::map<std::vector<int>, int>::const_iterator it = bdr_attr.find(key);
+      if (it != bdr_attr.end()) { be->SetAttribute(it->second); }
+   }
+   SetAttributes(); // update the attribute lists
+}
+
+SparseMatrix *SubMesh::CreateTransferMap(const FiniteElementSpace &parent_fes,
+                                         const FiniteElementSpace &sub_fes)
+const
+{
+   MFEM_VERIFY(sub_fes.GetMesh() == this,
+               "'sub_fes' is not defined on this SubMesh");
+   MFEM_VERIFY(parent_fes.GetMesh() == parent,
+               "'parent_fes' is not defined on the parent mesh");
+   MFEM_VERIFY(parent_fes.GetVDim() == sub_fes.GetVDim() &&
+               parent_fes.GetOrdering() == sub_fes.GetOrdering(),
+               "incompatible vector structure of the spaces");
+
+   SparseMatrix *R = new SparseMatrix(sub_fes.GetVSize(),
+                                      parent_fes.GetVSize());
+   Array<int> pvdofs, svdofs;
+   for (int i = 0; i < GetNE(); i++)
+   {
+      parent_fes.GetElementVDofs(parent_element_ids[i], pvdofs);
+      sub_fes.GetElementVDofs(i, svdofs);
+      MFEM_ASSERT(pvdofs.Size() == svdofs.Size(),
+                  "incompatible elements in the two spaces");
+      for (int k = 0; k < svdofs.Size(); k++)
+      {
+         int pv = pvdofs[k], sv = svdofs[k];
+         double s = 1.0;
+         if (sv < 0) { sv = -1-sv; s = -s; }
+         if (pv < 0) { pv = -1-pv; s = -s; }
+         R->Set(sv, pv, s);
+      }
+   }
+   R->Finalize();
+   return R;
+}
+
+void SubMesh::TransferField(const GridFunction &parent_gf,
+                            GridFunction &sub_gf) const
+{
+   MFEM_VERIFY(sub_gf.FESpace()->GetMesh() == this,
+               "'sub_gf' is not defined on this SubMesh");
+   MFEM_VERIFY(parent_gf.FESpace()->GetMesh() == parent,
+               "'parent_gf' is not defined on the parent mesh");
+
+   Array<int> pvdofs, svdofs;
+   Vector loc;
+   for (int i = 0; i < GetNE(); i++)
+   {
+      parent_gf.FESpace()->GetElementVDofs(parent_element_ids[i], pvdofs);
+      sub_gf.FESpace()->GetElementVDofs(i, svdofs);
+      parent_gf.GetSubVector(pvdofs, loc);
+      sub_gf.SetSubVector(svdofs, loc);
+   }
+}
+
+}
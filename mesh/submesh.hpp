@@ -0,0 +1,95 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_SUBMESH
+#define MFEM_SUBMESH
+
+#include "../config/config.hpp"
+#include "../linalg/sparsemat.hpp"
+#include "mesh.hpp"
+
+namespace mfem
+{
+
+class FiniteElementSpace;
+
+/** @brief Subdomain mesh extracted from a parent Mesh by element attribute.
+
+    A SubMesh contains copies of all parent elements whose attribute belongs
+    to a given set of attributes, together with the maps from its elements and
+    vertices back to the parent mesh. The maps allow GridFunction data defined
+    on the parent mesh to be restricted to the subdomain, either through the
+    sparse dof-injection matrix returned by CreateTransferMap() or directly
+    with TransferField(). Mesh curvature (the nodal grid function) is
+    inherited from the parent, and boundary elements that coincide with
+    parent boundary elements inherit their boundary attributes.
+
+    A typical use is region-limited postprocessing: extract the region of
+    interest once, then transfer and save fields on the (much smaller)
+    SubMesh instead of dumping the full domain. */
+class SubMesh : public Mesh
+{
+public:
+   /** @brief Extract the subdomain of @a parent formed by the elements whose
+       attribute appears in the list @a attributes.
+
+       The parent mesh must be conforming and must remain valid for the
+       lifetime of the SubMesh. Element attributes are copied from the
+       parent. */
+   SubMesh(const Mesh &parent, const Array<int> &attributes);
+
+   /// Return the parent Mesh this SubMesh was extracted from.
+   const Mesh *GetParent() const { return parent; }
+
+   /** @brief Return the map from SubMesh element indices to parent element
+       indices, i.e. entry i is the parent element that element i was copied
+       from. */
+   const Array<int> &GetParentElementIDMap() const
+   { return parent_element_ids; }
+
+   /// Return the map from SubMesh vertex indices to parent vertex indices.
+   const Array<int> &GetParentVertexIDMap() const
+   { return parent_vertex_ids; }
+
+   /** @brief Create the sparse dof-injection matrix R mapping vdofs of
+       @a parent_fes to vdofs of @a sub_fes, so that sub_gf = R parent_gf
+       restricts a parent grid function to the subdomain.
+
+       The matrix has exactly one nonzero (+1 or -1) per row. The two spaces
+       must use the same FiniteElementCollection, vdim and ordering, with
+       @a sub_fes defined on this SubMesh and @a parent_fes on the parent
+       mesh. The caller owns the returned matrix. */
+   SparseMatrix *CreateTransferMap(const FiniteElementSpace &parent_fes,
+                                   const FiniteElementSpace &sub_fes) const;
+
+   /** @brief Restrict @a parent_gf to the subdomain, writing the result in
+       @a sub_gf, without forming the transfer matrix.
+
+       The spaces of the two grid functions must be related as described in
+       CreateTransferMap(). */
+   void TransferField(const GridFunction &parent_gf,
+                      GridFunction &sub_gf) const;
+
+private:
+   /// The parent mesh, not owned.
+   const Mesh *parent;
+   /// Map from SubMesh element index to parent element index.
+   Array<int> parent_element_ids;
+   /// Map from SubMesh vertex index to parent vertex index.
+   Array<int> parent_vertex_ids;
+
+   /// Copy boundary attributes from coinciding parent boundary elements.
+   void InheritBoundaryAttributes();
+};
+
+}
+
+#endif
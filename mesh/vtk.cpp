@@ -11,6 +11,9 @@
 
 #include "vtk.hpp"
 #include "../general/binaryio.hpp"
+
+#include <algorithm>
+#include <cstring>
 #ifdef MFEM_USE_ZLIB
 #include <zlib.h>
 #endif
@@ -430,19 +433,48 @@ void WriteVTKEncodedCompressed(std::ostream &out, const void *bytes,
 #ifdef MFEM_USE_ZLIB
       MFEM_ASSERT(compression_level >= -1 && compression_level <= 9,
                   "Compression level must be between -1 and 9 (inclusive).");
-      uLongf buf_sz = compressBound(nbytes);
-      std::vector<unsigned char> buf(buf_sz);
-      compress2(buf.data(), &buf_sz, static_cast<const Bytef *>(bytes), nbytes,
-                compression_level);
+      // Split the data into fixed-size blocks that are compressed
+      // independently (the multi-block layout of the VTK appended data
+      // format), so the compression of large arrays can run in parallel.
+      const uint32_t block_size = std::min<uint32_t>(nbytes, 1 << 20);
+      const int num_blocks =
+         block_size ? (int)((nbytes + block_size - 1)/block_size) : 1;
+      std::vector<std::vector<unsigned char> > blocks(num_blocks);
+      std::vector<uLongf> block_sz(num_blocks);
+      #pragma omp parallel for
+      for (int b = 0; b < num_blocks; b++)
+      {
+         const uint32_t offset = b*block_size;
+         const uint32_t bsize = std::min(block_size, nbytes - offset);
+         uLongf sz = compressBound(bsize);
+         blocks[b].resize(sz);
+         compress2(blocks[b].data(), &sz,
+                   static_cast<const Bytef *>(bytes) + offset, bsize,
+                   compression_level);
+         block_sz[b] = sz;
+      }
 
       // Write the header
-      std::vector<uint32_t> header(4);
-      header[0] = 1; // number of blocks
-      header[1] = nbytes; // uncompressed size
-      header[2] = 0; // size of partial block
-      header[3] = buf_sz; // compressed size
+      std::vector<uint32_t> header(3 + num_blocks);
+      header[0] = num_blocks; // number of blocks
+      header[1] = block_size; // uncompressed size of a full block
+      // size of the last block when partial, 0 when all blocks are full
+      header[2] = block_size ? (nbytes % block_size) : 0;
+      for (int b = 0; b < num_blocks; b++)
+      {
+         header[3 + b] = block_sz[b]; // compressed block sizes
+      }
       bin_io::WriteBase64(out, header.data(), header.size()*sizeof(uint32_t));
-      // Write the compressed data
+      // Write the compressed blocks, base64-encoded as one stream
+      uLongf buf_sz = 0;
+      for (int b = 0; b < num_blocks; b++) { buf_sz += block_sz[b]; }
+      std::vector<unsigned char> buf(buf_sz);
+      buf_sz = 0;
+      for (int b = 0; b < num_blocks; b++)
+      {
+         std::memcpy(buf.data() + buf_sz, blocks[b].data(), block_sz[b]);
+         buf_sz += block_sz[b];
+      }
       bin_io::WriteBase64(out, buf.data(), buf_sz);
 #else
       MFEM_ABORT("MFEM must be compiled with ZLib support to output "
@@ -14,6 +14,8 @@
 
 #include "../fem/geom.hpp"
 
+#include <cstdint>
+
 namespace mfem
 {
 
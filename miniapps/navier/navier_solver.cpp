@@ -350,22 +350,29 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    sw_extrap.Start();
 
    N->Mult(un, Nun);
-   Nun.Add(1.0, fn);
 
+   // Fuse the forcing accumulation into the extrapolation sweep: store
+   // N(u^n) + f^{n+1} back into Nun for the history rotation and form the
+   // extrapolated term in the same pass.
    {
-      const auto d_Nun = Nun.Read();
+      const auto d_fn = fn.Read();
       const auto d_Nunm1 = Nunm1.Read();
       const auto d_Nunm2 = Nunm2.Read();
+      auto d_Nun = Nun.ReadWrite();
       auto d_Fext = Fext.Write();
       MFEM_FORALL(i, Fext.Size(),
-                  d_Fext[i] = ab1 * d_Nun[i] +
+                  const double nun = d_Nun[i] + d_fn[i];
+                  d_Nun[i] = nun;
+                  d_Fext[i] = ab1 * nun +
                               ab2 * d_Nunm1[i] +
                               ab3 * d_Nunm2[i];);
    }
 
-   // Rotate the solutions from previous time steps.
-   Nunm2 = Nunm1;
-   Nunm1 = Nun;
+   // Rotate the solutions from previous time steps, swapping the underlying
+   // storage instead of copying it; Nun is fully overwritten by the next
+   // nonlinear apply.
+   Nunm2.Swap(Nunm1);
+   Nunm1.Swap(Nun);
 
    // Fext = M^{-1} (F(u^{n}) + f^{n+1})
    MvInv->Mult(Fext, tmp1);
@@ -373,7 +380,8 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    res_mvsolve = MvInv->GetFinalNorm();
    Fext.Set(1.0, tmp1);
 
-   // Compute BDF terms.
+   // Compute the BDF terms and the extrapolated velocity in a single sweep
+   // over the velocity history.
    {
       const double bd1idt = -bd1 / dt;
       const double bd2idt = -bd2 / dt;
@@ -382,10 +390,14 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
       const auto d_unm1 = unm1.Read();
       const auto d_unm2 = unm2.Read();
       auto d_Fext = Fext.ReadWrite();
+      auto d_Lext = Lext.Write();
       MFEM_FORALL(i, Fext.Size(),
                   d_Fext[i] += bd1idt * d_un[i] +
                                bd2idt * d_unm1[i] +
-                               bd3idt * d_unm2[i];);
+                               bd3idt * d_unm2[i];
+                  d_Lext[i] = ab1 * d_un[i] +
+                              ab2 * d_unm1[i] +
+                              ab3 * d_unm2[i];);
    }
 
    sw_extrap.Stop();
@@ -394,16 +406,6 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    // Pressure poisson.
    //
    sw_curlcurl.Start();
-   {
-      const auto d_un = un.Read();
-      const auto d_unm1 = unm1.Read();
-      const auto d_unm2 = unm2.Read();
-      auto d_Lext = Lext.Write();
-      MFEM_FORALL(i, Lext.Size(),
-                  d_Lext[i] = ab1 * d_un[i] +
-                              ab2 * d_unm1[i] +
-                              ab3 * d_unm2[i];);
-   }
 
    Lext_gf.SetFromTrueDofs(Lext);
    if (pmesh->Dimension() == 2)
@@ -418,17 +420,22 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    }
 
    curlcurlu_gf.GetTrueDofs(Lext);
-   Lext *= kin_vis;
 
    sw_curlcurl.Stop();
 
-   // \tilde{F} = F - \nu CurlCurl(u)
-   FText.Set(-1.0, Lext);
-   FText.Add(1.0, Fext);
+   // \tilde{F} = F - \nu CurlCurl(u), with the viscosity scaling folded into
+   // the same sweep
+   {
+      const double nu = kin_vis;
+      const auto d_Lext = Lext.Read();
+      const auto d_Fext = Fext.Read();
+      auto d_FText = FText.Write();
+      MFEM_FORALL(i, FText.Size(),
+                  d_FText[i] = d_Fext[i] - nu * d_Lext[i];);
+   }
 
    // p_r = \nabla \cdot FText
    D->Mult(FText, resp);
-   resp.Neg();
 
    // Add boundary terms.
    FText_gf.SetFromTrueDofs(FText);
@@ -437,8 +444,17 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
 
    g_bdr_form->Assemble();
    g_bdr_form->ParallelAssemble(g_bdr);
-   resp.Add(1.0, FText_bdr);
-   resp.Add(-bd0 / dt, g_bdr);
+
+   // resp = -div(FText) + FText_bdr - (bd0/dt) g_bdr in a single sweep
+   {
+      const double bd0idt = -bd0 / dt;
+      const auto d_FText_bdr = FText_bdr.Read();
+      const auto d_g_bdr = g_bdr.Read();
+      auto d_resp = resp.ReadWrite();
+      MFEM_FORALL(i, resp.Size(),
+                  d_resp[i] = -d_resp[i] + d_FText_bdr[i] +
+                              bd0idt * d_g_bdr[i];);
+   }
 
    if (pres_dbcs.empty())
    {
@@ -484,9 +500,14 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
    // Project velocity.
    //
    G->Mult(pn, resu);
-   resu.Neg();
    Mv->Mult(Fext, tmp1);
-   resu.Add(1.0, tmp1);
+
+   // resu = M F - grad(p) in a single sweep
+   {
+      const auto d_tmp1 = tmp1.Read();
+      auto d_resu = resu.ReadWrite();
+      MFEM_FORALL(i, resu.Size(), d_resu[i] = d_tmp1[i] - d_resu[i];);
+   }
 
    for (auto &vel_dbc : vel_dbcs)
    {
@@ -495,9 +516,11 @@ void NavierSolver::Step(double &time, double dt, int cur_step)
 
    vfes->GetRestrictionMatrix()->MultTranspose(resu, resu_gf);
 
-   // Rotate solutions from previous time steps.
-   unm2 = unm1;
-   unm1 = un;
+   // Rotate solutions from previous time steps, swapping the underlying
+   // storage instead of copying it; un is fully overwritten after the
+   // Helmholtz solve below.
+   unm2.Swap(unm1);
+   unm1.Swap(un);
 
    Vector X2, B2;
    if (partial_assembly)
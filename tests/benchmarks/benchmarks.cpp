@@ -0,0 +1,279 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+//
+// -------------------------------------------------------------------------
+//             Performance regression benchmarks (serial kernels)
+// -------------------------------------------------------------------------
+//
+// Curated suite of kernel benchmarks for trend tracking: sparse matrix-vector
+// product, partially assembled diffusion and mass operator application at
+// orders 1 to 8, element restriction transfer, quadrature interpolation, and
+// full CG iterations. Each benchmark reports throughput in GDOF/s and an
+// estimated data volume in GB/s, compared against the streaming bandwidth
+// measured by a vector triad — a simple roofline reference for these
+// memory-bound kernels.
+//
+// Run with:  make benchmarks   (from the top-level MFEM directory)
+// or:        ./benchmarks [-d cuda] [-j benchmarks.json]
+
+#include "mfem.hpp"
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+
+using namespace std;
+using namespace mfem;
+
+struct BenchmarkResult
+{
+   string name;
+   int order;
+   long dofs;
+   double seconds;  // seconds per repetition
+   double gdofs;    // dofs processed per second, in 1e9
+   double gbytes;   // estimated data volume per second, in 1e9
+};
+
+static vector<BenchmarkResult> results;
+static double peak_gbytes = 0.0; // measured triad bandwidth
+
+// Time one repetition of 'kernel', repeating until the total measured time
+// exceeds min_time seconds.
+template <typename Kernel>
+static double TimeKernel(Kernel kernel, double min_time = 0.25)
+{
+   StopWatch sw;
+   kernel(); // warm-up (also moves data to the device, if enabled)
+   MFEM_DEVICE_SYNC;
+   int reps = 1;
+   while (true)
+   {
+      sw.Clear();
+      sw.Start();
+      for (int i = 0; i < reps; i++) { kernel(); }
+      MFEM_DEVICE_SYNC;
+      sw.Stop();
+      const double t = sw.RealTime();
+      if (t >= min_time) { return t/reps; }
+      reps *= (t > 0.0) ? max(2, (int)(1.2*min_time/t)) : 16;
+   }
+}
+
+static void Report(const string &name, int order, long dofs, double seconds,
+                   double bytes)
+{
+   BenchmarkResult r;
+   r.name = name;
+   r.order = order;
+   r.dofs = dofs;
+   r.seconds = seconds;
+   r.gdofs = 1e-9*dofs/seconds;
+   r.gbytes = 1e-9*bytes/seconds;
+   results.push_back(r);
+
+   cout << left << setw(28) << name << right
+        << " p=" << setw(2) << order
+        << setw(10) << dofs << " dofs"
+        << fixed << setprecision(3)
+        << setw(9) << r.gdofs << " GDOF/s"
+        << setw(9) << r.gbytes << " GB/s";
+   if (peak_gbytes > 0.0)
+   {
+      cout << setw(6) << setprecision(1) << 100.0*r.gbytes/peak_gbytes
+           << "% of peak";
+   }
+   cout << endl;
+}
+
+// Measure the streaming bandwidth with a vector triad, z = x + a*y. This is
+// the roofline reference for the memory-bound kernels below.
+static void BenchmarkTriad()
+{
+   const int n = 1 << 22;
+   Vector x(n), y(n), z(n);
+   x.UseDevice(true); y.UseDevice(true); z.UseDevice(true);
+   x = 1.0; y = 2.0; z = 0.0;
+   const double seconds = TimeKernel([&]() { add(x, 0.5, y, z); });
+   peak_gbytes = 1e-9*3.0*sizeof(double)*n/seconds;
+   Report("triad (peak bandwidth)", 0, n, seconds, 3.0*sizeof(double)*n);
+}
+
+static void BenchmarkSparseMatVec()
+{
+   for (int p = 1; p <= 2; p++)
+   {
+      const int n = 40/p;
+      Mesh mesh(n, n, n, Element::HEXAHEDRON, 1, 1.0, 1.0, 1.0);
+      H1_FECollection fec(p, 3);
+      FiniteElementSpace fes(&mesh, &fec);
+      BilinearForm a(&fes);
+      a.AddDomainIntegrator(new DiffusionIntegrator);
+      a.Assemble();
+      a.Finalize();
+      const SparseMatrix &A = a.SpMat();
+      Vector x(A.Width()), y(A.Height());
+      x.UseDevice(true); y.UseDevice(true);
+      x = 1.0;
+      const double seconds = TimeKernel([&]() { A.Mult(x, y); });
+      // CSR data plus row pointers, the source and the destination vector
+      const double bytes =
+         A.NumNonZeroElems()*(sizeof(double) + sizeof(int)) +
+         (A.Height() + 1)*sizeof(int) +
+         (A.Width() + A.Height())*sizeof(double);
+      Report("SparseMatrix::Mult", p, A.Height(), seconds, bytes);
+   }
+}
+
+static void BenchmarkPAApply(bool mass)
+{
+   for (int p = 1; p <= 8; p++)
+   {
+      const int n = max(2, 40/p);
+      Mesh mesh(n, n, n, Element::HEXAHEDRON, 1, 1.0, 1.0, 1.0);
+      H1_FECollection fec(p, 3);
+      FiniteElementSpace fes(&mesh, &fec);
+      BilinearForm a(&fes);
+      a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      if (mass) { a.AddDomainIntegrator(new MassIntegrator); }
+      else { a.AddDomainIntegrator(new DiffusionIntegrator); }
+      a.Assemble();
+      Vector x(fes.GetVSize()), y(fes.GetVSize());
+      x.UseDevice(true); y.UseDevice(true);
+      x = 1.0;
+      const double seconds = TimeKernel([&]() { a.Mult(x, y); });
+      // source, destination, and the assembled quadrature data: one value
+      // per point for mass, a symmetric 3x3 matrix for diffusion
+      const long nq = (long)mesh.GetNE()*pow(p + 2, 3);
+      const double bytes =
+         (2.0*fes.GetVSize() + (mass ? 1.0 : 6.0)*nq)*sizeof(double);
+      Report(mass ? "PA mass apply" : "PA diffusion apply",
+             p, fes.GetVSize(), seconds, bytes);
+   }
+}
+
+static void BenchmarkElementRestriction()
+{
+   const int p = 2;
+   Mesh mesh(20, 20, 20, Element::HEXAHEDRON, 1, 1.0, 1.0, 1.0);
+   H1_FECollection fec(p, 3);
+   FiniteElementSpace fes(&mesh, &fec);
+   const Operator *R = fes.GetElementRestriction(
+                          ElementDofOrdering::LEXICOGRAPHIC);
+   MFEM_VERIFY(R, "no element restriction");
+   Vector x(R->Width()), y(R->Height());
+   x.UseDevice(true); y.UseDevice(true);
+   x = 1.0;
+   const double seconds = TimeKernel([&]() { R->Mult(x, y); });
+   // gather indices, the L-vector and the E-vector
+   const double bytes = R->Height()*(sizeof(int) + sizeof(double)) +
+                        R->Width()*sizeof(double);
+   Report("ElementRestriction::Mult", p, fes.GetVSize(), seconds, bytes);
+}
+
+static void BenchmarkQuadInterpolator()
+{
+   const int p = 2;
+   Mesh mesh(20, 20, 20, Element::HEXAHEDRON, 1, 1.0, 1.0, 1.0);
+   H1_FECollection fec(p, 3);
+   FiniteElementSpace fes(&mesh, &fec);
+   const IntegrationRule &ir =
+      IntRules.Get(Geometry::CUBE, 2*p + 1);
+   const Operator *R = fes.GetElementRestriction(
+                          ElementDofOrdering::LEXICOGRAPHIC);
+   const QuadratureInterpolator *qi = fes.GetQuadratureInterpolator(ir);
+   MFEM_VERIFY(R && qi, "no quadrature interpolator");
+   Vector x(R->Width()), e_vec(R->Height());
+   Vector q_val((long)mesh.GetNE()*ir.GetNPoints());
+   x.UseDevice(true); e_vec.UseDevice(true); q_val.UseDevice(true);
+   x = 1.0;
+   R->Mult(x, e_vec);
+   const double seconds = TimeKernel([&]() { qi->Values(e_vec, q_val); });
+   const double bytes = (e_vec.Size() + q_val.Size())*sizeof(double);
+   Report("QuadratureInterpolator", p, fes.GetVSize(), seconds, bytes);
+}
+
+static void BenchmarkCG()
+{
+   const int p = 2, iters = 50;
+   Mesh mesh(20, 20, 20, Element::HEXAHEDRON, 1, 1.0, 1.0, 1.0);
+   H1_FECollection fec(p, 3);
+   FiniteElementSpace fes(&mesh, &fec);
+   BilinearForm a(&fes);
+   a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a.AddDomainIntegrator(new DiffusionIntegrator);
+   a.Assemble();
+   Vector b(fes.GetVSize()), x(fes.GetVSize());
+   b.UseDevice(true); x.UseDevice(true);
+   b = 1.0;
+   CGSolver cg;
+   cg.SetOperator(a);
+   cg.SetRelTol(0.0);
+   cg.SetAbsTol(0.0);
+   cg.SetMaxIter(iters);
+   cg.SetPrintLevel(-1);
+   const double seconds = TimeKernel([&]() { x = 0.0; cg.Mult(b, x); },
+                                     0.5)/iters;
+   // per iteration: one operator apply plus roughly five full-vector sweeps
+   const long nq = (long)mesh.GetNE()*pow(p + 2, 3);
+   const double bytes =
+      (2.0*fes.GetVSize() + 6.0*nq + 10.0*fes.GetVSize())*sizeof(double);
+   Report("CG iteration (PA diffusion)", p, fes.GetVSize(), seconds, bytes);
+}
+
+static void WriteJSON(const string &file_name)
+{
+   ofstream out(file_name.c_str());
+   out << "{\n  \"peak_gbytes_per_sec\": " << peak_gbytes << ",\n"
+       << "  \"benchmarks\": [";
+   for (size_t i = 0; i < results.size(); i++)
+   {
+      const BenchmarkResult &r = results[i];
+      out << (i ? "," : "") << "\n    {"
+          << "\"name\": \"" << r.name << "\", "
+          << "\"order\": " << r.order << ", "
+          << "\"dofs\": " << r.dofs << ", "
+          << "\"seconds\": " << r.seconds << ", "
+          << "\"gdofs_per_sec\": " << r.gdofs << ", "
+          << "\"gbytes_per_sec\": " << r.gbytes << "}";
+   }
+   out << "\n  ]\n}\n";
+   MFEM_VERIFY(out, "error writing JSON output: " << file_name);
+   cout << "Wrote " << file_name << endl;
+}
+
+int main(int argc, char *argv[])
+{
+   const char *device_config = "cpu";
+   const char *json_file = "";
+   OptionsParser args(argc, argv);
+   args.AddOption(&device_config, "-d", "--device",
+                  "Device configuration string, see Device::Configure().");
+   args.AddOption(&json_file, "-j", "--json",
+                  "Write the results to the given JSON file.");
+   args.Parse();
+   if (!args.Good()) { args.PrintUsage(cout); return 1; }
+
+   Device device(device_config);
+   device.Print();
+
+   BenchmarkTriad();
+   BenchmarkSparseMatVec();
+   BenchmarkPAApply(false);
+   BenchmarkPAApply(true);
+   BenchmarkElementRestriction();
+   BenchmarkQuadInterpolator();
+   BenchmarkCG();
+
+   if (json_file[0] != '\0') { WriteJSON(json_file); }
+   return 0;
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "unit_tests.hpp"
+#include "mfem.hpp"
+
+using namespace mfem;
+
+namespace nurbs_pa
+{
+
+static double coeff_func(const Vector &x)
+{
+   double s = 1.3 + 0.4*sin(x(0)) + 0.25*cos(2.0*x(1));
+   if (x.Size() == 3) { s += 0.1*x(2)*x(2); }
+   return s;
+}
+
+// Compare the patch-level mass and diffusion operators against the standard
+// full assembly path, using the same tensor-product quadrature rule.
+static void TestNURBSPatchOps(const char *mesh_file, int degree_elevate,
+                              int refine)
+{
+   Mesh mesh(mesh_file, 1, 1);
+   if (degree_elevate > 0) { mesh.DegreeElevate(degree_elevate); }
+   for (int r = 0; r < refine; r++) { mesh.UniformRefinement(); }
+   const int dim = mesh.Dimension();
+
+   FiniteElementSpace fes(&mesh, mesh.GetNodes()->OwnFEC());
+   FunctionCoefficient Q(coeff_func);
+
+   // Tensor-product Gauss rule with q1d points per direction, matching the
+   // default rule of the patch-level operators.
+   const int q1d = mesh.NURBSext->GetOrder() + 1;
+   const IntegrationRule &ir1d = IntRules.Get(Geometry::SEGMENT, 2*q1d - 1);
+   const int nqz = (dim == 3) ? q1d : 1;
+   IntegrationRule ir(q1d*q1d*nqz);
+   for (int qz = 0; qz < nqz; qz++)
+   {
+      for (int qy = 0; qy < q1d; qy++)
+      {
+         for (int qx = 0; qx < q1d; qx++)
+         {
+            IntegrationPoint &ip = ir[qx + q1d*(qy + q1d*qz)];
+            ip.x = ir1d.IntPoint(qx).x;
+            ip.y = ir1d.IntPoint(qy).x;
+            ip.z = (dim == 3) ? ir1d.IntPoint(qz).x : 0.0;
+            ip.weight = ir1d.IntPoint(qx).weight*ir1d.IntPoint(qy).weight*
+                        ((dim == 3) ? ir1d.IntPoint(qz).weight : 1.0);
+         }
+      }
+   }
+
+   for (int op = 0; op < 2; op++)
+   {
+      BilinearForm a(&fes);
+      BilinearFormIntegrator *bfi = (op == 0) ?
+                                    (BilinearFormIntegrator *)
+                                    new MassIntegrator(Q) :
+                                    new DiffusionIntegrator(Q);
+      bfi->SetIntRule(&ir);
+      a.AddDomainIntegrator(bfi);
+      a.Assemble();
+      a.Finalize();
+
+      Operator *pa_op;
+      if (op == 0) { pa_op = new NURBSPatchMassOperator(fes, &Q); }
+      else { pa_op = new NURBSPatchDiffusionOperator(fes, &Q); }
+
+      Vector x(fes.GetVSize()), y_full(x.Size()), y_patch(x.Size());
+      x.Randomize(3);
+      a.Mult(x, y_full);
+      pa_op->Mult(x, y_patch);
+      y_patch -= y_full;
+      REQUIRE(y_patch.Normlinf() < 1e-12*y_full.Normlinf());
+      delete pa_op;
+   }
+}
+
+TEST_CASE("NURBS Patch Assembly", "[NURBSPatchOperator][PartialAssembly]")
+{
+   SECTION("2D")
+   {
+      TestNURBSPatchOps("../../data/square-nurbs.mesh", 1, 2);
+      TestNURBSPatchOps("../../data/square-nurbs.mesh", 2, 1);
+      TestNURBSPatchOps("../../data/disc-nurbs.mesh", 0, 2);
+   }
+   SECTION("3D")
+   {
+      TestNURBSPatchOps("../../data/cube-nurbs.mesh", 1, 1);
+      TestNURBSPatchOps("../../data/pipe-nurbs.mesh", 0, 1);
+   }
+}
+
+} // namespace nurbs_pa
@@ -0,0 +1,79 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "unit_tests.hpp"
+#include "mfem.hpp"
+
+using namespace mfem;
+
+namespace tmop_pa
+{
+
+static TMOP_QualityMetric *NewMetric(int mid)
+{
+   switch (mid)
+   {
+      case 1:   return new TMOP_Metric_001;
+      case 2:   return new TMOP_Metric_002;
+      case 302: return new TMOP_Metric_302;
+      case 303: return new TMOP_Metric_303;
+   }
+   return NULL;
+}
+
+// Compare the PA action of the TMOP metric term with the standard
+// element-by-element assembly on a perturbed curved mesh.
+static void TestTMOPAction(int dim, int mid, int order)
+{
+   INFO("dim=" << dim << ", metric=" << mid << ", order=" << order);
+   Mesh *mesh = (dim == 2) ?
+                new Mesh(3, 3, Element::QUADRILATERAL, 1, 1.0, 1.0) :
+                new Mesh(2, 2, 2, Element::HEXAHEDRON);
+   mesh->SetCurvature(order, false, -1, Ordering::byNODES);
+   GridFunction *nodes = mesh->GetNodes();
+   for (int i = 0; i < nodes->Size(); i++)
+   {
+      (*nodes)(i) += 0.01 * sin(13.0 * i);
+   }
+   FiniteElementSpace &fes = *nodes->FESpace();
+
+   TMOP_QualityMetric *metric = NewMetric(mid);
+   TargetConstructor target_c(TargetConstructor::IDEAL_SHAPE_UNIT_SIZE);
+   target_c.SetNodes(*nodes);
+
+   NonlinearForm nlf_full(&fes), nlf_pa(&fes);
+   nlf_full.AddDomainIntegrator(new TMOP_Integrator(metric, &target_c));
+   nlf_pa.AddDomainIntegrator(new TMOP_Integrator(metric, &target_c));
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.Setup();
+
+   Vector x(*nodes), y_full(x.Size()), y_pa(x.Size());
+   nlf_full.Mult(x, y_full);
+   nlf_pa.Mult(x, y_pa);
+
+   y_pa -= y_full;
+   REQUIRE(y_pa.Normlinf() < 1e-11 * y_full.Normlinf());
+   delete metric;
+   delete mesh;
+}
+
+TEST_CASE("TMOP Partial Assembly", "[TMOP_Integrator][PartialAssembly]")
+{
+   for (int order = 1; order <= 3; order++)
+   {
+      TestTMOPAction(2, 1, order);
+      TestTMOPAction(2, 2, order);
+      TestTMOPAction(3, 302, order);
+      TestTMOPAction(3, 303, order);
+   }
+}
+
+} // namespace tmop_pa
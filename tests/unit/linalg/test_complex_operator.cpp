@@ -113,3 +113,57 @@ TEST_CASE("ComplexOperator Quaternion Tests", "[ComplexOperator]")
       REQUIRE(qikx.Normlinf() < tol);
    }
 }
+
+TEST_CASE("ComplexSparseMatrix Fused Matvec", "[ComplexOperator]")
+{
+   double tol = 1e-13;
+   const int n = 100;
+
+   // Random sparse matrices with different sparsity patterns for the real
+   // and the imaginary part.
+   SparseMatrix *A_r = new SparseMatrix(n, n);
+   SparseMatrix *A_i = new SparseMatrix(n, n);
+   srand(1);
+   for (int i = 0; i < n; i++)
+   {
+      A_r->Set(i, i, 2.0 + rand()/(double)RAND_MAX);
+      for (int k = 0; k < 5; k++)
+      {
+         A_r->Set(i, rand() % n, -1.0 + 2.0*rand()/(double)RAND_MAX);
+      }
+      for (int k = 0; k < 3; k++)
+      {
+         A_i->Set(i, rand() % n, -1.0 + 2.0*rand()/(double)RAND_MAX);
+      }
+   }
+   A_r->Finalize();
+   A_i->Finalize();
+
+   ComplexOperator::Convention conv =
+      GENERATE(ComplexOperator::HERMITIAN, ComplexOperator::BLOCK_SYMMETRIC);
+   ComplexSparseMatrix A(A_r, A_i, true, true, conv);
+   SparseMatrix *S = A.GetSystemMatrix();
+
+   Vector x(2*n), y_sys(2*n), y_fused(2*n);
+   x.Randomize(3);
+   S->Mult(x, y_sys);
+   A.Mult(x, y_fused);
+   y_fused.Add(-1.0, y_sys);
+   REQUIRE(y_fused.Normlinf() < tol*y_sys.Normlinf());
+
+   // Repeat with the cached interleaved data, and after an entry change
+   // followed by ResetInterleavedData().
+   A.Mult(x, y_fused);
+   y_fused.Add(-1.0, y_sys);
+   REQUIRE(y_fused.Normlinf() < tol*y_sys.Normlinf());
+
+   A.real().Add(0, 0, 1.0);
+   A.ResetInterleavedData();
+   delete S;
+   S = A.GetSystemMatrix();
+   S->Mult(x, y_sys);
+   A.Mult(x, y_fused);
+   y_fused.Add(-1.0, y_sys);
+   REQUIRE(y_fused.Normlinf() < tol*y_sys.Normlinf());
+   delete S;
+}
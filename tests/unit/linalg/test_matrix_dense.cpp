@@ -293,3 +293,104 @@ TEST_CASE("DenseTensor LinearSolve methods",
       }
    }
 }
+
+TEST_CASE("DenseTensor BatchInverse",
+          "[DenseMatrix]")
+{
+   int N = 3;
+   DenseMatrix A(N);
+   A(0,0) = 4; A(0,1) =  5; A(0,2) = -2;
+   A(1,0) = 7; A(1,1) = -1; A(1,2) =  2;
+   A(2,0) = 3; A(2,1) =  1; A(2,2) =  4;
+
+   DenseMatrix Ainv(A);
+   Ainv.Invert();
+
+   int NE = 10;
+   DenseTensor A_batch(N,N,NE);
+   DenseTensor Ainv_batch(N,N,NE);
+
+   auto a_batch = mfem::Reshape(A_batch.HostWrite(),N,N,NE);
+   for (int e=0; e<NE; ++e)
+   {
+      for (int c=0; c<N; ++c)
+      {
+         for (int r=0; r<N; ++r)
+         {
+            a_batch(r, c, e) = A(r, c);
+         }
+      }
+   }
+
+   BatchInverse(A_batch, Ainv_batch);
+
+   auto ainv_batch = mfem::Reshape(Ainv_batch.HostRead(),N,N,NE);
+   for (int e=0; e<NE; ++e)
+   {
+      for (int c=0; c<N; ++c)
+      {
+         for (int r=0; r<N; ++r)
+         {
+            REQUIRE(ainv_batch(r,c,e) == MFEM_Approx(Ainv(r,c)));
+         }
+      }
+   }
+}
+
+TEST_CASE("DenseTensor multi-RHS BatchLUSolve",
+          "[DenseMatrix]")
+{
+   int N = 3;
+   const int NRHS = 2;
+   DenseMatrix A(N);
+   A(0,0) = 4; A(0,1) =  5; A(0,2) = -2;
+   A(1,0) = 7; A(1,1) = -1; A(1,2) =  2;
+   A(2,0) = 3; A(2,1) =  1; A(2,2) =  4;
+
+   double X0[3] = { -14, 42, 28 };
+   double X1[3] = { 5, -1, 7 };
+
+   int NE = 10;
+   DenseTensor A_batch(N,N,NE);
+   DenseTensor X_batch(N,NRHS,NE);
+
+   auto a_batch = mfem::Reshape(A_batch.HostWrite(),N,N,NE);
+   auto x_batch = mfem::Reshape(X_batch.HostWrite(),N,NRHS,NE);
+   for (int e=0; e<NE; ++e)
+   {
+      for (int c=0; c<N; ++c)
+      {
+         for (int r=0; r<N; ++r)
+         {
+            a_batch(r, c, e) = A(r, c);
+         }
+      }
+      for (int r=0; r<N; ++r)
+      {
+         x_batch(r,0,e) = X0[r];
+         x_batch(r,1,e) = X1[r];
+      }
+   }
+
+   Array<int> P;
+   BatchLUFactor(A_batch, P);
+   BatchLUSolve(A_batch, P, X_batch);
+
+   Vector Y0(X0, N), Y1(X1, N);
+   REQUIRE(LinearSolve(A, Y0.GetData()));
+   DenseMatrix A1(N);
+   A1(0,0) = 4; A1(0,1) =  5; A1(0,2) = -2;
+   A1(1,0) = 7; A1(1,1) = -1; A1(1,2) =  2;
+   A1(2,0) = 3; A1(2,1) =  1; A1(2,2) =  4;
+   REQUIRE(LinearSolve(A1, Y1.GetData()));
+
+   auto xans_batch = mfem::Reshape(X_batch.HostRead(),N,NRHS,NE);
+   for (int e=0; e<NE; ++e)
+   {
+      for (int r=0; r<N; ++r)
+      {
+         REQUIRE(xans_batch(r,0,e) == MFEM_Approx(Y0[r]));
+         REQUIRE(xans_batch(r,1,e) == MFEM_Approx(Y1[r]));
+      }
+   }
+}
@@ -0,0 +1,84 @@
+// Copyright (c) 2010-2020, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace
+{
+
+// SPD tridiagonal test matrix (1D Laplacian).
+SparseMatrix Laplacian1D(int n)
+{
+   SparseMatrix A(n, n);
+   for (int i = 0; i < n; i++)
+   {
+      A.Add(i, i, 2.0);
+      if (i > 0) { A.Add(i, i-1, -1.0); }
+      if (i < n-1) { A.Add(i, i+1, -1.0); }
+   }
+   A.Finalize();
+   return A;
+}
+
+}
+
+TEST_CASE("PipelinedCGSolver", "[PipelinedCGSolver]")
+{
+   const int n = 100;
+   SparseMatrix A = Laplacian1D(n);
+
+   Vector b(n);
+   b.Randomize(1);
+   Vector x_cg(n), x_pcg(n);
+   x_cg = 0.0;
+   x_pcg = 0.0;
+
+   CGSolver cg;
+   cg.SetOperator(A);
+   cg.SetRelTol(1e-12);
+   cg.SetMaxIter(500);
+   cg.Mult(b, x_cg);
+   REQUIRE(cg.GetConverged());
+
+   // Note: the fused recurrences of pipelined CG have a lower attainable
+   // accuracy than standard CG, so the tolerances below are looser than the
+   // ones used for the reference solve.
+   SECTION("unpreconditioned")
+   {
+      PipelinedCGSolver pipe;
+      pipe.SetOperator(A);
+      pipe.SetRelTol(1e-10);
+      pipe.SetMaxIter(500);
+      pipe.Mult(b, x_pcg);
+      REQUIRE(pipe.GetConverged());
+
+      x_pcg -= x_cg;
+      REQUIRE(x_pcg.Norml2() < 1e-6*x_cg.Norml2());
+   }
+
+   SECTION("preconditioned")
+   {
+      GSSmoother prec(A);
+      PipelinedCGSolver pipe;
+      pipe.SetOperator(A);
+      pipe.SetPreconditioner(prec);
+      pipe.SetRelTol(1e-10);
+      pipe.SetMaxIter(500);
+      pipe.Mult(b, x_pcg);
+      REQUIRE(pipe.GetConverged());
+
+      x_pcg -= x_cg;
+      REQUIRE(x_pcg.Norml2() < 1e-6*x_cg.Norml2());
+   }
+}